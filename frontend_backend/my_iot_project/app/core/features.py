@@ -0,0 +1,49 @@
+"""
+SIESPRO - Feature Schema
+Generated by hardware/schema/generate_schema.py from hardware/schema/features.json, do not edit.
+
+The features the Random Forest is trained on and the schemas, the sets of them
+a node can send, the same tables the firmware builds against in LTFeatures.h.
+"""
+
+FEATURES = {
+    1: {"key": "temperatura", "serial": "temp_C", "dataset": "temp_C", "type": "int16", "scale": 100, "link": False},
+    2: {"key": "humedad_relativa", "serial": "hum_air_pct", "dataset": "hum_aire_pct", "type": "uint8", "scale": 2, "link": False},
+    3: {"key": "humedad_suelo", "serial": "soil_moisture_pct", "dataset": "hum_tierra_pct", "type": "uint8", "scale": 1, "link": False},
+    4: {"key": "rssi", "serial": "rssi_dBm", "dataset": "rssi_dBm", "type": "int16", "scale": 1, "link": True},
+    5: {"key": "snr", "serial": "snr_dB", "dataset": "snr_dB", "type": "int8", "scale": 1, "link": True},
+}
+
+SCHEMAS = {
+    1: {"name": "2S", "sensors": "DHT11", "features": [1, 2, 4, 5]},
+    2: {"name": "3S", "sensors": "DHT11 + HW-080", "features": [1, 2, 3, 4, 5]},
+}
+
+MODEL_SCHEMA   = 1      # schema the backend model is trained on
+DEFAULT_SCHEMA = 1
+
+
+def schema_keys(schema_id):
+    """Backend JSON keys of the features of a schema, in order."""
+    return [FEATURES[i]["key"] for i in SCHEMAS[schema_id]["features"]]
+
+
+def schema_serial_columns(schema_id):
+    """Columns of the CSV line the master prints for a schema."""
+    return [FEATURES[i]["serial"] for i in SCHEMAS[schema_id]["features"]]
+
+
+def schema_dataset_columns(schema_id):
+    """Columns of the dataset CSV for a schema, between timestamp_iso and label."""
+    return [FEATURES[i]["dataset"] for i in SCHEMAS[schema_id]["features"]]
+
+
+def dataset_to_key():
+    """Dataset CSV column to backend JSON key, for every feature."""
+    return {f["dataset"]: f["key"] for f in FEATURES.values()}
+
+
+def schema_for_field_count(count):
+    """Schema with count features, None if none or more than one has."""
+    found = [i for i, s in SCHEMAS.items() if len(s["features"]) == count]
+    return found[0] if len(found) == 1 else None
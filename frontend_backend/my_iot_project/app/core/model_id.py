@@ -0,0 +1,18 @@
+"""
+SIESPRO - Identificador del modelo
+
+Los primeros 4 bytes del SHA-256 de ml/rf_model.pkl seguido de ml/preprocessor.pkl,
+en 8 cifras hexadecimales. export_forest.py lo escribe en LTForestModel.h como
+LTForestModelID y el hub lo manda con cada predicción ("model_id"); el backend
+solo guarda la predicción del hub si coincide con el de los .pkl que tiene cargados.
+"""
+
+import hashlib
+
+
+def model_id(model_path: str, preprocessor_path: str) -> str:
+    digest = hashlib.sha256()
+    for path in (model_path, preprocessor_path):
+        with open(path, "rb") as file:
+            digest.update(file.read())
+    return digest.hexdigest()[:8]
@@ -1,11 +1,11 @@
 from fastapi import APIRouter, Depends
 from sqlalchemy.orm import Session
 from sqlalchemy import text
-from typing import List
+from typing import List, Union
 from datetime import datetime, timezone
 
 from app.core.database import get_db
-from app.schemas.sensor import SensorInput, DeviceStatus
+from app.schemas.sensor import SensorInput, SensorBatch, DeviceStatus
 from app.models.sensor import SensorData
 from app.services.ml_service import ml_service
 
@@ -13,37 +13,70 @@ router = APIRouter(prefix="/sensors", tags=["Sensors"])
 
 # ID por defecto para la demo
 DEMO_ID = "MANILLA-DEMO-01"
+
+# Las muestras con timestamp se guardan a la hora en que se leyeron, las demás a la hora de llegada
+def read_time(sample: SensorInput) -> dict:
+    if sample.timestamp is None:
+        return {}
+    return {"created_at": datetime.fromtimestamp(sample.timestamp, timezone.utc)}
+
 @router.post("/data")
-def receive_sensor_data(data: SensorInput, db: Session = Depends(get_db)):
+def receive_sensor_data(data: Union[SensorBatch, SensorInput], db: Session = Depends(get_db)):
+    # Acepta una muestra o un lote {"samples": [...]} del hub, el lote se guarda en una sola transacción
+    samples = data.samples if isinstance(data, SensorBatch) else [data]
+
     try:
-        # 1. Predicción (El servicio ML también debe actualizarse, ver abajo)
+        # 1. Predicción: la del hub si la hizo con el mismo modelo (model_id, export_forest.py),
+        #    si no la trae o es de otro modelo la calcula el backend
+        same_model = lambda s: ml_service.model_id is not None and s.model_id == ml_service.model_id
+        predictions = [s.prediction if same_model(s) else None for s in samples]
+        pending = [i for i, p in enumerate(predictions) if p is None]
+        stale = [samples[i].model_id for i in pending if samples[i].prediction is not None]
+        if stale:
+            print(f"⚠️ {len(stale)} predicciones del hub con otro modelo, recalculadas (hub {stale[0]}, backend {ml_service.model_id})")
         try:
-            prediction_result = ml_service.predict(data.dict())
+            if pending:
+                computed = ml_service.predict_batch([samples[i].dict(exclude={"bracelet_id", "timestamp", "prediction", "model_id"}) for i in pending])
+                for i, p in zip(pending, computed):
+                    predictions[i] = p
         except Exception as e:
             print(f"❌ Error en ML: {e}")
-            prediction_result = -1 
+            for i in pending:
+                predictions[i] = -1
 
-        # 2. Crear objeto (SIN humedad_suelo)
-        db_sensor = SensorData(
-            bracelet_id=DEMO_ID,
-            temperatura=data.temperatura,
-            humedad_relativa=data.humedad_relativa,
-            # humedad_suelo=data.humedad_suelo, <-- ELIMINADO
-            rssi=data.rssi,
-            snr=data.snr,
-            prediction=prediction_result
-        )
+        # 2. Crear objetos (SIN humedad_suelo)
+        db_sensors = [
+            SensorData(
+                bracelet_id=sample.bracelet_id or DEMO_ID,
+                temperatura=sample.temperatura,
+                humedad_relativa=sample.humedad_relativa,
+                # humedad_suelo=sample.humedad_suelo, <-- ELIMINADO
+                rssi=sample.rssi,
+                snr=sample.snr,
+                prediction=prediction,
+                **read_time(sample)
+            )
+            for sample, prediction in zip(samples, predictions)
+        ]
         
         # 3. Guardar en DB
-        db.add(db_sensor)
+        db.add_all(db_sensors)
         db.commit()
-        db.refresh(db_sensor)
+
+        if isinstance(data, SensorBatch):
+            return {
+                "status": "ok",
+                "count": len(db_sensors),
+                "predictions": predictions
+            }
+
+        db.refresh(db_sensors[0])
         
         return {
             "status": "ok",
-            "bracelet_id": db_sensor.bracelet_id,
-            "prediction": prediction_result,
-            "saved_at": db_sensor.created_at
+            "bracelet_id": db_sensors[0].bracelet_id,
+            "prediction": predictions[0],
+            "saved_at": db_sensors[0].created_at
         }
 
     except Exception as e:
@@ -52,7 +85,7 @@ def receive_sensor_data(data: SensorInput, db: Session = Depends(get_db)):
         import traceback
         return {"status": "error", "detail": str(e)}
     
-# --- El endpoint Monitor queda igual, pero ahora solo verá la MANILLA-DEMO-01 ---
+# --- El endpoint Monitor muestra la última lectura de cada manilla ---
 OFFLINE_THRESHOLD_SECONDS = 120 
 
 @router.get("/monitor", response_model=List[DeviceStatus])
@@ -1,12 +1,44 @@
 from pydantic import BaseModel, Field
 from datetime import datetime
+from typing import List, Optional
 
 class SensorInput(BaseModel):
     temperatura: float = Field(..., example=21.0)
     humedad_relativa: float = Field(..., example=54.7)
-    # humedad_suelo: ELIMINADO
+    # Solo en muestras de nodos con sensor de suelo (esquema 3S); no la usa el modelo 2S ni se guarda
+    humedad_suelo: Optional[float] = Field(None, example=35)
     rssi: int = Field(..., example=-47)
     snr: int = Field(..., example=9)
+    # Enviado por el hub cuando sondea varias manillas, si falta se usa la de la demo
+    bracelet_id: Optional[str] = Field(None, example="MANILLA-3210")
+    # Hora de la lectura en segundos desde 1970 (UTC), la envía el hub cuando la muestra
+    # llega tarde desde su registro en FRAM; si falta se usa la hora de llegada
+    timestamp: Optional[int] = Field(None, example=1760000000)
+    # Esquema de variables de la muestra, app/core/features.py; si falta es DEFAULT_SCHEMA
+    schema_id: Optional[int] = Field(None, example=1)
+    # Clase que el hub ya calculó (LTForest.h, export_forest.py) y el modelo con que lo hizo,
+    # LTForestModelID (app/core/model_id.py); si falta o el modelo no es el del backend, la
+    # calcula el backend
+    prediction: Optional[int] = Field(None, example=0)
+    model_id: Optional[str] = Field(None, example="1a2b3c4d")
+    # Estadísticas del enlace en las últimas consultas de la manilla (LTLinkStats.h en el hub),
+    # en dB a una décima; el modelo actual no las usa, quedan disponibles para entrenar con ellas
+    rssi_ewma: Optional[float] = Field(None, example=-47.3)
+    rssi_median: Optional[float] = Field(None, example=-47.5)
+    rssi_std: Optional[float] = Field(None, example=2.1)
+    rssi_min: Optional[int] = Field(None, example=-51)
+    rssi_max: Optional[int] = Field(None, example=-44)
+    snr_ewma: Optional[float] = Field(None, example=8.8)
+    snr_median: Optional[float] = Field(None, example=9.0)
+    snr_std: Optional[float] = Field(None, example=0.7)
+    snr_min: Optional[int] = Field(None, example=8)
+    snr_max: Optional[int] = Field(None, example=10)
+    loss_pct: Optional[int] = Field(None, example=12)
+    link_samples: Optional[int] = Field(None, example=8)
+
+# Lote de muestras que el hub envía en una sola petición
+class SensorBatch(BaseModel):
+    samples: List[SensorInput] = Field(..., min_length=1, max_length=64)
 
 class SensorResponse(BaseModel):
     status: str
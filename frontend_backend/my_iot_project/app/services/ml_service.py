@@ -2,10 +2,14 @@ import joblib
 import pandas as pd
 import os
 
+from app.core.features import MODEL_SCHEMA, schema_keys
+from app.core.model_id import model_id
+
 class MLService:
     def __init__(self):
         self.model = None
         self.preprocessor = None
+        self.model_id = None   # el de los .pkl cargados, el hub manda el de su LTForestModel.h
         self.model_path = "ml/rf_model.pkl"
         self.preprocessor_path = "ml/preprocessor.pkl"
         self.load_models()
@@ -24,33 +28,45 @@ class MLService:
                 print(f"✅ Preprocesador cargado desde {self.preprocessor_path}")
             else:
                 print(f"⚠️ No se encontró {self.preprocessor_path}")
+
+            self.model_id = None
+            if self.model and self.preprocessor:
+                self.model_id = model_id(self.model_path, self.preprocessor_path)
+                print(f"✅ Modelo {self.model_id}")
                 
         except Exception as e:
             print(f"❌ Error cargando modelos: {e}")
 
     def predict(self, data: dict) -> int:
+        return self.predict_batch([data])[0]
+
+    def predict_batch(self, rows: list) -> list:
+        """Una predicción por fila, el modelo se llama una sola vez para todo el lote"""
+        predictions = [-1] * len(rows)
         if not self.model:
-            return -1
+            return predictions
         
         try:
-            df = pd.DataFrame([data])
-            
-            # ⚠️ AQUÍ ESTÁ EL ERROR: Seguramente todavía tienes 'humedad_suelo' aquí.
-            # ✅ CORRECCIÓN: Deja SOLO estas 4 variables:
-            features = ['temperatura', 'humedad_relativa', 'rssi', 'snr']
-            
-            # Seleccionar solo las columnas que existen
-            X = df[features]
+            # Las variables del esquema con que se entrenó el modelo (app/core/features.py,
+            # generado de hardware/schema/features.json), en su orden. Las filas de otro
+            # esquema sirven si traen todas; a las que les falta alguna les toca -1.
+            features = schema_keys(MODEL_SCHEMA)
+            usable = [i for i, row in enumerate(rows) if all(row.get(k) is not None for k in features)]
+            if not usable:
+                return predictions
+
+            X = pd.DataFrame([rows[i] for i in usable])[features]
 
             if self.preprocessor:
                 X = self.preprocessor.transform(X)
 
-            prediction = self.model.predict(X)
-            return int(prediction[0])
+            for i, p in zip(usable, self.model.predict(X)):
+                predictions[i] = int(p)
+            return predictions
         except Exception as e:
             # Este es el print que estás viendo en tu consola
             print(f"Error en predicción: {e}")
-            return -1
+            return [-1] * len(rows)
 
 # Instancia global
 ml_service = MLService()
\ No newline at end of file
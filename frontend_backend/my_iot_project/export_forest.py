@@ -0,0 +1,341 @@
+"""
+SIESPRO - Exportador del Random Forest al hub
+Convierte el modelo entrenado (ml/rf_model.pkl y ml/preprocessor.pkl, de
+train_real_model.py) en las tablas que usa LTForest.h para clasificar en el
+ESP32 maestro, sin pasar por el backend:
+
+  hardware/library/SX12XX-LoRa-master/src/LTForestModel.h                 nodos, hojas y raices
+  hardware/library/SX12XX-LoRa-master/extras/host/Forest_Reference.csv    predicciones de referencia
+
+El escalado del StandardScaler se pliega en los umbrales: el hub compara la
+lectura en centesimas (int16) con un umbral entero, elegido para que la
+comparacion de el mismo lado que la de scikit-learn (escalado en float64,
+paso a float32, x <= umbral) para toda entrada en centesimas. Las hojas
+guardan las probabilidades que da predict_proba() de cada arbol, para sumar en
+el mismo orden que el bosque cuando hace falta el resultado exacto. LTForestModelID
+identifica los .pkl exportados (app/core/model_id.py); el hub lo manda con cada
+prediccion y el backend no guarda la de otro modelo.
+
+Los .pkl se cargan con joblib y scikit-learn, como en ml_service.py, y los
+arboles se leen de estimators_[i].tree_. Las predicciones de Forest_Reference.csv
+salen de model.predict(). Correr despues de train_real_model.py y hacer commit de los archivos generados
+con el modelo.
+
+Uso (desde my_iot_project):
+  python export_forest.py           escribe los archivos
+  python export_forest.py --check   sale con 1 si no estan al dia con el modelo
+"""
+
+import csv
+import os
+import struct
+import sys
+from decimal import Decimal
+
+import joblib
+import pandas as pd
+
+from app.core.features import FEATURES, MODEL_SCHEMA, SCHEMAS, dataset_to_key, schema_keys
+from app.core.model_id import model_id
+
+HERE    = os.path.dirname(os.path.abspath(__file__))
+REPO    = os.path.dirname(os.path.dirname(HERE))
+LIBRARY = os.path.join(REPO, "hardware", "library", "SX12XX-LoRa-master")
+
+MODEL_PATH        = os.path.join(HERE, "ml", "rf_model.pkl")
+PREPROCESSOR_PATH = os.path.join(HERE, "ml", "preprocessor.pkl")
+HEADER_PATH       = os.path.join(LIBRARY, "src", "LTForestModel.h")
+REFERENCE_PATH    = os.path.join(LIBRARY, "extras", "host", "Forest_Reference.csv")
+
+DATASETS = [  # CSV grabados, ruta y nombre en Forest_Reference.csv
+    (os.path.join(HERE, "dataset.csv"), "dataset"),
+    (os.path.join(REPO, "hardware", "master_esp32", "IA_config", "dataset_tool", "mediciones_loRa_[2s].csv"), "2s"),
+    (os.path.join(REPO, "hardware", "master_esp32", "IA_config", "dataset_tool", "mediciones_loRa_[3s].csv"), "3s"),
+]
+
+INPUT_SCALE = 100      # el hub pasa las lecturas en centesimas
+INPUT_MAX   = 32767    # int16, -32767 a 32767
+LEAF_FLAG   = 0x8000   # indice de hoja en LTForestNode.child y las raices
+
+FEATURE_DEFINES = {1: "LTFeatureTemperature", 2: "LTFeatureHumidity", 3: "LTFeatureSoil",
+                   4: "LTFeatureRSSI", 5: "LTFeatureSNR"}
+
+MIT_LICENSE = """/*
+  MIT license
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+  associated documentation files (the "Software"), to deal in the Software without restriction, including
+  without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the
+  following conditions:
+
+  The above copyright notice and this permission notice shall be included in all copies or substantial
+  portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+  LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO
+  EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+  IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE
+  USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+"""
+
+
+# --- Lectura del modelo -----------------------------------------------------------
+
+def load_model():
+    model  = joblib.load(MODEL_PATH)
+    scaler = joblib.load(PREPROCESSOR_PATH)
+
+    features = schema_keys(MODEL_SCHEMA)
+    names    = list(getattr(scaler, "feature_names_in_", features))
+    if names != features:
+        sys.exit(f"El preprocesador tiene {names}, el esquema del modelo {features}: correr train_real_model.py")
+    if model.n_outputs_ != 1 or model.n_features_in_ != len(features):
+        sys.exit("Solo se exporta un clasificador de una salida con las features del esquema del modelo")
+
+    classes = [int(c) for c in model.classes_]
+    if not 2 <= len(classes) <= 8:
+        sys.exit("LTForest.h clasifica entre 2 y 8 clases (LTForestMaxClasses)")
+    trees   = []
+    for estimator in model.estimators_:
+        tree = estimator.tree_
+        # las hojas como las devuelve DecisionTreeClassifier.predict_proba(), value normalizado por su suma
+        value = tree.value[:, 0, :]
+        total = value.sum(axis=1, keepdims=True)
+        total[total == 0] = 1
+        proba = value / total
+        trees.append({
+            "left":      [int(n) for n in tree.children_left],
+            "right":     [int(n) for n in tree.children_right],
+            "feature":   [int(f) for f in tree.feature],
+            "threshold": [float(v) for v in tree.threshold],
+            "value":     [tuple(float(p) for p in row) for row in proba],
+        })
+
+    return {
+        "trees":    trees,
+        "classes":  classes,
+        "features": features,
+        "mean":     [float(v) for v in scaler.mean_] if scaler.with_mean else [0.0] * len(features),
+        "scale":    [float(v) for v in scaler.scale_] if scaler.with_std else [1.0] * len(features),
+    }
+
+
+# --- Aritmetica de scikit-learn y del hub -----------------------------------------
+
+def float32(value):
+    return struct.unpack("f", struct.pack("f", value))[0]
+
+
+def scaled(forest, feature, value):
+    """StandardScaler.transform() en float64, luego el float32 con que compara el arbol"""
+    return float32((value - forest["mean"][feature]) / forest["scale"][feature])
+
+
+def quantize(forest, feature, threshold):
+    """Mayor entrada v en centesimas con scaled(v / 100) <= threshold, el hub va a la derecha si v > umbral.
+       scaled() no decrece con v, asi que las entradas que van a la izquierda son un prefijo."""
+    low, high = -INPUT_MAX, INPUT_MAX
+    if scaled(forest, feature, low / INPUT_SCALE) > threshold:
+        return -INPUT_MAX - 1                          # todas a la derecha
+    while low < high:
+        middle = (low + high + 1) // 2
+        if scaled(forest, feature, middle / INPUT_SCALE) <= threshold:
+            low = middle
+        else:
+            high = middle - 1
+    return low
+
+
+def predict_sklearn(rows):
+    model  = joblib.load(MODEL_PATH)
+    scaler = joblib.load(PREPROCESSOR_PATH)
+    X = pd.DataFrame(rows, columns=schema_keys(MODEL_SCHEMA))
+    return [int(p) for p in model.predict(scaler.transform(X))]
+
+
+def flatten(forest):
+    """Nodos internos de todos los arboles en un array, las hojas iguales una sola vez"""
+    nodes, roots, leaves, leaf_index = [], [], [], {}
+
+    def add(tree, node):
+        if tree["left"][node] == -1:
+            value = tree["value"][node]
+            if value not in leaf_index:
+                leaf_index[value] = len(leaves)
+                leaves.append(value)
+            return LEAF_FLAG | leaf_index[value]
+        index = len(nodes)
+        feature = tree["feature"][node]
+        nodes.append([quantize(forest, feature, tree["threshold"][node]), feature, 0, 0])
+        nodes[index][2] = add(tree, tree["left"][node])
+        nodes[index][3] = add(tree, tree["right"][node])
+        return index
+
+    for tree in forest["trees"]:
+        roots.append(add(tree, 0))
+
+    if len(nodes) >= LEAF_FLAG or len(leaves) >= LEAF_FLAG:
+        sys.exit("El bosque no cabe en indices de 15 bits")
+    return nodes, roots, leaves
+
+
+def predict_flat(forest, nodes, roots, leaves, inputs):
+    """Lo que hace LTForest::predictExact() en el hub"""
+    total = [0.0] * len(forest["classes"])
+    for root in roots:
+        index = root
+        while not index & LEAF_FLAG:
+            threshold, feature, left, right = nodes[index]
+            index = right if inputs[feature] > threshold else left
+        for c, p in enumerate(leaves[index & ~LEAF_FLAG]):
+            total[c] += p
+    total = [t / len(roots) for t in total]
+    return forest["classes"][total.index(max(total))]
+
+
+def to_input(text):
+    """Lectura del CSV en centesimas, exacta, los CSV traen un decimal"""
+    value = Decimal(text) * INPUT_SCALE
+    if value != value.to_integral_value() or abs(value) > INPUT_MAX:
+        sys.exit(f"Lectura {text} fuera de las centesimas de int16")
+    return int(value)
+
+
+def load_rows(forest):
+    """Las filas de los CSV grabados con las features del modelo, sin repetir entradas"""
+    columns = {key: column for column, key in dataset_to_key().items()}
+    rows, seen = [], set()
+    for path, source in DATASETS:
+        with open(path, newline="") as file:
+            for record in csv.DictReader(file):
+                inputs = tuple(to_input(record[columns[key]]) for key in forest["features"])
+                if inputs not in seen:
+                    seen.add(inputs)
+                    rows.append((source, inputs))
+    return rows
+
+
+# --- Salida -----------------------------------------------------------------------
+
+def fixed_shift(trees):
+    """Bits de fraccion de las probabilidades en punto fijo, la suma de todos los arboles cabe en int32"""
+    return 31 - trees.bit_length() - 1
+
+
+def render_header(forest, nodes, roots, leaves):
+    trees   = len(roots)
+    classes = forest["classes"]
+    shift   = fixed_shift(trees)
+    ids     = {feature["key"]: feature_id for feature_id, feature in FEATURES.items()}
+    inputs  = [FEATURE_DEFINES[ids[key]] for key in forest["features"]]
+
+    lines = [
+        "/*",
+        "  Licensed under a MIT license displayed at the bottom of this document.",
+        "  Original published 16/10/26, Random Forest model for LTForest.h",
+        "",
+        "  Generated by frontend_backend/my_iot_project/export_forest.py from ml/rf_model.pkl and",
+        "  ml/preprocessor.pkl, do not edit.",
+        "*/",
+        "",
+        "/*",
+        f"  {trees} trees, {len(nodes)} split nodes and {len(leaves)} distinct leaves, classes {', '.join(map(str, classes))}.",
+        f"  Inputs are the features of schema {SCHEMAS[MODEL_SCHEMA]['name']} in hundredths, in LTForestInputFeature[] order; the",
+        "  StandardScaler of the backend is folded into the thresholds.",
+        "*/",
+        "",
+        "#ifndef LTForestModel_h",
+        "#define LTForestModel_h",
+        "",
+        "#include <LTForest.h>",
+        "#include <LTFeatures.h>",
+        "",
+        f"#define LTForestSchema {MODEL_SCHEMA}",
+        f"#define LTForestModelID 0x{model_id(MODEL_PATH, PREPROCESSOR_PATH).upper()}UL".ljust(44) + "//app/core/model_id.py of the .pkl files, sent as \"model_id\"",
+        f"#define LTForestInputs {len(inputs)}",
+        f"#define LTForestTrees {trees}",
+        f"#define LTForestClasses {len(classes)}",
+        "",
+        f"const uint8_t LTForestInputFeature[LTForestInputs] = {{{', '.join(inputs)}}};",
+        "",
+        f"const int16_t LTForestLabels[LTForestClasses] = {{{', '.join(map(str, classes))}}};",
+        "",
+        f"const uint16_t LTForestRoots[LTForestTrees] =",
+        "{",
+    ]
+    lines += wrap([f"0x{root:04X}" for root in roots])
+    lines += ["};", "", f"const LTForestNode LTForestNodes[{len(nodes)}] =", "{"]
+    lines += wrap([f"{{{{0x{left:04X}, 0x{right:04X}}}, {threshold}, {feature}}}"
+                   for threshold, feature, left, right in nodes], 4)
+    lines += ["};", "", f"const int32_t LTForestLeafFixed[{len(leaves)} * LTForestClasses] =", "{"]
+    lines += wrap([str(round(p * (1 << shift))) for leaf in leaves for p in leaf])
+    lines += ["};", "", f"const double LTForestLeafProba[{len(leaves)} * LTForestClasses] =", "{"]
+    lines += wrap([repr(float(p)) for leaf in leaves for p in leaf], 6)
+    lines += [
+        "};",
+        "",
+        "const LTForestModel LTForestSIESPRO =",
+        "{",
+        "  LTForestTrees, LTForestInputs, LTForestClasses,",
+        f"  {shift}, {trees + 1},".ljust(44) + "//fixed point bits, one unit per tree of margin",
+        "  LTForestNodes, LTForestRoots, LTForestLeafFixed, LTForestLeafProba, LTForestLabels",
+        "};",
+        "",
+        f"static_assert(LTForestSchema == LTSchemaModel, \"LTForestModel.h out of step with features.json\");",
+        "",
+        "#endif",
+        "",
+    ]
+    return "\n".join(lines) + "\n" + MIT_LICENSE
+
+
+def wrap(items, per_line=8):
+    rows = [items[i:i + per_line] for i in range(0, len(items), per_line)]
+    return ["  " + ", ".join(row) + ("," if index < len(rows) - 1 else "") for index, row in enumerate(rows)]
+
+
+def render_reference(forest, rows, expected):
+    lines = ["source," + ",".join(forest["features"]) + ",prediction"]
+    for (source, inputs), label in zip(rows, expected):
+        lines.append(",".join([source] + [str(v) for v in inputs] + [str(label)]))
+    return "\n".join(lines) + "\n"
+
+
+def main():
+    check  = "--check" in sys.argv[1:]
+    forest = load_model()
+    nodes, roots, leaves = flatten(forest)
+    rows   = load_rows(forest)
+
+    expected = predict_sklearn([[v / INPUT_SCALE for v in inputs] for _, inputs in rows])
+    outputs  = [(HEADER_PATH, render_header(forest, nodes, roots, leaves)),
+                (REFERENCE_PATH, render_reference(forest, rows, expected))]
+
+    wrong = sum(predict_flat(forest, nodes, roots, leaves, inputs) != label
+                for (_, inputs), label in zip(rows, expected))
+    if wrong:
+        sys.exit(f"❌ El bosque exportado difiere en {wrong} de {len(rows)} filas")
+
+    stale = 0
+    for path, text in outputs:
+        current = open(path, encoding="utf-8", newline="").read() if os.path.exists(path) else None
+        if current == text:
+            continue
+        stale += 1
+        if check:
+            print(f"Desactualizado: {os.path.relpath(path, REPO)}")
+        else:
+            with open(path, "w", encoding="utf-8", newline="") as file:
+                file.write(text)
+            print(f"Escrito: {os.path.relpath(path, REPO)}")
+
+    print(f"✅ {len(roots)} arboles, {len(nodes)} nodos, {len(leaves)} hojas distintas, "
+          f"{len(rows)} filas iguales a predict() de scikit-learn")
+    if check and stale:
+        sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
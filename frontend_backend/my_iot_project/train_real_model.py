@@ -5,22 +5,18 @@ from sklearn.preprocessing import StandardScaler
 from sklearn.model_selection import train_test_split
 from sklearn.metrics import classification_report, confusion_matrix
 
+from app.core.features import MODEL_SCHEMA, SCHEMAS, dataset_to_key, schema_keys
+
 print("🔄 Cargando dataset.csv...")
 df = pd.read_csv('dataset.csv')
 
-# Mapeo (Quitamos humedad_tierra_pct si existía en tu CSV original)
-column_mapping = {
-    'temp_C': 'temperatura',
-    'hum_aire_pct': 'humedad_relativa',
-    # 'hum_tierra_pct': 'humedad_suelo', <-- IGNORAMOS ESTA COLUMNA DEL CSV
-    'rssi_dBm': 'rssi',
-    'snr_dB': 'snr',
-    'label': 'target'
-}
+# Mapeo de las columnas del CSV a las claves del backend, de app/core/features.py
+# (generado de hardware/schema/features.json, las mismas tablas que el firmware)
+column_mapping = dict(dataset_to_key(), label='target')
 df = df.rename(columns=column_mapping)
 
-# Definir features (SIN SUELO)
-features = ['temperatura', 'humedad_relativa', 'rssi', 'snr']
+# Features del esquema del modelo (MODEL_SCHEMA), las columnas de otros sensores se ignoran
+features = schema_keys(MODEL_SCHEMA)
 
 X = df[features]
 y = df['target']
@@ -34,7 +30,7 @@ X_train_scaled = scaler.fit_transform(X_train)
 X_test_scaled = scaler.transform(X_test)
 
 # Entrenar
-print("🧠 Entrenando Random Forest (Sin Humedad Suelo)...")
+print(f"🧠 Entrenando Random Forest (esquema {SCHEMAS[MODEL_SCHEMA]['name']}: {', '.join(features)})...")
 rf = RandomForestClassifier(n_estimators=100, random_state=42)
 rf.fit(X_train_scaled, y_train)
 
@@ -54,4 +50,5 @@ final_model.fit(X_scaled_full, y)
 joblib.dump(final_model, 'ml/rf_model.pkl')
 joblib.dump(full_scaler, 'ml/preprocessor.pkl')
 
-print("✅ Nuevos modelos generados en /ml (4 features)")
\ No newline at end of file
+print(f"✅ Nuevos modelos generados en /ml ({len(features)} features)")
+print("ℹ️ Correr export_forest.py para llevar el modelo al hub (LTForestModel.h)")
\ No newline at end of file
@@ -0,0 +1,141 @@
+/*******************************************************************************************************
+  Programs for Arduino - 16/10/26
+
+  This program is supplied as is, it is up to the user of the program to decide if the program is
+  suitable for the intended purpose and free from errors.
+*******************************************************************************************************/
+
+
+/*******************************************************************************************************
+  Program Operation - This program checks the table driven CRC16 CCITT engine in LTCRC.h against the
+  original bit by bit CRC calculation used by the library, and times both. No LoRa device is needed.
+
+  A test array is filled with pseudo random data and the CRC of the array is calculated with the original
+  shift and XOR loop and with LTCRCCCITTUpdate(). The array is then CRC'd again in 245 byte segments, the
+  same size as an ARtransfer data segment, passing the running CRC from one segment to the next, to check
+  the incremental CRC gives the same result as a single pass. All three results must match, and the CRC of
+  the standard check string '123456789' must be 0x29B1.
+
+  The engine variant can be changed by adding one of these defines before the #include <LTCRC.h>;
+  LTCRC_BITWISE, LTCRC_NIBBLE, LTCRC_TABLE, LTCRC_SLICE4, LTCRC_SLICE8
+
+  Serial monitor baud rate is set at 9600
+*******************************************************************************************************/
+
+#include <LTCRC.h>
+
+#if defined(__AVR__)
+const uint16_t testsize = 1024;               //size of test array, smaller for AVR
+#else
+const uint16_t testsize = 16384;              //size of test array
+#endif
+
+const uint8_t segmentsize = 245;              //segment size for the incremental CRC check
+const uint8_t loops = 10;                     //number of times to repeat each CRC for timing
+
+uint8_t testarray[testsize];
+
+
+uint16_t bitwiseCRC(uint8_t *buffer, uint32_t size, uint16_t startvalue)
+{
+  //the original CRC calculation used by the library
+  uint32_t index;
+  uint16_t libraryCRC;
+  uint8_t j;
+
+  libraryCRC = startvalue;                                  //start value for CRC16
+
+  for (index = 0; index < size; index++)
+  {
+    libraryCRC ^= (((uint16_t)buffer[index]) << 8);
+    for (j = 0; j < 8; j++)
+    {
+      if (libraryCRC & 0x8000)
+        libraryCRC = (libraryCRC << 1) ^ 0x1021;
+      else
+        libraryCRC <<= 1;
+    }
+  }
+
+  return libraryCRC;
+}
+
+
+void loop()
+{
+  uint8_t index;
+  uint16_t CRCbitwise, CRCengine, CRCsegments, CRCcheck, length;
+  uint32_t startuS, bitwiseuS, engineuS, position;
+
+  startuS = micros();
+  for (index = 0; index < loops; index++)
+  {
+    CRCbitwise = bitwiseCRC(testarray, testsize, 0xFFFF);
+  }
+  bitwiseuS = micros() - startuS;
+
+  startuS = micros();
+  for (index = 0; index < loops; index++)
+  {
+    CRCengine = LTCRCCCITTUpdate(0xFFFF, testarray, testsize);
+  }
+  engineuS = micros() - startuS;
+
+  CRCsegments = 0xFFFF;
+
+  for (position = 0; position < testsize; position = position + length)
+  {
+    length = ((testsize - position) < segmentsize) ? (testsize - position) : segmentsize;
+    CRCsegments = LTCRCCCITTUpdate(CRCsegments, testarray + position, length);
+  }
+
+  CRCcheck = LTCRCCCITTUpdate(0xFFFF, (const uint8_t *) "123456789", 9);
+
+  Serial.print(F("Array size "));
+  Serial.print(testsize);
+  Serial.println(F(" bytes"));
+  Serial.print(F("Bitwise CRC 0x"));
+  Serial.print(CRCbitwise, HEX);
+  Serial.print(F("  "));
+  Serial.print(bitwiseuS / loops);
+  Serial.println(F("uS"));
+  Serial.print(F("Engine CRC 0x"));
+  Serial.print(CRCengine, HEX);
+  Serial.print(F("  "));
+  Serial.print(engineuS / loops);
+  Serial.println(F("uS"));
+  Serial.print(F("Segmented CRC 0x"));
+  Serial.println(CRCsegments, HEX);
+  Serial.print(F("Check CRC 0x"));
+  Serial.println(CRCcheck, HEX);
+
+  if ((CRCbitwise == CRCengine) && (CRCbitwise == CRCsegments) && (CRCcheck == 0x29B1))
+  {
+    Serial.println(F("CRC engine OK"));
+  }
+  else
+  {
+    Serial.println(F("ERROR - CRC engine mismatch"));
+  }
+
+  Serial.println();
+  delay(5000);
+}
+
+
+void setup()
+{
+  uint16_t index;
+
+  Serial.begin(9600);
+  Serial.println();
+  Serial.println(F("44_CRC_Engine_Check Starting"));
+  Serial.println();
+
+  randomSeed(1);
+
+  for (index = 0; index < testsize; index++)
+  {
+    testarray[index] = random(256);
+  }
+}
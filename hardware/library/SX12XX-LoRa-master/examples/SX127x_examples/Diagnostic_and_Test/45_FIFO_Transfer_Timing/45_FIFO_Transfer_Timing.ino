@@ -0,0 +1,174 @@
+/*******************************************************************************************************
+  Programs for Arduino - 16/10/26
+
+  This program is supplied as is, it is up to the user of the program to decide if the program is
+  suitable for the intended purpose and free from errors.
+*******************************************************************************************************/
+
+
+/*******************************************************************************************************
+  Program Operation - This program times loading and unloading the FIFO of an SX127X for packet sizes from
+  8 to 255 bytes. Nothing is transmitted.
+
+  Each load is startWriteSXBuffer(), the data, endWriteSXBuffer(), and each unload the same with the read
+  functions. The data is moved first with one SPI.transfer() per byte, as the library used to, then with
+  writeBufferbytes() and readBufferbytes(), which use the block transfers in LTSPI.h. On the ESP32 and
+  ESP8266 these hand the whole packet to the SPI peripheral in one call, other processors still move a
+  byte at a time so the two times are much the same. The data read back is checked against the data
+  written.
+
+  The pins used are for the SIESPRO ESP32 master board, change them to match your own setup.
+
+  Serial monitor baud rate is set at 115200
+*******************************************************************************************************/
+
+#include <SPI.h>
+#include <SX127XLT.h>
+
+#define NSS 5                                   //select on LoRa device
+#define NRESET 14                               //reset on LoRa device
+#define DIO0 2                                  //DIO0 on LoRa device, used for RX and TX done
+#define LORA_DEVICE DEVICE_SX1278               //this is the device we are using
+
+const uint8_t packetsizes[] = {8, 16, 32, 64, 128, 255};
+const uint16_t loops = 100;                     //number of times to repeat each transfer for timing
+
+SX127XLT LT;
+
+uint8_t txbuffer[255];
+uint8_t rxbuffer[255];
+
+
+void loadBytewise(uint8_t size)
+{
+  uint8_t index;
+
+  LT.startWriteSXBuffer(0);
+
+  for (index = 0; index < size; index++)
+  {
+    SPI.transfer(txbuffer[index]);
+  }
+
+  LT.endWriteSXBuffer();
+}
+
+
+void unloadBytewise(uint8_t size)
+{
+  uint8_t index;
+
+  LT.startReadSXBuffer(0);
+
+  for (index = 0; index < size; index++)
+  {
+    rxbuffer[index] = SPI.transfer(0);
+  }
+
+  LT.endReadSXBuffer();
+}
+
+
+void loadBlock(uint8_t size)
+{
+  LT.startWriteSXBuffer(0);
+  LT.writeBufferbytes(txbuffer, size);
+  LT.endWriteSXBuffer();
+}
+
+
+void unloadBlock(uint8_t size)
+{
+  LT.startReadSXBuffer(0);
+  LT.readBufferbytes(rxbuffer, size);
+  LT.endReadSXBuffer();
+}
+
+
+uint32_t timeTransfer(void (*transfer)(uint8_t), uint8_t size)
+{
+  //returns the average time in uS of one transfer
+  uint16_t index;
+  uint32_t startuS;
+
+  startuS = micros();
+
+  for (index = 0; index < loops; index++)
+  {
+    transfer(size);
+  }
+
+  return (micros() - startuS) / loops;
+}
+
+
+bool checkFIFO(uint8_t size)
+{
+  return (memcmp(txbuffer, rxbuffer, size) == 0);
+}
+
+
+void loop()
+{
+  uint8_t index, size;
+  bool ok = true;
+
+  Serial.println(F("Bytes  Load bytewise  Load block  Unload bytewise  Unload block  (uS)"));
+
+  for (index = 0; index < sizeof(packetsizes); index++)
+  {
+    size = packetsizes[index];
+
+    Serial.print(size);
+    Serial.print(F("      "));
+    Serial.print(timeTransfer(loadBytewise, size));
+    Serial.print(F("            "));
+    Serial.print(timeTransfer(loadBlock, size));
+    Serial.print(F("          "));
+
+    memset(rxbuffer, 0, sizeof(rxbuffer));
+    Serial.print(timeTransfer(unloadBytewise, size));
+    ok = ok && checkFIFO(size);
+    Serial.print(F("              "));
+
+    memset(rxbuffer, 0, sizeof(rxbuffer));
+    Serial.println(timeTransfer(unloadBlock, size));
+    ok = ok && checkFIFO(size);
+  }
+
+  if (ok)
+  {
+    Serial.println(F("FIFO data matches"));
+  }
+  else
+  {
+    Serial.println(F("ERROR - FIFO data mismatch"));
+  }
+
+  Serial.println();
+  delay(5000);
+}
+
+
+void setup()
+{
+  uint8_t index;
+
+  Serial.begin(115200);
+  Serial.println();
+  Serial.println(F("45_FIFO_Transfer_Timing Starting"));
+  Serial.println();
+
+  SPI.begin();
+
+  if (!LT.begin(NSS, NRESET, DIO0, LORA_DEVICE))
+  {
+    Serial.println(F("No device responding"));
+    while (1);
+  }
+
+  for (index = 0; index < sizeof(txbuffer); index++)
+  {
+    txbuffer[index] = (index * 37) + 11;
+  }
+}
@@ -0,0 +1,248 @@
+/*
+  Licensed under a MIT license, see LICENSE.txt in the library src folder.
+  Original published 16/10/26
+*/
+
+/*******************************************************************************************************
+  Program Operation - Runs the master_esp32 and slave_esp32_mini reliable packet exchange between two
+  simulated SX1278s while the path loss between them follows a walk, the wristband moving away from the
+  hub and back, and compares the fixed SF7 BW125 settings, 10dBm from the master and 2dBm ACKs, with the adaptive data rate of LTADR.h.
+
+  The master proposes changes from the ACK RSSI and SNR and sends them to the slave as an ADR request in
+  a reliable packet. The slave switches after sending the ACK, the master when it gets the ACK. A failed
+  exchange puts the master on the fallback settings, SF12 at 17dBm, and the slave goes to them when it has
+  heard nothing for FallbackmS, the same as the firmware. ADR starts at SF7 BW125 with 2dBm both ways.
+
+  Usage: ADR_Link_Sim [exchanges] [near path loss dB] [far path loss dB] [packet loss 0-1] [time scale]
+
+  Build from the library folder, see extras/host/README.md;
+  g++ -std=c++17 -O2 -pthread -Iextras/host -Isrc extras/host/LTHAL.cpp extras/host/SX127XSim.cpp
+      extras/host/ADR_Link_Sim.cpp src/SX127XLT.cpp -o ADR_Link_Sim
+*******************************************************************************************************/
+
+#include <SPI.h>
+#include <SX127XLT.h>
+#include <SX127XSim.h>
+#include <LTADR.h>
+
+#include <atomic>
+#include <thread>
+#include <stdio.h>
+
+#define NSS 5                                //master_esp32 pins
+#define NRESET 14
+#define DIO0 2
+#define SLAVE_NSS 7                          //slave_esp32_mini pins
+#define SLAVE_NRESET 3
+#define SLAVE_DIO0 2
+
+#define LORA_DEVICE DEVICE_SX1278
+const uint32_t Frequency = 434000000;
+const uint16_t NetworkID = 0x3210;
+const uint32_t ACKtimeout = 1000;            //at SF7 BW125, stretched by 40 symbols for slower rates
+const uint32_t TXtimeout = 1000;
+const uint8_t TXattempts = 10;
+const uint32_t ACKdelay = 100;
+const uint32_t RXtimeout = 60000;
+const uint32_t CyclePeriodmS = 10000;        //one exchange per period, as API_config
+const uint32_t FallbackmS = 3 * CyclePeriodmS;
+const uint8_t DefaultRate = 5;               //SF7 BW125
+const int8_t MasterTXpower = 10;             //fixed settings
+const int8_t DefaultTXpower = 2;             //the slave ACK power the dataset was recorded with
+
+LTSimAir air;
+std::atomic<bool> slaveRun(true);
+
+
+uint32_t stretch(uint32_t timeoutmS, uint8_t rate)
+{
+  return timeoutmS + ((40 * LTADR::getSymbolTimeuS(rate)) / 1000);
+}
+
+
+void slaveNode(SX127XSim *radio)
+{
+  SX127XLT LT;
+  LTSimBoard board;
+  LTADR ADR;
+  uint8_t RXBUFFER[251];
+  uint8_t rate, RXPayloadL;
+  int8_t txpower;
+  uint32_t lastheardmS;
+  bool requested = false;                            //fall back only once the master has shown it does ADR
+
+  board.attach(*radio, SLAVE_NSS, SLAVE_NRESET, SLAVE_DIO0);
+  LTHALbind(&board, &board);
+
+  if (!LT.begin(SLAVE_NSS, SLAVE_NRESET, SLAVE_DIO0, LORA_DEVICE))
+  {
+    Serial.println(F("No LoRa device responding"));
+    exit(1);
+  }
+
+  ADR.begin(DefaultRate, DefaultTXpower);
+  LTADRsetup(LT, Frequency, ADR.getRate());
+  lastheardmS = millis();
+
+  while (slaveRun)
+  {
+    if (LT.receiveReliableAutoACK(RXBUFFER, sizeof(RXBUFFER), NetworkID, ACKdelay, ADR.getTXpower(), ADR.isFallback() ? RXtimeout : FallbackmS, WAIT_RX))
+    {
+      lastheardmS = millis();
+      RXPayloadL = LT.readRXPacketL() - 4;
+
+      if (LTADR::readRequest(RXBUFFER, RXPayloadL, rate, txpower))
+      {
+        ADR.apply(rate, txpower);                      //the ACK has gone, switch now
+        requested = true;
+        LTADRsetup(LT, Frequency, ADR.getRate());
+      }
+    }
+    else if (requested && !ADR.isFallback() && ((uint32_t) (millis() - lastheardmS) >= FallbackmS))
+    {
+      ADR.fallback();
+      LTADRsetup(LT, Frequency, ADR.getRate());
+    }
+  }
+}
+
+
+int16_t walk(uint32_t exchange, uint32_t exchanges, int16_t nearloss, int16_t farloss)
+{
+  //out from near to far over the first half of the exchanges, then back
+  uint32_t half = exchanges / 2;
+  uint32_t step = (exchange < half) ? exchange : (exchanges - 1 - exchange);
+
+  return nearloss + (int16_t) (((int32_t) (farloss - nearloss) * (int32_t) step) / (int32_t) (half ? half : 1));
+}
+
+
+void runLink(SX127XLT &LT, SX127XSim &masterRadio, SX127XSim &slaveRadio, uint32_t exchanges, int16_t nearloss, int16_t farloss, bool adr)
+{
+  LTADR ADR;
+  uint32_t index, acked = 0, failed = 0, transmissions = 0, changes = 0, fallbacks = 0, cyclestartmS;
+  uint32_t ratecount[LTADRRates] = {0};
+  uint64_t airtime;
+  uint8_t buff[8] = "SIESPRO", payload[8], payloadL, attempts, rate;
+  int8_t txpower;
+  bool request, acknowledged;
+
+  ADR.begin(DefaultRate, DefaultTXpower);
+  LTADRsetup(LT, Frequency, ADR.getRate());
+  airtime = masterRadio.txAirtimeuS + slaveRadio.txAirtimeuS;
+
+  for (index = 0; index < exchanges; index++)
+  {
+    cyclestartmS = millis();
+    masterRadio.setPathLoss(walk(index, exchanges, nearloss, farloss));
+    slaveRadio.setPathLoss(walk(index, exchanges, nearloss, farloss));
+
+    request = adr && ADR.getProposal(rate, txpower);
+
+    if (request)
+    {
+      payloadL = LTADR::buildRequest(payload, rate, txpower);
+    }
+    else
+    {
+      memcpy(payload, buff, sizeof(buff));
+      payloadL = sizeof(buff);
+    }
+
+    attempts = 0;
+
+    do
+    {
+      attempts++;
+      transmissions++;
+      acknowledged = LT.transmitReliableAutoACK(payload, payloadL, NetworkID, stretch(ACKtimeout, ADR.getRate()), stretch(TXtimeout, ADR.getRate()), adr ? ADR.getTXpower() : MasterTXpower, WAIT_TX);
+    } while (!acknowledged && (attempts < TXattempts));
+
+    ratecount[ADR.getRate()]++;
+
+    if (acknowledged)
+    {
+      acked++;
+      ADR.addSample(LT.readPacketRSSI(), LT.readPacketSNR());
+
+      if (request)
+      {
+        ADR.apply(rate, txpower);
+        LTADRsetup(LT, Frequency, rate);
+        changes++;
+      }
+    }
+    else
+    {
+      failed++;
+      ADR.addFailure();
+
+      if (adr && !ADR.isFallback())
+      {
+        ADR.fallback();
+        LTADRsetup(LT, Frequency, ADR.getRate());
+        fallbacks++;
+      }
+      else if (adr)
+      {
+        ADR.restart();
+        LTADRsetup(LT, Frequency, ADR.getRate());
+      }
+    }
+
+    while ((uint32_t) (millis() - cyclestartmS) < CyclePeriodmS)
+    {
+      delay(10);
+    }
+  }
+
+  airtime = masterRadio.txAirtimeuS + slaveRadio.txAirtimeuS - airtime;
+
+  printf("%-6s acknowledged %u, failed %u, transmissions %u, airtime %.1fs, ADR changes %u, fallbacks %u\n",
+         adr ? "ADR" : "Fixed", acked, failed, transmissions, airtime / 1e6, changes, fallbacks);
+  printf("       exchanges at SF12 %u, SF11 %u, SF10 %u, SF9 %u, SF8 %u, SF7 %u, SF7 BW250 %u\n",
+         ratecount[0], ratecount[1], ratecount[2], ratecount[3], ratecount[4], ratecount[5], ratecount[6]);
+}
+
+
+int main(int argc, char *argv[])
+{
+  uint32_t exchanges = (argc > 1) ? atoi(argv[1]) : 200;
+  int16_t nearloss = (argc > 2) ? atoi(argv[2]) : 80;
+  int16_t farloss = (argc > 3) ? atoi(argv[3]) : 140;
+  float loss = (argc > 4) ? atof(argv[4]) : 0.05;
+  float scale = (argc > 5) ? atof(argv[5]) : 20;
+
+  LTHostClock clock(scale);
+  LTHALsetClock(&clock);
+
+  air.setPacketLoss(loss);
+  SX127XSim masterRadio(air);
+  SX127XSim slaveRadio(air);
+
+  std::thread slave(slaveNode, &slaveRadio);
+
+  SX127XLT LT;
+  LTSimBoard board;
+  board.attach(masterRadio, NSS, NRESET, DIO0);
+  LTHALbind(&board, &board);
+
+  if (!LT.begin(NSS, NRESET, DIO0, LORA_DEVICE))
+  {
+    Serial.println(F("No LoRa device responding"));
+    exit(1);
+  }
+
+  delay(100);                                //let the slave get into receive
+
+  printf("%u exchanges, path loss %ddB to %ddB and back, packet loss %.2f, one exchange per %umS\n",
+         exchanges, nearloss, farloss, loss, CyclePeriodmS);
+
+  runLink(LT, masterRadio, slaveRadio, exchanges, nearloss, farloss, false);
+  runLink(LT, masterRadio, slaveRadio, exchanges, nearloss, farloss, true);
+
+  slaveRun = false;
+  slave.join();
+
+  return 0;
+}
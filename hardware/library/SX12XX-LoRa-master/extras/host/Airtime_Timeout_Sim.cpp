@@ -0,0 +1,217 @@
+/*
+  Licensed under a MIT license, see LICENSE.txt in the library src folder.
+  Original published 16/10/26
+*/
+
+/*******************************************************************************************************
+  Program Operation - Checks getTimeOnAiruS() and the LTAirtime.h timeouts. First the time on air the
+  driver works out for each LTADR.h rate and a range of packet lengths is compared with the airtime of
+  the packet the simulated SX1278 sends, they must agree to within a symbol time of rounding.
+
+  Then a master sends reliable packets to a slave over a channel that loses packets at random, up to 3
+  attempts each, at SF7 BW125 and at SF12 BW125. Once with the fixed timeouts of the master firmware,
+  1000mS stretched by 40 symbols for the slower rates, and once with the timeouts LTAirtime.h gives for the
+  packet and its ACK. For each the packets acknowledged, transmissions and the average time the master
+  spent on a packet, sending, waiting and sending again, are printed. The program returns 1 if a time on
+  air is wrong, or with a packet loss of 0 if the LTAirtime.h timeouts caused a packet to be sent again.
+
+  Usage: Airtime_Timeout_Sim [packets] [packet loss 0-1] [time scale]
+
+  Build from the library folder, see extras/host/README.md;
+  g++ -std=c++17 -O2 -pthread -Iextras/host -Isrc extras/host/LTHAL.cpp extras/host/SX127XSim.cpp
+      extras/host/Airtime_Timeout_Sim.cpp src/SX127XLT.cpp -o Airtime_Timeout_Sim
+*******************************************************************************************************/
+
+#include <SPI.h>
+#include <SX127XLT.h>
+#include <SX127XSim.h>
+#include <LTADR.h>
+#include <LTAirtime.h>
+
+#include <atomic>
+#include <thread>
+#include <stdio.h>
+
+#define NSS 5                                //master_esp32 pins
+#define NRESET 14
+#define DIO0 2
+#define SLAVE_NSS 7                          //slave_esp32_mini pins
+#define SLAVE_NRESET 3
+#define SLAVE_DIO0 2
+
+#define LORA_DEVICE DEVICE_SX1278
+const uint32_t Frequency = 434000000;
+const uint16_t NetworkID = 0x3210;
+const uint32_t ACKtimeout = 1000;            //the fixed timeouts of the firmware, at SF7 BW125
+const uint32_t TXtimeout = 1000;
+const uint8_t TXattempts = 3;
+const uint32_t ACKdelay = 100;
+const uint32_t RXtimeout = 10000;           //longer than a packet at SF12, the driver stops RX at the timeout
+const int8_t MasterTXpower = 10;
+const int8_t SlaveTXpower = 2;
+
+//SF7 BW125 CR4/5, 8 symbol preamble, 12 bytes with CRC, 40.25 symbols of 1024uS, and SF12 with LDRO
+static_assert(LTAirtimeuS(125000, 7, 5, 8, 12, true, false, false) == 41216, "SF7 time on air");
+static_assert(LTAirtimeuS(125000, 12, 5, 8, 12, true, false, true) == 1155072, "SF12 time on air");
+
+std::atomic<bool> slaveRun;
+
+
+void setupNode(SX127XLT &LT, LTSimBoard &board, SX127XSim &radio, int8_t nss, int8_t nreset, int8_t dio0, uint8_t rate)
+{
+  board.attach(radio, nss, nreset, dio0);
+  LTHALbind(&board, &board);
+
+  if (!LT.begin(nss, nreset, dio0, LORA_DEVICE))
+  {
+    Serial.println(F("No LoRa device responding"));
+    exit(1);
+  }
+
+  LTADRsetup(LT, Frequency, rate);
+}
+
+
+uint32_t checkAirtime()
+{
+  //time on air from the driver against the simulated device, returns the number that disagree
+  LTSimAir air;
+  SX127XSim radio(air);
+  SX127XLT LT;
+  LTSimBoard board;
+  const uint8_t lengths[] = {4, 12, 64, 255};
+  uint8_t buff[255] = {0};
+  uint8_t rate, index;
+  uint32_t driveruS, wrong = 0;
+  uint64_t simuS;
+
+  setupNode(LT, board, radio, NSS, NRESET, DIO0, 5);
+  printf("Rate  Bytes  Driver uS    Device uS\n");
+
+  for (rate = 0; rate < LTADRRates; rate++)
+  {
+    LTADRsetup(LT, Frequency, rate);
+
+    for (index = 0; index < sizeof(lengths); index++)
+    {
+      driveruS = LT.getTimeOnAiruS(lengths[index]);
+      simuS = radio.txAirtimeuS;
+      LT.transmit(buff, lengths[index], 20000, MasterTXpower, WAIT_TX);
+      simuS = radio.txAirtimeuS - simuS;
+
+      if (llabs((long long) simuS - (long long) driveruS) > (long long) LTADR::getSymbolTimeuS(rate))
+      {
+        wrong++;
+      }
+
+      printf("%-5u %5u  %9u  %11llu\n", rate, lengths[index], driveruS, (unsigned long long) simuS);
+    }
+  }
+
+  return wrong;
+}
+
+
+void slaveNode(SX127XSim *radio, uint8_t rate)
+{
+  SX127XLT LT;
+  LTSimBoard board;
+  uint8_t RXBUFFER[251];
+
+  setupNode(LT, board, *radio, SLAVE_NSS, SLAVE_NRESET, SLAVE_DIO0, rate);
+
+  while (slaveRun)
+  {
+    LT.receiveReliableAutoACK(RXBUFFER, sizeof(RXBUFFER), NetworkID, ACKdelay, SlaveTXpower, RXtimeout, WAIT_RX);
+  }
+}
+
+
+uint32_t runLink(uint8_t rate, bool airtime, uint32_t packets, float loss)
+{
+  LTSimAir air;
+  SX127XSim masterRadio(air), slaveRadio(air);
+  SX127XLT LT;
+  LTSimBoard board;
+  uint8_t payload[] = "SIESPRO";
+  uint32_t index, acked = 0, transmissions = 0, acktimeout, txtimeout, startmS, totalmS = 0;
+  uint8_t attempts, acknowledged;
+
+  air.setPacketLoss(loss);
+  air.setSeed(1234);
+  setupNode(LT, board, masterRadio, NSS, NRESET, DIO0, rate);
+
+  if (airtime)
+  {
+    txtimeout = LTAirtimeTXTimeoutmS(LT.getTimeOnAiruS(sizeof(payload) + 4));
+    acktimeout = LTAirtimeACKTimeoutmS(ACKdelay, LT.getTimeOnAiruS(4));
+  }
+  else
+  {
+    txtimeout = TXtimeout + ((40 * LTADR::getSymbolTimeuS(rate)) / 1000);
+    acktimeout = ACKtimeout + ((40 * LTADR::getSymbolTimeuS(rate)) / 1000);
+  }
+
+  slaveRun = true;
+  std::thread slave(slaveNode, &slaveRadio, rate);
+  delay(1000);                               //the slave set up and in RX
+
+  for (index = 0; index < packets; index++)
+  {
+    attempts = 0;
+    startmS = millis();
+
+    do
+    {
+      attempts++;
+      transmissions++;
+      acknowledged = LT.transmitReliableAutoACK(payload, sizeof(payload), NetworkID, acktimeout, txtimeout, MasterTXpower, WAIT_TX);
+    } while (!acknowledged && (attempts < TXattempts));
+
+    totalmS += millis() - startmS;
+    acked += (acknowledged != 0);
+    delay(ACKdelay + 50);                    //let a late ACK finish before the next packet
+  }
+
+  slaveRun = false;
+  slave.join();
+
+  printf("SF%-2u %-8s TX timeout %5umS, ACK timeout %5umS, acknowledged %u of %u, transmissions %u, %.0fmS per packet\n",
+         LTADR::getSF(rate), airtime ? "airtime" : "fixed", txtimeout, acktimeout, acked, packets, transmissions,
+         (double) totalmS / packets);
+  return transmissions - packets;
+}
+
+
+int main(int argc, char *argv[])
+{
+  uint32_t packets = (argc > 1) ? atoi(argv[1]) : 50;
+  float loss = (argc > 2) ? atof(argv[2]) : 0.3;
+  float scale = (argc > 3) ? atof(argv[3]) : 10;
+  uint32_t wrong, resent = 0;
+
+  LTHostClock clock(scale);
+  LTHALsetClock(&clock);
+
+  wrong = checkAirtime();
+  printf("\n%u packets, packet loss %.2f, up to %u attempts\n", packets, loss, TXattempts);
+
+  runLink(5, false, packets, loss);
+  resent += runLink(5, true, packets, loss);
+  runLink(0, false, packets, loss);
+  resent += runLink(0, true, packets, loss);
+
+  if (wrong)
+  {
+    printf("ERROR - %u times on air differ from the device\n", wrong);
+    return 1;
+  }
+
+  if ((loss == 0) && resent)
+  {
+    printf("ERROR - %u packets sent again with no packet loss, the timeouts are too short\n", resent);
+    return 1;
+  }
+
+  return 0;
+}
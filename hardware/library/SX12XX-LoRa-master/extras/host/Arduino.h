@@ -0,0 +1,126 @@
+/*
+  Licensed under a MIT license, see LICENSE.txt in the library src folder.
+  Original published 16/10/26
+*/
+
+/*******************************************************************************************************
+  Host replacement for Arduino.h, only the parts of the Arduino API used by the SX12XX-LoRa library.
+  Pins, SPI and time are forwarded to the host hardware abstraction layer in LTHAL.h.
+*******************************************************************************************************/
+
+#ifndef Arduino_h
+#define Arduino_h
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <LTHAL.h>
+
+#define HIGH 0x1
+#define LOW  0x0
+
+#define INPUT 0x0
+#define OUTPUT 0x1
+#define INPUT_PULLUP 0x2
+
+#define CHANGE 0x1                      //interrupt modes
+#define FALLING 0x2
+#define RISING 0x3
+
+#define DEC 10
+#define HEX 16
+#define OCT 8
+#define BIN 2
+
+#define LSBFIRST 0
+#define MSBFIRST 1
+
+#define PROGMEM
+#define IRAM_ATTR
+#define digitalPinToInterrupt(pin) (pin)
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+#define pgm_read_word(addr) (*(const uint16_t *)(addr))
+#define F(string_literal) (string_literal)
+
+#define lowByte(w) ((uint8_t) ((w) & 0xff))
+#define highByte(w) ((uint8_t) ((w) >> 8))
+#define bitRead(value, bit) (((value) >> (bit)) & 0x01)
+#define bitSet(value, bit) ((value) |= (1UL << (bit)))
+#define bitClear(value, bit) ((value) &= ~(1UL << (bit)))
+#define bitWrite(value, bit, bitvalue) ((bitvalue) ? bitSet(value, bit) : bitClear(value, bit))
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t level);
+int digitalRead(uint8_t pin);
+void attachInterrupt(uint8_t pin, void (*isr)(), int mode);
+void detachInterrupt(uint8_t pin);
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void yield();
+
+long random(long howbig);
+long random(long howsmall, long howbig);
+void randomSeed(unsigned long seed);
+
+
+class Print
+{
+  public:
+    size_t write(uint8_t data);
+    size_t write(const uint8_t *buffer, size_t size);
+
+    size_t print(const char *str);
+    size_t print(char c);
+    size_t print(unsigned char n, int base = DEC);
+    size_t print(int n, int base = DEC);
+    size_t print(unsigned int n, int base = DEC);
+    size_t print(long n, int base = DEC);
+    size_t print(unsigned long n, int base = DEC);
+    size_t print(long long n, int base = DEC);
+    size_t print(unsigned long long n, int base = DEC);
+    size_t print(double n, int digits = 2);
+
+    size_t println();
+    template <typename T> size_t println(T value)
+    {
+      size_t n = print(value);
+      return n + println();
+    }
+    template <typename T> size_t println(T value, int format)
+    {
+      size_t n = print(value, format);
+      return n + println();
+    }
+
+    void flush();
+
+  private:
+    size_t printNumber(unsigned long long n, int base, bool negative);
+};
+
+
+class HardwareSerial : public Print
+{
+  public:
+    void begin(unsigned long baud);
+    void end();
+    int available();
+    int read();
+    operator bool()
+    {
+      return true;
+    }
+};
+
+extern HardwareSerial Serial;
+
+#endif
@@ -0,0 +1,217 @@
+/*
+  Licensed under a MIT license, see LICENSE.txt in the library src folder.
+  Original published 16/10/26
+*/
+
+/*******************************************************************************************************
+  Program Operation - Transfers an array between two simulated SX1278s with the ARtransfer.h functions,
+  ARsendArray() on the transmitter and ARreceiveArray() on the receiver, and reports the effective
+  throughput. The same array is sent first with the original stop and wait transfer, one ACK per segment,
+  then with the windowed transfer set by ARsetWindow(), one bitmap ACK per window. Given a number of
+  repair segments it is last sent windowed with ARsetRepair(), the gaps a bitmap ACK shows in a group go
+  as repair segments the receiver rebuilds them from. Repair segments are off by default, as they are in
+  ARtransfer.h, see extras/host/README.md for where they pay.
+
+  ARtransfer.h keeps its state in globals and uses a library instance called LoRa, so it is included
+  twice, once in namespace ARTX for the transmitter and once in namespace ARRX for the receiver, each with
+  its own LoRa instance.
+
+  Usage: Array_Transfer_Sim [array bytes] [packet loss 0-1] [window] [time scale] [path loss dB] [repair segments]
+
+  Build from the library folder, see extras/host/README.md;
+  g++ -std=c++17 -O2 -pthread -Iextras/host -Isrc extras/host/LTHAL.cpp extras/host/SX127XSim.cpp
+      extras/host/Array_Transfer_Sim.cpp src/SX127XLT.cpp -o Array_Transfer_Sim
+*******************************************************************************************************/
+
+#include <SPI.h>
+#include <SX127XLT.h>
+#include <SX127XSim.h>
+#include <ProgramLT_Definitions.h>
+#include <LTCRC.h>
+#include <LTFEC.h>
+
+#include <atomic>
+#include <thread>
+#include <stdio.h>
+
+#define NSS 5                                //master_esp32 pins
+#define NRESET 14
+#define DIO0 2
+#define SLAVE_NSS 7                          //slave_esp32_mini pins
+#define SLAVE_NRESET 3
+#define SLAVE_DIO0 2
+
+#define LORA_DEVICE DEVICE_SX1278
+#define ENABLEARRAYCRC                       //check the array CRC at the end of each transfer
+#define ENABLEARFEC                          //enable the repair segments
+
+const uint32_t Frequency = 434000000;
+const int8_t TXpower = 10;
+
+const uint32_t TXtimeoutmS = 5000;           //mS to wait for TX to complete
+const uint32_t RXtimeoutmS = 1000;           //mS to wait for receiving a packet
+const uint32_t ACKdelaymS = 0;               //ms delay after packet actioned and ack sent
+const uint32_t ACKdelaystartendmS = 25;      //ms delay before ack sent at array start wrie and end write
+const uint32_t ACKsegtimeoutmS = 200;        //mS to wait for receiving an ACK before re-trying transmit segment
+const uint32_t ACKopentimeoutmS = 500;       //mS to wait for receiving an ACK before re-trying transmit file open
+const uint32_t ACKclosetimeoutmS = 500;      //mS to wait for receiving an ACK before re-trying transmit file close
+const uint32_t DuplicatedelaymS = 25;        //ms delay if there has been an duplicate segment or command receipt
+const uint32_t NoAckCountLimit = 250;        //if no NoAckCount exceeds this value - restart transfer
+const uint32_t FunctionDelaymS = 0;          //delay between functions such as open file, send segments etc
+const uint32_t PacketDelaymS = 1000;         //mS delay between transmitted packets such as DTInfo etc
+
+const uint8_t ARDTfilenamesize = 32;         //size of filename buffer
+const uint8_t StartAttempts = 2;             //number of attempts to start transfer before a fail
+const uint8_t SendAttempts = 5;              //number of attempts carrying out a process before a restart
+const uint8_t HeaderSizeMax = 12;            //max size of header in bytes, minimum size is 7 bytes
+const uint8_t DataSizeMax = 245;             //max size of data array in bytes
+const uint16_t NetworkID = 0x3210;           //a unique identifier to go out with packet
+const uint8_t SegmentSize = 245;             //number of bytes in each segment, 245 is maximum value for LoRa
+
+
+class LTNullPort                             //receiver prints are not needed for the throughput figures
+{
+  public:
+    template <typename... T> size_t print(T...)
+    {
+      return 0;
+    }
+    template <typename... T> size_t println(T...)
+    {
+      return 0;
+    }
+};
+
+LTNullPort Quietport;
+
+namespace ARTX
+{
+SX127XLT LoRa;
+#include <ARtransfer.h>
+}
+
+#undef Monitorport
+#define Monitorport Quietport
+
+namespace ARRX
+{
+SX127XLT LoRa;
+#include <ARtransfer.h>
+}
+
+LTSimAir air;
+std::atomic<bool> receiverRun(true);
+
+
+void setupNode(SX127XLT &LT, int8_t pinNSS, int8_t pinNRESET, int8_t pinDIO0)
+{
+  if (!LT.begin(pinNSS, pinNRESET, pinDIO0, LORA_DEVICE))
+  {
+    Serial.println(F("No LoRa device responding"));
+    exit(1);
+  }
+
+  LT.setupLoRa(Frequency, 0, LORA_SF7, LORA_BW_125, LORA_CR_4_5, LDRO_AUTO);
+}
+
+
+void receiverNode(SX127XSim *radio, uint8_t *array, uint32_t length)
+{
+  LTSimBoard board;
+
+  board.attach(*radio, SLAVE_NSS, SLAVE_NRESET, SLAVE_DIO0);
+  LTHALbind(&board, &board);
+  setupNode(ARRX::LoRa, SLAVE_NSS, SLAVE_NRESET, SLAVE_DIO0);
+
+  while (receiverRun)
+  {
+    ARRX::ARreceiveArray(array, length, RXtimeoutmS);
+  }
+}
+
+
+bool sendArray(uint8_t *array, uint32_t length, uint8_t window, uint8_t repair, uint8_t *received, SX127XSim &radio1, SX127XSim &radio2)
+{
+  char filename[] = "/sim.bin";
+  uint32_t startmS, elapsedmS, packets, ACKs;
+  bool sent;
+
+  ARTX::ARsetWindow(window);
+  ARTX::ARsetRepair(repair);
+  ARTX::ARAckCount = 0;
+  ARRX::ARDTReceivedSegments = 0;
+  memset(received, 0, length);
+  packets = radio1.packetsSent + radio2.packetsSent;
+
+  startmS = millis();
+  sent = ARTX::ARsendArray(array, length, filename, sizeof(filename));
+  elapsedmS = millis() - startmS;
+  delay(100);                                //let the receiver see the end of the transfer
+
+  packets = radio1.packetsSent + radio2.packetsSent - packets;
+  ACKs = ARTX::ARAckCount;
+
+  printf("%-14s %s in %6umS, %7.1f bytes/s, %u segments, %u packets on air, %u segment ACKs, %u rebuilt, array %s\n",
+         (window < 2) ? "Stop and wait" : (repair ? "Windowed+FEC" : "Windowed"), sent ? "sent" : "FAILED", elapsedmS,
+         sent ? (length * 1000.0) / elapsedmS : 0.0, ARTX::ARDTNumberSegments, packets, ACKs,
+         ARRX::ARDTRecoveredSegments, memcmp(array, received, length) ? "differs" : "matches");
+
+  return sent && !memcmp(array, received, length);
+}
+
+
+int main(int argc, char *argv[])
+{
+  uint32_t length = (argc > 1) ? atoi(argv[1]) : 8000;
+  float loss = (argc > 2) ? atof(argv[2]) : 0.1;
+  uint8_t window = (argc > 3) ? atoi(argv[3]) : 8;
+  float scale = (argc > 4) ? atof(argv[4]) : 1;
+  int16_t pathloss = (argc > 5) ? atoi(argv[5]) : 80;
+  uint8_t repair = (argc > 6) ? atoi(argv[6]) : 0;
+
+  uint32_t index;
+  bool ok;
+
+  uint8_t *array = new uint8_t[length];
+  uint8_t *received = new uint8_t[length];
+
+  for (index = 0; index < length; index++)
+  {
+    array[index] = (uint8_t) ((index * 7) + (index >> 8));
+  }
+
+  LTHostClock clock(scale);
+  LTHALsetClock(&clock);
+
+  air.setPacketLoss(loss);
+  SX127XSim transmitterRadio(air);
+  SX127XSim receiverRadio(air);
+  transmitterRadio.setPathLoss(pathloss);
+  receiverRadio.setPathLoss(pathloss);
+
+  std::thread receiver(receiverNode, &receiverRadio, received, length);
+
+  LTSimBoard board;
+  board.attach(transmitterRadio, NSS, NRESET, DIO0);
+  LTHALbind(&board, &board);
+  setupNode(ARTX::LoRa, NSS, NRESET, DIO0);
+  delay(100);                                //let the receiver get into receive
+
+  printf("Array %u bytes, packet loss %.2f, SF7 BW125, window %u, repair segments %u\n", length, loss, window, repair);
+
+  ok = sendArray(array, length, 1, 0, received, transmitterRadio, receiverRadio);
+  ok = sendArray(array, length, window, 0, received, transmitterRadio, receiverRadio) && ok;
+
+  if (repair)
+  {
+    ok = sendArray(array, length, window, repair, received, transmitterRadio, receiverRadio) && ok;
+  }
+
+  receiverRun = false;
+  receiver.join();
+
+  delete[] array;
+  delete[] received;
+
+  return ok ? 0 : 1;
+}
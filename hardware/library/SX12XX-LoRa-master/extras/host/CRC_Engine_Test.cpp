@@ -0,0 +1,233 @@
+/*
+  Licensed under a MIT license, see LICENSE.txt in the library src folder.
+  Original published 16/10/26
+*/
+
+/*******************************************************************************************************
+  Program Operation - Builds each implementation of the LTCRC.h CRC16 CCITT engine in one program,
+  LTCRC_BITWISE, LTCRC_NIBBLE, LTCRC_TABLE, LTCRC_SLICE4 and LTCRC_SLICE8, each in its own namespace, and
+  checks them bit for bit against the original shift and XOR loop of CRCCCITT();
+
+  Check      - the CRC of '123456789' from 0xFFFF must be 0x29B1
+  Random     - random buffers of 0 to 600 bytes from random start values, in one LTCRCCCITTUpdate()
+  Segments   - the same buffers split at random points, the CRC of each segment passed on to the next,
+               and a byte at a time with LTCRCCCITTByte(), as the SX buffer reads do
+
+  Then the time per byte of each implementation over a 64k byte buffer is printed. The program returns 1
+  if any result differs from the original loop.
+
+  Usage: CRC_Engine_Test [buffers] [benchmark passes]
+
+  Build from the library folder, see extras/host/README.md;
+  g++ -std=c++17 -O2 -Iextras/host -Isrc extras/host/CRC_Engine_Test.cpp -o CRC_Engine_Test
+*******************************************************************************************************/
+
+#include <Arduino.h>
+
+#include <chrono>
+#include <random>
+#include <vector>
+#include <stdio.h>
+
+//LTCRC.h selects its implementation when included, so it is included once per implementation with its
+//include guard and selection cleared in between
+
+namespace CRCbitwise
+{
+#define LTCRC_BITWISE
+#include <LTCRC.h>
+#undef LTCRC_BITWISE
+}
+#undef LTCRC_h
+
+namespace CRCnibble
+{
+#define LTCRC_NIBBLE
+#include <LTCRC.h>
+#undef LTCRC_NIBBLE
+}
+#undef LTCRC_h
+
+namespace CRCtable
+{
+#define LTCRC_TABLE
+#include <LTCRC.h>
+#undef LTCRC_TABLE
+}
+#undef LTCRC_h
+#undef LTCRC_SLICES
+#undef LTCRCslot
+
+namespace CRCslice4
+{
+#define LTCRC_SLICE4
+#include <LTCRC.h>
+#undef LTCRC_SLICE4
+}
+#undef LTCRC_h
+#undef LTCRC_SLICES
+#undef LTCRCslot
+
+namespace CRCslice8
+{
+#define LTCRC_SLICE8
+#include <LTCRC.h>
+#undef LTCRC_SLICE8
+}
+
+struct Engine
+{
+  const char *name;
+  uint16_t (*update)(uint16_t crc, const uint8_t *buffer, uint32_t size);
+  uint16_t (*byte)(uint16_t crc, uint8_t data);
+};
+
+const Engine Engines[] =
+{
+  {"LTCRC_BITWISE", CRCbitwise::LTCRCCCITTUpdate, CRCbitwise::LTCRCCCITTByte},
+  {"LTCRC_NIBBLE", CRCnibble::LTCRCCCITTUpdate, CRCnibble::LTCRCCCITTByte},
+  {"LTCRC_TABLE", CRCtable::LTCRCCCITTUpdate, CRCtable::LTCRCCCITTByte},
+  {"LTCRC_SLICE4", CRCslice4::LTCRCCCITTUpdate, CRCslice4::LTCRCCCITTByte},
+  {"LTCRC_SLICE8", CRCslice8::LTCRCCCITTUpdate, CRCslice8::LTCRCCCITTByte},
+};
+
+uint32_t failures = 0;
+
+
+void check(bool ok, const char *engine, const char *test, uint32_t index)
+{
+  if (!ok)
+  {
+    failures++;
+
+    if (failures <= 20)
+    {
+      printf("FAIL %s %s: buffer %u\n", engine, test, index);
+    }
+  }
+}
+
+
+uint16_t originalCRC(uint16_t startvalue, const uint8_t *buffer, uint32_t size)
+{
+  //the loop of CRCCCITT() in the drivers before LTCRC.h, with the arguments in LTCRCCCITTUpdate() order
+
+  uint32_t index;
+  uint16_t libraryCRC;
+  uint8_t j;
+
+  libraryCRC = startvalue;
+
+  for (index = 0; index < size; index++)
+  {
+    libraryCRC ^= (((uint16_t)buffer[index]) << 8);
+    for (j = 0; j < 8; j++)
+    {
+      if (libraryCRC & 0x8000)
+        libraryCRC = (libraryCRC << 1) ^ 0x1021;
+      else
+        libraryCRC <<= 1;
+    }
+  }
+
+  return libraryCRC;
+}
+
+
+void testEngine(const Engine &engine, uint32_t buffers)
+{
+  std::mt19937 random(1);                    //the same buffers for each engine
+  std::vector<uint8_t> buffer;
+  uint32_t size, start, split, index;
+  uint16_t startvalue, expected, crc;
+
+  check(engine.update(0xFFFF, (const uint8_t *) "123456789", 9) == 0x29B1, engine.name, "check value", 0);
+
+  for (index = 0; index < buffers; index++)
+  {
+    size = random() % 601;
+    startvalue = (index & 1) ? (uint16_t) random() : 0xFFFF;
+    buffer.resize(size);
+
+    for (uint8_t &value : buffer)
+    {
+      value = (uint8_t) random();
+    }
+
+    expected = originalCRC(startvalue, buffer.data(), size);
+    check(engine.update(startvalue, buffer.data(), size) == expected, engine.name, "random", index);
+
+    //segments of random length, each CRC carried on into the next
+    crc = startvalue;
+    start = 0;
+
+    while (start < size)
+    {
+      split = start + 1 + (random() % (size - start));
+      crc = engine.update(crc, buffer.data() + start, split - start);
+      start = split;
+    }
+
+    check(crc == expected, engine.name, "segments", index);
+
+    crc = startvalue;
+
+    for (start = 0; start < size; start++)
+    {
+      crc = engine.byte(crc, buffer[start]);
+    }
+
+    check(crc == expected, engine.name, "byte at a time", index);
+  }
+}
+
+
+double timePerByte(uint16_t (*update)(uint16_t, const uint8_t *, uint32_t), const std::vector<uint8_t> &buffer, uint32_t passes)
+{
+  volatile uint16_t sink;
+  uint16_t crc = 0xFFFF;
+
+  auto startTime = std::chrono::steady_clock::now();
+
+  for (uint32_t pass = 0; pass < passes; pass++)
+  {
+    crc = update(crc, buffer.data(), buffer.size());
+  }
+
+  auto endTime = std::chrono::steady_clock::now();
+  sink = crc;
+  (void) sink;
+
+  return std::chrono::duration<double, std::nano>(endTime - startTime).count() / ((double) buffer.size() * passes);
+}
+
+
+int main(int argc, char *argv[])
+{
+  uint32_t buffers = (argc > 1) ? atoi(argv[1]) : 2000;
+  uint32_t passes = (argc > 2) ? atoi(argv[2]) : 200;
+  std::vector<uint8_t> buffer(65536);
+  std::mt19937 random(2);
+
+  printf("%u random buffers of 0 to 600 bytes against the original loop\n", buffers);
+
+  for (const Engine &engine : Engines)
+  {
+    testEngine(engine, buffers);
+  }
+
+  for (uint8_t &value : buffer)
+  {
+    value = (uint8_t) random();
+  }
+
+  printf("%-14s %8.2f ns/byte\n", "original loop", timePerByte(originalCRC, buffer, passes));
+
+  for (const Engine &engine : Engines)
+  {
+    printf("%-14s %8.2f ns/byte\n", engine.name, timePerByte(engine.update, buffer, passes));
+  }
+
+  printf("%s, %u failures\n", failures ? "FAILED" : "PASSED", failures);
+  return failures ? 1 : 0;
+}
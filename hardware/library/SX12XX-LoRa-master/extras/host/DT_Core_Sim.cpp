@@ -0,0 +1,285 @@
+/*
+  Licensed under a MIT license, see LICENSE.txt in the library src folder.
+  Original published 16/10/26
+*/
+
+/*******************************************************************************************************
+  Program Operation - Runs the data transfer (DT) functions of LTReliableCore.h between a master and a
+  slave SX127XLT on simulated SX1278s, each step once with the DIO pin functions and once with the IRQ
+  variants;
+
+  Exchange - transmitDT() and waitACKDT() on the master, receiveDT() and sendACKDT() on the slave, with
+             no data, one byte, a segment and the largest data the header leaves room for. The slave
+             must receive the header and data sent and the master the ACK header the slave sent
+  Header   - the same with receiveHeaderDT() and readDataDT() on the slave
+  ID       - the master sends with another network ID, the slave must report ReliableIDError and the
+             master ReliableACKError and ReliableTimeout when no ACK comes
+  Size     - the slave offers a data buffer too small for the data, it must report ReliableSizeError
+  Large    - transmitDT() of more data than fits a packet must fail with ReliableSizeError, nothing sent
+
+  The program returns 1 if a check fails.
+
+  Usage: DT_Core_Sim [time scale]
+
+  Build from the library folder, see extras/host/README.md;
+  g++ -std=c++17 -O2 -pthread -Iextras/host -Isrc extras/host/LTHAL.cpp extras/host/SX127XSim.cpp
+      extras/host/DT_Core_Sim.cpp src/SX127XLT.cpp -o DT_Core_Sim
+*******************************************************************************************************/
+
+#include <SPI.h>
+#include <SX127XLT.h>
+#include <SX127XSim.h>
+
+#include <atomic>
+#include <thread>
+#include <stdio.h>
+
+#define NSS 5                                //master_esp32 pins
+#define NRESET 14
+#define DIO0 2
+#define SLAVE_NSS 7                          //slave_esp32_mini pins
+#define SLAVE_NRESET 3
+#define SLAVE_DIO0 2
+
+#define LORA_DEVICE DEVICE_SX1278
+const uint32_t Frequency = 434000000;
+const uint16_t NetworkID = 0x3210;
+const uint32_t ACKtimeout = 1500;
+const uint32_t TXtimeout = 5000;
+const uint32_t RXtimeout = 10000;
+const uint32_t StepDelaymS = 20;             //gives the slave time to return to receive
+const uint8_t HeaderL = 8;
+const uint8_t ACKHeaderL = 5;
+
+enum Outcome {OK, IDError, SizeError};
+
+struct Step
+{
+  const char *name;
+  uint8_t datasize;
+  uint16_t networkID;
+  uint8_t slavesize;                         //data buffer the slave offers
+  bool headerFirst;                          //slave uses receiveHeaderDT() and readDataDT()
+  Outcome outcome;
+};
+
+const Step Steps[] =
+{
+  {"Exchange", 0, NetworkID, 251, false, OK},
+  {"Exchange", 1, NetworkID, 251, false, OK},
+  {"Exchange", 200, NetworkID, 251, false, OK},
+  {"Exchange", 251 - HeaderL, NetworkID, 251, false, OK},
+  {"Header", 0, NetworkID, 251, true, OK},
+  {"Header", 200, NetworkID, 200, true, OK},
+  {"ID", 20, NetworkID + 1, 251, false, IDError},
+  {"ID", 20, NetworkID + 1, 251, true, IDError},
+  {"Size", 100, NetworkID, 99, false, SizeError},
+  {"Size", 100, NetworkID, 99, true, SizeError},
+};
+
+const uint8_t StepCount = sizeof(Steps) / sizeof(Steps[0]);
+
+LTSimAir air;
+std::atomic<uint32_t> failures(0);
+
+
+void check(bool ok, const Step &step, bool useIRQ, const char *what)
+{
+  if (!ok)
+  {
+    failures++;
+    printf("FAIL %s %u bytes%s: %s\n", step.name, step.datasize, useIRQ ? " IRQ" : "", what);
+  }
+}
+
+
+void fillStep(uint8_t index, uint8_t *header, uint8_t *data, uint8_t *ackheader)
+{
+  //what each side sends for a step, so the other side knows what to expect. A DT header has its own
+  //length in byte 2 and the length of the data in byte 3
+
+  for (uint8_t count = 0; count < HeaderL; count++)
+  {
+    header[count] = (index * 7) + count;
+  }
+
+  header[2] = HeaderL;
+  header[3] = Steps[index].datasize;
+
+  for (uint16_t count = 0; count < 251; count++)
+  {
+    data[count] = (index * 31) + count;
+  }
+
+  for (uint8_t count = 0; count < ACKHeaderL; count++)
+  {
+    ackheader[count] = 0xA0 + index + count;
+  }
+}
+
+
+void setupNode(SX127XLT &LT, int8_t pinNSS, int8_t pinNRESET, int8_t pinDIO0)
+{
+  if (!LT.begin(pinNSS, pinNRESET, pinDIO0, LORA_DEVICE))
+  {
+    Serial.println(F("No LoRa device responding"));
+    exit(1);
+  }
+
+  LT.setupLoRa(Frequency, 0, LORA_SF7, LORA_BW_125, LORA_CR_4_5, LDRO_AUTO);
+}
+
+
+void slaveNode(SX127XSim *radio)
+{
+  SX127XLT LT;
+  LTSimBoard board;
+  uint8_t header[HeaderL], data[251], ackheader[ACKHeaderL];
+  uint8_t sentheader[HeaderL], sentdata[251];
+  uint8_t RXPacketL, errors;
+
+  board.attach(*radio, SLAVE_NSS, SLAVE_NRESET, SLAVE_DIO0);
+  LTHALbind(&board, &board);
+  setupNode(LT, SLAVE_NSS, SLAVE_NRESET, SLAVE_DIO0);
+
+  for (uint8_t useIRQ = 0; useIRQ < 2; useIRQ++)
+  {
+    for (uint8_t index = 0; index < StepCount; index++)
+    {
+      const Step &step = Steps[index];
+
+      fillStep(index, sentheader, sentdata, ackheader);
+      memset(header, 0, sizeof(header));
+      memset(data, 0, sizeof(data));
+
+      if (step.headerFirst)
+      {
+        RXPacketL = LT.receiveHeaderDT(header, HeaderL, NetworkID, RXtimeout, WAIT_RX);
+
+        if (RXPacketL && (LT.readDataDT(data, step.slavesize) != step.datasize))
+        {
+          RXPacketL = 0;
+        }
+      }
+      else if (useIRQ)
+      {
+        RXPacketL = LT.receiveDTIRQ(header, HeaderL, data, step.slavesize, NetworkID, RXtimeout, WAIT_RX);
+      }
+      else
+      {
+        RXPacketL = LT.receiveDT(header, HeaderL, data, step.slavesize, NetworkID, RXtimeout, WAIT_RX);
+      }
+
+      errors = LT.readReliableErrors();
+
+      if (step.outcome != OK)
+      {
+        check(RXPacketL == 0, step, useIRQ, "slave accepted a packet in error");
+        check(bitRead(errors, (step.outcome == IDError) ? ReliableIDError : ReliableSizeError), step, useIRQ, "slave reported the wrong error");
+        continue;                            //no ACK, the master times out
+      }
+
+      check(RXPacketL == (HeaderL + step.datasize + 4), step, useIRQ, "slave packet length");
+      check((errors == 0) && (memcmp(header, sentheader, HeaderL) == 0) && (memcmp(data, sentdata, step.datasize) == 0), step, useIRQ, "slave received other header or data");
+
+      delay(10);                             //the ACK delay
+
+      if (useIRQ)
+      {
+        check(LT.sendACKDTIRQ(ackheader, ACKHeaderL, 10) == (ACKHeaderL + 4), step, useIRQ, "ACK not sent");
+      }
+      else
+      {
+        check(LT.sendACKDT(ackheader, ACKHeaderL, 10) == (ACKHeaderL + 4), step, useIRQ, "ACK not sent");
+      }
+
+      check(bitRead(LT.readReliableFlags(), ReliableACKSent), step, useIRQ, "ReliableACKSent not set");
+    }
+  }
+}
+
+
+void testLarge(SX127XLT &LT, SX127XSim &radio)
+{
+  const Step step = {"Large", 251 - HeaderL + 1, NetworkID, 251, false, SizeError};
+  uint8_t header[HeaderL], data[251], ackheader[ACKHeaderL];
+  uint32_t sent = radio.packetsSent;
+
+  fillStep(0, header, data, ackheader);
+
+  check(LT.transmitDT(header, HeaderL, data, step.datasize, NetworkID, TXtimeout, 10, WAIT_TX) == 0, step, false, "transmitDT() did not fail");
+  check(bitRead(LT.readReliableErrors(), ReliableSizeError), step, false, "ReliableSizeError not set");
+  check(LT.transmitDTIRQ(header, HeaderL, data, step.datasize, NetworkID, TXtimeout, 10, WAIT_TX) == 0, step, true, "transmitDTIRQ() did not fail");
+  check(radio.packetsSent == sent, step, false, "a packet was sent");
+}
+
+
+int main(int argc, char *argv[])
+{
+  float scale = (argc > 1) ? atof(argv[1]) : 1;
+  uint8_t header[HeaderL], data[251], ackheader[ACKHeaderL], expectedack[ACKHeaderL];
+  uint8_t TXPacketL, ACKPacketL, exchanges = 0;
+
+  LTHostClock clock(scale);
+  LTHALsetClock(&clock);
+
+  SX127XSim masterRadio(air);
+  SX127XSim slaveRadio(air);
+
+  std::thread slave(slaveNode, &slaveRadio);
+
+  SX127XLT LT;
+  LTSimBoard board;
+  board.attach(masterRadio, NSS, NRESET, DIO0);
+  LTHALbind(&board, &board);
+  setupNode(LT, NSS, NRESET, DIO0);
+
+  delay(100);                                //let the slave get into receive
+
+  for (uint8_t useIRQ = 0; useIRQ < 2; useIRQ++)
+  {
+    for (uint8_t index = 0; index < StepCount; index++)
+    {
+      const Step &step = Steps[index];
+
+      fillStep(index, header, data, expectedack);
+      memset(ackheader, 0, sizeof(ackheader));
+      delay(StepDelaymS);
+
+      if (useIRQ)
+      {
+        TXPacketL = LT.transmitDTIRQ(header, HeaderL, data, step.datasize, step.networkID, TXtimeout, 10, WAIT_TX);
+        ACKPacketL = LT.waitACKDTIRQ(ackheader, ACKHeaderL, ACKtimeout);
+      }
+      else
+      {
+        TXPacketL = LT.transmitDT(header, HeaderL, data, step.datasize, step.networkID, TXtimeout, 10, WAIT_TX);
+        ACKPacketL = LT.waitACKDT(ackheader, ACKHeaderL, ACKtimeout);
+      }
+
+      check(TXPacketL == (HeaderL + step.datasize + 4), step, useIRQ, "master packet length");
+
+      if (step.outcome == OK)
+      {
+        check(ACKPacketL == (ACKHeaderL + 4), step, useIRQ, "no ACK");
+        check(memcmp(ackheader, expectedack, ACKHeaderL) == 0, step, useIRQ, "ACK header differs from the one sent");
+        check(bitRead(LT.readReliableFlags(), ReliableACKReceived), step, useIRQ, "ReliableACKReceived not set");
+        exchanges++;
+      }
+      else
+      {
+        check(ACKPacketL == 0, step, useIRQ, "ACK for a packet in error");
+        check(bitRead(LT.readReliableErrors(), ReliableACKError) && bitRead(LT.readReliableErrors(), ReliableTimeout), step, useIRQ, "ACK timeout not reported");
+      }
+    }
+  }
+
+  slave.join();
+  testLarge(LT, masterRadio);
+
+  printf("Steps      %u, %u exchanges acknowledged, each with the DIO pin and the IRQ functions\n", StepCount * 2, exchanges);
+  printf("Master radio sent %u received %u, slave radio sent %u received %u\n", masterRadio.packetsSent, masterRadio.packetsReceived,
+         slaveRadio.packetsSent, slaveRadio.packetsReceived);
+  printf("%s, %u failures\n", failures ? "FAILED" : "PASSED", (uint32_t) failures);
+  return failures ? 1 : 0;
+}
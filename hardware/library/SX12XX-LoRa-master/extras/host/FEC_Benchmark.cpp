@@ -0,0 +1,181 @@
+/*
+  Licensed under a MIT license, see LICENSE.txt in the library src folder.
+  Original published 16/10/26
+*/
+
+/*******************************************************************************************************
+  Program Operation - Measures the encode and decode throughput of the LTFEC.h erasure code used by the
+  windowed array transfer in ARtransfer.h, and checks that every lost segment is rebuilt correctly.
+
+  For each group size and repair count a group of 245 byte data segments is encoded into repair
+  segments, as many data segments as there are repairs are erased at random, and the group is rebuilt
+  from the remaining data segments and the repairs, the same steps as ARsendRepairSegment() and
+  ARdecodeWindow(). Throughput is bytes of data segment per second.
+
+  Usage: FEC_Benchmark [groups]
+
+  Build from the library folder, see extras/host/README.md;
+  g++ -std=c++17 -O2 -Iextras/host -Isrc extras/host/FEC_Benchmark.cpp -o FEC_Benchmark
+*******************************************************************************************************/
+
+#include <Arduino.h>
+#include <LTFEC.h>
+
+#include <chrono>
+#include <random>
+#include <stdio.h>
+
+const uint16_t SegmentSize = 245;
+
+struct FECCase
+{
+  uint8_t data;
+  uint8_t repair;
+};
+
+const FECCase cases[] = {{4, 1}, {8, 1}, {8, 2}, {8, 4}, {16, 2}, {16, 4}, {32, 4}, {32, 8}};
+
+uint8_t segments[LTFECMaxData][SegmentSize];
+uint8_t repairs[16][SegmentSize];
+uint8_t received[LTFECMaxData][SegmentSize];
+
+
+double seconds(std::chrono::steady_clock::time_point start)
+{
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+
+void encode(uint8_t data, uint8_t repair)
+{
+  uint8_t j, i;
+
+  for (j = 0; j < repair; j++)
+  {
+    memset(repairs[j], 0, SegmentSize);
+
+    for (i = 0; i < data; i++)
+    {
+      LTFECMulAdd(repairs[j], segments[i], LTFECCoefficient(j, i), SegmentSize);
+    }
+  }
+}
+
+
+bool decode(uint8_t data, const bool *lost)
+{
+  uint8_t i, t, u, lostcount = 0;
+  uint8_t lostsegment[16];
+  uint8_t matrix[16 * 16];
+  uint8_t *rows[16];
+
+  for (i = 0; i < data; i++)
+  {
+    if (lost[i])
+    {
+      lostsegment[lostcount++] = i;
+    }
+  }
+
+  for (t = 0; t < lostcount; t++)
+  {
+    rows[t] = repairs[t];
+
+    for (i = 0; i < data; i++)
+    {
+      if (!lost[i])
+      {
+        LTFECMulAdd(rows[t], received[i], LTFECCoefficient(t, i), SegmentSize);
+      }
+    }
+
+    for (u = 0; u < lostcount; u++)
+    {
+      matrix[(t * lostcount) + u] = LTFECCoefficient(t, lostsegment[u]);
+    }
+  }
+
+  if (!LTFECSolve(matrix, lostcount, rows, SegmentSize))
+  {
+    return false;
+  }
+
+  for (u = 0; u < lostcount; u++)
+  {
+    memcpy(received[lostsegment[u]], rows[u], SegmentSize);
+  }
+
+  return true;
+}
+
+
+int main(int argc, char *argv[])
+{
+  uint32_t groups = (argc > 1) ? atoi(argv[1]) : 2000;
+  uint32_t group, failures = 0;
+  uint8_t i, n;
+  bool lost[LTFECMaxData];
+  double encodesecs, decodesecs;
+  std::mt19937 random(1);
+
+  printf("Segment %u bytes, %u groups per case\n", SegmentSize, groups);
+  printf("Data  Repair  Overhead  Encode MB/s  Decode MB/s  Rebuilt\n");
+
+  for (const FECCase &c : cases)
+  {
+    encodesecs = 0;
+    decodesecs = 0;
+
+    for (group = 0; group < groups; group++)
+    {
+      for (i = 0; i < c.data; i++)
+      {
+        for (uint16_t index = 0; index < SegmentSize; index++)
+        {
+          segments[i][index] = (uint8_t) random();
+        }
+      }
+
+      auto start = std::chrono::steady_clock::now();
+      encode(c.data, c.repair);
+      encodesecs += seconds(start);
+
+      memset(lost, 0, sizeof(lost));
+
+      for (n = 0; n < c.repair; )
+      {
+        i = random() % c.data;
+
+        if (!lost[i])
+        {
+          lost[i] = true;
+          n++;
+        }
+      }
+
+      for (i = 0; i < c.data; i++)
+      {
+        memcpy(received[i], lost[i] ? repairs[0] : segments[i], SegmentSize);   //lost segments hold rubbish
+      }
+
+      start = std::chrono::steady_clock::now();
+      decode(c.data, lost);
+      decodesecs += seconds(start);
+
+      for (i = 0; i < c.data; i++)
+      {
+        if (memcmp(received[i], segments[i], SegmentSize))
+        {
+          failures++;
+          break;
+        }
+      }
+    }
+
+    printf("%4u  %6u  %7.1f%%  %11.1f  %11.1f  %s\n", c.data, c.repair, (100.0 * c.repair) / c.data,
+           (groups * c.data * SegmentSize) / encodesecs / 1e6, (groups * c.data * SegmentSize) / decodesecs / 1e6,
+           failures ? "FAILED" : "all");
+  }
+
+  return failures ? 1 : 0;
+}
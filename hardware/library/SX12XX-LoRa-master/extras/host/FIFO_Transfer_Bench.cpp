@@ -0,0 +1,202 @@
+/*
+  Licensed under a MIT license, see LICENSE.txt in the library src folder.
+  Original published 16/10/26
+*/
+
+/*******************************************************************************************************
+  Program Operation - Times loading and unloading the FIFO of a simulated SX1278 for packet sizes from 8
+  to 255 bytes. Each load is startWriteSXBuffer(), the data, endWriteSXBuffer(), and each unload the same
+  with the read functions, first moving the data one SPI.transfer() per byte as the driver used to, then
+  with writeBufferbytes() and readBufferbytes(), which use the block transfers in LTSPI.h. The data read
+  back is checked against what was written.
+
+  The SPI bus is wrapped to count the calls the driver makes to it. The times are for the host, each call
+  goes through the HAL to the simulated device, so they show the per call overhead the block transfer
+  removes rather than the time on an ESP32, for that see the 45_FIFO_Transfer_Timing example.
+
+  Usage: FIFO_Transfer_Bench [loops]
+
+  Build from the library folder, see extras/host/README.md;
+  g++ -std=c++17 -O2 -pthread -Iextras/host -Isrc extras/host/LTHAL.cpp extras/host/SX127XSim.cpp
+      extras/host/FIFO_Transfer_Bench.cpp src/SX127XLT.cpp -o FIFO_Transfer_Bench
+*******************************************************************************************************/
+
+#include <SPI.h>
+#include <SX127XLT.h>
+#include <SX127XSim.h>
+
+#include <chrono>
+#include <stdio.h>
+#include <string.h>
+
+#define NSS 5                                //master_esp32 pins
+#define NRESET 14
+#define DIO0 2
+
+#define LORA_DEVICE DEVICE_SX1278
+
+const uint8_t PacketSizes[] = {8, 16, 32, 64, 128, 255};
+
+
+class LTCountingSPI : public LTHALSPI
+{
+  //forwards to the board and counts the calls made to the bus
+
+  public:
+    LTCountingSPI(LTSimBoard &board) : _board(board)
+    {
+    }
+
+    uint32_t calls = 0;
+
+    uint8_t transfer(uint8_t data)
+    {
+      calls++;
+      return _board.transfer(data);
+    }
+
+    void transferBytes(const uint8_t *data, uint8_t *out, uint32_t size)
+    {
+      calls++;
+      _board.transferBytes(data, out, size);
+    }
+
+  private:
+    LTSimBoard &_board;
+};
+
+
+LTSimAir air;
+SX127XSim radio(air);
+SX127XLT LT;
+uint32_t failures = 0;
+
+
+void loadBytewise(uint8_t *buffer, uint8_t size)
+{
+  uint8_t index;
+
+  LT.startWriteSXBuffer(0);
+
+  for (index = 0; index < size; index++)
+  {
+    SPI.transfer(buffer[index]);
+  }
+
+  LT.endWriteSXBuffer();
+}
+
+
+void unloadBytewise(uint8_t *buffer, uint8_t size)
+{
+  uint8_t index;
+
+  LT.startReadSXBuffer(0);
+
+  for (index = 0; index < size; index++)
+  {
+    buffer[index] = SPI.transfer(0);
+  }
+
+  LT.endReadSXBuffer();
+}
+
+
+void loadBlock(uint8_t *buffer, uint8_t size)
+{
+  LT.startWriteSXBuffer(0);
+  LT.writeBufferbytes(buffer, size);
+  LT.endWriteSXBuffer();
+}
+
+
+void unloadBlock(uint8_t *buffer, uint8_t size)
+{
+  LT.startReadSXBuffer(0);
+  LT.readBufferbytes(buffer, size);
+  LT.endReadSXBuffer();
+}
+
+
+double timeTransfer(void (*transfer)(uint8_t *, uint8_t), uint8_t *buffer, uint8_t size, uint32_t loops,
+                    LTCountingSPI &spi, uint32_t &calls)
+{
+  //returns uS per transfer, calls is the SPI calls for one
+
+  uint32_t index;
+
+  spi.calls = 0;
+  transfer(buffer, size);
+  calls = spi.calls;
+
+  auto start = std::chrono::steady_clock::now();
+
+  for (index = 0; index < loops; index++)
+  {
+    transfer(buffer, size);
+  }
+
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::micro>(end - start).count() / loops;
+}
+
+
+int main(int argc, char *argv[])
+{
+  uint32_t loops = (argc > 1) ? atoi(argv[1]) : 20000;
+  uint8_t txbuffer[256], rxbuffer[256];
+  uint32_t bytecalls, blockcalls, index;
+  double byteuS, blockuS;
+
+  LTSimBoard board;
+  LTCountingSPI spi(board);
+  board.attach(radio, NSS, NRESET, DIO0);
+  LTHALbind(&spi, &board);
+
+  if (!LT.begin(NSS, NRESET, DIO0, LORA_DEVICE))
+  {
+    printf("No LoRa device responding\n");
+    return 1;
+  }
+
+  LT.setupLoRa(434000000, 0, LORA_SF7, LORA_BW_125, LORA_CR_4_5, LDRO_AUTO);
+
+  for (index = 0; index < sizeof(txbuffer); index++)
+  {
+    txbuffer[index] = (uint8_t) ((index * 37) + 11);
+  }
+
+  printf("%u loops per figure, uS per load or unload on this host, SPI calls in brackets\n\n", loops);
+  printf("Bytes  Load bytewise      Load block       Unload bytewise    Unload block\n");
+
+  for (uint8_t size : PacketSizes)
+  {
+    printf("%5u", size);
+
+    byteuS = timeTransfer(loadBytewise, txbuffer, size, loops, spi, bytecalls);
+    blockuS = timeTransfer(loadBlock, txbuffer, size, loops, spi, blockcalls);
+    printf("  %7.2f (%3u)    %7.2f (%3u)", byteuS, bytecalls, blockuS, blockcalls);
+
+    memset(rxbuffer, 0, sizeof(rxbuffer));
+    byteuS = timeTransfer(unloadBytewise, rxbuffer, size, loops, spi, bytecalls);
+
+    if (memcmp(txbuffer, rxbuffer, size) != 0)
+    {
+      failures++;
+    }
+
+    memset(rxbuffer, 0, sizeof(rxbuffer));
+    blockuS = timeTransfer(unloadBlock, rxbuffer, size, loops, spi, blockcalls);
+
+    if (memcmp(txbuffer, rxbuffer, size) != 0)
+    {
+      failures++;
+    }
+
+    printf("    %7.2f (%3u)    %7.2f (%3u)\n", byteuS, bytecalls, blockuS, blockcalls);
+    fflush(stdout);
+  }
+
+  printf("\n%s\n", failures ? "FIFO data mismatch" : "FIFO data matches");
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,259 @@
+/*
+  Licensed under a MIT license, see LICENSE.txt in the library src folder.
+  Original published 16/10/26
+*/
+
+/*******************************************************************************************************
+  Program Operation - Tests the LTForest.h Random Forest inference with the model of the backend,
+  LTForestModel.h, against the predictions of the model in Python;
+
+  Reference - every distinct sample of the recorded CSVs, in Forest_Reference.csv with the prediction
+              export_forest.py got from the model, predict() and predictExact() must give the same
+  Margin    - random inputs over the recorded ranges and inputs either side of every threshold,
+              predict() must give the same as predictExact(), the count that took the exact path is
+              printed
+  Inputs    - toInput() of readings as the firmware has them, and of ones that do not fit
+
+  Then the time per prediction of predict() and predictExact() is printed. The program returns 1 if a
+  prediction differs.
+
+  Usage: Forest_Inference_Test [reference csv] [random samples]
+
+  Build from the library folder, see extras/host/README.md;
+  g++ -std=c++17 -O2 -Iextras/host -Isrc extras/host/Forest_Inference_Test.cpp -o Forest_Inference_Test
+*******************************************************************************************************/
+
+#include <LTForest.h>
+#include <LTForestModel.h>
+
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <vector>
+#include <stdio.h>
+
+struct ReferenceRow
+{
+  int16_t inputs[LTForestInputs];
+  int16_t prediction;
+};
+
+uint32_t failures = 0;
+
+
+void check(bool ok, const char *test, const char *what)
+{
+  if (!ok)
+  {
+    failures++;
+    printf("FAIL %s: %s\n", test, what);
+  }
+}
+
+
+bool readReference(const char *path, std::vector<ReferenceRow> &rows)
+{
+  FILE *file = fopen(path, "r");
+  char line[160];
+  char *field;
+  ReferenceRow row;
+
+  if (file == NULL)
+  {
+    return false;
+  }
+
+  fgets(line, sizeof(line), file);                   //header
+
+  while (fgets(line, sizeof(line), file) != NULL)
+  {
+    field = strchr(line, ',');                       //after the source
+
+    for (uint8_t index = 0; (field != NULL) && (index < LTForestInputs); index++)
+    {
+      row.inputs[index] = (int16_t) strtol(field + 1, &field, 10);
+    }
+
+    if (field != NULL)
+    {
+      row.prediction = (int16_t) strtol(field + 1, NULL, 10);
+      rows.push_back(row);
+    }
+  }
+
+  fclose(file);
+  return true;
+}
+
+
+double seconds(std::chrono::steady_clock::time_point start)
+{
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+
+void testReference(const std::vector<ReferenceRow> &rows)
+{
+  uint32_t wrong = 0, exacts = 0;
+  bool exact;
+
+  for (const ReferenceRow &row : rows)
+  {
+    int16_t fast = LTForest::predict(LTForestSIESPRO, row.inputs, &exact);
+
+    exacts += exact;
+
+    if ((fast != row.prediction) || (LTForest::predictExact(LTForestSIESPRO, row.inputs) != row.prediction))
+    {
+      wrong++;
+      printf("  %d,%d,%d,%d expected %d, predict() %d\n", row.inputs[0], row.inputs[1], row.inputs[2],
+             row.inputs[3], row.prediction, fast);
+    }
+  }
+
+  printf("Reference  %u samples, %u differ, %u took the exact path\n", (uint32_t) rows.size(), wrong, exacts);
+  check(wrong == 0, "Reference", "prediction differs from the model in Python");
+  check(!rows.empty(), "Reference", "no samples read");
+}
+
+
+void testMargin(const std::vector<ReferenceRow> &rows, uint32_t samples)
+{
+  int16_t low[LTForestInputs], high[LTForestInputs], inputs[LTForestInputs];
+  uint32_t tested = 0, wrong = 0, exacts = 0;
+  bool exact;
+  std::mt19937 random(1);
+
+  for (uint8_t index = 0; index < LTForestInputs; index++)
+  {
+    low[index] = INT16_MAX;
+    high[index] = INT16_MIN;
+
+    for (const ReferenceRow &row : rows)
+    {
+      low[index] = std::min(low[index], row.inputs[index]);
+      high[index] = std::max(high[index], row.inputs[index]);
+    }
+
+    low[index] -= 1000;                                //10 units either side of what was recorded
+    high[index] += 1000;
+  }
+
+  auto test = [&]()
+  {
+    tested++;
+
+    if (LTForest::predict(LTForestSIESPRO, inputs, &exact) != LTForest::predictExact(LTForestSIESPRO, inputs))
+    {
+      wrong++;
+    }
+
+    exacts += exact;
+  };
+
+  for (uint32_t sample = 0; sample < samples; sample++)
+  {
+    for (uint8_t index = 0; index < LTForestInputs; index++)
+    {
+      inputs[index] = (int16_t) std::uniform_int_distribution<int>(low[index], high[index])(random);
+    }
+
+    test();
+  }
+
+  for (const LTForestNode &node : LTForestNodes)
+  {
+    for (int16_t side = 0; side < 2; side++)
+    {
+      for (uint8_t index = 0; index < LTForestInputs; index++)
+      {
+        inputs[index] = (int16_t) std::uniform_int_distribution<int>(low[index], high[index])(random);
+      }
+
+      inputs[node.input] = (int16_t) (node.threshold + side);
+      test();
+    }
+  }
+
+  printf("Margin     %u samples, %u differ, %u took the exact path\n", tested, wrong, exacts);
+  check(wrong == 0, "Margin", "predict() differs from predictExact()");
+}
+
+
+void testInputs()
+{
+  check(LTForest::toInput(20.7F) == 2070, "Inputs", "DHT11 temperature");
+  check(LTForest::toInput(57.4F) == 5740, "Inputs", "DHT11 humidity");
+  check(LTForest::toInput(-106) == -10600, "Inputs", "RSSI");
+  check(LTForest::toInput(-7) == -700, "Inputs", "SNR");
+  check(LTForest::toInput(327.67F) == 32767, "Inputs", "largest reading");
+  check(LTForest::toInput(-327.67F) == -32767, "Inputs", "smallest reading");
+  check(LTForest::toInput(400) == LTForestNoInput, "Inputs", "reading too large");
+  check(LTForest::toInput(-400) == LTForestNoInput, "Inputs", "reading too small");
+  check(LTForest::toInput(NAN) == LTForestNoInput, "Inputs", "failed DHT11 read");
+
+  int16_t inputs[LTForestInputs] = {2070, 5740, -10600, -700};
+  check(LTForest::validInputs(LTForestSIESPRO, inputs), "Inputs", "valid inputs refused");
+  inputs[1] = LTForestNoInput;
+  check(!LTForest::validInputs(LTForestSIESPRO, inputs), "Inputs", "missing input taken");
+}
+
+
+void timePredictions(const std::vector<ReferenceRow> &rows)
+{
+  const uint32_t laps = 200;
+  volatile int16_t sink = 0;
+  uint32_t predictions = laps * rows.size();
+
+  auto start = std::chrono::steady_clock::now();
+
+  for (uint32_t lap = 0; lap < laps; lap++)
+  {
+    for (const ReferenceRow &row : rows)
+    {
+      sink = sink + LTForest::predict(LTForestSIESPRO, row.inputs);
+    }
+  }
+
+  double fastsecs = seconds(start);
+  start = std::chrono::steady_clock::now();
+
+  for (uint32_t lap = 0; lap < laps; lap++)
+  {
+    for (const ReferenceRow &row : rows)
+    {
+      sink = sink + LTForest::predictExact(LTForestSIESPRO, row.inputs);
+    }
+  }
+
+  double exactsecs = seconds(start);
+
+  printf("Time       predict() %.2fuS, predictExact() %.2fuS per prediction on this host\n",
+         (fastsecs * 1e6) / predictions, (exactsecs * 1e6) / predictions);
+}
+
+
+int main(int argc, char *argv[])
+{
+  const char *path = (argc > 1) ? argv[1] : "extras/host/Forest_Reference.csv";
+  uint32_t samples = (argc > 2) ? atoi(argv[2]) : 200000;
+  std::vector<ReferenceRow> rows;
+
+  printf("Model      %u trees, %u split nodes, %u bytes of tables\n", LTForestTrees,
+         (uint32_t) (sizeof(LTForestNodes) / sizeof(LTForestNode)),
+         (uint32_t) (sizeof(LTForestNodes) + sizeof(LTForestRoots) + sizeof(LTForestLeafFixed) + sizeof(LTForestLeafProba)));
+
+  if (!readReference(path, rows))
+  {
+    printf("Cannot open %s\n", path);
+    return 1;
+  }
+
+  testReference(rows);
+  testMargin(rows, samples);
+  testInputs();
+  timePredictions(rows);
+
+  printf("%s, %u failures\n", failures ? "FAILED" : "PASSED", failures);
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,365 @@
+/*
+  Licensed under a MIT license, see LICENSE.txt in the library src folder.
+  Original published 16/10/26
+*/
+
+#include <Arduino.h>
+#include <SPI.h>
+
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <random>
+#include <stdio.h>
+
+HardwareSerial Serial;
+SPIClass SPI;
+
+static thread_local LTHALSPI *_halSPI = NULL;
+static thread_local LTHALGPIO *_halGPIO = NULL;
+static LTHALClock *_halClock = NULL;
+static std::mutex _printLock;
+static std::mt19937 _random(1);
+
+
+/***************************************************************************
+  Null devices, used when a thread has not been bound
+***************************************************************************/
+
+class LTNullSPI : public LTHALSPI
+{
+  public:
+    uint8_t transfer(uint8_t data)
+    {
+      (void) data;
+      return 0xFF;
+    }
+};
+
+
+class LTNullGPIO : public LTHALGPIO
+{
+  public:
+    void pinMode(uint8_t pin, uint8_t mode)
+    {
+      (void) pin;
+      (void) mode;
+    }
+    void digitalWrite(uint8_t pin, uint8_t level)
+    {
+      (void) pin;
+      (void) level;
+    }
+    int digitalRead(uint8_t pin)
+    {
+      (void) pin;
+      return LOW;
+    }
+};
+
+static LTNullSPI _nullSPI;
+static LTNullGPIO _nullGPIO;
+static LTHostClock _defaultClock;
+
+
+/***************************************************************************
+  Binding
+***************************************************************************/
+
+void LTHALbind(LTHALSPI *spi, LTHALGPIO *gpio)
+{
+  _halSPI = spi;
+  _halGPIO = gpio;
+}
+
+
+void LTHALsetClock(LTHALClock *clock)
+{
+  _halClock = clock;
+}
+
+
+LTHALSPI *LTHALgetSPI()
+{
+  return _halSPI ? _halSPI : &_nullSPI;
+}
+
+
+LTHALGPIO *LTHALgetGPIO()
+{
+  return _halGPIO ? _halGPIO : &_nullGPIO;
+}
+
+
+LTHALClock *LTHALgetClock()
+{
+  return _halClock ? _halClock : &_defaultClock;
+}
+
+
+/***************************************************************************
+  LTHostClock
+***************************************************************************/
+
+static uint64_t steadyMicros()
+{
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+
+LTHostClock::LTHostClock(float scale)
+{
+  _scale = (scale > 0) ? scale : 1.0f;
+  _startuS = steadyMicros();
+}
+
+
+uint64_t LTHostClock::nowMicros()
+{
+  return (uint64_t) ((steadyMicros() - _startuS) * _scale);
+}
+
+
+void LTHostClock::sleepMicros(uint64_t us)
+{
+  std::this_thread::sleep_for(std::chrono::microseconds((uint64_t) (us / _scale)));
+}
+
+
+/***************************************************************************
+  Arduino API
+***************************************************************************/
+
+void pinMode(uint8_t pin, uint8_t mode)
+{
+  LTHALgetGPIO()->pinMode(pin, mode);
+}
+
+
+void digitalWrite(uint8_t pin, uint8_t level)
+{
+  LTHALgetGPIO()->digitalWrite(pin, level);
+}
+
+
+int digitalRead(uint8_t pin)
+{
+  return LTHALgetGPIO()->digitalRead(pin);
+}
+
+
+void attachInterrupt(uint8_t pin, void (*isr)(), int mode)
+{
+  LTHALgetGPIO()->attachInterrupt(pin, isr, mode);
+}
+
+
+void detachInterrupt(uint8_t pin)
+{
+  LTHALgetGPIO()->detachInterrupt(pin);
+}
+
+
+unsigned long millis()
+{
+  return (unsigned long) (LTHALgetClock()->nowMicros() / 1000);
+}
+
+
+unsigned long micros()
+{
+  return (unsigned long) LTHALgetClock()->nowMicros();
+}
+
+
+void delay(unsigned long ms)
+{
+  LTHALgetClock()->sleepMicros((uint64_t) ms * 1000);
+}
+
+
+void delayMicroseconds(unsigned int us)
+{
+  LTHALgetClock()->sleepMicros(us);
+}
+
+
+void yield()
+{
+  std::this_thread::yield();
+}
+
+
+long random(long howbig)
+{
+  if (howbig <= 0)
+  {
+    return 0;
+  }
+  return (long) (_random() % (unsigned long) howbig);
+}
+
+
+long random(long howsmall, long howbig)
+{
+  if (howsmall >= howbig)
+  {
+    return howsmall;
+  }
+  return howsmall + random(howbig - howsmall);
+}
+
+
+void randomSeed(unsigned long seed)
+{
+  _random.seed(seed);
+}
+
+
+/***************************************************************************
+  Print and Serial, output goes to stdout
+***************************************************************************/
+
+size_t Print::write(uint8_t data)
+{
+  std::lock_guard<std::mutex> guard(_printLock);
+  fputc(data, stdout);
+  return 1;
+}
+
+
+size_t Print::write(const uint8_t *buffer, size_t size)
+{
+  std::lock_guard<std::mutex> guard(_printLock);
+  return fwrite(buffer, 1, size, stdout);
+}
+
+
+size_t Print::print(const char *str)
+{
+  return write((const uint8_t *) str, strlen(str));
+}
+
+
+size_t Print::print(char c)
+{
+  return write((uint8_t) c);
+}
+
+
+size_t Print::print(unsigned char n, int base)
+{
+  return printNumber(n, base, false);
+}
+
+
+size_t Print::print(int n, int base)
+{
+  return print((long long) n, base);
+}
+
+
+size_t Print::print(unsigned int n, int base)
+{
+  return printNumber(n, base, false);
+}
+
+
+size_t Print::print(long n, int base)
+{
+  return print((long long) n, base);
+}
+
+
+size_t Print::print(unsigned long n, int base)
+{
+  return printNumber(n, base, false);
+}
+
+
+size_t Print::print(long long n, int base)
+{
+  if ((base == DEC) && (n < 0))
+  {
+    return printNumber((unsigned long long) (-n), base, true);
+  }
+  return printNumber((unsigned long long) n, base, false);
+}
+
+
+size_t Print::print(unsigned long long n, int base)
+{
+  return printNumber(n, base, false);
+}
+
+
+size_t Print::print(double n, int digits)
+{
+  char buff[48];
+  snprintf(buff, sizeof(buff), "%.*f", digits, n);
+  return print(buff);
+}
+
+
+size_t Print::println()
+{
+  return write((uint8_t) '\n');
+}
+
+
+void Print::flush()
+{
+  std::lock_guard<std::mutex> guard(_printLock);
+  fflush(stdout);
+}
+
+
+size_t Print::printNumber(unsigned long long n, int base, bool negative)
+{
+  char buff[72];
+  char *str = &buff[sizeof(buff) - 1];
+
+  if (base < 2)
+  {
+    base = DEC;
+  }
+
+  *str = '\0';
+
+  do
+  {
+    uint8_t digit = n % base;
+    n /= base;
+    *--str = (digit < 10) ? ('0' + digit) : ('A' + digit - 10);
+  } while (n);
+
+  if (negative)
+  {
+    *--str = '-';
+  }
+
+  return print(str);
+}
+
+
+void HardwareSerial::begin(unsigned long baud)
+{
+  (void) baud;
+}
+
+
+void HardwareSerial::end()
+{
+}
+
+
+int HardwareSerial::available()
+{
+  return 0;
+}
+
+
+int HardwareSerial::read()
+{
+  return -1;
+}
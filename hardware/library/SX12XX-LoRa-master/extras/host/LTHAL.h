@@ -0,0 +1,111 @@
+/*
+  Licensed under a MIT license, see LICENSE.txt in the library src folder.
+  Original published 16/10/26
+*/
+
+/*******************************************************************************************************
+  Host hardware abstraction layer for the SX12XX-LoRa library.
+
+  The library drivers talk to the hardware only through the Arduino API, SPI.transfer(), digitalWrite(),
+  digitalRead(), millis() and delay(). When the library is compiled on a Linux host with this folder on
+  the include path, the Arduino.h and SPI.h found here forward those calls to the three interfaces below,
+  so the driver source is compiled unchanged.
+
+  LTHALSPI   - the SPI bus, one byte or block transfers with the device selected by the GPIO
+  LTHALGPIO  - pin mode, write and read, and interrupts on a pin changing
+  LTHALClock - the time base for millis(), micros() and delay()
+
+  The SPI bus and GPIO are bound per thread with LTHALbind(), so a master and a slave node can each run
+  their own code in their own thread of the same process, each seeing its own pins. The clock is shared
+  by all threads.
+*******************************************************************************************************/
+
+#ifndef LTHAL_h
+#define LTHAL_h
+
+#include <stdint.h>
+
+
+class LTHALSPI
+{
+  public:
+    virtual ~LTHALSPI() {}
+    virtual void beginTransaction() {}
+    virtual uint8_t transfer(uint8_t data) = 0;
+    virtual void endTransaction() {}
+
+    virtual void transferBytes(const uint8_t *data, uint8_t *out, uint32_t size)
+    {
+      //size bytes from data, 0xFF if data is NULL, what comes back goes to out if not NULL. A bus that
+      //can do better than a byte at a time overrides this.
+      uint32_t index;
+      uint8_t received;
+
+      for (index = 0; index < size; index++)
+      {
+        received = transfer(data ? data[index] : 0xFF);
+
+        if (out)
+        {
+          out[index] = received;
+        }
+      }
+    }
+};
+
+
+class LTHALGPIO
+{
+  public:
+    virtual ~LTHALGPIO() {}
+    virtual void pinMode(uint8_t pin, uint8_t mode) = 0;
+    virtual void digitalWrite(uint8_t pin, uint8_t level) = 0;
+    virtual int digitalRead(uint8_t pin) = 0;
+
+    virtual void attachInterrupt(uint8_t pin, void (*isr)(), int mode)
+    {
+      //GPIO that can watch its pins calls isr from its own thread on the edge set by mode
+      (void) pin;
+      (void) isr;
+      (void) mode;
+    }
+
+    virtual void detachInterrupt(uint8_t pin)
+    {
+      (void) pin;
+    }
+};
+
+
+class LTHALClock
+{
+  public:
+    virtual ~LTHALClock() {}
+    virtual uint64_t nowMicros() = 0;                 //monotonic time in uS since the clock started
+    virtual void sleepMicros(uint64_t us) = 0;        //block the calling thread for us
+};
+
+
+class LTHostClock : public LTHALClock
+{
+  //wall clock time base, a scale above 1 runs simulated time faster than real time, so a scale of 10
+  //makes a 1000mS delay() take 100mS of real time. Airtime in the simulated radio scales with it.
+
+  public:
+    LTHostClock(float scale = 1.0f);
+    uint64_t nowMicros();
+    void sleepMicros(uint64_t us);
+
+  private:
+    float _scale;
+    uint64_t _startuS;
+};
+
+
+void LTHALbind(LTHALSPI *spi, LTHALGPIO *gpio);      //bind SPI bus and GPIO to the calling thread
+void LTHALsetClock(LTHALClock *clock);               //set the clock for all threads, default is LTHostClock
+LTHALSPI *LTHALgetSPI();
+LTHALGPIO *LTHALgetGPIO();
+LTHALClock *LTHALgetClock();
+
+#endif
@@ -0,0 +1,309 @@
+/*
+  Licensed under a MIT license, see LICENSE.txt in the library src folder.
+  Original published 16/10/26
+*/
+
+/*******************************************************************************************************
+  Program Operation - Tests the LTLinkStats.h rolling link statistics against a model that keeps the
+  whole history and works each statistic out again from it, sorting for the median and in doubles for
+  the deviation;
+
+  Random     - polls with random attempts, lost polls and RSSI and SNR over their whole range, the
+               summary is checked after every poll
+  Recorded   - the RSSI and SNR of the recorded dataset CSVs, in the order recorded, checked the same
+               way. The mean change from one sample to the next of the RSSI and SNR, of their EWMA
+               and of their median is printed, how much steadier the features are than one ACK
+
+  Then the time per addPoll() and per summary is printed. The program returns 1 if a statistic differs
+  from the model, the deviation and EWMA by more than the rounding of their integer arithmetic.
+
+  Usage: Link_Stats_Test [polls] [recorded csv]...
+
+  Build from the library folder, see extras/host/README.md;
+  g++ -std=c++17 -O2 -Iextras/host -Isrc extras/host/Link_Stats_Test.cpp -o Link_Stats_Test
+*******************************************************************************************************/
+
+#include <LTLinkStats.h>
+
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <vector>
+#include <stdio.h>
+
+struct Poll
+{
+  bool acked;
+  uint8_t attempts;
+  int16_t rssi;
+  int8_t snr;
+};
+
+uint32_t failures = 0;
+
+
+void check(bool ok, const char *test, const char *what)
+{
+  if (!ok)
+  {
+    failures++;
+
+    if (failures < 20)
+    {
+      printf("FAIL %s: %s\n", test, what);
+    }
+  }
+}
+
+
+// ===================== Model, from the whole history =====================
+class Model
+{
+  public:
+
+    void addPoll(const Poll &poll)
+    {
+      polls.push_back(poll);
+
+      if (poll.acked)
+      {
+        rssi.push_back(std::max(-128, std::min(127, (int) poll.rssi)));
+        snr.push_back(poll.snr);
+        rssiEWMA = (rssi.size() == 1) ? rssi.back() : rssiEWMA + ((rssi.back() - rssiEWMA) / (1 << LTLinkStatsEWMAShift));
+        snrEWMA = (snr.size() == 1) ? snr.back() : snrEWMA + ((snr.back() - snrEWMA) / (1 << LTLinkStatsEWMAShift));
+      }
+    }
+
+    void check(LTLinkStats &stats, const char *test)
+    {
+      LTLinkSummary summary;
+      uint32_t sent = 0, acked = 0;
+
+      stats.getRSSI(summary);
+      checkWindow(summary, rssi, rssiEWMA, test, "RSSI");
+      stats.getSNR(summary);
+      checkWindow(summary, snr, snrEWMA, test, "SNR");
+
+      for (size_t index = (polls.size() > LTLinkStatsWindow) ? (polls.size() - LTLinkStatsWindow) : 0; index < polls.size(); index++)
+      {
+        sent += polls[index].attempts;
+        acked += polls[index].acked;
+      }
+
+      ::check(stats.getLossPercent() == (sent ? (((sent - acked) * 100) / sent) : 0), test, "loss percent");
+      ::check(stats.getSamples() == std::min<size_t>(rssi.size(), LTLinkStatsWindow), test, "samples");
+    }
+
+  private:
+
+    void checkWindow(const LTLinkSummary &summary, const std::vector<int> &history, double ewma, const char *test, const char *what)
+    {
+      char text[64];
+      std::vector<int> window(history.end() - std::min<size_t>(history.size(), LTLinkStatsWindow), history.end());
+      double mean = 0, variance = 0;
+
+      if (window.empty())
+      {
+        return;
+      }
+
+      std::sort(window.begin(), window.end());
+
+      for (int value : window)
+      {
+        mean += value;
+      }
+
+      mean /= window.size();
+
+      for (int value : window)
+      {
+        variance += (value - mean) * (value - mean);
+      }
+
+      variance /= window.size();
+
+      snprintf(text, sizeof(text), "%s median", what);
+      ::check(summary.median == (window[(window.size() - 1) / 2] + window[window.size() / 2]) * 5, test, text);
+      snprintf(text, sizeof(text), "%s min and max", what);
+      ::check((summary.min == window.front()) && (summary.max == window.back()), test, text);
+      snprintf(text, sizeof(text), "%s deviation", what);
+      ::check(fabs(summary.deviation - (sqrt(variance) * 10)) < 1.0, test, text);
+      snprintf(text, sizeof(text), "%s EWMA", what);
+      ::check(fabs(summary.ewma - (ewma * 10)) < 4.0, test, text);           //the stats truncate to 1/16dB each step
+    }
+
+    std::vector<Poll> polls;
+    std::vector<int> rssi, snr;
+    double rssiEWMA = 0, snrEWMA = 0;
+};
+
+
+void testRandom(uint32_t count)
+{
+  std::mt19937 random(1);
+  LTLinkStats stats;
+  Model model;
+  Poll poll;
+
+  for (uint32_t index = 0; index < count; index++)
+  {
+    poll.attempts = (uint8_t) std::uniform_int_distribution<int>(1, 3)(random);
+    poll.acked = (std::uniform_int_distribution<int>(0, 9)(random) < 8);
+    poll.rssi = (int16_t) std::uniform_int_distribution<int>(-150, -20)(random);
+    poll.snr = (int8_t) std::uniform_int_distribution<int>(-20, 12)(random);
+
+    stats.addPoll(poll.acked, poll.attempts, poll.rssi, poll.snr);
+    model.addPoll(poll);
+    model.check(stats, "Random");
+  }
+
+  printf("Random     %u polls checked\n", count);
+}
+
+
+double meanChange(const std::vector<double> &values)
+{
+  double total = 0;
+
+  for (size_t index = 1; index < values.size(); index++)
+  {
+    total += fabs(values[index] - values[index - 1]);
+  }
+
+  return (values.size() > 1) ? (total / (values.size() - 1)) : 0;
+}
+
+
+void testRecorded(const char *path)
+{
+  FILE *file = fopen(path, "r");
+  char line[256];
+  int rssicolumn = -1, snrcolumn = -1, column;
+  char *field, *save;
+  std::vector<double> rssi, snr, rssiEWMA, snrEWMA, rssiMedian, snrMedian;
+  LTLinkStats stats;
+  LTLinkSummary summary;
+  Model model;
+  Poll poll = {true, 1, 0, 0};
+
+  if (file == NULL)
+  {
+    printf("Recorded   cannot open %s\n", path);
+    failures++;
+    return;
+  }
+
+  if (fgets(line, sizeof(line), file) != NULL)
+  {
+    for (column = 0, field = strtok_r(line, ",\r\n", &save); field != NULL; column++, field = strtok_r(NULL, ",\r\n", &save))
+    {
+      rssicolumn = (strcmp(field, "rssi_dBm") == 0) ? column : rssicolumn;
+      snrcolumn = (strcmp(field, "snr_dB") == 0) ? column : snrcolumn;
+    }
+  }
+
+  while ((rssicolumn >= 0) && (snrcolumn >= 0) && (fgets(line, sizeof(line), file) != NULL))
+  {
+    for (column = 0, field = strtok_r(line, ",\r\n", &save); field != NULL; column++, field = strtok_r(NULL, ",\r\n", &save))
+    {
+      if (column == rssicolumn)
+      {
+        poll.rssi = (int16_t) lround(atof(field));
+      }
+
+      if (column == snrcolumn)
+      {
+        poll.snr = (int8_t) lround(atof(field));
+      }
+    }
+
+    stats.addPoll(true, 1, poll.rssi, poll.snr);
+    model.addPoll(poll);
+    model.check(stats, "Recorded");
+
+    rssi.push_back(poll.rssi);
+    snr.push_back(poll.snr);
+    stats.getRSSI(summary);
+    rssiEWMA.push_back(summary.ewma / 10.0);
+    rssiMedian.push_back(summary.median / 10.0);
+    stats.getSNR(summary);
+    snrEWMA.push_back(summary.ewma / 10.0);
+    snrMedian.push_back(summary.median / 10.0);
+  }
+
+  fclose(file);
+
+  printf("Recorded   %-28s %4u samples, mean change RSSI %.2f EWMA %.2f median %.2f dB, SNR %.2f EWMA %.2f median %.2f dB\n",
+         strrchr(path, '/') ? (strrchr(path, '/') + 1) : path, (uint32_t) rssi.size(), meanChange(rssi),
+         meanChange(rssiEWMA), meanChange(rssiMedian), meanChange(snr), meanChange(snrEWMA), meanChange(snrMedian));
+}
+
+
+void timeStats()
+{
+  const uint32_t polls = 1000000;
+  std::mt19937 random(2);
+  std::vector<Poll> sequence(4096);
+  LTLinkStats stats;
+  LTLinkSummary summary;
+  volatile int32_t sink = 0;
+
+  for (Poll &poll : sequence)
+  {
+    poll = {(random() % 10) < 8, (uint8_t) (1 + (random() % 3)), (int16_t) (-150 + (int) (random() % 130)), (int8_t) (-20 + (int) (random() % 32))};
+  }
+
+  auto start = std::chrono::steady_clock::now();
+
+  for (uint32_t index = 0; index < polls; index++)
+  {
+    const Poll &poll = sequence[index % sequence.size()];
+    stats.addPoll(poll.acked, poll.attempts, poll.rssi, poll.snr);
+  }
+
+  double addsecs = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  start = std::chrono::steady_clock::now();
+
+  for (uint32_t index = 0; index < polls; index++)
+  {
+    stats.getRSSI(summary);
+    sink = sink + summary.deviation + stats.getLossPercent();
+  }
+
+  double summarysecs = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  printf("Time       addPoll() %.1fnS, getRSSI() and getLossPercent() %.1fnS on this host, %u bytes per node\n",
+         (addsecs * 1e9) / polls, (summarysecs * 1e9) / polls, (uint32_t) sizeof(LTLinkStats));
+}
+
+
+int main(int argc, char *argv[])
+{
+  uint32_t polls = (argc > 1) ? atoi(argv[1]) : 100000;
+  const char *recorded[] = {"../../master_esp32/IA_config/dataset_tool/mediciones_loRa_[2s].csv",
+                            "../../master_esp32/IA_config/dataset_tool/mediciones_loRa_[3s].csv"
+                           };
+
+  testRandom(polls);
+
+  if (argc > 2)
+  {
+    for (int index = 2; index < argc; index++)
+    {
+      testRecorded(argv[index]);
+    }
+  }
+  else
+  {
+    for (const char *path : recorded)
+    {
+      testRecorded(path);
+    }
+  }
+
+  timeStats();
+
+  printf("%s, %u failures\n", failures ? "FAILED" : "PASSED", failures);
+  return failures ? 1 : 0;
+}
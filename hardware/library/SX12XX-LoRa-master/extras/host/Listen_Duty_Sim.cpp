@@ -0,0 +1,286 @@
+/*
+  Licensed under a MIT license, see LICENSE.txt in the library src folder.
+  Original published 16/10/26
+*/
+
+/*******************************************************************************************************
+  Program Operation - Checks the energy and latency model of LTListen.h against the simulated SX1278. A
+  master sends reliable packets at random to a slave, on average one per gap seconds, up to 3 times each.
+
+  The slave runs twice. First as it was, always in RX with receiveReliableAutoACK(). Then duty cycled as
+  in LTListen.h, the device asleep and the processor in light sleep, here a delay(), waking once a period
+  for doCAD() and only receiving when it finds a preamble. The master sends with setReliablePreamble() set
+  to the preamble LTListen gives for the period.
+
+  The charge used by the slave is worked out from the time the simulated device spent in each mode and the
+  time the slave was awake, at the currents of the model. It is printed next to the average current the
+  model predicts for the packets received, with the time from the start of each packet to its CAD
+  against the longest the model allows. The host wakes late from a delay(), so the model is given the
+  time the slave was really awake in each wake up. The program returns 1 if the two currents differ by
+  more than 10% or a wake up took over 10mS longer than the model allows, the 10mS for the host threads.
+
+  Usage: Listen_Duty_Sim [packets] [gap S] [period mS] [time scale]
+
+  Build from the library folder, see extras/host/README.md;
+  g++ -std=c++17 -O2 -pthread -Iextras/host -Isrc extras/host/LTHAL.cpp extras/host/SX127XSim.cpp
+      extras/host/Listen_Duty_Sim.cpp src/SX127XLT.cpp -o Listen_Duty_Sim
+*******************************************************************************************************/
+
+#include <SPI.h>
+#include <SX127XLT.h>
+#include <SX127XSim.h>
+#include <LTListen.h>
+
+#include <atomic>
+#include <random>
+#include <thread>
+#include <stdio.h>
+
+#define NSS 5                                //master_esp32 pins
+#define NRESET 14
+#define DIO0 2
+#define SLAVE_NSS 7                          //slave_esp32_mini pins
+#define SLAVE_NRESET 3
+#define SLAVE_DIO0 2
+
+#define LORA_DEVICE DEVICE_SX1278
+const uint32_t Frequency = 434000000;
+const uint16_t NetworkID = 0x3210;
+const uint32_t ACKtimeout = 1000;
+const uint32_t TXtimeout = 1000;
+const uint8_t TXattempts = 3;
+const uint32_t ACKdelay = 100;
+const uint32_t RXtimeout = 1000;             //continuous RX, short so the slave sees the end of the run
+const int8_t MasterTXpower = 10;
+const int8_t SlaveTXpower = 2;
+const uint32_t SymboluS = 1024;              //SF7 BW125
+const uint32_t LatencySlackmS = 10;          //a late wake up of the host threads, 1mS real at time scale 10
+
+LTListen Listen;
+std::atomic<bool> slaveRun;
+std::atomic<uint64_t> txStartuS;             //start of the packet the master is sending, 0 for none
+
+
+struct LTSlaveResult
+{
+  uint32_t received;
+  uint32_t wakeups;
+  uint32_t detected;                         //wake ups with a preamble found
+  uint64_t sleptuS;                          //processor in light sleep
+  uint64_t idleawakeuS;                      //awake in the wake ups with no preamble
+  uint64_t latencyuS;                        //packet start to CAD, total and largest
+  uint64_t maxlatencyuS;
+};
+
+
+void setupNode(SX127XLT &LT, LTSimBoard &board, SX127XSim &radio, int8_t nss, int8_t nreset, int8_t dio0)
+{
+  board.attach(radio, nss, nreset, dio0);
+  LTHALbind(&board, &board);
+
+  if (!LT.begin(nss, nreset, dio0, LORA_DEVICE))
+  {
+    Serial.println(F("No LoRa device responding"));
+    exit(1);
+  }
+
+  LT.setupLoRa(Frequency, 0, LORA_SF7, LORA_BW_125, LORA_CR_4_5, LDRO_AUTO);
+}
+
+
+void slaveNode(SX127XSim *radio, bool listen, LTSlaveResult *result)
+{
+  SX127XLT LT;
+  LTSimBoard board;
+  uint8_t RXBUFFER[251];
+  uint64_t nextuS, startuS, latencyuS, sleepuS, wakeuS;
+
+  setupNode(LT, board, *radio, SLAVE_NSS, SLAVE_NRESET, SLAVE_DIO0);
+  nextuS = micros();
+
+  while (slaveRun)
+  {
+    if (!listen)
+    {
+      if (LT.receiveReliableAutoACK(RXBUFFER, sizeof(RXBUFFER), NetworkID, ACKdelay, SlaveTXpower, RXtimeout, WAIT_RX))
+      {
+        result->received++;
+      }
+
+      continue;
+    }
+
+    startuS = micros();
+    LT.setSleep(CONFIGURATION_RETENTION);
+    sleepuS = micros() - startuS;
+    nextuS = nextuS + (Listen.getPeriod() * 1000);
+    startuS = micros();
+
+    if (nextuS > startuS)
+    {
+      delayMicroseconds(nextuS - startuS);   //light sleep on the ESP32
+      result->sleptuS += micros() - startuS;
+    }
+
+    wakeuS = micros();
+    LT.wake();
+    delayMicroseconds(LTListenWakeuS);       //the processor and device waking
+    result->wakeups++;
+
+    if (!LT.doCAD())
+    {
+      result->idleawakeuS += sleepuS + (micros() - wakeuS);
+      continue;
+    }
+
+    result->detected++;
+
+    if (txStartuS)
+    {
+      latencyuS = micros() - txStartuS;
+      result->latencyuS += latencyuS;
+      result->maxlatencyuS = (latencyuS > result->maxlatencyuS) ? latencyuS : result->maxlatencyuS;
+    }
+
+    if (LT.receiveReliableAutoACK(RXBUFFER, sizeof(RXBUFFER), NetworkID, ACKdelay, SlaveTXpower, Listen.getRXTimeout(), WAIT_RX))
+    {
+      result->received++;
+    }
+
+    if (micros() > nextuS)
+    {
+      nextuS = micros();                     //a packet took the slave past its next wake up
+    }
+  }
+
+  LT.setSleep(CONFIGURATION_RETENTION);
+}
+
+
+void runLink(bool listen, uint32_t packets, uint32_t gapS)
+{
+  LTSimAir air;
+  SX127XSim masterRadio(air), slaveRadio(air);
+  SX127XLT LT;
+  LTSimBoard board;
+  LTSlaveResult result = {};
+  std::mt19937 random(1234);
+  std::exponential_distribution<double> gap(1.0 / (gapS * 1000.0));
+  uint8_t payload[] = "SIESPRO";
+  uint32_t index, acked = 0, transmissions = 0, exchangemS = 0, startmS;
+  uint8_t attempts, acknowledged;
+  uint64_t runstartuS, runuS, awakeuS, slaveTime[8];
+  double chargeuC, measureduA, modeluA, packetsperhour, payloaduS, ackuS;
+  const char *name = listen ? "Listen" : "RX";
+
+  setupNode(LT, board, masterRadio, NSS, NRESET, DIO0);
+  LT.setReliablePreamble(listen ? Listen.getPreamble() : 0);
+
+  slaveRun = true;
+  txStartuS = 0;
+  runstartuS = micros();
+  std::thread slave(slaveNode, &slaveRadio, listen, &result);
+
+  for (index = 0; index < packets; index++)
+  {
+    delay((uint32_t) gap(random));
+    attempts = 0;
+    startmS = millis();
+
+    do
+    {
+      attempts++;
+      transmissions++;
+      txStartuS = micros();
+      acknowledged = LT.transmitReliableAutoACK(payload, sizeof(payload) - 1, NetworkID, ACKtimeout, TXtimeout + Listen.getAddedLatencymS(), MasterTXpower, WAIT_TX);
+      txStartuS = 0;
+    } while (!acknowledged && (attempts < TXattempts));
+
+    if (acknowledged)
+    {
+      acked++;
+      exchangemS += millis() - startmS;
+    }
+  }
+
+  slaveRun = false;
+  slave.join();
+  runuS = micros() - runstartuS;
+
+  for (index = 0; index < 8; index++)
+  {
+    slaveTime[index] = slaveRadio.readModeTimeuS(index);
+  }
+
+  //charge from the time in each state at the currents of the model
+  awakeuS = runuS - result.sleptuS;
+  chargeuC = (130.0 * result.sleptuS) + (22000.0 * awakeuS);
+  chargeuC += 1600.0 * slaveTime[MODE_STDBY];
+  chargeuC += 11500.0 * (slaveTime[MODE_RXCONTINUOUS] + slaveTime[MODE_RXSINGLE] + slaveTime[MODE_CAD]);
+  chargeuC += 29000.0 * slaveTime[MODE_TX];
+  chargeuC = chargeuC / 1e6;
+  measureduA = (chargeuC * 1e6) / runuS;
+
+  packetsperhour = (result.received * 3600e6) / runuS;
+  payloaduS = 0;
+  ackuS = 0;
+
+  if (masterRadio.packetsSent && slaveRadio.packetsSent)
+  {
+    payloaduS = ((double) masterRadio.txAirtimeuS / masterRadio.packetsSent) - ((listen ? Listen.getPreamble() : LTListenShortPreamble) * (double) SymboluS);
+    ackuS = (double) slaveRadio.txAirtimeuS / slaveRadio.packetsSent;
+  }
+
+  //the host wakes late from each delay(), at larger time scales more so. The model is checked with the
+  //time the slave was really awake in each wake up, as an ESP32 with a longer wake up would be
+  LTListen host = Listen;
+  uint32_t idleuS = (result.wakeups > result.detected) ? result.idleawakeuS / (result.wakeups - result.detected) : 0;
+
+  if (idleuS > Listen.getCycleuS())
+  {
+    host.begin(Listen.getPeriod(), SymboluS, LTListenWakeuS + idleuS - Listen.getCycleuS());
+  }
+
+  modeluA = listen ? host.getAverageuA(packetsperhour, payloaduS, ACKdelay, ackuS) : host.getContinuousuA();
+
+  printf("%-6s acknowledged %u of %u, transmissions %u, exchange %.0fmS, slave received %u\n",
+         name, acked, packets, transmissions, acked ? (double) exchangemS / acked : 0.0, result.received);
+  printf("       slave %.1fmAh over %.0fs, average %.1fuA, model %.1fuA, difference %+.1f%%\n",
+         chargeuC / 3.6e3 / 1e3, runuS / 1e6, measureduA, modeluA, ((measureduA - modeluA) * 100) / modeluA);
+
+  if (listen)
+  {
+    printf("       preamble %u symbols, %u wake ups, awake %.1fmS in a wake up without a packet, model %.1fmS\n",
+           Listen.getPreamble(), result.wakeups, idleuS / 1e3, Listen.getCycleuS() / 1e3);
+    printf("       packet start to CAD average %.0fmS, largest %.0fmS, model largest %umS\n",
+           result.detected ? (result.latencyuS / 1e3) / result.detected : 0.0, result.maxlatencyuS / 1e3, host.getWakeLatencymS());
+  }
+
+  if (listen && ((fabs(measureduA - modeluA) > (modeluA / 10)) || ((result.maxlatencyuS / 1000) > (host.getWakeLatencymS() + LatencySlackmS))))
+  {
+    printf("       ERROR - outside the model\n");
+    exit(1);
+  }
+}
+
+
+int main(int argc, char *argv[])
+{
+  uint32_t packets = (argc > 1) ? atoi(argv[1]) : 60;
+  uint32_t gapS = (argc > 2) ? atoi(argv[2]) : 10;
+  uint32_t periodmS = (argc > 3) ? atoi(argv[3]) : 1000;
+  float scale = (argc > 4) ? atof(argv[4]) : 10;
+
+  LTHostClock clock(scale);
+  LTHALsetClock(&clock);
+  Listen.begin(periodmS, SymboluS);
+
+  printf("%u packets, one per %us on average, listen period %umS, SF7 BW125\n", packets, gapS, periodmS);
+
+  runLink(false, packets, gapS);
+  runLink(true, packets, gapS);
+
+  printf("Continuous RX %.0fuA, listening idle %.1fuA, packets delayed %umS\n",
+         Listen.getContinuousuA(), Listen.getIdleuA(), Listen.getAddedLatencymS());
+  return 0;
+}
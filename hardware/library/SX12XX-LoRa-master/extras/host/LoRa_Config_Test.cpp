@@ -0,0 +1,215 @@
+/*
+  Licensed under a MIT license, see LICENSE.txt in the library src folder.
+  Original published 16/10/26
+*/
+
+/*******************************************************************************************************
+  Program Operation - Checks applyConfig() of SX127XLT with the register images of LTLoRaConfig.h
+  against setupLoRa() on a simulated SX1278;
+
+  Settings - every spreading factor, bandwidth and coding rate, LDRO auto, off and on, at 434MHz, at
+             434MHz with an offset and at 868MHz and 915MHz. For each the device is reset and set up
+             with setupLoRa(), then reset and set up with applyConfig() of the image worked out at run
+             time by the same constexpr function, and every register of the device must be the same.
+             The driver must report the same frequency, settings and time on air, and its register
+             shadow copies must match the device
+  SIESPRO  - the settings of the firmware, 434MHz SF7 BW125 CR4/5, from the LTLoRaConfig template so
+             the image is worked out by the compiler, checked with static_assert. The SPI transactions
+             of setupLoRa() and applyConfig() after a reset are printed. An SF5 configuration must build
+             for its SX126X image, using its SX127X image stops the build
+
+  The program returns 1 if a check fails.
+
+  Build from the library folder, see extras/host/README.md;
+  g++ -std=c++17 -O2 -pthread -Iextras/host -Isrc extras/host/LTHAL.cpp extras/host/SX127XSim.cpp
+      extras/host/LoRa_Config_Test.cpp src/SX127XLT.cpp -o LoRa_Config_Test
+*******************************************************************************************************/
+
+#include <SPI.h>
+#include <SX127XLT.h>
+#include <SX127XSim.h>
+
+#include <stdio.h>
+
+#define NSS 5                                //master_esp32 pins
+#define NRESET 14
+#define DIO0 2
+
+#define LORA_DEVICE DEVICE_SX1278
+
+typedef LTLoRaConfig<434000000, 7, 125000, 5> SIESPROConfig;
+
+static_assert((SIESPROConfig::SX127X.frf[0] == 0x6C) && (SIESPROConfig::SX127X.frf[1] == 0x80) && (SIESPROConfig::SX127X.frf[2] == 0x00),
+              "434MHz is 0x6C8000");
+static_assert((SIESPROConfig::SX127X.modem[0] == (LORA_BW_125 + LORA_CR_4_5)) && (SIESPROConfig::SX127X.modem[1] == ((LORA_SF7 << 4) + 0x04)),
+              "BW125 CR4/5 explicit header, SF7 CRC on");
+static_assert(SIESPROConfig::SX127X.modem3 == 0x04, "SF7 BW125 has no LDRO, AGC on");
+static_assert(LTLoRaConfig<434000000, 12, 125000, 5>::SX127X.modem3 == 0x0C, "SF12 BW125 has LDRO");
+static_assert(LTLoRaConfig<868100000, 5, 125000, 5>::SX126X.modulation[0] == 5, "SF5 builds for the SX126X, its SX127X image is not used");
+
+const uint32_t Bandwidths[] = {7800, 10400, 15600, 20800, 31250, 41700, 62500, 125000, 250000, 500000};
+const uint8_t BandwidthCodes[] = {LORA_BW_007, LORA_BW_010, LORA_BW_015, LORA_BW_020, LORA_BW_031, LORA_BW_041, LORA_BW_062, LORA_BW_125, LORA_BW_250, LORA_BW_500};
+const uint8_t CodingRates[] = {LORA_CR_4_5, LORA_CR_4_6, LORA_CR_4_7, LORA_CR_4_8};
+const uint8_t LDROs[] = {LDRO_AUTO, LDRO_OFF, LDRO_ON};
+const uint32_t Frequencies[] = {434000000, 434000000, 868100000, 915000000};
+const int32_t Offsets[] = {0, -25000, 0, 0};
+
+LTSimAir air;
+SX127XSim radio(air);
+SX127XLT LT;
+uint32_t failures = 0;
+
+
+void check(bool ok, const char *test, const char *what)
+{
+  if (!ok)
+  {
+    failures++;
+
+    if (failures < 20)
+    {
+      printf("FAIL %s: %s\n", test, what);
+    }
+  }
+}
+
+
+struct Setup
+{
+  uint8_t registers[REGCACHE_SIZE];
+  uint32_t frequency;
+  uint32_t airtimeuS;
+  uint8_t sf, cr, ldro;
+  bool cacheMatches;
+};
+
+
+void readSetup(Setup &setup)
+{
+  //the device registers, and what the driver reports, where it can from its shadow copies
+
+  setup.cacheMatches = true;
+
+  for (uint8_t address = 0; address < REGCACHE_SIZE; address++)
+  {
+    setup.registers[address] = radio.peekRegister(address);
+
+    if ((address != REG_IRQFLAGS) && (address != REG_RSSIVALUE) && (LT.readRegister(address) != setup.registers[address]))
+    {
+      setup.cacheMatches = false;
+    }
+  }
+
+  setup.registers[REG_IRQFLAGS] = 0;
+  setup.registers[REG_RSSIVALUE] = 0;
+  setup.frequency = LT.getFreqInt();
+  setup.airtimeuS = LT.getTimeOnAiruS(20);
+  setup.sf = LT.getLoRaSF();
+  setup.cr = LT.getLoRaCodingRate();
+  setup.ldro = LT.getOptimisation();
+}
+
+
+void testSettings()
+{
+  Setup runtime, image;
+  uint32_t settings = 0;
+  char what[96];
+
+  for (uint8_t place = 0; place < 4; place++)
+  {
+    for (uint8_t sf = LORA_SF6; sf <= LORA_SF12; sf++)
+    {
+      for (uint8_t bw = 0; bw < 10; bw++)
+      {
+        for (uint8_t cr = 0; cr < 4; cr++)
+        {
+          for (uint8_t ldro : LDROs)
+          {
+            LT.resetDevice();
+            LT.setupLoRa(Frequencies[place], Offsets[place], sf, BandwidthCodes[bw], CodingRates[cr], ldro);
+            readSetup(runtime);
+
+            LT.resetDevice();
+            LT.applyConfig(LTLoRaConfigSX127X(Frequencies[place], Offsets[place], sf, Bandwidths[bw], cr + 5, ldro));
+            readSetup(image);
+
+            snprintf(what, sizeof(what), "%uHz%+d SF%u BW%u CR4/%u LDRO %u", Frequencies[place], Offsets[place], sf, Bandwidths[bw], cr + 5, ldro);
+
+            for (uint8_t address = 0; address < REGCACHE_SIZE; address++)
+            {
+              if (runtime.registers[address] != image.registers[address])
+              {
+                printf("  %s register 0x%02X setupLoRa() 0x%02X applyConfig() 0x%02X\n", what, address, runtime.registers[address], image.registers[address]);
+                check(false, "Settings", what);
+              }
+            }
+
+            check((runtime.frequency == image.frequency) && (runtime.airtimeuS == image.airtimeuS) && (runtime.sf == image.sf) &&
+                  (runtime.cr == image.cr) && (runtime.ldro == image.ldro), "Settings", what);
+            check(image.cacheMatches, "Settings", "shadow copies differ from the device after applyConfig()");
+            settings++;
+          }
+        }
+      }
+    }
+  }
+
+  printf("Settings   %u settings, the device registers after applyConfig() are those after setupLoRa()\n", settings);
+}
+
+
+void testSIESPRO()
+{
+  uint32_t transactions[2] = {0, 0}, radiotransactions[2] = {0, 0};
+  Setup runtime, image;
+
+  for (uint8_t method = 0; method < 2; method++)
+  {
+    LT.resetDevice();
+    LT.resetSPITransactions();
+    radiotransactions[method] = radio.spiTransactions;
+
+    if (method == 0)
+    {
+      LT.setupLoRa(434000000, 0, LORA_SF7, LORA_BW_125, LORA_CR_4_5, LDRO_AUTO);
+    }
+    else
+    {
+      LT.applyConfig(SIESPROConfig::SX127X);
+    }
+
+    transactions[method] = LT.getSPITransactions();
+    radiotransactions[method] = radio.spiTransactions - radiotransactions[method];
+    readSetup((method == 0) ? runtime : image);
+  }
+
+  printf("SIESPRO    setupLoRa() %u SPI transactions, applyConfig() %u, 9 of each are the image calibration\n", transactions[0], transactions[1]);
+
+  check((transactions[0] == radiotransactions[0]) && (transactions[1] == radiotransactions[1]), "SIESPRO", "driver count differs from the device");
+  check(transactions[1] < transactions[0], "SIESPRO", "applyConfig() no fewer SPI transactions than setupLoRa()");
+  check(memcmp(runtime.registers, image.registers, REGCACHE_SIZE) == 0, "SIESPRO", "registers differ");
+}
+
+
+int main()
+{
+  LTHostClock clock(100);                    //resets and the image calibration wait in simulated time
+  LTSimBoard board;
+
+  LTHALsetClock(&clock);
+  board.attach(radio, NSS, NRESET, DIO0);
+  LTHALbind(&board, &board);
+
+  if (!LT.begin(NSS, NRESET, DIO0, LORA_DEVICE))
+  {
+    printf("No LoRa device responding\n");
+    return 1;
+  }
+
+  testSettings();
+  testSIESPRO();
+
+  printf("%s, %u failures\n", failures ? "FAILED" : "PASSED", failures);
+  return failures ? 1 : 0;
+}
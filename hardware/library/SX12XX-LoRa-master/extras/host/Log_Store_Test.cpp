@@ -0,0 +1,333 @@
+/*
+  Licensed under a MIT license, see LICENSE.txt in the library src folder.
+  Original published 16/10/26
+*/
+
+/*******************************************************************************************************
+  Program Operation - Tests the LTLog.h store and forward log on an in memory FM24CL64 FRAM, driven
+  through the unmodified FRAM_FM24CL64.h, against a model of what should be in the log;
+
+  Empty      - a blank or erased FRAM reads as an empty log
+  Order      - records come back oldest first, markSent() and a restart carry on from the right record
+  Wrap       - many laps of the ring, through lap 255 back to 1, with uplinks of random size, restarts
+               and overflows, the log is checked against the model at every restart
+  Power fail - a reset after each byte of an append() or markSent(), what begin() finds is checked
+  Wear       - writes per byte over the ring after the wrap test
+
+  Usage: Log_Store_Test [laps]
+
+  Build from the library folder, see extras/host/README.md;
+  g++ -std=c++17 -O2 -pthread -Iextras/host -Isrc extras/host/LTHAL.cpp extras/host/Log_Store_Test.cpp
+      -o Log_Store_Test
+*******************************************************************************************************/
+
+#include <Wire.h>
+#include <FRAM_FM24CL64.h>
+#include <LTLog.h>
+
+#include <deque>
+#include <random>
+#include <stdio.h>
+
+const uint16_t LogStart = 0;
+const uint16_t LogEnd = 8191;
+
+LTSimFRAM FRAM(8192, 0x50, 2);
+uint32_t failures = 0;
+uint32_t recordNumber = 0;
+
+
+void check(bool ok, const char *test, const char *what)
+{
+  if (!ok)
+  {
+    printf("FAIL %s: %s\n", test, what);
+    failures++;
+  }
+}
+
+
+LTLogRecord makeRecord(uint32_t number)
+{
+  LTLogRecord record;
+
+  record.node = 0x3210 + (number % 300);
+  record.time = 1760000000UL + (number * 10);
+  record.temperature = -1000 + (int16_t) (number % 5000);
+  record.humidity = (uint16_t) (number % 10001);
+  record.soil = (number & 1) ? LTLogNoSoil : (uint8_t) (number % 101);
+  record.rssi = -20 - (int16_t) (number % 130);
+  record.snr = 12 - (int8_t) (number % 33);
+  return record;
+}
+
+
+bool sameRecord(const LTLogRecord &a, const LTLogRecord &b)
+{
+  return (a.node == b.node) && (a.time == b.time) && (a.temperature == b.temperature) &&
+         (a.humidity == b.humidity) && (a.soil == b.soil) && (a.rssi == b.rssi) && (a.snr == b.snr);
+}
+
+
+bool matchesModel(LTLog &Log, const std::deque<uint32_t> &model)
+{
+  //every unsent record in the log, oldest first, is the model
+  static LTLogRecord records[512];
+  uint16_t count, index;
+
+  if (Log.getPending() != model.size())
+  {
+    return false;
+  }
+
+  count = Log.read(records, 512);
+
+  if (count != model.size())
+  {
+    return false;
+  }
+
+  for (index = 0; index < count; index++)
+  {
+    if (!sameRecord(records[index], makeRecord(model[index])))
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+
+void testEmpty()
+{
+  LTLog Log;
+  std::mt19937 random(1);
+
+  for (uint8_t fill : {0x00, 0xFF})
+  {
+    std::fill(FRAM.image.begin(), FRAM.image.end(), fill);
+    check(Log.begin(LogStart, LogEnd) == 0, "Empty", fill ? "0xFF filled FRAM is empty" : "0x00 filled FRAM is empty");
+  }
+
+  for (auto &byte : FRAM.image)
+  {
+    byte = random();
+  }
+
+  Log.begin(LogStart, LogEnd);
+  Log.format();
+  check(Log.begin(LogStart, LogEnd) == 0, "Empty", "random FRAM is empty after format()");
+  printf("Empty       %u slots of %u bytes in %u bytes of FRAM\n", Log.getCapacity(), LTLogRecordSize, LogEnd - LogStart + 1);
+}
+
+
+void testOrder()
+{
+  LTLog Log;
+  LTLogRecord records[16];
+  std::deque<uint32_t> model;
+  uint16_t index, count;
+
+  Log.begin(LogStart, LogEnd);
+  Log.format();
+
+  for (index = 0; index < 100; index++)
+  {
+    Log.append(makeRecord(recordNumber));
+    model.push_back(recordNumber++);
+  }
+
+  count = Log.read(records, 16);
+  check(count == 16, "Order", "read() returns 16 records");
+
+  for (index = 0; index < count; index++)
+  {
+    check(sameRecord(records[index], makeRecord(model[index])), "Order", "records read oldest first");
+  }
+
+  Log.markSent(count);
+  model.erase(model.begin(), model.begin() + count);
+
+  LTLog Restarted;
+  check(Restarted.begin(LogStart, LogEnd) == 84, "Order", "84 pending after restart");
+  check(matchesModel(Restarted, model), "Order", "restart carries on after the records sent");
+  printf("Order       100 appended, 16 sent, %u pending after restart\n", Restarted.getPending());
+}
+
+
+void testWrap(uint32_t laps)
+{
+  LTLog Log;
+  std::deque<uint32_t> model;
+  std::mt19937 random(2);
+  LTLogRecord records[16];
+  uint32_t appends = 0, restarts = 0, lost = 0, index, total;
+  uint16_t count;
+  bool ok = true;
+
+  Log.begin(LogStart, LogEnd);
+  Log.format();
+  std::fill(FRAM.writes.begin(), FRAM.writes.end(), 0);
+  total = laps * Log.getCapacity();
+
+  while (appends < total)
+  {
+    //an offline spell of up to 1.5 rings, then uplink some of it in batches of up to 16
+    uint32_t offline = random() % ((Log.getCapacity() * 3) / 2);
+
+    for (index = 0; (index < offline) && (appends < total); index++, appends++)
+    {
+      if (!Log.append(makeRecord(recordNumber)))
+      {
+        model.pop_front();
+        lost++;
+      }
+
+      model.push_back(recordNumber++);
+    }
+
+    uint32_t batches = random() % 40;
+
+    for (index = 0; index < batches; index++)
+    {
+      count = Log.read(records, 1 + (random() % 16));
+      Log.markSent(count);
+      model.erase(model.begin(), model.begin() + count);
+    }
+
+    Log.begin(LogStart, LogEnd);                  //restart
+    restarts++;
+
+    if (!matchesModel(Log, model))
+    {
+      ok = false;
+      break;
+    }
+  }
+
+  check(ok, "Wrap", "log matches the model at every restart");
+  printf("Wrap        %u laps, %u records, %u restarts, %u overwritten unsent, %u pending\n",
+         laps, appends, restarts, lost, Log.getPending());
+}
+
+
+void testPowerFail()
+{
+  //for each state, an empty ring part filled, a full ring and at the last slot before the lap changes,
+  //reset after every byte of an append() and of a markSent() of 4 records
+  std::vector<uint8_t> image;
+  std::deque<uint32_t> model, sentmodel;
+  uint32_t resets = 0, number;
+  uint16_t fill, capacity;
+  int32_t bytes;
+
+  LTLog Log;
+  Log.begin(LogStart, LogEnd);
+  capacity = Log.getCapacity();
+
+  for (fill = 0; fill < 3; fill++)
+  {
+    Log.format();
+    model.clear();
+
+    uint16_t records = (fill == 0) ? 20 : ((fill == 1) ? (capacity + 30) : (capacity - 1));
+
+    for (uint16_t index = 0; index < records; index++)
+    {
+      Log.append(makeRecord(recordNumber));
+
+      if (model.size() == capacity)
+      {
+        model.pop_front();
+      }
+
+      model.push_back(recordNumber++);
+    }
+
+    image = FRAM.image;
+    number = recordNumber++;
+
+    for (bytes = 0; bytes <= LTLogRecordSize; bytes++)
+    {
+      FRAM.image = image;
+      Log.begin(LogStart, LogEnd);
+      FRAM.powerFailAfter(bytes);
+      Log.append(makeRecord(number));
+      FRAM.powerOn();
+      Log.begin(LogStart, LogEnd);
+      resets++;
+
+      //the record is there once all its bytes are, a full ring has lost its oldest once any byte is
+      std::deque<uint32_t> expected = model;
+
+      if ((expected.size() == capacity) && (bytes > 0))
+      {
+        expected.pop_front();
+      }
+
+      if (bytes == LTLogRecordSize)
+      {
+        expected.push_back(number);
+      }
+
+      check(matchesModel(Log, expected), "Power fail", "append() reset leaves the log consistent");
+    }
+
+    for (bytes = 0; bytes <= 4; bytes++)
+    {
+      FRAM.image = image;
+      Log.begin(LogStart, LogEnd);
+      FRAM.powerFailAfter(bytes);
+      LTLogRecord records[4];
+      Log.markSent(Log.read(records, 4));
+      FRAM.powerOn();
+      Log.begin(LogStart, LogEnd);
+      resets++;
+
+      sentmodel = model;
+      sentmodel.erase(sentmodel.begin(), sentmodel.begin() + bytes);
+      check(matchesModel(Log, sentmodel), "Power fail", "markSent() reset leaves the later records unsent");
+    }
+  }
+
+  FRAM.image = image;
+  printf("Power fail  %u resets part way through append() and markSent()\n", resets);
+}
+
+
+void testWear(uint32_t laps)
+{
+  uint32_t lowest = 0xFFFFFFFF, highest = 0, address;
+  uint64_t total = 0;
+  uint32_t used = (LogEnd - LogStart + 1) / LTLogRecordSize * LTLogRecordSize;
+
+  for (address = LogStart; address < (LogStart + used); address++)
+  {
+    lowest = (FRAM.writes[address] < lowest) ? FRAM.writes[address] : lowest;
+    highest = (FRAM.writes[address] > highest) ? FRAM.writes[address] : highest;
+    total += FRAM.writes[address];
+  }
+
+  printf("Wear        writes per byte over %u laps, lowest %u, mean %.1f, highest %u\n",
+         laps, lowest, (double) total / used, highest);
+  check(highest <= (2 * (laps + 2)), "Wear", "no byte written more than twice per lap");
+}
+
+
+int main(int argc, char *argv[])
+{
+  uint32_t laps = (argc > 1) ? atoi(argv[1]) : 300;
+
+  Wire.attach(&FRAM);
+  memoryStart(0x50);
+
+  testEmpty();
+  testOrder();
+  testWrap(laps);
+  testWear(laps);
+  testPowerFail();
+
+  printf("%s, %u failures\n", failures ? "FAILED" : "PASSED", failures);
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,300 @@
+/*
+  Licensed under a MIT license, see LICENSE.txt in the library src folder.
+  Original published 16/10/26
+*/
+
+/*******************************************************************************************************
+  Program Operation - A hub master polls a classroom of simulated SX1278 wristbands with the LTPoll.h
+  scheduler and reports the cycle time against the number of nodes. Each slave has its own NetworkID,
+  0x3210 plus its node number, and answers with the AutoACK. All the slaves run in one thread with the
+  non blocking startReceiveReliableAutoACK() and pollReliable(), which is what lets a few hundred of them
+  share a process.
+
+  For each node count the program measures;
+
+  Full cycle - every node due at once, the time to poll them all, the worst case after a hub restart.
+  Steady     - SteadymS of scheduled polling. MovingFraction of the wristbands have a path loss that
+               changes at every poll, AbsentFraction are out of range, the rest stay put. The poll
+               intervals actually achieved for each node state are printed, when the hub is overloaded
+               they stretch past the intervals set with setIntervals().
+
+  Usage: Poll_Scheduler_Sim [max nodes] [packet loss 0-1] [time scale] [ACK delay mS]
+
+  Build from the library folder, see extras/host/README.md;
+  g++ -std=c++17 -O2 -pthread -Iextras/host -Isrc extras/host/LTHAL.cpp extras/host/SX127XSim.cpp
+      extras/host/Poll_Scheduler_Sim.cpp src/SX127XLT.cpp -o Poll_Scheduler_Sim
+*******************************************************************************************************/
+
+#include <SPI.h>
+#include <SX127XLT.h>
+#include <SX127XSim.h>
+#include <LTPoll.h>
+
+#include <atomic>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+#include <stdio.h>
+
+#define NSS 5                                //master_esp32 pins
+#define NRESET 14
+#define DIO0 2
+#define SLAVE_NSS 7                          //slave_esp32_mini pins, each slave has its own board
+#define SLAVE_NRESET 3
+#define SLAVE_DIO0 2
+
+#define LORA_DEVICE DEVICE_SX1278
+#define MaxNodes 512
+
+const uint32_t Frequency = 434000000;
+const uint16_t BaseAddress = 0x3210;
+const uint32_t ACKtimeout = 500;
+const uint32_t TXtimeout = 1000;
+const uint8_t TXattempts = 2;                //a node that misses a poll waits for its next one
+const uint32_t ActivemS = 10000;
+const uint32_t StablemS = 30000;
+const uint32_t LostmS = 120000;
+const uint32_t SteadymS = 300000;
+const float MovingFraction = 0.2;
+const float AbsentFraction = 0.05;
+const uint16_t NodeCounts[] = {1, 10, 25, 50, 100, 200, 300, 400, 500};
+
+struct SlaveNode
+{
+  SX127XSim *radio;
+  LTSimBoard board;
+  SX127XLT LT;
+  uint8_t buff[16];
+  uint16_t address;
+};
+
+LTSimAir air;
+std::vector<std::unique_ptr<SX127XSim>> radios;
+std::vector<std::unique_ptr<SlaveNode>> slaves;
+std::atomic<bool> slavesRun(true);
+std::atomic<bool> slavesReady(false);
+uint32_t ACKdelay = 10;
+
+
+void setupNode(SX127XLT &LT, int8_t pinNSS, int8_t pinNRESET, int8_t pinDIO0)
+{
+  if (!LT.begin(pinNSS, pinNRESET, pinDIO0, LORA_DEVICE))
+  {
+    Serial.println(F("No LoRa device responding"));
+    exit(1);
+  }
+
+  LT.setupLoRa(Frequency, 0, LORA_SF7, LORA_BW_125, LORA_CR_4_5, LDRO_AUTO);
+}
+
+
+void slaveNodes()
+{
+  //all the slaves, each polled in turn, the HAL is bound to a slave's board before its driver is used
+
+  for (auto &slave : slaves)
+  {
+    slave->board.attach(*slave->radio, SLAVE_NSS, SLAVE_NRESET, SLAVE_DIO0);
+    LTHALbind(&slave->board, &slave->board);
+    setupNode(slave->LT, SLAVE_NSS, SLAVE_NRESET, SLAVE_DIO0);
+    slave->LT.startReceiveReliableAutoACK(slave->buff, sizeof(slave->buff), slave->address, ACKdelay, 2, 0);
+  }
+
+  slavesReady = true;
+
+  while (slavesRun)
+  {
+    for (auto &slave : slaves)
+    {
+      LTHALbind(&slave->board, &slave->board);
+
+      if (slave->LT.pollReliable() >= ReliableDone)
+      {
+        slave->LT.startReceiveReliableAutoACK(slave->buff, sizeof(slave->buff), slave->address, ACKdelay, 2, 0);
+      }
+    }
+
+    delay(1);
+  }
+}
+
+
+bool pollNode(SX127XLT &LT, uint16_t address, int16_t &rssi, int8_t &snr)
+{
+  uint8_t buff[] = "SIESPRO";
+  uint8_t attempts = 0;
+
+  do
+  {
+    attempts++;
+
+    if (LT.transmitReliableAutoACK(buff, sizeof(buff), address, ACKtimeout, TXtimeout, 10, WAIT_TX))
+    {
+      rssi = LT.readPacketRSSI();
+      snr = LT.readPacketSNR();
+      return true;
+    }
+  } while (attempts < TXattempts);
+
+  return false;
+}
+
+
+void runNodes(SX127XLT &LT, uint16_t nodes, std::mt19937 &random)
+{
+  static LTPoll<MaxNodes> Poller;             //static, so the table is not on the stack
+  std::uniform_real_distribution<float> uniform(0, 1);
+  std::vector<int16_t> pathloss(nodes);
+  std::vector<uint8_t> kind(nodes);            //0 stays put, 1 moving, 2 absent
+  uint32_t startmS, cyclemS, polls = 0, acked = 0, steadystartmS, statepolls[5] = {0};
+  uint64_t intervaltotal[5] = {0};
+  std::vector<uint32_t> lastpollmS(nodes, 0);
+  uint16_t index;
+  int16_t slot, rssi;
+  int8_t snr;
+  bool ok;
+  uint8_t state;
+
+  for (index = 0; index < nodes; index++)
+  {
+    Poller.removeNode(BaseAddress + index);
+  }
+
+  Poller.setIntervals(ActivemS, StablemS, LostmS);
+
+  for (index = 0; index < nodes; index++)
+  {
+    kind[index] = (uniform(random) < AbsentFraction) ? 2 : ((uniform(random) < MovingFraction) ? 1 : 0);
+    pathloss[index] = (kind[index] == 2) ? 200 : (80 + (int16_t) (uniform(random) * 40));
+    radios[index]->setPathLoss(pathloss[index]);
+    Poller.addNode(BaseAddress + index, millis());
+  }
+
+  //full cycle, every node due at once
+
+  startmS = millis();
+
+  while (polls < nodes)
+  {
+    slot = Poller.next(millis());
+    ok = pollNode(LT, Poller.getAddress(slot), rssi, snr);
+    Poller.pollDone(slot, millis(), ok, rssi, snr);
+    lastpollmS[slot] = millis();
+    polls++;
+  }
+
+  cyclemS = millis() - startmS;
+
+  //steady polling with moving and absent wristbands
+
+  steadystartmS = millis();
+  polls = 0;
+
+  while ((uint32_t) (millis() - steadystartmS) < SteadymS)
+  {
+    slot = Poller.next(millis());
+
+    if (slot < 0)
+    {
+      delay(5);
+      continue;
+    }
+
+    if (kind[slot] == 1)
+    {
+      pathloss[slot] = constrain(pathloss[slot] + (int16_t) ((uniform(random) * 13) - 6), 70, 125);
+      radios[slot]->setPathLoss(pathloss[slot]);
+    }
+
+    state = Poller.getNode(slot).state;
+    intervaltotal[state] += millis() - lastpollmS[slot];
+    statepolls[state]++;
+    lastpollmS[slot] = millis();
+
+    ok = pollNode(LT, Poller.getAddress(slot), rssi, snr);
+    Poller.pollDone(slot, millis(), ok, rssi, snr);
+    polls++;
+    acked += ok;
+  }
+
+  printf("%5u  %6u  %8.1fs  %7.2f  %6.1f%%", nodes, (unsigned) (nodes * sizeof(LTPollNode)), cyclemS / 1000.0,
+         (polls * 1000.0) / SteadymS, polls ? (100.0 * acked) / polls : 0.0);
+
+  for (state = LTPollActive; state <= LTPollLost; state++)
+  {
+    if (statepolls[state])
+    {
+      printf("  %7.1fs", intervaltotal[state] / 1000.0 / statepolls[state]);
+    }
+    else
+    {
+      printf("  %8s", "-");
+    }
+  }
+
+  printf("\n");
+  fflush(stdout);
+}
+
+
+int main(int argc, char *argv[])
+{
+  uint16_t maxnodes = (argc > 1) ? atoi(argv[1]) : 300;
+  float loss = (argc > 2) ? atof(argv[2]) : 0.05;
+  float scale = (argc > 3) ? atof(argv[3]) : 20;
+  ACKdelay = (argc > 4) ? atoi(argv[4]) : 10;
+
+  uint16_t index;
+  std::mt19937 random(1);
+
+  if (maxnodes > MaxNodes)
+  {
+    maxnodes = MaxNodes;
+  }
+
+  LTHostClock clock(scale);
+  LTHALsetClock(&clock);
+  air.setPacketLoss(loss);
+
+  SX127XSim masterRadio(air);
+
+  for (index = 0; index < maxnodes; index++)
+  {
+    radios.emplace_back(new SX127XSim(air));
+    slaves.emplace_back(new SlaveNode());
+    slaves.back()->radio = radios.back().get();
+    slaves.back()->address = BaseAddress + index;
+  }
+
+  std::thread slave(slaveNodes);
+
+  SX127XLT LT;
+  LTSimBoard board;
+  board.attach(masterRadio, NSS, NRESET, DIO0);
+  LTHALbind(&board, &board);
+  setupNode(LT, NSS, NRESET, DIO0);
+
+  while (!slavesReady)
+  {
+    delay(10);
+  }
+
+  printf("SF7 BW125, packet loss %.2f, ACK delay %umS, %u attempts per poll\n", loss, ACKdelay, TXattempts);
+  printf("Intervals active %umS, stable %umS, lost up to %umS, %.0f%% moving, %.0f%% absent\n",
+         ActivemS, StablemS, LostmS, MovingFraction * 100, AbsentFraction * 100);
+  printf("Nodes  RAM B   Full cycle  Polls/s  Acked    Active    Stable      Lost\n");
+
+  for (uint16_t nodes : NodeCounts)
+  {
+    if (nodes <= maxnodes)
+    {
+      runNodes(LT, nodes, random);
+    }
+  }
+
+  slavesRun = false;
+  slave.join();
+
+  return 0;
+}
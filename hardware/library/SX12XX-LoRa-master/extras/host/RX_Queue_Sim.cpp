@@ -0,0 +1,319 @@
+/*
+  Licensed under a MIT license, see LICENSE.txt in the library src folder.
+  Original published 16/10/26
+*/
+
+/*******************************************************************************************************
+  Program Operation - Two masters send reliable packets at random to one slave, which takes processmS over
+  each packet it receives, the time slave_esp32_mini spends printing it. Both masters use the same
+  NetworkID, send each packet up to 3 times and wait 1000mS for the ACK each time.
+
+  The slave is run twice. First as it was, receiveReliableAutoACK() and then the processing, so no packet
+  is received and no ACK sent while it processes. Then as the firmware now is, DIO0 wakes a radio thread
+  that runs startReceiveReliableAutoACK() and pollReliable() into an LTRXQueue.h slot and sends the ACK,
+  while a second thread, loop() on the firmware, takes the packets from the queue and processes them. The
+  interrupt is the LTSimBoard pin watcher, the handler only wakes the radio thread.
+
+  For each slave the packets acknowledged, transmissions per packet, packets processed, the most packets
+  queued at once and the times the queue was full are printed.
+
+  Usage: RX_Queue_Sim [packets per master] [process mS] [mean gap mS] [time scale]
+
+  Build from the library folder, see extras/host/README.md;
+  g++ -std=c++17 -O2 -pthread -Iextras/host -Isrc extras/host/LTHAL.cpp extras/host/SX127XSim.cpp
+      extras/host/RX_Queue_Sim.cpp src/SX127XLT.cpp -o RX_Queue_Sim
+*******************************************************************************************************/
+
+#include <SPI.h>
+#include <SX127XLT.h>
+#include <SX127XSim.h>
+#include <LTRXQueue.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <random>
+#include <thread>
+#include <stdio.h>
+
+#define NSS 5                                //master_esp32 pins
+#define NRESET 14
+#define DIO0 2
+#define SLAVE_NSS 7                          //slave_esp32_mini pins
+#define SLAVE_NRESET 3
+#define SLAVE_DIO0 2
+
+#define LORA_DEVICE DEVICE_SX1278
+const uint32_t Frequency = 434000000;
+const uint16_t NetworkID = 0x3210;
+const uint32_t ACKtimeout = 1000;
+const uint32_t TXtimeout = 1000;
+const uint8_t TXattempts = 3;
+const uint32_t ACKdelay = 100;
+const uint32_t RXtimeout = 1000;
+const int8_t TXpower = 10;
+const uint32_t RadioWaitmS = 100;            //longest wait for DIO0, as the firmware
+
+const uint8_t Masters = 2;
+const uint8_t QueueSlots = 8;
+
+float scale;
+uint32_t processmS;
+std::atomic<bool> slaveRun;
+std::atomic<uint32_t> processed;
+
+std::mutex dio0Lock;                         //DIO0 interrupt to the radio thread
+std::condition_variable dio0Wake;
+bool dio0Flag = false;
+
+
+void DIO0_ISR()
+{
+  {
+    std::lock_guard<std::mutex> guard(dio0Lock);
+    dio0Flag = true;
+  }
+
+  dio0Wake.notify_one();
+}
+
+
+void waitDIO0(uint32_t timeoutmS)
+{
+  //ulTaskNotifyTake() on the firmware, the timeout is simulated time
+  std::unique_lock<std::mutex> guard(dio0Lock);
+  uint64_t realuS = (uint64_t) ((timeoutmS * 1000.0) / scale);
+
+  dio0Wake.wait_for(guard, std::chrono::microseconds(realuS), [] { return dio0Flag; });
+  dio0Flag = false;
+}
+
+
+void startSlave(SX127XLT &LT, LTSimBoard &board, SX127XSim *radio)
+{
+  board.attach(*radio, SLAVE_NSS, SLAVE_NRESET, SLAVE_DIO0);
+  LTHALbind(&board, &board);
+
+  if (!LT.begin(SLAVE_NSS, SLAVE_NRESET, SLAVE_DIO0, LORA_DEVICE))
+  {
+    Serial.println(F("No LoRa device responding"));
+    exit(1);
+  }
+
+  LT.setupLoRa(Frequency, 0, LORA_SF7, LORA_BW_125, LORA_CR_4_5, LDRO_AUTO);
+}
+
+
+void blockingSlave(SX127XSim *radio)
+{
+  SX127XLT LT;
+  LTSimBoard board;
+  uint8_t RXBUFFER[251];
+
+  startSlave(LT, board, radio);
+
+  while (slaveRun)
+  {
+    if (LT.receiveReliableAutoACK(RXBUFFER, sizeof(RXBUFFER), NetworkID, ACKdelay, TXpower, RXtimeout, WAIT_RX))
+    {
+      delay(processmS);
+      processed++;
+    }
+  }
+}
+
+
+void queuedSlave(SX127XSim *radio, LTRXQueue<QueueSlots> *queue, uint8_t *maxqueued)
+{
+  //the radio thread, the producer
+  SX127XLT LT;
+  LTSimBoard board;
+  LTRXPacket *slot = NULL;
+  uint8_t state, count;
+
+  startSlave(LT, board, radio);
+  board.attachInterrupt(SLAVE_DIO0, DIO0_ISR, RISING);
+
+  while (slaveRun)
+  {
+    state = LT.getReliableState();
+
+    if ((state == ReliableIdle) || (state == ReliableDone) || (state == ReliableFailed))
+    {
+      slot = queue->reserve();
+
+      if (slot == NULL)
+      {
+        delay(1);
+        continue;
+      }
+
+      LT.startReceiveReliableAutoACK(slot->data, sizeof(slot->data), NetworkID, ACKdelay, TXpower, RXtimeout);
+    }
+
+    waitDIO0((state == ReliableACKDelay) ? 1 : RadioWaitmS);
+
+    if (LT.pollReliable() == ReliableDone)
+    {
+      slot->length = LT.readRXPacketL() - 4;
+      slot->rssi = LT.readPacketRSSI();
+      slot->snr = LT.readPacketSNR();
+      slot->mS = millis();
+      queue->commit();
+
+      count = queue->getCount();
+      *maxqueued = (count > *maxqueued) ? count : *maxqueued;
+    }
+  }
+
+  board.detachInterrupt(SLAVE_DIO0);
+  LT.cancelReliable();
+}
+
+
+void processQueue(LTRXQueue<QueueSlots> *queue)
+{
+  //loop() on the firmware, the consumer, never touches the LoRa device
+  LTHALbind(NULL, NULL);
+
+  while (slaveRun || queue->getCount())
+  {
+    if (queue->peek() != NULL)
+    {
+      delay(processmS);
+      queue->pop();
+      processed++;
+    }
+    else
+    {
+      delay(1);
+    }
+  }
+}
+
+
+struct LTMasterResult
+{
+  uint32_t acked;
+  uint32_t transmissions;
+};
+
+
+void masterNode(SX127XSim *radio, uint8_t master, uint32_t packets, uint32_t gapmS, LTMasterResult *result)
+{
+  SX127XLT LT;
+  LTSimBoard board;
+  std::mt19937 random(1000 + master);
+  std::exponential_distribution<double> gap(1.0 / gapmS);
+  uint8_t payload[16], payloadL, attempts, acknowledged;
+  uint32_t index;
+
+  board.attach(*radio, NSS, NRESET, DIO0);
+  LTHALbind(&board, &board);
+
+  if (!LT.begin(NSS, NRESET, DIO0, LORA_DEVICE))
+  {
+    Serial.println(F("No LoRa device responding"));
+    exit(1);
+  }
+
+  LT.setupLoRa(Frequency, 0, LORA_SF7, LORA_BW_125, LORA_CR_4_5, LDRO_AUTO);
+
+  for (index = 0; index < packets; index++)
+  {
+    delay((uint32_t) gap(random));
+    payloadL = snprintf((char *) payload, sizeof(payload), "M%u %u", master, index);
+    attempts = 0;
+
+    do
+    {
+      attempts++;
+      result->transmissions++;
+      acknowledged = LT.transmitReliableAutoACK(payload, payloadL, NetworkID, ACKtimeout, TXtimeout, TXpower, WAIT_TX);
+    } while (!acknowledged && (attempts < TXattempts));
+
+    if (acknowledged)
+    {
+      result->acked++;
+    }
+  }
+}
+
+
+void runLink(bool queued, uint32_t packets, uint32_t gapmS)
+{
+  LTSimAir air;
+  SX127XSim slaveRadio(air);
+  SX127XSim masterRadio0(air), masterRadio1(air);
+  SX127XSim *masterRadios[Masters] = {&masterRadio0, &masterRadio1};
+  LTMasterResult results[Masters] = {};
+  LTRXQueue<QueueSlots> queue;
+  std::thread masters[Masters];
+  std::thread slave, consumer;
+  uint32_t acked = 0, transmissions = 0;
+  uint8_t maxqueued = 0, index;
+
+  slaveRun = true;
+  processed = 0;
+
+  if (queued)
+  {
+    slave = std::thread(queuedSlave, &slaveRadio, &queue, &maxqueued);
+    consumer = std::thread(processQueue, &queue);
+  }
+  else
+  {
+    slave = std::thread(blockingSlave, &slaveRadio);
+  }
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+  for (index = 0; index < Masters; index++)
+  {
+    masters[index] = std::thread(masterNode, masterRadios[index], index, packets, gapmS, &results[index]);
+  }
+
+  for (index = 0; index < Masters; index++)
+  {
+    masters[index].join();
+    acked += results[index].acked;
+    transmissions += results[index].transmissions;
+  }
+
+  slaveRun = false;
+  slave.join();
+
+  if (queued)
+  {
+    consumer.join();
+  }
+
+  printf("%-8s acknowledged %u of %u, transmissions per packet %.2f, processed %u",
+         queued ? "Queued" : "Blocking", acked, Masters * packets, (double) transmissions / (Masters * packets), processed.load());
+
+  if (queued)
+  {
+    printf(", most queued %u, queue full %u", maxqueued, queue.getFullCount());
+  }
+
+  printf("\n");
+}
+
+
+int main(int argc, char *argv[])
+{
+  uint32_t packets = (argc > 1) ? atoi(argv[1]) : 50;
+  processmS = (argc > 2) ? atoi(argv[2]) : 500;
+  uint32_t gapmS = (argc > 3) ? atoi(argv[3]) : 1000;
+  scale = (argc > 4) ? atof(argv[4]) : 10;
+
+  LTHostClock clock(scale);
+  LTHALsetClock(&clock);
+
+  printf("%u masters, %u packets each, mean gap %umS, slave processing %umS per packet\n",
+         Masters, packets, gapmS, processmS);
+
+  runLink(false, packets, gapmS);
+  runLink(true, packets, gapmS);
+
+  return 0;
+}
@@ -0,0 +1,135 @@
+/*
+  Licensed under a MIT license, see LICENSE.txt in the library src folder.
+  Original published 16/10/26
+*/
+
+/*******************************************************************************************************
+  Program Operation - Counts the SPI transactions used by SX127XLT to configure a simulated SX1278, for
+  the first setupLoRa(), for switching spreading factor as would be done on each retry and for a repeat
+  setupLoRa(). The count kept by the driver, getSPITransactions(), is checked against the NSS accesses seen
+  by the simulated device. After each step every register the driver keeps a shadow copy of is compared
+  with the device register, the program exits with 1 if any differ.
+
+  To see the counts without the register cache comment out USE_REGISTER_CACHE at the top of SX127XLT.cpp.
+
+  Build from the library folder, see extras/host/README.md;
+  g++ -std=c++17 -O2 -pthread -Iextras/host -Isrc extras/host/LTHAL.cpp extras/host/SX127XSim.cpp
+      extras/host/Register_Cache_Sim.cpp src/SX127XLT.cpp -o Register_Cache_Sim
+*******************************************************************************************************/
+
+#include <SPI.h>
+#include <SX127XLT.h>
+#include <SX127XSim.h>
+
+#include <stdio.h>
+
+#define NSS 5                                //master_esp32 pins
+#define NRESET 14
+#define DIO0 2
+
+#define LORA_DEVICE DEVICE_SX1278
+const uint32_t Frequency = 434000000;
+
+LTSimAir air;
+SX127XSim radio(air);
+SX127XLT LT;
+uint32_t radioStart;
+uint16_t mismatches = 0;
+
+
+void startCount()
+{
+  LT.resetSPITransactions();
+  radioStart = radio.spiTransactions;
+}
+
+
+void printCount(const char *step)
+{
+  uint32_t radioCount = radio.spiTransactions - radioStart;
+
+  printf("%-34s %4u SPI transactions", step, LT.getSPITransactions());
+
+  if (radioCount != LT.getSPITransactions())
+  {
+    printf(", device saw %u", radioCount);
+    mismatches++;
+  }
+
+  printf("\n");
+}
+
+
+void checkRegisters()
+{
+  //a burst read always goes to the device, readRegister() returns the shadow copy where there is one
+
+  uint8_t address, devicereg[REGCACHE_SIZE], driverreg;
+
+  for (address = 1; address < REGCACHE_SIZE; address++)
+  {
+    devicereg[address] = radio.peekRegister(address);
+    driverreg = LT.readRegister(address);
+
+    if ((address != REG_IRQFLAGS) && (address != REG_RSSIVALUE) && (driverreg != devicereg[address]))
+    {
+      printf("  Register 0x%02X driver 0x%02X device 0x%02X\n", address, driverreg, devicereg[address]);
+      mismatches++;
+    }
+  }
+}
+
+
+int main()
+{
+  uint8_t SF;
+
+  LTSimBoard board;
+  board.attach(radio, NSS, NRESET, DIO0);
+  LTHALbind(&board, &board);
+
+  if (!LT.begin(NSS, NRESET, DIO0, LORA_DEVICE))
+  {
+    printf("No LoRa device responding\n");
+    return 1;
+  }
+
+  startCount();
+  LT.setupLoRa(Frequency, 0, LORA_SF7, LORA_BW_125, LORA_CR_4_5, LDRO_AUTO);
+  printCount("setupLoRa()");
+  checkRegisters();
+
+  for (SF = LORA_SF8; SF <= LORA_SF12; SF++)
+  {
+    char step[40];
+    snprintf(step, sizeof(step), "setModulationParams() SF%u", SF);
+    startCount();
+    LT.setModulationParams(SF, LORA_BW_125, LORA_CR_4_5, LDRO_AUTO);
+    printCount(step);
+    checkRegisters();
+  }
+
+  startCount();
+  LT.setModulationParams(LORA_SF12, LORA_BW_125, LORA_CR_4_5, LDRO_AUTO);
+  printCount("setModulationParams() unchanged");
+
+  startCount();
+  LT.setupLoRa(Frequency, 0, LORA_SF7, LORA_BW_125, LORA_CR_4_5, LDRO_AUTO);
+  printCount("setupLoRa() repeated");
+  checkRegisters();
+
+  startCount();
+  LT.setTxParams(10, RADIO_RAMP_DEFAULT);
+  LT.setTxParams(10, RADIO_RAMP_DEFAULT);
+  printCount("setTxParams() twice");
+  checkRegisters();
+
+  if (mismatches)
+  {
+    printf("%u mismatches\n", mismatches);
+    return 1;
+  }
+
+  printf("Driver and device registers match\n");
+  return 0;
+}
@@ -0,0 +1,199 @@
+/*
+  Licensed under a MIT license, see LICENSE.txt in the library src folder.
+  Original published 16/10/26
+*/
+
+/*******************************************************************************************************
+  Program Operation - Runs a master and a slave SX127XLT instance in one Linux process against simulated
+  SX1278 devices and measures reliable packet throughput. The master sends a payload with
+  transmitReliableAutoACK(), retrying up to TXattempts times, and the slave answers with
+  receiveReliableAutoACK(), the same exchange used by the master_esp32 and slave_esp32_mini firmware.
+
+  With mode 1 both nodes use the non blocking startTransmitReliableAutoACK() / startReceiveReliableAutoACK()
+  and pollReliable() instead, polling every PollPeriodmS. The time the master spends inside library calls is
+  printed, with the blocking functions that is all of the time.
+
+  Usage: Reliable_Link_Sim [packets] [payload length] [packet loss 0-1] [path loss dB] [time scale] [mode 0/1]
+
+  Build from the library folder, see extras/host/README.md;
+  g++ -std=c++17 -O2 -pthread -Iextras/host -Isrc extras/host/LTHAL.cpp extras/host/SX127XSim.cpp
+      extras/host/Reliable_Link_Sim.cpp src/SX127XLT.cpp -o Reliable_Link_Sim
+*******************************************************************************************************/
+
+#include <SPI.h>
+#include <SX127XLT.h>
+#include <SX127XSim.h>
+
+#include <atomic>
+#include <thread>
+#include <stdio.h>
+
+#define NSS 5                                //master_esp32 pins
+#define NRESET 14
+#define DIO0 2
+#define SLAVE_NSS 7                          //slave_esp32_mini pins
+#define SLAVE_NRESET 3
+#define SLAVE_DIO0 2
+
+#define LORA_DEVICE DEVICE_SX1278
+const uint32_t Frequency = 434000000;
+const uint16_t NetworkID = 0x3210;
+const uint32_t ACKtimeout = 1000;
+const uint32_t TXtimeout = 1000;
+const uint8_t TXattempts = 10;
+const uint32_t ACKdelay = 100;
+const uint32_t RXtimeout = 1000;
+const uint32_t PacketDelaymS = 10;           //gives the slave time to return to receive after sending the ACK
+const uint32_t PollPeriodmS = 1;             //time between pollReliable() calls in mode 1, the application runs in between
+
+LTSimAir air;
+std::atomic<bool> slaveRun(true);
+bool nonBlocking = false;
+
+
+void setupNode(SX127XLT &LT, int8_t pinNSS, int8_t pinNRESET, int8_t pinDIO0)
+{
+  if (!LT.begin(pinNSS, pinNRESET, pinDIO0, LORA_DEVICE))
+  {
+    Serial.println(F("No LoRa device responding"));
+    exit(1);
+  }
+
+  LT.setupLoRa(Frequency, 0, LORA_SF7, LORA_BW_125, LORA_CR_4_5, LDRO_AUTO);
+}
+
+
+void slaveNode(SX127XSim *radio)
+{
+  SX127XLT LT;
+  LTSimBoard board;
+  uint8_t RXBUFFER[251];
+
+  board.attach(*radio, SLAVE_NSS, SLAVE_NRESET, SLAVE_DIO0);
+  LTHALbind(&board, &board);
+  setupNode(LT, SLAVE_NSS, SLAVE_NRESET, SLAVE_DIO0);
+
+  while (slaveRun)
+  {
+    if (nonBlocking)
+    {
+      LT.startReceiveReliableAutoACK(RXBUFFER, sizeof(RXBUFFER), NetworkID, ACKdelay, 2, RXtimeout);
+
+      while (slaveRun && (LT.pollReliable() < ReliableDone))
+      {
+        delay(PollPeriodmS);
+      }
+    }
+    else
+    {
+      LT.receiveReliableAutoACK(RXBUFFER, sizeof(RXBUFFER), NetworkID, ACKdelay, 2, RXtimeout, WAIT_RX);
+    }
+  }
+}
+
+
+int main(int argc, char *argv[])
+{
+  uint32_t packets = (argc > 1) ? atoi(argv[1]) : 20;
+  uint8_t length = (argc > 2) ? atoi(argv[2]) : 7;
+  float loss = (argc > 3) ? atof(argv[3]) : 0;
+  int16_t pathloss = (argc > 4) ? atoi(argv[4]) : 80;
+  float scale = (argc > 5) ? atof(argv[5]) : 1;
+  nonBlocking = (argc > 6) ? atoi(argv[6]) : 0;
+
+  uint32_t index, sent = 0, failed = 0, transmissions = 0, startmS, elapsedmS, callstartuS;
+  uint64_t libraryuS = 0;
+  int32_t RSSItotal = 0, SNRtotal = 0;
+  uint8_t attempts, TXPacketL, buff[251];
+
+  LTHostClock clock(scale);
+  LTHALsetClock(&clock);
+
+  air.setPacketLoss(loss);
+  SX127XSim masterRadio(air);
+  SX127XSim slaveRadio(air);
+  masterRadio.setPathLoss(pathloss);
+  slaveRadio.setPathLoss(pathloss);
+
+  std::thread slave(slaveNode, &slaveRadio);
+
+  SX127XLT LT;
+  LTSimBoard board;
+  board.attach(masterRadio, NSS, NRESET, DIO0);
+  LTHALbind(&board, &board);
+  setupNode(LT, NSS, NRESET, DIO0);
+
+  for (index = 0; index < length; index++)
+  {
+    buff[index] = 'A' + (index % 26);
+  }
+
+  delay(100);                                //let the slave get into receive
+  startmS = millis();
+
+  for (index = 0; index < packets; index++)
+  {
+    attempts = TXattempts;
+
+    if (nonBlocking)
+    {
+      callstartuS = micros();
+      LT.startTransmitReliableAutoACK(buff, length, NetworkID, ACKtimeout, TXtimeout, 10, TXattempts);
+      libraryuS += micros() - callstartuS;
+
+      do
+      {
+        delay(PollPeriodmS);
+        callstartuS = micros();
+        TXPacketL = LT.pollReliable();
+        libraryuS += micros() - callstartuS;
+      } while (TXPacketL < ReliableDone);
+
+      transmissions += LT.getReliableAttempts();
+      TXPacketL = (TXPacketL == ReliableDone) ? LT.readTXPacketL() : 0;
+    }
+    else
+    {
+      callstartuS = micros();
+
+      do
+      {
+        transmissions++;
+        TXPacketL = LT.transmitReliableAutoACK(buff, length, NetworkID, ACKtimeout, TXtimeout, 10, WAIT_TX);
+      } while ((TXPacketL == 0) && (--attempts > 0));
+
+      libraryuS += micros() - callstartuS;
+    }
+
+    if (TXPacketL)
+    {
+      sent++;
+      RSSItotal += LT.readPacketRSSI();
+      SNRtotal += LT.readPacketSNR();
+    }
+    else
+    {
+      failed++;
+    }
+
+    delay(PacketDelaymS);
+  }
+
+  elapsedmS = millis() - startmS;
+  slaveRun = false;
+  slave.join();
+
+  printf("Packets %u, payload %u bytes, acknowledged %u, failed %u, transmissions %u\n", packets, length, sent, failed, transmissions);
+  printf("Simulated time %umS, %.1fmS per packet, %.1f payload bytes/s\n", elapsedmS, (float) elapsedmS / packets, (sent * length * 1000.0) / elapsedmS);
+  printf("Master time in library calls %umS, %.1f%%\n", (uint32_t) (libraryuS / 1000), (libraryuS / 10.0) / elapsedmS);
+
+  if (sent)
+  {
+    printf("Average ACK RSSI %ddBm, SNR %ddB\n", RSSItotal / (int32_t) sent, SNRtotal / (int32_t) sent);
+  }
+
+  printf("Master radio sent %u received %u lost %u\n", masterRadio.packetsSent, masterRadio.packetsReceived, masterRadio.packetsLost);
+  printf("Slave radio sent %u received %u lost %u\n", slaveRadio.packetsSent, slaveRadio.packetsReceived, slaveRadio.packetsLost);
+
+  return 0;
+}
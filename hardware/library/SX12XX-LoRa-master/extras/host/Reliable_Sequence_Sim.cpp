@@ -0,0 +1,416 @@
+/*
+  Licensed under a MIT license, see LICENSE.txt in the library src folder.
+  Original published 16/10/26
+*/
+
+/*******************************************************************************************************
+  Program Operation - A master sends numbered reliable packets to a slave on simulated SX1278s, a share of
+  the packets on the air is lost, packets and ACKs, so the master sends again packets whose ACK was lost
+  and that the slave already has. Each run sends the same packets, each up to TXattempts times;
+
+  Plain     - neither end with ReliableSequence, as before, the slave returns a packet again each time
+              its ACK was lost. The packets returned twice are printed, not checked
+  Blocking  - ReliableSequence at both ends, transmitReliableAutoACK() in a TXattempts loop as ACK_config
+              and receiveReliableAutoACK(). The slave must return each packet once, every packet the
+              master had an ACK for, and ACK again each packet whose ACK was lost
+  Polled    - the same with startTransmitReliableAutoACK() and startReceiveReliableAutoACK(), pollReliable()
+              at both ends, as API_config and slave_esp32_mini, and ReliableACKLink. Every ACK must
+              carry the RSSI and SNR, those sent again too
+  Mixed     - a master without ReliableSequence, as an old ACK_config, to the slave with it, every packet
+              must arrive whole, none taken for a duplicate
+  MixedNoCRC - the same with NoReliableCRC at both ends, there is no CRC to tell the packets by, the
+              NetworkID does
+  Repeat    - no packets lost, ReliableSequence at both ends, the master sends the same payload each time,
+              each must be returned, a packet ACKed is never taken for the next one
+  Reserved  - as Polled with a second slave given the NetworkID with ReliableSequenceID flipped, to which
+              the sequenced packets of the first are sent. The library must refuse that NetworkID at both
+              ends, and LTPoll addNode() too, with every packet returned once by the first slave
+
+  The program returns 1 if a check fails.
+
+  Usage: Reliable_Sequence_Sim [packets] [loss 0 to 1] [time scale]
+
+  Build from the library folder, see extras/host/README.md;
+  g++ -std=c++17 -O2 -pthread -Iextras/host -Isrc extras/host/LTHAL.cpp extras/host/SX127XSim.cpp
+      extras/host/Reliable_Sequence_Sim.cpp src/SX127XLT.cpp -o Reliable_Sequence_Sim
+*******************************************************************************************************/
+
+#include <SPI.h>
+#include <SX127XLT.h>
+#include <SX127XSim.h>
+#include <LTPoll.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <stdio.h>
+
+#define NSS 5                                //master_esp32 pins
+#define NRESET 14
+#define DIO0 2
+#define SLAVE_NSS 7                          //slave_esp32_mini pins
+#define SLAVE_NRESET 3
+#define SLAVE_DIO0 2
+#define OTHER_NSS 9                          //second slave, the reserved NetworkID
+#define OTHER_NRESET 4
+#define OTHER_DIO0 2
+
+#define LORA_DEVICE DEVICE_SX1278
+const uint32_t Frequency = 434000000;
+const uint16_t NetworkID = 0x3210;
+const uint16_t OtherNetworkID = NetworkID ^ ReliableSequenceID;
+const uint32_t ACKtimeout = 400;
+const uint32_t TXtimeout = 1000;
+const uint8_t TXattempts = 10;               //as ACK_config, enough that every packet gets through
+const uint32_t ACKdelay = 100;
+const uint32_t RXtimeout = 1000;
+const int8_t TXpower = 10;
+
+struct Run
+{
+  const char *name;
+  bool masterSequence;
+  bool slaveSequence;
+  bool polled;                               //pollReliable() at both ends, with ReliableACKLink
+  bool lossy;                                //packets and ACKs lost
+  bool samePayload;
+  bool noCRC;                                //NoReliableCRC at both ends
+  bool otherNode;                            //second slave on OtherNetworkID
+};
+
+const Run Runs[] =
+{
+  {"Plain", false, false, false, true, false, false, false},
+  {"Blocking", true, true, false, true, false, false, false},
+  {"Polled", true, true, true, true, false, false, false},
+  {"Mixed", false, true, true, true, false, false, false},
+  {"MixedNoCRC", false, true, true, true, false, true, false},
+  {"Repeat", true, true, true, false, true, false, false},
+  {"Reserved", true, true, true, true, false, false, true},
+};
+
+uint32_t packets;
+float loss;
+std::atomic<bool> slaveRun;
+std::atomic<uint32_t> failures(0);
+
+
+void check(bool ok, const char *test, const char *what)
+{
+  if (!ok)
+  {
+    failures++;
+    printf("FAIL %s: %s\n", test, what);
+  }
+}
+
+
+uint8_t buildPayload(const Run &run, uint32_t index, uint8_t *payload)
+{
+  //numbered so the slave knows which packet it has, different lengths so one returned short is noticed
+
+  return snprintf((char *) payload, 32, "P%u %.*s", run.samePayload ? 0 : index, (int) (index % 7), "abcdefg");
+}
+
+
+struct SlaveResult
+{
+  std::vector<uint8_t> returned;             //times each packet was returned
+  uint32_t other;                            //returned packets not sent, or not whole
+  uint16_t duplicates;                       //readReliableDuplicates() at the end
+};
+
+
+void setupNode(SX127XLT &LT, LTSimBoard &board, SX127XSim *radio, int8_t pinNSS, int8_t pinNRESET, int8_t pinDIO0, const Run &run, bool sequence)
+{
+  board.attach(*radio, pinNSS, pinNRESET, pinDIO0);
+  LTHALbind(&board, &board);
+
+  if (!LT.begin(pinNSS, pinNRESET, pinDIO0, LORA_DEVICE))
+  {
+    Serial.println(F("No LoRa device responding"));
+    exit(1);
+  }
+
+  LT.setupLoRa(Frequency, 0, LORA_SF7, LORA_BW_125, LORA_CR_4_5, LDRO_AUTO);
+
+  if (sequence)
+  {
+    LT.setReliableConfig(ReliableSequence);
+  }
+
+  if (run.polled)
+  {
+    LT.setReliableConfig(ReliableACKLink);
+  }
+
+  if (run.noCRC)
+  {
+    LT.setReliableConfig(NoReliableCRC);
+  }
+}
+
+
+void recordPacket(const Run &run, uint8_t *buff, uint8_t length, SlaveResult *result)
+{
+  uint8_t expected[32];
+  uint32_t index = 0;
+
+  for (uint8_t count = 0; count < packets; count++)
+  {
+    index = count;
+
+    if ((buildPayload(run, index, expected) == length) && (memcmp(buff, expected, length) == 0))
+    {
+      break;
+    }
+
+    index = packets;
+  }
+
+  if (run.samePayload && (index < packets))
+  {
+    result->returned[0]++;                   //every packet the same, count them on the first
+  }
+  else if (index < packets)
+  {
+    result->returned[index]++;
+  }
+  else
+  {
+    result->other++;
+  }
+}
+
+
+void slaveNode(SX127XSim *radio, const Run *run, SlaveResult *result)
+{
+  SX127XLT LT;
+  LTSimBoard board;
+  uint8_t buff[251];
+  uint8_t state;
+
+  setupNode(LT, board, radio, SLAVE_NSS, SLAVE_NRESET, SLAVE_DIO0, *run, run->slaveSequence);
+
+  while (slaveRun)
+  {
+    memset(buff, 0, sizeof(buff));
+
+    if (run->polled)
+    {
+      LT.startReceiveReliableAutoACK(buff, sizeof(buff), NetworkID, ACKdelay, TXpower, RXtimeout);
+
+      do
+      {
+        delay(1);
+        state = LT.pollReliable();
+      } while (slaveRun && (state < ReliableDone));
+
+      if (state == ReliableDone)
+      {
+        check(LT.readReliablePayloadL() == (LT.readRXPacketL() - ((run->slaveSequence && run->masterSequence) ? ReliableSequenceL : 4)),
+              run->name, "payload length not the packet less what the library adds");
+        recordPacket(*run, buff, LT.readReliablePayloadL(), result);
+      }
+    }
+    else if (LT.receiveReliableAutoACK(buff, sizeof(buff), NetworkID, ACKdelay, TXpower, RXtimeout, WAIT_RX))
+    {
+      recordPacket(*run, buff, LT.readReliablePayloadL(), result);
+    }
+  }
+
+  LT.cancelReliable();
+  result->duplicates = LT.readReliableDuplicates();
+}
+
+
+void otherNode(SX127XSim *radio, const Run *run, uint32_t *refused)
+{
+  //the slave on OtherNetworkID, each receive must be refused with a ReliableIDError and nothing returned
+
+  SX127XLT LT;
+  LTSimBoard board;
+  uint8_t buff[251];
+
+  setupNode(LT, board, radio, OTHER_NSS, OTHER_NRESET, OTHER_DIO0, *run, true);
+
+  while (slaveRun)
+  {
+    check(LT.startReceiveReliableAutoACK(buff, sizeof(buff), OtherNetworkID, ACKdelay, TXpower, RXtimeout) == 0,
+          run->name, "reserved NetworkID taken by startReceiveReliableAutoACK()");
+    check((LT.getReliableState() == ReliableFailed) && bitRead(LT.readReliableErrors(), ReliableIDError),
+          run->name, "reserved NetworkID not a ReliableIDError");
+    check(LT.receiveReliableAutoACK(buff, sizeof(buff), OtherNetworkID, ACKdelay, TXpower, RXtimeout, WAIT_RX) == 0,
+          run->name, "packet returned on the reserved NetworkID");
+    check(bitRead(LT.readReliableErrors(), ReliableIDError), run->name, "reserved NetworkID not a ReliableIDError");
+    (*refused)++;
+    delay(100);
+  }
+}
+
+
+struct MasterResult
+{
+  uint32_t acked;
+  uint32_t transmissions;
+  std::vector<bool> packetACKed;
+};
+
+
+void masterNode(SX127XSim *radio, const Run *run, MasterResult *result)
+{
+  SX127XLT LT;
+  LTSimBoard board;
+  uint8_t payload[32], payloadL, attempts, state;
+  bool acknowledged;
+
+  setupNode(LT, board, radio, NSS, NRESET, DIO0, *run, run->masterSequence);
+
+  if (run->otherNode)
+  {
+    LTPoll<4> poller;
+
+    payloadL = buildPayload(*run, 0, payload);
+    check(LT.transmitReliableAutoACK(payload, payloadL, OtherNetworkID, ACKtimeout, TXtimeout, TXpower, WAIT_TX) == 0,
+          run->name, "reserved NetworkID sent by transmitReliableAutoACK()");
+    check(bitRead(LT.readReliableErrors(), ReliableIDError), run->name, "reserved NetworkID not a ReliableIDError");
+    LT.startTransmitReliableAutoACK(payload, payloadL, OtherNetworkID, ACKtimeout, TXtimeout, TXpower, TXattempts);
+    check(LT.pollReliable() == ReliableFailed, run->name, "reserved NetworkID sent by startTransmitReliableAutoACK()");
+    check(poller.addNode(OtherNetworkID) < 0, run->name, "reserved NetworkID added by LTPoll addNode()");
+    check(poller.addNode(NetworkID) >= 0, run->name, "NetworkID not added by LTPoll addNode()");
+  }
+
+  for (uint32_t index = 0; index < packets; index++)
+  {
+    payloadL = buildPayload(*run, index, payload);
+    delay(50);
+
+    if (run->polled)
+    {
+      LT.startTransmitReliableAutoACK(payload, payloadL, NetworkID, ACKtimeout, TXtimeout, TXpower, TXattempts);
+
+      do
+      {
+        delay(1);
+        state = LT.pollReliable();
+      } while (state < ReliableDone);
+
+      acknowledged = (state == ReliableDone);
+      result->transmissions += LT.getReliableAttempts();
+
+      if (acknowledged)
+      {
+        check(LT.readReliableACKRSSI() != 0, run->name, "ACK without RSSI and SNR");
+      }
+    }
+    else
+    {
+      attempts = 0;
+
+      do
+      {
+        attempts++;
+        result->transmissions++;
+        acknowledged = LT.transmitReliableAutoACK(payload, payloadL, NetworkID, ACKtimeout, TXtimeout, TXpower, WAIT_TX);
+      } while (!acknowledged && (attempts < TXattempts));
+    }
+
+    result->packetACKed[index] = acknowledged;
+    result->acked += acknowledged;
+  }
+}
+
+
+void runLink(const Run &run)
+{
+  LTSimAir air;
+  SX127XSim masterRadio(air), slaveRadio(air), otherRadio(air);
+  SlaveResult slave = {};
+  MasterResult master = {};
+  uint32_t twice = 0, missing = 0, refused = 0;
+
+  slave.returned.assign(packets, 0);
+  master.packetACKed.assign(packets, false);
+  air.setSeed(25);
+  air.setPacketLoss(run.lossy ? loss : 0);
+
+  slaveRun = true;
+  std::thread slaveThread(slaveNode, &slaveRadio, &run, &slave);
+  std::thread otherThread;
+
+  if (run.otherNode)
+  {
+    otherThread = std::thread(otherNode, &otherRadio, &run, &refused);
+  }
+
+  delay(100);                                //let the slave get into receive
+
+  std::thread masterThread(masterNode, &masterRadio, &run, &master);
+  masterThread.join();
+  delay(ACKdelay + 100);                     //the last ACK
+  slaveRun = false;
+  slaveThread.join();
+
+  if (run.otherNode)
+  {
+    otherThread.join();
+    check(refused > 0, run.name, "second slave did not run");
+  }
+
+  for (uint32_t index = 0; index < packets; index++)
+  {
+    twice += (slave.returned[index] > 1) ? (slave.returned[index] - 1) : 0;
+    missing += (master.packetACKed[index] && (slave.returned[index] == 0)) ? 1 : 0;
+  }
+
+  printf("%-10s acknowledged %u of %u, transmissions %u, ACKs lost %u, returned twice %u, ACKed again %u\n",
+         run.name, master.acked, packets, master.transmissions, masterRadio.packetsLost, run.samePayload ? 0 : twice, slave.duplicates);
+
+  check(slave.other == 0, run.name, "slave returned a packet not sent or not whole");
+
+  if (run.samePayload)
+  {
+    check(slave.returned[0] == master.acked, run.name, "same payload sent again not returned each time");
+    check(slave.duplicates == 0, run.name, "packet taken for a duplicate");
+    return;
+  }
+
+  check(missing == 0, run.name, "packet ACKed not returned");
+
+  if (run.masterSequence && run.slaveSequence)
+  {
+    check(twice == 0, run.name, "packet returned more than once");
+    check((master.acked < packets) || (slave.duplicates == masterRadio.packetsLost), run.name, "not every packet whose ACK was lost ACKed again");
+  }
+  else
+  {
+    check(slave.duplicates == 0, run.name, "packet without a sequence number taken for a duplicate");
+  }
+}
+
+
+int main(int argc, char *argv[])
+{
+  packets = (argc > 1) ? atoi(argv[1]) : 40;
+  loss = (argc > 2) ? atof(argv[2]) : 0.3;
+  float scale = (argc > 3) ? atof(argv[3]) : 10;
+
+  LTHostClock clock(scale);
+  LTHALsetClock(&clock);
+
+  if ((packets == 0) || (packets > 250))
+  {
+    printf("packets 1 to 250\n");
+    return 1;
+  }
+
+  printf("%u packets, %.0f%% of packets lost, up to %u transmissions each\n", packets, loss * 100, TXattempts);
+
+  for (const Run &run : Runs)
+  {
+    runLink(run);
+  }
+
+  printf("%s, %u failures\n", failures ? "FAILED" : "PASSED", (uint32_t) failures);
+  return failures ? 1 : 0;
+}
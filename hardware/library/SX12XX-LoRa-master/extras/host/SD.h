@@ -0,0 +1,224 @@
+/*
+  Licensed under a MIT license, see LICENSE.txt in the library src folder.
+  Original published 16/10/26
+*/
+
+/*******************************************************************************************************
+  Host replacement for SD.h with an in memory card, so DTSDlibrary.h runs unmodified on the host with
+  SDLIB defined.
+
+  Files are byte vectors by name in LTSimSDCard, there are no directories. FILE_WRITE opens at the end
+  of the file as the Arduino SD library does. Every write() to a file is counted in SDCard.stats, the
+  calls, the bytes and the calls that were one whole sector at a sector boundary of the file, which the
+  SD libraries pass straight to the card instead of through their one sector cache.
+*******************************************************************************************************/
+
+#ifndef SD_h
+#define SD_h
+
+#include <Arduino.h>
+#include <map>
+#include <string>
+#include <vector>
+
+#define FILE_READ 0
+#define FILE_WRITE 1
+
+#define LTSimSDSectorSize 512
+
+
+struct LTSimSDStats
+{
+  uint32_t writeCalls;                        //calls of write(), of any length
+  uint32_t writeBytes;
+  uint32_t sectorWrites;                      //calls that were one whole sector at a sector boundary
+};
+
+
+class LTSimSDCard
+{
+  public:
+
+    std::map<std::string, std::vector<uint8_t>> files;
+    LTSimSDStats stats = {0, 0, 0};
+
+    void clearStats()
+    {
+      stats = {0, 0, 0};
+    }
+};
+
+inline LTSimSDCard SDCard;
+
+
+class File
+{
+  public:
+
+    File()
+    {
+    }
+
+    File(const char *name, std::vector<uint8_t> *data, uint32_t position) :
+      _name(name), _data(data), _position(position)
+    {
+    }
+
+    explicit operator bool()
+    {
+      return _data != NULL;
+    }
+
+    size_t write(uint8_t data)
+    {
+      return write(&data, 1);
+    }
+
+    size_t write(const uint8_t *buffer, size_t size)
+    {
+      if (_data == NULL)
+      {
+        return 0;
+      }
+
+      if ((_position + size) > _data->size())
+      {
+        _data->resize(_position + size);
+      }
+
+      memcpy(_data->data() + _position, buffer, size);
+      SDCard.stats.writeCalls++;
+      SDCard.stats.writeBytes += size;
+
+      if ((size == LTSimSDSectorSize) && ((_position % LTSimSDSectorSize) == 0))
+      {
+        SDCard.stats.sectorWrites++;
+      }
+
+      _position += size;
+      return size;
+    }
+
+    int read()
+    {
+      if ((_data == NULL) || (_position >= _data->size()))
+      {
+        return -1;
+      }
+
+      return (*_data)[_position++];
+    }
+
+    int read(void *buffer, size_t size)
+    {
+      size_t count = (size_t) available();
+
+      count = (count < size) ? count : size;
+
+      if (count > 0)
+      {
+        memcpy(buffer, _data->data() + _position, count);
+        _position += count;
+      }
+
+      return (int) count;
+    }
+
+    int available()
+    {
+      return (_data == NULL) ? 0 : (int) (_data->size() - _position);
+    }
+
+    bool seek(uint32_t position)
+    {
+      if ((_data == NULL) || (position > _data->size()))
+      {
+        return false;
+      }
+
+      _position = position;
+      return true;
+    }
+
+    uint32_t position()
+    {
+      return _position;
+    }
+
+    uint32_t size()
+    {
+      return (_data == NULL) ? 0 : (uint32_t) _data->size();
+    }
+
+    void flush()
+    {
+    }
+
+    void close()
+    {
+      _data = NULL;
+    }
+
+    const char *name()
+    {
+      return _name.c_str();
+    }
+
+    bool isDirectory()
+    {
+      return false;
+    }
+
+    File openNextFile()
+    {
+      return File();
+    }
+
+  private:
+
+    std::string _name;
+    std::vector<uint8_t> *_data = NULL;
+    uint32_t _position = 0;
+};
+
+
+class SDClass
+{
+  public:
+
+    bool begin(uint8_t cspin)
+    {
+      (void) cspin;
+      return true;
+    }
+
+    bool exists(const char *name)
+    {
+      return SDCard.files.count(name) != 0;
+    }
+
+    bool remove(const char *name)
+    {
+      return SDCard.files.erase(name) != 0;
+    }
+
+    File open(const char *name, uint8_t mode = FILE_READ)
+    {
+      if (mode == FILE_WRITE)
+      {
+        std::vector<uint8_t> &data = SDCard.files[name];
+        return File(name, &data, (uint32_t) data.size());
+      }
+
+      if (!exists(name))
+      {
+        return File();
+      }
+
+      return File(name, &SDCard.files[name], 0);
+    }
+};
+
+inline SDClass SD;
+
+#endif
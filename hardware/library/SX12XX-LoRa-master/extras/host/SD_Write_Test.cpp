@@ -0,0 +1,214 @@
+/*
+  Licensed under a MIT license, see LICENSE.txt in the library src folder.
+  Original published 16/10/26
+*/
+
+/*******************************************************************************************************
+  Program Operation - Tests the sector buffered segment writes and the write CRC of DTSDlibrary.h on an
+  in memory SD card, as the receiver of SDtransfer.h uses them;
+
+  Transfer - a file received in 245 byte segments, written a byte at a time as DTSD_writeSegmentFile()
+             used to, a segment at a time as it still is on AVR, and through the sector buffers with
+             DTSD_writePending() after each segment as SDtransfer.h calls it in the ACK delay. The calls
+             of write() to the card, the whole sector writes and the calls made before the ACK could be
+             sent are printed
+  Random   - files of random length in segments of random size, with DTSD_fileFlush() at random and
+             DTSD_writePending() left out at random, the file and the write CRC are checked each time
+  Fallback - a file opened with DTSD_openFileWrite() at a position, DTSD_getWriteCRC() must read the
+             file back
+
+  Each file must be as sent and DTSD_getWriteCRC() must be the CRC of the whole file. The program
+  returns 1 if either differs.
+
+  Usage: SD_Write_Test [file bytes] [random files]
+
+  Build from the library folder, see extras/host/README.md;
+  g++ -std=c++17 -O2 -pthread -Iextras/host -Isrc extras/host/LTHAL.cpp extras/host/SD_Write_Test.cpp
+      -o SD_Write_Test
+*******************************************************************************************************/
+
+#define SDLIB
+#include <SD.h>
+#include <DTSDlibrary.h>
+
+#include <random>
+#include <vector>
+#include <stdio.h>
+
+const uint8_t SegmentSize = 245;              //largest segment of the SDtransfer examples
+
+char filename[] = "/RECEIVED.BIN";
+uint32_t failures = 0;
+
+
+void check(bool ok, const char *test, const char *what)
+{
+  if (!ok)
+  {
+    printf("FAIL %s: %s\n", test, what);
+    failures++;
+  }
+}
+
+
+void checkFile(const std::vector<uint8_t> &sent, const char *test)
+{
+  uint32_t length = DTSD_openFileRead(filename);
+
+  check((length == sent.size()) && (SDCard.files[filename] == sent), test, "file differs from what was sent");
+  check(DTSD_getWriteCRC(length) == LTCRCCCITTUpdate(0xFFFF, sent.data(), sent.size()), test, "write CRC is not the CRC of the file");
+  DTSD_closeFile();
+}
+
+
+void testTransfer(uint32_t bytes)
+{
+  std::vector<uint8_t> sent(bytes);
+  std::mt19937 random(1);
+  uint32_t index, size, calls, beforeACK;
+  const char *methods[] = {"Byte", "Segment", "Sector"};
+
+  for (uint8_t &data : sent)
+  {
+    data = (uint8_t) random();
+  }
+
+  printf("Transfer   %u bytes in %u byte segments\n", bytes, SegmentSize);
+
+  for (uint8_t method = 0; method < 3; method++)
+  {
+    DTSD_openNewFileWrite(filename);
+    SDCard.clearStats();
+    beforeACK = 0;
+
+    for (index = 0; index < bytes; index = index + size)
+    {
+      size = ((bytes - index) < SegmentSize) ? (bytes - index) : SegmentSize;
+      calls = SDCard.stats.writeCalls;
+
+      if (method == 0)
+      {
+        for (uint32_t byte = 0; byte < size; byte++)
+        {
+          dataFile.write(sent[index + byte]);
+        }
+      }
+      else if (method == 1)
+      {
+        dataFile.write(&sent[index], size);
+      }
+      else
+      {
+        DTSD_writeSegmentFile(&sent[index], (uint8_t) size);
+      }
+
+      beforeACK += SDCard.stats.writeCalls - calls;
+      DTSD_writePending();                           //in the ACK delay
+    }
+
+    DTSD_closeFile();
+
+    printf("  %-8s %6u calls of write(), %4u whole sectors, %6u calls before the ACK could be sent\n",
+           methods[method], SDCard.stats.writeCalls, SDCard.stats.sectorWrites, beforeACK);
+    check(SDCard.files[filename] == sent, methods[method], "file differs from what was sent");
+  }
+
+  check(beforeACK == 0, "Transfer", "a segment was written to the card before the ACK");
+  check(SDCard.stats.sectorWrites == (bytes / LTSimSDSectorSize), "Transfer", "not every whole sector written as one");
+
+  DTSD_openNewFileWrite(filename);
+
+  for (index = 0; index < bytes; index = index + size)
+  {
+    size = ((bytes - index) < SegmentSize) ? (bytes - index) : SegmentSize;
+    DTSD_writeSegmentFile(&sent[index], (uint8_t) size);
+    DTSD_writePending();
+  }
+
+  DTSD_closeFile();
+  checkFile(sent, "Transfer");
+  printf("  CRC      the write CRC needs no read back, DTSD_fileCRCCCITT() reads the %u bytes again\n", bytes);
+}
+
+
+void testRandom(uint32_t files)
+{
+  std::mt19937 random(2);
+  std::vector<uint8_t> sent;
+  uint32_t bytes, index, size;
+
+  for (uint32_t file = 0; file < files; file++)
+  {
+    bytes = std::uniform_int_distribution<uint32_t>(0, 20000)(random);
+    sent.resize(bytes);
+
+    for (uint8_t &data : sent)
+    {
+      data = (uint8_t) random();
+    }
+
+    DTSD_openNewFileWrite(filename);
+
+    for (index = 0; index < bytes; index = index + size)
+    {
+      size = std::uniform_int_distribution<uint32_t>(1, 255)(random);
+      size = ((bytes - index) < size) ? (bytes - index) : size;
+      DTSD_writeSegmentFile(&sent[index], (uint8_t) size);
+
+      if ((random() % 4) != 0)
+      {
+        DTSD_writePending();
+      }
+
+      if ((random() % 50) == 0)
+      {
+        DTSD_fileFlush();
+      }
+    }
+
+    DTSD_closeFile();
+    checkFile(sent, "Random");
+  }
+
+  printf("Random     %u files checked\n", files);
+}
+
+
+void testFallback()
+{
+  std::vector<uint8_t> sent(3000);
+
+  for (uint32_t index = 0; index < sent.size(); index++)
+  {
+    sent[index] = (uint8_t) (index * 7);
+  }
+
+  DTSD_openNewFileWrite(filename);
+  DTSD_writeSegmentFile(&sent[0], 200);
+  DTSD_closeFile();
+
+  DTSD_openFileWrite(filename, 200);
+
+  for (uint32_t index = 200; index < sent.size(); index = index + 200)
+  {
+    DTSD_writeSegmentFile(&sent[index], 200);
+  }
+
+  DTSD_closeFile();
+  checkFile(sent, "Fallback");
+  printf("Fallback   file written from a position, the CRC is read back\n");
+}
+
+
+int main(int argc, char *argv[])
+{
+  uint32_t bytes = (argc > 1) ? atoi(argv[1]) : 100000;
+  uint32_t files = (argc > 2) ? atoi(argv[2]) : 2000;
+
+  testTransfer(bytes);
+  testRandom(files);
+  testFallback();
+
+  printf("%s, %u failures\n", failures ? "FAILED" : "PASSED", failures);
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,79 @@
+/*
+  Licensed under a MIT license, see LICENSE.txt in the library src folder.
+  Original published 16/10/26
+*/
+
+/*******************************************************************************************************
+  Host replacement for SPI.h, transfers are forwarded to the SPI bus bound to the calling thread, see
+  LTHALbind() in LTHAL.h. Bus speed, bit order and mode are accepted and ignored. writeBytes() and
+  transferBytes() are the block transfers of the ESP32 SPIClass, the bus moves the whole block in one call.
+*******************************************************************************************************/
+
+#ifndef SPI_h
+#define SPI_h
+
+#include <Arduino.h>
+
+#define SPI_MODE0 0x00
+#define SPI_MODE1 0x04
+#define SPI_MODE2 0x08
+#define SPI_MODE3 0x0C
+
+#define SPI_HAS_TRANSFER_BYTES                      //has the ESP32 writeBytes() and transferBytes()
+
+
+class SPISettings
+{
+  public:
+    SPISettings(uint32_t clock, uint8_t bitOrder, uint8_t dataMode)
+    {
+      (void) clock;
+      (void) bitOrder;
+      (void) dataMode;
+    }
+};
+
+
+class SPIClass
+{
+  public:
+    void begin() {}
+    void begin(int8_t sck, int8_t miso, int8_t mosi, int8_t ss)
+    {
+      (void) sck;
+      (void) miso;
+      (void) mosi;
+      (void) ss;
+    }
+    void end() {}
+
+    void beginTransaction(SPISettings settings)
+    {
+      (void) settings;
+      LTHALgetSPI()->beginTransaction();
+    }
+
+    uint8_t transfer(uint8_t data)
+    {
+      return LTHALgetSPI()->transfer(data);
+    }
+
+    void writeBytes(const uint8_t *data, uint32_t size)
+    {
+      LTHALgetSPI()->transferBytes(data, NULL, size);
+    }
+
+    void transferBytes(const uint8_t *data, uint8_t *out, uint32_t size)
+    {
+      LTHALgetSPI()->transferBytes(data, out, size);
+    }
+
+    void endTransaction()
+    {
+      LTHALgetSPI()->endTransaction();
+    }
+};
+
+extern SPIClass SPI;
+
+#endif
@@ -0,0 +1,419 @@
+/*
+  Licensed under a MIT license, see LICENSE.txt in the library src folder.
+  Original published 16/10/26
+*/
+
+/*******************************************************************************************************
+  Program Operation - Runs SX126XLT against a mocked SX1262 that holds BUSY high after each command, on a
+  simulated clock, and checks the driver never starts a command while BUSY is high;
+
+  Setup     - begin() and setupLoRa(), the simulated time each takes and the BUSY wait counters of the
+              driver, getBusyStats(), against the commands the mock saw and how long it held BUSY
+  Queue     - commands between beginCommandQueue() and endCommandQueue(), a command repeated in a row is
+              sent once with the last parameters, a register read sends what is queued first
+  Interrupt - setupLoRa() again waiting on the BUSY falling edge interrupt, setBusyInterrupt()
+  Timeout   - BUSY held high for 20mS, the driver resets the device and carries on
+  Config    - applyConfig() with the parameters of LTLoRaConfig.h must send the commands setupLoRa() sends,
+              for every spreading factor, bandwidth, coding rate and LDRO setting at four frequencies
+
+  The time BUSY stays high after each command is a model, 3.5mS for a calibration of all blocks and after
+  a reset as in the datasheet, 1mS for an image calibration and 20uS for the rest. Each SPI byte takes 1uS,
+  8MHz, and each read of BUSY or the clock 0.1uS.
+
+  To see the times with the original BUSY handling, 1mS steps and a wait after every command, comment out
+  USE_BUSY_MICROS at the top of SX126XLT.cpp, the wait counters are only kept with it so those checks
+  fail. The program returns 1 if a check fails.
+
+  Build from the library folder, see extras/host/README.md;
+  g++ -std=c++17 -O2 -pthread -Iextras/host -Isrc extras/host/LTHAL.cpp extras/host/SX126X_Busy_Sim.cpp
+      src/SX126XLT.cpp -o SX126X_Busy_Sim
+*******************************************************************************************************/
+
+#include <SPI.h>
+#include <SX126XLT.h>
+#include <LTHAL.h>
+
+#include <map>
+#include <vector>
+#include <stdio.h>
+
+#define NSS 5                                //pins of an SX1262 module on an ESP32
+#define NRESET 14
+#define RFBUSY 4
+#define DIO1 2
+
+#define LORA_DEVICE DEVICE_SX1262
+const uint32_t Frequency = 434000000;
+
+uint32_t failures = 0;
+
+
+void check(bool ok, const char *test, const char *what)
+{
+  if (!ok)
+  {
+    printf("FAIL %s: %s\n", test, what);
+    failures++;
+  }
+}
+
+
+struct MockCommand
+{
+  uint8_t opcode;
+  std::vector<uint8_t> params;
+};
+
+
+class SX1262Mock : public LTHALSPI, public LTHALGPIO, public LTHALClock
+{
+  public:
+
+    std::vector<MockCommand> commands;        //every command in the order received
+    uint32_t violations = 0;                  //commands started while BUSY was high
+    uint32_t resets = 0;
+    uint32_t interrupts = 0;                  //BUSY falling edge interrupts raised
+    std::map<uint8_t, uint32_t> busyuS;       //longest time BUSY was held after each command
+
+    uint64_t nowNanos()
+    {
+      return _nowNs;
+    }
+
+    void holdBusy(uint32_t us)
+    {
+      _busy = true;
+      _busyUntilNs = _nowNs + (us * 1000ULL);
+    }
+
+    //LTHALClock
+
+    uint64_t nowMicros()
+    {
+      advance(100);
+      return _nowNs / 1000;
+    }
+
+    void sleepMicros(uint64_t us)
+    {
+      advance(us * 1000);
+    }
+
+    //LTHALGPIO
+
+    void pinMode(uint8_t pin, uint8_t mode)
+    {
+      (void) pin;
+      (void) mode;
+    }
+
+    void digitalWrite(uint8_t pin, uint8_t level)
+    {
+      if ((pin == NRESET) && (level == LOW))
+      {
+        _inReset = true;
+        _busy = true;
+      }
+
+      if ((pin == NRESET) && (level == HIGH) && _inReset)
+      {
+        _inReset = false;
+        resets++;
+        holdBusy(3500);
+      }
+
+      if ((pin == NSS) && (level == LOW))
+      {
+        _frame.clear();
+        violations += _busy;
+      }
+
+      if ((pin == NSS) && (level == HIGH) && !_frame.empty())
+      {
+        endFrame();
+      }
+    }
+
+    int digitalRead(uint8_t pin)
+    {
+      advance(100);
+      return (pin == RFBUSY) ? _busy : LOW;
+    }
+
+    void attachInterrupt(uint8_t pin, void (*isr)(), int mode)
+    {
+      (void) mode;
+      _isr = (pin == RFBUSY) ? isr : NULL;
+    }
+
+    void detachInterrupt(uint8_t pin)
+    {
+      (void) pin;
+      _isr = NULL;
+    }
+
+    //LTHALSPI
+
+    uint8_t transfer(uint8_t data)
+    {
+      uint8_t out = 0;
+
+      advance(1000);
+
+      if ((_frame.size() >= 4) && (_frame[0] == RADIO_READ_REGISTER))
+      {
+        out = _registers[(uint16_t) (((_frame[1] << 8) | _frame[2]) + (_frame.size() - 4))];
+      }
+
+      _frame.push_back(data);
+      return out;
+    }
+
+  private:
+
+    void advance(uint64_t ns)
+    {
+      _nowNs += ns;
+
+      if (_busy && !_inReset && (_nowNs >= _busyUntilNs))
+      {
+        _busy = false;
+
+        if (_isr != NULL)
+        {
+          interrupts++;
+          _isr();                             //falling edge
+        }
+      }
+    }
+
+    void endFrame()
+    {
+      uint8_t opcode = _frame[0];
+      uint32_t us = 20;
+
+      if (opcode == RADIO_WRITE_REGISTER)
+      {
+        for (size_t index = 3; index < _frame.size(); index++)
+        {
+          _registers[(uint16_t) (((_frame[1] << 8) | _frame[2]) + (index - 3))] = _frame[index];
+        }
+      }
+
+      if (opcode == RADIO_CALIBRATE)
+      {
+        us = 3500;
+      }
+
+      if (opcode == RADIO_CALIBRATEIMAGE)
+      {
+        us = 1000;
+      }
+
+      commands.push_back({opcode, std::vector<uint8_t>(_frame.begin() + 1, _frame.end())});
+      busyuS[opcode] = std::max(busyuS[opcode], us);
+      holdBusy(us);
+    }
+
+    uint64_t _nowNs = 0;
+    uint64_t _busyUntilNs = 0;
+    bool _busy = false;
+    bool _inReset = false;
+    void (*_isr)() = NULL;
+    std::vector<uint8_t> _frame;
+    std::map<uint16_t, uint8_t> _registers;
+};
+
+
+SX1262Mock mock;
+SX126XLT LT;
+
+
+double elapsedmS(uint64_t startns)
+{
+  return (mock.nowNanos() - startns) / 1e6;
+}
+
+
+void checkStats(const char *test, size_t first)
+{
+  //the counters were reset before the wait after the command before first, the test waits after the
+  //last, each wait cannot be longer than the mock held BUSY
+
+  SX126XBusyStat stats[SX126XBusyStatsSize];
+  std::map<uint8_t, uint32_t> sent;
+  uint8_t count = LT.getBusyStats(stats, SX126XBusyStatsSize);
+  char what[64];
+
+  for (size_t index = first - 1; index < mock.commands.size(); index++)
+  {
+    sent[mock.commands[index].opcode]++;
+  }
+
+  for (uint8_t index = 0; index < count; index++)
+  {
+    printf("  0x%02X %3u sent, mean wait %7.1fuS, longest %5uuS\n", stats[index].opcode, stats[index].count,
+           (double) stats[index].waituS / stats[index].count, stats[index].maxuS);
+
+    snprintf(what, sizeof(what), "count of 0x%02X", stats[index].opcode);
+    check(stats[index].count == sent[stats[index].opcode], test, what);
+    snprintf(what, sizeof(what), "wait after 0x%02X longer than BUSY was held", stats[index].opcode);
+    check(stats[index].maxuS <= (mock.busyuS[stats[index].opcode] + 1), test, what);
+    sent.erase(stats[index].opcode);
+  }
+
+  check(sent.empty(), test, "a command sent has no wait counter");
+}
+
+
+void testSetup()
+{
+  uint64_t startns = mock.nowNanos();
+  size_t first;
+
+  check(LT.begin(NSS, NRESET, RFBUSY, DIO1, LORA_DEVICE), "Setup", "begin() did not find the device");
+  printf("Setup      begin() %.2fmS", elapsedmS(startns));
+
+  LT.resetBusyStats();
+  first = mock.commands.size();
+  startns = mock.nowNanos();
+  LT.setupLoRa(Frequency, 0, LORA_SF7, LORA_BW_125, LORA_CR_4_5, LDRO_AUTO);
+  LT.checkBusy();                            //wait for the last command too
+  printf(", setupLoRa() %.2fmS, %u commands\n", elapsedmS(startns), (uint32_t) (mock.commands.size() - first));
+
+  checkStats("Setup", first);
+  check(mock.violations == 0, "Setup", "command started while BUSY was high");
+}
+
+
+void testQueue()
+{
+  size_t first = mock.commands.size();
+
+  LT.beginCommandQueue();
+  LT.setPacketParams(8, LORA_PACKET_VARIABLE_LENGTH, 255, LORA_CRC_ON, LORA_IQ_NORMAL);
+  LT.setPacketParams(12, LORA_PACKET_VARIABLE_LENGTH, 255, LORA_CRC_ON, LORA_IQ_NORMAL);
+  LT.setPacketParams(16, LORA_PACKET_VARIABLE_LENGTH, 64, LORA_CRC_ON, LORA_IQ_NORMAL);
+  LT.setModulationParams(LORA_SF9, LORA_BW_125, LORA_CR_4_5, LDRO_AUTO);
+  LT.setTxParams(10, RADIO_RAMP_200_US);
+  LT.setTxParams(14, RADIO_RAMP_200_US);
+  check(mock.commands.size() == first, "Queue", "command sent while queueing");
+
+  LT.readRegister(0x88e);                    //sends the queue first
+  LT.endCommandQueue();
+
+  std::vector<MockCommand> seen(mock.commands.begin() + first, mock.commands.end());
+  std::vector<uint8_t> opcodes;
+
+  for (const MockCommand &command : seen)
+  {
+    opcodes.push_back(command.opcode);
+  }
+
+  printf("Queue      6 commands queued, %u sent before the register read\n", (uint32_t) (opcodes.size() - 1));
+  check(opcodes == std::vector<uint8_t>({RADIO_SET_PACKETPARAMS, RADIO_SET_MODULATIONPARAMS, RADIO_SET_TXPARAMS, RADIO_READ_REGISTER}),
+        "Queue", "commands not sent once each in order");
+  check((seen.size() == 4) && (seen[0].params[1] == 16) && (seen[0].params[3] == 64), "Queue", "packet params not the last queued");
+  check((seen.size() == 4) && (seen[2].params[0] == 14), "Queue", "TX params not the last queued");
+  check(mock.violations == 0, "Queue", "command started while BUSY was high");
+}
+
+
+void testInterrupt()
+{
+  uint64_t startns;
+  size_t first = mock.commands.size();
+  uint32_t interrupts = mock.interrupts;
+
+  LT.setBusyInterrupt(true);
+  LT.resetBusyStats();
+  startns = mock.nowNanos();
+  LT.setupLoRa(Frequency, 0, LORA_SF7, LORA_BW_125, LORA_CR_4_5, LDRO_AUTO);
+  LT.checkBusy();
+  printf("Interrupt  setupLoRa() %.2fmS, %u falling edges\n", elapsedmS(startns), mock.interrupts - interrupts);
+  LT.setBusyInterrupt(false);
+
+  checkStats("Interrupt", first);
+  check(mock.violations == 0, "Interrupt", "command started while BUSY was high");
+}
+
+
+void testConfig()
+{
+  const uint32_t bandwidths[] = {7800, 10400, 15600, 20800, 31250, 41700, 62500, 125000, 250000, 500000};
+  const uint8_t bandwidthcodes[] = {LORA_BW_007, LORA_BW_010, LORA_BW_015, LORA_BW_020, LORA_BW_031, LORA_BW_041, LORA_BW_062, LORA_BW_125, LORA_BW_250, LORA_BW_500};
+  const uint32_t frequencies[] = {434000000, 434000000, 868100000, 915000000};
+  const int32_t offsets[] = {0, -25000, 0, 0};
+  uint32_t settings = 0, differ = 0;
+  uint32_t violations = mock.violations;              //the timeout test starts a command with BUSY held
+  size_t first;
+
+  for (uint8_t place = 0; place < 4; place++)
+  {
+    for (uint8_t sf = LORA_SF5; sf <= LORA_SF12; sf++)
+    {
+      for (uint8_t bw = 0; bw < 10; bw++)
+      {
+        for (uint8_t cr = 0; cr < 4; cr++)
+        {
+          for (uint8_t ldro = LDRO_OFF; ldro <= LDRO_AUTO; ldro++)
+          {
+            first = mock.commands.size();
+            LT.setupLoRa(frequencies[place], offsets[place], sf, bandwidthcodes[bw], cr + LORA_CR_4_5, ldro);
+            std::vector<MockCommand> runtime(mock.commands.begin() + first, mock.commands.end());
+
+            first = mock.commands.size();
+            LT.applyConfig(LTLoRaConfigSX126X(frequencies[place], offsets[place], sf, bandwidths[bw], cr + 5, ldro));
+            std::vector<MockCommand> image(mock.commands.begin() + first, mock.commands.end());
+
+            bool same = (runtime.size() == image.size());
+
+            for (size_t index = 0; same && (index < runtime.size()); index++)
+            {
+              same = (runtime[index].opcode == image[index].opcode) && (runtime[index].params == image[index].params);
+            }
+
+            differ += !same;
+            settings++;
+          }
+        }
+      }
+    }
+  }
+
+  printf("Config     %u settings, %u where applyConfig() sent other commands than setupLoRa()\n", settings, differ);
+  check(differ == 0, "Config", "applyConfig() commands differ from setupLoRa()");
+  check(mock.violations == violations, "Config", "command started while BUSY was high");
+}
+
+
+void testTimeout()
+{
+  uint32_t resets = mock.resets;
+
+  LT.resetBusyStats();
+  mock.holdBusy(20000);
+  LT.setSyncWord(LORA_MAC_PRIVATE_SYNCWORD);
+  LT.checkBusy();
+
+  printf("Timeout    %u timeout, %u resets, one by the timeout and one by config()\n", LT.getBusyTimeouts(), mock.resets - resets);
+  check(LT.getBusyTimeouts() == 1, "Timeout", "timeout not counted");
+  check((mock.resets - resets) >= 1, "Timeout", "device not reset");
+  check(LT.checkDevice(), "Timeout", "device not working after the reset");
+}
+
+
+int main()
+{
+  LTHALbind(&mock, &mock);
+  LTHALsetClock(&mock);
+
+  testSetup();
+  testQueue();
+  testInterrupt();
+  testTimeout();
+  testConfig();
+
+  printf("%s, %u failures\n", failures ? "FAILED" : "PASSED", failures);
+  return failures ? 1 : 0;
+}
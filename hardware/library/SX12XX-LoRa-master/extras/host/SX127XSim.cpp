@@ -0,0 +1,1041 @@
+/*
+  Licensed under a MIT license, see LICENSE.txt in the library src folder.
+  Original published 16/10/26
+*/
+
+#include <SX127XSim.h>
+
+//RegIrqFlags bits
+#define SIMIRQ_RXTIMEOUT    0x80
+#define SIMIRQ_RXDONE       0x40
+#define SIMIRQ_CRCERROR     0x20
+#define SIMIRQ_HEADERVALID  0x10
+#define SIMIRQ_TXDONE       0x08
+#define SIMIRQ_CADDONE      0x04
+#define SIMIRQ_CADDETECTED  0x01
+
+#define SIMFRF_779MHZ       0xC2C000    //frequency register value for 779Mhz, the LF/HF port RSSI offset changes here
+
+
+static const uint32_t bandwidthTable[10] = {7810, 10420, 15630, 20830, 31250, 41670, 62500, 125000, 250000, 500000};
+
+
+/***************************************************************************
+  SX127XSim
+***************************************************************************/
+
+SX127XSim::SX127XSim(LTSimAir &air) : _air(air)
+{
+  packetsSent = 0;
+  packetsReceived = 0;
+  packetsLost = 0;
+  spiTransactions = 0;
+  txAirtimeuS = 0;
+  memset(modeTimeuS, 0, sizeof(modeTimeuS));
+  memset(_regs, 0, sizeof(_regs));
+  _modeStartuS = LTHALgetClock()->nowMicros();
+  _pathLoss = 80;
+  _selected = false;
+  reset();
+  _air.attach(this);
+}
+
+
+void SX127XSim::reset()
+{
+  //register values after reset, LoRa page defaults from the datasheet
+
+  std::lock_guard<std::recursive_mutex> guard(_air.lock);
+
+  endMode(LTHALgetClock()->nowMicros());
+  memset(_regs, 0, sizeof(_regs));
+  memset(_fifo, 0, sizeof(_fifo));
+
+  _regs[REG_OPMODE] = 0x09;
+  _regs[REG_FRMSB] = 0x6C;
+  _regs[REG_FRMID] = 0x80;
+  _regs[REG_FRLSB] = 0x00;
+  _regs[REG_PACONFIG] = 0x4F;
+  _regs[REG_PARAMP] = 0x09;
+  _regs[REG_OCP] = 0x2B;
+  _regs[REG_LNA] = 0x20;
+  _regs[REG_FIFOTXBASEADDR] = 0x80;
+  _regs[REG_MODEMCONFIG1] = 0x72;
+  _regs[REG_MODEMCONFIG2] = 0x70;
+  _regs[REG_SYMBTIMEOUTLSB] = 0x64;
+  _regs[REG_PREAMBLELSB] = 0x08;
+  _regs[REG_PAYLOADLENGTH] = 0x01;
+  _regs[0x23] = 0xFF;                                //RegMaxPayloadLength
+  _regs[REG_MODEMCONFIG3] = 0x04;
+  _regs[REG_DETECTOPTIMIZE] = 0xC3;
+  _regs[REG_INVERTIQ] = 0x27;
+  _regs[REG_DETECTIONTHRESHOLD] = 0x0A;
+  _regs[REG_SYNCWORD] = 0x12;
+  _regs[REG_INVERTIQ2] = 0x1D;
+  _regs[REG_VERSION] = 0x12;
+  _regs[REG_PADAC] = 0x84;
+
+  _addressPhase = false;
+  _writing = false;
+  _address = 0;
+  _txEnduS = 0;
+  _rxTimeoutuS = 0;
+  _cadEnduS = 0;
+  _cadStartuS = 0;
+  _txPacket.reset();
+  _rxPacket.reset();
+  _rxRSSI = 0;
+  _rxSNR = 0;
+}
+
+
+void SX127XSim::select(bool active)
+{
+  if (active && !_selected)
+  {
+    spiTransactions++;
+  }
+
+  _selected = active;
+  _addressPhase = active;
+}
+
+
+uint8_t SX127XSim::transfer(uint8_t data)
+{
+  std::lock_guard<std::recursive_mutex> guard(_air.lock);
+
+  uint64_t now = LTHALgetClock()->nowMicros();
+  uint8_t regdata = 0;
+
+  if (!_selected)
+  {
+    return 0xFF;                                     //NSS high, device does not drive MISO
+  }
+
+  update(now);
+
+  if (_addressPhase)
+  {
+    _writing = (data & 0x80);
+    _address = (data & 0x7F);
+    _addressPhase = false;
+    return 0;
+  }
+
+  if (_writing)
+  {
+    writeRegister(_address, data, now);
+  }
+  else
+  {
+    regdata = readRegister(_address, now);
+  }
+
+  if (_address != REG_FIFO)
+  {
+    _address = (_address + 1) & 0x7F;                //burst access, address auto increments, FIFO does not
+  }
+
+  return regdata;
+}
+
+
+void SX127XSim::transferBytes(const uint8_t *data, uint8_t *out, uint32_t size)
+{
+  //a FIFO burst is copied to or from the FIFO with memcpy, the FIFO address pointer wraps at 256 as
+  //it does a byte at a time. Anything else goes through transfer().
+
+  std::lock_guard<std::recursive_mutex> guard(_air.lock);
+
+  uint32_t index, length;
+  uint8_t pointer;
+
+  if (!_selected || _addressPhase || (_address != REG_FIFO))
+  {
+    for (index = 0; index < size; index++)
+    {
+      uint8_t regdata = transfer(data ? data[index] : 0xFF);
+
+      if (out)
+      {
+        out[index] = regdata;
+      }
+    }
+
+    return;
+  }
+
+  update(LTHALgetClock()->nowMicros());
+
+  for (index = 0; index < size; index = index + length)
+  {
+    pointer = _regs[REG_FIFOADDRPTR];
+    length = ((size - index) < (256U - pointer)) ? (size - index) : (256U - pointer);
+
+    if (_writing)
+    {
+      if (data)
+      {
+        memcpy(&_fifo[pointer], &data[index], length);
+      }
+      else
+      {
+        memset(&_fifo[pointer], 0xFF, length);
+      }
+    }
+    else if (out)
+    {
+      memcpy(&out[index], &_fifo[pointer], length);
+    }
+
+    _regs[REG_FIFOADDRPTR] = (uint8_t) (pointer + length);
+  }
+
+  if (out && _writing)
+  {
+    memset(out, 0, size);
+  }
+}
+
+
+bool SX127XSim::readDIO(uint8_t dio)
+{
+  std::lock_guard<std::recursive_mutex> guard(_air.lock);
+
+  uint8_t mapping, flags;
+
+  update(LTHALgetClock()->nowMicros());
+
+  flags = _regs[REG_IRQFLAGS];
+
+  if (dio == 0)
+  {
+    mapping = (_regs[REG_DIOMAPPING1] >> 6) & 0x03;
+
+    switch (mapping)
+    {
+      case 0:
+        return (flags & SIMIRQ_RXDONE);
+      case 1:
+        return (flags & SIMIRQ_TXDONE);
+      case 2:
+        return (flags & SIMIRQ_CADDONE);
+      default:
+        return false;
+    }
+  }
+
+  if (dio == 1)
+  {
+    mapping = (_regs[REG_DIOMAPPING1] >> 4) & 0x03;
+
+    switch (mapping)
+    {
+      case 0:
+        return (flags & SIMIRQ_RXTIMEOUT);
+      case 2:
+        return (flags & SIMIRQ_CADDETECTED);
+      default:
+        return false;
+    }
+  }
+
+  return false;
+}
+
+
+void SX127XSim::setPathLoss(int16_t dB)
+{
+  std::lock_guard<std::recursive_mutex> guard(_air.lock);
+  _pathLoss = dB;
+}
+
+
+uint8_t SX127XSim::peekRegister(uint8_t address)
+{
+  std::lock_guard<std::recursive_mutex> guard(_air.lock);
+  return _regs[address & 0x7F];
+}
+
+
+void SX127XSim::update(uint64_t now)
+{
+  //advance the device state to now
+
+  uint8_t mode = getMode();
+
+  if ((mode == MODE_TX) && (now >= _txEnduS))
+  {
+    setIrq(SIMIRQ_TXDONE);
+    endMode(_txEnduS);
+    _regs[REG_OPMODE] = (_regs[REG_OPMODE] & 0xF8) | MODE_STDBY;
+    txAirtimeuS += _txPacket->enduS - _txPacket->startuS;
+    _txPacket.reset();
+    packetsSent++;
+  }
+
+  if (_rxPacket && (now >= _rxPacket->enduS))
+  {
+    std::shared_ptr<LTSimPacket> packet = _rxPacket;
+    uint8_t index, rxbase, length;
+
+    _rxPacket.reset();
+
+    if (packet->aborted || _air.collided(*packet))
+    {
+      packetsLost++;
+    }
+    else
+    {
+      rxbase = _regs[REG_FIFORXBASEADDR];
+      length = packet->length;
+
+      if (_regs[REG_MODEMCONFIG1] & 0x01)
+      {
+        length = _regs[REG_PAYLOADLENGTH];           //implicit header, receiver uses its own length
+      }
+
+      for (index = 0; index < length; index++)
+      {
+        _fifo[(uint8_t) (rxbase + index)] = packet->data[index];
+      }
+
+      _regs[REG_FIFORXCURRENTADDR] = rxbase;
+      _regs[REG_FIFORXBYTEADDR] = rxbase + length;
+      _regs[REG_RXNBBYTES] = length;
+
+      if (getFrf() < SIMFRF_779MHZ)
+      {
+        _regs[REG_PKTRSSIVALUE] = constrainRSSI(_rxRSSI + 164);
+      }
+      else
+      {
+        _regs[REG_PKTRSSIVALUE] = constrainRSSI(_rxRSSI + 157);
+      }
+
+      _regs[REG_PKTSNRVALUE] = (uint8_t) ((int8_t) (_rxSNR * 4));
+
+      if (packet->modemconfig2 & 0x04)
+      {
+        _regs[REG_HOPCHANNEL] |= 0x40;               //header says packet has CRC
+      }
+      else
+      {
+        _regs[REG_HOPCHANNEL] &= ~0x40;
+      }
+
+      setIrq(SIMIRQ_RXDONE + SIMIRQ_HEADERVALID);
+      packetsReceived++;
+
+      if (mode == MODE_RXSINGLE)
+      {
+        endMode(packet->enduS);
+        _regs[REG_OPMODE] = (_regs[REG_OPMODE] & 0xF8) | MODE_STDBY;
+      }
+    }
+  }
+
+  if ((mode == MODE_RXSINGLE) && !_rxPacket && (getMode() == MODE_RXSINGLE) && (now >= _rxTimeoutuS))
+  {
+    setIrq(SIMIRQ_RXTIMEOUT);
+    endMode(_rxTimeoutuS);
+    _regs[REG_OPMODE] = (_regs[REG_OPMODE] & 0xF8) | MODE_STDBY;
+  }
+
+  if ((mode == 0x07) && (now >= _cadEnduS))
+  {
+    if (_air.preambleOnAir(this, _cadStartuS, _cadEnduS))
+    {
+      setIrq(SIMIRQ_CADDONE + SIMIRQ_CADDETECTED);
+    }
+    else
+    {
+      setIrq(SIMIRQ_CADDONE);
+    }
+    endMode(_cadEnduS);
+    _regs[REG_OPMODE] = (_regs[REG_OPMODE] & 0xF8) | MODE_STDBY;
+  }
+}
+
+
+void SX127XSim::writeRegister(uint8_t address, uint8_t value, uint64_t now)
+{
+  switch (address)
+  {
+    case REG_FIFO:
+      _fifo[_regs[REG_FIFOADDRPTR]++] = value;
+      break;
+
+    case REG_OPMODE:
+      setOpMode(value, now);
+      break;
+
+    case REG_IRQFLAGS:
+      _regs[REG_IRQFLAGS] &= ~value;                 //writing a 1 clears the flag
+      break;
+
+    case REG_FIFORXCURRENTADDR:
+    case REG_RXNBBYTES:
+    case REG_RXHEADERCNTVALUEMSB:
+    case REG_RXHEADERCNTVALUELSB:
+    case REG_RXPACKETCNTVALUEMSB:
+    case REG_RXPACKETCNTVALUELSB:
+    case REG_MODEMSTAT:
+    case REG_PKTSNRVALUE:
+    case REG_PKTRSSIVALUE:
+    case REG_RSSIVALUE:
+    case REG_HOPCHANNEL:
+    case REG_FIFORXBYTEADDR:
+    case REG_VERSION:
+      break;                                         //read only
+
+    default:
+      _regs[address] = value;
+  }
+}
+
+
+uint8_t SX127XSim::readRegister(uint8_t address, uint64_t now)
+{
+  int16_t rssi;
+
+  switch (address)
+  {
+    case REG_FIFO:
+      return _fifo[_regs[REG_FIFOADDRPTR]++];
+
+    case REG_MODEMSTAT:
+      return _rxPacket ? 0x03 : 0x00;                //signal detected and synchronized while a packet is arriving
+
+    case REG_RSSIVALUE:
+      rssi = _air._noiseFloor;
+
+      if (_air.channelBusy(this, now, now))
+      {
+        rssi = _rxRSSI;
+      }
+
+      if (getFrf() < SIMFRF_779MHZ)
+      {
+        return constrainRSSI(rssi + 164);
+      }
+      return constrainRSSI(rssi + 157);
+
+    default:
+      return _regs[address];
+  }
+}
+
+
+void SX127XSim::setOpMode(uint8_t value, uint64_t now)
+{
+  uint8_t oldmode, newmode;
+
+  oldmode = getMode();
+  endMode(now);
+  _regs[REG_OPMODE] = value;
+  newmode = getMode();
+
+  if (!isLoRa())
+  {
+    _rxPacket.reset();
+    return;
+  }
+
+  if ((oldmode == MODE_TX) && (newmode != MODE_TX) && _txPacket)
+  {
+    _txPacket->aborted = true;                       //TX stopped before the packet was sent
+    _txPacket->enduS = now;
+    _txPacket.reset();
+  }
+
+  if (((oldmode == MODE_RXCONTINUOUS) || (oldmode == MODE_RXSINGLE)) && (newmode != oldmode))
+  {
+    _rxPacket.reset();                               //leaving RX, any packet being received is lost
+  }
+
+  if ((newmode == MODE_TX) && (oldmode != MODE_TX))
+  {
+    std::shared_ptr<LTSimPacket> packet(new LTSimPacket);
+    uint8_t index, txbase;
+
+    txbase = _regs[REG_FIFOTXBASEADDR];
+    packet->length = _regs[REG_PAYLOADLENGTH];
+
+    for (index = 0; index < packet->length; index++)
+    {
+      packet->data[index] = _fifo[(uint8_t) (txbase + index)];
+    }
+
+    packet->frf = getFrf();
+    packet->modemconfig1 = _regs[REG_MODEMCONFIG1];
+    packet->modemconfig2 = _regs[REG_MODEMCONFIG2];
+    packet->syncword = _regs[REG_SYNCWORD];
+    packet->invertIQ = !(_regs[REG_INVERTIQ] & 0x01);
+    packet->txpowerdBm = getTXPower();
+    packet->startuS = now;
+    packet->lockuS = now + (preambleLockSymbols() * symbolTimeuS());
+    packet->preambleEnduS = now + ((preambleLockSymbols() + 4) * symbolTimeuS());
+    packet->enduS = now + airtimeuS(packet->length);
+    packet->aborted = false;
+    packet->source = this;
+
+    _txPacket = packet;
+    _txEnduS = packet->enduS;
+    _air.transmit(this, packet, now);
+  }
+
+  if (((newmode == MODE_RXCONTINUOUS) || (newmode == MODE_RXSINGLE)) && (oldmode != MODE_RXCONTINUOUS) && (oldmode != MODE_RXSINGLE))
+  {
+    _air.listen(this, now);                          //a packet may already be in its preamble
+  }
+
+  if ((newmode == MODE_RXSINGLE) && (oldmode != MODE_RXSINGLE))
+  {
+    uint16_t symbols = ((uint16_t) (_regs[REG_MODEMCONFIG2] & 0x03) << 8) + _regs[REG_SYMBTIMEOUTLSB];
+    _rxTimeoutuS = now + (symbols * symbolTimeuS());
+  }
+
+  if ((newmode == 0x07) && (oldmode != 0x07))
+  {
+    _cadStartuS = now;
+    _cadEnduS = now + (2 * symbolTimeuS());          //CAD takes around 2 symbols
+  }
+}
+
+
+void SX127XSim::endMode(uint64_t at)
+{
+  //the mode in RegOpMode ends at time at, add the time since it started to its total
+
+  if (at > _modeStartuS)
+  {
+    modeTimeuS[getMode()] += at - _modeStartuS;
+    _modeStartuS = at;
+  }
+}
+
+
+uint64_t SX127XSim::readModeTimeuS(uint8_t mode)
+{
+  std::lock_guard<std::recursive_mutex> guard(_air.lock);
+  uint64_t now = LTHALgetClock()->nowMicros();
+
+  update(now);
+  endMode(now);
+  return modeTimeuS[mode & 0x07];
+}
+
+
+void SX127XSim::setIrq(uint8_t flags)
+{
+  _regs[REG_IRQFLAGS] |= (flags & ~_regs[REG_IRQFLAGSMASK]);
+}
+
+
+void SX127XSim::receivePacket(std::shared_ptr<LTSimPacket> packet, uint64_t now)
+{
+  //called by LTSimAir when a transmission starts, decide if this device will receive it
+
+  uint8_t mode, sf;
+  int16_t snrlimit;
+
+  update(now);
+  mode = getMode();
+
+  if (!isLoRa() || ((mode != MODE_RXCONTINUOUS) && (mode != MODE_RXSINGLE)) || _rxPacket || !channelMatches(*packet))
+  {
+    return;
+  }
+
+  sf = packet->modemconfig2 >> 4;
+  snrlimit = -5 - (5 * (sf - 6)) / 2;                //-7.5dB at SF7 to -20dB at SF12, rounded
+
+  _rxRSSI = packet->txpowerdBm - _pathLoss;
+  _rxSNR = (int8_t) constrain(_rxRSSI - _air._noiseFloor, -32, 12);    //packet SNR reported by the device tops out at around +12dB
+
+  if ((_rxSNR < snrlimit) || _air.dropPacket())
+  {
+    packetsLost++;
+    return;
+  }
+
+  _rxPacket = packet;
+}
+
+
+uint8_t SX127XSim::getMode()
+{
+  return _regs[REG_OPMODE] & 0x07;
+}
+
+
+bool SX127XSim::isLoRa()
+{
+  return (_regs[REG_OPMODE] & 0x80);
+}
+
+
+bool SX127XSim::channelMatches(const LTSimPacket &packet)
+{
+  bool rxinvertIQ = (_regs[REG_INVERTIQ] & 0x40);
+
+  return (packet.frf == getFrf()) &&
+         ((packet.modemconfig1 & 0xF0) == (_regs[REG_MODEMCONFIG1] & 0xF0)) &&
+         ((packet.modemconfig2 & 0xF0) == (_regs[REG_MODEMCONFIG2] & 0xF0)) &&
+         (packet.syncword == _regs[REG_SYNCWORD]) &&
+         (packet.invertIQ == rxinvertIQ);
+}
+
+
+uint32_t SX127XSim::getFrf()
+{
+  return ((uint32_t) _regs[REG_FRMSB] << 16) + ((uint32_t) _regs[REG_FRMID] << 8) + _regs[REG_FRLSB];
+}
+
+
+uint64_t SX127XSim::symbolTimeuS()
+{
+  //same calculation as SX127XLT::calcSymbolTime(), 2^SF / bandwidth
+
+  uint8_t bw, sf;
+
+  bw = _regs[REG_MODEMCONFIG1] >> 4;
+  sf = _regs[REG_MODEMCONFIG2] >> 4;
+
+  if (bw > 9)
+  {
+    bw = 9;
+  }
+
+  return (((uint64_t) 1 << sf) * 1000000) / bandwidthTable[bw];
+}
+
+
+uint16_t SX127XSim::preambleLockSymbols()
+{
+  //the demodulator needs around 4 preamble symbols to detect a packet, so a receiver that starts listening
+  //after the transmission has begun still gets the packet if it is in RX before the last 4 symbols
+
+  uint16_t preamble;
+
+  preamble = ((uint16_t) _regs[REG_PREAMBLEMSB] << 8) + _regs[REG_PREAMBLELSB];
+
+  if (preamble < 4)
+  {
+    return 0;
+  }
+
+  return preamble - 4;
+}
+
+
+uint64_t SX127XSim::airtimeuS(uint8_t length)
+{
+  //packet airtime from the SX1276/77/78/79 datasheet, section 4.1.1.7
+
+  uint8_t sf, cr, crc, ih, de;
+  uint16_t preamble;
+  int32_t numerator, denominator, payloadsymbols;
+  uint64_t symboluS;
+
+  sf = _regs[REG_MODEMCONFIG2] >> 4;
+  cr = (_regs[REG_MODEMCONFIG1] >> 1) & 0x07;
+  ih = _regs[REG_MODEMCONFIG1] & 0x01;
+  crc = (_regs[REG_MODEMCONFIG2] >> 2) & 0x01;
+  de = (_regs[REG_MODEMCONFIG3] >> 3) & 0x01;
+  preamble = ((uint16_t) _regs[REG_PREAMBLEMSB] << 8) + _regs[REG_PREAMBLELSB];
+  symboluS = symbolTimeuS();
+
+  numerator = (8 * length) - (4 * sf) + 28 + (16 * crc) - (20 * ih);
+  denominator = 4 * (sf - (2 * de));
+  payloadsymbols = 8;
+
+  if (numerator > 0)
+  {
+    payloadsymbols = payloadsymbols + (((numerator + denominator - 1) / denominator) * (cr + 4));
+  }
+
+  return (((preamble * 4) + 17) * symboluS) / 4 + (payloadsymbols * symboluS);
+}
+
+
+int16_t SX127XSim::getTXPower()
+{
+  uint8_t paconfig, outputpower, maxpower;
+
+  paconfig = _regs[REG_PACONFIG];
+  outputpower = paconfig & 0x0F;
+
+  if (paconfig & 0x80)
+  {
+    if (_regs[REG_PADAC] == 0x87)
+    {
+      return 5 + outputpower;                        //PA_BOOST with high power DAC, 5dBm to 20dBm
+    }
+    return 2 + outputpower;                          //PA_BOOST, 2dBm to 17dBm
+  }
+
+  maxpower = (paconfig >> 4) & 0x07;
+  return ((108 + (6 * maxpower)) / 10) - (15 - outputpower);       //RFO
+}
+
+
+uint8_t SX127XSim::constrainRSSI(int16_t value)
+{
+  return (uint8_t) constrain(value, 0, 255);
+}
+
+
+/***************************************************************************
+  LTSimAir
+***************************************************************************/
+
+LTSimAir::LTSimAir() : _random(1)
+{
+  _packetLoss = 0;
+  _noiseFloor = -120;
+}
+
+
+void LTSimAir::setPacketLoss(float fraction)
+{
+  std::lock_guard<std::recursive_mutex> guard(lock);
+  _packetLoss = fraction;
+}
+
+
+void LTSimAir::setNoiseFloor(int16_t dBm)
+{
+  std::lock_guard<std::recursive_mutex> guard(lock);
+  _noiseFloor = dBm;
+}
+
+
+void LTSimAir::setSeed(uint32_t seed)
+{
+  std::lock_guard<std::recursive_mutex> guard(lock);
+  _random.seed(seed);
+}
+
+
+void LTSimAir::attach(SX127XSim *radio)
+{
+  std::lock_guard<std::recursive_mutex> guard(lock);
+  _radios.push_back(radio);
+}
+
+
+void LTSimAir::transmit(SX127XSim *source, std::shared_ptr<LTSimPacket> packet, uint64_t now)
+{
+  size_t index;
+
+  //forget packets that ended more than 10 seconds ago, they cannot collide with anything now
+  for (index = 0; index < _history.size(); )
+  {
+    if ((_history[index]->enduS + 10000000) < now)
+    {
+      _history.erase(_history.begin() + index);
+    }
+    else
+    {
+      index++;
+    }
+  }
+
+  _history.push_back(packet);
+
+  for (index = 0; index < _radios.size(); index++)
+  {
+    if (_radios[index] != source)
+    {
+      _radios[index]->receivePacket(packet, now);
+    }
+  }
+}
+
+
+void LTSimAir::listen(SX127XSim *radio, uint64_t now)
+{
+  //called when a device enters RX, offer it any packet on the air whose preamble can still be detected
+
+  size_t index;
+
+  for (index = 0; index < _history.size(); index++)
+  {
+    std::shared_ptr<LTSimPacket> packet = _history[index];
+
+    if ((packet->source != radio) && !packet->aborted && (packet->startuS <= now) && (now < packet->lockuS))
+    {
+      radio->receivePacket(packet, now);
+    }
+  }
+}
+
+
+bool LTSimAir::channelBusy(SX127XSim *radio, uint64_t fromuS, uint64_t touS)
+{
+  size_t index;
+
+  for (index = 0; index < _history.size(); index++)
+  {
+    const LTSimPacket &packet = *_history[index];
+
+    if ((packet.source != radio) && (packet.startuS <= touS) && (packet.enduS >= fromuS) && radio->channelMatches(packet))
+    {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+
+bool LTSimAir::preambleOnAir(SX127XSim *radio, uint64_t fromuS, uint64_t touS)
+{
+  //true if the preamble of a packet another device is sending overlaps fromuS to touS, as seen by a CAD
+
+  size_t index;
+
+  for (index = 0; index < _history.size(); index++)
+  {
+    const LTSimPacket &packet = *_history[index];
+
+    if ((packet.source != radio) && !packet.aborted && (packet.startuS <= touS) && (packet.preambleEnduS >= fromuS) && radio->channelMatches(packet))
+    {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+
+bool LTSimAir::collided(const LTSimPacket &packet)
+{
+  size_t index;
+
+  for (index = 0; index < _history.size(); index++)
+  {
+    const LTSimPacket &other = *_history[index];
+
+    if ((&other != &packet) && (other.frf == packet.frf) && (other.startuS < packet.enduS) && (other.enduS > packet.startuS))
+    {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+
+bool LTSimAir::dropPacket()
+{
+  if (_packetLoss <= 0)
+  {
+    return false;
+  }
+
+  return (std::uniform_real_distribution<float>(0, 1)(_random) < _packetLoss);
+}
+
+
+/***************************************************************************
+  LTSimBoard
+***************************************************************************/
+
+LTSimBoard::LTSimBoard()
+{
+  _selected = NULL;
+  memset(_pins, LOW, sizeof(_pins));
+  memset(_interrupts, 0, sizeof(_interrupts));
+  _interruptRun = false;
+}
+
+
+LTSimBoard::~LTSimBoard()
+{
+  _interruptRun = false;
+
+  if (_interruptThread.joinable())
+  {
+    _interruptThread.join();
+  }
+}
+
+
+void LTSimBoard::attach(SX127XSim &radio, int8_t pinNSS, int8_t pinNRESET, int8_t pinDIO0, int8_t pinDIO1, int8_t pinDIO2)
+{
+  LTSimWiring wiring;
+
+  wiring.radio = &radio;
+  wiring.NSS = pinNSS;
+  wiring.NRESET = pinNRESET;
+  wiring.DIO[0] = pinDIO0;
+  wiring.DIO[1] = pinDIO1;
+  wiring.DIO[2] = pinDIO2;
+  _wiring.push_back(wiring);
+
+  if (pinNSS >= 0)
+  {
+    _pins[(uint8_t) pinNSS] = HIGH;
+  }
+
+  if (pinNRESET >= 0)
+  {
+    _pins[(uint8_t) pinNRESET] = HIGH;
+  }
+}
+
+
+uint8_t LTSimBoard::transfer(uint8_t data)
+{
+  if (_selected == NULL)
+  {
+    return 0xFF;
+  }
+
+  return _selected->transfer(data);
+}
+
+
+void LTSimBoard::transferBytes(const uint8_t *data, uint8_t *out, uint32_t size)
+{
+  if (_selected == NULL)
+  {
+    if (out)
+    {
+      memset(out, 0xFF, size);
+    }
+
+    return;
+  }
+
+  _selected->transferBytes(data, out, size);
+}
+
+
+void LTSimBoard::pinMode(uint8_t pin, uint8_t mode)
+{
+  (void) pin;
+  (void) mode;
+}
+
+
+void LTSimBoard::digitalWrite(uint8_t pin, uint8_t level)
+{
+  size_t index;
+  uint8_t previous = _pins[pin];
+
+  _pins[pin] = level;
+
+  for (index = 0; index < _wiring.size(); index++)
+  {
+    LTSimWiring &wiring = _wiring[index];
+
+    if (wiring.NSS == (int8_t) pin)
+    {
+      wiring.radio->select(level == LOW);
+      _selected = (level == LOW) ? wiring.radio : NULL;
+    }
+
+    if ((wiring.NRESET == (int8_t) pin) && (previous == LOW) && (level == HIGH))
+    {
+      wiring.radio->reset();                         //device resets on release of NRESET
+    }
+  }
+}
+
+
+int LTSimBoard::digitalRead(uint8_t pin)
+{
+  size_t index;
+  uint8_t dio;
+
+  for (index = 0; index < _wiring.size(); index++)
+  {
+    for (dio = 0; dio < 3; dio++)
+    {
+      if (_wiring[index].DIO[dio] == (int8_t) pin)
+      {
+        return _wiring[index].radio->readDIO(dio) ? HIGH : LOW;
+      }
+    }
+  }
+
+  return _pins[pin];
+}
+
+
+void LTSimBoard::attachInterrupt(uint8_t pin, void (*isr)(), int mode)
+{
+  int level = digitalRead(pin);
+  std::lock_guard<std::mutex> guard(_interruptLock);
+
+  _interrupts[pin].isr = isr;
+  _interrupts[pin].mode = mode;
+  _interrupts[pin].level = level;
+
+  if (!_interruptRun)
+  {
+    _interruptRun = true;
+    _interruptThread = std::thread(&LTSimBoard::watchInterrupts, this);
+  }
+}
+
+
+void LTSimBoard::detachInterrupt(uint8_t pin)
+{
+  std::lock_guard<std::mutex> guard(_interruptLock);
+
+  _interrupts[pin].isr = NULL;
+}
+
+
+void LTSimBoard::watchInterrupts()
+{
+  //reads the pins with a handler every 20uS of real time, reading a DIO pin advances the device model so
+  //a packet or TX done raises the pin when it would on the real device. The handlers run on this thread,
+  //so like an interrupt they run alongside the sketch and should only signal it.
+
+  std::vector<void (*)()> pending;
+  uint16_t pin;
+  int level;
+  bool edge;
+
+  while (_interruptRun)
+  {
+    pending.clear();
+
+    {
+      std::lock_guard<std::mutex> guard(_interruptLock);
+
+      for (pin = 0; pin < 256; pin++)
+      {
+        LTSimInterrupt &interrupt = _interrupts[pin];
+
+        if (interrupt.isr == NULL)
+        {
+          continue;
+        }
+
+        level = digitalRead(pin);
+        edge = (level != interrupt.level);
+        interrupt.level = level;
+
+        if (edge && ((interrupt.mode == CHANGE) || ((interrupt.mode == RISING) && level) || ((interrupt.mode == FALLING) && !level)))
+        {
+          pending.push_back(interrupt.isr);
+        }
+      }
+    }
+
+    for (void (*isr)() : pending)
+    {
+      isr();
+    }
+
+    std::this_thread::sleep_for(std::chrono::microseconds(20));
+  }
+}
@@ -0,0 +1,202 @@
+/*
+  Licensed under a MIT license, see LICENSE.txt in the library src folder.
+  Original published 16/10/26
+*/
+
+/*******************************************************************************************************
+  In process model of an SX1278 in LoRa mode, for running the SX127XLT driver on a Linux host.
+
+  SX127XSim    - register file and 256 byte FIFO, SPI single and burst access with address auto increment,
+                 LoRa TX, RX continuous, RX single with symbol timeout, and CAD. The time spent in each mode is kept, for energy
+                 estimates. IRQ flags and the DIO0/DIO1
+                 pins follow RegIrqFlags, RegIrqFlagsMask and RegDioMapping1 as on the real device.
+  LTSimAir     - the radio channel shared by all simulated devices. A packet is delivered to every device
+                 that is in RX on the same frequency, spreading factor, bandwidth and sync word when the
+                 transmission started, or that enters RX early enough in the preamble to detect it, after
+                 the packet airtime has elapsed. Overlapping packets collide.
+  LTSimBoard   - one node, implements the LTHALSPI and LTHALGPIO interfaces and wires an SX127XSim to the
+                 NSS, NRESET and DIO pins the sketch passes to begin(). attachInterrupt() starts a thread
+                 that watches the pins and calls the handler on the edge, as the interrupt would.
+
+  Airtime uses the same symbol time as SX127XLT::calcSymbolTime() and the packet length formula from the
+  SX1276/77/78/79 datasheet. Packet RSSI is the transmit power less the path loss set for the receiving
+  device, packet SNR is RSSI less the noise floor, packets below the demodulator SNR limit for the
+  spreading factor are not received and a configurable fraction of packets is dropped at random.
+
+  Time is taken from the LTHAL clock and the model is advanced lazily, whenever a device is accessed over
+  SPI or a DIO pin is read, so the drivers own polling loops drive the simulation.
+*******************************************************************************************************/
+
+#ifndef SX127XSim_h
+#define SX127XSim_h
+
+#include <Arduino.h>
+#include <SX127XLT.h>                   //for the register definitions, SX127XLT_Definitions.h has no include guard
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+class LTSimAir;
+
+
+struct LTSimPacket
+{
+  uint8_t data[256];
+  uint8_t length;
+  uint32_t frf;                    //frequency register value, RegFrfMsb, RegFrfMid, RegFrfLsb
+  uint8_t modemconfig1;            //bandwidth, coding rate and header mode
+  uint8_t modemconfig2;            //spreading factor and CRC on
+  uint8_t syncword;
+  bool invertIQ;
+  int16_t txpowerdBm;
+  uint64_t startuS;
+  uint64_t lockuS;                 //a receiver entering RX before this time can still detect the preamble
+  uint64_t preambleEnduS;          //end of the preamble, CAD only detects the preamble
+  uint64_t enduS;
+  bool aborted;
+  const void *source;
+};
+
+
+class SX127XSim
+{
+  public:
+    SX127XSim(LTSimAir &air);
+
+    void reset();
+    void select(bool active);                        //NSS low starts an SPI access, high ends it
+    uint8_t transfer(uint8_t data);
+    void transferBytes(const uint8_t *data, uint8_t *out, uint32_t size);   //FIFO bursts copied as a block
+    bool readDIO(uint8_t dio);
+
+    void setPathLoss(int16_t dB);                    //path loss from any transmitter to this device
+    uint8_t peekRegister(uint8_t address);          //read a register without side effects
+
+    uint32_t packetsSent;
+    uint32_t packetsReceived;
+    uint32_t packetsLost;                           //dropped at random, collided or below sensitivity
+    uint32_t spiTransactions;                       //NSS low to high accesses seen by the device
+    uint64_t txAirtimeuS;                           //total airtime of the packets sent
+    uint64_t modeTimeuS[8];                         //time spent in each RegOpMode mode, sleep to CAD
+
+    uint64_t readModeTimeuS(uint8_t mode);          //modeTimeuS[mode] brought up to now
+
+  private:
+    friend class LTSimAir;
+
+    void update(uint64_t now);
+    void writeRegister(uint8_t address, uint8_t value, uint64_t now);
+    uint8_t readRegister(uint8_t address, uint64_t now);
+    void setOpMode(uint8_t value, uint64_t now);
+    void setIrq(uint8_t flags);
+    void endMode(uint64_t at);
+    void receivePacket(std::shared_ptr<LTSimPacket> packet, uint64_t now);
+    uint8_t getMode();
+    bool isLoRa();
+    bool channelMatches(const LTSimPacket &packet);
+    uint32_t getFrf();
+    uint64_t symbolTimeuS();
+    uint64_t airtimeuS(uint8_t length);
+    uint16_t preambleLockSymbols();
+    int16_t getTXPower();
+    uint8_t constrainRSSI(int16_t value);
+
+    LTSimAir &_air;
+    uint8_t _regs[128];
+    uint8_t _fifo[256];
+    bool _selected;
+    bool _addressPhase;
+    bool _writing;
+    uint8_t _address;
+
+    uint64_t _txEnduS;
+    uint64_t _rxTimeoutuS;
+    uint64_t _cadEnduS;
+    uint64_t _cadStartuS;
+    uint64_t _modeStartuS;
+    std::shared_ptr<LTSimPacket> _txPacket;
+    std::shared_ptr<LTSimPacket> _rxPacket;          //packet being received, delivered at its end time
+    int16_t _pathLoss;
+    int16_t _rxRSSI;
+    int8_t _rxSNR;
+};
+
+
+class LTSimAir
+{
+  public:
+    LTSimAir();
+
+    void setPacketLoss(float fraction);              //fraction of packets dropped at random, 0 to 1
+    void setNoiseFloor(int16_t dBm);
+    void setSeed(uint32_t seed);
+
+    std::recursive_mutex lock;                       //held for every device access
+
+  private:
+    friend class SX127XSim;
+
+    void attach(SX127XSim *radio);
+    void transmit(SX127XSim *source, std::shared_ptr<LTSimPacket> packet, uint64_t now);
+    void listen(SX127XSim *radio, uint64_t now);
+    bool channelBusy(SX127XSim *radio, uint64_t fromuS, uint64_t touS);
+    bool preambleOnAir(SX127XSim *radio, uint64_t fromuS, uint64_t touS);
+    bool collided(const LTSimPacket &packet);
+    bool dropPacket();
+
+    std::vector<SX127XSim *> _radios;
+    std::vector<std::shared_ptr<LTSimPacket>> _history;
+    float _packetLoss;
+    int16_t _noiseFloor;
+    std::mt19937 _random;
+};
+
+
+class LTSimBoard : public LTHALSPI, public LTHALGPIO
+{
+  public:
+    LTSimBoard();
+    ~LTSimBoard();
+
+    void attach(SX127XSim &radio, int8_t pinNSS, int8_t pinNRESET, int8_t pinDIO0, int8_t pinDIO1 = -1, int8_t pinDIO2 = -1);
+
+    uint8_t transfer(uint8_t data);
+    void transferBytes(const uint8_t *data, uint8_t *out, uint32_t size);
+    void pinMode(uint8_t pin, uint8_t mode);
+    void digitalWrite(uint8_t pin, uint8_t level);
+    int digitalRead(uint8_t pin);
+    void attachInterrupt(uint8_t pin, void (*isr)(), int mode);
+    void detachInterrupt(uint8_t pin);
+
+  private:
+    struct LTSimWiring
+    {
+      SX127XSim *radio;
+      int8_t NSS;
+      int8_t NRESET;
+      int8_t DIO[3];
+    };
+
+    struct LTSimInterrupt
+    {
+      void (*isr)();
+      int mode;
+      int level;
+    };
+
+    void watchInterrupts();
+
+    std::vector<LTSimWiring> _wiring;
+    SX127XSim *_selected;
+    uint8_t _pins[256];
+    std::mutex _interruptLock;
+    LTSimInterrupt _interrupts[256];
+    std::thread _interruptThread;
+    std::atomic<bool> _interruptRun;
+};
+
+#endif
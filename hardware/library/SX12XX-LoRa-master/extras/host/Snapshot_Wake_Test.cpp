@@ -0,0 +1,244 @@
+/*
+  Licensed under a MIT license, see LICENSE.txt in the library src folder.
+  Original published 16/10/26
+*/
+
+/*******************************************************************************************************
+  Program Operation - Checks saveSnapshot() and beginFromSnapshot() of SX127XLT on a simulated SX1278.
+  The processor sleeping is a new SX127XLT, the device is set to sleep mode and keeps its registers;
+
+  Wake      - the device set up with setupLoRa() and the snapshot saved, a new SX127XLT must come up
+              from the snapshot with the device registers as they were, the same frequency, settings and
+              time on air, its register shadow copies matching the device and a packet sent. The time and
+              SPI transactions of begin() and setupLoRa() against beginFromSnapshot() are printed
+  Changed   - the device set up for another spreading factor, or another frequency, after the snapshot
+              was saved, beginFromSnapshot() must write back the registers of the snapshot, for another
+              frequency with the image calibration run again
+  Reset     - the device reset while the processor slept, beginFromSnapshot() must return false and
+              leave the device as it came out of reset
+  Invalid   - a snapshot never saved, one with a byte changed and one for another device type must be
+              refused without an SPI transaction
+
+  The program returns 1 if a check fails.
+
+  Build from the library folder, see extras/host/README.md;
+  g++ -std=c++17 -O2 -pthread -Iextras/host -Isrc extras/host/LTHAL.cpp extras/host/SX127XSim.cpp
+      extras/host/Snapshot_Wake_Test.cpp src/SX127XLT.cpp -o Snapshot_Wake_Test
+*******************************************************************************************************/
+
+#include <SPI.h>
+#include <SX127XLT.h>
+#include <SX127XSim.h>
+
+#include <stdio.h>
+
+#define NSS 7                                //slave_esp32_mini pins
+#define NRESET 3
+#define DIO0 2
+
+#define LORA_DEVICE DEVICE_SX1278
+const uint32_t Frequency = 434000000;
+const int32_t Offset = -25000;
+
+LTSimAir air;
+SX127XSim radio(air);
+uint32_t failures = 0;
+
+
+void check(bool ok, const char *test, const char *what)
+{
+  if (!ok)
+  {
+    failures++;
+    printf("FAIL %s: %s\n", test, what);
+  }
+}
+
+
+struct Setup
+{
+  uint8_t registers[REGCACHE_SIZE];
+  uint32_t frequency;
+  uint32_t airtimeuS;
+  uint8_t sf, cr, ldro;
+  bool cacheMatches;
+};
+
+
+void readSetup(SX127XLT &LT, Setup &setup)
+{
+  //the device registers, and what the driver reports, where it can from its shadow copies. A read of
+  //REG_FIFO would move the FIFO pointer
+
+  setup.cacheMatches = true;
+  setup.registers[REG_FIFO] = 0;
+
+  for (uint8_t address = REG_OPMODE; address < REGCACHE_SIZE; address++)
+  {
+    setup.registers[address] = radio.peekRegister(address);
+
+    if ((address != REG_IRQFLAGS) && (address != REG_RSSIVALUE) && (LT.readRegister(address) != setup.registers[address]))
+    {
+      setup.cacheMatches = false;
+    }
+  }
+
+  setup.registers[REG_IRQFLAGS] = 0;
+  setup.registers[REG_RSSIVALUE] = 0;
+  setup.frequency = LT.getFreqInt();
+  setup.airtimeuS = LT.getTimeOnAiruS(20);
+  setup.sf = LT.getLoRaSF();
+  setup.cr = LT.getLoRaCodingRate();
+  setup.ldro = LT.getOptimisation();
+}
+
+
+bool sameSetup(const Setup &first, const Setup &second)
+{
+  return (memcmp(first.registers, second.registers, REGCACHE_SIZE) == 0) && (first.frequency == second.frequency) &&
+         (first.airtimeuS == second.airtimeuS) && (first.sf == second.sf) && (first.cr == second.cr) && (first.ldro == second.ldro);
+}
+
+
+void coldStart(SX127XLT &LT, uint8_t sf, uint32_t frequency)
+{
+  if (!LT.begin(NSS, NRESET, DIO0, LORA_DEVICE))
+  {
+    printf("No LoRa device responding\n");
+    exit(1);
+  }
+
+  LT.setupLoRa(frequency, Offset, sf, LORA_BW_125, LORA_CR_4_5, LDRO_AUTO);
+}
+
+
+void testWake(LTSX127XSnapshot &snapshot)
+{
+  SX127XLT LT;
+  Setup before, after;
+  uint64_t startuS, coldmS, wakeuS;
+  uint32_t coldTransactions, wakeTransactions, sent;
+
+  startuS = micros();
+  coldStart(LT, LORA_SF9, Frequency);
+  coldmS = (micros() - startuS) / 1000;
+  coldTransactions = LT.getSPITransactions();
+
+  LT.saveSnapshot(snapshot);
+  readSetup(LT, before);
+  LT.setSleep(CONFIGURATION_RETENTION);
+
+  SX127XLT woken;                            //the driver after the processor slept
+
+  startuS = micros();
+  check(woken.beginFromSnapshot(NSS, NRESET, DIO0, LORA_DEVICE, snapshot), "Wake", "beginFromSnapshot() failed");
+  wakeuS = micros() - startuS;
+  wakeTransactions = woken.getSPITransactions();
+
+  check((radio.peekRegister(REG_OPMODE) & 0x87) == (PACKET_TYPE_LORA + MODE_STDBY_RC), "Wake", "device not in LoRa standby");
+  readSetup(woken, after);
+  check(sameSetup(before, after), "Wake", "registers or settings differ from those before the sleep");
+  check(after.cacheMatches, "Wake", "shadow copies differ from the device");
+  check(wakeTransactions == 2, "Wake", "SPI transactions other than the register read and standby");
+
+  sent = radio.packetsSent;
+  check(woken.transmit((uint8_t *) "Wake", 4, 1000, 2, WAIT_TX) == 4, "Wake", "transmit() failed");
+  check(radio.packetsSent == (sent + 1), "Wake", "no packet sent");
+
+  printf("Wake       begin() and setupLoRa() %umS, %u SPI transactions, beginFromSnapshot() %uuS, %u SPI transactions\n",
+         (uint32_t) coldmS, coldTransactions, (uint32_t) wakeuS, wakeTransactions);
+}
+
+
+void testChanged(const LTSX127XSnapshot &snapshot, uint8_t sf, uint32_t frequency, const char *test)
+{
+  SX127XLT LT, woken;
+  Setup expected, after;
+  uint32_t transactions;
+
+  coldStart(LT, LORA_SF9, Frequency);
+  readSetup(LT, expected);
+
+  LT.setupLoRa(frequency, Offset, sf, LORA_BW_125, LORA_CR_4_5, LDRO_AUTO);
+  LT.setSleep(CONFIGURATION_RETENTION);
+
+  check(woken.beginFromSnapshot(NSS, NRESET, DIO0, LORA_DEVICE, snapshot), test, "beginFromSnapshot() failed");
+  transactions = woken.getSPITransactions();
+  readSetup(woken, after);
+  check(sameSetup(expected, after), test, "registers or settings differ from the snapshot");
+  check(after.cacheMatches, test, "shadow copies differ from the device");
+  check((frequency == Frequency) == (transactions == 4), test, "SPI transactions other than the read, the write back, its check and standby");
+  printf("%-10s device set up at SF%u %uHz after the snapshot, %u SPI transactions to put it back\n", test, sf, frequency, transactions);
+}
+
+
+void testReset(const LTSX127XSnapshot &snapshot)
+{
+  SX127XLT LT;
+  uint8_t registers[REGCACHE_SIZE];
+  uint32_t transactions;
+  bool same = true;
+
+  radio.reset();                             //power lost while the processor slept
+
+  for (uint8_t address = 0; address < REGCACHE_SIZE; address++)
+  {
+    registers[address] = radio.peekRegister(address);
+  }
+
+  transactions = radio.spiTransactions;
+  check(!LT.beginFromSnapshot(NSS, NRESET, DIO0, LORA_DEVICE, snapshot), "Reset", "beginFromSnapshot() accepted a reset device");
+  check(radio.spiTransactions == (transactions + 1), "Reset", "SPI transactions other than the register read");
+
+  for (uint8_t address = 0; address < REGCACHE_SIZE; address++)
+  {
+    same = same && (radio.peekRegister(address) == registers[address]);
+  }
+
+  check(same, "Reset", "device registers changed");
+  printf("Reset      device reset while the processor slept, refused after 1 SPI transaction\n");
+}
+
+
+void testInvalid(const LTSX127XSnapshot &snapshot)
+{
+  LTSX127XSnapshot changed;
+  SX127XLT LT;
+  uint32_t transactions;
+
+  coldStart(LT, LORA_SF9, Frequency);
+  LT.setSleep(CONFIGURATION_RETENTION);
+  transactions = radio.spiTransactions;
+
+  memset(&changed, 0, sizeof(changed));
+  check(!LT.beginFromSnapshot(NSS, NRESET, DIO0, LORA_DEVICE, changed), "Invalid", "snapshot never saved accepted");
+
+  changed = snapshot;
+  changed.registers[REG_MODEMCONFIG2] ^= 0x10;
+  check(!LT.beginFromSnapshot(NSS, NRESET, DIO0, LORA_DEVICE, changed), "Invalid", "changed snapshot accepted");
+
+  check(!LT.beginFromSnapshot(NSS, NRESET, DIO0, DEVICE_SX1276, snapshot), "Invalid", "snapshot of another device type accepted");
+  check(radio.spiTransactions == transactions, "Invalid", "device accessed");
+  printf("Invalid    snapshots never saved, changed or of another device type refused\n");
+}
+
+
+int main()
+{
+  LTHostClock clock;
+  LTSimBoard board;
+  LTSX127XSnapshot snapshot;
+
+  LTHALsetClock(&clock);
+  board.attach(radio, NSS, NRESET, DIO0);
+  LTHALbind(&board, &board);
+
+  testWake(snapshot);
+  testChanged(snapshot, LORA_SF12, Frequency, "Changed");
+  testChanged(snapshot, LORA_SF9, 868100000, "Changed");
+  testReset(snapshot);
+  testInvalid(snapshot);
+
+  printf("%s, %u failures\n", failures ? "FAILED" : "PASSED", failures);
+  return failures ? 1 : 0;
+}
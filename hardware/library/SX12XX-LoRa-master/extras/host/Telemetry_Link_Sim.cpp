@@ -0,0 +1,353 @@
+/*
+  Licensed under a MIT license, see LICENSE.txt in the library src folder.
+  Original published 16/10/26
+*/
+
+/*******************************************************************************************************
+  Program Operation - Checks the LTTelemetry.h frame and the ACK that carries the link back, with the
+  non blocking reliable functions the API_config master and the slave firmware use. The master sends a
+  telemetry frame to the slave at a range of path losses, the path loss to the master 5dB more than to the
+  slave so the two directions differ. The slave decodes each frame with LTTelemetry::read() and keeps the
+  RSSI and SNR it received it at, its ACK carries them back with ReliableACKLink set. The frames sent
+  alternate between the LTSchema2S and LTSchema3S feature schemas of LTFeatures.h.
+
+  For each path loss the frames decoded, the RSSI and SNR both ways and the airtime of the exchange are
+  printed, against the "SIESPRO" probe with a plain ACK it replaces. Then a master without ReliableACKLink,
+  as ACK_config and IA_config, sends to the same slave with the blocking transmitReliableAutoACK(), its
+  packets must still be acknowledged. The program returns 1 if a frame decodes wrong, the RSSI or SNR in
+  an ACK differs from what the slave measured, or the master without ReliableACKLink gets no ACKs.
+
+  Before the link runs, a frame of each schema is built and read back without the radio, then one of a
+  schema this build does not know, one a byte short and readings out of range, the program also returns
+  1 if one of those is read wrong.
+
+  Usage: Telemetry_Link_Sim [packets] [time scale]
+
+  Build from the library folder, see extras/host/README.md;
+  g++ -std=c++17 -O2 -pthread -Iextras/host -Isrc extras/host/LTHAL.cpp extras/host/SX127XSim.cpp
+      extras/host/Telemetry_Link_Sim.cpp src/SX127XLT.cpp -o Telemetry_Link_Sim
+*******************************************************************************************************/
+
+#include <SPI.h>
+#include <SX127XLT.h>
+#include <SX127XSim.h>
+#include <LTTelemetry.h>
+#include <LTAirtime.h>
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <stdio.h>
+
+#define NSS 5                                //master_esp32 pins
+#define NRESET 14
+#define DIO0 2
+#define SLAVE_NSS 7                          //slave_esp32_mini pins
+#define SLAVE_NRESET 3
+#define SLAVE_DIO0 2
+
+#define LORA_DEVICE DEVICE_SX1278
+const uint32_t Frequency = 434000000;
+const uint16_t NetworkID = 0x3210;
+const uint8_t TXattempts = 3;
+const uint32_t ACKdelay = 100;
+const uint32_t RXtimeout = 1000;             //short so the slave sees the end of the run
+const int8_t MasterTXpower = 10;
+const int8_t SlaveTXpower = 2;
+const int16_t DownlinkExtradB = 5;           //path loss to the master over that to the slave
+
+std::atomic<bool> slaveRun;
+std::mutex slaveLock;
+
+struct LTSlaveResult                         //last frame the slave received, under slaveLock
+{
+  uint32_t frames;
+  LTTelemetryFrame frame;
+  int16_t rssi;
+  int8_t snr;
+};
+
+LTSlaveResult slaveResult;
+
+
+void setupNode(SX127XLT &LT, LTSimBoard &board, SX127XSim &radio, int8_t nss, int8_t nreset, int8_t dio0)
+{
+  board.attach(radio, nss, nreset, dio0);
+  LTHALbind(&board, &board);
+
+  if (!LT.begin(nss, nreset, dio0, LORA_DEVICE))
+  {
+    Serial.println(F("No LoRa device responding"));
+    exit(1);
+  }
+
+  LT.setupLoRa(Frequency, 0, LORA_SF7, LORA_BW_125, LORA_CR_4_5, LDRO_AUTO);
+}
+
+
+void slaveNode(SX127XSim *radio)
+{
+  SX127XLT LT;
+  LTSimBoard board;
+  LTTelemetryFrame frame;
+  uint8_t RXBUFFER[251];
+
+  setupNode(LT, board, *radio, SLAVE_NSS, SLAVE_NRESET, SLAVE_DIO0);
+  LT.setReliableConfig(ReliableACKLink);
+
+  while (slaveRun)
+  {
+    LT.startReceiveReliableAutoACK(RXBUFFER, sizeof(RXBUFFER), NetworkID, ACKdelay, SlaveTXpower, RXtimeout);
+
+    while (LT.pollReliable() < ReliableDone)
+    {
+      delay(1);
+    }
+
+    if ((LT.getReliableState() == ReliableDone) && LTTelemetry::read(RXBUFFER, LT.readRXPacketL() - 4, frame))
+    {
+      std::lock_guard<std::mutex> lock(slaveLock);
+      slaveResult.frames++;
+      slaveResult.frame = frame;
+      slaveResult.rssi = LT.readPacketRSSI();
+      slaveResult.snr = LT.readPacketSNR();
+    }
+  }
+}
+
+
+bool sameFrame(const LTTelemetryFrame &a, const LTTelemetryFrame &b)
+{
+  uint8_t id;
+
+  if ((a.schema != b.schema) || (a.node != b.node) || (a.sequence != b.sequence) || (a.battery != b.battery) ||
+      (a.txpower != b.txpower))
+  {
+    return false;
+  }
+
+  for (id = 1; id <= LTFeatureCount; id++)
+  {
+    if (a.values[id - 1] != b.values[id - 1])
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+
+void fillFrame(LTTelemetryFrame &frame, uint32_t index)
+{
+  //sample index of the run, 3S on even samples with the soil not read on every other one, 2S on odd
+  uint8_t schema = (index & 1) ? LTSchema2S : LTSchema3S;
+
+  LTTelemetry::clear(frame, schema);
+  frame.node = NetworkID;
+  frame.sequence = index;
+  frame.battery = 3700 - index;
+  frame.txpower = MasterTXpower;
+  LTTelemetry::setReading(frame, LTFeatureTemperature, 18.5 + (index * 0.37));
+  LTTelemetry::setReading(frame, LTFeatureHumidity, 40 + index);
+
+  if (LTSchemaHas(schema, LTFeatureSoil) && (index & 2))
+  {
+    LTTelemetry::setReading(frame, LTFeatureSoil, index % 100);
+  }
+}
+
+
+uint32_t checkFrames()
+{
+  //returns the number of frames read back wrong, built and read without the radio
+  LTTelemetryFrame frame, back;
+  uint8_t buff[LTTelemetryMaxL], length = 0, schema;
+  uint32_t errors = 0;
+
+  for (schema = 1; schema <= LTSchemaCount; schema++)
+  {
+    fillFrame(frame, 2);
+    frame.schema = schema;
+    LTTelemetry::setReading(frame, LTFeatureSoil, LTSchemaHas(schema, LTFeatureSoil) ? 55 : NAN);
+    length = LTTelemetry::build(buff, frame);
+
+    if ((length != LTTelemetryLength(schema)) || !LTTelemetry::read(buff, length, back) || !sameFrame(frame, back))
+    {
+      printf("Schema %u frame of %u bytes read back wrong\n", schema, length);
+      errors++;
+    }
+
+    if (LTTelemetry::read(buff, length - 1, back))
+    {
+      printf("Schema %u frame a byte short read\n", schema);
+      errors++;
+    }
+  }
+
+  buff[1] = LTSchemaCount + 1;                //a schema of a later build
+
+  if (!LTTelemetry::read(buff, length, back) || (back.node != frame.node) || (back.sequence != frame.sequence) ||
+      !isnan(LTTelemetry::getReading(back, LTFeatureTemperature)))
+  {
+    printf("Frame of an unknown schema read wrong\n");
+    errors++;
+  }
+
+  if ((LTTelemetry::toFixed(LTFeatureHumidity, 127.4) != LTFeatureNoReading(LTFeatureHumidity)) ||
+      (LTTelemetry::toFixed(LTFeatureHumidity, 99.8) != 200) ||
+      (LTTelemetry::toFixed(LTFeatureTemperature, -400) != LTFeatureNoReading(LTFeatureTemperature)) ||
+      (LTTelemetry::toFixed(LTFeatureTemperature, -12.34) != -1234))
+  {
+    printf("Readings scaled wrong\n");
+    errors++;
+  }
+
+  return errors;
+}
+
+
+uint32_t runLink(int16_t pathloss, uint32_t packets, bool linkACK)
+{
+  //returns the number of errors, frames decoded wrong or ACKs with the wrong RSSI and SNR
+  LTSimAir air;
+  SX127XSim masterRadio(air), slaveRadio(air);
+  SX127XLT LT;
+  LTSimBoard board;
+  LTTelemetryFrame frame;
+  LTSlaveResult result;
+  uint8_t buff[LTTelemetryMaxL], state, length;
+  uint32_t index, wait, frames, acked = 0, errors = 0, exchangeuS, probeuS;
+  int32_t upRSSI = 0, upSNR = 0, downRSSI = 0, downSNR = 0;
+
+  slaveRadio.setPathLoss(pathloss);
+  masterRadio.setPathLoss(pathloss + DownlinkExtradB);
+  setupNode(LT, board, masterRadio, NSS, NRESET, DIO0);
+
+  if (linkACK)
+  {
+    LT.setReliableConfig(ReliableACKLink);
+  }
+
+  slaveResult = {};
+  slaveRun = true;
+  std::thread slave(slaveNode, &slaveRadio);
+  delay(200);                                //the slave set up and in RX
+
+  for (index = 0; index < packets; index++)
+  {
+    fillFrame(frame, index);
+    length = LTTelemetry::build(buff, frame);
+    frames = slaveResult.frames;
+
+    if (linkACK)
+    {
+      LT.startTransmitReliableAutoACK(buff, length, NetworkID, LTAirtimeACKTimeoutmS(ACKdelay, LT.getTimeOnAiruS(ReliableACKLinkL)),
+                                      LTAirtimeTXTimeoutmS(LT.getTimeOnAiruS(length + 4)), MasterTXpower, TXattempts);
+
+      do
+      {
+        delay(1);
+        state = LT.pollReliable();
+      } while (state < ReliableDone);
+
+      LT.cancelReliable();
+    }
+    else
+    {
+      state = LT.transmitReliableAutoACK(buff, length, NetworkID, LTAirtimeACKTimeoutmS(ACKdelay, LT.getTimeOnAiruS(ReliableACKLinkL)),
+                                         LTAirtimeTXTimeoutmS(LT.getTimeOnAiruS(length + 4)), MasterTXpower, WAIT_TX) ? ReliableDone : ReliableFailed;
+    }
+
+    if (state != ReliableDone)
+    {
+      continue;
+    }
+
+    acked++;
+
+    for (wait = 0; wait < 100; wait++)       //the slave sees its ACK go a poll after the master gets it
+    {
+      slaveLock.lock();
+      result = slaveResult;
+      slaveLock.unlock();
+
+      if (result.frames != frames)
+      {
+        break;
+      }
+
+      delay(1);
+    }
+
+    if (!sameFrame(result.frame, frame))
+    {
+      errors++;                              //not the frame sent
+    }
+
+    if (linkACK && ((LT.readReliableACKRSSI() != result.rssi) || (LT.readReliableACKSNR() != result.snr)))
+    {
+      errors++;                              //ACK does not carry what the slave measured
+    }
+
+    if (!linkACK && (LT.readReliableACKRSSI() || LT.readReliableACKSNR()))
+    {
+      errors++;                              //link read from an ACK without ReliableACKLink set
+    }
+
+    upRSSI += LT.readReliableACKRSSI();
+    upSNR += LT.readReliableACKSNR();
+    downRSSI += LT.readPacketRSSI();
+    downSNR += LT.readPacketSNR();
+  }
+
+  slaveRun = false;
+  slave.join();
+
+  exchangeuS = LT.getTimeOnAiruS(LTTelemetryLength(LTSchema2S) + 4) + LT.getTimeOnAiruS(ReliableACKLinkL);
+  probeuS = LT.getTimeOnAiruS(sizeof("SIESPRO") + 4) + LT.getTimeOnAiruS(4);
+
+  if (!linkACK)
+  {
+    printf("Master without ReliableACKLink, blocking, %udB, acknowledged %u of %u, errors %u\n", pathloss, acked, packets, errors);
+    return errors + ((acked == 0) ? 1 : 0);
+  }
+
+  printf("%4udB  %4u of %-4u %6u  %7.1f  %5.1f  %9.1f  %7.1f  %6.1fmS  %6.1fmS\n", pathloss, acked, packets, errors,
+         acked ? (double) upRSSI / acked : 0.0, acked ? (double) upSNR / acked : 0.0,
+         acked ? (double) downRSSI / acked : 0.0, acked ? (double) downSNR / acked : 0.0,
+         exchangeuS / 1e3, probeuS / 1e3);
+  return errors;
+}
+
+
+int main(int argc, char *argv[])
+{
+  uint32_t packets = (argc > 1) ? atoi(argv[1]) : 20;
+  float scale = (argc > 2) ? atof(argv[2]) : 10;
+  const int16_t pathlosses[] = {80, 100, 115};
+  uint32_t index, errors = 0;
+
+  LTHostClock clock(scale);
+  LTHALsetClock(&clock);
+
+  errors += checkFrames();
+
+  printf("%u frames of %u and %u bytes per path loss, SF7 BW125, master %ddBm, slave ACKs %ddBm\n", packets, LTTelemetryLength(LTSchema2S), LTTelemetryLength(LTSchema3S), MasterTXpower, SlaveTXpower);
+  printf("Path   Acked        Errors  Up RSSI  Up SNR  Down RSSI  Down SNR  Exchange  Probe\n");
+
+  for (index = 0; index < (sizeof(pathlosses) / sizeof(pathlosses[0])); index++)
+  {
+    errors += runLink(pathlosses[index], packets, true);
+  }
+
+  errors += runLink(80, packets, false);
+
+  if (errors)
+  {
+    printf("ERROR - %u frames or ACKs wrong\n", errors);
+    return 1;
+  }
+
+  return 0;
+}
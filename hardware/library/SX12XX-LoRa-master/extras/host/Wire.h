@@ -0,0 +1,177 @@
+/*
+  Licensed under a MIT license, see LICENSE.txt in the library src folder.
+  Original published 16/10/26
+*/
+
+/*******************************************************************************************************
+  Host replacement for Wire.h with an in memory I2C FRAM on the bus, so FRAM_FM24CL64.h and
+  FRAM_MB85RC16PNF.h run unmodified on the host.
+
+  LTSimFRAM is the image of the device. addressbytes is 2 for the FM24CL64, the MB85RC16 has 1 address
+  byte and takes the 3 high address bits from the I2C address. Every byte written is counted per
+  address for wear figures, and powerFailAfter(n) lets n more bytes be written and drops the rest until
+  powerOn(), to check what is left in the memory after a reset part way through a write.
+*******************************************************************************************************/
+
+#ifndef Wire_h
+#define Wire_h
+
+#include <Arduino.h>
+#include <vector>
+
+class LTSimFRAM
+{
+  public:
+
+    LTSimFRAM(uint32_t size, uint8_t i2caddr, uint8_t addressbytes) :
+      image(size, 0), writes(size, 0), _i2caddr(i2caddr), _addressbytes(addressbytes)
+    {
+    }
+
+    std::vector<uint8_t> image;
+    std::vector<uint32_t> writes;             //bytes written to each address
+
+    void powerFailAfter(int32_t bytes)
+    {
+      _writesLeft = bytes;
+    }
+
+    void powerOn()
+    {
+      _writesLeft = -1;
+    }
+
+    bool isPowered()
+    {
+      return _writesLeft != 0;
+    }
+
+    bool select(uint8_t i2caddr)
+    {
+      //true if i2caddr is this device, the MB85RC16 answers on 8 addresses
+      uint8_t span = (_addressbytes == 1) ? 8 : 1;
+
+      if ((i2caddr < _i2caddr) || (i2caddr >= (_i2caddr + span)))
+      {
+        return false;
+      }
+
+      _pointer = (_addressbytes == 1) ? ((uint32_t) (i2caddr - _i2caddr) << 8) : 0;
+      _addressed = 0;
+      return true;
+    }
+
+    void receive(uint8_t data)
+    {
+      //a byte written by the master, address bytes first then data
+      if (_addressed < _addressbytes)
+      {
+        _pointer = (_addressbytes == 1) ? (_pointer | data) : ((_pointer << 8) | data);
+        _addressed++;
+        return;
+      }
+
+      if (_writesLeft == 0)
+      {
+        return;                               //power has gone
+      }
+
+      if (_writesLeft > 0)
+      {
+        _writesLeft--;
+      }
+
+      image[_pointer % image.size()] = data;
+      writes[_pointer % image.size()]++;
+      _pointer++;
+    }
+
+    uint8_t send()
+    {
+      //a byte read by the master, from the address pointer
+      uint8_t data = image[_pointer % image.size()];
+      _pointer++;
+      return data;
+    }
+
+  private:
+
+    uint8_t _i2caddr, _addressbytes, _addressed = 0;
+    uint32_t _pointer = 0;
+    int32_t _writesLeft = -1;
+};
+
+
+class TwoWire
+{
+  public:
+
+    void attach(LTSimFRAM *device)
+    {
+      _device = device;
+    }
+
+    void begin()
+    {
+    }
+
+    void setClock(uint32_t frequency)
+    {
+      (void) frequency;
+    }
+
+    void beginTransmission(int address)
+    {
+      _selected = (_device != NULL) && _device->select(address);
+    }
+
+    size_t write(uint8_t data)
+    {
+      if (_selected)
+      {
+        _device->receive(data);
+      }
+
+      return 1;
+    }
+
+    uint8_t endTransmission(bool stop = true)
+    {
+      (void) stop;
+      return _selected ? 0 : 2;               //2 is address not acknowledged
+    }
+
+    uint8_t requestFrom(int address, int quantity)
+    {
+      //the FRAM keeps its address pointer from the write that set it
+      (void) address;
+      _available = _selected ? quantity : 0;
+      return _available;
+    }
+
+    int available()
+    {
+      return _available;
+    }
+
+    int read()
+    {
+      if (_available == 0)
+      {
+        return -1;
+      }
+
+      _available--;
+      return _device->send();
+    }
+
+  private:
+
+    LTSimFRAM *_device = NULL;
+    bool _selected = false;
+    int _available = 0;
+};
+
+inline TwoWire Wire;
+
+#endif
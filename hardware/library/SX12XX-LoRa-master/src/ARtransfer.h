@@ -28,6 +28,27 @@
 
   Updated 10/10/23 to correct issues with transfer of images > 65535 bytes long.
 
+  Updated 16/10/26 to add a windowed transfer mode, set with ARsetWindow(). The transmitter sends up to
+  ARWindowMax segments back to back and the receiver answers the last of them with a bitmap of the segments
+  it holds, so only the missing segments are sent again. The window size goes to the receiver in the array
+  start header, so both ends must use this version of ARtransfer.h. A window of 1, the default, is the
+  original stop and wait transfer.
+
+  With ENABLEARFEC defined the windowed transfer can also send forward error correction, set with
+  ARsetRepair(). The array is split in fixed groups of ARDTWindow segments, and once a group has been sent
+  and the bitmap ACK shows up to ARsetRepair() of its segments missing, that many repair segments,
+  Reed-Solomon combinations of the group, see LTFEC.h, are sent in place of the missing segments. Any
+  repair segment stands in for any lost segment of the group, and a group sent without loss costs no
+  repair segments. The receiver holds up to ARFECMaxRepair repair segments of 245 bytes in RAM. They only
+  pay on links with around 10% loss, above that they are slower than windowed alone, so ENABLEARFEC is
+  not defined by default and ARsetRepair() is 0, see Array_Transfer_Sim in extras/host/README.md.
+
+  Updated 16/10/26 to move segments without copying them. The transmitter sends each segment straight
+  from the array, and the receiver reads only the header of a packet with receiveHeaderDT(), then reads
+  the data with readDataDT() from the LoRa device straight into its place in the array, or into
+  ARDTfilenamebuff for the array start. The 245 byte ARDTdata buffer is only needed for building repair
+  segments, so it only exists with ENABLEARFEC.
+
 *******************************************************************************************************/
 
 //so that Monitorport prints default to the primary Monitorport port of Monitorport
@@ -39,6 +60,10 @@
 
 //#define DEBUG                              //enable this define to show data transfer debug info
 #include <arrayRW.h>                         //part of SX12XX library
+#include <LTCRC.h>                           //part of SX12XX library
+#ifdef ENABLEARFEC
+#include <LTFEC.h>                           //part of SX12XX library
+#endif
 
 //Variables used on transmitter and receiver
 uint8_t ARRXPacketL;                         //length of received packet
@@ -57,7 +82,9 @@ uint32_t ARDTStartmS;                        //used for timeing transfers
 uint16_t ARDTSegment = 0;                    //current segment number
 char ARDTfilenamebuff[ARDTfilenamesize];     //global buffer to store filename
 uint8_t ARDTheader[16];                      //header array
-uint8_t ARDTdata[245];                       //data/segment array
+#ifdef ENABLEARFEC
+uint8_t ARDTdata[245];                       //repair segment being built on the transmitter
+#endif
 uint8_t ARDTflags = 0;                       //Flags byte used to pass status information between nodes
 int8_t ARDTLED = -1;                         //pin number for indicator LED, if -1 then not used
 uint16_t ARDTErrors;                         //used for tracking errors in the transfer process
@@ -71,6 +98,7 @@ uint8_t  ARTXPacketL;                        //length of transmitted packet
 uint16_t ARTXNetworkID;                      //this is used to store the 'network' number, receiver must have the same
 uint16_t ARTXArrayCRC;                       //should contain CRC of data array transmitted
 uint16_t ARDTSentSegments;                   //count of segments sent
+uint8_t ARDTWindow = 1;                      //segments sent before waiting for an ACK, 1 is stop and wait
 
 //Receive mode only variables
 uint16_t ARRXErrors;                         //count of packets received with error
@@ -82,6 +110,25 @@ bool ARDTArrayTimeout;                       //set true when there is a timeout
 uint16_t ARDTSegmentNext;                    //next segment expected
 uint16_t ARDTReceivedSegments;               //count of segments received
 uint16_t ARDTSegmentLast;                    //last segment processed
+uint8_t ARDTWindowRX;                        //window size from the array start header, 0 or 1 is stop and wait
+uint8_t ARDTSegmentSizeRX;                   //segment size from the array start header, locates windowed segments
+
+//Windowed transfer variables, used on transmitter and receiver
+uint16_t ARDTWindowBase;                     //first segment not yet acknowledged (TX) or not yet received (RX)
+uint32_t ARDTWindowBitmap;                   //bit n set when segment ARDTWindowBase + n is acknowledged or received
+
+#ifdef ENABLEARFEC
+#ifndef ARFECMaxRepair
+#define ARFECMaxRepair 4                     //repair segments per group the receiver can hold, 1 to 8
+#endif
+uint8_t ARDTRepair = 0;                      //most repair segments sent for a group, set with ARsetRepair()
+uint16_t ARFECSentTo;                        //segments below this have all been sent once
+uint16_t ARDTRecoveredSegments;              //count of segments rebuilt from repair segments
+uint16_t ARFECRepairGroup;                   //first segment of the group the held repair segments belong to
+uint8_t ARFECRepairHeld;                     //bit n set when repair segment n is held in ARFECRepair[n]
+uint8_t ARFECRepairL;                        //length of the held repair segments
+uint8_t ARFECRepair[ARFECMaxRepair][245];    //repair segments received for the current group
+#endif
 
 //A global pointer to the array and a variable for its length and current location are used so that all routines
 //have access to the array to send without constantly passing the array pointer and variables between functions.
@@ -95,6 +142,9 @@ bool ARsendArray(uint8_t *ptrarray, uint32_t arraylength, char *filename, uint8_
 bool ARstartArrayTransfer(char *buff, uint8_t filenamesize);
 bool ARsendSegments();
 bool ARsendArraySegment(uint16_t segnum, uint8_t segmentsize);
+bool ARsendSegmentsWindow();
+bool ARsendWindowSegment(uint16_t segnum, bool ackrequest);
+bool ARsendRepairSegment(uint16_t groupstart, uint8_t repair, bool ackrequest);
 bool ARendArrayTransfer(char *buff, uint8_t filenamesize);
 void ARbuild_DTArrayStartHeader(uint8_t *header, uint8_t headersize, uint8_t datalength, uint32_t arraylength, uint16_t arraycrc, uint8_t segsize);
 void ARbuild_DTSegmentHeader(uint8_t *header, uint8_t headersize, uint8_t datalen, uint16_t segnum);
@@ -107,6 +157,7 @@ void ARprintACKdetail();
 void ARprintdata(uint8_t *dataarray, uint8_t arraysize);
 uint16_t ARgetNumberSegments(uint32_t arraysize, uint8_t segmentsize);
 uint8_t ARgetLastSegmentSize(uint32_t arraysize, uint8_t segmentsize);
+uint8_t ARgetSegmentSize(uint32_t arraysize, uint8_t segmentsize, uint16_t segnum);
 bool ARsendDTInfo();
 void ARbuild_DTInfoHeader(uint8_t *header, uint8_t headersize, uint8_t datalen);
 
@@ -114,8 +165,12 @@ void ARbuild_DTInfoHeader(uint8_t *header, uint8_t headersize, uint8_t datalen);
 uint32_t ARreceiveArray(uint8_t *arraychar, uint32_t length, uint32_t receivetimeout);
 bool ARreceivePacketDT();
 void ARreadHeaderDT();
+bool ARreadDataDT(uint8_t *dest, uint8_t size);
 bool ARprocessPacket(uint8_t packettype);
 bool ARprocessSegmentWrite();
+bool ARprocessSegmentWindow();
+bool ARstoreRepairSegment();
+bool ARdecodeWindow();
 bool ARprocessArrayStart(uint8_t *buff, uint8_t filenamesize);
 bool ARprocessArrayEnd();
 void ARprintSourceArrayDetails();
@@ -124,6 +179,8 @@ uint16_t ARarrayCRC(uint8_t *buffer, uint32_t size, uint16_t startvalue);
 
 //Common functions
 void ARsetDTLED(int8_t pinnumber);
+void ARsetWindow(uint8_t segments);
+void ARsetRepair(uint8_t segments);
 void ARprintheader(uint8_t *hdr, uint8_t hdrsize);
 void ARprintArrayHEX(uint8_t *buff, uint32_t len);
 void ARprintReliableStatus();
@@ -144,6 +201,9 @@ const uint8_t ARSendSegment = 13;            //bit number of ATDTErrors to set w
 const uint8_t AROpeningFile = 14;            //bit number of ATDTErrors to set when opening file fails
 const uint8_t ARendTransfer = 15;            //bit number of ATDTErrors to set when end transfer fails
 
+const uint8_t ARACKRequest = 7;              //bit number of segment header flags, set on the segment that ends a window
+const uint8_t ARWindowMax = 32;              //maximum window, the number of bits in ARDTWindowBitmap
+
 
 //************************************************
 //Transmit mode functions
@@ -424,6 +484,11 @@ bool ARstartArrayTransfer(char *buff, uint8_t filenamesize)
 
 bool ARsendSegments()
 {
+  if (ARDTWindow > 1)
+  {
+    return ARsendSegmentsWindow();
+  }
+
   //Start the array transfer at segment 0
   ARDTSegment = 0;
   ARDTSentSegments = 0;
@@ -466,16 +531,10 @@ bool ARsendArraySegment(uint16_t segnum, uint8_t segmentsize)
   //Send array segment as payload in a data transfer packet
 
   uint8_t ValidACK;
-  uint8_t index;
-  uint8_t tempdata;
   uint8_t localattempts = 0;
+  uint8_t *segment = &ptrARsendArray[ARarraylocation];     //sent straight from the array, no copy
 
-  for (index = 0; index < segmentsize; index++)
-  {
-    tempdata = ptrARsendArray[ARarraylocation];
-    ARDTdata[index] = tempdata;
-    ARarraylocation++;
-  }
+  ARarraylocation += segmentsize;
 
   ARbuild_DTSegmentHeader(ARDTheader, DTSegmentWriteHeaderL, segmentsize, segnum);
 
@@ -487,7 +546,7 @@ bool ARsendArraySegment(uint16_t segnum, uint8_t segmentsize)
   Monitorport.print(F(" "));
   ARprintheader(ARDTheader, DTSegmentWriteHeaderL);
   Monitorport.print(F(" "));
-  ARprintdata(ARDTdata, segmentsize);                           //print segment size of data array only
+  ARprintdata(segment, segmentsize);                            //print segment size of data array only
   Monitorport.println();
 #endif
 #endif
@@ -500,7 +559,7 @@ bool ARsendArraySegment(uint16_t segnum, uint8_t segmentsize)
       digitalWrite(ARDTLED, HIGH);
     }
 
-    ARTXPacketL = LoRa.transmitDT(ARDTheader, DTSegmentWriteHeaderL, (uint8_t *) ARDTdata, segmentsize, NetworkID, TXtimeoutmS, TXpower,  WAIT_TX);
+    ARTXPacketL = LoRa.transmitDT(ARDTheader, DTSegmentWriteHeaderL, segment, segmentsize, NetworkID, TXtimeoutmS, TXpower,  WAIT_TX);
     if (ARDTLED >= 0)
     {
       digitalWrite(ARDTLED, LOW);
@@ -590,6 +649,312 @@ bool ARsendArraySegment(uint16_t segnum, uint8_t segmentsize)
 }
 
 
+bool ARsendSegmentsWindow()
+{
+  //Selective repeat transfer of the array. Each round sends every segment in the window that has not been
+  //acknowledged, back to back, and only the last one asks for an ACK. The bitmap ACK says which segments
+  //the receiver holds, the window moves up to the first one missing and the next round sends the gaps and
+  //the new segments at the top of the window. If the ACK is lost the last segment is sent again on its own
+  //to get a fresh one. With repair segments enabled, once the group the window starts in has been sent
+  //the gaps in it, if there are no more than ARDTRepair, go as that many repair segments for the group,
+  //ahead of the new segments. A segment that fails to transmit ends the round, the ACK request then goes
+  //on the last segment that went out, sent again, and the segments not sent are gaps for the next round.
+
+  uint8_t ValidACK;
+  uint8_t localattempts;
+  uint16_t segnum, firstsegment, lastsegment, sentsegment, ackbase, roundend;
+  uint32_t ackbitmap;
+  bool sending, ackrequested;
+
+  ARDTWindowBase = 0;
+  ARDTWindowBitmap = 0;
+  ARDTSentSegments = 0;
+
+#ifdef ENABLEARFEC
+  uint8_t repair, repairs;
+  uint16_t groupstart = 0, groupend;
+
+  ARFECSentTo = 0;
+#endif
+
+#ifdef ENABLEMONITOR
+  Monitorport.print(F("Windowed transfer, "));
+  Monitorport.print(ARDTWindow);
+  Monitorport.println(F(" segments per ACK"));
+#endif
+
+  while (ARDTWindowBase < ARDTNumberSegments)
+  {
+    firstsegment = ARDTWindowBase;
+    lastsegment = ARDTNumberSegments;               //none yet
+    roundend = ARDTWindowBase + ARDTWindow;
+
+#ifdef ENABLEARFEC
+    repairs = 0;
+    groupstart = (ARDTWindowBase / ARDTWindow) * ARDTWindow;
+    groupend = groupstart + ARDTWindow;
+
+    if (groupend > ARDTNumberSegments)
+    {
+      groupend = ARDTNumberSegments;
+    }
+
+    if ((ARDTRepair > 0) && (ARFECSentTo >= groupend))
+    {
+      for (segnum = ARDTWindowBase; segnum < groupend; segnum++)
+      {
+        repairs += !bitRead(ARDTWindowBitmap, segnum - ARDTWindowBase);
+      }
+
+      if (repairs <= ARDTRepair)
+      {
+        firstsegment = groupend;                    //the gaps of the group go as repair segments
+      }
+      else
+      {
+        repairs = 0;
+      }
+    }
+#endif
+
+    for (segnum = firstsegment; (segnum < ARDTNumberSegments) && (segnum < roundend); segnum++)
+    {
+      if (!bitRead(ARDTWindowBitmap, segnum - ARDTWindowBase))
+      {
+        lastsegment = segnum;
+      }
+    }
+
+#ifdef ENABLEMONITOR
+#ifdef DEBUG
+    ARprintSeconds();
+#endif
+#endif
+
+    sentsegment = ARDTWindowBase;                   //the first missing segment, if none goes out it is sent again
+    sending = true;
+    ackrequested = false;
+
+#ifdef ENABLEARFEC
+    for (repair = 0; sending && (repair < repairs); repair++)
+    {
+      ackrequested = ((repair == (repairs - 1)) && (lastsegment == ARDTNumberSegments));
+      sending = ARsendRepairSegment(groupstart, repair, ackrequested);
+      ackrequested = ackrequested && sending;
+    }
+#endif
+
+    for (segnum = firstsegment; sending && (lastsegment < ARDTNumberSegments) && (segnum <= lastsegment); segnum++)
+    {
+      if (!bitRead(ARDTWindowBitmap, segnum - ARDTWindowBase))
+      {
+        sending = ARsendWindowSegment(segnum, (segnum == lastsegment));
+
+        if (sending)
+        {
+          ARDTSentSegments++;
+          sentsegment = segnum;
+          ackrequested = (segnum == lastsegment);
+
+#ifdef ENABLEARFEC
+          if (segnum >= ARFECSentTo)
+          {
+            ARFECSentTo = segnum + 1;
+          }
+#endif
+        }
+      }
+    }
+
+    lastsegment = sentsegment;
+    localattempts = 0;
+
+    do
+    {
+      localattempts++;
+
+      if (ackrequested)
+      {
+        ValidACK = LoRa.waitACKDT(ARDTheader, DTSegmentWindowACKHeaderL, ACKsegtimeoutmS);
+        ARRXPacketType = ARDTheader[0];
+
+        if (ValidACK > 0)
+        {
+          if (ARRXPacketType == DTStartNACK)
+          {
+#ifdef ENABLEMONITOR
+            Monitorport.println(F("Received restart request"));
+#endif
+
+            return false;
+          }
+
+          if (ARRXPacketType == DTSegmentWindowACK)
+          {
+            break;
+          }
+        }
+
+        ARNoAckCount++;
+
+#ifdef ENABLEMONITOR
+#ifdef DEBUG
+        Monitorport.println(F("NoACK"));
+#endif
+#endif
+
+        if (ARNoAckCount > NoAckCountLimit)
+        {
+#ifdef ENABLEMONITOR
+          Monitorport.println(F("ERROR NoACK limit reached"));
+#endif
+
+          bitSet(ARDTErrors, ARNoACKlimit);
+          return false;
+        }
+      }
+
+      if (localattempts == SendAttempts)
+      {
+        bitSet(ARDTErrors, ARSendSegment);
+        return false;
+      }
+
+      ackrequested = ARsendWindowSegment(lastsegment, true);    //the ACK was lost or the ACK request never went out
+
+      if (ackrequested)
+      {
+        ARDTSentSegments++;
+      }
+    } while (true);
+
+    ARAckCount++;
+    beginarrayRW(ARDTheader, 4);
+    ackbase = arrayReadUint16();
+    ackbitmap = arrayReadUint32();
+
+    if (ackbase >= ARDTWindowBase)                 //the receiver never moves its window back
+    {
+      ARDTWindowBase = ackbase;
+      ARDTWindowBitmap = ackbitmap;
+    }
+
+#ifdef ENABLEMONITOR
+#ifdef DEBUG
+    Monitorport.print(F("Window ACK, first missing segment "));
+    Monitorport.print(ARDTWindowBase);
+    Monitorport.print(F(" bitmap 0x"));
+    Monitorport.println(ARDTWindowBitmap, HEX);
+#endif
+#endif
+  }
+
+  return true;
+}
+
+
+bool ARsendWindowSegment(uint16_t segnum, bool ackrequest)
+{
+  //Send one segment of a windowed transfer, segments are taken from the array by number so they can be
+  //sent in any order. No ACK is waited for here.
+
+  uint8_t segmentsize = SegmentSize;
+
+  if (segnum == (ARDTNumberSegments - 1))
+  {
+    segmentsize = ARDTLastSegmentSize;
+  }
+
+  ARbuild_DTSegmentHeader(ARDTheader, DTSegmentWriteHeaderL, segmentsize, segnum);
+
+  if (ackrequest)
+  {
+    bitSet(ARDTheader[1], ARACKRequest);
+  }
+
+#ifdef ENABLEMONITOR
+#ifdef PRINTSEGMENTNUM
+  Monitorport.println(segnum);
+#endif
+#endif
+
+  if (ARDTLED >= 0)
+  {
+    digitalWrite(ARDTLED, HIGH);
+  }
+
+  ARTXPacketL = LoRa.transmitDT(ARDTheader, DTSegmentWriteHeaderL, &ptrARsendArray[(uint32_t) segnum * SegmentSize], segmentsize, NetworkID, TXtimeoutmS, TXpower,  WAIT_TX);
+
+  if (ARDTLED >= 0)
+  {
+    digitalWrite(ARDTLED, LOW);
+  }
+
+  if (ARTXPacketL == 0)                                     //if there has been an error ARTXPacketL returns as 0
+  {
+#ifdef ENABLEMONITOR
+    Monitorport.println(F("Transmit error"));
+#endif
+
+    return false;
+  }
+
+  return true;
+}
+
+
+#ifdef ENABLEARFEC
+bool ARsendRepairSegment(uint16_t groupstart, uint8_t repair, bool ackrequest)
+{
+  //Build and send repair segment number repair for the group of segments starting at groupstart. The
+  //repair is as long as the first segment of the group, shorter segments count as padded with zeros.
+
+  uint8_t index, segmentsize;
+  uint16_t segnum;
+
+  segmentsize = ARgetSegmentSize(ARDTSourceArrayLength, SegmentSize, groupstart);
+  memset(ARDTdata, 0, segmentsize);
+
+  for (index = 0; (index < ARDTWindow) && ((groupstart + index) < ARDTNumberSegments); index++)
+  {
+    segnum = groupstart + index;
+    LTFECMulAdd(ARDTdata, &ptrARsendArray[(uint32_t) segnum * SegmentSize], LTFECCoefficient(repair, index), ARgetSegmentSize(ARDTSourceArrayLength, SegmentSize, segnum));
+  }
+
+  ARbuild_DTSegmentHeader(ARDTheader, DTSegmentWriteHeaderL, segmentsize, groupstart);
+  ARDTheader[0] = DTSegmentRepair + repair;
+
+  if (ackrequest)
+  {
+    bitSet(ARDTheader[1], ARACKRequest);
+  }
+
+  if (ARDTLED >= 0)
+  {
+    digitalWrite(ARDTLED, HIGH);
+  }
+
+  ARTXPacketL = LoRa.transmitDT(ARDTheader, DTSegmentWriteHeaderL, (uint8_t *) ARDTdata, segmentsize, NetworkID, TXtimeoutmS, TXpower,  WAIT_TX);
+
+  if (ARDTLED >= 0)
+  {
+    digitalWrite(ARDTLED, LOW);
+  }
+
+  if (ARTXPacketL == 0)
+  {
+#ifdef ENABLEMONITOR
+    Monitorport.println(F("Transmit error"));
+#endif
+
+    return false;
+  }
+
+  return true;
+}
+#endif
+
+
 bool ARendArrayTransfer(char *buff, uint8_t filenamesize)
 {
   //End array transfer
@@ -691,7 +1056,7 @@ void ARbuild_DTArrayStartHeader(uint8_t *header, uint8_t headersize, uint8_t dat
   arrayWriteUint32(arraylength);       //byte 4,5,6,7, write the array length
   arrayWriteUint16(arraycrc);          //byte 8, 9, write array CRC
   arrayWriteUint8(segsize);            //byte 10, segment size
-  arrayWriteUint8(0);                  //byte 11, unused byte
+  arrayWriteUint8(ARDTWindow);         //byte 11, window size, segments sent before an ACK
   endarrayRW();
 }
 
@@ -845,6 +1210,19 @@ uint8_t ARgetLastSegmentSize(uint32_t arraysize, uint8_t segmentsize)
 }
 
 
+uint8_t ARgetSegmentSize(uint32_t arraysize, uint8_t segmentsize, uint16_t segnum)
+{
+  //size of segment segnum, all are segmentsize apart from the last
+  uint32_t location = (uint32_t) segnum * segmentsize;
+
+  if ((location + segmentsize) > arraysize)
+  {
+    return arraysize - location;
+  }
+  return segmentsize;
+}
+
+
 bool ARsendDTInfo()
 {
   //Send array info packet, for this implmentation its really only the flags in ARDTflags that is sent
@@ -866,7 +1244,7 @@ bool ARsendDTInfo()
     Monitorport.print(F("Send DTInfo packet attempt "));
     Monitorport.println(localattempts);
 #endif
-    ARTXPacketL = LoRa.transmitDT(ARDTheader, DTInfoHeaderL, (uint8_t *) ARDTdata, 0, NetworkID, TXtimeoutmS, TXpower,  WAIT_TX);
+    ARTXPacketL = LoRa.transmitDT(ARDTheader, DTInfoHeaderL, ARDTheader, 0, NetworkID, TXtimeoutmS, TXpower,  WAIT_TX);   //no data
 
     if (ARTXPacketL == 0)                                         //if there has been an error ARTXPacketL returns as 0
     {
@@ -997,7 +1375,7 @@ bool ARreceivePacketDT()
   //Receive data transfer packets
 
   ARRXPacketType = 0;
-  ARRXPacketL = LoRa.receiveDT(ARDTheader, HeaderSizeMax, (uint8_t *) ARDTdata, DataSizeMax, NetworkID, RXtimeoutmS, WAIT_RX);
+  ARRXPacketL = LoRa.receiveHeaderDT(ARDTheader, HeaderSizeMax, NetworkID, RXtimeoutmS, WAIT_RX);   //data is left in the LoRa device
 
   if (ARDTLED >= 0)
   {
@@ -1011,7 +1389,7 @@ bool ARreceivePacketDT()
 #endif
   if (ARRXPacketL > 0)
   {
-    //if the LoRa.receiveDT() returns a value > 0 for ARRXPacketL then packet was received OK
+    //if the LoRa.receiveHeaderDT() returns a value > 0 for ARRXPacketL then packet was received OK
     //then only action payload if destinationNode = thisNode
     ARreadHeaderDT();                        //get the basic header details into global variables ARRXPacketType etc
     ARprocessPacket(ARRXPacketType);         //process and act on the packet
@@ -1023,7 +1401,7 @@ bool ARreceivePacketDT()
   }
   else
   {
-    //if the LoRa.receiveDT() function detects an error RXOK is 0
+    //if the LoRa.receiveHeaderDT() function detects an error RXOK is 0
 
     uint16_t IRQStatus = LoRa.readIrqStatus();
 
@@ -1067,6 +1445,29 @@ void ARreadHeaderDT()
 }
 
 
+bool ARreadDataDT(uint8_t *dest, uint8_t size)
+{
+  //Read the data of the received packet from the LoRa device straight into dest. If it is longer than size
+  //or fails the payload CRC it counts as a packet error, and is not acted on or answered.
+
+  if ((LoRa.readDataDT(dest, size) == ARRXDataarrayL) && !LoRa.readReliableErrors())
+  {
+    return true;
+  }
+
+  ARRXErrors++;
+
+#ifdef ENABLEMONITOR
+  Monitorport.print(F("PacketError"));
+  ARprintPacketDetails();
+  ARprintReliableStatus();
+  Monitorport.println();
+#endif
+
+  return false;
+}
+
+
 bool ARprocessPacket(uint8_t packettype)
 {
   //Decide what to do with an incoming packet
@@ -1077,9 +1478,20 @@ bool ARprocessPacket(uint8_t packettype)
     return true;
   }
 
+#ifdef ENABLEARFEC
+  if (((packettype & 0xF8) == DTSegmentRepair) && (ARDTWindowRX > 1))
+  {
+    ARprocessSegmentWrite();
+    return true;
+  }
+#endif
+
   if (packettype == DTArrayStart)
   {
-    ARprocessArrayStart(ARDTdata, ARRXDataarrayL);       //ARDTdata contains the filename
+    if (ARreadDataDT((uint8_t *) ARDTfilenamebuff, ARDTfilenamesize - 1))   //the filename, leaving room for a null
+    {
+      ARprocessArrayStart((uint8_t *) ARDTfilenamebuff, ARRXDataarrayL);
+    }
     return true;
   }
 
@@ -1098,8 +1510,6 @@ bool ARprocessSegmentWrite()
   //There is a request to write a segment to array on receiver
   //checks that the sequence of segment writes is correct
 
-  uint8_t index, byteswritten = 0;
-
   if (!ARDTArrayStarted)
   {
     //something is wrong, have received a request to write a segment but there is no array
@@ -1113,6 +1523,11 @@ bool ARprocessSegmentWrite()
     Monitorport.println();
 #endif
 
+    if ((ARDTWindowRX > 1) && !bitRead(ARRXFlags, ARACKRequest))
+    {
+      return false;                                 //only answer the segment that ends a window
+    }
+
     ARDTheader[0] = DTStartNACK;
     delay(ACKdelaymS);
     delay(DuplicatedelaymS);
@@ -1131,17 +1546,26 @@ bool ARprocessSegmentWrite()
     return false;
   }
 
+  if (ARDTWindowRX > 1)
+  {
+    return ARprocessSegmentWindow();
+  }
+
   if (ARDTSegment == ARDTSegmentNext)
   {
-    //segment to write is as expected
+    //segment to write is as expected, read it straight into the array
 
-    for (index = 0; index < ARRXDataarrayL; index++)
+    if (((ARarraylocation + ARRXDataarrayL) > MAXarraysize) || !ARreadDataDT(&ptrARreceivearray[ARarraylocation], ARRXDataarrayL))
     {
-      ptrARreceivearray[ARarraylocation] = ARDTdata[index];
-      ARarraylocation++;
-      byteswritten++;
+      return false;                                 //not ACKed, so the transmitter sends it again
     }
 
+#ifdef ENABLEARRAYCRC
+    ARDTDestinationArrayCRC = LTCRCCCITTUpdate(ARDTDestinationArrayCRC, &ptrARreceivearray[ARarraylocation], ARRXDataarrayL);   //CRC the segment as it arrives
+#endif
+
+    ARarraylocation += ARRXDataarrayL;
+
 #ifdef ENABLEMONITOR
 #ifdef PRINTSEGMENTNUM
     Monitorport.println(ARDTSegment);
@@ -1241,6 +1665,235 @@ bool ARprocessSegmentWrite()
 }
 
 
+bool ARprocessSegmentWindow()
+{
+  //Segment write in a windowed transfer. Segments may arrive in any order, each is written to its place
+  //in the array and marked in the window bitmap. The array CRC is run over segments as they become
+  //contiguous, so ARDTDestinationArrayCRC and ARarraylocation always cover the array received in sequence.
+  //Only a segment with the ARACKRequest flag set is answered, with a bitmap ACK. Repair segments are held
+  //and used to rebuild lost segments of the group once enough have arrived.
+
+  uint16_t offset;
+  uint32_t location;
+  uint8_t length;
+
+#ifdef ENABLEARFEC
+  if (((ARRXPacketType & 0xF8) == DTSegmentRepair) && !ARstoreRepairSegment())
+  {
+    return false;
+  }
+#endif
+
+  if ((ARRXPacketType == DTSegmentWrite) && (ARDTSegment >= ARDTWindowBase) && ((ARDTSegment - ARDTWindowBase) < ARWindowMax))
+  {
+    offset = ARDTSegment - ARDTWindowBase;
+    location = (uint32_t) ARDTSegment * ARDTSegmentSizeRX;
+
+    if (!bitRead(ARDTWindowBitmap, offset) && ((location + ARRXDataarrayL) <= ARDTSourceArrayLength))
+    {
+      if (!ARreadDataDT(&ptrARreceivearray[location], ARRXDataarrayL))
+      {
+        return false;
+      }
+
+      bitSet(ARDTWindowBitmap, offset);
+      ARDTReceivedSegments++;
+
+#ifdef ENABLEMONITOR
+#ifdef PRINTSEGMENTNUM
+      Monitorport.println(ARDTSegment);
+#endif
+#endif
+    }
+  }
+
+#ifdef ENABLEARFEC
+  ARdecodeWindow();
+#endif
+
+  while (bitRead(ARDTWindowBitmap, 0))
+  {
+    location = (uint32_t) ARDTWindowBase * ARDTSegmentSizeRX;
+    length = ARgetSegmentSize(ARDTSourceArrayLength, ARDTSegmentSizeRX, ARDTWindowBase);
+
+#ifdef ENABLEARRAYCRC
+    ARDTDestinationArrayCRC = LTCRCCCITTUpdate(ARDTDestinationArrayCRC, &ptrARreceivearray[location], length);
+#endif
+
+    ARarraylocation = location + length;
+    ARDTWindowBitmap = ARDTWindowBitmap >> 1;
+    ARDTWindowBase++;
+  }
+
+  ARDTSegmentLast = ARDTSegment;
+  ARDTSegmentNext = ARDTWindowBase;
+
+  if (!bitRead(ARRXFlags, ARACKRequest))
+  {
+    return true;
+  }
+
+  beginarrayRW(ARDTheader, 0);
+  arrayWriteUint8(DTSegmentWindowACK);               //byte 0, write the packet type
+  arrayWriteUint8(ARDTflags);                        //byte 1, ARDTflags byte
+  arrayWriteUint8(DTSegmentWindowACKHeaderL);        //byte 2, write length of header
+  arrayWriteUint8(0);                                //byte 3, no data
+  arrayWriteUint16(ARDTWindowBase);                  //byte 4, 5, first segment not received
+  arrayWriteUint32(ARDTWindowBitmap);                //byte 6, 7, 8, 9, segments received after it
+  endarrayRW();
+
+  delay(ACKdelaymS);
+
+  if (ARDTLED >= 0)
+  {
+    digitalWrite(ARDTLED, HIGH);
+  }
+
+  LoRa.sendACKDT(ARDTheader, DTSegmentWindowACKHeaderL, TXpower);
+
+  if (ARDTLED >= 0)
+  {
+    digitalWrite(ARDTLED, LOW);
+  }
+
+  return true;
+}
+
+
+#ifdef ENABLEARFEC
+bool ARstoreRepairSegment()
+{
+  //hold a repair segment for the group the window is in, repairs for any other group are of no use and
+  //are not read. Returns false if the repair segment fails its CRC.
+
+  uint8_t repair = ARRXPacketType & 0x07;
+  uint16_t groupstart = (ARDTWindowBase / ARDTWindowRX) * ARDTWindowRX;
+
+  if ((repair >= ARFECMaxRepair) || (ARDTSegment != groupstart))
+  {
+    return true;
+  }
+
+  if (ARFECRepairGroup != groupstart)
+  {
+    ARFECRepairGroup = groupstart;
+    ARFECRepairHeld = 0;
+  }
+
+  bitClear(ARFECRepairHeld, repair);               //it is read in place, over any copy already held
+
+  if (!ARreadDataDT(ARFECRepair[repair], sizeof(ARFECRepair[repair])))
+  {
+    return false;
+  }
+
+  ARFECRepairL = ARRXDataarrayL;
+  bitSet(ARFECRepairHeld, repair);
+  return true;
+}
+
+
+bool ARdecodeWindow()
+{
+  //Rebuild the lost segments of the group the window is in, if there are at least as many repair segments
+  //held as there are segments lost. The received segments are taken out of each repair segment, leaving
+  //a set of equations in the lost segments only which LTFECSolve() solves.
+
+  uint8_t index, count, lostcount = 0, repair, t, u;
+  uint8_t lostsegment[ARFECMaxRepair], repairnum[ARFECMaxRepair];
+  uint8_t matrix[ARFECMaxRepair * ARFECMaxRepair];
+  uint8_t *rows[ARFECMaxRepair];
+  uint16_t groupstart, segnum, segments;
+
+  groupstart = (ARDTWindowBase / ARDTWindowRX) * ARDTWindowRX;
+
+  if ((ARFECRepairHeld == 0) || (ARFECRepairGroup != groupstart))
+  {
+    return false;
+  }
+
+  segments = ARgetNumberSegments(ARDTSourceArrayLength, ARDTSegmentSizeRX);
+  count = ARDTWindowRX;
+
+  if ((groupstart + count) > segments)
+  {
+    count = segments - groupstart;
+  }
+
+  for (index = ARDTWindowBase - groupstart; index < count; index++)
+  {
+    if (!bitRead(ARDTWindowBitmap, (groupstart + index) - ARDTWindowBase))
+    {
+      if (lostcount == ARFECMaxRepair)
+      {
+        return false;
+      }
+      lostsegment[lostcount++] = index;
+    }
+  }
+
+  for (repair = 0, t = 0; (repair < ARFECMaxRepair) && (t < lostcount); repair++)
+  {
+    if (bitRead(ARFECRepairHeld, repair))
+    {
+      repairnum[t++] = repair;
+    }
+  }
+
+  if ((lostcount == 0) || (t < lostcount))
+  {
+    return false;                                   //nothing lost, or not enough repair segments yet
+  }
+
+  for (t = 0; t < lostcount; t++)
+  {
+    rows[t] = ARFECRepair[repairnum[t]];
+
+    for (index = 0, u = 0; index < count; index++)
+    {
+      if ((u < lostcount) && (lostsegment[u] == index))
+      {
+        u++;
+        continue;
+      }
+
+      segnum = groupstart + index;
+      LTFECMulAdd(rows[t], &ptrARreceivearray[(uint32_t) segnum * ARDTSegmentSizeRX], LTFECCoefficient(repairnum[t], index), ARgetSegmentSize(ARDTSourceArrayLength, ARDTSegmentSizeRX, segnum));
+    }
+
+    for (u = 0; u < lostcount; u++)
+    {
+      matrix[(t * lostcount) + u] = LTFECCoefficient(repairnum[t], lostsegment[u]);
+    }
+  }
+
+  ARFECRepairHeld = 0;                              //the repair segments are used up either way
+
+  if (!LTFECSolve(matrix, lostcount, rows, ARFECRepairL))
+  {
+    return false;
+  }
+
+  for (u = 0; u < lostcount; u++)
+  {
+    segnum = groupstart + lostsegment[u];
+    memcpy(&ptrARreceivearray[(uint32_t) segnum * ARDTSegmentSizeRX], rows[u], ARgetSegmentSize(ARDTSourceArrayLength, ARDTSegmentSizeRX, segnum));
+    bitSet(ARDTWindowBitmap, segnum - ARDTWindowBase);
+    ARDTRecoveredSegments++;
+
+#ifdef ENABLEMONITOR
+#ifdef PRINTSEGMENTNUM
+    Monitorport.print(segnum);
+    Monitorport.println(F(" rebuilt"));
+#endif
+#endif
+  }
+
+  return true;
+}
+#endif
+
+
 bool ARprocessArrayStart(uint8_t *buff, uint8_t filenamesize)
 {
   //There is a request to start writing to a local array on receiver
@@ -1250,6 +1903,7 @@ bool ARprocessArrayStart(uint8_t *buff, uint8_t filenamesize)
   ARDTArrayStarted = false;                         //until this function completes the Array transfer has not started
   ARDTArrayEnded = false;                           //and it cannot hve completed either ......
   ARarraylocation = 0;
+  ARDTDestinationArrayCRC = 0xFFFF;                 //start value for the running CRC of segments received
   beginarrayRW(ARDTheader, 4);                      //start buffer read at location 4
   ARDTSourceArrayLength = arrayReadUint32();        //load the array length being sent
 
@@ -1270,8 +1924,21 @@ bool ARprocessArrayStart(uint8_t *buff, uint8_t filenamesize)
 
 
   ARDTSourceArrayCRC = arrayReadUint16();           //load the CRC of the array being sent
-  memset(ARDTfilenamebuff, 0, ARDTfilenamesize);    //clear ARDTfilenamebuff to all 0s
-  memcpy(ARDTfilenamebuff, buff, filenamesize);     //copy received ARDTdata into ARDTfilenamebuff, the array should have a destination filename
+  ARDTSegmentSizeRX = arrayReadUint8();             //load the segment size
+  ARDTWindowRX = arrayReadUint8();                  //load the window size, 0 from a transmitter without windowed transfer
+  ARDTWindowBase = 0;
+  ARDTWindowBitmap = 0;
+#ifdef ENABLEARFEC
+  ARDTRecoveredSegments = 0;
+  ARFECRepairGroup = 0xFFFF;
+  ARFECRepairHeld = 0;
+#endif
+  if (buff != (uint8_t *) ARDTfilenamebuff)         //ARprocessPacket() reads the filename straight into ARDTfilenamebuff
+  {
+    memcpy(ARDTfilenamebuff, buff, filenamesize);
+  }
+
+  memset(&ARDTfilenamebuff[filenamesize], 0, ARDTfilenamesize - filenamesize);   //null terminate the destination filename
 
 #ifdef ENABLEMONITOR
   Monitorport.print((char*) ARDTfilenamebuff);
@@ -1287,6 +1954,13 @@ bool ARprocessArrayStart(uint8_t *buff, uint8_t filenamesize)
   {
     Monitorport.println(F("Remote did not save file to SD"));
   }
+
+  if (ARDTWindowRX > 1)
+  {
+    Monitorport.print(F("Windowed transfer, "));
+    Monitorport.print(ARDTWindowRX);
+    Monitorport.println(F(" segments per ACK"));
+  }
 #endif
   ARDTStartmS = millis();
   delay(ACKdelaystartendmS);                          //there needs to be a dealy here, to wait for receiver to be ready
@@ -1327,7 +2001,7 @@ bool ARprocessArrayEnd()
     Monitorport.print(F("ARDTDestinationArrayLength "));
     Monitorport.println(ARDTDestinationArrayLength);
 #ifdef ENABLEARRAYCRC
-    ARDTDestinationArrayCRC = ARarrayCRC(ptrARreceivearray, ARDTDestinationArrayLength, 0xFFFF);
+    //ARDTDestinationArrayCRC has been accumulated segment by segment in ARprocessSegmentWrite()
     Monitorport.print(F("Destination arrayCRC 0x"));
     Monitorport.println(ARDTDestinationArrayCRC, HEX);
 #endif
@@ -1376,25 +2050,7 @@ bool ARprocessArrayEnd()
 
 uint16_t ARarrayCRC(uint8_t *buffer, uint32_t size, uint16_t startvalue)
 {
-  uint32_t index;
-  uint16_t libraryCRC;
-  uint8_t j;
-
-  libraryCRC = startvalue;                                  //start value for CRC16
-
-  for (index = 0; index < size; index++)
-  {
-    libraryCRC ^= (((uint16_t)buffer[index]) << 8);
-    for (j = 0; j < 8; j++)
-    {
-      if (libraryCRC & 0x8000)
-        libraryCRC = (libraryCRC << 1) ^ 0x1021;
-      else
-        libraryCRC <<= 1;
-    }
-  }
-
-  return libraryCRC;
+  return LTCRCCCITTUpdate(startvalue, buffer, size);       //table driven CRC16, see LTCRC.h
 }
 
 
@@ -1488,6 +2144,40 @@ void ARsetDTLED(int8_t pinnumber)
 }
 
 
+void ARsetWindow(uint8_t segments)
+{
+  //set the number of segments the transmitter sends before waiting for an ACK, 1 is stop and wait
+
+  if (segments == 0)
+  {
+    segments = 1;
+  }
+
+  if (segments > ARWindowMax)
+  {
+    segments = ARWindowMax;
+  }
+
+  ARDTWindow = segments;
+}
+
+
+#ifdef ENABLEARFEC
+void ARsetRepair(uint8_t segments)
+{
+  //set the number of repair segments sent with each group of ARDTWindow segments, 0 for none, needs a
+  //window of 2 or more
+
+  if (segments > ARFECMaxRepair)
+  {
+    segments = ARFECMaxRepair;
+  }
+
+  ARDTRepair = segments;
+}
+#endif
+
+
 void ARprintheader(uint8_t *hdr, uint8_t hdrsize)
 {
   ARUNUSED(hdr);
@@ -40,6 +40,7 @@
 
 //#define DEBUG                              //enable this define to show data transfer debug info
 #include <arrayRW.h>                         //part of SX12XX library
+#include <LTCRC.h>                           //part of SX12XX library
 
 //Variables used on transmitter and receiver
 uint8_t ARRXPacketL;                         //length of received packet
@@ -1136,6 +1137,10 @@ bool ARprocessSegmentWrite()
   {
     //segment to write is as expected
 
+#ifdef ENABLEARRAYCRC
+    ARDTDestinationArrayCRC = LTCRCCCITTUpdate(ARDTDestinationArrayCRC, ARDTdata, ARRXDataarrayL);   //CRC the segment as it arrives
+#endif
+
     for (index = 0; index < ARRXDataarrayL; index++)
     {
       ptrARreceivearray[ARarraylocation] = ARDTdata[index];
@@ -1251,6 +1256,7 @@ bool ARprocessArrayStart(uint8_t *buff, uint8_t filenamesize)
   ARDTArrayStarted = false;                         //until this function completes the Array transfer has not started
   ARDTArrayEnded = false;                           //and it cannot hve completed either ......
   ARarraylocation = 0;
+  ARDTDestinationArrayCRC = 0xFFFF;                 //start value for the running CRC of segments received
   beginarrayRW(ARDTheader, 4);                      //start buffer read at location 4
   ARDTSourceArrayLength = arrayReadUint32();        //load the array length being sent
 
@@ -1328,7 +1334,7 @@ bool ARprocessArrayEnd()
     Monitorport.print(F("ARDTDestinationArrayLength "));
     Monitorport.println(ARDTDestinationArrayLength);
 #ifdef ENABLEARRAYCRC
-    ARDTDestinationArrayCRC = ARarrayCRC(ptrARreceivearray, ARDTDestinationArrayLength, 0xFFFF);
+    //ARDTDestinationArrayCRC has been accumulated segment by segment in ARprocessSegmentWrite()
     Monitorport.print(F("Destination arrayCRC 0x"));
     Monitorport.println(ARDTDestinationArrayCRC, HEX);
 #endif
@@ -1377,25 +1383,7 @@ bool ARprocessArrayEnd()
 
 uint16_t ARarrayCRC(uint8_t *buffer, uint32_t size, uint16_t startvalue)
 {
-  uint32_t index;
-  uint16_t libraryCRC;
-  uint8_t j;
-
-  libraryCRC = startvalue;                                  //start value for CRC16
-
-  for (index = 0; index < size; index++)
-  {
-    libraryCRC ^= (((uint16_t)buffer[index]) << 8);
-    for (j = 0; j < 8; j++)
-    {
-      if (libraryCRC & 0x8000)
-        libraryCRC = (libraryCRC << 1) ^ 0x1021;
-      else
-        libraryCRC <<= 1;
-    }
-  }
-
-  return libraryCRC;
+  return LTCRCCCITTUpdate(startvalue, buffer, size);       //table driven CRC16, see LTCRC.h
 }
 
 
@@ -16,10 +16,42 @@ File dataFile;                                   //name the file instance needed
 File dataFile;                                   //name the file instance needed for SD library routines
 #endif
 
+#include <LTCRC.h>                               //part of SX12XX library
+
 #ifndef Monitorport
 #define Monitorport Serial                       //output to Serial if no other port defined 
 #endif
 
+//Received segments are gathered into SD sector sized blocks, two are kept so that one can be filling
+//while the other is written, DTSD_writePending() writes the full one. Each write to the card is then a
+//whole sector at a sector boundary of the file, which the SD libraries pass straight to the card. The
+//segments are also CRC'd as they are written, so DTSD_getWriteCRC() has the CRC of the file without
+//reading it back. There is no RAM to spare for the 1k of buffers on AVR, each segment is written as one
+//block there.
+
+#ifndef DTSDWriteBufferSize
+#if defined(__AVR__)
+#define DTSDWriteBufferSize 0                    //no buffer, each segment is written as one block
+#else
+#define DTSDWriteBufferSize 512                  //one SD sector
+#endif
+#endif
+
+#if (DTSDWriteBufferSize > 0) && (DTSDWriteBufferSize < 256)
+#error "DTSDWriteBufferSize must be 0 or at least the largest segment, 255 bytes"
+#endif
+
+#if (DTSDWriteBufferSize > 0)
+uint8_t DTSD_writeBuffer[2][DTSDWriteBufferSize];
+uint16_t DTSD_writeFill;                         //bytes in the sector being filled
+uint8_t DTSD_writeSector;                        //sector being filled, 0 or 1
+bool DTSD_writeReady;                            //the other sector is full and waiting to be written
+#endif
+
+uint16_t DTSD_writeCRC;                          //CRC of the bytes written since DTSD_openNewFileWrite()
+uint32_t DTSD_writeLength;                       //bytes written since DTSD_openNewFileWrite()
+bool DTSD_writeCRCValid;                         //false if the file was not written from the start
+
 
 bool DTSD_dumpFileASCII(char *buff);
 bool DTSD_dumpFileHEX(char *buff);
@@ -34,9 +66,13 @@ bool DTSD_openNewFileWrite(char *buff);
 bool DTSD_openFileWrite(char *buff, uint32_t position);
 uint8_t DTSD_readFileSegment(uint8_t *buff, uint8_t segmentsize);
 uint8_t DTSD_writeSegmentFile(uint8_t *buff, uint8_t segmentsize);
+bool DTSD_writePending();
+void DTSD_writeBuffered();
+void DTSD_resetWrite(bool fromstart);
+uint16_t DTSD_getWriteCRC(uint32_t fsize);
 void DTSD_seekFileLocation(uint32_t position);
 uint16_t DTSD_createFile(char *buff);
-uint16_t DTSD_fileCRCCCITT();
+uint16_t DTSD_fileCRCCCITT(uint32_t fsize);
 void DTSD_fileFlush();
 void DTSD_closeFile();
 void printDirectorySD(File dir, int numTabs);
@@ -324,6 +360,7 @@ bool DTSD_openNewFileWrite(char *buff)
   {
     //Monitorport.print(buff);
     //Monitorport.println(F(" SD File opened"));
+    DTSD_resetWrite(true);
     return true;
   }
   else
@@ -339,6 +376,7 @@ bool DTSD_openFileWrite(char *buff, uint32_t position)
 {
   dataFile = SD.open(buff, FILE_WRITE);   //seems to operate as append
   dataFile.seek(position);                //seek to first position in file
+  DTSD_resetWrite(false);                 //not written from the start, the write CRC is not of the file
 
   if (dataFile)
   {
@@ -376,19 +414,107 @@ uint8_t DTSD_readFileSegment(uint8_t *buff, uint8_t segmentsize)
 
 uint8_t DTSD_writeSegmentFile(uint8_t *buff, uint8_t segmentsize)
 {
-  uint8_t index, byteswritten = 0;
+  //the segment is copied into the sector being filled, when that is full the rest goes into the other
+  //sector and the full one is written by DTSD_writePending() or by the next DTSD_writeSegmentFile()
+
+  DTSD_writeCRC = LTCRCCCITTUpdate(DTSD_writeCRC, buff, segmentsize);
+  DTSD_writeLength = DTSD_writeLength + segmentsize;
+
+#if (DTSDWriteBufferSize > 0)
+  uint16_t part;
 
-  for (index = 0; index < segmentsize; index++)
+  DTSD_writePending();                               //the other sector may be needed for this segment
+
+  part = DTSDWriteBufferSize - DTSD_writeFill;
+
+  if (part > segmentsize)
   {
-    dataFile.write(buff[index]);
-    byteswritten++;
+    part = segmentsize;
   }
-  return byteswritten;
+
+  memcpy(&DTSD_writeBuffer[DTSD_writeSector][DTSD_writeFill], buff, part);
+  DTSD_writeFill = DTSD_writeFill + part;
+
+  if (DTSD_writeFill == DTSDWriteBufferSize)
+  {
+    DTSD_writeReady = true;
+    DTSD_writeSector = DTSD_writeSector ^ 1;
+    DTSD_writeFill = segmentsize - part;
+    memcpy(&DTSD_writeBuffer[DTSD_writeSector][0], &buff[part], DTSD_writeFill);
+  }
+
+  return segmentsize;
+#else
+  return (uint8_t) dataFile.write(buff, segmentsize);
+#endif
+}
+
+
+bool DTSD_writePending()
+{
+  //writes the full sector if there is one, call when there is time to spare such as while waiting to
+  //send an ACK. Returns false if the card did not take all of it
+
+#if (DTSDWriteBufferSize > 0)
+  if (DTSD_writeReady)
+  {
+    DTSD_writeReady = false;
+    return (dataFile.write(DTSD_writeBuffer[DTSD_writeSector ^ 1], DTSDWriteBufferSize) == DTSDWriteBufferSize);
+  }
+#endif
+
+  return true;
+}
+
+
+void DTSD_writeBuffered()
+{
+  //writes the full sector and the part filled one, the next segment starts a new sector
+
+#if (DTSDWriteBufferSize > 0)
+  DTSD_writePending();
+
+  if (DTSD_writeFill > 0)
+  {
+    dataFile.write(DTSD_writeBuffer[DTSD_writeSector], DTSD_writeFill);
+    DTSD_writeFill = 0;
+  }
+#endif
+}
+
+
+void DTSD_resetWrite(bool fromstart)
+{
+  //empties the sectors without writing them and restarts the write CRC
+
+#if (DTSDWriteBufferSize > 0)
+  DTSD_writeFill = 0;
+  DTSD_writeSector = 0;
+  DTSD_writeReady = false;
+#endif
+  DTSD_writeCRC = 0xFFFF;                            //start value for CRC16
+  DTSD_writeLength = 0;
+  DTSD_writeCRCValid = fromstart;
+}
+
+
+uint16_t DTSD_getWriteCRC(uint32_t fsize)
+{
+  //CRC of the file from the segments as they were written, if the file was written from the start with
+  //DTSD_writeSegmentFile() and is fsize long, else the file is read back, it must be open for read
+
+  if (DTSD_writeCRCValid && (DTSD_writeLength == fsize))
+  {
+    return DTSD_writeCRC;
+  }
+
+  return DTSD_fileCRCCCITT(fsize);
 }
 
 
 void DTSD_seekFileLocation(uint32_t position)
 {
+  DTSD_writeBuffered();                          //anything buffered belongs at the old position
   dataFile.seek(position);                       //seek to position in file
   return;
 }
@@ -420,29 +546,25 @@ uint16_t DTSD_createFile(char *buff)
     return 0;
   }
 
+  DTSD_resetWrite(true);
   return index;                                      //return number of logfile created
 }
 
 
 uint16_t DTSD_fileCRCCCITT(uint32_t fsize)
 {
+  //reads the file in blocks and CRCs each block, much faster than a byte at a time read
   uint32_t index;
-  uint16_t CRCcalc;
-  uint8_t j, filedata;
+  uint16_t CRCcalc, blocksize;
+  uint8_t filedata[64];
 
   CRCcalc = 0xFFFF;                                  //start value for CRC16
 
-  for (index = 0; index < fsize; index++)
+  for (index = 0; index < fsize; index = index + blocksize)
   {
-    filedata = dataFile.read();
-    CRCcalc ^= (((uint16_t) filedata ) << 8);
-    for (j = 0; j < 8; j++)
-    {
-      if (CRCcalc & 0x8000)
-        CRCcalc = (CRCcalc << 1) ^ 0x1021;
-      else
-        CRCcalc <<= 1;
-    }
+    blocksize = ((fsize - index) < sizeof(filedata)) ? (fsize - index) : sizeof(filedata);
+    dataFile.read(filedata, blocksize);
+    CRCcalc = LTCRCCCITTUpdate(CRCcalc, filedata, blocksize);
   }
 
   return CRCcalc;
@@ -451,11 +573,13 @@ uint16_t DTSD_fileCRCCCITT(uint32_t fsize)
 
 void DTSD_fileFlush()
 {
+  DTSD_writeBuffered();
   dataFile.flush();
 }
 
 
 void DTSD_closeFile()
 {
+  DTSD_writeBuffered();                               //write what is left of the segments
   dataFile.close();                                   //close local file
 }
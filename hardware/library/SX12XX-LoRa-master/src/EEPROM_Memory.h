@@ -32,6 +32,14 @@ void writeMemoryUint8(uint16_t addr, uint8_t x)
 }
 
 
+uint8_t readMemoryUint8(uint16_t addr)
+{
+  uint8_t x;
+  EEPROM.get(addr, x);
+  return x;
+}
+
+
 uint16_t readMemoryUint16(uint16_t addr)
 {
   uint16_t x;
@@ -13,6 +13,7 @@
 *******************************************************************************************************/
 
 #include <Wire.h>
+#include <LTCRC.h>
 
 int16_t Memory_I2C_Addr = 0x50;              //default I2C address of MB85RC16PNF FRAM
 
@@ -365,20 +366,12 @@ float readMemoryFloat(uint16_t addr)
 uint16_t CRCMemory(uint16_t startaddr, uint16_t endaddr, uint16_t startval)
 {
   uint16_t i, libraryCRC;
-  uint8_t j;
 
   libraryCRC = startval;                                     //start value for CRC16, often 0xffff
 
   for (i = startaddr; i <= endaddr; i++)                     //element 4 is first character after $$$$ at start
   {
-    libraryCRC ^= ((uint16_t)readMemoryUint8(i) << 8);
-    for (j = 0; j < 8; j++)
-    {
-      if (libraryCRC & 0x8000)
-        libraryCRC = (libraryCRC << 1) ^ 0x1021;
-      else
-        libraryCRC <<= 1;
-    }
+    libraryCRC = LTCRCCCITTByte(libraryCRC, readMemoryUint8(i));
   }
   return libraryCRC;
 
@@ -0,0 +1,303 @@
+/*
+  Licensed under a MIT license displayed at the bottom of this document.
+  Original published 16/10/26, adaptive data rate for reliable packet links
+*/
+
+/*
+  Adaptive data rate for a master that exchanges reliable packets with a slave. The master feeds the RSSI
+  and SNR of each ACK it receives into an LTADR, which keeps them over a window of LTADRWindow exchanges
+  and works out the link margin, how far the link is above the limit of the current spreading factor and
+  bandwidth. A margin of more than LTADRStepdB above the installation margin set with setMargin() moves
+  the link to a faster rate and then to lower TX power, a margin below it raises the TX power and then
+  moves to a slower rate, one step per LTADRStepdB.
+
+  A full window is needed before a faster rate or lower power is proposed, half a window is enough when
+  the margin has gone below the installation margin.
+
+  The change is negotiated with the slave in a reliable packet carrying an ADR request, see
+  buildRequest() and readRequest(). The slave applies it after it has sent the ACK, the master when it
+  receives the ACK, so both ends switch together. If the ACK is lost the two ends no longer match, the
+  master then calls fallback() when the exchange fails and the slave calls it when it has heard nothing
+  for a while, so both meet again at the fallback settings, the slowest rate at the highest TX power.
+  A link that fails because the wristband has moved out of range recovers the same way. A slave that has
+  been reset is back at the start settings, so when an exchange fails at the fallback settings the master
+  goes to the start settings with restart(), and the two alternate until the slave answers. The slave
+  should only fall back once it has had an ADR request, so it still works with a master without ADR.
+
+  Rates, 0 is the most robust;
+
+  0 - SF12 BW125    2 - SF10 BW125    4 - SF8 BW125    6 - SF7 BW250
+  1 - SF11 BW125    3 - SF9 BW125     5 - SF7 BW125
+
+  The spreading factor and bandwidth for a rate are returned with the constants of the driver included
+  before this file, so it can be used with SX126XLT and SX127XLT. SX128XLT has no 125kHz bandwidth.
+*/
+
+#ifndef LTADR_h
+#define LTADR_h
+
+#include <Arduino.h>
+
+#ifndef LTADRWindow
+#define LTADRWindow 8                         //ACKs averaged before a change is proposed
+#endif
+#define LTADRRates 7
+#define LTADRStepdB 3                         //margin per rate or TX power step
+#define LTADRRequest 0xC8                     //packet type of an ADR request, byte 0 of the payload
+#define LTADRRequestL 3
+
+
+//demodulator SNR limit and sensitivity, dBm, of each rate on the SX127X datasheet, rounded down
+static const int8_t LTADRSNRlimit[LTADRRates] = {-20, -18, -15, -13, -10, -8, -8};
+static const int16_t LTADRSensitivity[LTADRRates] = {-137, -134, -132, -129, -126, -123, -120};
+
+
+class LTADR
+{
+  public:
+
+    LTADR()
+    {
+      begin(5, 10);
+    }
+
+    void begin(uint8_t rate, int8_t txpower, uint8_t minrate = 0, uint8_t maxrate = (LTADRRates - 1), int8_t minpower = 2, int8_t maxpower = 17)
+    {
+      //rate and txpower are the settings used at start up, fallback() goes to minrate at maxpower
+
+      _minRate = minrate;
+      _maxRate = (maxrate < LTADRRates) ? maxrate : (LTADRRates - 1);
+      _minPower = minpower;
+      _maxPower = maxpower;
+      _margin = 10;
+      _startRate = constrain(rate, _minRate, _maxRate);
+      _startPower = constrain(txpower, _minPower, _maxPower);
+      restart();
+    }
+
+    void setMargin(int8_t dB)
+    {
+      //installation margin kept above the demodulator limit, for fading and body loss
+      _margin = dB;
+    }
+
+    void addSample(int16_t rssi, int8_t snr)
+    {
+      //RSSI and SNR of an ACK received at the current settings
+
+      if (_samples == LTADRWindow)
+      {
+        _RSSItotal -= _RSSI[_next];
+        _SNRtotal -= _SNR[_next];
+        _samples--;
+      }
+
+      _RSSI[_next] = rssi;                    //int16_t, the SF11 and SF12 sensitivities are below -128dBm
+      _SNR[_next] = snr;
+      _RSSItotal += rssi;
+      _SNRtotal += snr;
+      _samples++;
+      _next = (_next + 1) % LTADRWindow;
+      _failures = 0;
+    }
+
+    void addFailure()
+    {
+      //an exchange that got no ACK at all
+      _failures++;
+    }
+
+    uint8_t getFailures()
+    {
+      return _failures;
+    }
+
+    int8_t getLinkMargin()
+    {
+      //mean margin above the demodulator limit over the window, less the installation margin
+
+      int16_t snrmargin, rssimargin;
+
+      if (_samples == 0)
+      {
+        return 0;
+      }
+
+      snrmargin = (_SNRtotal / _samples) - LTADRSNRlimit[_rate];
+      rssimargin = (_RSSItotal / _samples) - LTADRSensitivity[_rate];
+
+      //the SNR reported by the device tops out at around +10dB, so a strong link is measured by the RSSI
+      if (rssimargin < snrmargin)
+      {
+        snrmargin = rssimargin;
+      }
+
+      return (int8_t) constrain(snrmargin - _margin, -127, 127);
+    }
+
+    bool getProposal(uint8_t &rate, int8_t &txpower)
+    {
+      //true when a full window is held and it calls for different settings, which are returned in rate
+      //and txpower
+
+      int8_t steps;
+
+      rate = _rate;
+      txpower = _power;
+
+      if (_samples < (LTADRWindow / 2))
+      {
+        return false;
+      }
+
+      steps = getLinkMargin() / LTADRStepdB;
+
+      if ((_samples < LTADRWindow) && (steps >= 0))
+      {
+        return false;
+      }
+
+      while ((steps > 0) && (rate < _maxRate))
+      {
+        rate++;
+        steps--;
+      }
+
+      while ((steps > 0) && (txpower > _minPower))
+      {
+        txpower = constrain(txpower - LTADRStepdB, _minPower, _maxPower);
+        steps--;
+      }
+
+      while ((steps < 0) && (txpower < _maxPower))
+      {
+        txpower = constrain(txpower + LTADRStepdB, _minPower, _maxPower);
+        steps++;
+      }
+
+      while ((steps < 0) && (rate > _minRate))
+      {
+        rate--;
+        steps++;
+      }
+
+      return (rate != _rate) || (txpower != _power);
+    }
+
+    void apply(uint8_t rate, int8_t txpower)
+    {
+      //both ends have switched, samples taken at the old settings are of no further use
+
+      _rate = constrain(rate, _minRate, _maxRate);
+      _power = constrain(txpower, _minPower, _maxPower);
+      _samples = 0;
+      _next = 0;
+      _RSSItotal = 0;
+      _SNRtotal = 0;
+      _failures = 0;
+    }
+
+    void fallback()
+    {
+      apply(_minRate, _maxPower);
+    }
+
+    void restart()
+    {
+      apply(_startRate, _startPower);
+    }
+
+    bool isFallback()
+    {
+      return (_rate == _minRate) && (_power == _maxPower);
+    }
+
+    uint8_t getRate()
+    {
+      return _rate;
+    }
+
+    int8_t getTXpower()
+    {
+      return _power;
+    }
+
+    static uint8_t getSF(uint8_t rate)
+    {
+      return (rate < 5) ? (LORA_SF12 - rate) : LORA_SF7;
+    }
+
+    static uint8_t getBandwidth(uint8_t rate)
+    {
+      return (rate < 6) ? LORA_BW_125 : LORA_BW_250;
+    }
+
+    static uint32_t getSymbolTimeuS(uint8_t rate)
+    {
+      //for stretching timeouts that were set for SF7 BW125, a packet and its ACK at rate 0 take 35 to 40
+      //symbols, over a second
+      return (((uint32_t) 1 << getSF(rate)) * 1000) / ((rate < 6) ? 125 : 250);
+    }
+
+    static uint8_t buildRequest(uint8_t *buff, uint8_t rate, int8_t txpower)
+    {
+      //payload of the reliable packet that asks the slave to switch, returns its length
+      buff[0] = LTADRRequest;
+      buff[1] = rate;
+      buff[2] = (uint8_t) txpower;
+      return LTADRRequestL;
+    }
+
+    static bool readRequest(const uint8_t *buff, uint8_t size, uint8_t &rate, int8_t &txpower)
+    {
+      //true if the payload received is a valid ADR request
+      if ((size != LTADRRequestL) || (buff[0] != LTADRRequest) || (buff[1] >= LTADRRates))
+      {
+        return false;
+      }
+
+      rate = buff[1];
+      txpower = (int8_t) buff[2];
+      return true;
+    }
+
+  private:
+
+    uint8_t _rate, _startRate, _minRate, _maxRate;
+    int8_t _power, _startPower, _minPower, _maxPower;
+    int8_t _margin;
+    int16_t _RSSI[LTADRWindow];
+    int8_t _SNR[LTADRWindow];
+    int16_t _RSSItotal, _SNRtotal;
+    uint8_t _samples, _next;
+    uint8_t _failures;
+};
+
+
+template <class LTclass>
+void LTADRsetup(LTclass &LT, uint32_t frequency, uint8_t rate)
+{
+  //configure the device for rate, coding rate 4/5
+  LT.setupLoRa(frequency, 0, LTADR::getSF(rate), LTADR::getBandwidth(rate), LORA_CR_4_5, LDRO_AUTO);
+}
+
+#endif
+
+/*
+  MIT license
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+  associated documentation files (the "Software"), to deal in the Software without restriction, including
+  without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the
+  following conditions:
+
+  The above copyright notice and this permission notice shall be included in all copies or substantial
+  portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+  LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO
+  EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+  IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE
+  USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
@@ -0,0 +1,104 @@
+/*
+  Licensed under a MIT license displayed at the bottom of this document.
+  Original published 16/10/26, LoRa time on air and timeouts
+*/
+
+/*
+  Time on air of a LoRa packet from the Semtech datasheet formula, for the SX126X, SX127X and SX128X. The
+  functions are constexpr, so with constant settings the airtime is worked out by the compiler, and they
+  take the settings as plain numbers, so they do not depend on the constants of any one driver. Each
+  driver has getTimeOnAiruS(), which reads its current settings and calls LTAirtimeuS().
+
+  bandwidth     Hz, 125000 for BW125, 203125 for the SX128X 200kHz
+  sf            spreading factor, 5 to 12
+  cr            coding rate denominator, 5 to 8 for 4/5 to 4/8
+  preamble      programmed preamble symbols, the device adds 4.25
+  packetL       bytes in the packet, for a reliable packet the payload and its 4 bytes
+  crc           payload CRC on
+  implicit      implicit header mode, no header sent
+  ldro          low data rate optimisation on, for the SX128X set it for SF11 and SF12
+  shortsf       SF5 and SF6 of the SX126X and SX128X, 6.25 symbols after the preamble and no 8 bit offset
+
+  For a reliable exchange LTAirtimeTXTimeoutmS() and LTAirtimeACKTimeoutmS() give timeouts that cover
+  the packet and the ACK with LTAirtimeMarginmS to spare, in place of fixed timeouts that have to allow
+  for the slowest rate. A failed attempt then only waits as long as its ACK could take.
+*/
+
+#ifndef LTAirtime_h
+#define LTAirtime_h
+
+#include <Arduino.h>
+
+#ifndef LTAirtimeMarginmS
+#define LTAirtimeMarginmS 100                 //added to each timeout, so a resend finds the slave back in RX
+#endif
+
+
+constexpr uint32_t LTAirtimeSymboluS(uint32_t bandwidth, uint8_t sf)
+{
+  //symbol time in uS, rounded down
+  return (uint32_t) ((((uint64_t) 1 << sf) * 1000000) / bandwidth);
+}
+
+
+constexpr uint32_t LTAirtimeCeil(int32_t bits, uint32_t perblock)
+{
+  return (bits <= 0) ? 0 : (((uint32_t) bits + perblock - 1) / perblock);
+}
+
+
+constexpr uint32_t LTAirtimePayloadSymbols(uint8_t sf, uint8_t cr, uint8_t packetL, bool crc, bool implicit, bool ldro, bool shortsf)
+{
+  //symbols after the preamble, 8 plus the coded blocks of header, payload and CRC
+  return 8 + (LTAirtimeCeil((8 * (int32_t) packetL) + (crc ? 16 : 0) - (4 * (int32_t) sf) + (shortsf ? 0 : 8) + (implicit ? 0 : 20),
+                            4 * (sf - (ldro ? 2 : 0))) * cr);
+}
+
+
+constexpr uint32_t LTAirtimeQuarterSymbols(uint8_t sf, uint8_t cr, uint16_t preamble, uint8_t packetL, bool crc, bool implicit, bool ldro, bool shortsf)
+{
+  //the whole packet in quarter symbols, so the 4.25 and 6.25 symbols after the preamble stay exact
+  return (4 * (uint32_t) preamble) + (shortsf ? 25 : 17) + (4 * LTAirtimePayloadSymbols(sf, cr, packetL, crc, implicit, ldro, shortsf));
+}
+
+
+constexpr uint32_t LTAirtimeuS(uint32_t bandwidth, uint8_t sf, uint8_t cr, uint16_t preamble, uint8_t packetL, bool crc, bool implicit, bool ldro, bool shortsf = false)
+{
+  return (uint32_t) ((((uint64_t) LTAirtimeQuarterSymbols(sf, cr, preamble, packetL, crc, implicit, ldro, shortsf) << sf) * 250000) / bandwidth);
+}
+
+
+constexpr uint32_t LTAirtimeTXTimeoutmS(uint32_t packetuS)
+{
+  //TX timeout of a packet of packetuS, from getTimeOnAiruS()
+  return ((packetuS + 999) / 1000) + LTAirtimeMarginmS;
+}
+
+
+constexpr uint32_t LTAirtimeACKTimeoutmS(uint32_t ackdelaymS, uint32_t ackuS)
+{
+  //ACK timeout of a reliable packet, the ACK delay of the slave and the ACK, getTimeOnAiruS(4). The
+  //drivers go on waiting while an ACK that started in time is being received
+  return ackdelaymS + ((ackuS + 999) / 1000) + LTAirtimeMarginmS;
+}
+
+#endif
+
+/*
+  MIT license
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+  associated documentation files (the "Software"), to deal in the Software without restriction, including
+  without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the
+  following conditions:
+
+  The above copyright notice and this permission notice shall be included in all copies or substantial
+  portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+  LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO
+  EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+  IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE
+  USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
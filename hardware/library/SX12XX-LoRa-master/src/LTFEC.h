@@ -0,0 +1,247 @@
+/*
+  Licensed under a MIT license displayed at the bottom of this document.
+  Original published 16/10/26, erasure code for the SX12XX-LoRa data transfer functions
+*/
+
+/*
+  Reed-Solomon erasure code over GF(256), used by ARtransfer.h to send repair segments along with a group
+  of data segments so that the receiver can rebuild lost segments without asking for them again.
+
+  Repair segment j of a group of k data segments d0 to dk-1 is the sum of LTFECCoefficient(j, i) * di. The
+  coefficients are a Cauchy matrix, 1 / (xj + yi) with xj = 0x80 + j and yi = i, every square part of which
+  can be inverted, so any k of the k data and m repair segments are enough to rebuild the whole group. Up
+  to 32 data segments and 128 repair segments per group are supported.
+
+  Arithmetic is in GF(256) with polynomial 0x11D, addition is XOR and multiplication is done with log and
+  antilog tables, 766 bytes of flash.
+
+  LTFECMulAdd()  - dst = dst + coefficient * src, builds a repair segment one data segment at a time
+  LTFECScale()   - dst = coefficient * dst
+  LTFECSolve()   - solves n equations for the n lost segments, rows are the repair segments with the
+                   received segments already taken out
+*/
+
+#ifndef LTFEC_h
+#define LTFEC_h
+
+#include <Arduino.h>
+
+#ifndef pgm_read_byte
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+#endif
+
+#define LTFECMaxData 32                       //data segments in a group, yi = i must stay below xj = 0x80
+
+//antilog table, LTFECexp[n] = 2^n, repeated so that LTFECexp[log a + log b] needs no modulo
+static const uint8_t LTFECexp[510] PROGMEM =
+{
+  0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x1D, 0x3A, 0x74, 0xE8, 0xCD, 0x87, 0x13, 0x26,
+  0x4C, 0x98, 0x2D, 0x5A, 0xB4, 0x75, 0xEA, 0xC9, 0x8F, 0x03, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC0,
+  0x9D, 0x27, 0x4E, 0x9C, 0x25, 0x4A, 0x94, 0x35, 0x6A, 0xD4, 0xB5, 0x77, 0xEE, 0xC1, 0x9F, 0x23,
+  0x46, 0x8C, 0x05, 0x0A, 0x14, 0x28, 0x50, 0xA0, 0x5D, 0xBA, 0x69, 0xD2, 0xB9, 0x6F, 0xDE, 0xA1,
+  0x5F, 0xBE, 0x61, 0xC2, 0x99, 0x2F, 0x5E, 0xBC, 0x65, 0xCA, 0x89, 0x0F, 0x1E, 0x3C, 0x78, 0xF0,
+  0xFD, 0xE7, 0xD3, 0xBB, 0x6B, 0xD6, 0xB1, 0x7F, 0xFE, 0xE1, 0xDF, 0xA3, 0x5B, 0xB6, 0x71, 0xE2,
+  0xD9, 0xAF, 0x43, 0x86, 0x11, 0x22, 0x44, 0x88, 0x0D, 0x1A, 0x34, 0x68, 0xD0, 0xBD, 0x67, 0xCE,
+  0x81, 0x1F, 0x3E, 0x7C, 0xF8, 0xED, 0xC7, 0x93, 0x3B, 0x76, 0xEC, 0xC5, 0x97, 0x33, 0x66, 0xCC,
+  0x85, 0x17, 0x2E, 0x5C, 0xB8, 0x6D, 0xDA, 0xA9, 0x4F, 0x9E, 0x21, 0x42, 0x84, 0x15, 0x2A, 0x54,
+  0xA8, 0x4D, 0x9A, 0x29, 0x52, 0xA4, 0x55, 0xAA, 0x49, 0x92, 0x39, 0x72, 0xE4, 0xD5, 0xB7, 0x73,
+  0xE6, 0xD1, 0xBF, 0x63, 0xC6, 0x91, 0x3F, 0x7E, 0xFC, 0xE5, 0xD7, 0xB3, 0x7B, 0xF6, 0xF1, 0xFF,
+  0xE3, 0xDB, 0xAB, 0x4B, 0x96, 0x31, 0x62, 0xC4, 0x95, 0x37, 0x6E, 0xDC, 0xA5, 0x57, 0xAE, 0x41,
+  0x82, 0x19, 0x32, 0x64, 0xC8, 0x8D, 0x07, 0x0E, 0x1C, 0x38, 0x70, 0xE0, 0xDD, 0xA7, 0x53, 0xA6,
+  0x51, 0xA2, 0x59, 0xB2, 0x79, 0xF2, 0xF9, 0xEF, 0xC3, 0x9B, 0x2B, 0x56, 0xAC, 0x45, 0x8A, 0x09,
+  0x12, 0x24, 0x48, 0x90, 0x3D, 0x7A, 0xF4, 0xF5, 0xF7, 0xF3, 0xFB, 0xEB, 0xCB, 0x8B, 0x0B, 0x16,
+  0x2C, 0x58, 0xB0, 0x7D, 0xFA, 0xE9, 0xCF, 0x83, 0x1B, 0x36, 0x6C, 0xD8, 0xAD, 0x47, 0x8E, 0x01,
+  0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x1D, 0x3A, 0x74, 0xE8, 0xCD, 0x87, 0x13, 0x26, 0x4C,
+  0x98, 0x2D, 0x5A, 0xB4, 0x75, 0xEA, 0xC9, 0x8F, 0x03, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC0, 0x9D,
+  0x27, 0x4E, 0x9C, 0x25, 0x4A, 0x94, 0x35, 0x6A, 0xD4, 0xB5, 0x77, 0xEE, 0xC1, 0x9F, 0x23, 0x46,
+  0x8C, 0x05, 0x0A, 0x14, 0x28, 0x50, 0xA0, 0x5D, 0xBA, 0x69, 0xD2, 0xB9, 0x6F, 0xDE, 0xA1, 0x5F,
+  0xBE, 0x61, 0xC2, 0x99, 0x2F, 0x5E, 0xBC, 0x65, 0xCA, 0x89, 0x0F, 0x1E, 0x3C, 0x78, 0xF0, 0xFD,
+  0xE7, 0xD3, 0xBB, 0x6B, 0xD6, 0xB1, 0x7F, 0xFE, 0xE1, 0xDF, 0xA3, 0x5B, 0xB6, 0x71, 0xE2, 0xD9,
+  0xAF, 0x43, 0x86, 0x11, 0x22, 0x44, 0x88, 0x0D, 0x1A, 0x34, 0x68, 0xD0, 0xBD, 0x67, 0xCE, 0x81,
+  0x1F, 0x3E, 0x7C, 0xF8, 0xED, 0xC7, 0x93, 0x3B, 0x76, 0xEC, 0xC5, 0x97, 0x33, 0x66, 0xCC, 0x85,
+  0x17, 0x2E, 0x5C, 0xB8, 0x6D, 0xDA, 0xA9, 0x4F, 0x9E, 0x21, 0x42, 0x84, 0x15, 0x2A, 0x54, 0xA8,
+  0x4D, 0x9A, 0x29, 0x52, 0xA4, 0x55, 0xAA, 0x49, 0x92, 0x39, 0x72, 0xE4, 0xD5, 0xB7, 0x73, 0xE6,
+  0xD1, 0xBF, 0x63, 0xC6, 0x91, 0x3F, 0x7E, 0xFC, 0xE5, 0xD7, 0xB3, 0x7B, 0xF6, 0xF1, 0xFF, 0xE3,
+  0xDB, 0xAB, 0x4B, 0x96, 0x31, 0x62, 0xC4, 0x95, 0x37, 0x6E, 0xDC, 0xA5, 0x57, 0xAE, 0x41, 0x82,
+  0x19, 0x32, 0x64, 0xC8, 0x8D, 0x07, 0x0E, 0x1C, 0x38, 0x70, 0xE0, 0xDD, 0xA7, 0x53, 0xA6, 0x51,
+  0xA2, 0x59, 0xB2, 0x79, 0xF2, 0xF9, 0xEF, 0xC3, 0x9B, 0x2B, 0x56, 0xAC, 0x45, 0x8A, 0x09, 0x12,
+  0x24, 0x48, 0x90, 0x3D, 0x7A, 0xF4, 0xF5, 0xF7, 0xF3, 0xFB, 0xEB, 0xCB, 0x8B, 0x0B, 0x16, 0x2C,
+  0x58, 0xB0, 0x7D, 0xFA, 0xE9, 0xCF, 0x83, 0x1B, 0x36, 0x6C, 0xD8, 0xAD, 0x47, 0x8E
+};
+
+//log table, LTFEClog[0] is not used
+static const uint8_t LTFEClog[256] PROGMEM =
+{
+  0x00, 0x00, 0x01, 0x19, 0x02, 0x32, 0x1A, 0xC6, 0x03, 0xDF, 0x33, 0xEE, 0x1B, 0x68, 0xC7, 0x4B,
+  0x04, 0x64, 0xE0, 0x0E, 0x34, 0x8D, 0xEF, 0x81, 0x1C, 0xC1, 0x69, 0xF8, 0xC8, 0x08, 0x4C, 0x71,
+  0x05, 0x8A, 0x65, 0x2F, 0xE1, 0x24, 0x0F, 0x21, 0x35, 0x93, 0x8E, 0xDA, 0xF0, 0x12, 0x82, 0x45,
+  0x1D, 0xB5, 0xC2, 0x7D, 0x6A, 0x27, 0xF9, 0xB9, 0xC9, 0x9A, 0x09, 0x78, 0x4D, 0xE4, 0x72, 0xA6,
+  0x06, 0xBF, 0x8B, 0x62, 0x66, 0xDD, 0x30, 0xFD, 0xE2, 0x98, 0x25, 0xB3, 0x10, 0x91, 0x22, 0x88,
+  0x36, 0xD0, 0x94, 0xCE, 0x8F, 0x96, 0xDB, 0xBD, 0xF1, 0xD2, 0x13, 0x5C, 0x83, 0x38, 0x46, 0x40,
+  0x1E, 0x42, 0xB6, 0xA3, 0xC3, 0x48, 0x7E, 0x6E, 0x6B, 0x3A, 0x28, 0x54, 0xFA, 0x85, 0xBA, 0x3D,
+  0xCA, 0x5E, 0x9B, 0x9F, 0x0A, 0x15, 0x79, 0x2B, 0x4E, 0xD4, 0xE5, 0xAC, 0x73, 0xF3, 0xA7, 0x57,
+  0x07, 0x70, 0xC0, 0xF7, 0x8C, 0x80, 0x63, 0x0D, 0x67, 0x4A, 0xDE, 0xED, 0x31, 0xC5, 0xFE, 0x18,
+  0xE3, 0xA5, 0x99, 0x77, 0x26, 0xB8, 0xB4, 0x7C, 0x11, 0x44, 0x92, 0xD9, 0x23, 0x20, 0x89, 0x2E,
+  0x37, 0x3F, 0xD1, 0x5B, 0x95, 0xBC, 0xCF, 0xCD, 0x90, 0x87, 0x97, 0xB2, 0xDC, 0xFC, 0xBE, 0x61,
+  0xF2, 0x56, 0xD3, 0xAB, 0x14, 0x2A, 0x5D, 0x9E, 0x84, 0x3C, 0x39, 0x53, 0x47, 0x6D, 0x41, 0xA2,
+  0x1F, 0x2D, 0x43, 0xD8, 0xB7, 0x7B, 0xA4, 0x76, 0xC4, 0x17, 0x49, 0xEC, 0x7F, 0x0C, 0x6F, 0xF6,
+  0x6C, 0xA1, 0x3B, 0x52, 0x29, 0x9D, 0x55, 0xAA, 0xFB, 0x60, 0x86, 0xB1, 0xBB, 0xCC, 0x3E, 0x5A,
+  0xCB, 0x59, 0x5F, 0xB0, 0x9C, 0xA9, 0xA0, 0x51, 0x0B, 0xF5, 0x16, 0xEB, 0x7A, 0x75, 0x2C, 0xD7,
+  0x4F, 0xAE, 0xD5, 0xE9, 0xE6, 0xE7, 0xAD, 0xE8, 0x74, 0xD6, 0xF4, 0xEA, 0xA8, 0x50, 0x58, 0xAF
+};
+
+
+static inline uint8_t LTFECMul(uint8_t a, uint8_t b)
+{
+  if ((a == 0) || (b == 0))
+  {
+    return 0;
+  }
+
+  return pgm_read_byte(&LTFECexp[pgm_read_byte(&LTFEClog[a]) + pgm_read_byte(&LTFEClog[b])]);
+}
+
+
+static inline uint8_t LTFECInverse(uint8_t a)
+{
+  //a must not be 0
+  return pgm_read_byte(&LTFECexp[255 - pgm_read_byte(&LTFEClog[a])]);
+}
+
+
+static inline uint8_t LTFECCoefficient(uint8_t repair, uint8_t segment)
+{
+  //Cauchy matrix entry for repair segment number repair and data segment number segment within the group
+  return LTFECInverse((uint8_t) ((0x80 + repair) ^ segment));
+}
+
+
+static inline void LTFECMulAdd(uint8_t *dst, const uint8_t *src, uint8_t coefficient, uint16_t size)
+{
+  //dst = dst + coefficient * src, for size bytes
+
+  uint16_t logc, index;
+  uint8_t data;
+
+  if (coefficient == 0)
+  {
+    return;
+  }
+
+  logc = pgm_read_byte(&LTFEClog[coefficient]);
+
+  for (index = 0; index < size; index++)
+  {
+    data = src[index];
+
+    if (data)
+    {
+      dst[index] ^= pgm_read_byte(&LTFECexp[pgm_read_byte(&LTFEClog[data]) + logc]);
+    }
+  }
+}
+
+
+static inline void LTFECScale(uint8_t *dst, uint8_t coefficient, uint16_t size)
+{
+  //dst = coefficient * dst, for size bytes, coefficient must not be 0
+
+  uint16_t logc, index;
+  uint8_t data;
+
+  logc = pgm_read_byte(&LTFEClog[coefficient]);
+
+  for (index = 0; index < size; index++)
+  {
+    data = dst[index];
+
+    if (data)
+    {
+      dst[index] = pgm_read_byte(&LTFECexp[pgm_read_byte(&LTFEClog[data]) + logc]);
+    }
+  }
+}
+
+
+static inline bool LTFECSolve(uint8_t *matrix, uint8_t n, uint8_t **rows, uint16_t size)
+{
+  //Gauss-Jordan elimination of the n x n matrix, row major, applied to the n row buffers of size bytes
+  //as well. On return rows[u] holds lost segment u, the row pointers are swapped rather than the data.
+  //Returns false if the matrix cannot be inverted, which does not happen for a Cauchy matrix.
+
+  uint8_t column, row, pivot, index, factor, temp;
+  uint8_t *tempptr;
+
+  for (column = 0; column < n; column++)
+  {
+    for (pivot = column; (pivot < n) && (matrix[(pivot * n) + column] == 0); pivot++);
+
+    if (pivot == n)
+    {
+      return false;
+    }
+
+    if (pivot != column)
+    {
+      for (index = 0; index < n; index++)
+      {
+        temp = matrix[(pivot * n) + index];
+        matrix[(pivot * n) + index] = matrix[(column * n) + index];
+        matrix[(column * n) + index] = temp;
+      }
+
+      tempptr = rows[pivot];
+      rows[pivot] = rows[column];
+      rows[column] = tempptr;
+    }
+
+    factor = LTFECInverse(matrix[(column * n) + column]);
+
+    for (index = 0; index < n; index++)
+    {
+      matrix[(column * n) + index] = LTFECMul(matrix[(column * n) + index], factor);
+    }
+
+    LTFECScale(rows[column], factor, size);
+
+    for (row = 0; row < n; row++)
+    {
+      factor = matrix[(row * n) + column];
+
+      if ((row == column) || (factor == 0))
+      {
+        continue;
+      }
+
+      for (index = 0; index < n; index++)
+      {
+        matrix[(row * n) + index] ^= LTFECMul(matrix[(column * n) + index], factor);
+      }
+
+      LTFECMulAdd(rows[row], rows[column], factor, size);
+    }
+  }
+
+  return true;
+}
+
+#endif
+
+/*
+  MIT license
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+  associated documentation files (the "Software"), to deal in the Software without restriction, including
+  without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the
+  following conditions:
+
+  The above copyright notice and this permission notice shall be included in all copies or substantial
+  portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+  LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO
+  EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+  IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE
+  USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
@@ -0,0 +1,153 @@
+/*
+  Licensed under a MIT license displayed at the bottom of this document.
+  Original published 16/10/26, feature schema
+
+  Generated by hardware/schema/generate_schema.py from hardware/schema/features.json, do not edit.
+*/
+
+/*
+  The features the Random Forest is trained on and the schemas, the sets of them a node can send. Each
+  feature has an id, the type and fixed point scale it is sent at in an LTTelemetry.h frame, the JSON key
+  the backend knows it by and the column it has in the serial CSV. The RSSI and SNR are link features,
+  measured by the radio of the master, not sent in the frame.
+
+  A firmware picks its schema at compile time and asks the tables what it has, LTSchema<schema>::has()
+  and the constexpr functions below fold to constants, so a feature not in the schema costs no code. The
+  schema id goes in byte 1 of each telemetry frame and in each sample sent to the backend, so the
+  receiver knows which features the sample has without being built for the same schema.
+
+  The dataset tool and the backend have the same tables in features.py, generated from the same file.
+*/
+
+#ifndef LTFeatures_h
+#define LTFeatures_h
+
+#include <Arduino.h>
+
+#define LTFeatureInt8 0                       //feature types
+#define LTFeatureUint8 1
+#define LTFeatureInt16 2
+#define LTFeatureUint16 3
+
+#define LTFeatureTemperature 1                //temperatura, C
+#define LTFeatureHumidity 2                   //humedad_relativa, %
+#define LTFeatureSoil 3                       //humedad_suelo, %
+#define LTFeatureRSSI 4                       //rssi, dBm
+#define LTFeatureSNR 5                        //snr, dB
+#define LTFeatureCount 5
+
+#define LTSchema2S 1                          //DHT11
+#define LTSchema3S 2                          //DHT11 + HW-080
+#define LTSchemaCount 2
+#define LTSchemaMaxFeatures 5
+#define LTSchemaMaxFrameBytes 4               //most bytes the sensor features of a schema take
+#define LTSchemaModel LTSchema2S              //schema the backend model is trained on
+#define LTSchemaDefault LTSchema2S
+
+
+struct LTFeatureInfo
+{
+  uint8_t type;
+  uint8_t scale;                              //sent as the reading times the scale
+  bool link;                                  //measured by the radio, not sent in the frame
+  const char *key;                            //JSON key of the backend
+  const char *column;                         //serial CSV column
+};
+
+constexpr LTFeatureInfo LTFeatureTable[LTFeatureCount] =
+{
+  {LTFeatureInt16, 100, false, "temperatura", "temp_C"},
+  {LTFeatureUint8, 2, false, "humedad_relativa", "hum_air_pct"},
+  {LTFeatureUint8, 1, false, "humedad_suelo", "soil_moisture_pct"},
+  {LTFeatureInt16, 1, true, "rssi", "rssi_dBm"},
+  {LTFeatureInt8, 1, true, "snr", "snr_dB"},
+};
+
+constexpr uint8_t LTSchemaTable[LTSchemaCount][LTSchemaMaxFeatures + 1] =
+{
+  {4, 1, 2, 4, 5, 0},        //2S, count then feature ids
+  {5, 1, 2, 3, 4, 5},        //3S, count then feature ids
+};
+
+
+constexpr bool LTSchemaValid(uint8_t schema)
+{
+  return (schema >= 1) && (schema <= LTSchemaCount);
+}
+
+constexpr uint8_t LTSchemaFeatures(uint8_t schema)
+{
+  //number of features in the schema
+  return LTSchemaTable[schema - 1][0];
+}
+
+constexpr uint8_t LTSchemaFeature(uint8_t schema, uint8_t index)
+{
+  //id of the feature at index, in the order of the CSV columns and the frame
+  return LTSchemaTable[schema - 1][index + 1];
+}
+
+constexpr bool LTSchemaHas(uint8_t schema, uint8_t id, uint8_t index = 0)
+{
+  return (index < LTSchemaMaxFeatures) && (index < LTSchemaFeatures(schema)) && ((LTSchemaFeature(schema, index) == id) || LTSchemaHas(schema, id, index + 1));
+}
+
+constexpr uint8_t LTFeatureBytes(uint8_t id)
+{
+  return ((LTFeatureTable[id - 1].type == LTFeatureInt16) || (LTFeatureTable[id - 1].type == LTFeatureUint16)) ? 2 : 1;
+}
+
+constexpr int32_t LTFeatureNoReading(uint8_t id)
+{
+  //value sent for a feature not read, outside the range of its type
+  return (LTFeatureTable[id - 1].type == LTFeatureInt8) ? -128 :
+         (LTFeatureTable[id - 1].type == LTFeatureUint8) ? 0xFF :
+         (LTFeatureTable[id - 1].type == LTFeatureInt16) ? -32768 : 0xFFFF;
+}
+
+constexpr uint8_t LTSchemaFrameBytes(uint8_t schema, uint8_t index = 0)
+{
+  //bytes the sensor features of the schema take in a telemetry frame
+  return ((index < LTSchemaMaxFeatures) && (index < LTSchemaFeatures(schema))) ?
+         ((LTFeatureTable[LTSchemaFeature(schema, index) - 1].link ? 0 : LTFeatureBytes(LTSchemaFeature(schema, index))) +
+          LTSchemaFrameBytes(schema, index + 1)) : 0;
+}
+
+
+template <uint8_t schema>
+struct LTSchema
+{
+  static_assert(LTSchemaValid(schema), "unknown feature schema, see hardware/schema/features.json");
+
+  static constexpr uint8_t features = LTSchemaFeatures(schema);
+  static constexpr uint8_t frameBytes = LTSchemaFrameBytes(schema);
+
+  static constexpr bool has(uint8_t id)
+  {
+    return LTSchemaHas(schema, id);
+  }
+};
+
+static_assert(LTSchemaFrameBytes(LTSchema2S) == 3, "LTFeatures.h out of step with features.json");
+static_assert(LTSchemaFrameBytes(LTSchema3S) == 4, "LTFeatures.h out of step with features.json");
+
+#endif
+
+/*
+  MIT license
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+  associated documentation files (the "Software"), to deal in the Software without restriction, including
+  without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the
+  following conditions:
+
+  The above copyright notice and this permission notice shall be included in all copies or substantial
+  portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+  LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO
+  EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+  IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE
+  USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
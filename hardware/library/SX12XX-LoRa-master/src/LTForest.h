@@ -0,0 +1,205 @@
+/*
+  Licensed under a MIT license displayed at the bottom of this document.
+  Original published 16/10/26, Random Forest inference
+*/
+
+/*
+  Runs the Random Forest of the backend on the hub, so a sample is classified where it is read and only
+  the result needs to go out. The model tables are generated from the trained model by
+  frontend_backend/my_iot_project/export_forest.py into LTForestModel.h.
+
+  Inputs are int16_t readings in hundredths, toInput(). The StandardScaler of the backend is folded into
+  the thresholds when the model is exported, each split node only compares an input with an integer and
+  the comparison is the index of the child taken, node.child[input > threshold]. The split nodes of all
+  trees are in one array of 8 byte nodes, a child or root with LTForestLeaf set is the index of a leaf.
+
+  predict() sums the class probabilities of the leaves in fixed point, leafFixed[], and picks the class
+  with the largest sum. Each leaf is rounded by at most half a unit, so when the best class leads the
+  next by more than the margin, one unit per tree, it is the class scikit-learn predicts. Closer than
+  that predict() falls back to predictExact(), which adds the leaf probabilities as doubles in tree order
+  and divides by the number of trees as RandomForestClassifier.predict_proba() does, so the result is
+  the same as the backend gets for the same readings, not just close to it.
+*/
+
+#ifndef LTForest_h
+#define LTForest_h
+
+#include <Arduino.h>
+
+#define LTForestLeaf 0x8000                   //set in a child or root index that is a leaf
+#define LTForestInputScale 100                //inputs are hundredths
+#define LTForestMaxClasses 8
+#define LTForestNoInput -32768                //reading out of the int16_t range
+
+
+struct LTForestNode
+{
+  uint16_t child[2];                          //left for input <= threshold, right for above
+  int16_t threshold;                          //hundredths
+  uint8_t input;                              //index in the inputs
+};
+
+
+struct LTForestModel
+{
+  uint16_t trees;
+  uint8_t inputs;
+  uint8_t classes;
+  uint8_t fixedShift;                         //fraction bits of leafFixed[]
+  int32_t margin;                             //lead under which predict() uses predictExact()
+  const LTForestNode *nodes;
+  const uint16_t *roots;                      //first node of each tree
+  const int32_t *leafFixed;                   //per leaf, the probability of each class in fixed point
+  const double *leafProba;                    //per leaf, the probability of each class as the model has it
+  const int16_t *labels;                      //label of each class
+};
+
+
+class LTForest
+{
+  public:
+
+    static int16_t toInput(float reading)
+    {
+      //reading to hundredths, rounded, LTForestNoInput if it does not fit or is not a number
+
+      float hundredths = reading * LTForestInputScale;
+
+      if (!(hundredths > -32767.5F) || !(hundredths < 32767.5F))
+      {
+        return LTForestNoInput;
+      }
+
+      return (int16_t) lroundf(hundredths);
+    }
+
+
+    static bool validInputs(const LTForestModel &model, const int16_t *inputs)
+    {
+      for (uint8_t index = 0; index < model.inputs; index++)
+      {
+        if (inputs[index] == LTForestNoInput)
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+
+    static int16_t predict(const LTForestModel &model, const int16_t *inputs, bool *exact = NULL)
+    {
+      //label of the class of inputs, exact set if it took predictExact()
+
+      int32_t sums[LTForestMaxClasses] = {0};
+      const int32_t *leaf;
+      uint8_t best = 0;
+      int32_t second = INT32_MIN;
+
+      for (uint16_t tree = 0; tree < model.trees; tree++)
+      {
+        leaf = &model.leafFixed[leafOf(model, tree, inputs) * model.classes];
+
+        for (uint8_t index = 0; index < model.classes; index++)
+        {
+          sums[index] += leaf[index];
+        }
+      }
+
+      for (uint8_t index = 1; index < model.classes; index++)
+      {
+        if (sums[index] > sums[best])
+        {
+          second = sums[best];
+          best = index;
+        }
+        else if (sums[index] > second)
+        {
+          second = sums[index];
+        }
+      }
+
+      if (exact != NULL)
+      {
+        *exact = ((sums[best] - second) <= model.margin);
+      }
+
+      if ((sums[best] - second) <= model.margin)
+      {
+        return predictExact(model, inputs);
+      }
+
+      return model.labels[best];
+    }
+
+
+    static int16_t predictExact(const LTForestModel &model, const int16_t *inputs)
+    {
+      //label of the class of inputs, with the arithmetic of RandomForestClassifier.predict()
+
+      double sums[LTForestMaxClasses] = {0};
+      const double *leaf;
+      uint8_t best = 0;
+
+      for (uint16_t tree = 0; tree < model.trees; tree++)
+      {
+        leaf = &model.leafProba[leafOf(model, tree, inputs) * model.classes];
+
+        for (uint8_t index = 0; index < model.classes; index++)
+        {
+          sums[index] += leaf[index];
+        }
+      }
+
+      for (uint8_t index = 0; index < model.classes; index++)
+      {
+        sums[index] /= model.trees;
+
+        if (sums[index] > sums[best])
+        {
+          best = index;                       //the first of equal sums, as argmax()
+        }
+      }
+
+      return model.labels[best];
+    }
+
+
+    static uint16_t leafOf(const LTForestModel &model, uint16_t tree, const int16_t *inputs)
+    {
+      //index of the leaf inputs end in, in tree
+
+      uint16_t index = model.roots[tree];
+      const LTForestNode *node;
+
+      while (!(index & LTForestLeaf))
+      {
+        node = &model.nodes[index];
+        index = node->child[inputs[node->input] > node->threshold];
+      }
+
+      return index & ~LTForestLeaf;
+    }
+};
+
+#endif
+
+/*
+  MIT license
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+  associated documentation files (the "Software"), to deal in the Software without restriction, including
+  without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the
+  following conditions:
+
+  The above copyright notice and this permission notice shall be included in all copies or substantial
+  portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+  LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO
+  EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+  IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE
+  USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
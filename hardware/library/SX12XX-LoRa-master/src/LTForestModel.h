@@ -0,0 +1,655 @@
+/*
+  Licensed under a MIT license displayed at the bottom of this document.
+  Original published 16/10/26, Random Forest model for LTForest.h
+
+  Generated by frontend_backend/my_iot_project/export_forest.py from ml/rf_model.pkl and
+  ml/preprocessor.pkl, do not edit.
+*/
+
+/*
+  300 trees, 1888 split nodes and 119 distinct leaves, classes 0, 1.
+  Inputs are the features of schema 2S in hundredths, in LTForestInputFeature[] order; the
+  StandardScaler of the backend is folded into the thresholds.
+*/
+
+#ifndef LTForestModel_h
+#define LTForestModel_h
+
+#include <LTForest.h>
+#include <LTFeatures.h>
+
+#define LTForestSchema 1
+#define LTForestModelID 0xBF81CF09UL        //app/core/model_id.py of the .pkl files, sent as "model_id"
+#define LTForestInputs 4
+#define LTForestTrees 300
+#define LTForestClasses 2
+
+const uint8_t LTForestInputFeature[LTForestInputs] = {LTFeatureTemperature, LTFeatureHumidity, LTFeatureRSSI, LTFeatureSNR};
+
+const int16_t LTForestLabels[LTForestClasses] = {0, 1};
+
+const uint16_t LTForestRoots[LTForestTrees] =
+{
+  0x0000, 0x0007, 0x000D, 0x0011, 0x0014, 0x001A, 0x0021, 0x0026,
+  0x002C, 0x0032, 0x0037, 0x003D, 0x0045, 0x004B, 0x0052, 0x0059,
+  0x0060, 0x0066, 0x006B, 0x0070, 0x0075, 0x007D, 0x0084, 0x008C,
+  0x0093, 0x0099, 0x009F, 0x00A6, 0x00AE, 0x00B4, 0x00BA, 0x00C1,
+  0x00C8, 0x00CF, 0x00D5, 0x00DD, 0x00E6, 0x00EC, 0x00F0, 0x00F4,
+  0x00FA, 0x0101, 0x0105, 0x010C, 0x0110, 0x0116, 0x011A, 0x0121,
+  0x0126, 0x012B, 0x0133, 0x013B, 0x0141, 0x0149, 0x014F, 0x0156,
+  0x015D, 0x0165, 0x016B, 0x0172, 0x0179, 0x0181, 0x0184, 0x018B,
+  0x0190, 0x0198, 0x01A0, 0x01A6, 0x01AC, 0x01B5, 0x01BA, 0x01C1,
+  0x01C8, 0x01CE, 0x01D3, 0x01DA, 0x01E1, 0x01E7, 0x01ED, 0x01F3,
+  0x01F8, 0x01FE, 0x0204, 0x020D, 0x0211, 0x0218, 0x021F, 0x0225,
+  0x0229, 0x022F, 0x0236, 0x023C, 0x0243, 0x0248, 0x024F, 0x0258,
+  0x025B, 0x0262, 0x0268, 0x026C, 0x0271, 0x0276, 0x027C, 0x0282,
+  0x0288, 0x028E, 0x0294, 0x0297, 0x029E, 0x02A3, 0x02A9, 0x02B1,
+  0x02B7, 0x02BE, 0x02C4, 0x02CB, 0x02D5, 0x02DA, 0x02E1, 0x02E8,
+  0x02EE, 0x02F3, 0x02FC, 0x0301, 0x0306, 0x030C, 0x0314, 0x0319,
+  0x0320, 0x0327, 0x032C, 0x0334, 0x033C, 0x0341, 0x0348, 0x034D,
+  0x0354, 0x035B, 0x0362, 0x036A, 0x0370, 0x0376, 0x037D, 0x0385,
+  0x038E, 0x0394, 0x039A, 0x03A0, 0x03A8, 0x03AF, 0x03B5, 0x03B8,
+  0x03BF, 0x03C4, 0x03CA, 0x03D0, 0x03D6, 0x03DC, 0x03E2, 0x03E8,
+  0x03EF, 0x03F5, 0x03FB, 0x0403, 0x040C, 0x0412, 0x0418, 0x0420,
+  0x0426, 0x042C, 0x0431, 0x0437, 0x043E, 0x0444, 0x044A, 0x044E,
+  0x0453, 0x045A, 0x0463, 0x046A, 0x0470, 0x0477, 0x047D, 0x0485,
+  0x048C, 0x0491, 0x0496, 0x049D, 0x04A3, 0x04A9, 0x04AE, 0x04B4,
+  0x04BB, 0x04C3, 0x04CB, 0x04D1, 0x04D7, 0x04DC, 0x04E3, 0x04EB,
+  0x04F0, 0x04F7, 0x04FE, 0x0504, 0x050A, 0x050F, 0x0515, 0x051B,
+  0x0523, 0x0529, 0x0530, 0x0535, 0x053B, 0x0541, 0x0548, 0x054E,
+  0x0557, 0x055D, 0x0563, 0x0569, 0x056E, 0x0574, 0x057A, 0x057E,
+  0x0583, 0x0589, 0x058E, 0x0592, 0x0598, 0x059E, 0x05A4, 0x05AA,
+  0x05B2, 0x05B8, 0x05BD, 0x05C3, 0x05C7, 0x05CB, 0x05D1, 0x05D6,
+  0x05DD, 0x05E3, 0x05E9, 0x05F0, 0x05F9, 0x05FF, 0x0606, 0x060E,
+  0x0614, 0x0619, 0x0621, 0x0626, 0x062A, 0x0630, 0x0637, 0x063D,
+  0x0643, 0x0649, 0x064E, 0x0655, 0x065B, 0x0662, 0x0669, 0x066E,
+  0x0676, 0x067C, 0x0682, 0x0689, 0x068F, 0x0697, 0x069E, 0x06A3,
+  0x06AA, 0x06B1, 0x06B7, 0x06BE, 0x06C5, 0x06CC, 0x06D2, 0x06D9,
+  0x06DF, 0x06E6, 0x06EB, 0x06F4, 0x06FA, 0x0701, 0x0708, 0x070E,
+  0x0713, 0x0719, 0x0720, 0x0726, 0x072D, 0x0734, 0x073A, 0x0740,
+  0x0747, 0x074E, 0x0755, 0x075B
+};
+
+const LTForestNode LTForestNodes[1888] =
+{
+  {{0x0001, 0x0002}, 4244, 1}, {{0x8000, 0x8001}, 750, 3}, {{0x0003, 0x0005}, -9301, 2}, {{0x0004, 0x8000}, 4264, 1},
+  {{0x8000, 0x8002}, -10200, 2}, {{0x8003, 0x0006}, 850, 3}, {{0x8003, 0x8004}, 4264, 1}, {{0x0008, 0x000A}, 4244, 1},
+  {{0x8000, 0x0009}, 750, 3}, {{0x8005, 0x8000}, -9351, 2}, {{0x000B, 0x000C}, -9400, 2}, {{0x8006, 0x8000}, 4264, 1},
+  {{0x8003, 0x8004}, 4264, 1}, {{0x8000, 0x000E}, 750, 3}, {{0x000F, 0x8008}, 4264, 1}, {{0x8005, 0x0010}, 4244, 1},
+  {{0x8007, 0x8003}, -9400, 2}, {{0x8000, 0x0012}, 750, 3}, {{0x8000, 0x0013}, 4244, 1}, {{0x8003, 0x8009}, 4264, 1},
+  {{0x8000, 0x0015}, 750, 3}, {{0x0016, 0x0018}, 850, 3}, {{0x0017, 0x8003}, -9500, 2}, {{0x800A, 0x8005}, -9800, 2},
+  {{0x800B, 0x0019}, 4254, 1}, {{0x800C, 0x8003}, -8750, 2}, {{0x001B, 0x001F}, -9250, 2}, {{0x8000, 0x001C}, -10000, 2},
+  {{0x8000, 0x001D}, 750, 3}, {{0x001E, 0x8000}, 850, 3}, {{0x800D, 0x800D}, -9850, 2}, {{0x0020, 0x8006}, 4264, 1},
+  {{0x8002, 0x8003}, 4254, 1}, {{0x8000, 0x0022}, 750, 3}, {{0x0023, 0x0025}, -9150, 2}, {{0x0024, 0x800E}, 4254, 1},
+  {{0x8004, 0x8000}, -9650, 2}, {{0x800F, 0x8010}, 4254, 1}, {{0x0027, 0x002A}, -9250, 2}, {{0x8000, 0x0028}, 750, 3},
+  {{0x8011, 0x0029}, -9650, 2}, {{0x8012, 0x8000}, 850, 3}, {{0x002B, 0x8003}, -8750, 2}, {{0x800D, 0x8003}, 4254, 1},
+  {{0x002D, 0x002E}, 4244, 1}, {{0x8000, 0x8013}, 750, 3}, {{0x8000, 0x002F}, -10050, 2}, {{0x0030, 0x8008}, 4264, 1},
+  {{0x8003, 0x0031}, 850, 3}, {{0x8014, 0x8003}, -8950, 2}, {{0x0033, 0x0035}, -9350, 2}, {{0x8000, 0x0034}, 750, 3},
+  {{0x8006, 0x8011}, 4254, 1}, {{0x8003, 0x0036}, 850, 3}, {{0x8007, 0x8003}, -8600, 2}, {{0x0038, 0x003B}, -9001, 2},
+  {{0x8000, 0x0039}, 750, 3}, {{0x8008, 0x003A}, -9650, 2}, {{0x8015, 0x8000}, 850, 3}, {{0x003C, 0x8003}, -8450, 2},
+  {{0x8004, 0x8016}, 4254, 1}, {{0x003E, 0x0041}, -9250, 2}, {{0x8000, 0x003F}, 750, 3}, {{0x0040, 0x8000}, 850, 3},
+  {{0x8017, 0x8018}, 4249, 1}, {{0x0042, 0x0043}, 4254, 1}, {{0x8003, 0x8019}, 850, 3}, {{0x0044, 0x8003}, -8650, 2},
+  {{0x8003, 0x8009}, -8850, 2}, {{0x8000, 0x0046}, 750, 3}, {{0x0047, 0x8003}, -8650, 2}, {{0x0048, 0x801C}, 4264, 1},
+  {{0x0049, 0x004A}, -9250, 2}, {{0x800E, 0x801A}, -9750, 2}, {{0x800E, 0x801B}, -9051, 2}, {{0x8000, 0x004C}, 750, 3},
+  {{0x004D, 0x004F}, 850, 3}, {{0x004E, 0x8003}, -9200, 2}, {{0x8015, 0x8006}, -9750, 2}, {{0x0050, 0x8004}, 4264, 1},
+  {{0x0051, 0x8003}, -8700, 2}, {{0x801D, 0x8003}, 4254, 1}, {{0x0053, 0x0055}, -9301, 2}, {{0x8000, 0x0054}, 750, 3},
+  {{0x801A, 0x800A}, 4249, 1}, {{0x8003, 0x0056}, 850, 3}, {{0x0057, 0x0058}, 4254, 1}, {{0x8004, 0x8014}, -8650, 2},
+  {{0x8003, 0x8018}, 4264, 1}, {{0x005A, 0x005D}, -9250, 2}, {{0x8000, 0x005B}, -10000, 2}, {{0x005C, 0x8000}, -9650, 2},
+  {{0x8006, 0x800A}, -9850, 2}, {{0x8000, 0x005E}, 4244, 1}, {{0x8003, 0x005F}, 4254, 1}, {{0x8007, 0x8003}, -8750, 2},
+  {{0x8000, 0x0061}, 750, 3}, {{0x0062, 0x8005}, 4264, 1}, {{0x801E, 0x0063}, 4244, 1}, {{0x0064, 0x0065}, 4254, 1},
+  {{0x8002, 0x8003}, -8550, 2}, {{0x801F, 0x8003}, -9400, 2}, {{0x8000, 0x0067}, 750, 3}, {{0x0068, 0x0069}, -9250, 2},
+  {{0x8018, 0x801D}, -9650, 2}, {{0x8003, 0x006A}, 850, 3}, {{0x8020, 0x8003}, 4254, 1}, {{0x006C, 0x006D}, -9450, 2},
+  {{0x8000, 0x801D}, -10050, 2}, {{0x800A, 0x006E}, 4244, 1}, {{0x8003, 0x006F}, 4254, 1}, {{0x8021, 0x8003}, -8650, 2},
+  {{0x8022, 0x0071}, 4244, 1}, {{0x8023, 0x0072}, -10050, 2}, {{0x0073, 0x8003}, -8650, 2}, {{0x8024, 0x0074}, 850, 3},
+  {{0x8024, 0x800E}, -8850, 2}, {{0x0076, 0x007A}, -9051, 2}, {{0x8000, 0x0077}, 750, 3}, {{0x0078, 0x0079}, 4244, 1},
+  {{0x8004, 0x8025}, -9701, 2}, {{0x8026, 0x801F}, -9650, 2}, {{0x007B, 0x007C}, 4254, 1}, {{0x8003, 0x800A}, 850, 3},
+  {{0x8007, 0x8003}, -8750, 2}, {{0x007E, 0x0081}, -9250, 2}, {{0x8000, 0x007F}, -10050, 2}, {{0x0080, 0x8027}, 4249, 1},
+  {{0x8000, 0x8006}, -9850, 2}, {{0x0082, 0x8003}, -8450, 2}, {{0x8003, 0x0083}, 850, 3}, {{0x8009, 0x8028}, -8650, 2},
+  {{0x0085, 0x0086}, 4244, 1}, {{0x8000, 0x8029}, 750, 3}, {{0x8000, 0x0087}, 750, 3}, {{0x0088, 0x802B}, 4264, 1},
+  {{0x0089, 0x008B}, 850, 3}, {{0x8003, 0x008A}, 4254, 1}, {{0x8007, 0x8003}, -9300, 2}, {{0x802A, 0x8003}, 4254, 1},
+  {{0x8000, 0x008D}, 750, 3}, {{0x008E, 0x0090}, -9250, 2}, {{0x008F, 0x8000}, 850, 3}, {{0x8005, 0x800D}, 4249, 1},
+  {{0x8003, 0x0091}, 850, 3}, {{0x0092, 0x8003}, -8401, 2}, {{0x8003, 0x802C}, -8900, 2}, {{0x0094, 0x0097}, -9250, 2},
+  {{0x8000, 0x0095}, 750, 3}, {{0x0096, 0x8000}, 850, 3}, {{0x8004, 0x8001}, -9750, 2}, {{0x8016, 0x0098}, -8650, 2},
+  {{0x8003, 0x8024}, 850, 3}, {{0x8000, 0x009A}, 750, 3}, {{0x009B, 0x009C}, -9150, 2}, {{0x8007, 0x802D}, -9800, 2},
+  {{0x8003, 0x009D}, 850, 3}, {{0x800E, 0x009E}, 4254, 1}, {{0x802E, 0x8003}, -8750, 2}, {{0x00A0, 0x00A3}, -9051, 2},
+  {{0x00A1, 0x00A2}, -9850, 2}, {{0x8000, 0x801A}, -10000, 2}, {{0x8012, 0x802F}, 4254, 1}, {{0x8003, 0x00A4}, 850, 3},
+  {{0x802C, 0x00A5}, -8650, 2}, {{0x8020, 0x8003}, -8401, 2}, {{0x00A7, 0x00AB}, -8750, 2}, {{0x8000, 0x00A8}, 750, 3},
+  {{0x00A9, 0x00AA}, 4254, 1}, {{0x8005, 0x8000}, 850, 3}, {{0x8007, 0x8030}, -9850, 2}, {{0x8003, 0x00AC}, 850, 3},
+  {{0x00AD, 0x8003}, -8401, 2}, {{0x8007, 0x8009}, -8550, 2}, {{0x00AF, 0x00B2}, -9250, 2}, {{0x00B0, 0x00B1}, 4254, 1},
+  {{0x8000, 0x8015}, -9850, 2}, {{0x8000, 0x8004}, 750, 3}, {{0x8003, 0x00B3}, 850, 3}, {{0x8000, 0x8031}, 4244, 1},
+  {{0x00B5, 0x00B6}, -9450, 2}, {{0x8000, 0x8005}, 750, 3}, {{0x8003, 0x00B7}, 850, 3}, {{0x00B8, 0x8006}, 4264, 1},
+  {{0x00B9, 0x8003}, -8351, 2}, {{0x8013, 0x8003}, 4254, 1}, {{0x00BB, 0x8000}, 4264, 1}, {{0x00BC, 0x00BE}, 4244, 1},
+  {{0x8000, 0x00BD}, 750, 3}, {{0x8032, 0x8004}, -9500, 2}, {{0x00BF, 0x00C0}, 4254, 1}, {{0x800C, 0x8003}, -8900, 2},
+  {{0x8033, 0x8003}, -9950, 2}, {{0x00C2, 0x00C5}, -9250, 2}, {{0x8000, 0x00C3}, -10050, 2}, {{0x00C4, 0x802F}, 4254, 1},
+  {{0x8033, 0x8006}, -9800, 2}, {{0x8003, 0x00C6}, 850, 3}, {{0x800D, 0x00C7}, -8750, 2}, {{0x8002, 0x8003}, -8250, 2},
+  {{0x00C9, 0x00CB}, -9250, 2}, {{0x8000, 0x00CA}, -10100, 2}, {{0x802D, 0x802B}, 4249, 1}, {{0x00CC, 0x8003}, -8450, 2},
+  {{0x00CD, 0x8004}, 4264, 1}, {{0x00CE, 0x8003}, 4254, 1}, {{0x8028, 0x800D}, -8650, 2}, {{0x00D0, 0x00D2}, -9850, 2},
+  {{0x8000, 0x00D1}, -10150, 2}, {{0x8008, 0x8034}, -9950, 2}, {{0x800B, 0x00D3}, 4244, 1}, {{0x8003, 0x00D4}, 4254, 1},
+  {{0x8002, 0x8003}, -8650, 2}, {{0x00D6, 0x00DA}, -9250, 2}, {{0x8000, 0x00D7}, -10200, 2}, {{0x00D8, 0x8000}, 850, 3},
+  {{0x00D9, 0x800A}, -9850, 2}, {{0x8008, 0x8032}, -9950, 2}, {{0x8003, 0x00DB}, 850, 3}, {{0x801F, 0x00DC}, 4254, 1},
+  {{0x8003, 0x8009}, 4264, 1}, {{0x00DE, 0x00E0}, 4244, 1}, {{0x8000, 0x00DF}, 4235, 1}, {{0x8033, 0x801A}, -9750, 2},
+  {{0x00E1, 0x00E2}, -10050, 2}, {{0x8000, 0x8033}, 650, 3}, {{0x00E3, 0x00E5}, 850, 3}, {{0x8003, 0x00E4}, 4254, 1},
+  {{0x801F, 0x8003}, -8950, 2}, {{0x8003, 0x8000}, 4275, 1}, {{0x00E7, 0x00E9}, 4244, 1}, {{0x8000, 0x00E8}, -10000, 2},
+  {{0x8004, 0x8000}, 850, 3}, {{0x8000, 0x00EA}, 750, 3}, {{0x8004, 0x00EB}, -9301, 2}, {{0x8003, 0x8019}, 4264, 1},
+  {{0x00ED, 0x00EF}, -9250, 2}, {{0x8000, 0x00EE}, 750, 3}, {{0x802F, 0x8004}, 4254, 1}, {{0x8026, 0x8003}, 4244, 1},
+  {{0x8000, 0x00F1}, 750, 3}, {{0x8030, 0x00F2}, -9301, 2}, {{0x00F3, 0x8003}, -8650, 2}, {{0x8018, 0x8020}, 4254, 1},
+  {{0x00F5, 0x00F8}, -9250, 2}, {{0x8000, 0x00F6}, 750, 3}, {{0x00F7, 0x8000}, 850, 3}, {{0x8002, 0x800B}, -9750, 2},
+  {{0x00F9, 0x8003}, 4254, 1}, {{0x8003, 0x8007}, 850, 3}, {{0x00FB, 0x00FE}, -9301, 2}, {{0x00FC, 0x8000}, 4264, 1},
+  {{0x8000, 0x00FD}, 750, 3}, {{0x801F, 0x8032}, -9800, 2}, {{0x00FF, 0x8003}, -8450, 2}, {{0x8000, 0x0100}, 4244, 1},
+  {{0x8003, 0x8035}, -8750, 2}, {{0x8000, 0x0102}, 4244, 1}, {{0x0103, 0x0104}, -9750, 2}, {{0x8000, 0x8019}, -10200, 2},
+  {{0x8003, 0x8004}, 4264, 1}, {{0x8000, 0x0106}, 750, 3}, {{0x0107, 0x010A}, -8650, 2}, {{0x0108, 0x0109}, 4244, 1},
+  {{0x8005, 0x8000}, -9650, 2}, {{0x800F, 0x8036}, -8850, 2}, {{0x010B, 0x8003}, -8450, 2}, {{0x8012, 0x8003}, 4254, 1},
+  {{0x8000, 0x010D}, 750, 3}, {{0x010E, 0x010F}, 4244, 1}, {{0x8008, 0x8000}, -9750, 2}, {{0x801D, 0x8003}, -9301, 2},
+  {{0x8000, 0x0111}, 750, 3}, {{0x0112, 0x0114}, -9250, 2}, {{0x0113, 0x8000}, 4264, 1}, {{0x8018, 0x8008}, -9650, 2},
+  {{0x800D, 0x0115}, 4254, 1}, {{0x8007, 0x8003}, -8750, 2}, {{0x0117, 0x0118}, -9250, 2}, {{0x8000, 0x8005}, 750, 3},
+  {{0x8003, 0x0119}, 850, 3}, {{0x8037, 0x8003}, -8401, 2}, {{0x011B, 0x011E}, -9450, 2}, {{0x8000, 0x011C}, 750, 3},
+  {{0x011D, 0x8007}, 4254, 1}, {{0x8033, 0x8000}, -9800, 2}, {{0x011F, 0x8003}, -8450, 2}, {{0x8003, 0x0120}, 850, 3},
+  {{0x8000, 0x8038}, 4244, 1}, {{0x0122, 0x0124}, -9051, 2}, {{0x8000, 0x0123}, 750, 3}, {{0x8006, 0x8008}, 4244, 1},
+  {{0x8003, 0x0125}, 850, 3}, {{0x800D, 0x8039}, 4254, 1}, {{0x8000, 0x0127}, 750, 3}, {{0x0128, 0x0129}, 4244, 1},
+  {{0x8033, 0x801D}, 4235, 1}, {{0x800D, 0x012A}, -9301, 2}, {{0x802E, 0x8003}, -8750, 2}, {{0x8000, 0x012C}, 750, 3},
+  {{0x012D, 0x0130}, 850, 3}, {{0x803A, 0x012E}, 4244, 1}, {{0x8003, 0x012F}, 4254, 1}, {{0x8007, 0x8003}, -8650, 2},
+  {{0x8033, 0x0131}, -8951, 2}, {{0x8013, 0x0132}, 4254, 1}, {{0x8014, 0x8003}, -8650, 2}, {{0x0134, 0x0137}, -9051, 2},
+  {{0x8000, 0x0135}, -10150, 2}, {{0x8000, 0x0136}, 750, 3}, {{0x8033, 0x803B}, 4244, 1}, {{0x0138, 0x800B}, 4264, 1},
+  {{0x8003, 0x0139}, 850, 3}, {{0x013A, 0x8003}, -8351, 2}, {{0x803C, 0x8009}, -8750, 2}, {{0x013C, 0x013F}, -9250, 2},
+  {{0x8000, 0x013D}, 750, 3}, {{0x013E, 0x8000}, 850, 3}, {{0x8006, 0x800F}, 4249, 1}, {{0x0140, 0x8003}, -8450, 2},
+  {{0x8013, 0x803D}, 4254, 1}, {{0x0142, 0x0144}, 4244, 1}, {{0x8000, 0x0143}, 750, 3}, {{0x801D, 0x8000}, 850, 3},
+  {{0x0145, 0x0147}, -9301, 2}, {{0x8000, 0x0146}, 750, 3}, {{0x8018, 0x8000}, 4264, 1}, {{0x8003, 0x0148}, 850, 3},
+  {{0x8011, 0x8003}, -8650, 2}, {{0x014A, 0x014D}, -9250, 2}, {{0x8000, 0x014B}, 750, 3}, {{0x800D, 0x014C}, -9850, 2},
+  {{0x8025, 0x8008}, 4254, 1}, {{0x014E, 0x8003}, -8450, 2}, {{0x800E, 0x803E}, 4254, 1}, {{0x0150, 0x0152}, 4244, 1},
+  {{0x8000, 0x0151}, 4235, 1}, {{0x8000, 0x800D}, 750, 3}, {{0x8000, 0x0153}, -10200, 2}, {{0x0154, 0x8004}, 4264, 1},
+  {{0x8003, 0x0155}, 4254, 1}, {{0x8007, 0x8003}, -9400, 2}, {{0x0157, 0x015A}, -9250, 2}, {{0x8000, 0x0158}, 750, 3},
+  {{0x0159, 0x8002}, 4249, 1}, {{0x8006, 0x8005}, -9650, 2}, {{0x015B, 0x8003}, -8401, 2}, {{0x8003, 0x015C}, 850, 3},
+  {{0x8008, 0x8016}, 4254, 1}, {{0x8000, 0x015E}, 750, 3}, {{0x015F, 0x0161}, 850, 3}, {{0x0160, 0x8003}, -9500, 2},
+  {{0x8004, 0x800C}, 4249, 1}, {{0x8000, 0x0162}, -9301, 2}, {{0x0163, 0x8003}, -8351, 2}, {{0x8000, 0x0164}, 4244, 1},
+  {{0x8003, 0x8002}, -8900, 2}, {{0x8000, 0x0166}, 750, 3}, {{0x0167, 0x0168}, 4244, 1}, {{0x800B, 0x8026}, -9351, 2},
+  {{0x0169, 0x8003}, 850, 3}, {{0x8003, 0x016A}, 4254, 1}, {{0x8007, 0x8003}, -9300, 2}, {{0x8000, 0x016C}, 750, 3},
+  {{0x016D, 0x8000}, 4275, 1}, {{0x016E, 0x016F}, 4244, 1}, {{0x801E, 0x8026}, -9351, 2}, {{0x0170, 0x0171}, 850, 3},
+  {{0x801F, 0x8003}, -9400, 2}, {{0x8002, 0x8003}, 4254, 1}, {{0x0173, 0x0176}, -9150, 2}, {{0x8000, 0x0174}, 750, 3},
+  {{0x0175, 0x8000}, 850, 3}, {{0x8014, 0x800E}, -9750, 2}, {{0x0177, 0x8003}, -8450, 2}, {{0x800A, 0x0178}, 4254, 1},
+  {{0x8024, 0x803F}, -8750, 2}, {{0x017A, 0x017D}, 4244, 1}, {{0x8000, 0x017B}, 4235, 1}, {{0x017C, 0x8005}, -9550, 2},
+  {{0x8000, 0x801C}, -10000, 2}, {{0x017E, 0x0180}, 4264, 1}, {{0x8000, 0x017F}, 750, 3}, {{0x8009, 0x8003}, -9400, 2},
+  {{0x8000, 0x8012}, -9100, 2}, {{0x8000, 0x0182}, 750, 3}, {{0x8033, 0x0183}, 4244, 1}, {{0x8003, 0x8032}, 4264, 1},
+  {{0x0185, 0x0188}, 4244, 1}, {{0x8000, 0x0186}, 750, 3}, {{0x0187, 0x8000}, 850, 3}, {{0x8005, 0x8026}, -9750, 2},
+  {{0x0189, 0x018A}, 4264, 1}, {{0x8004, 0x8003}, -9400, 2}, {{0x8000, 0x8012}, -9200, 2}, {{0x018C, 0x018F}, -9250, 2},
+  {{0x018D, 0x018E}, -9850, 2}, {{0x8000, 0x8033}, 750, 3}, {{0x8032, 0x800B}, 4254, 1}, {{0x8028, 0x8003}, -8650, 2},
+  {{0x0191, 0x0194}, -9250, 2}, {{0x8000, 0x0192}, 750, 3}, {{0x8009, 0x0193}, -9750, 2}, {{0x8000, 0x8026}, 4254, 1},
+  {{0x0195, 0x0197}, -8650, 2}, {{0x800B, 0x0196}, 4254, 1}, {{0x8003, 0x800C}, -8850, 2}, {{0x8024, 0x8003}, 4254, 1},
+  {{0x0199, 0x019B}, 4244, 1}, {{0x8000, 0x019A}, 750, 3}, {{0x8000, 0x8030}, 4235, 1}, {{0x019C, 0x019D}, -9650, 2},
+  {{0x8026, 0x8000}, 4264, 1}, {{0x019E, 0x801D}, 4264, 1}, {{0x019F, 0x8003}, 850, 3}, {{0x8002, 0x8003}, -8500, 2},
+  {{0x01A1, 0x01A3}, 4244, 1}, {{0x8000, 0x01A2}, 750, 3}, {{0x8012, 0x8015}, -9750, 2}, {{0x8000, 0x01A4}, 750, 3},
+  {{0x8040, 0x01A5}, -9400, 2}, {{0x8035, 0x8003}, -8750, 2}, {{0x01A7, 0x01A9}, -9250, 2}, {{0x8000, 0x01A8}, 750, 3},
+  {{0x803A, 0x801D}, -9650, 2}, {{0x8003, 0x01AA}, 850, 3}, {{0x01AB, 0x8003}, -8351, 2}, {{0x8018, 0x8041}, 4254, 1},
+  {{0x01AD, 0x01B0}, 4244, 1}, {{0x01AE, 0x8006}, -9450, 2}, {{0x01AF, 0x8000}, -9750, 2}, {{0x8000, 0x8013}, -10050, 2},
+  {{0x01B1, 0x01B4}, 4264, 1}, {{0x01B2, 0x01B3}, 850, 3}, {{0x8003, 0x800B}, 4254, 1}, {{0x801B, 0x8003}, 4254, 1},
+  {{0x8000, 0x8013}, 800, 3}, {{0x8000, 0x01B6}, 750, 3}, {{0x01B7, 0x01B8}, 4244, 1}, {{0x8023, 0x801D}, -9450, 2},
+  {{0x800A, 0x01B9}, -9301, 2}, {{0x8003, 0x800E}, 4264, 1}, {{0x01BB, 0x01BE}, -9250, 2}, {{0x8000, 0x01BC}, -10050, 2},
+  {{0x8000, 0x01BD}, 750, 3}, {{0x800D, 0x8000}, 850, 3}, {{0x8003, 0x01BF}, 850, 3}, {{0x01C0, 0x800E}, 4264, 1},
+  {{0x8007, 0x8003}, 4254, 1}, {{0x8000, 0x01C2}, 750, 3}, {{0x01C3, 0x01C5}, 850, 3}, {{0x8001, 0x01C4}, 4244, 1},
+  {{0x8002, 0x8003}, -9650, 2}, {{0x8000, 0x01C6}, -9150, 2}, {{0x8028, 0x01C7}, 4254, 1}, {{0x8007, 0x8003}, -8650, 2},
+  {{0x01C9, 0x01CB}, -9301, 2}, {{0x01CA, 0x8042}, -9850, 2}, {{0x8000, 0x801C}, 4254, 1}, {{0x8000, 0x01CC}, 4244, 1},
+  {{0x8003, 0x01CD}, 4254, 1}, {{0x8003, 0x8043}, -8750, 2}, {{0x8000, 0x01CF}, 750, 3}, {{0x01D0, 0x01D2}, -9250, 2},
+  {{0x8044, 0x01D1}, -9750, 2}, {{0x8015, 0x8005}, 4244, 1}, {{0x8045, 0x8003}, -8650, 2}, {{0x8000, 0x01D4}, 750, 3},
+  {{0x01D5, 0x01D7}, -9500, 2}, {{0x8026, 0x01D6}, -9750, 2}, {{0x8000, 0x802F}, 4244, 1}, {{0x01D8, 0x8003}, -8450, 2},
+  {{0x803D, 0x01D9}, -8850, 2}, {{0x800B, 0x800C}, -8650, 2}, {{0x01DB, 0x01DF}, -9301, 2}, {{0x01DC, 0x8000}, 4264, 1},
+  {{0x01DD, 0x01DE}, 4254, 1}, {{0x8000, 0x8044}, 750, 3}, {{0x8013, 0x8009}, -10050, 2}, {{0x8003, 0x01E0}, 850, 3},
+  {{0x801F, 0x8003}, 4254, 1}, {{0x8000, 0x01E2}, 750, 3}, {{0x01E3, 0x01E4}, 4244, 1}, {{0x8042, 0x8000}, 850, 3},
+  {{0x8046, 0x01E5}, -9301, 2}, {{0x01E6, 0x8003}, -8650, 2}, {{0x8003, 0x8028}, 4254, 1}, {{0x01E8, 0x01E9}, -9301, 2},
+  {{0x8000, 0x8047}, 750, 3}, {{0x8003, 0x01EA}, 850, 3}, {{0x01EB, 0x8003}, -8401, 2}, {{0x01EC, 0x800C}, -8550, 2},
+  {{0x8002, 0x8007}, -8900, 2}, {{0x01EE, 0x01F0}, -9051, 2}, {{0x8000, 0x01EF}, 750, 3}, {{0x8032, 0x8030}, 4249, 1},
+  {{0x01F1, 0x8003}, -8450, 2}, {{0x800F, 0x01F2}, 4254, 1}, {{0x8028, 0x8003}, -8750, 2}, {{0x01F4, 0x8000}, 4264, 1},
+  {{0x8000, 0x01F5}, 750, 3}, {{0x01F6, 0x01F7}, 4244, 1}, {{0x8013, 0x8000}, 4235, 1}, {{0x8002, 0x8003}, -9100, 2},
+  {{0x8000, 0x01F9}, 750, 3}, {{0x01FA, 0x01FC}, 850, 3}, {{0x01FB, 0x8003}, -9500, 2}, {{0x8005, 0x800F}, 4249, 1},
+  {{0x8000, 0x01FD}, 4244, 1}, {{0x8003, 0x800E}, 4264, 1}, {{0x01FF, 0x0202}, -9301, 2}, {{0x8000, 0x0200}, -10150, 2},
+  {{0x0201, 0x8000}, -9650, 2}, {{0x8006, 0x8012}, 4249, 1}, {{0x8003, 0x0203}, 850, 3}, {{0x8037, 0x8003}, -8401, 2},
+  {{0x0205, 0x020A}, -9500, 2}, {{0x0206, 0x0208}, 4254, 1}, {{0x8000, 0x0207}, -10000, 2}, {{0x802F, 0x8000}, -9750, 2},
+  {{0x8000, 0x0209}, 750, 3}, {{0x8002, 0x8004}, -9800, 2}, {{0x800E, 0x020B}, -9051, 2}, {{0x020C, 0x8003}, 4254, 1},
+  {{0x8028, 0x8003}, -8301, 2}, {{0x020E, 0x0210}, -9051, 2}, {{0x8000, 0x020F}, 750, 3}, {{0x8000, 0x8048}, 4254, 1},
+  {{0x802E, 0x8003}, -8450, 2}, {{0x0212, 0x0215}, -9051, 2}, {{0x8000, 0x0213}, 750, 3}, {{0x0214, 0x8001}, 4244, 1},
+  {{0x8026, 0x8032}, -9750, 2}, {{0x8003, 0x0216}, 850, 3}, {{0x801B, 0x0217}, 4254, 1}, {{0x8014, 0x8003}, -8650, 2},
+  {{0x8000, 0x0219}, 750, 3}, {{0x021A, 0x021B}, 4244, 1}, {{0x8032, 0x8006}, 4235, 1}, {{0x021C, 0x021D}, 850, 3},
+  {{0x8028, 0x8003}, -9450, 2}, {{0x800E, 0x021E}, -9100, 2}, {{0x8003, 0x8018}, 4264, 1}, {{0x0220, 0x0221}, 4244, 1},
+  {{0x8000, 0x802F}, -9850, 2}, {{0x8000, 0x0222}, -10100, 2}, {{0x0223, 0x0224}, 850, 3}, {{0x8007, 0x8003}, -9300, 2},
+  {{0x8003, 0x8001}, 4264, 1}, {{0x0226, 0x0227}, 4244, 1}, {{0x8000, 0x8019}, -9850, 2}, {{0x8000, 0x0228}, -10200, 2},
+  {{0x8003, 0x800C}, 4264, 1}, {{0x022A, 0x022B}, 4244, 1}, {{0x8000, 0x8026}, -9500, 2}, {{0x022C, 0x022D}, -9400, 2},
+  {{0x8000, 0x8005}, 750, 3}, {{0x8003, 0x022E}, 4254, 1}, {{0x8049, 0x8003}, -8650, 2}, {{0x0230, 0x8000}, 4264, 1},
+  {{0x8000, 0x0231}, 750, 3}, {{0x0232, 0x0234}, -9051, 2}, {{0x801B, 0x0233}, -9750, 2}, {{0x800D, 0x8019}, 850, 3},
+  {{0x8003, 0x0235}, -8550, 2}, {{0x8007, 0x8003}, 4254, 1}, {{0x0237, 0x0239}, -9250, 2}, {{0x8000, 0x0238}, 750, 3},
+  {{0x800D, 0x8033}, -9850, 2}, {{0x023A, 0x8003}, -8401, 2}, {{0x023B, 0x804A}, 4254, 1}, {{0x8020, 0x800D}, -8900, 2},
+  {{0x023D, 0x023E}, 4244, 1}, {{0x8000, 0x8019}, -9450, 2}, {{0x8000, 0x023F}, 750, 3}, {{0x0240, 0x804B}, 4264, 1},
+  {{0x0241, 0x0242}, 850, 3}, {{0x8003, 0x803B}, 4254, 1}, {{0x8002, 0x8003}, -8850, 2}, {{0x8000, 0x0244}, 750, 3},
+  {{0x0245, 0x0246}, 4244, 1}, {{0x8019, 0x8004}, 4235, 1}, {{0x0247, 0x800A}, 4264, 1}, {{0x803F, 0x8003}, -9400, 2},
+  {{0x0249, 0x024C}, -9250, 2}, {{0x8000, 0x024A}, -10200, 2}, {{0x024B, 0x801A}, -9650, 2}, {{0x8000, 0x800F}, 750, 3},
+  {{0x024D, 0x804C}, 4254, 1}, {{0x024E, 0x8003}, -8450, 2}, {{0x801F, 0x800D}, -8650, 2}, {{0x0250, 0x0254}, -9250, 2},
+  {{0x8000, 0x0251}, -10000, 2}, {{0x0252, 0x8008}, 4249, 1}, {{0x8006, 0x0253}, 4235, 1}, {{0x8008, 0x8026}, -9750, 2},
+  {{0x8003, 0x0255}, 850, 3}, {{0x0256, 0x8003}, -8401, 2}, {{0x8002, 0x0257}, -8850, 2}, {{0x8004, 0x8009}, -8750, 2},
+  {{0x8000, 0x0259}, 750, 3}, {{0x804D, 0x025A}, -9400, 2}, {{0x804E, 0x8003}, -8650, 2}, {{0x8000, 0x025C}, 750, 3},
+  {{0x8000, 0x025D}, 4235, 1}, {{0x025E, 0x8004}, 4264, 1}, {{0x025F, 0x0261}, 850, 3}, {{0x8020, 0x0260}, 4244, 1},
+  {{0x8003, 0x804A}, 4254, 1}, {{0x800E, 0x8003}, -9100, 2}, {{0x8000, 0x0263}, 750, 3}, {{0x0264, 0x0265}, 4244, 1},
+  {{0x8001, 0x8000}, 850, 3}, {{0x0266, 0x801D}, 4264, 1}, {{0x8003, 0x0267}, 4254, 1}, {{0x8041, 0x8003}, 850, 3},
+  {{0x0269, 0x026B}, -9250, 2}, {{0x8000, 0x026A}, -10050, 2}, {{0x804B, 0x802F}, -9750, 2}, {{0x8003, 0x804F}, 850, 3},
+  {{0x026D, 0x0270}, -9250, 2}, {{0x8000, 0x026E}, 750, 3}, {{0x026F, 0x8050}, -9650, 2}, {{0x8005, 0x8009}, 4249, 1},
+  {{0x8051, 0x8003}, -8650, 2}, {{0x0272, 0x0274}, -9450, 2}, {{0x0273, 0x8000}, 4264, 1}, {{0x8000, 0x8052}, -10250, 2},
+  {{0x8026, 0x0275}, 4244, 1}, {{0x8053, 0x8003}, -8650, 2}, {{0x0277, 0x0279}, 4244, 1}, {{0x8000, 0x0278}, 750, 3},
+  {{0x800B, 0x8000}, -9351, 2}, {{0x027A, 0x027B}, -9301, 2}, {{0x8000, 0x8005}, 750, 3}, {{0x8003, 0x8054}, 4254, 1},
+  {{0x8000, 0x027D}, 750, 3}, {{0x027E, 0x0280}, 850, 3}, {{0x8055, 0x027F}, 4244, 1}, {{0x8003, 0x800E}, 4254, 1},
+  {{0x8000, 0x0281}, -9001, 2}, {{0x8004, 0x8056}, 4254, 1}, {{0x0283, 0x0285}, -9301, 2}, {{0x8000, 0x0284}, 750, 3},
+  {{0x8007, 0x8000}, 850, 3}, {{0x0286, 0x8003}, -8401, 2}, {{0x8003, 0x0287}, 850, 3}, {{0x800C, 0x8041}, -8650, 2},
+  {{0x0289, 0x028A}, 4244, 1}, {{0x8032, 0x8029}, 4235, 1}, {{0x028B, 0x028D}, -9301, 2}, {{0x8000, 0x028C}, 750, 3},
+  {{0x8007, 0x8000}, -9850, 2}, {{0x8003, 0x8004}, 4264, 1}, {{0x8000, 0x028F}, 750, 3}, {{0x0290, 0x0292}, -8750, 2},
+  {{0x0291, 0x800C}, 4244, 1}, {{0x8000, 0x8015}, -9500, 2}, {{0x8003, 0x0293}, 850, 3}, {{0x8057, 0x8003}, -8401, 2},
+  {{0x8000, 0x0295}, 750, 3}, {{0x801D, 0x0296}, -9250, 2}, {{0x8003, 0x8058}, 850, 3}, {{0x0298, 0x029B}, -9250, 2},
+  {{0x0299, 0x8000}, 4264, 1}, {{0x8000, 0x029A}, -10100, 2}, {{0x800D, 0x8042}, -9750, 2}, {{0x8003, 0x029C}, 850, 3},
+  {{0x029D, 0x8003}, -8351, 2}, {{0x8003, 0x8059}, -8850, 2}, {{0x029F, 0x02A1}, -9500, 2}, {{0x8000, 0x02A0}, 4254, 1},
+  {{0x800B, 0x8000}, 4264, 1}, {{0x8013, 0x02A2}, 4244, 1}, {{0x8003, 0x804C}, 4254, 1}, {{0x02A4, 0x02A7}, -9051, 2},
+  {{0x8000, 0x02A5}, 750, 3}, {{0x02A6, 0x802F}, 850, 3}, {{0x802B, 0x800A}, 4249, 1}, {{0x02A8, 0x8003}, -8450, 2},
+  {{0x800D, 0x805A}, 4254, 1}, {{0x02AA, 0x02AC}, -9850, 2}, {{0x8000, 0x02AB}, -10200, 2}, {{0x8000, 0x8019}, 750, 3},
+  {{0x02AD, 0x02AE}, 4244, 1}, {{0x801F, 0x8000}, 850, 3}, {{0x8004, 0x02AF}, -9400, 2}, {{0x02B0, 0x8003}, -8750, 2},
+  {{0x8003, 0x8007}, 4254, 1}, {{0x02B2, 0x02B6}, -9051, 2}, {{0x8000, 0x02B3}, -10050, 2}, {{0x02B4, 0x800C}, 4254, 1},
+  {{0x8012, 0x02B5}, -9701, 2}, {{0x8026, 0x8000}, 850, 3}, {{0x8054, 0x8003}, -8450, 2}, {{0x02B8, 0x02BB}, -9400, 2},
+  {{0x02B9, 0x8000}, 4264, 1}, {{0x8000, 0x02BA}, 750, 3}, {{0x800B, 0x8000}, -9650, 2}, {{0x8026, 0x02BC}, 4244, 1},
+  {{0x8003, 0x02BD}, 850, 3}, {{0x8003, 0x8035}, -8750, 2}, {{0x8000, 0x02BF}, 750, 3}, {{0x02C0, 0x8003}, -8401, 2},
+  {{0x02C1, 0x02C2}, 4244, 1}, {{0x800B, 0x8000}, 850, 3}, {{0x02C3, 0x8000}, 4275, 1}, {{0x800E, 0x8003}, -9800, 2},
+  {{0x8000, 0x02C5}, 750, 3}, {{0x02C6, 0x02C8}, -9250, 2}, {{0x02C7, 0x8000}, 850, 3}, {{0x801A, 0x8009}, 4249, 1},
+  {{0x8003, 0x02C9}, 850, 3}, {{0x8028, 0x02CA}, 4254, 1}, {{0x802E, 0x8003}, -8600, 2}, {{0x02CC, 0x02CF}, 4244, 1},
+  {{0x02CD, 0x800B}, -9450, 2}, {{0x02CE, 0x8000}, -9750, 2}, {{0x8000, 0x8006}, 750, 3}, {{0x02D0, 0x02D4}, 4264, 1},
+  {{0x801A, 0x02D1}, -10000, 2}, {{0x02D2, 0x02D3}, 850, 3}, {{0x8003, 0x801B}, 4254, 1}, {{0x8007, 0x8003}, -8900, 2},
+  {{0x8000, 0x8004}, 850, 3}, {{0x02D6, 0x02D8}, -9301, 2}, {{0x02D7, 0x800B}, -9850, 2}, {{0x8000, 0x801A}, -10150, 2},
+  {{0x8015, 0x02D9}, 4244, 1}, {{0x8003, 0x8009}, 4264, 1}, {{0x02DB, 0x02DF}, -9250, 2}, {{0x8000, 0x02DC}, 750, 3},
+  {{0x02DD, 0x8000}, 850, 3}, {{0x02DE, 0x8028}, 4249, 1}, {{0x8019, 0x801A}, -9800, 2}, {{0x02E0, 0x8003}, -8650, 2},
+  {{0x8012, 0x800D}, 4254, 1}, {{0x8000, 0x02E2}, 750, 3}, {{0x02E3, 0x02E4}, 4244, 1}, {{0x8004, 0x8000}, -9750, 2},
+  {{0x02E5, 0x8005}, 4264, 1}, {{0x02E6, 0x02E7}, 4254, 1}, {{0x8003, 0x800C}, 850, 3}, {{0x8007, 0x8003}, -9300, 2},
+  {{0x02E9, 0x02EA}, 4244, 1}, {{0x8000, 0x8044}, -9850, 2}, {{0x02EB, 0x02ED}, -9400, 2}, {{0x02EC, 0x8000}, 4264, 1},
+  {{0x8000, 0x8013}, -10200, 2}, {{0x8003, 0x8012}, 4264, 1}, {{0x02EF, 0x02F1}, 4244, 1}, {{0x8000, 0x02F0}, 750, 3},
+  {{0x8013, 0x8000}, -9351, 2}, {{0x8000, 0x02F2}, -10200, 2}, {{0x8003, 0x800D}, 4264, 1}, {{0x02F4, 0x02F6}, 4244, 1},
+  {{0x8000, 0x02F5}, 750, 3}, {{0x800E, 0x8000}, -9500, 2}, {{0x02F7, 0x02FA}, 4264, 1}, {{0x8011, 0x02F8}, 4254, 1},
+  {{0x02F9, 0x8003}, 850, 3}, {{0x800E, 0x801B}, -9800, 2}, {{0x02FB, 0x8000}, 4275, 1}, {{0x8000, 0x8007}, -9950, 2},
+  {{0x8000, 0x02FD}, 750, 3}, {{0x02FE, 0x02FF}, -9250, 2}, {{0x802D, 0x801F}, 4249, 1}, {{0x0300, 0x803D}, 4254, 1},
+  {{0x8003, 0x801F}, 850, 3}, {{0x8000, 0x0302}, 750, 3}, {{0x0303, 0x0304}, 4244, 1}, {{0x8013, 0x8008}, 4235, 1},
+  {{0x0305, 0x8003}, -9400, 2}, {{0x800E, 0x8015}, -9850, 2}, {{0x0307, 0x0309}, 4244, 1}, {{0x8000, 0x0308}, 750, 3},
+  {{0x8008, 0x8000}, 850, 3}, {{0x8000, 0x030A}, -10050, 2}, {{0x030B, 0x8013}, 4264, 1}, {{0x8028, 0x8003}, -9400, 2},
+  {{0x8000, 0x030D}, 750, 3}, {{0x030E, 0x030F}, 4244, 1}, {{0x800E, 0x8000}, 850, 3}, {{0x0310, 0x0311}, 850, 3},
+  {{0x800E, 0x8003}, -9150, 2}, {{0x0312, 0x8003}, -8600, 2}, {{0x0313, 0x8032}, 4264, 1}, {{0x8002, 0x8003}, -8950, 2},
+  {{0x0315, 0x0317}, -9250, 2}, {{0x8000, 0x0316}, -10150, 2}, {{0x8026, 0x801F}, 4249, 1}, {{0x0318, 0x805B}, 4254, 1},
+  {{0x8003, 0x8004}, 850, 3}, {{0x031A, 0x031B}, 4244, 1}, {{0x8000, 0x8036}, -9450, 2}, {{0x031C, 0x031D}, -10050, 2},
+  {{0x8033, 0x8000}, 4264, 1}, {{0x031E, 0x8003}, -8750, 2}, {{0x801B, 0x031F}, 850, 3}, {{0x8008, 0x8004}, -9100, 2},
+  {{0x8000, 0x0321}, 750, 3}, {{0x0322, 0x0324}, -9301, 2}, {{0x0323, 0x8017}, -9650, 2}, {{0x802B, 0x8004}, -9850, 2},
+  {{0x0325, 0x8003}, -8450, 2}, {{0x8003, 0x0326}, 850, 3}, {{0x800D, 0x800B}, -8750, 2}, {{0x8000, 0x0328}, 750, 3},
+  {{0x0329, 0x032A}, 4244, 1}, {{0x8004, 0x8000}, -9750, 2}, {{0x8052, 0x032B}, -9300, 2}, {{0x8003, 0x8002}, 4264, 1},
+  {{0x032D, 0x0331}, -9051, 2}, {{0x032E, 0x8000}, 4264, 1}, {{0x8000, 0x032F}, 750, 3}, {{0x0330, 0x8028}, 4244, 1},
+  {{0x8009, 0x8000}, -9701, 2}, {{0x8003, 0x0332}, 850, 3}, {{0x0333, 0x8003}, -8401, 2}, {{0x801D, 0x8003}, 4254, 1},
+  {{0x0335, 0x033A}, -9051, 2}, {{0x8000, 0x0336}, -10150, 2}, {{0x0337, 0x0338}, -9750, 2}, {{0x8012, 0x8013}, 4244, 1},
+  {{0x0339, 0x8000}, 850, 3}, {{0x8015, 0x800B}, 4244, 1}, {{0x8003, 0x033B}, 850, 3}, {{0x8012, 0x8043}, 4254, 1},
+  {{0x033D, 0x8000}, 4275, 1}, {{0x033E, 0x8003}, -9500, 2}, {{0x8000, 0x033F}, -10150, 2}, {{0x0340, 0x8004}, 4254, 1},
+  {{0x8017, 0x8000}, -9750, 2}, {{0x0342, 0x0344}, 4244, 1}, {{0x8000, 0x0343}, -10000, 2}, {{0x8005, 0x8032}, -9750, 2},
+  {{0x0345, 0x0347}, 4264, 1}, {{0x803F, 0x0346}, 4254, 1}, {{0x8000, 0x8003}, -10150, 2}, {{0x8000, 0x805C}, 850, 3},
+  {{0x0349, 0x034C}, -9250, 2}, {{0x8000, 0x034A}, 750, 3}, {{0x034B, 0x8000}, -9650, 2}, {{0x8004, 0x800E}, 4249, 1},
+  {{0x8003, 0x8002}, 850, 3}, {{0x034E, 0x0351}, -9250, 2}, {{0x8000, 0x034F}, 750, 3}, {{0x0350, 0x8025}, -9650, 2},
+  {{0x8019, 0x8012}, 4249, 1}, {{0x0352, 0x8003}, -8450, 2}, {{0x8000, 0x0353}, 4244, 1}, {{0x8003, 0x8005}, 4264, 1},
+  {{0x0355, 0x0358}, -9250, 2}, {{0x8000, 0x0356}, 750, 3}, {{0x0357, 0x8000}, -9750, 2}, {{0x8019, 0x8009}, 4249, 1},
+  {{0x0359, 0x8003}, -8401, 2}, {{0x8003, 0x035A}, -8850, 2}, {{0x805D, 0x8012}, -8550, 2}, {{0x035C, 0x035F}, -9450, 2},
+  {{0x035D, 0x8000}, 4264, 1}, {{0x035E, 0x8033}, 4244, 1}, {{0x8000, 0x8005}, 750, 3}, {{0x8005, 0x0360}, 4244, 1},
+  {{0x8003, 0x0361}, 4254, 1}, {{0x8002, 0x8003}, -8850, 2}, {{0x0363, 0x0367}, -9250, 2}, {{0x8000, 0x0364}, -10200, 2},
+  {{0x0365, 0x0366}, -9750, 2}, {{0x8004, 0x8044}, -9950, 2}, {{0x8044, 0x8000}, 850, 3}, {{0x803D, 0x0368}, 4254, 1},
+  {{0x0369, 0x8003}, -8650, 2}, {{0x8003, 0x801B}, -8850, 2}, {{0x8000, 0x036B}, 750, 3}, {{0x036C, 0x036D}, -9051, 2},
+  {{0x805E, 0x8000}, 4264, 1}, {{0x8015, 0x036E}, 4244, 1}, {{0x036F, 0x8003}, -8650, 2}, {{0x8003, 0x8002}, -8850, 2},
+  {{0x0371, 0x0373}, -9450, 2}, {{0x8000, 0x0372}, 750, 3}, {{0x801C, 0x801E}, 4254, 1}, {{0x0374, 0x8003}, -8401, 2},
+  {{0x8003, 0x0375}, 850, 3}, {{0x8005, 0x805F}, 4254, 1}, {{0x0377, 0x037B}, -9250, 2}, {{0x0378, 0x037A}, 4254, 1},
+  {{0x8000, 0x0379}, 750, 3}, {{0x8000, 0x8026}, -9650, 2}, {{0x8000, 0x8018}, 750, 3}, {{0x8003, 0x037C}, 850, 3},
+  {{0x8005, 0x803D}, 4254, 1}, {{0x8000, 0x037E}, 750, 3}, {{0x037F, 0x0381}, -9051, 2}, {{0x0380, 0x801A}, 850, 3},
+  {{0x801D, 0x8004}, -9850, 2}, {{0x0382, 0x0383}, 4254, 1}, {{0x8003, 0x800D}, -8550, 2}, {{0x8003, 0x0384}, 850, 3},
+  {{0x8007, 0x8003}, -8750, 2}, {{0x0386, 0x0388}, -9850, 2}, {{0x8000, 0x0387}, 650, 3}, {{0x8000, 0x8026}, 4254, 1},
+  {{0x0389, 0x038A}, 4244, 1}, {{0x8032, 0x8005}, 4235, 1}, {{0x038B, 0x038C}, 850, 3}, {{0x8003, 0x8028}, 4254, 1},
+  {{0x038D, 0x8003}, -8650, 2}, {{0x801F, 0x8004}, -8850, 2}, {{0x038F, 0x0391}, -9051, 2}, {{0x8000, 0x0390}, 750, 3},
+  {{0x8038, 0x8060}, -9650, 2}, {{0x0392, 0x804C}, 4254, 1}, {{0x0393, 0x8003}, -8450, 2}, {{0x8009, 0x800E}, -8650, 2},
+  {{0x0395, 0x0397}, -9250, 2}, {{0x8000, 0x0396}, 750, 3}, {{0x802F, 0x802D}, -9850, 2}, {{0x8009, 0x0398}, -9051, 2},
+  {{0x8003, 0x0399}, 4254, 1}, {{0x8028, 0x8003}, -8750, 2}, {{0x039B, 0x039E}, -9450, 2}, {{0x8000, 0x039C}, -10150, 2},
+  {{0x039D, 0x802B}, 4254, 1}, {{0x801D, 0x8000}, -9750, 2}, {{0x800B, 0x039F}, 4244, 1}, {{0x8003, 0x800A}, 4264, 1},
+  {{0x03A1, 0x03A3}, 4244, 1}, {{0x03A2, 0x8019}, -8951, 2}, {{0x8000, 0x8032}, -9850, 2}, {{0x03A4, 0x03A7}, 4264, 1},
+  {{0x8061, 0x03A5}, 4254, 1}, {{0x8005, 0x03A6}, -10050, 2}, {{0x8041, 0x8003}, 850, 3}, {{0x8000, 0x8015}, -9950, 2},
+  {{0x03A9, 0x03AC}, -9250, 2}, {{0x8000, 0x03AA}, -10200, 2}, {{0x8000, 0x03AB}, 750, 3}, {{0x8040, 0x8013}, -9750, 2},
+  {{0x03AD, 0x8003}, -8401, 2}, {{0x03AE, 0x800C}, -8550, 2}, {{0x8003, 0x8016}, 850, 3}, {{0x8000, 0x03B0}, 750, 3},
+  {{0x03B1, 0x03B2}, -9301, 2}, {{0x8062, 0x8029}, -9750, 2}, {{0x03B3, 0x8003}, -8401, 2}, {{0x8003, 0x03B4}, -8850, 2},
+  {{0x8018, 0x8004}, -8550, 2}, {{0x8000, 0x03B6}, 750, 3}, {{0x8005, 0x03B7}, 4244, 1}, {{0x800E, 0x8003}, -9301, 2},
+  {{0x8000, 0x03B9}, 750, 3}, {{0x03BA, 0x03BC}, -9250, 2}, {{0x03BB, 0x8028}, 4254, 1}, {{0x8015, 0x8015}, -9650, 2},
+  {{0x8003, 0x03BD}, 850, 3}, {{0x800C, 0x03BE}, -8750, 2}, {{0x8009, 0x8003}, 4254, 1}, {{0x8000, 0x03C0}, 750, 3},
+  {{0x03C1, 0x03C2}, 4244, 1}, {{0x801D, 0x8000}, -9701, 2}, {{0x03C3, 0x8004}, 4264, 1}, {{0x8043, 0x8003}, 850, 3},
+  {{0x8000, 0x03C5}, 750, 3}, {{0x03C6, 0x03C7}, 4244, 1}, {{0x8025, 0x8001}, 4235, 1}, {{0x03C8, 0x8003}, -8650, 2},
+  {{0x03C9, 0x8002}, -8750, 2}, {{0x8007, 0x8003}, 4254, 1}, {{0x03CB, 0x03CE}, -9250, 2}, {{0x8000, 0x03CC}, -10200, 2},
+  {{0x03CD, 0x8000}, -9750, 2}, {{0x8009, 0x8004}, -9950, 2}, {{0x03CF, 0x8003}, -8450, 2}, {{0x802B, 0x8043}, 4254, 1},
+  {{0x8000, 0x03D1}, 750, 3}, {{0x03D2, 0x03D4}, 850, 3}, {{0x03D3, 0x8003}, -9400, 2}, {{0x8013, 0x800C}, 4249, 1},
+  {{0x03D5, 0x800C}, 4264, 1}, {{0x800D, 0x8003}, 4254, 1}, {{0x03D7, 0x03D9}, 4244, 1}, {{0x03D8, 0x801D}, -9850, 2},
+  {{0x8000, 0x801A}, -10100, 2}, {{0x8000, 0x03DA}, 750, 3}, {{0x03DB, 0x8004}, 4264, 1}, {{0x8009, 0x8003}, -9400, 2},
+  {{0x03DD, 0x03DF}, -9450, 2}, {{0x8000, 0x03DE}, -10050, 2}, {{0x8063, 0x8006}, 4254, 1}, {{0x8003, 0x03E0}, 850, 3},
+  {{0x8000, 0x03E1}, 4244, 1}, {{0x8003, 0x800D}, 4264, 1}, {{0x8000, 0x03E3}, 750, 3}, {{0x03E4, 0x03E6}, -9250, 2},
+  {{0x03E5, 0x8000}, 4264, 1}, {{0x8004, 0x8064}, -9650, 2}, {{0x03E7, 0x8003}, -8401, 2}, {{0x800D, 0x805F}, 4254, 1},
+  {{0x03E9, 0x03EC}, -9250, 2}, {{0x8000, 0x03EA}, -10150, 2}, {{0x8000, 0x03EB}, 4254, 1}, {{0x8004, 0x8008}, -9750, 2},
+  {{0x03ED, 0x8003}, -8650, 2}, {{0x8003, 0x03EE}, 850, 3}, {{0x801B, 0x8012}, -8950, 2}, {{0x03F0, 0x03F2}, 4244, 1},
+  {{0x8000, 0x03F1}, 750, 3}, {{0x8032, 0x8000}, 850, 3}, {{0x03F3, 0x03F4}, -9400, 2}, {{0x8036, 0x8000}, 4264, 1},
+  {{0x8003, 0x8005}, 4264, 1}, {{0x03F6, 0x03F8}, -9500, 2}, {{0x8000, 0x03F7}, 750, 3}, {{0x801E, 0x8032}, -9650, 2},
+  {{0x03F9, 0x03FA}, 4254, 1}, {{0x8003, 0x8007}, -8550, 2}, {{0x8020, 0x8003}, -8650, 2}, {{0x03FC, 0x03FF}, -9051, 2},
+  {{0x8000, 0x03FD}, -10150, 2}, {{0x03FE, 0x8013}, 4244, 1}, {{0x8033, 0x8000}, 4235, 1}, {{0x0400, 0x0401}, -8750, 2},
+  {{0x8003, 0x800C}, -8850, 2}, {{0x0402, 0x8003}, 4254, 1}, {{0x8003, 0x8002}, 850, 3}, {{0x0404, 0x0407}, 4244, 1},
+  {{0x8000, 0x0405}, 4235, 1}, {{0x8000, 0x0406}, -10000, 2}, {{0x8005, 0x8005}, -9550, 2}, {{0x8000, 0x0408}, -10200, 2},
+  {{0x0409, 0x040A}, 850, 3}, {{0x8018, 0x8003}, -9400, 2}, {{0x040B, 0x8008}, 4264, 1}, {{0x8007, 0x8003}, -8900, 2},
+  {{0x040D, 0x0410}, -9301, 2}, {{0x8000, 0x040E}, 750, 3}, {{0x040F, 0x801E}, 4254, 1}, {{0x8013, 0x8000}, -9750, 2},
+  {{0x0411, 0x8003}, -8450, 2}, {{0x800F, 0x8003}, 4254, 1}, {{0x0413, 0x0414}, 4244, 1}, {{0x8032, 0x8000}, 4235, 1},
+  {{0x0415, 0x0417}, 4264, 1}, {{0x0416, 0x8003}, -9400, 2}, {{0x8000, 0x8015}, -10200, 2}, {{0x8000, 0x8008}, 850, 3},
+  {{0x0419, 0x041C}, -9250, 2}, {{0x8000, 0x041A}, -10150, 2}, {{0x041B, 0x8004}, 4254, 1}, {{0x8000, 0x802D}, -9850, 2},
+  {{0x041D, 0x041E}, -8750, 2}, {{0x803B, 0x800D}, -8850, 2}, {{0x041F, 0x8003}, 4254, 1}, {{0x8003, 0x8007}, 850, 3},
+  {{0x8000, 0x0421}, 750, 3}, {{0x0422, 0x0424}, -9301, 2}, {{0x0423, 0x801A}, -9701, 2}, {{0x8019, 0x803F}, -9950, 2},
+  {{0x0425, 0x8003}, -8650, 2}, {{0x8003, 0x800E}, -8850, 2}, {{0x8000, 0x0427}, 750, 3}, {{0x0428, 0x8003}, -8650, 2},
+  {{0x0429, 0x8032}, 4264, 1}, {{0x042A, 0x042B}, -9051, 2}, {{0x8019, 0x8014}, 4254, 1}, {{0x800D, 0x8003}, 4254, 1},
+  {{0x8000, 0x042D}, 750, 3}, {{0x042E, 0x042F}, 4244, 1}, {{0x8006, 0x8050}, -9450, 2}, {{0x0430, 0x8003}, -8650, 2},
+  {{0x8001, 0x8046}, -9301, 2}, {{0x0432, 0x0435}, -9051, 2}, {{0x8000, 0x0433}, -10200, 2}, {{0x0434, 0x800D}, 4254, 1},
+  {{0x8033, 0x8000}, -9701, 2}, {{0x8003, 0x0436}, 850, 3}, {{0x800D, 0x8035}, 4254, 1}, {{0x0438, 0x043C}, -9250, 2},
+  {{0x8000, 0x0439}, 750, 3}, {{0x043A, 0x8000}, 850, 3}, {{0x8009, 0x043B}, -9850, 2}, {{0x8005, 0x8026}, -9650, 2},
+  {{0x8003, 0x043D}, 850, 3}, {{0x8003, 0x8021}, -8850, 2}, {{0x8000, 0x043F}, 750, 3}, {{0x0440, 0x0441}, -9500, 2},
+  {{0x8015, 0x8004}, 4254, 1}, {{0x0442, 0x8003}, -8401, 2}, {{0x8003, 0x0443}, 850, 3}, {{0x8008, 0x8065}, -8950, 2},
+  {{0x0445, 0x0448}, -9250, 2}, {{0x8000, 0x0446}, 750, 3}, {{0x0447, 0x8000}, 4264, 1}, {{0x800D, 0x8064}, -9750, 2},
+  {{0x0449, 0x8003}, -8650, 2}, {{0x8003, 0x803B}, -8850, 2}, {{0x044B, 0x044D}, -9250, 2}, {{0x8000, 0x044C}, -10200, 2},
+  {{0x8033, 0x8012}, 4254, 1}, {{0x8066, 0x8003}, -8401, 2}, {{0x8000, 0x044F}, 750, 3}, {{0x0450, 0x0451}, 850, 3},
+  {{0x801D, 0x8003}, -9500, 2}, {{0x801D, 0x0452}, -9051, 2}, {{0x8061, 0x8003}, -8351, 2}, {{0x0454, 0x0456}, -9450, 2},
+  {{0x8000, 0x0455}, 750, 3}, {{0x8000, 0x8008}, 4254, 1}, {{0x0457, 0x8003}, -8450, 2}, {{0x0458, 0x0459}, -8850, 2},
+  {{0x8002, 0x8003}, -9100, 2}, {{0x8004, 0x8014}, 4254, 1}, {{0x045B, 0x045F}, -9051, 2}, {{0x8000, 0x045C}, -10200, 2},
+  {{0x045D, 0x800E}, 4254, 1}, {{0x8026, 0x045E}, 4235, 1}, {{0x8000, 0x8015}, 750, 3}, {{0x0460, 0x800D}, 4264, 1},
+  {{0x8003, 0x0461}, 850, 3}, {{0x8003, 0x0462}, -8550, 2}, {{0x8007, 0x8003}, 4254, 1}, {{0x0464, 0x0466}, -9450, 2},
+  {{0x8000, 0x0465}, -10200, 2}, {{0x8067, 0x8007}, 4254, 1}, {{0x0467, 0x0468}, -8750, 2}, {{0x8019, 0x8003}, 4244, 1},
+  {{0x8003, 0x0469}, 850, 3}, {{0x801B, 0x8003}, -8351, 2}, {{0x8000, 0x046B}, 750, 3}, {{0x046C, 0x046E}, -9250, 2},
+  {{0x046D, 0x8000}, 850, 3}, {{0x800C, 0x8004}, -9850, 2}, {{0x8003, 0x046F}, 850, 3}, {{0x802B, 0x8003}, 4254, 1},
+  {{0x8000, 0x0471}, 750, 3}, {{0x0472, 0x0473}, 4244, 1}, {{0x800B, 0x8000}, 850, 3}, {{0x0474, 0x0475}, 850, 3},
+  {{0x8019, 0x8003}, -9400, 2}, {{0x0476, 0x800C}, 4264, 1}, {{0x8018, 0x8003}, 4254, 1}, {{0x0478, 0x047A}, -9051, 2},
+  {{0x8000, 0x0479}, 750, 3}, {{0x8064, 0x800C}, 4254, 1}, {{0x047B, 0x047C}, 4254, 1}, {{0x8014, 0x8003}, -8401, 2},
+  {{0x803D, 0x8003}, -8650, 2}, {{0x047E, 0x0481}, -9301, 2}, {{0x8000, 0x047F}, 750, 3}, {{0x0480, 0x8000}, 4264, 1},
+  {{0x8018, 0x801D}, -9701, 2}, {{0x0482, 0x0483}, -8650, 2}, {{0x8004, 0x8002}, 4254, 1}, {{0x0484, 0x8003}, -8450, 2},
+  {{0x8007, 0x8003}, 4254, 1}, {{0x0486, 0x0488}, 4244, 1}, {{0x8000, 0x0487}, 750, 3}, {{0x800E, 0x8001}, -9650, 2},
+  {{0x8000, 0x0489}, 750, 3}, {{0x801F, 0x048A}, -9400, 2}, {{0x048B, 0x8003}, -8650, 2}, {{0x8003, 0x8028}, 4254, 1},
+  {{0x048D, 0x048E}, 4244, 1}, {{0x8000, 0x8004}, -9450, 2}, {{0x048F, 0x0490}, 4264, 1}, {{0x8026, 0x8003}, -10050, 2},
+  {{0x8000, 0x801D}, -10050, 2}, {{0x8000, 0x0492}, 750, 3}, {{0x0493, 0x0494}, 4244, 1}, {{0x8000, 0x804B}, 4235, 1},
+  {{0x0495, 0x8044}, 4264, 1}, {{0x8020, 0x8003}, 850, 3}, {{0x0497, 0x049A}, -9250, 2}, {{0x8000, 0x0498}, -10150, 2},
+  {{0x8000, 0x0499}, 750, 3}, {{0x800A, 0x8025}, -9750, 2}, {{0x049B, 0x049C}, 4254, 1}, {{0x8003, 0x8009}, 850, 3},
+  {{0x803B, 0x8003}, -8750, 2}, {{0x049E, 0x04A1}, -9301, 2}, {{0x049F, 0x8000}, 4264, 1}, {{0x8000, 0x04A0}, -10050, 2},
+  {{0x8068, 0x800C}, 4254, 1}, {{0x8009, 0x04A2}, 4254, 1}, {{0x8007, 0x8003}, -8700, 2}, {{0x04A4, 0x04A8}, 4264, 1},
+  {{0x04A5, 0x04A6}, -9400, 2}, {{0x8000, 0x8005}, -10150, 2}, {{0x04A7, 0x8003}, -8700, 2}, {{0x8003, 0x800E}, -8850, 2},
+  {{0x8032, 0x8000}, 4275, 1}, {{0x04AA, 0x04AC}, -9250, 2}, {{0x8000, 0x04AB}, 750, 3}, {{0x8032, 0x8001}, 4254, 1},
+  {{0x8003, 0x04AD}, 850, 3}, {{0x8039, 0x8003}, -8401, 2}, {{0x04AF, 0x04B2}, -9001, 2}, {{0x8000, 0x04B0}, 750, 3},
+  {{0x800E, 0x04B1}, -9850, 2}, {{0x8000, 0x8005}, 4254, 1}, {{0x8003, 0x04B3}, 850, 3}, {{0x805F, 0x8007}, 4264, 1},
+  {{0x04B5, 0x04B6}, 4244, 1}, {{0x8000, 0x8005}, -9450, 2}, {{0x04B7, 0x04B9}, -9301, 2}, {{0x04B8, 0x8000}, 4264, 1},
+  {{0x8000, 0x800C}, 750, 3}, {{0x8003, 0x04BA}, 4254, 1}, {{0x8020, 0x8003}, -8600, 2}, {{0x04BC, 0x04BE}, 4244, 1},
+  {{0x8000, 0x04BD}, 750, 3}, {{0x8000, 0x8006}, -9500, 2}, {{0x8000, 0x04BF}, 750, 3}, {{0x8043, 0x04C0}, 850, 3},
+  {{0x8015, 0x04C1}, -9100, 2}, {{0x8003, 0x04C2}, 4254, 1}, {{0x8057, 0x8003}, -8600, 2}, {{0x8000, 0x04C4}, 750, 3},
+  {{0x04C5, 0x04C7}, -9250, 2}, {{0x04C6, 0x8000}, 850, 3}, {{0x8032, 0x8004}, -9750, 2}, {{0x04C8, 0x04C9}, -8650, 2},
+  {{0x803F, 0x8046}, -8850, 2}, {{0x04CA, 0x8003}, 4254, 1}, {{0x8009, 0x8003}, -8250, 2}, {{0x04CC, 0x04CF}, -9250, 2},
+  {{0x04CD, 0x04CE}, 4254, 1}, {{0x8000, 0x801D}, 750, 3}, {{0x8000, 0x800A}, 750, 3}, {{0x04D0, 0x8003}, 4254, 1},
+  {{0x8003, 0x8007}, 850, 3}, {{0x04D2, 0x04D5}, -9301, 2}, {{0x8000, 0x04D3}, -10150, 2}, {{0x04D4, 0x800B}, 4254, 1},
+  {{0x8000, 0x8033}, -9850, 2}, {{0x04D6, 0x8003}, -8450, 2}, {{0x8003, 0x802A}, -8850, 2}, {{0x04D8, 0x04DB}, -9400, 2},
+  {{0x8000, 0x04D9}, -10150, 2}, {{0x04DA, 0x8000}, -9850, 2}, {{0x8000, 0x800E}, 750, 3}, {{0x8003, 0x8069}, 850, 3},
+  {{0x04DD, 0x04DF}, 4244, 1}, {{0x8000, 0x04DE}, 750, 3}, {{0x8008, 0x8000}, 850, 3}, {{0x8000, 0x04E0}, 750, 3},
+  {{0x8004, 0x04E1}, -9301, 2}, {{0x8003, 0x04E2}, 850, 3}, {{0x8035, 0x8003}, -8650, 2}, {{0x04E4, 0x04E7}, 4244, 1},
+  {{0x8060, 0x04E5}, 4235, 1}, {{0x04E6, 0x8008}, -9750, 2}, {{0x8000, 0x8025}, 600, 3}, {{0x8000, 0x04E8}, 750, 3},
+  {{0x04E9, 0x8012}, 4264, 1}, {{0x04EA, 0x8003}, 4254, 1}, {{0x8003, 0x8028}, 850, 3}, {{0x04EC, 0x04EF}, -9051, 2},
+  {{0x04ED, 0x8000}, 4264, 1}, {{0x04EE, 0x8030}, -9800, 2}, {{0x8000, 0x8004}, 750, 3}, {{0x8014, 0x8003}, -8750, 2},
+  {{0x04F1, 0x04F4}, -9250, 2}, {{0x8000, 0x04F2}, -10150, 2}, {{0x8013, 0x04F3}, -9850, 2}, {{0x8005, 0x801D}, 4249, 1},
+  {{0x04F5, 0x04F6}, -8650, 2}, {{0x8003, 0x8004}, -8850, 2}, {{0x8020, 0x8003}, -8450, 2}, {{0x8000, 0x04F8}, 750, 3},
+  {{0x04F9, 0x04FB}, 850, 3}, {{0x04FA, 0x8003}, -9500, 2}, {{0x8032, 0x8005}, 4249, 1}, {{0x803A, 0x04FC}, 4254, 1},
+  {{0x800E, 0x04FD}, -8850, 2}, {{0x8024, 0x8003}, -8650, 2}, {{0x8000, 0x04FF}, 750, 3}, {{0x0500, 0x0502}, -9250, 2},
+  {{0x800D, 0x0501}, -9750, 2}, {{0x802F, 0x801A}, 4244, 1}, {{0x0503, 0x8003}, -8650, 2}, {{0x800D, 0x803F}, 4254, 1},
+  {{0x8000, 0x0505}, 750, 3}, {{0x0506, 0x0507}, -9250, 2}, {{0x8026, 0x800D}, 4249, 1}, {{0x0508, 0x8003}, -8450, 2},
+  {{0x801B, 0x0509}, -8850, 2}, {{0x8018, 0x8020}, -8650, 2}, {{0x8000, 0x050B}, 4244, 1}, {{0x8000, 0x050C}, 750, 3},
+  {{0x050D, 0x800D}, 4264, 1}, {{0x8003, 0x050E}, 4254, 1}, {{0x8014, 0x8003}, 850, 3}, {{0x0510, 0x0512}, -9500, 2},
+  {{0x8000, 0x0511}, 750, 3}, {{0x8000, 0x8007}, 4254, 1}, {{0x0513, 0x8003}, -8450, 2}, {{0x8003, 0x0514}, 850, 3},
+  {{0x8009, 0x8019}, 4254, 1}, {{0x8000, 0x0516}, 750, 3}, {{0x0517, 0x0518}, -9051, 2}, {{0x8032, 0x803F}, 4244, 1},
+  {{0x0519, 0x800D}, 4264, 1}, {{0x8003, 0x051A}, -8600, 2}, {{0x800F, 0x8003}, -8401, 2}, {{0x8000, 0x051C}, 750, 3},
+  {{0x051D, 0x0520}, -8750, 2}, {{0x051E, 0x8000}, 4264, 1}, {{0x051F, 0x801B}, 4254, 1}, {{0x8008, 0x8000}, 4235, 1},
+  {{0x8003, 0x0521}, 850, 3}, {{0x0522, 0x8003}, -8401, 2}, {{0x800D, 0x8007}, -8550, 2}, {{0x8000, 0x0524}, 750, 3},
+  {{0x0525, 0x8000}, 4275, 1}, {{0x8008, 0x0526}, 4244, 1}, {{0x0527, 0x0528}, 4254, 1}, {{0x8003, 0x8020}, 850, 3},
+  {{0x800D, 0x8003}, -9400, 2}, {{0x052A, 0x052D}, -9250, 2}, {{0x052B, 0x052C}, 4254, 1}, {{0x8000, 0x801C}, 750, 3},
+  {{0x8000, 0x8044}, -10200, 2}, {{0x052E, 0x8003}, -8450, 2}, {{0x052F, 0x8004}, -8550, 2}, {{0x8003, 0x803F}, 4254, 1},
+  {{0x8000, 0x0531}, 750, 3}, {{0x0532, 0x0533}, 850, 3}, {{0x800B, 0x8049}, 4244, 1}, {{0x0534, 0x8032}, 4264, 1},
+  {{0x8005, 0x8003}, 4254, 1}, {{0x8000, 0x0536}, 750, 3}, {{0x0537, 0x806A}, 850, 3}, {{0x0538, 0x0539}, 4244, 1},
+  {{0x8004, 0x8005}, -9750, 2}, {{0x8003, 0x053A}, 4254, 1}, {{0x800A, 0x8003}, -8950, 2}, {{0x053C, 0x053F}, -9450, 2},
+  {{0x8000, 0x053D}, -10050, 2}, {{0x053E, 0x8004}, 4254, 1}, {{0x8008, 0x8000}, -9750, 2}, {{0x8003, 0x0540}, 850, 3},
+  {{0x8002, 0x8003}, -8351, 2}, {{0x0542, 0x0546}, -9051, 2}, {{0x8000, 0x0543}, 750, 3}, {{0x800A, 0x0544}, -9850, 2},
+  {{0x0545, 0x8019}, -9500, 2}, {{0x8013, 0x8026}, -9650, 2}, {{0x8003, 0x0547}, 850, 3}, {{0x8007, 0x8003}, 4254, 1},
+  {{0x0549, 0x054B}, -9500, 2}, {{0x8000, 0x054A}, 750, 3}, {{0x8000, 0x8019}, 4254, 1}, {{0x054C, 0x8003}, -8450, 2},
+  {{0x8003, 0x054D}, 850, 3}, {{0x800E, 0x8008}, 4264, 1}, {{0x054F, 0x8015}, 4264, 1}, {{0x0550, 0x0552}, 4244, 1},
+  {{0x0551, 0x8018}, -9500, 2}, {{0x8000, 0x8032}, -10000, 2}, {{0x0553, 0x0554}, 4254, 1}, {{0x8012, 0x8003}, -8900, 2},
+  {{0x8000, 0x0555}, -10200, 2}, {{0x0556, 0x8003}, 850, 3}, {{0x8020, 0x8003}, -9300, 2}, {{0x0558, 0x055B}, -9250, 2},
+  {{0x8000, 0x0559}, -10200, 2}, {{0x055A, 0x800D}, 4254, 1}, {{0x8033, 0x8000}, -9800, 2}, {{0x8015, 0x055C}, 4244, 1},
+  {{0x8003, 0x8008}, 4264, 1}, {{0x8000, 0x055E}, 750, 3}, {{0x055F, 0x0561}, -9150, 2}, {{0x800B, 0x0560}, -9850, 2},
+  {{0x8000, 0x8026}, 4254, 1}, {{0x8003, 0x0562}, 850, 3}, {{0x8018, 0x8003}, -8401, 2}, {{0x0564, 0x0566}, -9301, 2},
+  {{0x8000, 0x0565}, 750, 3}, {{0x801A, 0x8036}, 4254, 1}, {{0x0567, 0x0568}, 4254, 1}, {{0x8003, 0x800C}, -8550, 2},
+  {{0x801B, 0x8003}, -8600, 2}, {{0x056A, 0x056C}, -9450, 2}, {{0x056B, 0x8000}, 4264, 1}, {{0x8000, 0x8004}, 750, 3},
+  {{0x056D, 0x8003}, -8450, 2}, {{0x8015, 0x8003}, 4244, 1}, {{0x056F, 0x0571}, 4244, 1}, {{0x8000, 0x0570}, 4235, 1},
+  {{0x8000, 0x800E}, 750, 3}, {{0x8000, 0x0572}, 750, 3}, {{0x0573, 0x8036}, 4264, 1}, {{0x800D, 0x8003}, -9400, 2},
+  {{0x8000, 0x0575}, 750, 3}, {{0x801D, 0x0576}, 4244, 1}, {{0x0577, 0x0578}, 850, 3}, {{0x800E, 0x8003}, -9300, 2},
+  {{0x0579, 0x8000}, 4275, 1}, {{0x8024, 0x8003}, -8850, 2}, {{0x057B, 0x057C}, -9250, 2}, {{0x8000, 0x806B}, 750, 3},
+  {{0x057D, 0x8004}, 4264, 1}, {{0x8045, 0x8003}, -8750, 2}, {{0x8000, 0x057F}, 750, 3}, {{0x0580, 0x0582}, 850, 3},
+  {{0x8026, 0x0581}, 4244, 1}, {{0x800E, 0x8003}, -8900, 2}, {{0x8040, 0x802E}, 4254, 1}, {{0x0584, 0x0587}, -9250, 2},
+  {{0x8000, 0x0585}, -10200, 2}, {{0x8000, 0x0586}, 750, 3}, {{0x8040, 0x8000}, -9650, 2}, {{0x8003, 0x0588}, 850, 3},
+  {{0x8003, 0x806C}, -8850, 2}, {{0x8000, 0x058A}, 750, 3}, {{0x058B, 0x058C}, 4244, 1}, {{0x800B, 0x8000}, 850, 3},
+  {{0x058D, 0x801F}, 4264, 1}, {{0x800D, 0x8003}, -9400, 2}, {{0x8000, 0x058F}, 750, 3}, {{0x806D, 0x0590}, -9250, 2},
+  {{0x0591, 0x8003}, -8650, 2}, {{0x8014, 0x8061}, 4254, 1}, {{0x0593, 0x0595}, 4244, 1}, {{0x8000, 0x0594}, 750, 3},
+  {{0x8013, 0x8000}, 850, 3}, {{0x8000, 0x0596}, -10050, 2}, {{0x0597, 0x8019}, 4264, 1}, {{0x8028, 0x8003}, -9400, 2},
+  {{0x0599, 0x059B}, -9301, 2}, {{0x8000, 0x059A}, 750, 3}, {{0x8017, 0x801A}, -9650, 2}, {{0x8003, 0x059C}, 850, 3},
+  {{0x8004, 0x059D}, 4254, 1}, {{0x8007, 0x8003}, -8650, 2}, {{0x059F, 0x05A1}, -9450, 2}, {{0x8000, 0x05A0}, 750, 3},
+  {{0x801E, 0x8032}, -9750, 2}, {{0x800A, 0x05A2}, 4244, 1}, {{0x8003, 0x05A3}, -8750, 2}, {{0x8020, 0x8003}, -8550, 2},
+  {{0x05A5, 0x05A7}, -9301, 2}, {{0x8000, 0x05A6}, 750, 3}, {{0x8000, 0x805C}, 4249, 1}, {{0x05A8, 0x8003}, -8450, 2},
+  {{0x803F, 0x05A9}, -8750, 2}, {{0x8040, 0x800A}, 4254, 1}, {{0x05AB, 0x05AE}, 4244, 1}, {{0x8000, 0x05AC}, 750, 3},
+  {{0x8005, 0x05AD}, -9800, 2}, {{0x8000, 0x8015}, 4235, 1}, {{0x8000, 0x05AF}, -9900, 2}, {{0x8002, 0x05B0}, -9100, 2},
+  {{0x05B1, 0x8003}, -8650, 2}, {{0x8003, 0x8020}, -8850, 2}, {{0x05B3, 0x05B4}, 4244, 1}, {{0x8000, 0x8060}, 750, 3},
+  {{0x8000, 0x05B5}, 750, 3}, {{0x05B6, 0x8003}, -8650, 2}, {{0x8020, 0x05B7}, 4254, 1}, {{0x8007, 0x803A}, 850, 3},
+  {{0x8000, 0x05B9}, 750, 3}, {{0x05BA, 0x05BB}, 4244, 1}, {{0x8014, 0x802F}, -9701, 2}, {{0x800D, 0x05BC}, -9400, 2},
+  {{0x8003, 0x8031}, 4254, 1}, {{0x8000, 0x05BE}, 750, 3}, {{0x05BF, 0x05C1}, -9301, 2}, {{0x05C0, 0x8006}, 4254, 1},
+  {{0x8015, 0x801A}, -9750, 2}, {{0x05C2, 0x8003}, -8750, 2}, {{0x8003, 0x800D}, -8850, 2}, {{0x8000, 0x05C4}, 750, 3},
+  {{0x8008, 0x05C5}, -9250, 2}, {{0x8003, 0x05C6}, 850, 3}, {{0x800C, 0x8003}, 4254, 1}, {{0x8000, 0x05C8}, 750, 3},
+  {{0x05C9, 0x806E}, 850, 3}, {{0x05CA, 0x8003}, -9500, 2}, {{0x8004, 0x8018}, -9750, 2}, {{0x05CC, 0x05CF}, 4244, 1},
+  {{0x8000, 0x05CD}, 750, 3}, {{0x8004, 0x05CE}, -9701, 2}, {{0x8000, 0x801D}, -9051, 2}, {{0x05D0, 0x8003}, -9301, 2},
+  {{0x8004, 0x8000}, 4264, 1}, {{0x05D2, 0x05D4}, 4244, 1}, {{0x8000, 0x05D3}, -9850, 2}, {{0x8006, 0x8000}, 850, 3},
+  {{0x8000, 0x05D5}, 750, 3}, {{0x800A, 0x8003}, -9300, 2}, {{0x8000, 0x05D7}, 750, 3}, {{0x05D8, 0x05DC}, -8650, 2},
+  {{0x05D9, 0x8000}, 4275, 1}, {{0x05DA, 0x803F}, -9051, 2}, {{0x05DB, 0x8033}, 850, 3}, {{0x800F, 0x801E}, -9750, 2},
+  {{0x8020, 0x8003}, 4254, 1}, {{0x05DE, 0x05DF}, -9500, 2}, {{0x8000, 0x8042}, 750, 3}, {{0x8003, 0x05E0}, 850, 3},
+  {{0x05E1, 0x8003}, -8401, 2}, {{0x8004, 0x05E2}, 4254, 1}, {{0x8003, 0x8012}, 4264, 1}, {{0x8000, 0x05E4}, 750, 3},
+  {{0x05E5, 0x05E6}, 4244, 1}, {{0x8006, 0x8000}, 850, 3}, {{0x801F, 0x05E7}, -9301, 2}, {{0x05E8, 0x8003}, -8650, 2},
+  {{0x8003, 0x8028}, 4254, 1}, {{0x05EA, 0x05EC}, -9450, 2}, {{0x8000, 0x05EB}, -10100, 2}, {{0x802F, 0x8006}, -9800, 2},
+  {{0x05ED, 0x8003}, -8450, 2}, {{0x05EE, 0x8013}, 4264, 1}, {{0x8003, 0x05EF}, 850, 3}, {{0x800D, 0x8003}, 4254, 1},
+  {{0x05F1, 0x05F6}, -8750, 2}, {{0x8000, 0x05F2}, 750, 3}, {{0x05F3, 0x05F5}, 850, 3}, {{0x8004, 0x05F4}, -9750, 2},
+  {{0x8008, 0x8007}, 4254, 1}, {{0x8000, 0x8004}, -9051, 2}, {{0x05F7, 0x05F8}, 4254, 1}, {{0x8003, 0x800E}, 850, 3},
+  {{0x8002, 0x8003}, -8550, 2}, {{0x05FA, 0x05FC}, -9250, 2}, {{0x8000, 0x05FB}, 750, 3}, {{0x806F, 0x8070}, -9650, 2},
+  {{0x05FD, 0x8003}, -8401, 2}, {{0x8003, 0x05FE}, -8850, 2}, {{0x8008, 0x8007}, -8650, 2}, {{0x0600, 0x0603}, -9250, 2},
+  {{0x8000, 0x0601}, -10150, 2}, {{0x0602, 0x8004}, 4254, 1}, {{0x8000, 0x8026}, 750, 3}, {{0x8003, 0x0604}, -8750, 2},
+  {{0x8018, 0x0605}, -8650, 2}, {{0x803D, 0x8003}, -8401, 2}, {{0x0607, 0x060B}, -9250, 2}, {{0x0608, 0x060A}, -9850, 2},
+  {{0x8000, 0x0609}, -10200, 2}, {{0x8000, 0x8008}, 4244, 1}, {{0x8008, 0x8005}, -9650, 2}, {{0x8003, 0x060C}, 850, 3},
+  {{0x800E, 0x060D}, 4254, 1}, {{0x8003, 0x800D}, 4264, 1}, {{0x8000, 0x060F}, 750, 3}, {{0x0610, 0x0612}, -9301, 2},
+  {{0x0611, 0x8000}, 4264, 1}, {{0x8018, 0x801D}, -9800, 2}, {{0x8026, 0x0613}, 4244, 1}, {{0x8003, 0x8008}, 4264, 1},
+  {{0x0615, 0x0618}, -9250, 2}, {{0x8000, 0x0616}, 750, 3}, {{0x0617, 0x800C}, 4254, 1}, {{0x8026, 0x8033}, -9750, 2},
+  {{0x803B, 0x8003}, -8750, 2}, {{0x061A, 0x061D}, -9250, 2}, {{0x8000, 0x061B}, -10050, 2}, {{0x8000, 0x061C}, 750, 3},
+  {{0x8004, 0x801D}, -9850, 2}, {{0x061E, 0x8003}, -8401, 2}, {{0x8000, 0x061F}, 4244, 1}, {{0x8003, 0x0620}, 4254, 1},
+  {{0x8003, 0x8020}, -8750, 2}, {{0x0622, 0x0623}, -9500, 2}, {{0x8000, 0x8071}, -10150, 2}, {{0x0624, 0x8003}, 4254, 1},
+  {{0x0625, 0x8003}, -8450, 2}, {{0x8003, 0x800E}, 850, 3}, {{0x0627, 0x0628}, 4244, 1}, {{0x8000, 0x8008}, -9850, 2},
+  {{0x8000, 0x0629}, -9400, 2}, {{0x8003, 0x8072}, 850, 3}, {{0x062B, 0x062D}, -9301, 2}, {{0x8000, 0x062C}, 750, 3},
+  {{0x802F, 0x8009}, 4249, 1}, {{0x062E, 0x8003}, -8401, 2}, {{0x8007, 0x062F}, 4254, 1}, {{0x8003, 0x800D}, -8750, 2},
+  {{0x0631, 0x0633}, -9350, 2}, {{0x8000, 0x0632}, 750, 3}, {{0x8000, 0x8040}, 4254, 1}, {{0x0634, 0x0635}, -8750, 2},
+  {{0x8014, 0x8018}, 4254, 1}, {{0x0636, 0x8003}, 4254, 1}, {{0x8009, 0x8003}, -8250, 2}, {{0x0638, 0x063A}, -9250, 2},
+  {{0x8000, 0x0639}, -10000, 2}, {{0x8015, 0x8004}, 4249, 1}, {{0x8003, 0x063B}, 850, 3}, {{0x063C, 0x8003}, -8650, 2},
+  {{0x8028, 0x800A}, -8850, 2}, {{0x063E, 0x0641}, -9051, 2}, {{0x063F, 0x8000}, 4264, 1}, {{0x8000, 0x0640}, 750, 3},
+  {{0x8014, 0x8044}, -9650, 2}, {{0x0642, 0x8008}, 4264, 1}, {{0x8056, 0x8003}, 4254, 1}, {{0x0644, 0x0645}, 4244, 1},
+  {{0x8000, 0x8019}, 750, 3}, {{0x0646, 0x0647}, 4264, 1}, {{0x8028, 0x8003}, -9800, 2}, {{0x0648, 0x8000}, 4275, 1},
+  {{0x8000, 0x8009}, -10200, 2}, {{0x8000, 0x064A}, 4244, 1}, {{0x064B, 0x064D}, -9301, 2}, {{0x8000, 0x064C}, 750, 3},
+  {{0x8028, 0x8000}, -9750, 2}, {{0x803F, 0x8003}, -8750, 2}, {{0x064F, 0x0651}, -9301, 2}, {{0x8000, 0x0650}, 4249, 1},
+  {{0x8000, 0x8004}, -10050, 2}, {{0x0652, 0x8003}, -8450, 2}, {{0x8000, 0x0653}, 4244, 1}, {{0x8003, 0x0654}, 4254, 1},
+  {{0x8028, 0x8003}, -8650, 2}, {{0x0656, 0x0659}, -9350, 2}, {{0x8000, 0x0657}, -10200, 2}, {{0x0658, 0x803B}, 4254, 1},
+  {{0x8000, 0x8063}, 750, 3}, {{0x065A, 0x8003}, -8450, 2}, {{0x8004, 0x803D}, 4254, 1}, {{0x065C, 0x0660}, -9150, 2},
+  {{0x065D, 0x065F}, 4254, 1}, {{0x8000, 0x065E}, -10000, 2}, {{0x8000, 0x8050}, 750, 3}, {{0x8000, 0x8016}, 750, 3},
+  {{0x0661, 0x8003}, -8450, 2}, {{0x8024, 0x800D}, -8550, 2}, {{0x0663, 0x0667}, -9051, 2}, {{0x8000, 0x0664}, -10200, 2},
+  {{0x0665, 0x0666}, -9650, 2}, {{0x8000, 0x8009}, 750, 3}, {{0x8004, 0x801A}, 850, 3}, {{0x0668, 0x8003}, 4254, 1},
+  {{0x8003, 0x8002}, -8550, 2}, {{0x8000, 0x066A}, 750, 3}, {{0x8000, 0x066B}, 4244, 1}, {{0x8044, 0x066C}, -9301, 2},
+  {{0x066D, 0x8003}, -8650, 2}, {{0x8003, 0x8004}, -8850, 2}, {{0x066F, 0x0672}, 4244, 1}, {{0x8000, 0x0670}, -10000, 2},
+  {{0x8001, 0x0671}, -9750, 2}, {{0x8000, 0x8032}, -9500, 2}, {{0x8000, 0x0673}, 750, 3}, {{0x0674, 0x8003}, -8650, 2},
+  {{0x8008, 0x0675}, -9400, 2}, {{0x8003, 0x800A}, -8850, 2}, {{0x8000, 0x0677}, 750, 3}, {{0x0678, 0x0679}, -9250, 2},
+  {{0x801A, 0x801E}, 4254, 1}, {{0x067A, 0x8003}, -8401, 2}, {{0x8009, 0x067B}, 4254, 1}, {{0x8003, 0x8007}, -8750, 2},
+  {{0x8000, 0x067D}, 750, 3}, {{0x067E, 0x0680}, -9250, 2}, {{0x067F, 0x8000}, 850, 3}, {{0x801D, 0x8004}, 4249, 1},
+  {{0x0681, 0x8003}, 4254, 1}, {{0x8003, 0x8007}, 850, 3}, {{0x0683, 0x0686}, -9250, 2}, {{0x8000, 0x0684}, -10200, 2},
+  {{0x0685, 0x801F}, 4254, 1}, {{0x8000, 0x8005}, -9850, 2}, {{0x0687, 0x0688}, -8750, 2}, {{0x8020, 0x800D}, -8900, 2},
+  {{0x8043, 0x8003}, 4254, 1}, {{0x8000, 0x068A}, 750, 3}, {{0x068B, 0x068D}, -9051, 2}, {{0x800E, 0x068C}, -9750, 2},
+  {{0x8050, 0x8008}, 4244, 1}, {{0x068E, 0x8003}, -8401, 2}, {{0x8003, 0x8040}, 850, 3}, {{0x0690, 0x0693}, 4244, 1},
+  {{0x8000, 0x0691}, -10100, 2}, {{0x8000, 0x0692}, 750, 3}, {{0x8019, 0x8000}, -9351, 2}, {{0x8000, 0x0694}, 750, 3},
+  {{0x0695, 0x8033}, 4264, 1}, {{0x8003, 0x0696}, 4254, 1}, {{0x8002, 0x8003}, 850, 3}, {{0x0698, 0x069C}, -9051, 2},
+  {{0x8000, 0x0699}, -10050, 2}, {{0x8040, 0x069A}, -9750, 2}, {{0x069B, 0x8004}, -9450, 2}, {{0x8000, 0x8026}, 4244, 1},
+  {{0x8003, 0x069D}, 850, 3}, {{0x8014, 0x8003}, 4254, 1}, {{0x069F, 0x06A1}, -9301, 2}, {{0x8000, 0x06A0}, 750, 3},
+  {{0x801A, 0x805C}, 4254, 1}, {{0x8003, 0x06A2}, 850, 3}, {{0x8028, 0x8073}, 4254, 1}, {{0x8000, 0x06A4}, 750, 3},
+  {{0x06A5, 0x06A7}, 850, 3}, {{0x06A6, 0x8003}, -9300, 2}, {{0x8044, 0x800B}, -9850, 2}, {{0x8005, 0x06A8}, -9100, 2},
+  {{0x800A, 0x06A9}, 4254, 1}, {{0x801B, 0x8003}, -8650, 2}, {{0x8000, 0x06AB}, 750, 3}, {{0x06AC, 0x06AD}, 4244, 1},
+  {{0x8040, 0x8000}, 850, 3}, {{0x06AE, 0x06AF}, 850, 3}, {{0x8003, 0x800F}, 4254, 1}, {{0x06B0, 0x8003}, -8600, 2},
+  {{0x8024, 0x8026}, 4264, 1}, {{0x06B2, 0x06B4}, 4244, 1}, {{0x8000, 0x06B3}, 750, 3}, {{0x8012, 0x801A}, -9750, 2},
+  {{0x8000, 0x06B5}, 750, 3}, {{0x803A, 0x06B6}, -9301, 2}, {{0x8003, 0x8007}, 4264, 1}, {{0x06B8, 0x06BB}, -9051, 2},
+  {{0x8000, 0x06B9}, 750, 3}, {{0x8019, 0x06BA}, -9650, 2}, {{0x8005, 0x8032}, 850, 3}, {{0x06BC, 0x8003}, -8401, 2},
+  {{0x8003, 0x06BD}, 850, 3}, {{0x801D, 0x8020}, 4254, 1}, {{0x06BF, 0x06C1}, -9450, 2}, {{0x8006, 0x06C0}, 4235, 1},
+  {{0x8000, 0x801D}, 750, 3}, {{0x06C2, 0x8008}, 4264, 1}, {{0x8003, 0x06C3}, 850, 3}, {{0x06C4, 0x8003}, -8351, 2},
+  {{0x8000, 0x8003}, 4244, 1}, {{0x06C6, 0x06C8}, 4244, 1}, {{0x8000, 0x06C7}, 750, 3}, {{0x800D, 0x8000}, 850, 3},
+  {{0x8000, 0x06C9}, -10200, 2}, {{0x06CA, 0x06CB}, 850, 3}, {{0x8007, 0x8003}, -9300, 2}, {{0x8074, 0x8003}, -8600, 2},
+  {{0x8000, 0x06CD}, 750, 3}, {{0x06CE, 0x06D0}, 850, 3}, {{0x06CF, 0x8003}, -9400, 2}, {{0x8001, 0x8044}, -9750, 2},
+  {{0x800A, 0x06D1}, 4254, 1}, {{0x8003, 0x8018}, 4264, 1}, {{0x06D3, 0x06D6}, -9250, 2}, {{0x8000, 0x06D4}, 750, 3},
+  {{0x800D, 0x06D5}, -9850, 2}, {{0x8019, 0x8013}, 4244, 1}, {{0x06D7, 0x800C}, 4264, 1}, {{0x06D8, 0x8003}, 4254, 1},
+  {{0x8003, 0x8002}, 850, 3}, {{0x06DA, 0x06DB}, 4244, 1}, {{0x8000, 0x8005}, 750, 3}, {{0x8000, 0x06DC}, 750, 3},
+  {{0x06DD, 0x801E}, 4264, 1}, {{0x06DE, 0x8003}, 4254, 1}, {{0x8020, 0x8003}, -8850, 2}, {{0x06E0, 0x06E3}, -9450, 2},
+  {{0x06E1, 0x06E2}, -9850, 2}, {{0x8000, 0x8005}, 750, 3}, {{0x8004, 0x8033}, -9650, 2}, {{0x8019, 0x06E4}, 4244, 1},
+  {{0x8003, 0x06E5}, 4254, 1}, {{0x8007, 0x8003}, -8650, 2}, {{0x06E7, 0x06E8}, 4244, 1}, {{0x8000, 0x8026}, -9550, 2},
+  {{0x8000, 0x06E9}, 750, 3}, {{0x06EA, 0x8026}, 4264, 1}, {{0x800F, 0x8003}, -9400, 2}, {{0x06EC, 0x06F1}, -9051, 2},
+  {{0x06ED, 0x06EE}, -10050, 2}, {{0x8000, 0x8033}, 650, 3}, {{0x06EF, 0x06F0}, 4244, 1}, {{0x8032, 0x8005}, 4235, 1},
+  {{0x8014, 0x8032}, 850, 3}, {{0x8003, 0x06F2}, 850, 3}, {{0x8020, 0x06F3}, 4254, 1}, {{0x800D, 0x8003}, -8650, 2},
+  {{0x8000, 0x06F5}, 750, 3}, {{0x06F6, 0x06F8}, 4244, 1}, {{0x801A, 0x06F7}, 4235, 1}, {{0x8005, 0x8005}, -9650, 2},
+  {{0x06F9, 0x8019}, 4264, 1}, {{0x800E, 0x8003}, -9400, 2}, {{0x8000, 0x06FB}, 750, 3}, {{0x06FC, 0x06FE}, -9250, 2},
+  {{0x8017, 0x06FD}, -9750, 2}, {{0x8014, 0x8000}, 850, 3}, {{0x06FF, 0x8003}, -8351, 2}, {{0x8075, 0x0700}, 4254, 1},
+  {{0x8009, 0x8009}, -8750, 2}, {{0x0702, 0x0704}, -9301, 2}, {{0x8000, 0x0703}, 750, 3}, {{0x8033, 0x800A}, 4254, 1},
+  {{0x0705, 0x0706}, 4254, 1}, {{0x8003, 0x8075}, 850, 3}, {{0x8003, 0x0707}, 850, 3}, {{0x801B, 0x8003}, -8750, 2},
+  {{0x0709, 0x070C}, -9250, 2}, {{0x8000, 0x070A}, 750, 3}, {{0x070B, 0x8009}, 4254, 1}, {{0x8008, 0x8000}, -9701, 2},
+  {{0x070D, 0x8003}, -8450, 2}, {{0x8009, 0x8028}, 4254, 1}, {{0x070F, 0x0711}, -9250, 2}, {{0x8000, 0x0710}, 750, 3},
+  {{0x8029, 0x8000}, -9750, 2}, {{0x8003, 0x0712}, 850, 3}, {{0x803A, 0x804A}, 4254, 1}, {{0x0714, 0x0716}, -9301, 2},
+  {{0x8000, 0x0715}, -10050, 2}, {{0x8019, 0x8076}, -9650, 2}, {{0x0717, 0x8003}, -8401, 2}, {{0x8000, 0x0718}, 4244, 1},
+  {{0x8003, 0x803F}, -8750, 2}, {{0x071A, 0x071E}, -9051, 2}, {{0x8000, 0x071B}, 750, 3}, {{0x071C, 0x071D}, 4244, 1},
+  {{0x8004, 0x8000}, -9750, 2}, {{0x801B, 0x800D}, -9701, 2}, {{0x8018, 0x071F}, -8650, 2}, {{0x803F, 0x8003}, -8450, 2},
+  {{0x0721, 0x0723}, -9400, 2}, {{0x8000, 0x0722}, 750, 3}, {{0x8013, 0x801D}, -9850, 2}, {{0x0724, 0x8003}, -8401, 2},
+  {{0x8004, 0x0725}, 4254, 1}, {{0x8003, 0x800E}, 4264, 1}, {{0x8000, 0x0727}, 750, 3}, {{0x0728, 0x072A}, -9051, 2},
+  {{0x0729, 0x801A}, 850, 3}, {{0x8019, 0x8040}, 4244, 1}, {{0x072B, 0x8003}, -8450, 2}, {{0x8003, 0x072C}, -8850, 2},
+  {{0x8006, 0x8014}, 4254, 1}, {{0x072E, 0x0730}, 4244, 1}, {{0x8000, 0x072F}, -9850, 2}, {{0x800E, 0x8000}, 850, 3},
+  {{0x8000, 0x0731}, 750, 3}, {{0x0732, 0x8003}, -8650, 2}, {{0x0733, 0x800A}, -8850, 2}, {{0x805F, 0x801F}, 850, 3},
+  {{0x8000, 0x0735}, 750, 3}, {{0x0736, 0x0737}, 4244, 1}, {{0x8025, 0x8012}, -9500, 2}, {{0x0738, 0x8006}, 4264, 1},
+  {{0x0739, 0x8003}, 850, 3}, {{0x8007, 0x8003}, -8650, 2}, {{0x073B, 0x073D}, 4244, 1}, {{0x8000, 0x073C}, 750, 3},
+  {{0x8006, 0x801D}, 4235, 1}, {{0x8000, 0x073E}, -10000, 2}, {{0x073F, 0x8003}, -8650, 2}, {{0x802E, 0x800F}, 850, 3},
+  {{0x0741, 0x0744}, -9051, 2}, {{0x8000, 0x0742}, 750, 3}, {{0x0743, 0x8025}, 850, 3}, {{0x8007, 0x802B}, -9750, 2},
+  {{0x0745, 0x8009}, 4264, 1}, {{0x8003, 0x0746}, 850, 3}, {{0x803B, 0x8003}, 4254, 1}, {{0x0748, 0x074B}, 4244, 1},
+  {{0x8000, 0x0749}, -10000, 2}, {{0x8032, 0x074A}, 4235, 1}, {{0x8015, 0x8008}, -9650, 2}, {{0x8000, 0x074C}, 750, 3},
+  {{0x074D, 0x8005}, 4264, 1}, {{0x8004, 0x8003}, -9100, 2}, {{0x074F, 0x0752}, -9250, 2}, {{0x8000, 0x0750}, -10050, 2},
+  {{0x0751, 0x8008}, 4249, 1}, {{0x8013, 0x8026}, 4235, 1}, {{0x8000, 0x0753}, 4244, 1}, {{0x0754, 0x8003}, -8650, 2},
+  {{0x8003, 0x803D}, -8850, 2}, {{0x0756, 0x0759}, -9450, 2}, {{0x8000, 0x0757}, 750, 3}, {{0x0758, 0x8015}, -9650, 2},
+  {{0x8004, 0x8012}, -9850, 2}, {{0x8012, 0x075A}, 4244, 1}, {{0x8043, 0x8003}, -8650, 2}, {{0x8000, 0x075C}, 750, 3},
+  {{0x075D, 0x075E}, 4244, 1}, {{0x8008, 0x8000}, 850, 3}, {{0x075F, 0x8000}, 4275, 1}, {{0x8018, 0x8003}, -9400, 2}
+};
+
+const int32_t LTForestLeafFixed[119 * LTForestClasses] =
+{
+  2097152, 0, 1334551, 762601, 349525, 1747627, 0, 2097152,
+  1048576, 1048576, 1398101, 699051, 1497966, 599186, 419430, 1677722,
+  1258291, 838861, 524288, 1572864, 932068, 1165084, 1165084, 932068,
+  786432, 1310720, 699051, 1398101, 838861, 1258291, 571951, 1525201,
+  153450, 1943702, 559241, 1537911, 898779, 1198373, 1310720, 786432,
+  466034, 1631118, 1747627, 349525, 449390, 1647762, 1525201, 571951,
+  599186, 1497966, 1198373, 898779, 1864135, 233017, 233017, 1864135,
+  1906502, 190650, 1572864, 524288, 1143901, 953251, 629146, 1468006,
+  299593, 1797559, 370086, 1727066, 1872457, 224695, 1947355, 149797,
+  190650, 1906502, 1887437, 209715, 1677722, 419430, 1537911, 559241,
+  262144, 1835008, 1774513, 322639, 616809, 1480343, 953251, 1143901,
+  582542, 1514610, 1703936, 393216, 161319, 1935833, 1631118, 466034,
+  1129236, 967916, 65536, 2031616, 1797559, 299593, 1835008, 262144,
+  1957342, 139810, 139810, 1957342, 1223339, 873813, 441506, 1655646,
+  806597, 1290555, 220753, 1876399, 762601, 1334551, 381300, 1715852,
+  279620, 1817532, 174763, 1922389, 110376, 1986776, 209715, 1887437,
+  873813, 1223339, 322639, 1774513, 1451874, 645278, 131072, 1966080,
+  1468006, 629146, 331129, 1766023, 748983, 1348169, 1367708, 729444,
+  978671, 1118481, 314573, 1782579, 123362, 1973790, 1348169, 748983,
+  83886, 2013266, 1426063, 671089, 551882, 1545270, 340079, 1757073,
+  1922389, 174763, 476625, 1620527, 1290555, 806597, 167772, 1929380,
+  241979, 1855173, 1118481, 978671, 116508, 1980644, 655360, 1441792,
+  506209, 1590943, 740171, 1356981, 149797, 1947355, 77672, 2019480,
+  967916, 1129236, 493448, 1603704, 1434893, 662259, 246724, 1850428,
+  1613194, 483958, 393216, 1703936, 917504, 1179648, 1935833, 161319,
+  1715852, 381300, 734003, 1363149, 508400, 1588752, 1697694, 399458,
+  1441792, 655360, 578525, 1518627, 310689, 1786463, 1281593, 815559,
+  754975, 1342177, 1298237, 798915, 555128, 1542024, 986895, 1110257,
+  1817532, 279620, 1708791, 388361, 87381, 2009771, 72316, 2024836,
+  499322, 1597830, 645278, 1451874, 1966080, 131072
+};
+
+const double LTForestLeafProba[119 * LTForestClasses] =
+{
+  1.0, 0.0, 0.6363636363636364, 0.36363636363636365, 0.16666666666666666, 0.8333333333333334,
+  0.0, 1.0, 0.5, 0.5, 0.6666666666666666, 0.3333333333333333,
+  0.7142857142857143, 0.2857142857142857, 0.2, 0.8, 0.6, 0.4,
+  0.25, 0.75, 0.4444444444444444, 0.5555555555555556, 0.5555555555555556, 0.4444444444444444,
+  0.375, 0.625, 0.3333333333333333, 0.6666666666666666, 0.4, 0.6,
+  0.2727272727272727, 0.7272727272727273, 0.07317073170731707, 0.926829268292683, 0.26666666666666666, 0.7333333333333333,
+  0.42857142857142855, 0.5714285714285714, 0.625, 0.375, 0.2222222222222222, 0.7777777777777778,
+  0.8333333333333334, 0.16666666666666666, 0.21428571428571427, 0.7857142857142857, 0.7272727272727273, 0.2727272727272727,
+  0.2857142857142857, 0.7142857142857143, 0.5714285714285714, 0.42857142857142855, 0.8888888888888888, 0.1111111111111111,
+  0.1111111111111111, 0.8888888888888888, 0.9090909090909091, 0.09090909090909091, 0.75, 0.25,
+  0.5454545454545454, 0.45454545454545453, 0.3, 0.7, 0.14285714285714285, 0.8571428571428571,
+  0.17647058823529413, 0.8235294117647058, 0.8928571428571429, 0.10714285714285714, 0.9285714285714286, 0.07142857142857142,
+  0.09090909090909091, 0.9090909090909091, 0.9, 0.1, 0.8, 0.2,
+  0.7333333333333333, 0.26666666666666666, 0.125, 0.875, 0.8461538461538461, 0.15384615384615385,
+  0.29411764705882354, 0.7058823529411765, 0.45454545454545453, 0.5454545454545454, 0.2777777777777778, 0.7222222222222222,
+  0.8125, 0.1875, 0.07692307692307693, 0.9230769230769231, 0.7777777777777778, 0.2222222222222222,
+  0.5384615384615384, 0.46153846153846156, 0.03125, 0.96875, 0.8571428571428571, 0.14285714285714285,
+  0.875, 0.125, 0.9333333333333333, 0.06666666666666667, 0.06666666666666667, 0.9333333333333333,
+  0.5833333333333334, 0.4166666666666667, 0.21052631578947367, 0.7894736842105263, 0.38461538461538464, 0.6153846153846154,
+  0.10526315789473684, 0.8947368421052632, 0.36363636363636365, 0.6363636363636364, 0.18181818181818182, 0.8181818181818182,
+  0.13333333333333333, 0.8666666666666667, 0.08333333333333333, 0.9166666666666666, 0.05263157894736842, 0.9473684210526315,
+  0.1, 0.9, 0.4166666666666667, 0.5833333333333334, 0.15384615384615385, 0.8461538461538461,
+  0.6923076923076923, 0.3076923076923077, 0.0625, 0.9375, 0.7, 0.3,
+  0.15789473684210525, 0.8421052631578947, 0.35714285714285715, 0.6428571428571429, 0.6521739130434783, 0.34782608695652173,
+  0.4666666666666667, 0.5333333333333333, 0.15, 0.85, 0.058823529411764705, 0.9411764705882353,
+  0.6428571428571429, 0.35714285714285715, 0.04, 0.96, 0.68, 0.32,
+  0.2631578947368421, 0.7368421052631579, 0.16216216216216217, 0.8378378378378378, 0.9166666666666666, 0.08333333333333333,
+  0.22727272727272727, 0.7727272727272727, 0.6153846153846154, 0.38461538461538464, 0.08, 0.92,
+  0.11538461538461539, 0.8846153846153846, 0.5333333333333333, 0.4666666666666667, 0.05555555555555555, 0.9444444444444444,
+  0.3125, 0.6875, 0.2413793103448276, 0.7586206896551724, 0.35294117647058826, 0.6470588235294118,
+  0.07142857142857142, 0.9285714285714286, 0.037037037037037035, 0.9629629629629629, 0.46153846153846156, 0.5384615384615384,
+  0.23529411764705882, 0.7647058823529411, 0.6842105263157895, 0.3157894736842105, 0.11764705882352941, 0.8823529411764706,
+  0.7692307692307693, 0.23076923076923078, 0.1875, 0.8125, 0.4375, 0.5625,
+  0.9230769230769231, 0.07692307692307693, 0.8181818181818182, 0.18181818181818182, 0.35, 0.65,
+  0.24242424242424243, 0.7575757575757576, 0.8095238095238095, 0.19047619047619047, 0.6875, 0.3125,
+  0.27586206896551724, 0.7241379310344828, 0.14814814814814814, 0.8518518518518519, 0.6111111111111112, 0.3888888888888889,
+  0.36, 0.64, 0.6190476190476191, 0.38095238095238093, 0.2647058823529412, 0.7352941176470589,
+  0.47058823529411764, 0.5294117647058824, 0.8666666666666667, 0.13333333333333333, 0.8148148148148148, 0.18518518518518517,
+  0.041666666666666664, 0.9583333333333334, 0.034482758620689655, 0.9655172413793104, 0.23809523809523808, 0.7619047619047619,
+  0.3076923076923077, 0.6923076923076923, 0.9375, 0.0625
+};
+
+const LTForestModel LTForestSIESPRO =
+{
+  LTForestTrees, LTForestInputs, LTForestClasses,
+  21, 301,                                  //fixed point bits, one unit per tree of margin
+  LTForestNodes, LTForestRoots, LTForestLeafFixed, LTForestLeafProba, LTForestLabels
+};
+
+static_assert(LTForestSchema == LTSchemaModel, "LTForestModel.h out of step with features.json");
+
+#endif
+
+/*
+  MIT license
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+  associated documentation files (the "Software"), to deal in the Software without restriction, including
+  without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the
+  following conditions:
+
+  The above copyright notice and this permission notice shall be included in all copies or substantial
+  portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+  LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO
+  EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+  IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE
+  USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
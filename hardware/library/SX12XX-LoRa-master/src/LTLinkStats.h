@@ -0,0 +1,301 @@
+/*
+  Licensed under a MIT license displayed at the bottom of this document.
+  Original published 16/10/26, rolling link statistics per node
+*/
+
+/*
+  Rolling statistics of the RSSI and SNR of the exchanges with one node, and of the packets it did not
+  acknowledge. A single RSSI or SNR jumps by 10dB or more from one packet to the next, so a hub that
+  classifies where a wristband is gets steadier features from the last few exchanges than from the
+  last one alone. The master feeds each exchange into the LTLinkStats of its node with addPoll();
+
+  EWMA        - exponentially weighted moving average, each exchange counts 1 / 2^LTLinkStatsEWMAShift
+  Median      - of the last LTLinkStatsWindow exchanges acknowledged, the mean of the middle two for an
+                even count
+  Deviation   - standard deviation over the same window
+  Min, max    - over the same window
+  Loss        - packets sent without an ACK over the last LTLinkStatsWindow polls, in percent of the
+                packets sent, counting each attempt of the TXattempts loop
+
+  Nothing is allocated and each addPoll() is a few dozen operations. The window is kept twice, in the
+  order received and sorted, so the median, min and max are read straight off the sorted copy and a new
+  value is only moved into place. The sums kept for the mean and deviation are updated the same way.
+  The averages, median and deviation are in tenths of a dB. RSSI is kept as an int8_t, as in LTADR,
+  values below -128dBm count as -128dBm. An LTLinkStats takes 76 bytes.
+
+  LTLinkStats nodeStats[256];
+  nodeStats[slot].addPoll(acked, attempts, rssi, snr);
+  nodeStats[slot].getRSSI(summary);
+*/
+
+#ifndef LTLinkStats_h
+#define LTLinkStats_h
+
+#include <Arduino.h>
+
+#ifndef LTLinkStatsWindow
+#define LTLinkStatsWindow 8                   //exchanges in the window, median, deviation, min, max and loss
+#endif
+#ifndef LTLinkStatsEWMAShift
+#define LTLinkStatsEWMAShift 2                //each exchange counts a quarter in the EWMA
+#endif
+
+
+struct LTLinkSummary
+{
+  int16_t ewma;                               //tenths of a dB
+  int16_t median;                             //tenths of a dB
+  uint16_t deviation;                         //tenths of a dB
+  int8_t min;                                 //dB
+  int8_t max;                                 //dB
+};
+
+
+class LTLinkWindow
+{
+  public:
+
+    LTLinkWindow()
+    {
+      clear();
+    }
+
+    void clear()
+    {
+      _count = 0;
+      _next = 0;
+      _total = 0;
+      _squares = 0;
+      _ewma = 0;
+    }
+
+    void add(int16_t value)
+    {
+      int8_t in = (int8_t) constrain(value, -128, 127);
+      uint8_t index;
+
+      if (_count == 0)
+      {
+        _ewma = in * 16;
+      }
+      else
+      {
+        _ewma += ((in * 16) - _ewma) / (1 << LTLinkStatsEWMAShift);
+      }
+
+      if (_count == LTLinkStatsWindow)
+      {
+        remove(_values[_next]);
+      }
+
+      //insert into the sorted copy, moving the larger values up one
+
+      for (index = _count; (index > 0) && (_sorted[index - 1] > in); index--)
+      {
+        _sorted[index] = _sorted[index - 1];
+      }
+
+      _sorted[index] = in;
+      _values[_next] = in;
+      _next = (_next + 1) % LTLinkStatsWindow;
+      _total += in;
+      _squares += in * in;
+      _count++;
+    }
+
+    uint8_t getCount()
+    {
+      return _count;
+    }
+
+    void getSummary(LTLinkSummary &summary)
+    {
+      uint32_t spread;
+
+      if (_count == 0)
+      {
+        summary = {0, 0, 0, 0, 0};
+        return;
+      }
+
+      //variance * count^2 = count * squares - total^2, in tenths of a dB squared times 100
+
+      spread = ((uint32_t) _count * _squares) - (uint32_t) (_total * _total);
+
+      summary.ewma = (int16_t) ((_ewma * 10) / 16);
+      summary.median = (int16_t) ((_sorted[(_count - 1) / 2] + _sorted[_count / 2]) * 5);
+      summary.deviation = (uint16_t) (squareRoot(spread * 100) / _count);
+      summary.min = _sorted[0];
+      summary.max = _sorted[_count - 1];
+    }
+
+  private:
+
+    void remove(int8_t out)
+    {
+      //the oldest value leaves the window, moving the larger values down one
+
+      uint8_t index = 0;
+
+      while ((index < _count) && (_sorted[index] != out))
+      {
+        index++;
+      }
+
+      for (; index < (_count - 1); index++)
+      {
+        _sorted[index] = _sorted[index + 1];
+      }
+
+      _total -= out;
+      _squares -= out * out;
+      _count--;
+    }
+
+    static uint32_t squareRoot(uint32_t value)
+    {
+      //integer square root, rounded down
+
+      uint32_t root = 0, bit = 1UL << 30;
+
+      while (bit > value)
+      {
+        bit >>= 2;
+      }
+
+      while (bit != 0)
+      {
+        if (value >= (root + bit))
+        {
+          value -= root + bit;
+          root = (root >> 1) + bit;
+        }
+        else
+        {
+          root >>= 1;
+        }
+
+        bit >>= 2;
+      }
+
+      return root;
+    }
+
+    int8_t _values[LTLinkStatsWindow];        //in the order received
+    int8_t _sorted[LTLinkStatsWindow];        //the same, smallest first
+    uint8_t _count, _next;
+    int16_t _total;
+    int32_t _squares;
+    int16_t _ewma;                            //sixteenths of a dB
+};
+
+
+class LTLinkStats
+{
+  public:
+
+    LTLinkStats()
+    {
+      clear();
+    }
+
+    void clear()
+    {
+      _RSSI.clear();
+      _SNR.clear();
+      _polls = 0;
+      _next = 0;
+      _sent = 0;
+      _acked = 0;
+      _ackedBits = 0;
+    }
+
+    void addPoll(bool acked, uint8_t attempts, int16_t rssi = 0, int8_t snr = 0)
+    {
+      //result of a poll, attempts is the packets sent for it, rssi and snr are of the ACK
+
+      if (attempts == 0)
+      {
+        return;
+      }
+
+      if (_polls == LTLinkStatsWindow)
+      {
+        _sent -= _attempts[_next];
+        _acked -= (_ackedBits >> _next) & 1;
+        _polls--;
+      }
+
+      _attempts[_next] = attempts;
+      _ackedBits = (_ackedBits & ~(1UL << _next)) | ((acked ? 1UL : 0) << _next);
+      _sent += attempts;
+      _acked += acked;
+      _polls++;
+      _next = (_next + 1) % LTLinkStatsWindow;
+
+      if (acked)
+      {
+        _RSSI.add(rssi);
+        _SNR.add(snr);
+      }
+    }
+
+    uint8_t getSamples()
+    {
+      //ACKs in the RSSI and SNR window
+      return _RSSI.getCount();
+    }
+
+    void getRSSI(LTLinkSummary &summary)
+    {
+      _RSSI.getSummary(summary);
+    }
+
+    void getSNR(LTLinkSummary &summary)
+    {
+      _SNR.getSummary(summary);
+    }
+
+    uint8_t getLossPercent()
+    {
+      //packets sent without an ACK over the last polls, each poll that got one had one packet acknowledged
+
+      if (_sent == 0)
+      {
+        return 0;
+      }
+
+      return (uint8_t) ((((uint16_t) (_sent - _acked)) * 100) / _sent);
+    }
+
+  private:
+
+    LTLinkWindow _RSSI, _SNR;
+    uint8_t _attempts[LTLinkStatsWindow];     //packets sent for each poll in the window
+    uint32_t _ackedBits;                      //bit per poll, set if it was acknowledged
+    uint8_t _polls, _next;
+    uint16_t _sent, _acked;
+};
+
+static_assert(LTLinkStatsWindow <= 32, "LTLinkStatsWindow is limited by the bits of _ackedBits");
+
+#endif
+
+/*
+  MIT license
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+  associated documentation files (the "Software"), to deal in the Software without restriction, including
+  without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the
+  following conditions:
+
+  The above copyright notice and this permission notice shall be included in all copies or substantial
+  portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+  LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO
+  EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+  IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE
+  USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
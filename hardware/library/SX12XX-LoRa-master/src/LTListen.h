@@ -0,0 +1,198 @@
+/*
+  Licensed under a MIT license displayed at the bottom of this document.
+  Original published 16/10/26, duty cycled listening with CAD
+*/
+
+/*
+  Duty cycled receive for a node that only has to answer now and then, such as a wristband slave. Rather
+  than stay in RX the node puts the LoRa device and itself to sleep and wakes once every period to run a
+  CAD with doCAD(). Only when the CAD finds a preamble does it go into RX. The master sends its reliable
+  packets with a preamble longer than the period, set with setReliablePreamble() to getPreamble(), so
+  whenever a packet starts the next CAD falls in its preamble with enough of it left for the receiver to
+  lock on.
+
+  One cycle of the slave;
+
+  LT.setSleep(CONFIGURATION_RETENTION);  sleep the processor until the next period
+  LT.wake();
+  if (LT.doCAD()) LT.receiveReliableAutoACK(..., Listen.getRXTimeout(), WAIT_RX);
+
+  The receive timeout only has to cover the rest of the preamble, the driver does not time out a packet
+  that is being received.
+
+  LTListen also models the average current and the latency for a period, to choose one. The currents are
+  in LTListenCurrents, the defaults are an ESP32-C3 in light sleep and running, and the SX1278 standby, RX
+  and +2dBm TX currents, from the datasheets. The model counts per cycle the sleep, the wake up with the
+  processor running and the device in standby, the CAD at RX current and the 1mS setSleep() waits. A
+  packet adds the rest of its preamble and the packet in RX, the ACK delay in standby and the ACK in TX.
+  Packets arrive at random, so on average the CAD finds them half a period into the preamble.
+
+  The spreading factor and bandwidth come in as the symbol time, LTADR::getSymbolTimeuS() or
+  1000 * calcSymbolTime(), set it again with setSymbolTime() when the rate changes.
+*/
+
+#ifndef LTListen_h
+#define LTListen_h
+
+#include <Arduino.h>
+
+#define LTListenCADSymbols 2                  //length of a CAD
+#define LTListenLockSymbols 6                 //preamble left after the CAD for the receiver to lock on
+#define LTListenShortPreamble 8               //preamble of the setupLoRa() settings
+
+#define LTListenSleepuS 1000                  //setSleep() waits 1mS for the device to shut down
+
+#ifndef LTListenWakeuS
+#define LTListenWakeuS 1000                   //processor out of light sleep and device to standby
+#endif
+
+
+struct LTListenCurrents
+{
+  uint32_t sleepuA;                           //processor in light sleep, device in sleep
+  uint32_t processoruA;                       //processor running
+  uint32_t standbyuA;                         //device in standby
+  uint32_t rxuA;                              //device in RX or CAD
+  uint32_t txuA;                              //device sending the ACK
+};
+
+
+class LTListen
+{
+  public:
+
+    LTListen()
+    {
+      begin(1000, 1024);
+    }
+
+    void begin(uint32_t periodmS, uint32_t symboluS, uint32_t wakeuS = LTListenWakeuS)
+    {
+      _periodmS = periodmS;
+      _symboluS = symboluS;
+      _wakeuS = wakeuS;
+      _currents.sleepuA = 130;
+      _currents.processoruA = 22000;
+      _currents.standbyuA = 1600;
+      _currents.rxuA = 11500;
+      _currents.txuA = 29000;
+    }
+
+    void setSymbolTime(uint32_t symboluS)
+    {
+      _symboluS = symboluS;
+    }
+
+    void setCurrents(const LTListenCurrents &currents)
+    {
+      _currents = currents;
+    }
+
+    uint32_t getPeriod()
+    {
+      return _periodmS;
+    }
+
+    uint16_t getPreamble()
+    {
+      //symbols of preamble for the master, the period and the wake up time rounded up, then the CAD and
+      //the symbols to lock on
+      uint32_t symbols = ((_periodmS * 1000) + _wakeuS + _symboluS - 1) / _symboluS;
+
+      symbols = symbols + LTListenCADSymbols + LTListenLockSymbols;
+      return (symbols > 0xFFFF) ? 0xFFFF : (uint16_t) symbols;
+    }
+
+    uint32_t getRXTimeout()
+    {
+      //mS to wait for the header once the CAD has found a preamble, all of the preamble and the header
+      return ((((uint32_t) getPreamble() + 8) * _symboluS) / 1000) + 1;
+    }
+
+    uint32_t getCycleuS()
+    {
+      //time awake each period when there is no packet
+      return _wakeuS + LTListenSleepuS + (LTListenCADSymbols * _symboluS);
+    }
+
+    uint32_t getWakeLatencymS()
+    {
+      //longest time from the start of a packet to the slave being in RX
+      return ((_periodmS * 1000) + getCycleuS() + 999) / 1000;
+    }
+
+    uint32_t getAddedLatencymS()
+    {
+      //every packet takes this much longer to arrive, the preamble over the setupLoRa() preamble
+      return (((uint32_t) (getPreamble() - LTListenShortPreamble) * _symboluS) + 999) / 1000;
+    }
+
+    float getIdleuA()
+    {
+      //average current with no packets
+      float perioduS = (float) _periodmS * 1000;
+      float caduS = (float) LTListenCADSymbols * _symboluS;
+      float charge;
+
+      charge = (float) _currents.sleepuA * (perioduS - getCycleuS());
+      charge += (float) (_currents.processoruA + _currents.standbyuA) * _wakeuS;
+      charge += (float) _currents.processoruA * LTListenSleepuS;
+      charge += (float) (_currents.processoruA + _currents.rxuA) * caduS;
+      return charge / perioduS;
+    }
+
+    float getPacketuC(uint32_t payloaduS, uint32_t ackdelaymS, uint32_t ackuS)
+    {
+      //charge of receiving a packet and sending its ACK, over the sleep it replaces. payloaduS is the
+      //airtime of the packet after the preamble, ackuS the airtime of the ACK
+      float rxuS = ((float) getPreamble() * _symboluS) - ((float) _periodmS * 500) - ((float) LTListenCADSymbols * _symboluS);
+      float delayuS = (float) ackdelaymS * 1000;
+      float charge;
+
+      rxuS = rxuS + payloaduS;
+      charge = (float) (_currents.processoruA + _currents.rxuA) * rxuS;
+      charge += (float) (_currents.processoruA + _currents.standbyuA) * delayuS;
+      charge += (float) (_currents.processoruA + _currents.txuA) * ackuS;
+      charge -= (float) _currents.sleepuA * (rxuS + delayuS + ackuS);
+      return charge / 1000000;
+    }
+
+    float getAverageuA(float packetsperhour, uint32_t payloaduS, uint32_t ackdelaymS, uint32_t ackuS)
+    {
+      return getIdleuA() + ((packetsperhour * getPacketuC(payloaduS, ackdelaymS, ackuS)) / 3600);
+    }
+
+    float getContinuousuA()
+    {
+      //average current staying in RX with the processor running, as without LTListen
+      return (float) (_currents.processoruA + _currents.rxuA);
+    }
+
+  private:
+
+    uint32_t _periodmS;
+    uint32_t _symboluS;
+    uint32_t _wakeuS;
+    LTListenCurrents _currents;
+};
+
+#endif
+
+/*
+  MIT license
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+  associated documentation files (the "Software"), to deal in the Software without restriction, including
+  without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the
+  following conditions:
+
+  The above copyright notice and this permission notice shall be included in all copies or substantial
+  portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+  LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO
+  EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+  IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE
+  USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
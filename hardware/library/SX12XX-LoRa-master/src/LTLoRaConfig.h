@@ -0,0 +1,205 @@
+/*
+  Licensed under a MIT license displayed at the bottom of this document.
+  Original published 16/10/26, LoRa configuration worked out at compile time
+*/
+
+/*
+  The register values setupLoRa() leaves in an SX127X and the command parameters it sends to an SX126X,
+  worked out by the compiler from settings fixed in the sketch. setupLoRa() works them out at run time,
+  the frequency with a 64 bit division on the SX127X and in double on the SX126X, the low data rate
+  optimisation from the symbol time in float, and the SX127X modem registers read, masked and written
+  back. applyConfig() of the driver writes the values as they are, in bursts of consecutive registers
+  on the SX127X, so the device ends up as after setupLoRa() with fewer SPI transactions and without the
+  float and 64 bit arithmetic linked in, if setupLoRa() and setModulationParams() are not used elsewhere.
+
+  As in LTAirtime.h the settings are plain numbers, so they do not depend on the constants of one driver;
+
+  frequency     Hz, the offset is added as in setupLoRa()
+  sf            spreading factor, 6 to 12 for the SX127X, 5 to 12 for the SX126X
+  bandwidth     Hz, 7800, 10400, 15600, 20800, 31250, 41700, 62500, 125000, 250000 or 500000
+  cr            coding rate denominator, 5 to 8 for 4/5 to 4/8
+  ldro          low data rate optimisation, 0 off, 1 on, 2 on when a symbol is longer than 16mS as
+                LDRO_AUTO of the drivers
+
+  The rest is as setupLoRa() sets it, preamble of 8 symbols, variable length packets of up to 255 bytes,
+  CRC on, IQ normal, the private sync word and maximum LNA gain. The bits of the SX127X modem registers
+  that setupLoRa() keeps are as after a reset, AGC on in REG_MODEMCONFIG3 for one.
+
+  The LTLoRaConfig template checks the settings with static_assert and holds both images, an SF5
+  configuration is rejected where its SX127X image is used;
+
+  typedef LTLoRaConfig<434000000, 7, 125000, 5> RadioConfig;
+  LT.applyConfig(RadioConfig::SX127X);
+*/
+
+#ifndef LTLoRaConfig_h
+#define LTLoRaConfig_h
+
+#include <Arduino.h>
+
+#define LTLoRaConfigBadBandwidth 0xFF         //bandwidth code of a bandwidth the devices do not have
+
+
+struct LTSX127XConfig
+{
+  uint32_t frequency;                         //as passed to setupLoRa(), for the driver
+  int32_t offset;
+  uint8_t frf[3];                             //REG_FRMSB to REG_FRLSB
+  uint8_t lna;                                //REG_LNA
+  uint8_t fifoBase[2];                        //REG_FIFOTXBASEADDR and REG_FIFORXBASEADDR
+  uint8_t modem[2];                           //REG_MODEMCONFIG1 and REG_MODEMCONFIG2, SX1276/77/78/79 layout
+  uint8_t packet[3];                          //REG_PREAMBLEMSB, REG_PREAMBLELSB and REG_PAYLOADLENGTH
+  uint8_t modem3;                             //REG_MODEMCONFIG3
+  uint8_t detectOptimize;                     //REG_DETECTOPTIMIZE
+  uint8_t invertIQ;                           //REG_INVERTIQ
+  uint8_t highBW[2];                          //REG_HIGHBWOPTIMIZE1 and REG_DETECTIONTHRESHOLD
+  uint8_t syncWord;                           //REG_SYNCWORD
+  uint8_t invertIQ2;                          //REG_INVERTIQ2, written after the image calibration
+  uint8_t highBW2;                            //REG_HIGHBWOPTIMIZE2, only written for 500kHz, 0 otherwise
+};
+
+
+struct LTSX126XConfig
+{
+  uint32_t frequency;                         //as passed to setupLoRa(), for the driver
+  int32_t offset;
+  uint8_t calibrateImage[2];                  //RADIO_CALIBRATEIMAGE parameters
+  uint8_t frf[4];                             //RADIO_SET_RFFREQUENCY parameters
+  uint8_t modulation[4];                      //RADIO_SET_MODULATIONPARAMS, SF, bandwidth, CR and LDRO
+};
+
+
+constexpr uint8_t LTLoRaConfigBandwidthIndex(uint32_t bandwidth)
+{
+  //0 to 9 for 7.8kHz to 500kHz
+  return (bandwidth == 7800) ? 0 : (bandwidth == 10400) ? 1 : (bandwidth == 15600) ? 2 : (bandwidth == 20800) ? 3 :
+         ((bandwidth == 31250) || (bandwidth == 31200)) ? 4 : ((bandwidth == 41700) || (bandwidth == 41667)) ? 5 :
+         (bandwidth == 62500) ? 6 : (bandwidth == 125000) ? 7 : (bandwidth == 250000) ? 8 : (bandwidth == 500000) ? 9 :
+         LTLoRaConfigBadBandwidth;
+}
+
+
+constexpr uint8_t LTLoRaConfigSX127XBandwidth(uint32_t bandwidth)
+{
+  //bandwidth bits of REG_MODEMCONFIG1, LORA_BW_125 and the rest of SX127XLT
+  return (LTLoRaConfigBandwidthIndex(bandwidth) == LTLoRaConfigBadBandwidth) ? LTLoRaConfigBadBandwidth :
+         (uint8_t) (LTLoRaConfigBandwidthIndex(bandwidth) << 4);
+}
+
+
+constexpr uint8_t LTLoRaConfigSX126XBandwidth(uint32_t bandwidth)
+{
+  //LORA_BW_125 and the rest of SX126XLT, the narrow bandwidths are not in order
+  return (LTLoRaConfigBandwidthIndex(bandwidth) == LTLoRaConfigBadBandwidth) ? LTLoRaConfigBadBandwidth :
+         (uint8_t) ("\x00\x08\x01\x09\x02\x0A\x03\x04\x05\x06"[LTLoRaConfigBandwidthIndex(bandwidth)]);
+}
+
+
+constexpr uint8_t LTLoRaConfigLDRO(uint8_t sf, uint32_t bandwidth, uint8_t ldro)
+{
+  //on for symbols longer than 16mS, 2^sf / bandwidth > 16 / 1000
+  return (ldro != 2) ? ldro : ((((uint32_t) 1 << sf) * 1000UL) > (16UL * bandwidth)) ? 1 : 0;
+}
+
+
+constexpr uint32_t LTLoRaConfigSX127XFrf(uint32_t frequency, int32_t offset)
+{
+  //frequency / (32MHz / 2^19)
+  return (uint32_t) ((((uint64_t) (frequency + offset)) << 19) / 32000000);
+}
+
+
+constexpr uint32_t LTLoRaConfigSX126XFrf(uint32_t frequency, int32_t offset)
+{
+  //frequency / (32MHz / 2^25), the same as the division by FREQ_STEP of setRfFrequency()
+  return (uint32_t) ((((uint64_t) (frequency + offset)) << 25) / 32000000);
+}
+
+
+constexpr LTSX127XConfig LTLoRaConfigSX127X(uint32_t frequency, int32_t offset, uint8_t sf, uint32_t bandwidth, uint8_t cr, uint8_t ldro)
+{
+  return
+  {
+    frequency, offset,
+    {(uint8_t) (LTLoRaConfigSX127XFrf(frequency, offset) >> 16), (uint8_t) (LTLoRaConfigSX127XFrf(frequency, offset) >> 8), (uint8_t) LTLoRaConfigSX127XFrf(frequency, offset)},
+    0x23,                                                         //maximum gain, 150% LNA current
+    {0x00, 0x00},
+    {(uint8_t) (LTLoRaConfigSX127XBandwidth(bandwidth) | ((cr - 4) << 1)), (uint8_t) ((sf << 4) | 0x04)},   //explicit header, CRC on
+    {0x00, 0x08, 0xFF},
+    (uint8_t) (0x04 | (LTLoRaConfigLDRO(sf, bandwidth, ldro) << 3)),
+    (uint8_t) ((sf == 6) ? 0xC5 : 0xC3),
+    0x27,
+    {(uint8_t) ((bandwidth == 500000) ? 0x02 : 0x03), (uint8_t) ((sf == 6) ? 0x0C : 0x0A)},      //errata 2.1, detection threshold
+    0x12,
+    0x1D,
+    (uint8_t) ((bandwidth != 500000) ? 0x00 : (frequency >= 862000000) ? 0x64 : 0x7F)
+  };
+}
+
+
+template <uint8_t SF>
+constexpr LTSX127XConfig LTLoRaConfigSX127XImage(uint32_t frequency, int32_t offset, uint32_t bandwidth, uint8_t cr, uint8_t ldro)
+{
+  //only instantiated when the SX127X image is used, so an SF5 configuration still serves the SX126X
+  static_assert(SF >= 6, "LTLoRaConfig spreading factor is 6 to 12 for the SX127X, SF5 is SX126X only");
+  return LTLoRaConfigSX127X(frequency, offset, SF, bandwidth, cr, ldro);
+}
+
+
+constexpr LTSX126XConfig LTLoRaConfigSX126X(uint32_t frequency, int32_t offset, uint8_t sf, uint32_t bandwidth, uint8_t cr, uint8_t ldro)
+{
+  //image calibration band from the frequency without the offset, as setupLoRa() passes it, below 425MHz
+  //the 430 to 440MHz band, where calibrateImage() of the driver leaves the parameters unset
+  return
+  {
+    frequency, offset,
+    {
+      (uint8_t) ((frequency > 900000000) ? 0xE1 : (frequency > 850000000) ? 0xD7 : (frequency > 770000000) ? 0xC1 : (frequency > 460000000) ? 0x75 : 0x6B),
+      (uint8_t) ((frequency > 900000000) ? 0xE9 : (frequency > 850000000) ? 0xD8 : (frequency > 770000000) ? 0xC5 : (frequency > 460000000) ? 0x81 : 0x6F)
+    },
+    {(uint8_t) (LTLoRaConfigSX126XFrf(frequency, offset) >> 24), (uint8_t) (LTLoRaConfigSX126XFrf(frequency, offset) >> 16), (uint8_t) (LTLoRaConfigSX126XFrf(frequency, offset) >> 8), (uint8_t) LTLoRaConfigSX126XFrf(frequency, offset)},
+    {sf, LTLoRaConfigSX126XBandwidth(bandwidth), (uint8_t) (cr - 4), LTLoRaConfigLDRO(sf, bandwidth, ldro)}
+  };
+}
+
+
+template <uint32_t Frequency, uint8_t SF, uint32_t Bandwidth, uint8_t CR, uint8_t LDRO = 2, int32_t Offset = 0>
+struct LTLoRaConfig
+{
+  static_assert((SF >= 5) && (SF <= 12), "LTLoRaConfig spreading factor is 5 to 12, 6 to 12 for the SX127X");
+  static_assert(LTLoRaConfigBandwidthIndex(Bandwidth) != LTLoRaConfigBadBandwidth, "LTLoRaConfig bandwidth is not one of the LoRa bandwidths in Hz");
+  static_assert((CR >= 5) && (CR <= 8), "LTLoRaConfig coding rate is the denominator, 5 to 8");
+  static_assert(LDRO <= 2, "LTLoRaConfig LDRO is 0 off, 1 on or 2 auto");
+
+  static constexpr LTSX127XConfig SX127X = LTLoRaConfigSX127XImage<SF>(Frequency, Offset, Bandwidth, CR, LDRO);
+  static constexpr LTSX126XConfig SX126X = LTLoRaConfigSX126X(Frequency, Offset, SF, Bandwidth, CR, LDRO);
+};
+
+//definitions for C++11 and C++14, where passing the images by reference needs them
+
+template <uint32_t Frequency, uint8_t SF, uint32_t Bandwidth, uint8_t CR, uint8_t LDRO, int32_t Offset>
+constexpr LTSX127XConfig LTLoRaConfig<Frequency, SF, Bandwidth, CR, LDRO, Offset>::SX127X;
+
+template <uint32_t Frequency, uint8_t SF, uint32_t Bandwidth, uint8_t CR, uint8_t LDRO, int32_t Offset>
+constexpr LTSX126XConfig LTLoRaConfig<Frequency, SF, Bandwidth, CR, LDRO, Offset>::SX126X;
+
+#endif
+
+/*
+  MIT license
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+  associated documentation files (the "Software"), to deal in the Software without restriction, including
+  without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the
+  following conditions:
+
+  The above copyright notice and this permission notice shall be included in all copies or substantial
+  portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+  LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO
+  EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+  IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE
+  USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
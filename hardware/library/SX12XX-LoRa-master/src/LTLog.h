@@ -0,0 +1,379 @@
+/*
+  Licensed under a MIT license displayed at the bottom of this document.
+  Original published 16/10/26, append only store and forward log for FRAM and EEPROM
+*/
+
+/*
+  Append only log of sensor records kept in a FRAM or EEPROM, for a node that has to hold its readings
+  while its uplink is down and send them once it is back. Include one of FRAM_FM24CL64.h,
+  FRAM_MB85RC16PNF.h or EEPROM_Memory.h before this file, the log only uses the memory functions they all
+  have.
+
+  The area given to begin() is a ring of LTLogRecordSize byte slots, written in order and never
+  rewritten in place except for the sent byte, so every slot gets the same wear, two writes per lap
+  of the ring. There is no head or tail pointer in the memory to wear out or to be left half written,
+  begin() works both out from the records;
+
+  byte 0      lap, 1 to 255, the number of the pass round the ring the record was written on
+  byte 1      sent, LTLogUnsent when written, LTLogSent once the record has been uplinked
+  bytes 2-3   node address
+  bytes 4-7   time, seconds since 1970, 0 if not known
+  bytes 8-9   temperature in 0.01 degC
+  bytes 10-11 humidity in 0.01 %
+  byte 12     soil moisture in %, 255 if not fitted
+  bytes 13-14 RSSI in dBm
+  byte 15     SNR in dB
+  bytes 16-17 CRC16 CCITT of bytes 0 and 2 to 15
+
+  The head is the first slot that is not a valid record of the current lap, the tail the oldest valid
+  record not yet sent. A record half written when the power failed fails its CRC and is skipped, a sent
+  byte is a single byte write, so a reset at any point leaves the log readable. A batch uplinked but
+  not yet marked sent when the power fails is sent again, the records are delivered at least once.
+
+  When the ring is full the oldest records are overwritten, whether sent or not, append() returns false
+  when an unsent record was lost. begin() reads every slot twice, 5 memory reads per slot, about 4600
+  reads for the 8k FM24CL64. A device that has held anything else should be cleared once with format().
+
+  LTLog Log;
+  Log.begin(0, 8191);
+  Log.append(record);                         //while offline
+  count = Log.read(records, 16);              //once back online, uplink them, then
+  Log.markSent(count);
+*/
+
+#ifndef LTLog_h
+#define LTLog_h
+
+#include <Arduino.h>
+#include <LTCRC.h>
+
+#define LTLogRecordSize 18
+#define LTLogUnsent 0xFF
+#define LTLogSent 0x00
+#define LTLogNoSoil 0xFF
+
+
+struct LTLogRecord
+{
+  uint16_t node;
+  uint32_t time;                              //seconds since 1970, 0 if not known
+  int16_t temperature;                        //0.01 degC
+  uint16_t humidity;                          //0.01 %
+  uint8_t soil;                               //%, LTLogNoSoil if not fitted
+  int16_t rssi;
+  int8_t snr;
+};
+
+
+class LTLog
+{
+  public:
+
+    uint16_t begin(uint16_t startaddr, uint16_t endaddr)
+    {
+      //uses the memory from startaddr to endaddr inclusive, finds the head and tail and returns the number
+      //of records not yet sent
+
+      uint16_t slot, age;
+      uint8_t lap, slotlap;
+
+      _start = startaddr;
+      _slots = ((uint32_t) endaddr - startaddr + 1) / LTLogRecordSize;
+      _head = 0;
+      _tail = 0;
+      _pending = 0;
+
+      if (readLap(0, lap))
+      {
+        for (slot = 1; slot < _slots; slot++)
+        {
+          if (!readLap(slot, slotlap) || (slotlap != lap))
+          {
+            break;
+          }
+        }
+
+        _head = slot % _slots;
+        _lap = (_head == 0) ? nextLap(lap) : lap;
+      }
+      else if (readLap(_slots - 1, lap))
+      {
+        _lap = nextLap(lap);                  //slot 0 was being written on a new lap
+      }
+      else
+      {
+        _lap = 1;                             //empty
+      }
+
+      for (age = 0; age < _slots; age++)
+      {
+        slot = (_head + age) % _slots;
+
+        if (isUnsent(slot))
+        {
+          if (_pending == 0)
+          {
+            _tail = slot;
+          }
+
+          _pending++;
+        }
+      }
+
+      return _pending;
+    }
+
+    void format()
+    {
+      //empties the log. Clears the whole area, not just the laps, so a write cut short after its lap byte
+      //cannot bring an old record back.
+
+      fillMemory(_start, address(_slots) - 1, 0);
+
+      _head = 0;
+      _tail = 0;
+      _pending = 0;
+      _lap = 1;
+    }
+
+    bool append(const LTLogRecord &record)
+    {
+      //adds a record at the head, returns false if the oldest unsent record was overwritten to make room
+
+      uint8_t buff[LTLogRecordSize];
+      bool kept = true;
+
+      if ((_pending > 0) && isUnsent(_head))
+      {
+        _pending--;                           //full, the oldest unsent record goes
+        kept = false;
+
+        if (_tail == _head)
+        {
+          _tail = (_tail + 1) % _slots;
+        }
+      }
+
+      if (_pending == 0)
+      {
+        _tail = _head;
+      }
+
+      buff[0] = _lap;
+      buff[1] = LTLogUnsent;
+      putUint16(&buff[2], record.node);
+      putUint16(&buff[4], (uint16_t) record.time);
+      putUint16(&buff[6], (uint16_t) (record.time >> 16));
+      putUint16(&buff[8], (uint16_t) record.temperature);
+      putUint16(&buff[10], record.humidity);
+      buff[12] = record.soil;
+      putUint16(&buff[13], (uint16_t) record.rssi);
+      buff[15] = (uint8_t) record.snr;
+      putUint16(&buff[16], recordCRC(buff));
+
+      writeBytes(address(_head), buff, LTLogRecordSize);
+
+      _pending++;
+      _head++;
+
+      if (_head == _slots)
+      {
+        _head = 0;
+        _lap = nextLap(_lap);
+      }
+
+      return kept;
+    }
+
+    uint16_t read(LTLogRecord *records, uint16_t count)
+    {
+      //copies up to count of the oldest unsent records, starting at the tail, into records and returns how
+      //many were copied. They stay unsent until markSent().
+
+      uint8_t buff[LTLogRecordSize];
+      uint16_t slot = _tail, copied = 0, age;
+
+      for (age = 0; (age < span()) && (copied < count) && (copied < _pending); age++)
+      {
+        if (isUnsent(slot, buff))
+        {
+          records[copied].node = getUint16(&buff[2]);
+          records[copied].time = getUint16(&buff[4]) + ((uint32_t) getUint16(&buff[6]) << 16);
+          records[copied].temperature = (int16_t) getUint16(&buff[8]);
+          records[copied].humidity = getUint16(&buff[10]);
+          records[copied].soil = buff[12];
+          records[copied].rssi = (int16_t) getUint16(&buff[13]);
+          records[copied].snr = (int8_t) buff[15];
+          copied++;
+        }
+
+        slot = (slot + 1) % _slots;
+      }
+
+      return copied;
+    }
+
+    void markSent(uint16_t count)
+    {
+      //marks the records returned by the last read() of count records as sent, oldest first
+
+      uint16_t age, slots = span();
+
+      for (age = 0; (age < slots) && (count > 0) && (_pending > 0); age++)
+      {
+        if (isUnsent(_tail))
+        {
+          writeMemoryUint8(address(_tail) + 1, LTLogSent);
+          count--;
+          _pending--;
+        }
+
+        _tail = (_tail + 1) % _slots;
+      }
+    }
+
+    uint16_t getPending()
+    {
+      return _pending;
+    }
+
+    uint16_t getCapacity()
+    {
+      return _slots;
+    }
+
+  private:
+
+    uint16_t _start, _slots, _head, _tail, _pending;
+    uint8_t _lap;
+
+    uint16_t address(uint16_t slot)
+    {
+      return _start + (slot * LTLogRecordSize);
+    }
+
+    static uint8_t nextLap(uint8_t lap)
+    {
+      return (lap == 255) ? 1 : (lap + 1);
+    }
+
+    uint16_t span()
+    {
+      //slots from the tail to the head
+      uint16_t slots = (_head + _slots - _tail) % _slots;
+      return ((slots == 0) && (_pending > 0)) ? _slots : slots;
+    }
+
+    static void putUint16(uint8_t *buff, uint16_t value)
+    {
+      buff[0] = lowByte(value);
+      buff[1] = highByte(value);
+    }
+
+    static uint16_t getUint16(const uint8_t *buff)
+    {
+      return buff[0] + ((uint16_t) buff[1] << 8);
+    }
+
+    static uint16_t recordCRC(const uint8_t *buff)
+    {
+      return LTCRCCCITTUpdate(LTCRCCCITTByte(0xFFFF, buff[0]), &buff[2], 14);
+    }
+
+    void readBytes(uint16_t addr, uint8_t *buff, uint8_t size)
+    {
+      //4 bytes per memory read where it can, the devices and hosts are all little endian
+      uint32_t data;
+
+      while (size >= 4)
+      {
+        data = readMemoryUint32(addr);
+        memcpy(buff, &data, 4);
+        addr += 4;
+        buff += 4;
+        size -= 4;
+      }
+
+      while (size > 0)
+      {
+        *buff++ = readMemoryUint8(addr++);
+        size--;
+      }
+    }
+
+    void writeBytes(uint16_t addr, const uint8_t *buff, uint8_t size)
+    {
+      uint32_t data;
+
+      while (size >= 4)
+      {
+        memcpy(&data, buff, 4);
+        writeMemoryUint32(addr, data);
+        addr += 4;
+        buff += 4;
+        size -= 4;
+      }
+
+      while (size > 0)
+      {
+        writeMemoryUint8(addr++, *buff++);
+        size--;
+      }
+    }
+
+    bool readRecord(uint16_t slot, uint8_t *buff)
+    {
+      readBytes(address(slot), buff, LTLogRecordSize);
+      return (buff[0] >= 1) && (getUint16(&buff[16]) == recordCRC(buff));
+    }
+
+    bool readLap(uint16_t slot, uint8_t &lap)
+    {
+      //true if the slot holds a valid record, lap is its lap
+      uint8_t buff[LTLogRecordSize];
+
+      if (!readRecord(slot, buff))
+      {
+        return false;
+      }
+
+      lap = buff[0];
+      return true;
+    }
+
+    bool isUnsent(uint16_t slot, uint8_t *buff)
+    {
+      //true if slot holds a valid record of the lap expected there that has not been sent, the record is
+      //read into buff
+      uint8_t lap = (slot < _head) ? _lap : ((_lap == 1) ? 255 : (_lap - 1));
+
+      return readRecord(slot, buff) && (buff[0] == lap) && (buff[1] == LTLogUnsent);
+    }
+
+    bool isUnsent(uint16_t slot)
+    {
+      uint8_t buff[LTLogRecordSize];
+      return isUnsent(slot, buff);
+    }
+};
+
+#endif
+
+/*
+  MIT license
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+  associated documentation files (the "Software"), to deal in the Software without restriction, including
+  without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the
+  following conditions:
+
+  The above copyright notice and this permission notice shall be included in all copies or substantial
+  portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+  LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO
+  EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+  IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE
+  USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
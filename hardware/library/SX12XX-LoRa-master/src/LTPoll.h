@@ -0,0 +1,282 @@
+/*
+  Licensed under a MIT license displayed at the bottom of this document.
+  Original published 16/10/26, polling scheduler for a hub with many reliable packet nodes
+*/
+
+/*
+  Polling scheduler for a master that serves many slaves with reliable packets, one at a time. Each slave
+  has its own NetworkID, which is its node address, so only the slave polled sends the AutoACK. The
+  master asks the scheduler for the next node due, polls it, and hands the result back with pollDone(),
+  which records the ACK RSSI and SNR and sets when the node is next due from its state;
+
+  LTPollNew     - added and not answered yet, polled every active interval
+  LTPollActive  - answered and its RSSI moved by LTPollMovingdB or more since the last poll, the wristband
+                  is moving, polled every active interval
+  LTPollStable  - answered LTPollStablePolls times in a row with the RSSI steady, polled every stable
+                  interval
+  LTPollLost    - LTPollLostFailures polls in a row without an ACK, the interval doubles with each
+                  further failure up to the lost interval
+
+  Each node takes sizeof(LTPollNode), 12 bytes, and the table is a fixed array of MaxNodes, so the RAM
+  used does not change as nodes come and go. next() scans the table for the node that is most overdue,
+  a few microseconds per node on an ESP32, which is small against a poll of 100mS or more.
+
+  LTPoll<256> Poller;
+  Poller.addNode(0x3210);
+  slot = Poller.next(millis());
+  if (slot >= 0) poll Poller.getAddress(slot), then Poller.pollDone(slot, millis(), acked, rssi, snr);
+*/
+
+#ifndef LTPoll_h
+#define LTPoll_h
+
+#include <Arduino.h>
+
+#define LTPollFree 0                          //node states
+#define LTPollNew 1
+#define LTPollActive 2
+#define LTPollStable 3
+#define LTPollLost 4
+
+#define LTPollReservedID 0x8000               //bit 15 of the NetworkID, ReliableSequenceID of the drivers
+
+#ifndef LTPollMovingdB
+#define LTPollMovingdB 3                      //RSSI change that marks a node as moving
+#endif
+#ifndef LTPollStablePolls
+#define LTPollStablePolls 3                   //steady polls before a node is stable
+#endif
+#ifndef LTPollLostFailures
+#define LTPollLostFailures 3                  //failed polls before a node is lost
+#endif
+
+
+struct LTPollNode
+{
+  uint16_t address;                           //NetworkID of the slave
+  uint8_t state;
+  uint8_t steady;                             //polls in a row answered with the RSSI steady
+  uint32_t duemS;                             //millis() when the node is next due
+  int16_t rssi;                               //ACK RSSI and SNR of the last poll answered
+  int8_t snr;
+  uint8_t failures;                           //polls in a row not answered
+};
+
+
+template <uint16_t MaxNodes>
+class LTPoll
+{
+  public:
+
+    LTPoll()
+    {
+      memset(_nodes, 0, sizeof(_nodes));
+      _count = 0;
+      setIntervals(10000, 30000, 120000);
+    }
+
+    void setIntervals(uint32_t activemS, uint32_t stablemS, uint32_t lostmS)
+    {
+      //poll intervals of new and active nodes, of stable nodes, and the longest for lost nodes
+      _activemS = activemS;
+      _stablemS = stablemS;
+      _lostmS = lostmS;
+    }
+
+    int16_t addNode(uint16_t address, uint32_t nowmS = 0)
+    {
+      //returns the slot of the node, -1 if the table is full or the address has bit 15 set, which marks the
+      //reliable packets with a sequence number. A node already in the table keeps its slot.
+
+      int16_t slot;
+      uint16_t index;
+
+      if (address & LTPollReservedID)
+      {
+        return -1;
+      }
+
+      slot = findNode(address);
+
+      if (slot >= 0)
+      {
+        return slot;
+      }
+
+      for (index = 0; index < MaxNodes; index++)
+      {
+        if (_nodes[index].state == LTPollFree)
+        {
+          memset(&_nodes[index], 0, sizeof(LTPollNode));
+          _nodes[index].address = address;
+          _nodes[index].state = LTPollNew;
+          _nodes[index].duemS = nowmS;
+          _count++;
+          return index;
+        }
+      }
+
+      return -1;
+    }
+
+    bool removeNode(uint16_t address)
+    {
+      int16_t slot = findNode(address);
+
+      if (slot < 0)
+      {
+        return false;
+      }
+
+      _nodes[slot].state = LTPollFree;
+      _count--;
+      return true;
+    }
+
+    int16_t findNode(uint16_t address)
+    {
+      uint16_t index;
+
+      for (index = 0; index < MaxNodes; index++)
+      {
+        if ((_nodes[index].state != LTPollFree) && (_nodes[index].address == address))
+        {
+          return index;
+        }
+      }
+
+      return -1;
+    }
+
+    int16_t next(uint32_t nowmS)
+    {
+      //slot of the node that has been due longest, -1 if none is due
+
+      int16_t slot = -1;
+      uint32_t late, latest = 0;
+      uint16_t index;
+
+      for (index = 0; index < MaxNodes; index++)
+      {
+        if (_nodes[index].state == LTPollFree)
+        {
+          continue;
+        }
+
+        late = nowmS - _nodes[index].duemS;
+
+        if ((late < 0x80000000UL) && ((slot < 0) || (late > latest)))
+        {
+          slot = index;
+          latest = late;
+        }
+      }
+
+      return slot;
+    }
+
+    void pollDone(int16_t slot, uint32_t nowmS, bool acked, int16_t rssi, int8_t snr)
+    {
+      //record the result of polling the node in slot and set when it is next due
+
+      LTPollNode *node = &_nodes[slot];
+      uint32_t intervalmS;
+      uint8_t doublings;
+
+      if (acked)
+      {
+        if ((node->state == LTPollNew) || (node->failures > 0) || (abs(rssi - node->rssi) >= LTPollMovingdB))
+        {
+          node->state = LTPollActive;
+          node->steady = 0;
+        }
+        else if ((node->state == LTPollActive) && (++node->steady >= LTPollStablePolls))
+        {
+          node->state = LTPollStable;
+        }
+
+        node->rssi = rssi;
+        node->snr = snr;
+        node->failures = 0;
+        intervalmS = (node->state == LTPollStable) ? _stablemS : _activemS;
+      }
+      else
+      {
+        if (node->failures < 255)
+        {
+          node->failures++;
+        }
+
+        intervalmS = _activemS;
+
+        if (node->failures >= LTPollLostFailures)
+        {
+          node->state = LTPollLost;
+
+          for (doublings = LTPollLostFailures; (doublings <= node->failures) && (intervalmS < _lostmS); doublings++)
+          {
+            intervalmS = intervalmS * 2;
+          }
+
+          if (intervalmS > _lostmS)
+          {
+            intervalmS = _lostmS;
+          }
+        }
+        else if (node->state == LTPollStable)
+        {
+          node->state = LTPollActive;                 //a stable node that misses a poll is checked again soon
+          node->steady = 0;
+        }
+      }
+
+      node->duemS = nowmS + intervalmS;
+    }
+
+    uint16_t getAddress(int16_t slot)
+    {
+      return _nodes[slot].address;
+    }
+
+    const LTPollNode &getNode(int16_t slot)
+    {
+      return _nodes[slot];
+    }
+
+    uint16_t getNodeCount()
+    {
+      return _count;
+    }
+
+    uint16_t getMaxNodes()
+    {
+      return MaxNodes;
+    }
+
+  private:
+
+    LTPollNode _nodes[MaxNodes];
+    uint16_t _count;
+    uint32_t _activemS, _stablemS, _lostmS;
+};
+
+#endif
+
+/*
+  MIT license
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+  associated documentation files (the "Software"), to deal in the Software without restriction, including
+  without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the
+  following conditions:
+
+  The above copyright notice and this permission notice shall be included in all copies or substantial
+  portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+  LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO
+  EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+  IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE
+  USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
@@ -0,0 +1,149 @@
+/*
+  Licensed under a MIT license displayed at the bottom of this document.
+  Original published 16/10/26, receive queue between the radio and the rest of a sketch
+*/
+
+/*
+  Single producer, single consumer queue of received packets, so a node can go on receiving and sending
+  ACKs while the packets it already has are printed, checked or passed on. The producer is the code that
+  services the LoRa device, run when DIO0 goes high, the consumer is loop(). Neither ever waits for the
+  other and no lock is needed, the producer only writes the tail index and the consumer only the head.
+
+  Packets are received in place, the producer asks for the next free slot with reserve(), has the driver
+  read the packet straight into its data, fills in the RSSI and SNR and calls commit(). The consumer reads
+  the oldest packet with peek() and frees its slot with pop(). When every slot is in use reserve() returns
+  NULL and the producer should stop receiving until there is room, a reliable packet that is not received
+  is not ACKed, so the transmitter sends it again.
+
+  Each slot takes sizeof(LTRXPacket), 260 bytes with the default LTRXQueueData of 251. Slots is a power
+  of 2, up to 128. The indexes are single bytes, read and written with acquire and release ordering, so
+  the queue works between an interrupt or task and loop() on any of the processors the library supports.
+
+  LTRXQueue<8> RXQueue;
+  producer  slot = RXQueue.reserve(); receive into slot->data, set slot->length etc, RXQueue.commit();
+  consumer  packet = RXQueue.peek(); if (packet) use it, then RXQueue.pop();
+*/
+
+#ifndef LTRXQueue_h
+#define LTRXQueue_h
+
+#include <Arduino.h>
+
+#ifndef LTRXQueueData
+#define LTRXQueueData 251                     //largest payload held, a reliable packet less its 4 bytes
+#endif
+
+
+struct LTRXPacket
+{
+  uint8_t data[LTRXQueueData];
+  uint8_t length;                             //bytes of data used
+  int16_t rssi;                               //packet RSSI and SNR
+  int8_t snr;
+  uint32_t mS;                                //millis() when the packet was received
+};
+
+
+template <uint8_t Slots>
+class LTRXQueue
+{
+  static_assert((Slots > 0) && (Slots <= 128) && ((Slots & (Slots - 1)) == 0), "Slots must be a power of 2, up to 128");
+
+  public:
+
+    LTRXQueue()
+    {
+      _head = 0;
+      _tail = 0;
+      _full = 0;
+      _waiting = false;
+    }
+
+    LTRXPacket *reserve()
+    {
+      //producer, the next free slot or NULL if the queue is full. The same slot is returned until commit()
+      uint8_t tail = __atomic_load_n(&_tail, __ATOMIC_RELAXED);
+
+      if ((uint8_t) (tail - __atomic_load_n(&_head, __ATOMIC_ACQUIRE)) >= Slots)
+      {
+        _full += !_waiting;
+        _waiting = true;
+        return NULL;
+      }
+
+      _waiting = false;
+      return &_slots[tail & (Slots - 1)];
+    }
+
+    void commit()
+    {
+      //producer, the slot from reserve() is filled in and can be read
+      __atomic_store_n(&_tail, (uint8_t) (_tail + 1), __ATOMIC_RELEASE);
+    }
+
+    LTRXPacket *peek()
+    {
+      //consumer, the oldest packet or NULL if there is none. It stays valid until pop()
+      uint8_t head = __atomic_load_n(&_head, __ATOMIC_RELAXED);
+
+      if (head == __atomic_load_n(&_tail, __ATOMIC_ACQUIRE))
+      {
+        return NULL;
+      }
+
+      return &_slots[head & (Slots - 1)];
+    }
+
+    void pop()
+    {
+      //consumer, done with the packet from peek(), its slot is free again
+      __atomic_store_n(&_head, (uint8_t) (_head + 1), __ATOMIC_RELEASE);
+    }
+
+    uint8_t getCount()
+    {
+      //packets waiting, from either side
+      return (uint8_t) (__atomic_load_n(&_tail, __ATOMIC_ACQUIRE) - __atomic_load_n(&_head, __ATOMIC_ACQUIRE));
+    }
+
+    uint32_t getFullCount()
+    {
+      //times the producer found the queue full, a run of reserve() calls returning NULL counts once. Read
+      //it from the producer side
+      return _full;
+    }
+
+    uint8_t getSlots()
+    {
+      return Slots;
+    }
+
+  private:
+
+    LTRXPacket _slots[Slots];
+    uint8_t _head;                            //next packet to read, written by the consumer only
+    uint8_t _tail;                            //next slot to fill, written by the producer only
+    uint32_t _full;
+    bool _waiting;                            //the last reserve() returned NULL
+};
+
+#endif
+
+/*
+  MIT license
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+  associated documentation files (the "Software"), to deal in the Software without restriction, including
+  without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the
+  following conditions:
+
+  The above copyright notice and this permission notice shall be included in all copies or substantial
+  portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+  LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO
+  EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+  IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE
+  USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
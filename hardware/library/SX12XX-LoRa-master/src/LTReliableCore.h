@@ -0,0 +1,1744 @@
+/*
+  Licensed under a MIT license displayed at the bottom of this document.
+  Original published 16/10/26, data transfer protocol shared by the SX126X, SX127X and SX128X drivers
+*/
+
+/*
+  The Data Transfer (DT) packets of transmitDT(), receiveDT(), sendACKDT() and waitACKDT(), and their IRQ
+  variants, were written three times, once in each driver, and had drifted apart in small ways. They are
+  written once here as a template on the driver class, which derives from it;
+
+  class SX127XLT : public LTReliableCore<SX127XLT>
+
+  so the calls to the driver are resolved at compile time, there is no virtual function. A DT packet is
+  the header, the data, the network ID and the CRC of the data, the last two as low byte first uint16_t.
+  An ACK is the header, then the network ID and the payload CRC of the packet it acknowledges.
+
+  The reliable packets, transmitReliable(), receiveReliable(), their AutoACK and SX buffer variants, the
+  ACKs and the non blocking startTransmitReliableAutoACK(), startReceiveReliableAutoACK() and
+  pollReliable(), are here too, so ReliableACKLink, ReliableSequence and setReliablePreamble() work the
+  same on all three devices. A reliable packet is the payload, the sequence number with ReliableSequence,
+  then the network ID and payload CRC as for a DT packet, see LTReliableSeq.h. Bit 15 of the network ID,
+  ReliableSequenceID, marks a packet with a sequence number, so the reliable functions take network IDs of
+  0 to 0x7FFF only and return a ReliableIDError for any other.
+
+  What differs between the devices is reached through a few private functions each driver provides, with
+  LTReliableCore<> a friend of the driver;
+
+  standbyDT()                 - puts the device in standby
+  beginWriteDT(offset)        - starts a burst write of the device buffer at offset, NSS left low
+  beginReadDT(offset)         - starts a burst read of the device buffer at offset, NSS left low
+  endBufferDT()               - ends the burst, NSS high
+  startTXDT(length, power, t) - sets the packet length, TX power and IRQs and starts the transmission
+  txDoneDT(useIRQ)            - true when the transmission is done, or timed out by the device
+  endTXDT()                   - puts the device in standby after txDoneDT(), false for a device TX timeout
+  waitTXDT(t, useIRQ)         - waits for TX done, by the DIO pin or by reading the IRQ flags, leaves the
+                                device in standby, false for a timeout
+  startRXDT(t)                - puts the device in standby, sets the IRQs and starts reception
+  rxDoneDT(useIRQ)            - true when the reception is done, by the DIO pin or the IRQ flags
+  waitRXDT(t, useIRQ)         - waits for rxDoneDT(), false for a timeout
+  endRXDT()                   - true if the packet received has no error, the device is left in standby
+  timeoutDT(tx)               - puts the device in standby when a TX or RX timed out by millis() is given up
+  readRXBufferStatusDT()      - sets _RXPacketL, returns where the packet starts in the buffer
+  restartRXDT()               - starts reception again for waitACKDT()
+  receivingDT()               - true while a packet is being received, so a waitACKDT() timeout is held
+                                off until it is in
+  setTXBaseDT(addr)           - buffer address the SX variants transmit from, where the device has one
+  setRXBaseDT(addr)           - buffer address the SX variants receive to, where the device has one
+  readPreambleDT()            - LoRa preamble length in symbols, for setReliablePreamble()
+  writePreambleDT(length)     - sets the LoRa preamble length in symbols
+  DTMinPacketL                - shortest packet receiveDT() accepts
+  DTACKTXTimeout              - TX timeout of sendACKDT() and of the reliable ACKs, mS
+
+  The drivers instantiate the template in their own .cpp file, extern in their header, so the DT functions
+  are compiled once, in the same file as the device access they call, which the compiler can then inline.
+  The header, data and trailer are moved with LTSPIwriteBytes() and LTSPIreadBytes() of LTSPI.h, a block
+  transfer where the SPI library has one.
+*/
+
+#ifndef LTReliableCore_h
+#define LTReliableCore_h
+
+#include <Arduino.h>
+#include <SPI.h>
+#include <LTSPI.h>
+#include <LTCRC.h>
+#include <LTReliableSeq.h>
+
+//#define LTDEBUGRELIABLE                     //enable for debugging reliable and data transfer (DT) packets
+
+
+template <class Radio>
+class LTReliableCore
+{
+  public:
+
+    uint8_t transmitDT(uint8_t *header, uint8_t headersize, uint8_t *dataarray, uint8_t datasize, uint16_t networkID, uint32_t txtimeout, int8_t txpower, uint8_t wait)
+    {
+      return doTransmitDT(header, headersize, dataarray, datasize, networkID, txtimeout, txpower, wait, false);
+    }
+
+    uint8_t receiveDT(uint8_t *header, uint8_t headersize, uint8_t *dataarray, uint8_t datasize, uint16_t networkID, uint32_t rxtimeout, uint8_t wait)
+    {
+      return doReceiveDT(header, headersize, dataarray, datasize, networkID, rxtimeout, wait, false);
+    }
+
+    uint8_t sendACKDT(uint8_t *header, uint8_t headersize, int8_t txpower)
+    {
+      return doSendACKDT(header, headersize, txpower, false);
+    }
+
+    uint8_t waitACKDT(uint8_t *header, uint8_t headersize, uint32_t acktimeout)
+    {
+      return doWaitACKDT(header, headersize, acktimeout, false);
+    }
+
+    uint8_t receiveHeaderDT(uint8_t *header, uint8_t headersize, uint16_t networkID, uint32_t rxtimeout, uint8_t wait);
+    uint8_t readDataDT(uint8_t *dataarray, uint8_t datasize);   //data of the packet from receiveHeaderDT(), read in place
+
+    //the IRQ variants read the IRQ flags of the device instead of the DIO pin
+
+    uint8_t transmitDTIRQ(uint8_t *header, uint8_t headersize, uint8_t *dataarray, uint8_t datasize, uint16_t networkID, uint32_t txtimeout, int8_t txpower, uint8_t wait)
+    {
+      return doTransmitDT(header, headersize, dataarray, datasize, networkID, txtimeout, txpower, wait, true);
+    }
+
+    uint8_t receiveDTIRQ(uint8_t *header, uint8_t headersize, uint8_t *dataarray, uint8_t datasize, uint16_t networkID, uint32_t rxtimeout, uint8_t wait)
+    {
+      return doReceiveDT(header, headersize, dataarray, datasize, networkID, rxtimeout, wait, true);
+    }
+
+    uint8_t sendACKDTIRQ(uint8_t *header, uint8_t headersize, int8_t txpower)
+    {
+      return doSendACKDT(header, headersize, txpower, true);
+    }
+
+    uint8_t waitACKDTIRQ(uint8_t *header, uint8_t headersize, uint32_t acktimeout)
+    {
+      return doWaitACKDT(header, headersize, acktimeout, true);
+    }
+
+    //*******************************************************************************
+    //Reliable RX\TX routines
+    //*******************************************************************************
+
+    uint8_t transmitReliable(uint8_t *txbuffer, uint8_t size, uint16_t networkID, uint32_t txtimeout, int8_t txpower, uint8_t wait);
+    uint8_t receiveReliable(uint8_t *rxbuffer, uint8_t size, uint16_t networkID, uint32_t rxtimeout, uint8_t wait);
+
+    uint8_t transmitReliableAutoACK(uint8_t *txbuffer, uint8_t size, uint16_t networkID, uint32_t acktimeout, uint32_t txtimeout, int8_t txpower, uint8_t wait);
+    uint8_t receiveReliableAutoACK(uint8_t *rxbuffer, uint8_t size, uint16_t networkID, uint32_t ackdelay, int8_t txpower, uint32_t rxtimeout, uint8_t wait);
+
+    uint8_t sendReliableACK(uint16_t networkID, uint16_t payloadcrc, int8_t txpower)
+    {
+      return sendReliableACK(NULL, 0, networkID, payloadcrc, txpower);
+    }
+
+    uint8_t sendReliableACK(uint8_t *txbuffer, uint8_t size, uint16_t networkID, uint16_t payloadcrc, int8_t txpower);
+    uint8_t waitReliableACK(uint16_t networkID, uint16_t payloadcrc, uint32_t acktimeout);
+    uint8_t waitReliableACK(uint8_t *rxbuffer, uint8_t size, uint16_t networkID, uint16_t payloadcrc, uint32_t acktimeout);
+
+    //non blocking versions of transmitReliableAutoACK() and receiveReliableAutoACK(), call pollReliable() until done
+    uint8_t startTransmitReliableAutoACK(uint8_t *txbuffer, uint8_t size, uint16_t networkID, uint32_t acktimeout, uint32_t txtimeout, int8_t txpower, uint8_t attempts);
+    uint8_t startReceiveReliableAutoACK(uint8_t *rxbuffer, uint8_t size, uint16_t networkID, uint32_t ackdelay, int8_t txpower, uint32_t rxtimeout);
+    uint8_t pollReliable();
+    void cancelReliable();
+
+    uint8_t getReliableState()
+    {
+      return _ReliableState;
+    }
+
+    uint8_t getReliableAttempts()
+    {
+      return _ReliableAttempt;                        //times the packet of the last startTransmitReliableAutoACK() was sent
+    }
+
+    void setReliablePreamble(uint16_t length)
+    {
+      //reliable packets from transmitReliableAutoACK() and startTransmitReliableAutoACK() are sent with a
+      //preamble of length symbols, so a receiver that only wakes for a CAD now and then still finds them, the
+      //ACK and all other packets keep the preamble of the packet settings. 0 turns it off. The packet takes
+      //longer to send, allow for that in txtimeout
+
+      _ReliablePreamble = length;
+    }
+
+    int16_t readReliableACKRSSI()
+    {
+      return _ReliableACKRSSI;                        //RSSI the receiver measured, from an ACK with ReliableACKLink, 0 if none
+    }
+
+    int8_t readReliableACKSNR()
+    {
+      return _ReliableACKSNR;
+    }
+
+    uint8_t readReliablePayloadL()
+    {
+      return _ReliablePayloadL;                       //payload length of the last reliable packet received
+    }
+
+    uint16_t readReliableDuplicates()
+    {
+      return _ReliableDuplicates;                     //packets received again and ACKed again since begin(), with ReliableSequence
+    }
+
+    //the SX variants send and receive the payload where it is in the device buffer, from startaddr
+
+    uint8_t transmitSXReliable(uint8_t startaddr, uint8_t length, uint16_t networkID, uint32_t txtimeout, int8_t txpower, uint8_t wait)
+    {
+      return doTransmitSXReliable(startaddr, length, networkID, txtimeout, txpower, wait, false);
+    }
+
+    uint8_t transmitSXReliableIRQ(uint8_t startaddr, uint8_t length, uint16_t networkID, uint32_t txtimeout, int8_t txpower, uint8_t wait)
+    {
+      return doTransmitSXReliable(startaddr, length, networkID, txtimeout, txpower, wait, true);
+    }
+
+    uint8_t receiveSXReliable(uint8_t startaddr, uint16_t networkID, uint32_t rxtimeout, uint8_t wait)
+    {
+      return doReceiveSXReliable(startaddr, networkID, rxtimeout, wait, false);
+    }
+
+    uint8_t receiveSXReliableIRQ(uint8_t startaddr, uint16_t networkID, uint32_t rxtimeout, uint8_t wait)
+    {
+      return doReceiveSXReliable(startaddr, networkID, rxtimeout, wait, true);
+    }
+
+    uint8_t sendSXReliableACK(uint8_t startaddr, uint8_t length, uint16_t networkID, uint16_t payloadcrc, int8_t txpower)
+    {
+      return doSendSXReliableACK(startaddr, length, networkID, payloadcrc, txpower, false);
+    }
+
+    uint8_t sendSXReliableACKIRQ(uint8_t startaddr, uint8_t length, uint16_t networkID, uint16_t payloadcrc, int8_t txpower)
+    {
+      return doSendSXReliableACK(startaddr, length, networkID, payloadcrc, txpower, true);
+    }
+
+    uint8_t waitSXReliableACK(uint8_t startaddr, uint16_t networkID, uint16_t payloadcrc, uint32_t acktimeout)
+    {
+      return doWaitSXReliableACK(startaddr, networkID, payloadcrc, acktimeout, false);
+    }
+
+    uint8_t waitSXReliableACKIRQ(uint8_t startaddr, uint16_t networkID, uint16_t payloadcrc, uint32_t acktimeout)
+    {
+      return doWaitSXReliableACK(startaddr, networkID, payloadcrc, acktimeout, true);
+    }
+
+    uint8_t transmitSXReliableAutoACK(uint8_t startaddr, uint8_t length, uint16_t networkID, uint32_t acktimeout, uint32_t txtimeout, int8_t txpower, uint8_t wait);
+    uint8_t receiveSXReliableAutoACK(uint8_t startaddr, uint16_t networkID, uint32_t ackdelay, int8_t txpower, uint32_t rxtimeout, uint8_t wait);
+
+  protected:
+
+    LTReliableCore()
+    {
+      beginReliable();
+    }
+
+    void beginReliable();                             //from begin() of the driver
+
+  private:
+
+    uint8_t _ReliableState;         //state of the non blocking reliable functions
+    uint8_t *_ReliableBuffer;       //payload buffer passed to the non blocking reliable functions
+    uint8_t _ReliableSize;          //payload size on TX, buffer size on RX
+    uint16_t _ReliableNetworkID;
+    uint16_t _ReliablePayloadCRC;   //payload CRC of the packet sent or received, the one its ACK carries
+    int8_t _ReliableTXpower;
+    uint8_t _ReliableAttempts;      //transmit attempts allowed
+    uint8_t _ReliableAttempt;       //transmit attempts made
+    uint32_t _ReliableTimeout;      //acktimeout on TX, rxtimeout on RX
+    uint32_t _ReliableTXtimeout;
+    uint32_t _ReliableACKdelay;
+    uint32_t _ReliableStartmS;      //time the current state started
+    uint16_t _ReliablePreamble;     //preamble set with setReliablePreamble(), 0 if not used
+    uint16_t _SavedPreamble;        //preamble to restore when the reliable packet has gone, 0 if nothing to restore
+    int16_t _ReliableACKRSSI;       //from the last ACK with ReliableACKLink, 0 if none
+    int8_t _ReliableACKSNR;
+    LTReliableSeq<ReliableSeenSlots> _ReliableSeq;   //sequence numbers sent and packets ACKed, with ReliableSequence
+    uint8_t _ReliableSequence;      //sequence number of the packet sent or received
+    bool _ReliableSequenced;        //the packet received had a sequence number
+    uint8_t _ReliablePayloadL;      //payload length of the packet received
+    uint16_t _ReliableACKData;      //RSSI and SNR for a ReliableACKLink ACK, or those it had the first time
+    bool _ReliableResendACK;        //the packet received was ACKed before
+    uint16_t _ReliableDuplicates;
+
+    Radio &radio()
+    {
+      return static_cast<Radio &>(*this);
+    }
+
+    uint8_t doTransmitDT(uint8_t *header, uint8_t headersize, uint8_t *dataarray, uint8_t datasize, uint16_t networkID, uint32_t txtimeout, int8_t txpower, uint8_t wait, bool useIRQ);
+    uint8_t doReceiveDT(uint8_t *header, uint8_t headersize, uint8_t *dataarray, uint8_t datasize, uint16_t networkID, uint32_t rxtimeout, uint8_t wait, bool useIRQ);
+    uint8_t doSendACKDT(uint8_t *header, uint8_t headersize, int8_t txpower, bool useIRQ);
+    uint8_t doWaitACKDT(uint8_t *header, uint8_t headersize, uint32_t acktimeout, bool useIRQ);
+
+    uint8_t doTransmitSXReliable(uint8_t startaddr, uint8_t length, uint16_t networkID, uint32_t txtimeout, int8_t txpower, uint8_t wait, bool useIRQ);
+    uint8_t doReceiveSXReliable(uint8_t startaddr, uint16_t networkID, uint32_t rxtimeout, uint8_t wait, bool useIRQ);
+    uint8_t doSendSXReliableACK(uint8_t startaddr, uint8_t length, uint16_t networkID, uint16_t payloadcrc, int8_t txpower, bool useIRQ);
+    uint8_t doWaitSXReliableACK(uint8_t startaddr, uint16_t networkID, uint16_t payloadcrc, uint32_t acktimeout, bool useIRQ);
+
+    bool writeReliablePacket(uint8_t *txbuffer, uint8_t size, uint16_t networkID);
+    bool readReliablePacket(uint8_t *rxbuffer, uint8_t size, uint16_t networkID, uint16_t *payloadcrc);
+    bool readReliableACK(uint16_t networkID, uint16_t payloadcrc);
+    void startReliableACK(uint8_t *txbuffer, uint8_t size, uint16_t networkID, uint16_t payloadcrc, int8_t txpower);
+    bool startReliableTX();
+    void startReliableRX();
+    uint8_t endReliable(uint8_t state);
+    void startReliablePreamble();
+    void endReliablePreamble();
+    bool checkReliableDuplicate(uint16_t networkID, uint16_t payloadcrc);
+    bool checkReliableID(uint16_t networkID);
+    uint16_t getACKLink();
+    void readACKLink();
+
+    static void writeTrailerDT(uint16_t networkID, uint16_t payloadCRC)
+    {
+      uint8_t trailer[4] = {lowByte(networkID), highByte(networkID), lowByte(payloadCRC), highByte(payloadCRC)};
+
+      LTSPIwriteBytes(trailer, 4);
+    }
+};
+
+
+template <class Radio>
+uint8_t LTReliableCore<Radio>::doTransmitDT(uint8_t *header, uint8_t headersize, uint8_t *dataarray, uint8_t datasize, uint16_t networkID, uint32_t txtimeout, int8_t txpower, uint8_t wait, bool useIRQ)
+{
+#ifdef LTDEBUGRELIABLE
+  Serial.println(useIRQ ? F(" {RELIABLE} transmitDTIRQ() ") : F(" {RELIABLE} transmitDT() "));
+#endif
+
+  Radio &device = radio();
+  uint16_t payloadcrc;
+
+  device._ReliableErrors = 0;
+  device._ReliableFlags = 0;
+
+  if (datasize > (251 - headersize))                  //its 251 because of 4 bytes appended to packet
+  {
+    bitSet(device._ReliableErrors, ReliableSizeError);
+    return 0;
+  }
+
+  device.standbyDT();
+  device._TXPacketL = headersize + datasize + 4;
+
+  if (bitRead(device._ReliableConfig, NoReliableCRC))
+  {
+    payloadcrc = 0;
+  }
+  else
+  {
+    payloadcrc = device.CRCCCITT(dataarray, datasize, 0xFFFF);
+  }
+
+  device.beginWriteDT(0);
+  LTSPIwriteBytes(header, headersize);
+  LTSPIwriteBytes(dataarray, datasize);
+  writeTrailerDT(networkID, payloadcrc);              //append the network ID and payload CRC at end
+  device.endBufferDT();
+
+  device.startTXDT(device._TXPacketL, txpower, txtimeout);
+
+  if (!wait)
+  {
+    return device._TXPacketL;
+  }
+
+  if (!device.waitTXDT(txtimeout, useIRQ))
+  {
+    return 0;
+  }
+
+  return device._TXPacketL;
+}
+
+
+template <class Radio>
+uint8_t LTReliableCore<Radio>::doReceiveDT(uint8_t *header, uint8_t headersize, uint8_t *dataarray, uint8_t datasize, uint16_t networkID, uint32_t rxtimeout, uint8_t wait, bool useIRQ)
+{
+#ifdef LTDEBUGRELIABLE
+  Serial.println(useIRQ ? F(" {RELIABLE} receiveDTIRQ()") : F(" {RELIABLE} receiveDT()"));
+#endif
+
+  Radio &device = radio();
+  uint16_t RXnetworkID, RXcrc;
+  uint8_t RXHeaderL, RXDataL, RXstart;
+  uint8_t trailer[4];
+
+  device._ReliableErrors = 0;
+  device._ReliableFlags = 0;
+  device.startRXDT(rxtimeout);
+
+  if (!wait)
+  {
+    return 0;                                         //not wait requested so no packet length to pass
+  }
+
+  if (!device.waitRXDT(rxtimeout, useIRQ) || !device.endRXDT())
+  {
+    return 0;                                         //RX timeout, or the packet is errored somewhere
+  }
+
+  RXstart = device.readRXBufferStatusDT();
+  RXHeaderL = device.getByteSXBuffer(RXstart + 2);
+  RXDataL = device.getByteSXBuffer(RXstart + 3);
+
+  if ((RXHeaderL > headersize) || (RXDataL > datasize) || (device._RXPacketL < Radio::DTMinPacketL))
+  {
+    bitSet(device._ReliableErrors, ReliableSizeError);
+    return 0;
+  }
+
+  device.beginReadDT(RXstart);
+  LTSPIreadBytes(header, RXHeaderL);
+  LTSPIreadBytes(dataarray, RXDataL);
+  LTSPIreadBytes(trailer, 4);
+  device.endBufferDT();
+
+  RXnetworkID = ((uint16_t) trailer[1] << 8) + trailer[0];
+  RXcrc = ((uint16_t) trailer[3] << 8) + trailer[2];
+
+  if (!bitRead(device._ReliableConfig, NoReliableCRC) && (device.CRCCCITT(dataarray, RXDataL, 0xFFFF) != RXcrc))
+  {
+    bitSet(device._ReliableErrors, ReliableCRCError);
+  }
+
+  if (RXnetworkID != networkID)
+  {
+    bitSet(device._ReliableErrors, ReliableIDError);
+  }
+
+  if (device._ReliableErrors)                         //if there has been a reliable error return a RX fail
+  {
+    return 0;
+  }
+
+  return device._RXPacketL;                           //return and indicate RX OK.
+}
+
+
+template <class Radio>
+uint8_t LTReliableCore<Radio>::receiveHeaderDT(uint8_t *header, uint8_t headersize, uint16_t networkID, uint32_t rxtimeout, uint8_t wait)
+{
+  //Receives a data transfer packet as receiveDT() does, but reads only the header. The data stays in the
+  //buffer to be read with readDataDT() straight to where it is going, once the header says where that is.
+
+#ifdef LTDEBUGRELIABLE
+  Serial.println(F(" {RELIABLE} receiveHeaderDT()"));
+#endif
+
+  Radio &device = radio();
+  uint16_t RXnetworkID;
+  uint8_t RXHeaderL, RXstart;
+
+  device._ReliableErrors = 0;
+  device._ReliableFlags = 0;
+  device._DTDataL = 0;
+  device.startRXDT(rxtimeout);
+
+  if (!wait)
+  {
+    return 0;                                         //not wait requested so no packet length to pass
+  }
+
+  if (!device.waitRXDT(rxtimeout, false) || !device.endRXDT())
+  {
+    return 0;
+  }
+
+  RXstart = device.readRXBufferStatusDT();
+  RXHeaderL = device.getByteSXBuffer(RXstart + 2);
+  device._DTDataL = device.getByteSXBuffer(RXstart + 3);
+
+  if ((RXHeaderL > headersize) || (device._RXPacketL < Radio::DTMinPacketL) || ((RXHeaderL + device._DTDataL + 4) != device._RXPacketL))
+  {
+    device._DTDataL = 0;                              //the data is not where the header says
+    bitSet(device._ReliableErrors, ReliableSizeError);
+    return 0;
+  }
+
+  device.beginReadDT(RXstart);
+  LTSPIreadBytes(header, RXHeaderL);
+  device.endBufferDT();
+
+  device._DTDataStart = RXstart + RXHeaderL;
+  RXnetworkID = device.readUint16SXBuffer(device._DTDataStart + device._DTDataL);
+  device._DTPayloadCRC = device.readUint16SXBuffer(device._DTDataStart + device._DTDataL + 2);
+
+  if (RXnetworkID != networkID)
+  {
+    device._DTDataL = 0;
+    bitSet(device._ReliableErrors, ReliableIDError);
+    return 0;
+  }
+
+  return device._RXPacketL;
+}
+
+
+template <class Radio>
+uint8_t LTReliableCore<Radio>::readDataDT(uint8_t *dataarray, uint8_t datasize)
+{
+  //Reads the data of the packet from receiveHeaderDT() into dataarray and checks the payload CRC. Call it
+  //before anything else is transmitted, that overwrites the buffer. Returns the data length, 0 for an
+  //error, which readReliableErrors() reports, or if the packet had no data.
+
+#ifdef LTDEBUGRELIABLE
+  Serial.println(F(" {RELIABLE} readDataDT()"));
+#endif
+
+  Radio &device = radio();
+
+  if (device._DTDataL > datasize)
+  {
+    bitSet(device._ReliableErrors, ReliableSizeError);
+    return 0;
+  }
+
+  device.beginReadDT(device._DTDataStart);
+  LTSPIreadBytes(dataarray, device._DTDataL);
+  device.endBufferDT();
+
+  if (!bitRead(device._ReliableConfig, NoReliableCRC) && (device.CRCCCITT(dataarray, device._DTDataL, 0xFFFF) != device._DTPayloadCRC))
+  {
+    bitSet(device._ReliableErrors, ReliableCRCError);
+    return 0;
+  }
+
+  return device._DTDataL;
+}
+
+
+template <class Radio>
+uint8_t LTReliableCore<Radio>::doSendACKDT(uint8_t *header, uint8_t headersize, int8_t txpower, bool useIRQ)
+{
+#ifdef LTDEBUGRELIABLE
+  Serial.println(useIRQ ? F(" {RELIABLE} sendACKDTIRQ() ") : F(" {RELIABLE} sendACKDT() "));
+#endif
+
+  Radio &device = radio();
+  uint16_t networkID, payloadCRC;
+
+  device.standbyDT();
+  device._TXPacketL = headersize + 4;
+  networkID = device.readUint16SXBuffer(device._RXPacketL - 4);
+  payloadCRC = device.readUint16SXBuffer(device._RXPacketL - 2);
+
+  device.beginWriteDT(0);
+  LTSPIwriteBytes(header, headersize);
+  writeTrailerDT(networkID, payloadCRC);
+  device.endBufferDT();
+
+  device.startTXDT(device._TXPacketL, txpower, Radio::DTACKTXTimeout);
+
+  if (!device.waitTXDT(Radio::DTACKTXTimeout, useIRQ))
+  {
+    bitSet(device._ReliableErrors, ReliableTimeout);
+    return 0;
+  }
+
+  bitSet(device._ReliableFlags, ReliableACKSent);
+  return device._TXPacketL;                           //TX OK so return TXpacket length
+}
+
+
+template <class Radio>
+uint8_t LTReliableCore<Radio>::doWaitACKDT(uint8_t *header, uint8_t headersize, uint32_t acktimeout, bool useIRQ)
+{
+#ifdef LTDEBUGRELIABLE
+  Serial.println(useIRQ ? F(" {RELIABLE} waitACKDTIRQ()") : F(" {RELIABLE} waitACKDT()"));
+#endif
+
+  Radio &device = radio();
+  uint16_t RXnetworkID, RXcrc;
+  uint16_t networkID, payloadCRC;
+  uint32_t startmS;
+
+  device._ReliableErrors = 0;
+  device._ReliableFlags = 0;
+
+  networkID = device.readUint16SXBuffer(device._TXPacketL - 4);   //get networkID used to transmit previous packet, before next RX
+  payloadCRC = device.readUint16SXBuffer(device._TXPacketL - 2);  //get payloadCRC used to transmit previous packet, before next RX
+
+  device.restartRXDT();
+  startmS = millis();                                 //an overall timeout waiting for the ACK
+
+  do
+  {
+    if (device.rxDoneDT(useIRQ))                      //has a packet arrived ?
+    {
+      if (!device.endRXDT())
+      {
+        device.restartRXDT();
+        continue;
+      }
+
+      device.readRXBufferStatusDT();
+
+      if ((device._RXPacketL < 4) || ((device._RXPacketL - 4) > headersize))   //check passed buffer is big enough for header
+      {
+        device.restartRXDT();
+        continue;
+      }
+
+      RXnetworkID = device.readUint16SXBuffer(device._RXPacketL - 4);
+      RXcrc = device.readUint16SXBuffer(device._RXPacketL - 2);
+
+      if (!bitRead(device._ReliableConfig, NoReliableCRC) && (payloadCRC != RXcrc))
+      {
+        bitSet(device._ReliableErrors, ReliableCRCError);
+        device.restartRXDT();
+        continue;
+      }
+
+      if (RXnetworkID != networkID)
+      {
+        device.restartRXDT();
+        continue;
+      }
+
+      bitSet(device._ReliableFlags, ReliableACKReceived);
+
+      device.beginReadDT(0);
+      LTSPIreadBytes(header, device._RXPacketL - 4);
+      device.endBufferDT();
+
+      return device._RXPacketL;                       //_RXPacketL should be payload length + 4
+    }
+  } while (((uint32_t) (millis() - startmS) < acktimeout) || device.receivingDT());
+
+  bitSet(device._ReliableErrors, ReliableACKError);
+  bitSet(device._ReliableErrors, ReliableTimeout);
+  return 0;
+}
+
+
+//*******************************************************************************
+//Reliable packet routines
+//*******************************************************************************
+
+template <class Radio>
+void LTReliableCore<Radio>::beginReliable()
+{
+  //forgets the exchange in progress, the sequence numbers sent and the packets received
+
+  _ReliableState = ReliableIdle;
+  _ReliableBuffer = NULL;
+  _ReliablePayloadCRC = 0;
+  _ReliableAttempt = 0;
+  _ReliablePreamble = 0;
+  _SavedPreamble = 0;
+  _ReliableACKRSSI = 0;
+  _ReliableACKSNR = 0;
+  _ReliableSeq.begin();
+  _ReliableSequence = 0;
+  _ReliableSequenced = false;
+  _ReliablePayloadL = 0;
+  _ReliableACKData = 0;
+  _ReliableResendACK = false;
+  _ReliableDuplicates = 0;
+}
+
+
+template <class Radio>
+uint8_t LTReliableCore<Radio>::transmitReliable(uint8_t *txbuffer, uint8_t size, uint16_t networkID, uint32_t txtimeout, int8_t txpower, uint8_t wait)
+{
+#ifdef LTDEBUGRELIABLE
+  Serial.println(F(" {RELIABLE} transmitReliable() "));
+#endif
+
+  Radio &device = radio();
+
+  device._ReliableErrors = 0;
+  device._ReliableFlags = 0;
+
+  if (!writeReliablePacket(txbuffer, size, networkID))
+  {
+    return 0;
+  }
+
+  device.startTXDT(device._TXPacketL, txpower, txtimeout);
+
+  if (!wait)
+  {
+    return device._TXPacketL;
+  }
+
+  if (!device.waitTXDT(txtimeout, false))
+  {
+    return 0;
+  }
+
+  return device._TXPacketL;
+}
+
+
+template <class Radio>
+uint8_t LTReliableCore<Radio>::transmitReliableAutoACK(uint8_t *txbuffer, uint8_t size, uint16_t networkID, uint32_t acktimeout, uint32_t txtimeout, int8_t txpower, uint8_t wait)
+{
+#ifdef LTDEBUGRELIABLE
+  Serial.println(F(" {RELIABLE} transmitReliableAutoACK() "));
+#endif
+
+  Radio &device = radio();
+  bool sent;
+
+  device._ReliableErrors = 0;
+  device._ReliableFlags = 0;
+
+  if (!writeReliablePacket(txbuffer, size, networkID))
+  {
+    return 0;
+  }
+
+  startReliablePreamble();                            //txtimeout needs to allow for a long preamble
+  device.startTXDT(device._TXPacketL, txpower, txtimeout);
+
+  if (!wait)
+  {
+    return device._TXPacketL;
+  }
+
+  sent = device.waitTXDT(txtimeout, false);
+  endReliablePreamble();
+
+  if (!sent || (waitReliableACK(networkID, _ReliablePayloadCRC, acktimeout) != 4))
+  {
+    return 0;
+  }
+
+  _ReliableSeq.acknowledged();
+  return device._TXPacketL;
+}
+
+
+template <class Radio>
+uint8_t LTReliableCore<Radio>::receiveReliable(uint8_t *rxbuffer, uint8_t size, uint16_t networkID, uint32_t rxtimeout, uint8_t wait)
+{
+  //Maximum LoRa packet size is 255 bytes, so allowing for the 4 bytes appended to the end of a reliable
+  //packet, the maximum payload size is 251 bytes. The payload length is 4 bytes less than the received
+  //packet length, 5 for a packet with a sequence number, rxbuffer needs to be big enough for it.
+
+#ifdef LTDEBUGRELIABLE
+  Serial.println(F(" {RELIABLE} receiveReliable()"));
+#endif
+
+  Radio &device = radio();
+  uint16_t payloadcrc = 0;
+
+  device._ReliableErrors = 0;
+  device._ReliableFlags = 0;
+
+  if (!checkReliableID(networkID))
+  {
+    return 0;
+  }
+
+  if (size > 251)
+  {
+    bitSet(device._ReliableErrors, ReliableSizeError);
+    return 0;
+  }
+
+  device.startRXDT(rxtimeout);
+
+  if (!wait)
+  {
+    return 0;                                         //not wait requested so no packet length to pass
+  }
+
+  if (!device.waitRXDT(rxtimeout, false) || !device.endRXDT())
+  {
+    return 0;                                         //RX timeout, or the packet is errored somewhere
+  }
+
+  if (!readReliablePacket(rxbuffer, size, networkID, &payloadcrc))
+  {
+    return 0;                                         //if there has been a reliable error return a RX fail
+  }
+
+  return device._RXPacketL;
+}
+
+
+template <class Radio>
+uint8_t LTReliableCore<Radio>::receiveReliableAutoACK(uint8_t *rxbuffer, uint8_t size, uint16_t networkID, uint32_t ackdelay, int8_t txpower, uint32_t rxtimeout, uint8_t wait)
+{
+  //As receiveReliable() then sends the ACK after ackdelay. With ReliableSequence a packet that was ACKed
+  //before, its ACK lost, is ACKed again with the ACK it had and not returned, the function goes back to
+  //receive with rxtimeout started again.
+
+#ifdef LTDEBUGRELIABLE
+  Serial.println(F(" {RELIABLE} receiveReliableAutoACK()"));
+#endif
+
+  Radio &device = radio();
+  uint16_t payloadcrc = 0;
+  uint8_t RXPacketL, link[2];
+  bool duplicate;
+
+  device._ReliableErrors = 0;
+  device._ReliableFlags = 0;
+
+  if (!checkReliableID(networkID))
+  {
+    return 0;
+  }
+
+  if (size > 251)
+  {
+    bitSet(device._ReliableErrors, ReliableSizeError);
+    return 0;
+  }
+
+  do
+  {
+    device.startRXDT(rxtimeout);
+
+    if (!wait)
+    {
+      return 0;                                       //not wait requested so no packet length to pass
+    }
+
+    if (!device.waitRXDT(rxtimeout, false) || !device.endRXDT())
+    {
+      return 0;
+    }
+
+    if (!readReliablePacket(rxbuffer, size, networkID, &payloadcrc))
+    {
+      return 0;
+    }
+
+    RXPacketL = device._RXPacketL;
+    duplicate = checkReliableDuplicate(networkID, payloadcrc);
+    delay(ackdelay);
+
+    link[0] = lowByte(_ReliableACKData);
+    link[1] = highByte(_ReliableACKData);
+
+    if (!sendReliableACK(link, bitRead(device._ReliableConfig, ReliableACKLink) ? 2 : 0, networkID, payloadcrc, txpower))
+    {
+      return 0;
+    }
+
+    if (_ReliableSequenced && !duplicate)
+    {
+      _ReliableSeq.add(networkID, _ReliableSequence, payloadcrc, _ReliableACKData);
+    }
+  }
+  while (duplicate);
+
+  return RXPacketL;
+}
+
+
+template <class Radio>
+uint8_t LTReliableCore<Radio>::sendReliableACK(uint8_t *txbuffer, uint8_t size, uint16_t networkID, uint16_t payloadcrc, int8_t txpower)
+{
+  //the ACK is the txbuffer payload, if any, then the networkID and payloadcrc of the packet it acknowledges
+
+#ifdef LTDEBUGRELIABLE
+  Serial.println(F(" {RELIABLE} sendReliableACK()"));
+#endif
+
+  Radio &device = radio();
+
+  startReliableACK(txbuffer, size, networkID, payloadcrc, txpower);
+
+  if (!device.waitTXDT(Radio::DTACKTXTimeout, false))
+  {
+    return 0;
+  }
+
+  bitSet(device._ReliableFlags, ReliableACKSent);
+  return device._TXPacketL;                           //TX OK so return TXpacket length
+}
+
+
+template <class Radio>
+uint8_t LTReliableCore<Radio>::waitReliableACK(uint16_t networkID, uint16_t payloadcrc, uint32_t acktimeout)
+{
+#ifdef LTDEBUGRELIABLE
+  Serial.println(F(" {RELIABLE} waitReliableACK()"));
+#endif
+
+  Radio &device = radio();
+  uint32_t startmS;
+
+  _ReliableACKRSSI = 0;
+  _ReliableACKSNR = 0;
+  device.restartRXDT();
+  startmS = millis();
+
+  do
+  {
+    if (device.rxDoneDT(false))                       //has a packet arrived ?
+    {
+      if (readReliableACK(networkID, payloadcrc))
+      {
+        bitSet(device._ReliableFlags, ReliableACKReceived);
+        return 4;                                     //return value of 4 indicates valid ack
+      }
+
+      device.restartRXDT();                           //not our ACK, keep listening
+    }
+  } while (((uint32_t) (millis() - startmS) < acktimeout) || device.receivingDT());
+
+  bitSet(device._ReliableErrors, ReliableACKError);
+  return 0;
+}
+
+
+template <class Radio>
+uint8_t LTReliableCore<Radio>::waitReliableACK(uint8_t *rxbuffer, uint8_t size, uint16_t networkID, uint16_t payloadcrc, uint32_t acktimeout)
+{
+  //overloaded version of waitReliableACK() for use when the ACK contains payload data
+
+#ifdef LTDEBUGRELIABLE
+  Serial.println(F(" {RELIABLE} waitReliableACK() payload"));
+#endif
+
+  Radio &device = radio();
+  uint32_t startmS;
+
+  if (size > 251)
+  {
+    bitSet(device._ReliableErrors, ReliableSizeError);
+    return 0;
+  }
+
+  device.restartRXDT();
+  startmS = millis();
+
+  do
+  {
+    if (device.rxDoneDT(false))                       //has a packet arrived ?
+    {
+      if (readReliableACK(networkID, payloadcrc))
+      {
+        if ((device._RXPacketL - 4) > size)           //check passed buffer is big enough for payload
+        {
+          bitSet(device._ReliableErrors, ReliableACKError);
+          bitSet(device._ReliableErrors, ReliableSizeError);
+          return 0;
+        }
+
+        bitSet(device._ReliableFlags, ReliableACKReceived);
+
+        device.beginReadDT(0);
+        LTSPIreadBytes(rxbuffer, device._RXPacketL - 4);
+        device.endBufferDT();
+
+        return device._RXPacketL;                     //_RXPacketL should be payload length + 4
+      }
+
+      device.restartRXDT();
+    }
+  } while (((uint32_t) (millis() - startmS) < acktimeout) || device.receivingDT());
+
+  bitSet(device._ReliableErrors, ReliableACKError);
+  return 0;
+}
+
+
+template <class Radio>
+uint8_t LTReliableCore<Radio>::startTransmitReliableAutoACK(uint8_t *txbuffer, uint8_t size, uint16_t networkID, uint32_t acktimeout, uint32_t txtimeout, int8_t txpower, uint8_t attempts)
+{
+  //starts the same exchange as transmitReliableAutoACK() but returns once the packet is being sent. pollReliable()
+  //then moves through TX, waiting for the ACK and re-transmitting, up to attempts times, until the state is
+  //ReliableDone or ReliableFailed. txbuffer needs to stay unchanged until then, it is used for re-transmissions.
+
+#ifdef LTDEBUGRELIABLE
+  Serial.println(F(" {RELIABLE} startTransmitReliableAutoACK() "));
+#endif
+
+  Radio &device = radio();
+
+  device._ReliableFlags = 0;
+  _ReliableBuffer = txbuffer;
+  _ReliableSize = size;
+  _ReliableNetworkID = networkID;
+  _ReliableTimeout = acktimeout;
+  _ReliableTXtimeout = txtimeout;
+  _ReliableTXpower = txpower;
+  _ReliableAttempts = attempts;
+  _ReliableAttempt = 0;
+
+  if (!startReliableTX())
+  {
+    return 0;
+  }
+
+  return device._TXPacketL;
+}
+
+
+template <class Radio>
+uint8_t LTReliableCore<Radio>::startReceiveReliableAutoACK(uint8_t *rxbuffer, uint8_t size, uint16_t networkID, uint32_t ackdelay, int8_t txpower, uint32_t rxtimeout)
+{
+  //starts the same exchange as receiveReliableAutoACK(), pollReliable() receives the packet, waits ackdelay and
+  //sends the ACK. An rxtimeout of 0 waits for a packet indefinitely. With ReliableSequence a packet ACKed before is
+  //ACKed again and pollReliable() goes back to ReliableRX, with rxtimeout started again.
+
+#ifdef LTDEBUGRELIABLE
+  Serial.println(F(" {RELIABLE} startReceiveReliableAutoACK() "));
+#endif
+
+  Radio &device = radio();
+
+  device._ReliableErrors = 0;
+  device._ReliableFlags = 0;
+
+  if (!checkReliableID(networkID))
+  {
+    _ReliableState = ReliableFailed;
+    return 0;
+  }
+
+  if (size > 251)
+  {
+    bitSet(device._ReliableErrors, ReliableSizeError);
+    _ReliableState = ReliableFailed;
+    return 0;
+  }
+
+  _ReliableBuffer = rxbuffer;
+  _ReliableSize = size;
+  _ReliableNetworkID = networkID;
+  _ReliableACKdelay = ackdelay;
+  _ReliableTXpower = txpower;
+  _ReliableTimeout = rxtimeout;
+
+  startReliableRX();
+  return 1;
+}
+
+
+template <class Radio>
+uint8_t LTReliableCore<Radio>::pollReliable()
+{
+  //advances the non blocking reliable exchange and returns its state. Does nothing that waits, so call it often,
+  //from loop() or when the TX done or RX done pin goes high. Timeouts are only checked when pollReliable() is
+  //called.
+
+  Radio &device = radio();
+  uint16_t payloadcrc = 0;
+  uint8_t link[2];
+  bool sent;
+
+  switch (_ReliableState)
+  {
+    case ReliableTX:
+      if (device.txDoneDT(false))
+      {
+        sent = device.endTXDT();
+        endReliablePreamble();
+
+        if (!sent)
+        {
+          return endReliable(ReliableFailed);         //timed out by the device
+        }
+
+        device.restartRXDT();                         //standby and then RX for the ACK
+        _ReliableState = ReliableWaitACK;
+        _ReliableStartmS = millis();
+      }
+      else if (_ReliableTXtimeout && ((uint32_t) (millis() - _ReliableStartmS) >= _ReliableTXtimeout))
+      {
+        device.timeoutDT(true);
+        endReliablePreamble();
+        return endReliable(ReliableFailed);
+      }
+      break;
+
+    case ReliableWaitACK:
+      if (device.rxDoneDT(false))
+      {
+        if (readReliableACK(_ReliableNetworkID, _ReliablePayloadCRC))
+        {
+          _ReliableSeq.acknowledged();
+          bitSet(device._ReliableFlags, ReliableACKReceived);
+          return endReliable(ReliableDone);
+        }
+
+        device.restartRXDT();                         //not our ACK, keep listening
+      }
+      else if (((uint32_t) (millis() - _ReliableStartmS) >= _ReliableTimeout) && !device.receivingDT())
+      {
+        bitSet(device._ReliableErrors, ReliableACKError);   //no ACK and no packet being received
+
+        if (_ReliableAttempt < _ReliableAttempts)
+        {
+          startReliableTX();                          //try again
+        }
+        else
+        {
+          return endReliable(ReliableFailed);
+        }
+      }
+      break;
+
+    case ReliableRX:
+      if (device.rxDoneDT(false))
+      {
+        device.standbyDT();                           //ensure to stop further packet reception
+
+        if (!device.endRXDT() || !readReliablePacket(_ReliableBuffer, _ReliableSize, _ReliableNetworkID, &payloadcrc))
+        {
+          return endReliable(ReliableFailed);         //errored packet or a reliable error, or timed out by the device
+        }
+
+        _ReliableResendACK = checkReliableDuplicate(_ReliableNetworkID, payloadcrc);
+        _ReliablePayloadCRC = payloadcrc;
+        _ReliableState = ReliableACKDelay;
+        _ReliableStartmS = millis();
+      }
+      else if (_ReliableTimeout && ((uint32_t) (millis() - _ReliableStartmS) >= _ReliableTimeout) && !device.receivingDT())
+      {
+        device.timeoutDT(false);
+        return endReliable(ReliableFailed);
+      }
+      break;
+
+    case ReliableACKDelay:
+      if ((uint32_t) (millis() - _ReliableStartmS) >= _ReliableACKdelay)
+      {
+        //same packet as sendReliableACK(), with ReliableACKLink after the RSSI and SNR of the packet, for a
+        //packet ACKed before those it was ACKed with
+        link[0] = lowByte(_ReliableACKData);
+        link[1] = highByte(_ReliableACKData);
+        startReliableACK(link, bitRead(device._ReliableConfig, ReliableACKLink) ? 2 : 0, _ReliableNetworkID, _ReliablePayloadCRC, _ReliableTXpower);
+        _ReliableState = ReliableSendACK;
+        _ReliableStartmS = millis();
+      }
+      break;
+
+    case ReliableSendACK:
+      if (device.txDoneDT(false))
+      {
+        if (!device.endTXDT())
+        {
+          return endReliable(ReliableFailed);
+        }
+
+        bitSet(device._ReliableFlags, ReliableACKSent);
+
+        if (_ReliableResendACK)
+        {
+          startReliableRX();                          //not returned again, wait for the next packet
+          break;
+        }
+
+        if (_ReliableSequenced)
+        {
+          _ReliableSeq.add(_ReliableNetworkID, _ReliableSequence, _ReliablePayloadCRC, _ReliableACKData);
+        }
+
+        return endReliable(ReliableDone);
+      }
+      else if ((uint32_t) (millis() - _ReliableStartmS) >= Radio::DTACKTXTimeout)   //same TX timeout as sendReliableACK()
+      {
+        device.timeoutDT(true);
+        return endReliable(ReliableFailed);
+      }
+      break;
+  }
+
+  return _ReliableState;
+}
+
+
+template <class Radio>
+void LTReliableCore<Radio>::cancelReliable()
+{
+#ifdef LTDEBUGRELIABLE
+  Serial.println(F(" {RELIABLE} cancelReliable()"));
+#endif
+
+  radio().standbyDT();
+  endReliablePreamble();
+  _ReliableState = ReliableIdle;
+}
+
+
+template <class Radio>
+uint8_t LTReliableCore<Radio>::transmitSXReliableAutoACK(uint8_t startaddr, uint8_t length, uint16_t networkID, uint32_t acktimeout, uint32_t txtimeout, int8_t txpower, uint8_t wait)
+{
+  uint8_t TXPacketL = doTransmitSXReliable(startaddr, length, networkID, txtimeout, txpower, wait, false);
+
+  if ((TXPacketL == 0) || !wait)
+  {
+    return TXPacketL;
+  }
+
+  if (waitReliableACK(networkID, _ReliablePayloadCRC, acktimeout) != 4)
+  {
+    return 0;
+  }
+
+  return TXPacketL;
+}
+
+
+template <class Radio>
+uint8_t LTReliableCore<Radio>::receiveSXReliableAutoACK(uint8_t startaddr, uint16_t networkID, uint32_t ackdelay, int8_t txpower, uint32_t rxtimeout, uint8_t wait)
+{
+  Radio &device = radio();
+  uint8_t RXPacketL = doReceiveSXReliable(startaddr, networkID, rxtimeout, wait, false);
+  uint16_t saved1, saved2;
+
+  if (RXPacketL == 0)
+  {
+    return 0;
+  }
+
+  delay(ackdelay);
+  saved1 = device.readUint16SXBuffer(0);              //save bytes that would be overwritten by the ACK
+  saved2 = device.readUint16SXBuffer(2);
+
+  device._TXPacketL = sendReliableACK(networkID, _ReliablePayloadCRC, txpower);
+
+  device.writeUint16SXBuffer(0, saved1);              //restore bytes that would be overwritten by the ACK
+  device.writeUint16SXBuffer(2, saved2);
+
+  if (device._TXPacketL != 4)
+  {
+    bitSet(device._ReliableErrors, ReliableACKError);
+    return 0;
+  }
+
+  return RXPacketL;                                   //return indicating RX ack sent OK.
+}
+
+
+template <class Radio>
+uint8_t LTReliableCore<Radio>::doTransmitSXReliable(uint8_t startaddr, uint8_t length, uint16_t networkID, uint32_t txtimeout, int8_t txpower, uint8_t wait, bool useIRQ)
+{
+#ifdef LTDEBUGRELIABLE
+  Serial.println(useIRQ ? F(" {RELIABLE} transmitSXReliableIRQ() ") : F(" {RELIABLE} transmitSXReliable() "));
+#endif
+
+  Radio &device = radio();
+
+  device._ReliableErrors = 0;
+  device._ReliableFlags = 0;
+
+  if (!checkReliableID(networkID))
+  {
+    return 0;
+  }
+
+  if (startaddr + length > 251)
+  {
+    bitSet(device._ReliableErrors, ReliableSizeError);
+    return 0;
+  }
+
+  device.standbyDT();
+  device.setTXBaseDT(startaddr);
+  device._TXPacketL = length + 4;
+
+  if (bitRead(device._ReliableConfig, NoReliableCRC))
+  {
+    _ReliablePayloadCRC = 0;
+  }
+  else
+  {
+    _ReliablePayloadCRC = device.CRCCCITTReliable(startaddr, startaddr + length - 1, 0xFFFF);
+  }
+
+  device.beginWriteDT(startaddr + length);
+  writeTrailerDT(networkID, _ReliablePayloadCRC);     //append the network ID and payload CRC to the payload in the buffer
+  device.endBufferDT();
+
+  device.startTXDT(device._TXPacketL, txpower, txtimeout);
+
+  if (!wait)
+  {
+    return device._TXPacketL;
+  }
+
+  if (!device.waitTXDT(txtimeout, useIRQ))
+  {
+    return 0;
+  }
+
+  return device._TXPacketL;
+}
+
+
+template <class Radio>
+uint8_t LTReliableCore<Radio>::doReceiveSXReliable(uint8_t startaddr, uint16_t networkID, uint32_t rxtimeout, uint8_t wait, bool useIRQ)
+{
+#ifdef LTDEBUGRELIABLE
+  Serial.println(useIRQ ? F(" {RELIABLE} receiveSXReliableIRQ()") : F(" {RELIABLE} receiveSXReliable()"));
+#endif
+
+  Radio &device = radio();
+  uint16_t RXnetworkID;
+
+  device._ReliableErrors = 0;
+  device._ReliableFlags = 0;
+  _ReliablePayloadCRC = 0;
+
+  if (!checkReliableID(networkID))
+  {
+    return 0;
+  }
+
+  device.standbyDT();
+  device.setRXBaseDT(startaddr);                      //set start address of RX packet in buffer
+  device.startRXDT(rxtimeout);
+
+  if (!wait)
+  {
+    return 0;                                         //not wait requested so no packet length to pass
+  }
+
+  if (!device.waitRXDT(rxtimeout, useIRQ) || !device.endRXDT())
+  {
+    return 0;
+  }
+
+  device.readRXBufferStatusDT();
+
+  if (device._RXPacketL < 4)                          //check received packet is 4 or more bytes long
+  {
+    bitSet(device._ReliableErrors, ReliableSizeError);
+    return 0;
+  }
+
+  RXnetworkID = device.readUint16SXBuffer(startaddr + device._RXPacketL - 4);
+
+  if (RXnetworkID != networkID)
+  {
+    bitSet(device._ReliableErrors, ReliableIDError);
+  }
+
+  if (!bitRead(device._ReliableConfig, NoReliableCRC))
+  {
+    _ReliablePayloadCRC = device.CRCCCITTReliable(startaddr, startaddr + device._RXPacketL - 5, 0xFFFF);
+
+    if (_ReliablePayloadCRC != device.readUint16SXBuffer(startaddr + device._RXPacketL - 2))
+    {
+      bitSet(device._ReliableErrors, ReliableCRCError);
+    }
+  }
+
+  if (device._ReliableErrors)                         //if there has been a reliable error return a RX fail
+  {
+    return 0;
+  }
+
+  return device._RXPacketL;
+}
+
+
+template <class Radio>
+uint8_t LTReliableCore<Radio>::doSendSXReliableACK(uint8_t startaddr, uint8_t length, uint16_t networkID, uint16_t payloadcrc, int8_t txpower, bool useIRQ)
+{
+  //the ACK is the length bytes at startaddr in the buffer, then the networkID and payloadcrc
+
+#ifdef LTDEBUGRELIABLE
+  Serial.println(useIRQ ? F(" {RELIABLE} sendSXReliableACKIRQ() ") : F(" {RELIABLE} sendSXReliableACK() "));
+#endif
+
+  Radio &device = radio();
+
+  device.standbyDT();
+  device.setTXBaseDT(startaddr);
+  device._TXPacketL = length + 4;
+
+  device.beginWriteDT(startaddr + length);
+  writeTrailerDT(networkID, payloadcrc);
+  device.endBufferDT();
+
+  device.startTXDT(device._TXPacketL, txpower, Radio::DTACKTXTimeout);
+
+  if (!device.waitTXDT(Radio::DTACKTXTimeout, useIRQ))
+  {
+    return 0;
+  }
+
+  bitSet(device._ReliableFlags, ReliableACKSent);
+  return device._TXPacketL;
+}
+
+
+template <class Radio>
+uint8_t LTReliableCore<Radio>::doWaitSXReliableACK(uint8_t startaddr, uint16_t networkID, uint16_t payloadcrc, uint32_t acktimeout, bool useIRQ)
+{
+#ifdef LTDEBUGRELIABLE
+  Serial.println(useIRQ ? F(" {RELIABLE} waitSXReliableACKIRQ()") : F(" {RELIABLE} waitSXReliableACK()"));
+#endif
+
+  Radio &device = radio();
+  uint32_t startmS;
+
+  device.setRXBaseDT(startaddr);                      //set the RX base address pointer
+  device.restartRXDT();
+  startmS = millis();
+
+  do
+  {
+    if (device.rxDoneDT(useIRQ))                      //has a packet arrived ?
+    {
+      if (device.endRXDT())
+      {
+        device.readRXBufferStatusDT();
+
+        if ((device._RXPacketL >= 4) && (device.readUint16SXBuffer(startaddr + device._RXPacketL - 4) == networkID) && (device.readUint16SXBuffer(startaddr + device._RXPacketL - 2) == payloadcrc))
+        {
+          bitSet(device._ReliableFlags, ReliableACKReceived);
+          return device._RXPacketL;                   //_RXPacketL should be payload length + 4
+        }
+      }
+
+      device.restartRXDT();
+    }
+  } while (((uint32_t) (millis() - startmS) < acktimeout) || device.receivingDT());
+
+  bitSet(device._ReliableErrors, ReliableACKError);
+  return 0;
+}
+
+
+template <class Radio>
+bool LTReliableCore<Radio>::writeReliablePacket(uint8_t *txbuffer, uint8_t size, uint16_t networkID)
+{
+  //writes the reliable packet to the buffer, payload, sequence number with ReliableSequence, NetworkID and
+  //payload CRC, sets _TXPacketL and _ReliablePayloadCRC, the CRC the ACK has to carry. false if the payload
+  //is too long. A packet with a sequence number is sent with ReliableSequenceID flipped in its NetworkID and
+  //its payload CRC carried on over the sequence number. With NoReliableCRC the packet is told from the last
+  //by a CRC of the payload all the same, but sent with a CRC of 0
+
+  Radio &device = radio();
+  bool sequence = bitRead(device._ReliableConfig, ReliableSequence);
+  uint16_t crc = 0;
+
+  if (!checkReliableID(networkID))
+  {
+    return false;
+  }
+
+  if (size > (sequence ? (255 - ReliableSequenceL) : 251))
+  {
+    bitSet(device._ReliableErrors, ReliableSizeError);
+    return false;
+  }
+
+  device.standbyDT();
+  device._TXPacketL = size + (sequence ? ReliableSequenceL : 4);
+
+  if (!bitRead(device._ReliableConfig, NoReliableCRC) || sequence)
+  {
+    crc = device.CRCCCITT(txbuffer, size, 0xFFFF);
+  }
+
+  if (sequence)
+  {
+    _ReliableSequence = _ReliableSeq.getSequence(networkID, crc);   //the same for a packet sent again
+    crc = LTCRCCCITTByte(crc, _ReliableSequence);
+    networkID = networkID ^ ReliableSequenceID;
+  }
+
+  _ReliablePayloadCRC = bitRead(device._ReliableConfig, NoReliableCRC) ? 0 : crc;
+
+  device.beginWriteDT(0);
+  LTSPIwriteBytes(txbuffer, size);
+
+  if (sequence)
+  {
+    LTSPIwriteBytes(&_ReliableSequence, 1);
+  }
+
+  writeTrailerDT(networkID, _ReliablePayloadCRC);
+  device.endBufferDT();
+  return true;
+}
+
+
+template <class Radio>
+bool LTReliableCore<Radio>::readReliablePacket(uint8_t *rxbuffer, uint8_t size, uint16_t networkID, uint16_t *payloadcrc)
+{
+  //reads the reliable packet received into rxbuffer in one burst and checks its size, CRC and NetworkID, true
+  //if it is OK. payloadcrc is then the CRC for the ACK, 0 with NoReliableCRC.
+
+  //A packet with a sequence number is sent with ReliableSequenceID flipped in its NetworkID, the byte before the
+  //NetworkID is then the sequence number and the payload CRC covers it. With ReliableSequence set the receiver
+  //takes both, a packet from a transmitter without ReliableSequence has the NetworkID as it is and no sequence
+  //number. Without ReliableSequence a packet with a sequence number is a ReliableIDError.
+
+  Radio &device = radio();
+  uint16_t RXnetworkID, RXcrc, crc = 0;
+  uint8_t trailer[ReliableSequenceL], trailerL, payloadL;
+  bool sequenced;
+
+  device.readRXBufferStatusDT();
+
+  if (device._RXPacketL < 4)
+  {
+    bitSet(device._ReliableErrors, ReliableSizeError);
+    return false;
+  }
+
+  RXnetworkID = device.readUint16SXBuffer(device._RXPacketL - 4);
+  sequenced = bitRead(device._ReliableConfig, ReliableSequence) && (device._RXPacketL >= ReliableSequenceL) && (RXnetworkID == (networkID ^ ReliableSequenceID));
+  trailerL = sequenced ? ReliableSequenceL : 4;
+  payloadL = device._RXPacketL - trailerL;
+
+  if (payloadL > size)
+  {
+    bitSet(device._ReliableErrors, ReliableSizeError);
+    return false;
+  }
+
+  device.beginReadDT(0);
+  LTSPIreadBytes(rxbuffer, payloadL);
+  LTSPIreadBytes(trailer, trailerL);                  //sequence number, NetworkID, read already, and payload CRC
+  device.endBufferDT();
+
+  if (!bitRead(device._ReliableConfig, NoReliableCRC))
+  {
+    crc = device.CRCCCITT(rxbuffer, payloadL, 0xFFFF);
+    RXcrc = ((uint16_t) trailer[trailerL - 1] << 8) + trailer[trailerL - 2];
+
+    if (sequenced)
+    {
+      crc = LTCRCCCITTByte(crc, trailer[0]);
+    }
+
+    if (crc != RXcrc)
+    {
+      bitSet(device._ReliableErrors, ReliableCRCError);
+    }
+  }
+
+  if (!sequenced && (RXnetworkID != networkID))
+  {
+    bitSet(device._ReliableErrors, ReliableIDError);
+  }
+
+  _ReliablePayloadL = payloadL;
+  _ReliableSequenced = sequenced;
+  _ReliableSequence = sequenced ? trailer[0] : 0;
+  *payloadcrc = crc;
+  return (device._ReliableErrors == 0);
+}
+
+
+template <class Radio>
+bool LTReliableCore<Radio>::readReliableACK(uint16_t networkID, uint16_t payloadcrc)
+{
+  //true if the packet received is the ACK of the packet sent, its NetworkID and payload CRC at the end,
+  //keeps the RSSI and SNR of an ACK with ReliableACKLink
+
+  Radio &device = radio();
+
+  if (!device.endRXDT())
+  {
+    return false;
+  }
+
+  device.readRXBufferStatusDT();
+
+  if ((device._RXPacketL < 4) || (device.readUint16SXBuffer(device._RXPacketL - 4) != networkID) || (device.readUint16SXBuffer(device._RXPacketL - 2) != payloadcrc))
+  {
+    return false;
+  }
+
+  readACKLink();
+  return true;
+}
+
+
+template <class Radio>
+void LTReliableCore<Radio>::startReliableACK(uint8_t *txbuffer, uint8_t size, uint16_t networkID, uint16_t payloadcrc, int8_t txpower)
+{
+  //writes the ACK, the txbuffer payload then networkID and payloadcrc, and starts sending it
+
+  Radio &device = radio();
+
+  device.standbyDT();
+  device._TXPacketL = size + 4;
+
+  device.beginWriteDT(0);
+  LTSPIwriteBytes(txbuffer, size);
+  writeTrailerDT(networkID, payloadcrc);
+  device.endBufferDT();
+
+  device.startTXDT(device._TXPacketL, txpower, Radio::DTACKTXTimeout);
+}
+
+
+template <class Radio>
+bool LTReliableCore<Radio>::startReliableTX()
+{
+  //loads the reliable packet and starts the transmission, used for the first attempt and for retries
+
+#ifdef LTDEBUGRELIABLE
+  Serial.print(F(" {RELIABLE} startReliableTX() attempt "));
+  Serial.println(_ReliableAttempt + 1);
+#endif
+
+  Radio &device = radio();
+
+  device._ReliableErrors = 0;                         //errors are from the last attempt only, as for transmitReliableAutoACK()
+  _ReliableACKRSSI = 0;
+  _ReliableACKSNR = 0;
+
+  if (!writeReliablePacket(_ReliableBuffer, _ReliableSize, _ReliableNetworkID))
+  {
+    _ReliableState = ReliableFailed;
+    return false;
+  }
+
+  startReliablePreamble();
+  device.startTXDT(device._TXPacketL, _ReliableTXpower, _ReliableTXtimeout);
+
+  _ReliableAttempt++;
+  _ReliableState = ReliableTX;
+  _ReliableStartmS = millis();
+  return true;
+}
+
+
+template <class Radio>
+void LTReliableCore<Radio>::startReliableRX()
+{
+  //receive for startReceiveReliableAutoACK(), and again after a packet ACKed before is ACKed again
+
+  radio().startRXDT(_ReliableTimeout);
+
+  _ReliableState = ReliableRX;
+  _ReliableStartmS = millis();
+}
+
+
+template <class Radio>
+uint8_t LTReliableCore<Radio>::endReliable(uint8_t state)
+{
+  //leaves the device in standby at the end of a non blocking exchange, packet RSSI and SNR are still readable
+
+  radio().standbyDT();
+  _ReliableState = state;
+  return state;
+}
+
+
+template <class Radio>
+void LTReliableCore<Radio>::startReliablePreamble()
+{
+  //switches to the preamble from setReliablePreamble() for the packet about to be sent
+
+  if (_ReliablePreamble && !_SavedPreamble)
+  {
+    _SavedPreamble = radio().readPreambleDT();
+    radio().writePreambleDT(_ReliablePreamble);
+  }
+}
+
+
+template <class Radio>
+void LTReliableCore<Radio>::endReliablePreamble()
+{
+  //the reliable packet has gone, back to the preamble the packet settings had
+
+  if (_SavedPreamble)
+  {
+    radio().writePreambleDT(_SavedPreamble);
+    _SavedPreamble = 0;
+  }
+}
+
+
+template <class Radio>
+bool LTReliableCore<Radio>::checkReliableDuplicate(uint16_t networkID, uint16_t payloadcrc)
+{
+  //sets _ReliableACKData for the ACK of the packet just read, true if the packet has a sequence number and was
+  //ACKed before, it is then ACKed again with the RSSI and SNR it had the first time
+
+  if (_ReliableSequenced && _ReliableSeq.find(networkID, _ReliableSequence, payloadcrc, _ReliableACKData))
+  {
+    _ReliableDuplicates++;
+    bitSet(radio()._ReliableFlags, ReliableDuplicate);
+    return true;
+  }
+
+  _ReliableACKData = getACKLink();
+  return false;
+}
+
+
+template <class Radio>
+bool LTReliableCore<Radio>::checkReliableID(uint16_t networkID)
+{
+  //false, with a ReliableIDError, for a network ID with ReliableSequenceID set. A sequenced packet for node X
+  //goes out as X ^ ReliableSequenceID, so a node with that ID would take it for its own
+
+  if (networkID & ReliableSequenceID)
+  {
+    bitSet(radio()._ReliableErrors, ReliableIDError);
+    return false;
+  }
+
+  return true;
+}
+
+
+template <class Radio>
+uint16_t LTReliableCore<Radio>::getACKLink()
+{
+  //RSSI and SNR of the packet received, for an ACK with ReliableACKLink. The RSSI goes in the low byte as dB
+  //below 0dBm, down to -255dBm, the SNR in the high byte
+
+  int16_t rssi = radio().readPacketRSSI();
+  uint8_t below = (rssi >= 0) ? 0 : ((rssi <= -255) ? 255 : (uint8_t) -rssi);
+
+  return ((uint16_t) ((uint8_t) radio().readPacketSNR()) << 8) + below;
+}
+
+
+template <class Radio>
+void LTReliableCore<Radio>::readACKLink()
+{
+  //keeps the RSSI and SNR from an ACK with ReliableACKLink, 0 if the ACK has none
+
+  Radio &device = radio();
+  uint16_t link;
+
+  if (bitRead(device._ReliableConfig, ReliableACKLink) && (device._RXPacketL == ReliableACKLinkL))
+  {
+    link = device.readUint16SXBuffer(0);
+    _ReliableACKRSSI = -(int16_t) lowByte(link);
+    _ReliableACKSNR = (int8_t) highByte(link);
+  }
+  else
+  {
+    _ReliableACKRSSI = 0;
+    _ReliableACKSNR = 0;
+  }
+}
+
+#endif
+
+/*
+  MIT license
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+  associated documentation files (the "Software"), to deal in the Software without restriction, including
+  without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the
+  following conditions:
+
+  The above copyright notice and this permission notice shall be included in all copies or substantial
+  portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+  LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO
+  EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+  IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE
+  USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
@@ -0,0 +1,148 @@
+/*
+  Licensed under a MIT license displayed at the bottom of this document.
+  Original published 16/10/26, sequence numbers and duplicate detection for reliable packets
+*/
+
+/*
+  With ReliableSequence set in the reliable config a reliable packet carries a sequence number byte
+  between its payload and the NetworkID, payload + sequence + NetworkID + payload CRC. The NetworkID is
+  sent with ReliableSequenceID flipped, which is how the receiver tells it from a packet without, and the
+  payload CRC, echoed in the ACK, covers the sequence number. When an ACK is lost the transmitter sends the
+  packet again, with the same sequence number, and the receiver, which remembers the last packets it
+  ACKed, sends the ACK it sent the first time once more and does not return the packet a second time.
+
+  Transmitter - getSequence() gives the packet the next sequence number, unless it is the packet sent
+                last, same NetworkID and payload CRC, and no ACK for it came. So a caller that sends a
+                packet again after transmitReliableAutoACK() failed, as in a TXattempts loop, sends it
+                with the sequence number it had. One sequence number serves all the links of a node,
+                the receiver keys on the NetworkID too.
+  Receiver    - find() looks for a packet, NetworkID, sequence number and payload CRC, in the Slots
+                packets last ACKed and gives the ACK data, the RSSI and SNR of a ReliableACKLink ACK, it
+                was sent with. add() keeps a packet once its ACK has gone, in place of the oldest.
+
+  A packet is only taken for one received before if all three match, so a new packet is lost only if
+  it has the NetworkID, sequence number and payload CRC of one of the last Slots packets. Each slot
+  takes 8 bytes.
+*/
+
+#ifndef LTReliableSeq_h
+#define LTReliableSeq_h
+
+#include <Arduino.h>
+
+
+template <uint8_t Slots>
+class LTReliableSeq
+{
+  static_assert((Slots > 0) && (Slots <= 64), "Slots must be 1 to 64");
+
+  public:
+
+    LTReliableSeq()
+    {
+      begin();
+    }
+
+    void begin()
+    {
+      //forget the packets sent and received, a begin() of the driver
+
+      _sequence = 0;
+      _networkID = 0;
+      _payloadCRC = 0;
+      _acknowledged = true;
+      _count = 0;
+      _next = 0;
+    }
+
+    uint8_t getSequence(uint16_t networkID, uint16_t payloadcrc)
+    {
+      //sequence number of a packet about to be sent, that of the last packet if this is it sent again
+
+      if (_acknowledged || (networkID != _networkID) || (payloadcrc != _payloadCRC))
+      {
+        _sequence++;
+        _networkID = networkID;
+        _payloadCRC = payloadcrc;
+        _acknowledged = false;
+      }
+
+      return _sequence;
+    }
+
+    void acknowledged()
+    {
+      //the last packet sent was ACKed, the next gets a new sequence number even with the same payload
+
+      _acknowledged = true;
+    }
+
+    bool find(uint16_t networkID, uint8_t sequence, uint16_t payloadcrc, uint16_t &ackdata)
+    {
+      for (uint8_t index = 0; index < _count; index++)
+      {
+        if ((_seen[index].networkID == networkID) && (_seen[index].sequence == sequence) && (_seen[index].payloadCRC == payloadcrc))
+        {
+          ackdata = _seen[index].ackData;
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+    void add(uint16_t networkID, uint8_t sequence, uint16_t payloadcrc, uint16_t ackdata)
+    {
+      _seen[_next].networkID = networkID;
+      _seen[_next].sequence = sequence;
+      _seen[_next].payloadCRC = payloadcrc;
+      _seen[_next].ackData = ackdata;
+
+      _next = (_next + 1) % Slots;
+
+      if (_count < Slots)
+      {
+        _count++;
+      }
+    }
+
+  private:
+
+    struct Seen
+    {
+      uint16_t networkID;
+      uint16_t payloadCRC;
+      uint16_t ackData;                       //RSSI and SNR of a ReliableACKLink ACK
+      uint8_t sequence;
+    };
+
+    Seen _seen[Slots];
+    uint8_t _count;                           //slots in use
+    uint8_t _next;                            //slot the next packet goes in, the oldest once all are in use
+
+    uint8_t _sequence;                        //last sequence number sent
+    uint16_t _networkID;                      //NetworkID and payload CRC of the packet it was sent with
+    uint16_t _payloadCRC;
+    bool _acknowledged;
+};
+
+#endif
+
+/*
+  MIT license
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+  associated documentation files (the "Software"), to deal in the Software without restriction, including
+  without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the
+  following conditions:
+
+  The above copyright notice and this permission notice shall be included in all copies or substantial
+  portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+  LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO
+  EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+  IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE
+  USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
@@ -0,0 +1,83 @@
+/*
+  Licensed under a MIT license displayed at the bottom of this document.
+  Original published 16/10/26, block SPI transfers for the SX12XX-LoRa library
+*/
+
+/*
+  Block transfers used by the SX126X, SX127X and SX128X drivers to move the device FIFO or data buffer,
+  and the data of multi byte commands, while NSS is held low. The caller selects the device and sends the
+  address or opcode, these move the bytes that follow.
+
+  Where the SPI class has writeBytes() and transferBytes(), the ESP32 and ESP8266 cores and the host build
+  in extras/host, a whole packet is handed to the SPI peripheral in one call, which the ESP32 core moves
+  64 bytes at a time through the SPI hardware buffer instead of setting up one transfer per byte. Other
+  cores fall back to one SPI.transfer() per byte, the same as before. Define LTSPI_BYTEWISE before this
+  file is included, or as a build flag, to use the byte loop everywhere.
+
+  LTSPIwriteBytes(buffer, size)   - sends size bytes from buffer, what the device returns is discarded
+  LTSPIreadBytes(buffer, size)    - sends size zero bytes and reads what the device returns into buffer
+*/
+
+#ifndef LTSPI_h
+#define LTSPI_h
+
+#include <Arduino.h>
+#include <SPI.h>
+
+#if !defined(LTSPI_BYTEWISE)
+#if defined(SPI_HAS_TRANSFER_BYTES) || defined(ARDUINO_ARCH_ESP32) || defined(ESP32) || defined(ARDUINO_ARCH_ESP8266)
+#define LTSPI_BLOCK
+#endif
+#endif
+
+
+static inline void LTSPIwriteBytes(const uint8_t *buffer, uint16_t size)
+{
+#if defined(LTSPI_BLOCK)
+  SPI.writeBytes((uint8_t *) buffer, size);   //older ESP8266 cores take a non const pointer
+#else
+  uint16_t index;
+
+  for (index = 0; index < size; index++)
+  {
+    SPI.transfer(buffer[index]);
+  }
+#endif
+}
+
+
+static inline void LTSPIreadBytes(uint8_t *buffer, uint16_t size)
+{
+#if defined(LTSPI_BLOCK)
+  memset(buffer, 0, size);                    //zeros are sent while reading, as the byte loop does
+  SPI.transferBytes(buffer, buffer, size);
+#else
+  uint16_t index;
+
+  for (index = 0; index < size; index++)
+  {
+    buffer[index] = SPI.transfer(0);
+  }
+#endif
+}
+
+#endif
+
+/*
+  MIT license
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+  associated documentation files (the "Software"), to deal in the Software without restriction, including
+  without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the
+  following conditions:
+
+  The above copyright notice and this permission notice shall be included in all copies or substantial
+  portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+  LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO
+  EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+  IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE
+  USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
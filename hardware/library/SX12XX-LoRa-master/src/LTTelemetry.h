@@ -0,0 +1,236 @@
+/*
+  Licensed under a MIT license displayed at the bottom of this document.
+  Original published 16/10/26, compact telemetry frame
+*/
+
+/*
+  A versioned binary frame for the sample a poll produces, sent as the payload of the reliable packet in
+  place of a constant probe string. Byte 0 is the frame version, so a receiver can tell it from an LTADR.h
+  request and from older payloads. Byte 1 is the feature schema of the node, LTFeatures.h, which says
+  which readings follow and how, so a node with another sensor set needs no change at the receiver. The
+  readings are fixed point and the multi byte fields low byte first, the order writeUint16() and
+  writeInt16() put them in the device buffer, so the frame is the same whether built here or streamed with
+  startWriteSXBuffer(). It is built in an array because the non blocking reliable functions send it again
+  from there on each attempt.
+
+  Version 2, LTTelemetryLength(schema) bytes, 11 for LTSchema2S and 12 for LTSchema3S;
+
+  0     version, LTTelemetryVersion
+  1     feature schema, LTSchema2S, LTSchema3S..
+  2-3   node, NetworkID of the wristband the sample is for
+  4     sequence, one more for each new sample of the node, the same on each attempt
+  5     TX power the frame was sent at, dBm
+  6-7   battery, mV, 0 if not measured
+  8-    the sensor features of the schema in its order, each the type and scale of LTFeatureTable,
+        LTFeatureNoReading() if not read. The link features, RSSI and SNR, are not sent.
+
+  A frame of a schema this build does not know is still read, with its readings left as not read.
+
+  With ReliableACKLink set at both ends the ACK carries back the RSSI and SNR the slave received the frame
+  at, readReliableACKRSSI() and readReliableACKSNR(), so one exchange gives the link both ways. The ACK is
+  then ReliableACKLinkL bytes, size the ACK timeout with getTimeOnAiruS(ReliableACKLinkL).
+*/
+
+#ifndef LTTelemetry_h
+#define LTTelemetry_h
+
+#include <Arduino.h>
+#include <LTFeatures.h>
+
+#define LTTelemetryVersion 0x02               //byte 0 of a version 2 frame
+#define LTTelemetryHeaderL 8                  //bytes before the readings
+#define LTTelemetryMaxL (LTTelemetryHeaderL + LTSchemaMaxFrameBytes)   //longest frame, for buffers
+
+
+constexpr uint8_t LTTelemetryLength(uint8_t schema)
+{
+  return LTTelemetryHeaderL + LTSchemaFrameBytes(schema);
+}
+
+
+struct LTTelemetryFrame
+{
+  uint8_t schema;
+  uint16_t node;
+  uint8_t sequence;
+  int8_t txpower;                             //dBm
+  uint16_t battery;                           //mV
+  int32_t values[LTFeatureCount];             //fixed point readings, by feature id - 1
+};
+
+
+class LTTelemetry
+{
+  public:
+
+    static void clear(LTTelemetryFrame &frame, uint8_t schema)
+    {
+      //a frame of the schema with no readings
+      uint8_t id;
+
+      frame.schema = schema;
+      frame.node = 0;
+      frame.sequence = 0;
+      frame.txpower = 0;
+      frame.battery = 0;
+
+      for (id = 1; id <= LTFeatureCount; id++)
+      {
+        frame.values[id - 1] = LTFeatureNoReading(id);
+      }
+    }
+
+    static uint8_t build(uint8_t *buff, const LTTelemetryFrame &frame)
+    {
+      //payload of the reliable packet, returns its length, 0 if the schema is not known
+      uint8_t index, id, length = LTTelemetryHeaderL;
+      int32_t value;
+
+      if (!LTSchemaValid(frame.schema))
+      {
+        return 0;
+      }
+
+      buff[0] = LTTelemetryVersion;
+      buff[1] = frame.schema;
+      buff[2] = lowByte(frame.node);
+      buff[3] = highByte(frame.node);
+      buff[4] = frame.sequence;
+      buff[5] = (uint8_t) frame.txpower;
+      buff[6] = lowByte(frame.battery);
+      buff[7] = highByte(frame.battery);
+
+      for (index = 0; index < LTSchemaFeatures(frame.schema); index++)
+      {
+        id = LTSchemaFeature(frame.schema, index);
+
+        if (LTFeatureTable[id - 1].link)
+        {
+          continue;
+        }
+
+        value = frame.values[id - 1];
+        buff[length++] = (uint8_t) value;
+
+        if (LTFeatureBytes(id) == 2)
+        {
+          buff[length++] = (uint8_t) (value >> 8);
+        }
+      }
+
+      return length;
+    }
+
+    static bool read(const uint8_t *buff, uint8_t size, LTTelemetryFrame &frame)
+    {
+      //true if the payload received is a version 2 frame
+      uint8_t index, id, length = LTTelemetryHeaderL;
+      uint16_t raw;
+
+      if ((size < LTTelemetryHeaderL) || (buff[0] != LTTelemetryVersion))
+      {
+        return false;
+      }
+
+      clear(frame, buff[1]);
+      frame.node = ((uint16_t) buff[3] << 8) + buff[2];
+      frame.sequence = buff[4];
+      frame.txpower = (int8_t) buff[5];
+      frame.battery = ((uint16_t) buff[7] << 8) + buff[6];
+
+      if (!LTSchemaValid(frame.schema))
+      {
+        return true;                          //header only, readings not known
+      }
+
+      if (size != LTTelemetryLength(frame.schema))
+      {
+        return false;
+      }
+
+      for (index = 0; index < LTSchemaFeatures(frame.schema); index++)
+      {
+        id = LTSchemaFeature(frame.schema, index);
+
+        if (LTFeatureTable[id - 1].link)
+        {
+          continue;
+        }
+
+        raw = buff[length++];
+
+        if (LTFeatureBytes(id) == 2)
+        {
+          raw += (uint16_t) buff[length++] << 8;
+        }
+
+        switch (LTFeatureTable[id - 1].type)
+        {
+          case LTFeatureInt8: frame.values[id - 1] = (int8_t) raw; break;
+          case LTFeatureInt16: frame.values[id - 1] = (int16_t) raw; break;
+          default: frame.values[id - 1] = raw; break;
+        }
+      }
+
+      return true;
+    }
+
+    static int32_t toFixed(uint8_t id, float reading)
+    {
+      //reading times the scale of the feature, NAN and readings out of range of its type as not read
+      int32_t lowest, highest;
+      float scaled = roundf(reading * LTFeatureTable[id - 1].scale);
+
+      switch (LTFeatureTable[id - 1].type)
+      {
+        case LTFeatureInt8: lowest = -127; highest = 127; break;
+        case LTFeatureUint8: lowest = 0; highest = 254; break;
+        case LTFeatureInt16: lowest = -32767; highest = 32767; break;
+        default: lowest = 0; highest = 65534; break;
+      }
+
+      if (isnan(scaled) || (scaled < lowest) || (scaled > highest))
+      {
+        return LTFeatureNoReading(id);
+      }
+
+      return (int32_t) scaled;
+    }
+
+    static float fromFixed(uint8_t id, int32_t value)
+    {
+      return (value == LTFeatureNoReading(id)) ? NAN : ((float) value / LTFeatureTable[id - 1].scale);
+    }
+
+    static void setReading(LTTelemetryFrame &frame, uint8_t id, float reading)
+    {
+      frame.values[id - 1] = toFixed(id, reading);
+    }
+
+    static float getReading(const LTTelemetryFrame &frame, uint8_t id)
+    {
+      //the reading of a feature, NAN if not read or not in the schema of the frame
+      return fromFixed(id, frame.values[id - 1]);
+    }
+};
+
+#endif
+
+/*
+  MIT license
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+  associated documentation files (the "Software"), to deal in the Software without restriction, including
+  without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the
+  following conditions:
+
+  The above copyright notice and this permission notice shall be included in all copies or substantial
+  portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+  LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO
+  EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+  IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE
+  USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
@@ -35,6 +35,9 @@ const char AFC = 'a';                   //Packet sent for AFC purposes
 #define DTSegmentWriteACK 0xA1             //packet type for segment write ACK
 #define DTSegmentWriteNACK 0xA2            //packet type for segment write NACK
 #define DTSegmentWriteHeaderL 6
+#define DTSegmentWindowACK 0xA3            //packet type for bitmap ACK of a window of segment writes
+#define DTSegmentWindowACKHeaderL 10
+#define DTSegmentRepair 0xC0               //packet types 0xC0 to 0xC7, repair segment 0 to 7 of a group of segment writes
 
 #define DTFileOpen 0xA4                    //packet type for file open, filename
 #define DTFileOpenACK 0xA5                 //packet type for file open, filename ACK
@@ -41,6 +41,7 @@
 
 #include <arrayRW.h>
 //#define DEBUG                              //enable this define to print additional debug info for segment transfers
+//#define ENABLEREADBACKCRC                  //enable this define to CRC a received file by reading it back from SD
 
 uint8_t SDRXPacketL;                         //length of received packet
 uint8_t SDRXPacketType;                      //type of received packet, segment write, ACK, NACK etc
@@ -1086,6 +1087,8 @@ bool SDprocessSegmentWrite()
 
   if (SDDTSegment == SDDTSegmentNext)
   {
+    uint32_t segmentmS = millis();
+
     DTSD_writeSegmentFile(SDDTdata, SDRXDataarrayL);
 
 #ifdef ENABLEMONITOR
@@ -1102,7 +1105,14 @@ bool SDprocessSegmentWrite()
 #endif
 #endif
     SDDTheader[0] = DTSegmentWriteACK;
-    delay(ACKdelaymS);
+    DTSD_writePending();                            //a full sector goes to the card in the ACK delay
+
+    segmentmS = millis() - segmentmS;
+
+    if (segmentmS < ACKdelaymS)
+    {
+      delay(ACKdelaymS - segmentmS);
+    }
 
     if (SDDTLED >= 0)
     {
@@ -1307,7 +1317,11 @@ bool SDprocessFileClose()
       SDDTDestinationFileLength = DTSD_openFileRead(SDDTfilenamebuff);
 
 #ifdef ENABLEFILECRC
-      SDDTDestinationFileCRC = DTSD_fileCRCCCITT(SDDTDestinationFileLength);
+#ifdef ENABLEREADBACKCRC
+      SDDTDestinationFileCRC = DTSD_fileCRCCCITT(SDDTDestinationFileLength);  //read the file back from the card
+#else
+      SDDTDestinationFileCRC = DTSD_getWriteCRC(SDDTDestinationFileLength);   //CRC of the segments as written
+#endif
 #endif
 
       beginarrayRW(SDDTheader, 4);                       //start writing to array at location 12
@@ -12,10 +12,15 @@
 
 
 #include <SX126XLT.h>
+#include <LTCRC.h>
 #include <SPI.h>
+#include <LTSPI.h>
+#include <LTAirtime.h>
 
 #define LTUNUSED(v) (void) (v)       //add LTUNUSED(variable); to avoid compiler warnings 
 #define USE_SPI_TRANSACTION
+#define USE_BUSY_MICROS              //wait for BUSY in uS and before each command only, not in 1mS steps after each
+#define BUSY_TIMEOUT_US 10000        //BUSY high for longer than this resets the device
 
 //#define DEBUGBUSY                  //comment out if you do not want a busy timeout message
 //#define SX126XDEBUG                //enable debug messages
@@ -24,9 +29,23 @@
 //#define DEBUGFSKRTTY               //enable for FSKRTTY debugging
 
 
+static volatile bool SX126XBusyFell;    //set by the BUSY falling edge interrupt
+
+
+static void SX126XBusyISR()
+{
+  SX126XBusyFell = true;
+}
+
+
 SX126XLT::SX126XLT()
 {
   //Anything you need when instantiating your object goes here
+  _LastOpcode = 0;
+  _BusyInterrupt = false;
+  _Queueing = false;
+  _Queued = 0;
+  resetBusyStats();
 }
 
 /* Formats for :begin
@@ -56,6 +75,7 @@ bool SX126XLT::begin(int8_t pinNSS, int8_t pinNRESET, int8_t pinRFBUSY, int8_t p
 
   _TXDonePin = pinDIO1;        //this is defalt pin for sensing TX done
   _RXDonePin = pinDIO1;        //this is defalt pin for sensing RX done
+  beginReliable();             //no reliable exchange in progress, sequence numbers start again
 
   pinMode(_NSS, OUTPUT);
   digitalWrite(_NSS, HIGH);
@@ -155,6 +175,7 @@ bool SX126XLT::begin(int8_t pinNSS, int8_t pinNRESET, int8_t pinRFBUSY, int8_t p
 
   _TXDonePin = pinDIO1;        //this is defalt pin for sensing TX done
   _RXDonePin = pinDIO1;        //this is defalt pin for sensing RX done
+  beginReliable();             //no reliable exchange in progress, sequence numbers start again
 
   pinMode(_NSS, OUTPUT);
   digitalWrite(_NSS, HIGH);
@@ -228,6 +249,7 @@ bool SX126XLT::begin(int8_t pinNSS, int8_t pinNRESET, int8_t pinRFBUSY, int8_t p
 
   _TXDonePin = pinDIO1;        //this is defalt pin for sensing TX done
   _RXDonePin = pinDIO1;        //this is defalt pin for sensing RX done
+  beginReliable();             //no reliable exchange in progress, sequence numbers start again
 
   pinMode(_NSS, OUTPUT);
   digitalWrite(_NSS, HIGH);
@@ -306,6 +328,7 @@ bool SX126XLT::begin(int8_t pinNSS, int8_t pinNRESET, int8_t pinRFBUSY, int8_t p
 
   _TXDonePin = pinDIO1;        //this is defalt pin for sensing TX done
   _RXDonePin = pinDIO1;        //this is defalt pin for sensing RX done
+  beginReliable();             //no reliable exchange in progress, sequence numbers start again
 
   pinMode(_NSS, OUTPUT);
   digitalWrite(_NSS, HIGH);
@@ -394,6 +417,7 @@ bool SX126XLT::begin(int8_t pinNSS, int8_t pinNRESET, int8_t pinRFBUSY, uint8_t
 
   _TXDonePin = -1;
   _RXDonePin = -1;
+  beginReliable();             //no reliable exchange in progress, sequence numbers start again
 
   pinMode(_NSS, OUTPUT);
   digitalWrite(_NSS, HIGH);
@@ -449,6 +473,59 @@ void SX126XLT::checkBusy()
   //Serial.println(F("checkBusy()"));
 #endif
 
+  //every access to the device starts here, so commands held by beginCommandQueue() go first
+
+  if (_Queued)
+  {
+    sendCommandQueue();
+  }
+
+  waitBusy();
+}
+
+
+void SX126XLT::waitBusy()
+{
+#ifdef USE_BUSY_MICROS
+  //BUSY goes high at the end of each command for as long as the device takes over it, from a few uS to
+  //3.5mS for a calibration. The wait is counted against the command sent last.
+
+  uint32_t startuS, waituS = 0;
+
+  if (digitalRead(_RFBUSY))
+  {
+    startuS = micros();
+
+    while (_BusyInterrupt ? !SX126XBusyFell : digitalRead(_RFBUSY))
+    {
+      if ((micros() - startuS) > BUSY_TIMEOUT_US)
+      {
+        //the device is set back to the saved settings, of limited benefit since you cannot know at
+        //which stage of the operation the timeout occurs
+#ifdef DEBUGBUSY
+        Serial.println(F("ERROR - Busy Timeout!"));
+#endif
+        _BusyTimeouts++;
+        _LastOpcode = 0;
+        resetDevice();          //reset device
+        setMode(MODE_STDBY_RC);
+        config();               //re-run saved config
+        return;
+      }
+
+      if (_BusyInterrupt)
+      {
+        yield();
+      }
+    }
+
+    waituS = micros() - startuS;
+  }
+
+  SX126XBusyFell = false;                    //the next falling edge is the end of the next command
+  addBusyStat(_LastOpcode, waituS);
+  _LastOpcode = 0;                           //accesses that do not set it are counted as 0
+#else
   uint8_t busy_timeout_cnt;
   busy_timeout_cnt = 0;
 
@@ -468,12 +545,138 @@ void SX126XLT::checkBusy()
 #ifdef DEBUGBUSY
       Serial.println(F("ERROR - Busy Timeout!"));
 #endif
+      _BusyTimeouts++;
       resetDevice();          //reset device
       setMode(MODE_STDBY_RC);
       config();               //re-run saved config
       break;
     }
   }
+#endif
+}
+
+
+void SX126XLT::setBusyInterrupt(bool enable)
+{
+  //wait for BUSY with an interrupt on its falling edge, yield() is called while waiting so other tasks
+  //can run, the BUSY pin must be able to take an interrupt
+
+  if (enable && !_BusyInterrupt)
+  {
+    SX126XBusyFell = false;
+    attachInterrupt(digitalPinToInterrupt(_RFBUSY), SX126XBusyISR, FALLING);
+  }
+
+  if (!enable && _BusyInterrupt)
+  {
+    detachInterrupt(digitalPinToInterrupt(_RFBUSY));
+  }
+
+  _BusyInterrupt = enable;
+}
+
+
+void SX126XLT::beginCommandQueue()
+{
+  //configuration commands are held until endCommandQueue() or the next other access to the device, a
+  //command repeated with nothing queued in between replaces the one queued, only the last is sent
+
+  _Queueing = true;
+}
+
+
+void SX126XLT::endCommandQueue()
+{
+  _Queueing = false;
+
+  if (_Queued)
+  {
+    sendCommandQueue();
+  }
+}
+
+
+uint8_t SX126XLT::getBusyStats(SX126XBusyStat *stats, uint8_t size)
+{
+  //copies the BUSY wait counters of each command into stats, returns the number of commands
+
+  uint8_t index;
+
+  for (index = 0; (index < SX126XBusyStatsSize) && (index < size) && (_BusyStats[index].count > 0); index++)
+  {
+    stats[index] = _BusyStats[index];
+  }
+
+  return index;
+}
+
+
+void SX126XLT::resetBusyStats()
+{
+  memset(_BusyStats, 0, sizeof(_BusyStats));
+  _BusyTimeouts = 0;
+}
+
+
+uint16_t SX126XLT::getBusyTimeouts()
+{
+  return _BusyTimeouts;
+}
+
+
+void SX126XLT::addBusyStat(uint8_t opcode, uint32_t waituS)
+{
+  uint8_t index;
+
+  for (index = 0; index < SX126XBusyStatsSize; index++)
+  {
+    if ((_BusyStats[index].count == 0) || (_BusyStats[index].opcode == opcode))
+    {
+      break;
+    }
+  }
+
+  if ((index == SX126XBusyStatsSize) || (_BusyStats[index].count == 0xFFFF))
+  {
+    return;                                  //table full or count at its limit
+  }
+
+  _BusyStats[index].opcode = opcode;
+  _BusyStats[index].count++;
+  _BusyStats[index].waituS += waituS;
+
+  if (waituS > _BusyStats[index].maxuS)
+  {
+    _BusyStats[index].maxuS = (waituS > 0xFFFF) ? 0xFFFF : waituS;
+  }
+}
+
+
+bool SX126XLT::isQueuedCommand(uint8_t Opcode)
+{
+  //commands that only set a configuration, so the last of several sent in a row is all that matters
+
+  switch (Opcode)
+  {
+    case RADIO_SET_PACKETTYPE:
+    case RADIO_SET_RFFREQUENCY:
+    case RADIO_SET_TXPARAMS:
+    case RADIO_SET_PACONFIG:
+    case RADIO_SET_CADPARAMS:
+    case RADIO_SET_BUFFERBASEADDRESS:
+    case RADIO_SET_MODULATIONPARAMS:
+    case RADIO_SET_PACKETPARAMS:
+    case RADIO_CFG_DIOIRQ:
+    case RADIO_SET_REGULATORMODE:
+    case RADIO_SET_TCXOMODE:
+    case RADIO_SET_RFSWITCHMODE:
+    case RADIO_SET_STOPRXTIMERONPREAMBLE:
+    case RADIO_SET_LORASYMBTIMEOUT:
+      return true;
+
+    default:
+      return false;
+  }
 }
 
 
@@ -483,8 +686,53 @@ void SX126XLT::writeCommand(uint8_t Opcode, uint8_t *buffer, uint16_t size)
   //Serial.println(F("writeCommand()"));
 #endif
 
-  uint8_t index;
+  if (_Queueing && (size <= SX126XQueueBytes) && isQueuedCommand(Opcode))
+  {
+    if ((_Queued == 0) || (_QueueOpcode[_Queued - 1] != Opcode))
+    {
+      if (_Queued == SX126XQueueSize)
+      {
+        sendCommandQueue();
+      }
+
+      _Queued++;
+    }
+
+    _QueueOpcode[_Queued - 1] = Opcode;
+    _QueueSize[_Queued - 1] = size;
+    memcpy(_QueueData[_Queued - 1], buffer, size);
+    return;
+  }
+
   checkBusy();
+  sendCommand(Opcode, buffer, size);
+
+#ifndef USE_BUSY_MICROS
+  if (Opcode != RADIO_SET_SLEEP)
+  {
+    checkBusy();
+  }
+#endif
+}
+
+
+void SX126XLT::sendCommandQueue()
+{
+  uint8_t index, queued = _Queued;
+
+  _Queued = 0;
+
+  for (index = 0; index < queued; index++)
+  {
+    waitBusy();
+    sendCommand(_QueueOpcode[index], _QueueData[index], _QueueSize[index]);
+  }
+}
+
+
+void SX126XLT::sendCommand(uint8_t Opcode, uint8_t *buffer, uint16_t size)
+{
+  //the command only, BUSY must already be low
 
 #ifdef USE_SPI_TRANSACTION     //to use SPI_TRANSACTION enable define at beginning of CPP file 
   SPI.beginTransaction(SPISettings(LTspeedMaximum, LTdataOrder, LTdataMode));
@@ -493,20 +741,14 @@ void SX126XLT::writeCommand(uint8_t Opcode, uint8_t *buffer, uint16_t size)
   digitalWrite(_NSS, LOW);
   SPI.transfer(Opcode);
 
-  for (index = 0; index < size; index++)
-  {
-    SPI.transfer(buffer[index]);
-  }
+  LTSPIwriteBytes(buffer, size);
   digitalWrite(_NSS, HIGH);
 
 #ifdef USE_SPI_TRANSACTION
   SPI.endTransaction();
 #endif
 
-  if (Opcode != RADIO_SET_SLEEP)
-  {
-    checkBusy();
-  }
+  _LastOpcode = Opcode;
 }
 
 
@@ -516,8 +758,8 @@ void SX126XLT::readCommand(uint8_t Opcode, uint8_t *buffer, uint16_t size)
   //Serial.println(F("readCommand()"));
 #endif
 
-  uint8_t i;
   checkBusy();
+  _LastOpcode = Opcode;
 
 #ifdef USE_SPI_TRANSACTION     //to use SPI_TRANSACTION enable define at beginning of CPP file 
   SPI.beginTransaction(SPISettings(LTspeedMaximum, LTdataOrder, LTdataMode));
@@ -527,11 +769,7 @@ void SX126XLT::readCommand(uint8_t Opcode, uint8_t *buffer, uint16_t size)
   SPI.transfer(Opcode);
   SPI.transfer(0xFF);
 
-  for ( i = 0; i < size; i++ )
-  {
-
-    *(buffer + i) = SPI.transfer(0xFF);
-  }
+  LTSPIreadBytes(buffer, size);
   digitalWrite(_NSS, HIGH);
 
 #ifdef USE_SPI_TRANSACTION
@@ -547,11 +785,11 @@ void SX126XLT::writeRegisters(uint16_t address, uint8_t *buffer, uint16_t size)
   //Serial.println(F("writeRegisters()"));
 #endif
   uint8_t addr_l, addr_h;
-  uint8_t i;
 
   addr_l = address & 0xff;
   addr_h = address >> 8;
   checkBusy();
+  _LastOpcode = RADIO_WRITE_REGISTER;
 
 #ifdef USE_SPI_TRANSACTION     //to use SPI_TRANSACTION enable define at beginning of CPP file 
   SPI.beginTransaction(SPISettings(LTspeedMaximum, LTdataOrder, LTdataMode));
@@ -562,10 +800,7 @@ void SX126XLT::writeRegisters(uint16_t address, uint8_t *buffer, uint16_t size)
   SPI.transfer(addr_h);   //MSB
   SPI.transfer(addr_l);   //LSB
 
-  for (i = 0; i < size; i++)
-  {
-    SPI.transfer(buffer[i]);
-  }
+  LTSPIwriteBytes(buffer, size);
 
   digitalWrite(_NSS, HIGH);
 
@@ -590,12 +825,12 @@ void SX126XLT::readRegisters(uint16_t address, uint8_t *buffer, uint16_t size)
   //Serial.println(F("readRegisters()"));
 #endif
 
-  uint16_t index;
   uint8_t addr_l, addr_h;
 
   addr_h = address >> 8;
   addr_l = address & 0x00FF;
   checkBusy();
+  _LastOpcode = RADIO_READ_REGISTER;
 
 #ifdef USE_SPI_TRANSACTION     //to use SPI_TRANSACTION enable define at beginning of CPP file 
   SPI.beginTransaction(SPISettings(LTspeedMaximum, LTdataOrder, LTdataMode));
@@ -606,10 +841,7 @@ void SX126XLT::readRegisters(uint16_t address, uint8_t *buffer, uint16_t size)
   SPI.transfer(addr_h);               //MSB
   SPI.transfer(addr_l);               //LSB
   SPI.transfer(0xFF);
-  for (index = 0; index < size; index++)
-  {
-    *(buffer + index) = SPI.transfer(0xFF);
-  }
+  LTSPIreadBytes(buffer, size);
 
   digitalWrite(_NSS, HIGH);
 
@@ -695,6 +927,51 @@ void SX126XLT::setupLoRa(uint32_t frequency, int32_t offset, uint8_t modParam1,
 }
 
 
+void SX126XLT::applyConfig(const LTSX126XConfig &config)
+{
+  //the commands of setupLoRa() with the frequency, image calibration and modulation parameters worked out
+  //by LTLoRaConfig.h, no double or float arithmetic
+
+#ifdef SX126XDEBUG
+  Serial.println(F("applyConfig()"));
+#endif
+  uint8_t buffer[4];
+
+  setMode(MODE_STDBY_RC);
+  setRegulatorMode(USE_DCDC);
+  setPaConfig(0x04, PAAUTO, _Device);
+  setDIO3AsTCXOCtrl(TCXO_CTRL_3_3V);
+  calibrateDevice(ALLDevices);
+  memcpy(buffer, config.calibrateImage, 2);
+  writeCommand(RADIO_CALIBRATEIMAGE, buffer, 2);
+  setDIO2AsRfSwitchCtrl();
+  setPacketType(PACKET_TYPE_LORA);
+
+  savedFrequency = config.frequency;
+  savedOffset = config.offset;
+  savedFrequencyReg = ((uint32_t) config.frf[0] << 24) + ((uint32_t) config.frf[1] << 16) + ((uint32_t) config.frf[2] << 8) + config.frf[3];
+  _freqregH = config.frf[0];
+  _freqregMH = config.frf[1];
+  _freqregML = config.frf[2];
+  _freqregL = config.frf[3];
+  memcpy(buffer, config.frf, 4);
+  writeCommand(RADIO_SET_RFFREQUENCY, buffer, 4);
+
+  savedModParam1 = config.modulation[0];
+  savedModParam2 = config.modulation[1];
+  savedModParam3 = config.modulation[2];
+  savedModParam4 = config.modulation[3];
+  memcpy(buffer, config.modulation, 4);
+  writeCommand(RADIO_SET_MODULATIONPARAMS, buffer, 4);
+
+  setBufferBaseAddress(0, 0);
+  setPacketParams(8, LORA_PACKET_VARIABLE_LENGTH, 255, LORA_CRC_ON, LORA_IQ_NORMAL);
+  setDioIrqParams(IRQ_RADIO_ALL, (IRQ_TX_DONE + IRQ_RX_TX_TIMEOUT), 0, 0);
+  setHighSensitivity();
+  setSyncWord(LORA_MAC_PRIVATE_SYNCWORD);
+}
+
+
 void SX126XLT::setMode(uint8_t modeconfig)
 {
 #ifdef SX126XDEBUG
@@ -716,6 +993,7 @@ void SX126XLT::setMode(uint8_t modeconfig)
   SPI.endTransaction();
 #endif
 
+  _LastOpcode = RADIO_SET_STANDBY;
   _OperatingMode = modeconfig;
 }
 
@@ -799,7 +1077,9 @@ void SX126XLT::calibrateDevice(uint8_t devices)
 #endif
 
   writeCommand(RADIO_CALIBRATE, &devices, 1);
+#ifndef USE_BUSY_MICROS
   delay(5);                              //calibration time for all devices is 3.5mS, SX126x
+#endif                                   //else BUSY is high until it is done, the next command waits
 
 }
 
@@ -996,6 +1276,20 @@ float SX126XLT::calcSymbolTime(float Bandwidth, uint8_t SpreadingFactor)
 }
 
 
+uint32_t SX126XLT::getTimeOnAiruS(uint8_t packetL)
+{
+  //time on air in uS of a LoRa packet of packetL bytes with the current settings, see LTAirtime.h
+
+#ifdef SX126XDEBUG
+  Serial.println(F("getTimeOnAiruS()"));
+#endif
+
+  return LTAirtimeuS(returnBandwidth(savedModParam2), savedModParam1, savedModParam3 + 4, savedPacketParam1, packetL,
+                     (savedPacketParam4 == LORA_CRC_ON), (savedPacketParam2 == LORA_PACKET_FIXED_LENGTH), (savedModParam4 == LDRO_ON),
+                     (savedModParam1 < LORA_SF7));
+}
+
+
 void SX126XLT::setBufferBaseAddress(uint8_t txBaseAddress, uint8_t rxBaseAddress)
 {
 #ifdef SX126XDEBUG
@@ -1362,25 +1656,7 @@ uint16_t SX126XLT::CRCCCITT(uint8_t *buffer, uint32_t size, uint16_t start)
   Serial.println(F("CRCCCITT()"));
 #endif
 
-  uint32_t index;
-  uint16_t libraryCRC;
-  uint8_t j;
-
-  libraryCRC = start;                                  //start value for CRC16
-
-  for (index = 0; index < size; index++)
-  {
-    libraryCRC ^= (((uint16_t)buffer[index]) << 8);
-    for (j = 0; j < 8; j++)
-    {
-      if (libraryCRC & 0x8000)
-        libraryCRC = (libraryCRC << 1) ^ 0x1021;
-      else
-        libraryCRC <<= 1;
-    }
-  }
-
-  return libraryCRC;
+  return LTCRCCCITTUpdate(start, buffer, size);                 //table driven CRC16, see LTCRC.h
 }
 
 
@@ -1389,8 +1665,6 @@ uint8_t SX126XLT::transmit(uint8_t *txbuffer, uint8_t size, uint32_t txtimeout,
 #ifdef SX126XDEBUG
   Serial.println(F("transmit()"));
 #endif
-  uint8_t index;
-  uint8_t bufferdata;
 
   if (size == 0)
   {
@@ -1410,11 +1684,7 @@ uint8_t SX126XLT::transmit(uint8_t *txbuffer, uint8_t size, uint32_t txtimeout,
   SPI.transfer(RADIO_WRITE_BUFFER);
   SPI.transfer(0);
 
-  for (index = 0; index < size; index++)
-  {
-    bufferdata = txbuffer[index];
-    SPI.transfer(bufferdata);
-  }
+  LTSPIwriteBytes(txbuffer, size);
 
   digitalWrite(_NSS, HIGH);
 
@@ -1452,8 +1722,6 @@ uint8_t SX126XLT::transmitIRQ(uint8_t *txbuffer, uint8_t size, uint16_t timeout,
 #ifdef SX126XDEBUG
   Serial.println(F("transmitIRQ()"));
 #endif
-  uint8_t index;
-  uint8_t bufferdata;
 
   if (size == 0)
   {
@@ -1471,11 +1739,7 @@ uint8_t SX126XLT::transmitIRQ(uint8_t *txbuffer, uint8_t size, uint16_t timeout,
   SPI.transfer(RADIO_WRITE_BUFFER);
   SPI.transfer(0);
 
-  for (index = 0; index < size; index++)
-  {
-    bufferdata = txbuffer[index];
-    SPI.transfer(bufferdata);
-  }
+  LTSPIwriteBytes(txbuffer, size);
 
   digitalWrite(_NSS, HIGH);
 
@@ -1762,7 +2026,7 @@ uint8_t SX126XLT::receive(uint8_t *rxbuffer, uint8_t size, uint32_t rxtimeout, u
   Serial.println(F("receive()"));
 #endif
 
-  uint8_t index, RXstart, RXend;
+  uint8_t RXstart;
   uint16_t regdata;
   uint8_t buffer[2];
 
@@ -1796,7 +2060,6 @@ uint8_t SX126XLT::receive(uint8_t *rxbuffer, uint8_t size, uint32_t rxtimeout, u
 
   RXstart = buffer[1];
 
-  RXend = RXstart + _RXPacketL;
 
   checkBusy();
 
@@ -1809,11 +2072,7 @@ uint8_t SX126XLT::receive(uint8_t *rxbuffer, uint8_t size, uint32_t rxtimeout, u
   SPI.transfer(RXstart);
   SPI.transfer(0xFF);
 
-  for (index = RXstart; index < RXend; index++)
-  {
-    regdata = SPI.transfer(0);
-    rxbuffer[index] = regdata;
-  }
+  LTSPIreadBytes(rxbuffer, _RXPacketL);
 
   digitalWrite(_NSS, HIGH);
 
@@ -1831,8 +2090,7 @@ uint8_t SX126XLT::receiveIRQ(uint8_t *rxbuffer, uint8_t size, uint16_t timeout,
   Serial.println(F("receiveIRQ()"));
 #endif
 
-  uint8_t index, RXstart, RXend;
-  uint16_t regdata;
+  uint8_t RXstart;
   uint8_t buffer[2];
 
   setRx(timeout);
@@ -1861,7 +2119,6 @@ uint8_t SX126XLT::receiveIRQ(uint8_t *rxbuffer, uint8_t size, uint16_t timeout,
   }
 
   RXstart = buffer[1];
-  RXend = RXstart + _RXPacketL;
 
   checkBusy();
 
@@ -1874,11 +2131,7 @@ uint8_t SX126XLT::receiveIRQ(uint8_t *rxbuffer, uint8_t size, uint16_t timeout,
   SPI.transfer(RXstart);
   SPI.transfer(0xFF);
 
-  for (index = RXstart; index < RXend; index++)
-  {
-    regdata = SPI.transfer(0);
-    rxbuffer[index] = regdata;
-  }
+  LTSPIreadBytes(rxbuffer, _RXPacketL);
 
   digitalWrite(_NSS, HIGH);
 
@@ -2345,17 +2598,12 @@ void SX126XLT::writeBuffer(uint8_t *txbuffer, uint8_t size)
   Serial.println(F("writeBuffer()"));
 #endif
 
-  uint8_t index, regdata;
 
   _TXPacketL = _TXPacketL + size;      //these are the number of bytes that will be added
 
   size--;                              //loose one byte from size, the last byte written MUST be a 0
 
-  for (index = 0; index < size; index++)
-  {
-    regdata = txbuffer[index];
-    SPI.transfer(regdata);
-  }
+  LTSPIwriteBytes(txbuffer, size);
 
   SPI.transfer(0);                     //this ensures last byte of buffer written really is a null (0)
 
@@ -2368,17 +2616,12 @@ void SX126XLT::writeBufferChar(char *txbuffer, uint8_t size)
   Serial.println(F("writeBuffer()"));
 #endif
 
-  uint8_t index, regdata;
 
   _TXPacketL = _TXPacketL + size;      //these are the number of bytes that will be added
 
   size--;                              //loose one byte from size, the last byte written MUST be a 0
 
-  for (index = 0; index < size; index++)
-  {
-    regdata = txbuffer[index];
-    SPI.transfer(regdata);
-  }
+  LTSPIwriteBytes((uint8_t *) txbuffer, size);
 
   SPI.transfer(0);                     //this ensures last byte of buffer written really is a null (0)
 
@@ -2478,23 +2721,22 @@ uint16_t SX126XLT::CRCCCITTSX(uint8_t startadd, uint8_t endadd, uint16_t startva
 #endif
 
 
-  uint16_t index, libraryCRC;
-  uint8_t j;
+  uint16_t remaining, libraryCRC;
+  uint8_t buff[32], length;
 
   libraryCRC = startvalue;               //start value for CRC16
 
   startReadSXBuffer(startadd);           //begin the buffer read
 
-  for (index = startadd; index <= endadd; index++)
+  remaining = (endadd >= startadd) ? (endadd - startadd + 1) : 0;
+
+  while (remaining > 0)                             //a block of the buffer at a time
   {
-    libraryCRC ^= (((uint16_t) readUint8() ) << 8);
-    for (j = 0; j < 8; j++)
-    {
-      if (libraryCRC & 0x8000)
-        libraryCRC = (libraryCRC << 1) ^ 0x1021;
-      else
-        libraryCRC <<= 1;
-    }
+    length = (remaining < sizeof(buff)) ? remaining : sizeof(buff);
+    LTSPIreadBytes(buff, length);
+    libraryCRC = LTCRCCCITTUpdate(libraryCRC, buff, length);
+    _RXPacketL = _RXPacketL + length;                 //count of bytes read, as readUint8() keeps it
+    remaining = remaining - length;
   }
 
   endReadSXBuffer();                    //end the buffer read
@@ -2655,6 +2897,8 @@ void SX126XLT::toneFM(uint16_t frequency, uint32_t length, uint32_t deviation, f
   setTxParams(txpower, RADIO_RAMP_200_US);
   setTXDirect();
 
+  checkBusy();
+
 #ifdef USE_SPI_TRANSACTION     //to use SPI_TRANSACTION enable define at beginning of CPP file 
   SPI.beginTransaction(SPISettings(LTspeedMaximum, LTdataOrder, LTdataMode));
 #endif
@@ -2708,6 +2952,8 @@ uint8_t SX126XLT::getByteSXBuffer(uint8_t addr)
   uint8_t regdata;
   setMode(MODE_STDBY_RC);                     //this is needed to ensure we can read from buffer OK.
 
+  checkBusy();
+
 #ifdef USE_SPI_TRANSACTION                    //to use SPI_TRANSACTION enable define at beginning of CPP file 
   SPI.beginTransaction(SPISettings(LTspeedMaximum, LTdataOrder, LTdataMode));
 #endif
@@ -2737,6 +2983,8 @@ void SX126XLT::printSXBufferHEX(uint8_t start, uint8_t end)
 
   setMode(MODE_STDBY_RC);
 
+  checkBusy();
+
 #ifdef USE_SPI_TRANSACTION     //to use SPI_TRANSACTION enable define at beginning of CPP file 
   SPI.beginTransaction(SPISettings(LTspeedMaximum, LTdataOrder, LTdataMode));
 #endif
@@ -2846,8 +3094,6 @@ uint8_t SX126XLT::transmitAddressed(uint8_t *txbuffer, uint8_t size, char txpack
   Serial.println(F("transmitAddressed()"));
 #endif
 
-  uint8_t index;
-  uint8_t bufferdata;
 
   if (size == 0)
   {
@@ -2871,11 +3117,7 @@ uint8_t SX126XLT::transmitAddressed(uint8_t *txbuffer, uint8_t size, char txpack
   SPI.transfer(txsource);                         //Source node
   _TXPacketL = 3 + size;                          //we have added 3 header bytes to size
 
-  for (index = 0; index < size; index++)
-  {
-    bufferdata = txbuffer[index];
-    SPI.transfer(bufferdata);
-  }
+  LTSPIwriteBytes(txbuffer, size);
 
   digitalWrite(_NSS, HIGH);
 
@@ -2938,7 +3180,7 @@ uint8_t SX126XLT::receiveAddressed(uint8_t *rxbuffer, uint8_t size, uint32_t rxt
   Serial.println(F("receiveAddressed()"));
 #endif
 
-  uint8_t index, RXstart, RXend;
+  uint8_t RXstart;
   uint16_t regdata;
   uint8_t buffer[2];
 
@@ -2972,7 +3214,8 @@ uint8_t SX126XLT::receiveAddressed(uint8_t *rxbuffer, uint8_t size, uint32_t rxt
 
   RXstart = buffer[1];
 
-  RXend = RXstart + _RXPacketL;
+
+  checkBusy();
 
 #ifdef USE_SPI_TRANSACTION     //to use SPI_TRANSACTION enable define at beginning of CPP file 
   SPI.beginTransaction(SPISettings(LTspeedMaximum, LTdataOrder, LTdataMode));
@@ -2987,11 +3230,7 @@ uint8_t SX126XLT::receiveAddressed(uint8_t *rxbuffer, uint8_t size, uint32_t rxt
   _RXDestination = SPI.transfer(0);
   _RXSource = SPI.transfer(0);
 
-  for (index = RXstart; index < RXend; index++)
-  {
-    regdata = SPI.transfer(0);
-    rxbuffer[index] = regdata;
-  }
+  LTSPIreadBytes(rxbuffer, _RXPacketL);
 
   digitalWrite(_NSS, HIGH);
 
@@ -3256,6 +3495,8 @@ void SX126XLT::fillSXBuffer(uint8_t startaddress, uint8_t size, uint8_t characte
 
   setMode(MODE_STDBY_RC);
 
+  checkBusy();
+
 #ifdef USE_SPI_TRANSACTION                          //to use SPI_TRANSACTION enable define at beginning of CPP file 
   SPI.beginTransaction(SPISettings(LTspeedMaximum, LTdataOrder, LTdataMode));
 #endif
@@ -3285,7 +3526,7 @@ uint8_t SX126XLT::readPacket(uint8_t *rxbuffer, uint8_t size)
   Serial.println(F("readPacket()"));
 #endif
 
-  uint8_t index, regdata, RXstart, RXend;
+  uint8_t RXstart;
   uint8_t buffer[2];
 
   readCommand(RADIO_GET_RXBUFFERSTATUS, buffer, 2);
@@ -3298,7 +3539,8 @@ uint8_t SX126XLT::readPacket(uint8_t *rxbuffer, uint8_t size)
 
   RXstart = buffer[1];
 
-  RXend = RXstart + _RXPacketL;
+
+  checkBusy();
 
 #ifdef USE_SPI_TRANSACTION     //to use SPI_TRANSACTION enable define at beginning of CPP file 
   SPI.beginTransaction(SPISettings(LTspeedMaximum, LTdataOrder, LTdataMode));
@@ -3309,11 +3551,7 @@ uint8_t SX126XLT::readPacket(uint8_t *rxbuffer, uint8_t size)
   SPI.transfer(RXstart);
   SPI.transfer(0xFF);
 
-  for (index = RXstart; index < RXend; index++)
-  {
-    regdata = SPI.transfer(0);
-    rxbuffer[index] = regdata;
-  }
+  LTSPIreadBytes(rxbuffer, _RXPacketL);
 
   digitalWrite(_NSS, HIGH);
 
@@ -3333,6 +3571,8 @@ void SX126XLT::writeByteSXBuffer(uint8_t addr, uint8_t regdata)
 
   setMode(MODE_STDBY_RC);                 //this is needed to ensure we can write to buffer OK.
 
+  checkBusy();
+
 #ifdef USE_SPI_TRANSACTION                //to use SPI_TRANSACTION enable define at beginning of CPP file 
   SPI.beginTransaction(SPISettings(LTspeedMaximum, LTdataOrder, LTdataMode));
 #endif
@@ -3711,6 +3951,7 @@ void SX126XLT::setRfFrequencyDirect(uint8_t high, uint8_t midhigh, uint8_t midlo
 //**********************************************************************************************
 // Reliable packet routines - added November 2021
 // Routines assume that RX and TX buffer base addresses are set to 0 by setupLoRa()
+// The reliable packets, ACKs and pollReliable() are in LTReliableCore.h, shared with the SX127X and SX128X
 //**********************************************************************************************
 
 void SX126XLT::printASCIIArray(uint8_t *buffer, uint8_t size)
@@ -3787,111 +4028,31 @@ void SX126XLT::printReliableStatus()
     Serial.print(F(",ACKreceived"));
   }
 
+  //0x02
+  if (bitRead(_ReliableFlags, ReliableDuplicate))
+  {
+    Serial.print(F(",DuplicateACKed"));
+  }
+
 }
 
 
-uint8_t SX126XLT::transmitReliable(uint8_t *txbuffer, uint8_t size, uint16_t networkID, uint32_t txtimeout, int8_t txpower, uint8_t wait)
+uint16_t SX126XLT::getTXPayloadCRC(uint8_t length)
 {
 #ifdef SX126XDEBUGRELIABLE
-  Serial.println();
-  Serial.println(F(" {RELIABLE} transmitRELIABLE() "));
-  Serial.print(F(" {RELIABLE} _ReliableConfig "));
-  Serial.println(_ReliableConfig, HEX);
-  Serial.print(F(" {RELIABLE} Payload length "));
-  Serial.println(size);
+  Serial.println(F(" {RELIABLE} getTXPayloadCRC() "));
 #endif
 
-  uint8_t index, tempdata;
-  uint16_t payloadcrc;
+  return readUint16SXBuffer(length - 2);
+}
 
-  _ReliableErrors = 0;
-  _ReliableFlags = 0;
 
-  if (size > 251)
-  {
-    bitSet(_ReliableErrors, ReliableSizeError);
-    return 0;
-  }
-
-  setMode(MODE_STDBY_RC);
-  _TXPacketL = size + 4;
-
-  if (bitRead(_ReliableConfig, NoReliableCRC))
-  {
-    payloadcrc = 0;
-  }
-  else
-  {
-    payloadcrc = CRCCCITT(txbuffer, size, 0xFFFF);
-  }
-
-  checkBusy();
-
-#ifdef USE_SPI_TRANSACTION
-  SPI.beginTransaction(SPISettings(LTspeedMaximum, LTdataOrder, LTdataMode));
-#endif
-
-  digitalWrite(_NSS, LOW);
-  SPI.transfer(RADIO_WRITE_BUFFER);
-  SPI.transfer(0);
-
-  for (index = 0; index < size; index++)
-  {
-    tempdata = txbuffer[index];
-    SPI.transfer(tempdata);
-  }
-
-  SPI.transfer(lowByte(networkID));
-  SPI.transfer(highByte(networkID));
-  SPI.transfer(lowByte(payloadcrc));
-  SPI.transfer(highByte(payloadcrc));
-
-  digitalWrite(_NSS, HIGH);
-
-#ifdef USE_SPI_TRANSACTION
-  SPI.endTransaction();
-#endif
-
-  setPayloadLength(_TXPacketL);
-
-  setTxParams(txpower, RAMP_TIME);
-  setDioIrqParams(IRQ_RADIO_ALL, (IRQ_TX_DONE + IRQ_RX_TX_TIMEOUT), 0, 0);   //set for IRQ on TX done and timeout on DIO1
-  setTx(txtimeout);
-
-  if (!wait)
-  {
-    return _TXPacketL;
-  }
-
-  while (!digitalRead(_TXDonePin));                                //Wait for DIO1 to go high
-
-  setMode(MODE_STDBY_RC);                                          //ensure we leave function with TX off
-
-  if (readIrqStatus() & IRQ_RX_TX_TIMEOUT )                        //check for timeout
-  {
-    return 0;
-  }
-
-  return _TXPacketL;
-}
-
-
-uint16_t SX126XLT::getTXPayloadCRC(uint8_t length)
-{
-#ifdef SX126XDEBUGRELIABLE
-  Serial.println(F(" {RELIABLE} getTXPayloadCRC() "));
-#endif
-
-  return readUint16SXBuffer(length - 2);
-}
-
-
-uint16_t SX126XLT::readUint16SXBuffer(uint8_t addr)
-{
-#ifdef SX126XDEBUGRELIABLE
-  Serial.print(F(" {RELIABLE} readUint16SXBuffer() 0x"));
-  Serial.println(addr, HEX);
-#endif
+uint16_t SX126XLT::readUint16SXBuffer(uint8_t addr)
+{
+#ifdef SX126XDEBUGRELIABLE
+  Serial.print(F(" {RELIABLE} readUint16SXBuffer() 0x"));
+  Serial.println(addr, HEX);
+#endif
 
   uint8_t regdatalow, regdatahigh;
   setMode(MODE_STDBY_RC);                  //this is needed to ensure we can read from buffer OK.
@@ -3935,65 +4096,43 @@ void SX126XLT::setPayloadLength(uint8_t length)
 }
 
 
-uint8_t SX126XLT::receiveReliable(uint8_t *rxbuffer, uint8_t size, uint16_t networkID, uint32_t rxtimeout, uint8_t wait )
+uint16_t SX126XLT::getRXNetworkID(uint8_t length)
 {
-  //Maximum total packet size is 255 bytes, so allowing for the 4 bytes appended to the end of a reliable
-  //packet
-
 #ifdef SX126XDEBUGRELIABLE
-  Serial.println();
-  Serial.println(F(" {RELIABLE} receiveReliable()"));
-  Serial.print(F(" {RELIABLE} _ReliableConfig "));
-  Serial.println(_ReliableConfig, HEX);
+  Serial.println(F(" {RELIABLE} getRXnetworkID() "));
 #endif
 
-  uint16_t payloadcrc = 0, RXcrc, RXnetworkID = 0;
-  uint8_t regdataL, regdataH;
-  uint8_t index;
-  uint8_t buffer[2];
-
-  _ReliableErrors = 0;
-  _ReliableFlags = 0;
-
-  if (size > 251 )
-  {
-    bitSet(_ReliableErrors, ReliableSizeError);
-    return 0;
-  }
+  return readUint16SXBuffer(length - 4);
+}
 
-  setMode(MODE_STDBY_RC);
-  setDioIrqParams(IRQ_RADIO_ALL, (IRQ_RX_DONE + IRQ_RX_TX_TIMEOUT), 0, 0);  //set for IRQ on RX done or timeout
-  setRx(rxtimeout);
 
-  if (!wait)
-  {
-    return 0;                                                               //not wait requested so no packet length to pass
-  }
+uint16_t SX126XLT::getRXPayloadCRC(uint8_t length)
+{
+#ifdef SX126XDEBUGRELIABLE
+  Serial.println(F(" {RELIABLE} getRXPayloadCRC) "));
+#endif
 
-  while (!digitalRead(_RXDonePin));                                         //Wait for DIO1 to go high
+  return readUint16SXBuffer(length - 2);
+}
 
-  setMode(MODE_STDBY_RC);                                                   //ensure to stop further packet reception
 
-  if ( readIrqStatus() & (IRQ_HEADER_ERROR + IRQ_CRC_ERROR + IRQ_RX_TX_TIMEOUT))
-  {
-    return 0;                                                               //packet is errored somewhere so return 0
-  }
+uint16_t SX126XLT::CRCCCITTReliable(uint8_t startadd, uint8_t endadd, uint16_t startvalue)
+{
+#ifdef SX126XDEBUGRELIABLE
+  Serial.println(F(" {RELIABLE} CRCCCITTReliable()"));
+#endif
 
-  readCommand(RADIO_GET_RXBUFFERSTATUS, buffer, 2);
-  _RXPacketL = buffer[0];
+  //generates a CRC of bytes from the internal SX buffer, _RXPackletL and _TXPackletL are not affected
 
-  if (_RXPacketL < 4)                                  //check received packet is 4 or more bytes long
-  {
-    bitSet(_ReliableErrors, ReliableSizeError);
-    return 0;
-  }
+#ifdef SX126DEBUGRELIABLE
+  Serial.println(F(" {RELIABLE} CRCCCITTReliable() "));
+#endif
 
-  if ((_RXPacketL - 4) > size )                        //check if calculated payload size (_RXPacketL -4) fits in array
-  {
-    bitSet(_ReliableErrors, ReliableSizeError);
-    return 0;
-  }
+  uint16_t remaining, libraryCRC;
+  uint8_t buff[32], length;
 
+  libraryCRC = startvalue;              //start value for CRC16
+  setMode(MODE_STDBY_RC);
   checkBusy();
 
 #ifdef USE_SPI_TRANSACTION
@@ -4002,2205 +4141,373 @@ uint8_t SX126XLT::receiveReliable(uint8_t *rxbuffer, uint8_t size, uint16_t netw
 
   digitalWrite(_NSS, LOW);             //start the burst read
   SPI.transfer(RADIO_READ_BUFFER);
-  SPI.transfer(0);
+  SPI.transfer(startadd);
   SPI.transfer(0xFF);
 
-  for (index = 0; index < (_RXPacketL - 4); index++)
+  remaining = (endadd >= startadd) ? (endadd - startadd + 1) : 0;
+
+  while (remaining > 0)                         //a block of the FIFO at a time
   {
-    regdataL = SPI.transfer(0);
-    rxbuffer[index] = regdataL;
+    length = (remaining < sizeof(buff)) ? remaining : sizeof(buff);
+    LTSPIreadBytes(buff, length);
+    libraryCRC = LTCRCCCITTUpdate(libraryCRC, buff, length);
+    remaining = remaining - length;
   }
 
-  regdataL = SPI.transfer(0);
-  regdataH = SPI.transfer(0);
-  RXnetworkID = ((uint16_t) regdataH << 8) + regdataL;
-  regdataL = SPI.transfer(0);
-  regdataH = SPI.transfer(0);
-
   digitalWrite(_NSS, HIGH);
 
 #ifdef USE_SPI_TRANSACTION
   SPI.endTransaction();
 #endif
 
-  if (!bitRead(_ReliableConfig, NoReliableCRC))
-  {
-    payloadcrc = CRCCCITT(rxbuffer, (_RXPacketL - 4), 0xFFFF);
-    RXcrc = ((uint16_t) regdataH << 8) + regdataL;
-
-    if (payloadcrc != RXcrc)
-    {
-      bitSet(_ReliableErrors, ReliableCRCError);
-    }
-  }
-
-  if (RXnetworkID != networkID)
-  {
-    bitSet(_ReliableErrors, ReliableIDError);
-  }
-
-  if (_ReliableErrors)                                      //if there has been a reliable error return a RX fail
-  {
-    return 0;
-  }
-
-  return _RXPacketL;                                        //return and indicate RX OK.
+  return libraryCRC;
 }
 
 
-uint16_t SX126XLT::getRXNetworkID(uint8_t length)
+void SX126XLT::writeUint16SXBuffer(uint8_t addr, uint16_t regdata)
 {
 #ifdef SX126XDEBUGRELIABLE
-  Serial.println(F(" {RELIABLE} getRXnetworkID() "));
+  Serial.print(F(" {RELIABLE} writeUint16SXBuffer() 0x"));
+  Serial.print(addr, HEX);
+  Serial.print(F(" 0x"));
+  Serial.println(regdata, HEX);
 #endif
 
-  return readUint16SXBuffer(length - 4);
-}
-
+  setMode(MODE_STDBY_RC);                 //this is needed to ensure we can write to buffer OK.
+  checkBusy();
 
-uint16_t SX126XLT::getRXPayloadCRC(uint8_t length)
-{
-#ifdef SX126XDEBUGRELIABLE
-  Serial.println(F(" {RELIABLE} getRXPayloadCRC) "));
+#ifdef USE_SPI_TRANSACTION
+  SPI.beginTransaction(SPISettings(LTspeedMaximum, LTdataOrder, LTdataMode));
 #endif
 
-  return readUint16SXBuffer(length - 2);
+  digitalWrite(_NSS, LOW);                //start the burst read
+  SPI.transfer(RADIO_WRITE_BUFFER);
+  SPI.transfer(addr);
+  SPI.transfer(lowByte(regdata));
+  SPI.transfer(highByte(regdata));
+  digitalWrite(_NSS, HIGH);
+
+#ifdef USE_SPI_TRANSACTION
+  SPI.endTransaction();
+#endif
 }
 
 
-uint8_t SX126XLT::transmitSXReliable(uint8_t startaddr, uint8_t length, uint16_t networkID, uint32_t txtimeout, int8_t txpower, uint8_t wait)
+void SX126XLT::setReliableRX(uint16_t timeout)
 {
+  //existing setRx() does not setup LoRa device as a receiver completly, just turns on receiver mode
+  //this routine does all the required setup for receive mode
 #ifdef SX126XDEBUGRELIABLE
-  Serial.println();
-  Serial.println(F(" {RELIABLE} transmitSXReliable() "));
-  Serial.print(F(" {RELIABLE} _ReliableConfig "));
-  Serial.println(_ReliableConfig, HEX);
+  Serial.println(F(" {RELIABLE} setReliableRX()"));
 #endif
 
-  uint16_t payloadcrc;
-
-  setMode(MODE_STDBY_RC);
-  checkBusy();
-  _ReliableErrors = 0;
-  _ReliableFlags = 0;
-
-  if (startaddr + length > 251)
-  {
-    bitSet(_ReliableErrors, ReliableSizeError);
-    return 0;
-  }
-
-  _TXPacketL = length + 4;
+  setMode(MODE_STDBY_RC);                                                   //stops receiver
+  clearIrqStatus(IRQ_RADIO_ALL);                                            //clear current interrupt flags
+  setDioIrqParams(IRQ_RADIO_ALL, (IRQ_RX_DONE + IRQ_RX_TX_TIMEOUT), 0, 0);
+  setRx(timeout);
+}
 
-  if (bitRead(_ReliableConfig, NoReliableCRC))
-  {
-    payloadcrc = 0;
-  }
-  else
-  {
-    payloadcrc = CRCCCITTReliable(startaddr, startaddr + length - 1, 0xFFFF);
-  }
 
-  writeUint16SXBuffer(startaddr + _TXPacketL - 4, networkID);
-  writeUint16SXBuffer(startaddr + _TXPacketL - 2, payloadcrc);
+uint8_t SX126XLT::transmitSXBufferIRQ(uint8_t startaddr, uint8_t length, uint16_t timeout, int8_t txpower, uint8_t wait)
+{
+#ifdef SX126XDEBUG
+  Serial.println(F("transmitSXBuffer()"));
+#endif
 
-  setPayloadLength(_TXPacketL);
+  setBufferBaseAddress(startaddr, 0);          //TX, RX
+  setPayloadLength(length);
   setTxParams(txpower, RAMP_TIME);
-  setDioIrqParams(IRQ_RADIO_ALL, (IRQ_TX_DONE + IRQ_RX_TX_TIMEOUT), 0, 0);   //set for IRQ on TX done and timeout on DIO1
-  setTx(txtimeout);                                    //this starts the TX
+  setTx(timeout);                              //this starts the TX
 
   if (!wait)
   {
     return _TXPacketL;
   }
 
-  while (!digitalRead(_TXDonePin));                    //Wait for pin to go high, TX finished
+  //0x0201   = IRQ_TX_DONE + IRQ_RX_TX_TIMEOUT
+  while (!(readIrqStatus() & 0x0201 ));        //wait for IRQs going active
 
-  setMode(MODE_STDBY_RC);                              //ensure we leave function with TX off
+  setMode(MODE_STDBY_RC);                      //ensure we leave function with TX off
 
-  if (readIrqStatus() & IRQ_RX_TX_TIMEOUT )            //check for timeout
+  if (readIrqStatus() & IRQ_RX_TX_TIMEOUT )    //check for timeout
   {
     return 0;
   }
-
-  return _TXPacketL;
+  else
+  {
+    return _TXPacketL;
+  }
 }
 
 
-uint8_t SX126XLT::receiveSXReliable(uint8_t startaddr, uint16_t networkID, uint32_t rxtimeout, uint8_t wait )
+uint8_t SX126XLT::receiveSXBufferIRQ(uint8_t startaddr, uint16_t timeout, uint8_t wait )
 {
-#ifdef SX126XDEBUGRELIABLE
-  Serial.println();
-  Serial.println(F(" {RELIABLE} receiveSXReliable()"));
-  Serial.print(F(" {RELIABLE} _ReliableConfig "));
-  Serial.println(_ReliableConfig, HEX);
+#ifdef SX126XDEBUG1
+  Serial.println(F("receiveSXBufferIRQ()"));
 #endif
 
-  uint16_t payloadcrc = 0, RXcrc, RXnetworkID = 0;
   uint8_t buffer[2];
 
-  _ReliableErrors = 0;
-  _ReliableFlags = 0;
-
   setMode(MODE_STDBY_RC);
-  checkBusy();
-  setDioIrqParams(IRQ_RADIO_ALL, (IRQ_RX_DONE + IRQ_RX_TX_TIMEOUT), 0, 0);  //set for IRQ on RX done or timeout
-  setRx(rxtimeout);
+  setBufferBaseAddress(0, startaddr);                //order is TX RX
+  setRx(timeout);
 
   if (!wait)
   {
-    return 0;                                           //not wait requested so no packet length to pass
+    return 0;
   }
 
-  while (!digitalRead(_RXDonePin));                     //Wait for DIO1 to go high, no timeout, RX DONE
+  //0x0202   = IRQ_RX_DONE + IRQ_RX_TX_TIMEOUT
+  while (!(readIrqStatus() & 0x0202 ));              //wait for IRQs going active
 
-  setMode(MODE_STDBY_RC);                               //ensure to stop further packet reception
+
+  setMode(MODE_STDBY_RC);                            //ensure to stop further packet reception
 
   if ( readIrqStatus() & (IRQ_HEADER_ERROR + IRQ_CRC_ERROR + IRQ_RX_TX_TIMEOUT))
   {
-    return 0;                                           //no RX done and header valid only, could be CRC error
+    return 0;                                        //no RX done and header valid only, could be CRC error
   }
 
   readCommand(RADIO_GET_RXBUFFERSTATUS, buffer, 2);
   _RXPacketL = buffer[0];
 
-  if (_RXPacketL < 4)                                   //check received packet is 4 or more bytes long
-  {
-    bitSet(_ReliableErrors, ReliableSizeError);
-    return 0;
-  }
-
-  RXnetworkID = readUint16SXBuffer(startaddr + _RXPacketL - 4);
-
-  if (RXnetworkID != networkID)
-  {
-    bitSet(_ReliableErrors, ReliableIDError);
-  }
-
-  if (!bitRead(_ReliableConfig, NoReliableCRC))
-  {
-    payloadcrc = CRCCCITTReliable(startaddr, (startaddr + _RXPacketL - 5), 0xFFFF);
-    RXcrc = readUint16SXBuffer(startaddr + _RXPacketL - 2);
-
-    if (payloadcrc != RXcrc)
-    {
-      bitSet(_ReliableErrors, ReliableCRCError);
-    }
-  }
-
-  if (_ReliableErrors)                                  //if there has been a reliable error return a RX fail
-  {
-    return 0;
-  }
-  return _RXPacketL;                                    //return and RX OK.
+  return _RXPacketL;
 }
 
 
-uint16_t SX126XLT::CRCCCITTReliable(uint8_t startadd, uint8_t endadd, uint16_t startvalue)
+void SX126XLT::setReliableConfig(uint8_t bitset)
 {
 #ifdef SX126XDEBUGRELIABLE
-  Serial.println(F(" {RELIABLE} CRCCCITTReliable()"));
+  Serial.print(F(" {RELIABLE} setReliableConfig() bit "));
+  Serial.println(bitset);
 #endif
 
-  //generates a CRC of bytes from the internal SX buffer, _RXPackletL and _TXPackletL are not affected
+  bitSet(_ReliableConfig, bitset);
+  return;
+}
 
-#ifdef SX126DEBUGRELIABLE
-  Serial.println(F(" {RELIABLE} CRCCCITTReliable() "));
-#endif
-
-  uint16_t index, libraryCRC;
-  uint8_t j, readSX;
-
-  libraryCRC = startvalue;              //start value for CRC16
-  setMode(MODE_STDBY_RC);
-  checkBusy();
 
-#ifdef USE_SPI_TRANSACTION
-  SPI.beginTransaction(SPISettings(LTspeedMaximum, LTdataOrder, LTdataMode));
+void SX126XLT::clearReliableConfig(uint8_t bitset)
+{
+#ifdef SX126XDEBUGRELIABLE
+  Serial.print(F(" {RELIABLE} clearReliableConfig() bit "));
+  Serial.println(bitset);
 #endif
 
-  digitalWrite(_NSS, LOW);             //start the burst read
-  SPI.transfer(RADIO_READ_BUFFER);
-  SPI.transfer(startadd);
-  SPI.transfer(0xFF);
+  bitClear(_ReliableConfig, bitset);
+  return;
+}
 
-  for (index = startadd; index <= endadd; index++)
-  {
-    readSX = SPI.transfer(0);
-    libraryCRC ^= (((uint16_t) readSX ) << 8);
-    for (j = 0; j < 8; j++)
-    {
-      if (libraryCRC & 0x8000)
-        libraryCRC = (libraryCRC << 1) ^ 0x1021;
-      else
-        libraryCRC <<= 1;
-    }
-  }
 
-  digitalWrite(_NSS, HIGH);
+//***********************************************************************************
+//Data Transfer functions - Added December 2021
+//TX and RX base addresses assumed to be 0
+//The DT functions are in LTReliableCore.h, these are the device accesses they call
+//***********************************************************************************
 
-#ifdef USE_SPI_TRANSACTION
-  SPI.endTransaction();
-#endif
+template class LTReliableCore<SX126XLT>;
 
-  return libraryCRC;
+
+void SX126XLT::standbyDT()
+{
+  setMode(MODE_STDBY_RC);
 }
 
 
-void SX126XLT::writeUint16SXBuffer(uint8_t addr, uint16_t regdata)
+void SX126XLT::beginWriteDT(uint8_t offset)
 {
-#ifdef SX126XDEBUGRELIABLE
-  Serial.print(F(" {RELIABLE} writeUint16SXBuffer() 0x"));
-  Serial.print(addr, HEX);
-  Serial.print(F(" 0x"));
-  Serial.println(regdata, HEX);
-#endif
-
-  setMode(MODE_STDBY_RC);                 //this is needed to ensure we can write to buffer OK.
   checkBusy();
 
 #ifdef USE_SPI_TRANSACTION
   SPI.beginTransaction(SPISettings(LTspeedMaximum, LTdataOrder, LTdataMode));
 #endif
 
-  digitalWrite(_NSS, LOW);                //start the burst read
+  digitalWrite(_NSS, LOW);
   SPI.transfer(RADIO_WRITE_BUFFER);
-  SPI.transfer(addr);
-  SPI.transfer(lowByte(regdata));
-  SPI.transfer(highByte(regdata));
-  digitalWrite(_NSS, HIGH);
-
-#ifdef USE_SPI_TRANSACTION
-  SPI.endTransaction();
-#endif
+  SPI.transfer(offset);
 }
 
 
-uint8_t SX126XLT::transmitReliableAutoACK(uint8_t *txbuffer, uint8_t size, uint16_t networkID, uint32_t acktimeout, uint32_t txtimeout, int8_t txpower, uint8_t wait)
+void SX126XLT::beginReadDT(uint8_t offset)
 {
-#ifdef SX126XDEBUGRELIABLE
-  Serial.println(F(" {RELIABLE} transmitReliableAutoACK() "));
-  Serial.print(F(" {RELIABLE} _ReliableConfig "));
-  Serial.println(_ReliableConfig, HEX);
-  Serial.print(F(" {RELIABLE} Payload length "));
-  Serial.println(size);
-#endif
-
-  uint8_t index, tempdata, RXPacketL;
-  uint16_t payloadcrc;
-
-  _ReliableErrors = 0;
-  _ReliableFlags = 0;
-
-  if (size > 251)
-  {
-    bitSet(_ReliableErrors, ReliableSizeError);
-    return 0;
-  }
-
-  setMode(MODE_STDBY_RC);
-  checkBusy();
-  _TXPacketL = size + 4;
-
-  if (bitRead(_ReliableConfig, NoReliableCRC))
-  {
-    payloadcrc = 0;
-  }
-  else
-  {
-    payloadcrc = CRCCCITT(txbuffer, size, 0xFFFF);
-  }
-
   checkBusy();
 
 #ifdef USE_SPI_TRANSACTION
   SPI.beginTransaction(SPISettings(LTspeedMaximum, LTdataOrder, LTdataMode));
 #endif
 
-  digitalWrite(_NSS, LOW);
-  SPI.transfer(RADIO_WRITE_BUFFER);
-  SPI.transfer(0);
-
-  for (index = 0; index < size; index++)
-  {
-    tempdata = txbuffer[index];
-    SPI.transfer(tempdata);
-  }
+  digitalWrite(_NSS, LOW);                             //start the burst read
+  SPI.transfer(RADIO_READ_BUFFER);
+  SPI.transfer(offset);
+  SPI.transfer(0xFF);
+}
 
-  SPI.transfer(lowByte(networkID));
-  SPI.transfer(highByte(networkID));
-  SPI.transfer(lowByte(payloadcrc));
-  SPI.transfer(highByte(payloadcrc));
 
+void SX126XLT::endBufferDT()
+{
   digitalWrite(_NSS, HIGH);
 
 #ifdef USE_SPI_TRANSACTION
   SPI.endTransaction();
 #endif
+}
 
-  setPayloadLength(_TXPacketL);
+
+void SX126XLT::startTXDT(uint8_t length, int8_t txpower, uint32_t txtimeout)
+{
+  setPayloadLength(length);
   setTxParams(txpower, RAMP_TIME);
   setDioIrqParams(IRQ_RADIO_ALL, (IRQ_TX_DONE + IRQ_RX_TX_TIMEOUT), 0, 0);   //set for IRQ on TX done and timeout on DIO1
   setTx(txtimeout);
+}
 
-  if (!wait)
-  {
-    return _TXPacketL;
-  }
-
-  while (!digitalRead(_TXDonePin));                                //Wait for DIO1 to go high
-
-  setMode(MODE_STDBY_RC);                                          //ensure we leave function with TX off
-
-  if (readIrqStatus() & IRQ_RX_TX_TIMEOUT )                        //check for timeout
-  {
-    return 0;
-  }
-
-  RXPacketL = waitReliableACK(networkID, payloadcrc, acktimeout);
 
-  if (RXPacketL != 4)
+bool SX126XLT::txDoneDT(bool useIRQ)
+{
+  if (useIRQ)
   {
-    return 0;
+    return (readIrqStatus() & (IRQ_TX_DONE + IRQ_RX_TX_TIMEOUT));
   }
 
-  return _TXPacketL;
+  return digitalRead(_TXDonePin);                      //DIO1, TX done or timeout
 }
 
 
-uint8_t SX126XLT::receiveReliableAutoACK(uint8_t *rxbuffer, uint8_t size, uint16_t networkID, uint32_t ackdelay, int8_t txpower, uint32_t rxtimeout, uint8_t wait )
+bool SX126XLT::endTXDT()
 {
-  //Maximum total packet size is 255 bytes, so allowing for the 4 bytes appended to the end of a reliable
-  //packet, the maximum payload size for LORa is 251 bytes. So to avoid overwriting
-  //memory, we do need to check if the passed array is big enough to take the payload received in the packet.
-  //The assumed payload length will always be 4 bytes less than the received packet length.
+  setMode(MODE_STDBY_RC);                              //ensure we leave with TX off
 
+  return !(readIrqStatus() & IRQ_RX_TX_TIMEOUT);
+}
 
-#ifdef SX126XDEBUGRELIABLE
-  Serial.println();
-  Serial.println(F(" {RELIABLE} receiveReliableAutoACK()"));
-  Serial.print(F(" {RELIABLE} _ReliableConfig "));
-  Serial.println(_ReliableConfig, HEX);
-#endif
 
-  uint16_t payloadcrc = 0, RXcrc, RXnetworkID = 0;
-  uint8_t regdataL, regdataH, index;
-  uint8_t buffer[2];
+bool SX126XLT::waitTXDT(uint32_t txtimeout, bool useIRQ)
+{
+  //the device times out the transmission, txtimeout went to setTx()
 
-  _ReliableErrors = 0;
-  _ReliableFlags = 0;
+  (void) txtimeout;
+  while (!txDoneDT(useIRQ));
+  return endTXDT();
+}
 
-  if (size > 251 )
-  {
-    bitSet(_ReliableErrors, ReliableSizeError);
-    return 0;
-  }
 
+void SX126XLT::startRXDT(uint32_t rxtimeout)
+{
   setMode(MODE_STDBY_RC);
-  setDioIrqParams(IRQ_RADIO_ALL, (IRQ_RX_DONE + IRQ_RX_TX_TIMEOUT), 0, 0);  //set for IRQ on RX done or timeout
+  setDioIrqParams(IRQ_RADIO_ALL, (IRQ_RX_DONE + IRQ_RX_TX_TIMEOUT), 0, 0);
   setRx(rxtimeout);
+}
 
-  if (!wait)
-  {
-    return 0;                                                               //not wait requested so no packet length to pass
-  }
-
-  while (!digitalRead(_RXDonePin));                                         //Wait for DIO1 to go high
-  setMode(MODE_STDBY_RC);                                                   //ensure to stop further packet reception
-
-  if ( readIrqStatus() & (IRQ_HEADER_ERROR + IRQ_CRC_ERROR + IRQ_RX_TX_TIMEOUT))
-  {
-    return 0;                                                               //packet is errored somewhere so return 0
-  }
-
-  readCommand(RADIO_GET_RXBUFFERSTATUS, buffer, 2);
-  _RXPacketL = buffer[0];
-
-  if (_RXPacketL < 4)    //check received packet is 4 or more bytes long
-  {
-    bitSet(_ReliableErrors, ReliableSizeError);
-    return 0;
-  }
 
-  if ((_RXPacketL - 4) > size )                      //check if calculated payload size (_RXPacketL -4) fits in array
+bool SX126XLT::rxDoneDT(bool useIRQ)
+{
+  if (useIRQ)
   {
-    bitSet(_ReliableErrors, ReliableSizeError);
-    return 0;
+    return (readIrqStatus() & (IRQ_RX_DONE + IRQ_RX_TX_TIMEOUT));
   }
 
-  checkBusy();
+  return digitalRead(_RXDonePin);
+}
 
-#ifdef USE_SPI_TRANSACTION
-  SPI.beginTransaction(SPISettings(LTspeedMaximum, LTdataOrder, LTdataMode));
-#endif
 
-  digitalWrite(_NSS, LOW);                           //start the burst read
-  SPI.transfer(RADIO_READ_BUFFER);
-  SPI.transfer(0);
-  SPI.transfer(0xFF);
+bool SX126XLT::waitRXDT(uint32_t rxtimeout, bool useIRQ)
+{
+  //the device times out the reception, rxtimeout went to setRx(), endRXDT() finds the timeout
 
-  for (index = 0; index < (_RXPacketL - 4); index++)
-  {
-    regdataL = SPI.transfer(0);
-    rxbuffer[index] = regdataL;
-  }
+  (void) rxtimeout;
+  while (!rxDoneDT(useIRQ));
+  return true;
+}
 
-  regdataL = SPI.transfer(0);
-  regdataH = SPI.transfer(0);
-  RXnetworkID = ((uint16_t) regdataH << 8) + regdataL;
-  regdataL = SPI.transfer(0);
-  regdataH = SPI.transfer(0);
-  digitalWrite(_NSS, HIGH);
 
-#ifdef USE_SPI_TRANSACTION
-  SPI.endTransaction();
-#endif
+bool SX126XLT::endRXDT()
+{
+  setMode(MODE_STDBY_RC);                              //ensure to stop further packet reception
 
-  if (!bitRead(_ReliableConfig, NoReliableCRC))
-  {
-    payloadcrc = CRCCCITT(rxbuffer, (_RXPacketL - 4), 0xFFFF);
-    RXcrc = ((uint16_t) regdataH << 8) + regdataL;
+  return !(readIrqStatus() & (IRQ_HEADER_ERROR + IRQ_CRC_ERROR + IRQ_RX_TX_TIMEOUT));
+}
 
-    if (payloadcrc != RXcrc)
-    {
-      bitSet(_ReliableErrors, ReliableCRCError);
-    }
-  }
 
-  if (RXnetworkID != networkID)
-  {
-    bitSet(_ReliableErrors, ReliableIDError);
-  }
+uint8_t SX126XLT::readRXBufferStatusDT()
+{
+  uint8_t buffer[2];
 
-  if (_ReliableErrors)                                      //if there has been a reliable error return a RX fail
-  {
-    return 0;
-  }
+  readCommand(RADIO_GET_RXBUFFERSTATUS, buffer, 2);
+  _RXPacketL = buffer[0];
+  return buffer[1];
+}
 
 
-  delay(ackdelay);
-  _TXPacketL = sendReliableACK(RXnetworkID, payloadcrc, txpower);
-  if (_TXPacketL != 4)
-  {
-    return 0;
-  }
+void SX126XLT::restartRXDT()
+{
+  setReliableRX(0);
+}
 
 
-  return _RXPacketL;                                        //return and indicate RX OK.
+bool SX126XLT::receivingDT()
+{
+  return false;                                        //the device holds off its own RX timeout
 }
 
 
-uint8_t SX126XLT::waitReliableACK(uint16_t networkID, uint16_t payloadcrc, uint32_t acktimeout)
+void SX126XLT::timeoutDT(bool tx)
 {
+  (void) tx;
+  setMode(MODE_STDBY_RC);                              //a timeout by millis(), the device has its own as well
+}
 
-#ifdef SX126XDEBUGRELIABLE
-  Serial.println(F(" {RELIABLE} waitReliableACK()"));
-#endif
-
-  uint16_t RXnetworkID, RXcrc;
-  uint32_t startmS;
-  uint8_t buffer[2];
 
-  setReliableRX(0);
-  startmS = millis();
+void SX126XLT::setTXBaseDT(uint8_t addr)
+{
+  (void) addr;                                         //the buffer base addresses stay at 0, from setupLoRa()
+}
 
-  do
-  {
-    if (digitalRead(_RXDonePin))          //has a packet arrived ?
-    {
-      if ( readIrqStatus() & (IRQ_HEADER_ERROR + IRQ_CRC_ERROR + IRQ_RX_TX_TIMEOUT))
-      {
-        setReliableRX(0);
-        continue;
-      }
 
-      readCommand(RADIO_GET_RXBUFFERSTATUS, buffer, 2);
-      _RXPacketL = buffer[0];
+void SX126XLT::setRXBaseDT(uint8_t addr)
+{
+  (void) addr;
+}
 
-      RXnetworkID = readUint16SXBuffer(_RXPacketL - 4);
-      RXcrc = readUint16SXBuffer(_RXPacketL - 2);
 
-      if ( (RXnetworkID == networkID) && (RXcrc == payloadcrc))
-      {
-        bitSet(_ReliableFlags, ReliableACKReceived);
-        return 4;                          //return value of 4 indicates valid ack
-      }
-      else
-      {
-        setReliableRX(0);
-        continue;
-      }
-    }
+uint16_t SX126XLT::readPreambleDT()
+{
+  return savedPacketParam1;                            //LoRa preamble length in symbols
+}
 
-  } while ( ((uint32_t) (millis() - startmS) < acktimeout));
 
-  bitSet(_ReliableErrors, ReliableACKError);
-  return 0;
+void SX126XLT::writePreambleDT(uint16_t length)
+{
+  setPacketParams(length, savedPacketParam2, savedPacketParam3, savedPacketParam4, savedPacketParam5);
 }
 
-void SX126XLT::setReliableRX(uint16_t timeout)
+
+uint16_t SX126XLT::getTXNetworkID(uint8_t length)
 {
-  //existing setRx() does not setup LoRa device as a receiver completly, just turns on receiver mode
-  //this routine does all the required setup for receive mode
 #ifdef SX126XDEBUGRELIABLE
-  Serial.println(F(" {RELIABLE} setReliableRX()"));
+  Serial.println(F(" {RELIABLE} getTXnetworkID() "));
 #endif
 
-  setMode(MODE_STDBY_RC);                                                   //stops receiver
-  clearIrqStatus(IRQ_RADIO_ALL);                                            //clear current interrupt flags
-  setDioIrqParams(IRQ_RADIO_ALL, (IRQ_RX_DONE + IRQ_RX_TX_TIMEOUT), 0, 0);
-  setRx(timeout);
+  return readUint16SXBuffer(length - 4);
 }
 
-
-uint8_t SX126XLT::sendReliableACK(uint16_t networkID, uint16_t payloadcrc, int8_t txpower)
+uint8_t SX126XLT::readReliableErrors()
 {
-
 #ifdef SX126XDEBUGRELIABLE
-  Serial.println(F(" {RELIABLE} sendReliableACK()"));
+  Serial.println(F(" {RELIABLE} readReliableErrors()"));
 #endif
 
-  uint32_t txtimeout = 12000;                               //set TX timeout to 12 seconds, longest packet is 8.7secs
-  _TXPacketL = 4;                                           //packet is networkId (2 bytes) + payloadCRC (2 bytes)
-  setMode(MODE_STDBY_RC);
-
-  writeUint16SXBuffer(0, networkID);
-  writeUint16SXBuffer(2, payloadcrc);
-
-  checkBusy();
-  setPayloadLength(_TXPacketL);
-  setTxParams(txpower, RAMP_TIME);
-  setDioIrqParams(IRQ_RADIO_ALL, (IRQ_TX_DONE + IRQ_RX_TX_TIMEOUT), 0, 0);   //set for IRQ on TX done and timeout on DIO1
-  setTx(txtimeout);
-
-  while (!digitalRead(_TXDonePin));
-
-  setMode(MODE_STDBY_RC);                                 //ensure we leave function with TX off
-
-  if (readIrqStatus() & IRQ_RX_TX_TIMEOUT )               //check for timeout
-  {
-    return 0;
-  }
-
-  bitSet(_ReliableFlags, ReliableACKSent);
-  return 4;                                               //TX OK so return TXpacket length
+  return _ReliableErrors;
 }
 
-
-uint8_t SX126XLT::transmitSXReliableAutoACK(uint8_t startaddr, uint8_t length, uint16_t networkID, uint32_t acktimeout, uint32_t txtimeout, int8_t txpower, uint8_t wait)
+uint8_t SX126XLT::readReliableFlags()
 {
 #ifdef SX126XDEBUGRELIABLE
-  Serial.println();
-  Serial.println(F(" {RELIABLE} transmitSXReliableAutoACK() "));
-  Serial.print(F(" {RELIABLE} _ReliableConfig "));
-  Serial.println(_ReliableConfig, HEX);
+  Serial.println(F(" {RELIABLE} readReliableFlags()"));
 #endif
 
-  uint8_t RXPacketL;
-  uint16_t payloadcrc;
-
-  _ReliableErrors = 0;
-  _ReliableFlags = 0;
-
-  if (startaddr + length > 251)
-  {
-    bitSet(_ReliableErrors, ReliableSizeError);
-    return 0;
-  }
-
-  setMode(MODE_STDBY_RC);
-  checkBusy();
-  _TXPacketL = length + 4;
+  return _ReliableFlags;
+}
 
-  if (bitRead(_ReliableConfig, NoReliableCRC))
-  {
-    payloadcrc = 0;
-  }
-  else
-  {
-    payloadcrc = CRCCCITTReliable(startaddr, startaddr + length - 1, 0xFFFF);
-  }
-
-  writeUint16SXBuffer(startaddr + _TXPacketL - 4, networkID);
-  writeUint16SXBuffer(startaddr + _TXPacketL - 2, payloadcrc);
-  setPayloadLength(_TXPacketL);
-  setTxParams(txpower, RAMP_TIME);
-  setDioIrqParams(IRQ_RADIO_ALL, (IRQ_TX_DONE + IRQ_RX_TX_TIMEOUT), 0, 0);   //set for IRQ on TX done and timeout on DIO1
-  setTx(txtimeout);
-
-  if (!wait)
-  {
-    return _TXPacketL;
-  }
-
-  if (!wait)
-  {
-    return _TXPacketL;
-  }
-
-  while (!digitalRead(_TXDonePin));                        //Wait for DIO1 to go high
-
-  setMode(MODE_STDBY_RC);                                  //ensure we leave function with TX off
-
-  if (readIrqStatus() & IRQ_RX_TX_TIMEOUT )                //check for timeout
-  {
-    return 0;
-  }
-
-  RXPacketL = waitReliableACK(networkID, payloadcrc, acktimeout);
-
-  if (RXPacketL != 4)
-  {
-
-    return 0;
-  }
-
-  return _TXPacketL;
-}
-
-
-uint8_t SX126XLT::receiveSXReliableAutoACK(uint8_t startaddr, uint16_t networkID, uint32_t ackdelay, int8_t txpower, uint32_t rxtimeout, uint8_t wait )
-{
-#ifdef SX126XDEBUGRELIABLE
-  Serial.println();
-  Serial.println(F(" {RELIABLE} receiveSXReliableAutoACK()"));
-  Serial.print(F(" {RELIABLE} _ReliableConfig "));
-  Serial.println(_ReliableConfig, HEX);
-#endif
-
-  uint16_t payloadcrc = 0, RXcrc, RXnetworkID = 0;
-  uint16_t temp1, temp2;
-  uint8_t buffer[2];
-
-  _ReliableErrors = 0;
-  _ReliableFlags = 0;
-
-  setMode(MODE_STDBY_RC);
-  setDioIrqParams(IRQ_RADIO_ALL, (IRQ_RX_DONE + IRQ_RX_TX_TIMEOUT), 0, 0);  //set for IRQ on RX done or timeout
-  setRx(rxtimeout);
-
-  if (!wait)
-  {
-    return 0;                                           //not wait requested so no packet length to pass
-  }
-
-  while (!digitalRead(_RXDonePin));                     //Wait for DIO1 to go high
-  setMode(MODE_STDBY_RC);                               //ensure to stop further packet reception
-
-  if ( readIrqStatus() & (IRQ_HEADER_ERROR + IRQ_CRC_ERROR + IRQ_RX_TX_TIMEOUT))
-  {
-    return 0;                                           //packet is errored somewhere so return 0
-  }
-
-  readCommand(RADIO_GET_RXBUFFERSTATUS, buffer, 2);
-  _RXPacketL = buffer[0];
-
-  if (_RXPacketL < 4)                                   //check received packet is 4 or more bytes long
-  {
-    bitSet(_ReliableErrors, ReliableSizeError);
-    return 0;
-  }
-
-  RXnetworkID = readUint16SXBuffer(startaddr + _RXPacketL - 4);
-
-  if (RXnetworkID != networkID)
-  {
-    bitSet(_ReliableErrors, ReliableIDError);
-  }
-
-  if (!bitRead(_ReliableConfig, NoReliableCRC))
-  {
-    payloadcrc = CRCCCITTReliable(startaddr, (startaddr + _RXPacketL - 5), 0xFFFF);
-    RXcrc = readUint16SXBuffer(startaddr + _RXPacketL - 2);
-
-    if (payloadcrc != RXcrc)
-    {
-      bitSet(_ReliableErrors, ReliableCRCError);
-    }
-  }
-
-  if (_ReliableErrors)                                    //if there has been a reliable error return a RX fail
-  {
-    return 0;
-  }
-
-  delay(ackdelay);
-  temp1 = readUint16SXBuffer(startaddr);                          //save bytes that would be overwritten by ack
-  temp2 = readUint16SXBuffer(startaddr + 2);                      //save bytes that would be overwritten by ack
-  _TXPacketL = sendReliableACK(RXnetworkID, payloadcrc, txpower);
-  writeUint16SXBuffer(startaddr, temp1);                          //restore bytes that would be overwritten by ack
-  writeUint16SXBuffer(startaddr + 2, temp2);                      //restore bytes that would be overwritten by ack
-
-  if (_TXPacketL != 4)
-  {
-    bitSet(_ReliableErrors, ReliableACKError);
-    return 0;
-  }
-
-  return _RXPacketL;                                              //return indicating RX ack sent OK.
-}
-
-
-
-uint8_t SX126XLT::waitReliableACK(uint8_t *rxbuffer, uint8_t size, uint16_t networkID, uint16_t payloadcrc, uint32_t acktimeout)
-{
-  //overloaded version of waitReliableACK() for use when ack contains payload data
-#ifdef SX126XDEBUGRELIABLE
-  Serial.println(F(" {RELIABLE} waitReliableACK()"));
-#endif
-
-  uint16_t RXnetworkID, RXcrc;
-  uint32_t startmS;
-  uint8_t buffer[2];
-  uint8_t regdata, index;
-
-  //payloadcrc++;
-
-  if (size > 251 )
-  {
-    bitSet(_ReliableErrors, ReliableSizeError);
-    return 0;
-  }
-
-  setReliableRX(0);
-  startmS = millis();
-
-  do
-  {
-    if (digitalRead(_RXDonePin))                         //has a packet arrived ?
-    {
-      regdata = readIrqStatus();
-
-      if ( readIrqStatus() & (IRQ_HEADER_ERROR + IRQ_CRC_ERROR + IRQ_RX_TX_TIMEOUT))
-      {
-        setReliableRX(0);
-        continue;
-      }
-
-      readCommand(RADIO_GET_RXBUFFERSTATUS, buffer, 2);
-      _RXPacketL = buffer[0];
-      RXnetworkID = readUint16SXBuffer(_RXPacketL - 4);
-      RXcrc = readUint16SXBuffer(_RXPacketL - 2);
-
-      if ( (RXnetworkID == networkID) && (RXcrc == payloadcrc))
-      {
-        if ((_RXPacketL - 4) > size )                    //check passed buffer is big enough for payload
-        {
-          bitSet(_ReliableErrors, ReliableACKError);
-          bitSet(_ReliableErrors, ReliableSizeError);
-          return 0;
-        }
-
-        bitSet(_ReliableFlags, ReliableACKReceived);
-        checkBusy();
-
-#ifdef USE_SPI_TRANSACTION
-        SPI.beginTransaction(SPISettings(LTspeedMaximum, LTdataOrder, LTdataMode));
-#endif
-
-        digitalWrite(_NSS, LOW);             //start the burst read
-        SPI.transfer(RADIO_READ_BUFFER);
-        SPI.transfer(0);
-        SPI.transfer(0xFF);
-
-        for (index = 0; index < (_RXPacketL - 4); index++)   //read packet into rxbuffer
-        {
-          regdata = SPI.transfer(0);
-          rxbuffer[index] = regdata;
-        }
-        digitalWrite(_NSS, HIGH);
-
-#ifdef USE_SPI_TRANSACTION
-        SPI.endTransaction();
-#endif
-
-        return _RXPacketL;                                  //_RXPacketL should be payload length + 4
-      }
-      else
-      {
-        setReliableRX(0);
-        continue;
-      }
-    }
-  } while ( ((uint32_t) (millis() - startmS) < acktimeout) );
-
-  bitSet(_ReliableErrors, ReliableACKError);
-  return 0;
-}
-
-
-uint8_t SX126XLT::sendReliableACK(uint8_t *txbuffer, uint8_t size, uint16_t networkID, uint16_t payloadcrc, int8_t txpower)
-{
-  //overloaded version of sendReliableACK() for use when ack contains payload data
-#ifdef SX126XDEBUGRELIABLE
-  Serial.print(F(" {RELIABLE} sendReliableACK() "));
-  Serial.print(F("buffer size "));
-  Serial.println(size);
-#endif
-
-  uint32_t txtimeout = 12000;                             //set TX timeout to 12 seconds, longest packet is 8.7secs
-  uint8_t bufferdata, index;
-
-  setMode(MODE_STDBY_RC);
-  _TXPacketL = size + 4;
-  checkBusy();
-
-#ifdef USE_SPI_TRANSACTION
-  SPI.beginTransaction(SPISettings(LTspeedMaximum, LTdataOrder, LTdataMode));
-#endif
-
-  digitalWrite(_NSS, LOW);
-  SPI.transfer(RADIO_WRITE_BUFFER);
-  SPI.transfer(0);
-
-  for (index = 0; index < size; index++)
-  {
-    bufferdata = txbuffer[index];
-    SPI.transfer(bufferdata);
-  }
-
-  SPI.transfer(lowByte(networkID));
-  SPI.transfer(highByte(networkID));
-  SPI.transfer(lowByte(payloadcrc));
-  SPI.transfer(highByte(payloadcrc));
-
-  digitalWrite(_NSS, HIGH);
-
-#ifdef USE_SPI_TRANSACTION
-  SPI.endTransaction();
-#endif
-
-  setPayloadLength(_TXPacketL);
-  setTxParams(txpower, RAMP_TIME);
-  setDioIrqParams(IRQ_RADIO_ALL, (IRQ_TX_DONE + IRQ_RX_TX_TIMEOUT), 0, 0);   //set for IRQ on TX done and timeout on DIO1
-  setTx(txtimeout);                                                          //this starts the TX
-
-  while (!digitalRead(_TXDonePin));                                //Wait for DIO1 to go high
-
-  setMode(MODE_STDBY_RC);                                          //ensure we leave function with TX off
-
-  if (readIrqStatus() & IRQ_RX_TX_TIMEOUT )                        //check for timeout
-  {
-    return 0;
-  }
-  else
-  {
-    return _TXPacketL;
-  }
-
-  bitSet(_ReliableFlags, ReliableACKSent);
-  return _TXPacketL;                                               //TX OK so return TXpacket length
-}
-
-
-uint8_t SX126XLT::waitSXReliableACK(uint8_t startaddr, uint16_t networkID, uint16_t payloadcrc, uint32_t acktimeout)
-{
-
-#ifdef SX126XDEBUGRELIABLE
-  Serial.println(F(" {RELIABLE} waitSXReliableACK()"));
-#endif
-
-  uint16_t RXnetworkID, RXcrc;
-  uint32_t startmS;
-  uint8_t buffer[2];
-
-  setReliableRX(0);
-
-  startmS = millis();
-
-  do
-  {
-    if (digitalRead(_RXDonePin))                             //has a packet arrived ?
-    {
-      if ( readIrqStatus() & (IRQ_HEADER_ERROR + IRQ_CRC_ERROR + IRQ_RX_TX_TIMEOUT))
-      {
-        setReliableRX(0);
-        continue;
-      }
-
-      readCommand(RADIO_GET_RXBUFFERSTATUS, buffer, 2);
-      _RXPacketL = buffer[0];
-      RXnetworkID = readUint16SXBuffer(startaddr + _RXPacketL - 4);
-      RXcrc = readUint16SXBuffer(startaddr + _RXPacketL - 2);
-
-      if ( (RXnetworkID == networkID) && (RXcrc == payloadcrc))
-      {
-        bitSet(_ReliableFlags, ReliableACKReceived);
-        return _RXPacketL;                                   //_RXPacketL should be payload length + 4
-      }
-      else
-      {
-        setReliableRX(0);
-        continue;
-      }
-    }
-  } while ( ((uint32_t) (millis() - startmS) < acktimeout) );
-
-  bitSet(_ReliableErrors, ReliableACKError);
-  return 0;
-}
-
-
-uint8_t SX126XLT::sendSXReliableACK(uint8_t startaddr, uint8_t length, uint16_t networkID, uint16_t payloadcrc, int8_t txpower)
-{
-
-#ifdef SX126XDEBUGRELIABLE
-  Serial.print(F(" {RELIABLE} sendSXReliableACK() "));
-#endif
-
-  uint32_t txtimeout = 12000;                                   //set TX timeout to 12 seconds, longest packet is 8.7secs
-
-  _TXPacketL = length + 4;                                      //packet is networkId (2 bytes) + payloadCRC (2 bytes)
-  setMode(MODE_STDBY_RC);
-
-  writeUint16SXBuffer((length + startaddr), networkID);
-  writeUint16SXBuffer((length + startaddr + 2), payloadcrc);
-  checkBusy();
-  setPayloadLength(_TXPacketL);
-  setTxParams(txpower, RAMP_TIME);
-  setDioIrqParams(IRQ_RADIO_ALL, (IRQ_TX_DONE + IRQ_RX_TX_TIMEOUT), 0, 0);   //set for IRQ on TX done and timeout on DIO1
-  setTx(txtimeout);                                             //start transmission
-
-  while (!digitalRead(_TXDonePin));
-
-  setMode(MODE_STDBY_RC);                                       //ensure we leave function with TX off
-
-  if (readIrqStatus() & IRQ_RX_TX_TIMEOUT )                     //check for timeout
-  {
-    return 0;
-  }
-
-  bitSet(_ReliableFlags, ReliableACKSent);
-  return _TXPacketL;                                            //TX OK so return TXpacket length
-}
-
-
-uint8_t SX126XLT::transmitSXReliableIRQ(uint8_t startaddr, uint8_t length, uint16_t networkID, uint32_t txtimeout, int8_t txpower, uint8_t wait)
-{
-#ifdef SX126XDEBUGRELIABLE
-  Serial.println();
-  Serial.println(F(" {RELIABLE} transmitSXReliableIRQ() "));
-  Serial.print(F(" {RELIABLE} _ReliableConfig "));
-  Serial.println(_ReliableConfig, HEX);
-#endif
-
-  uint16_t payloadcrc;
-
-  setMode(MODE_STDBY_RC);
-  checkBusy();
-  _ReliableErrors = 0;
-  _ReliableFlags = 0;
-
-  if (startaddr + length > 251)
-  {
-    bitSet(_ReliableErrors, ReliableSizeError);
-    return 0;
-  }
-
-  _TXPacketL = length + 4;
-
-  if (bitRead(_ReliableConfig, NoReliableCRC))
-  {
-    payloadcrc = 0;
-  }
-  else
-  {
-    payloadcrc = CRCCCITTReliable(startaddr, startaddr + length - 1, 0xFFFF);
-  }
-
-  writeUint16SXBuffer(startaddr + _TXPacketL - 4, networkID);
-  writeUint16SXBuffer(startaddr + _TXPacketL - 2, payloadcrc);
-  setPayloadLength(_TXPacketL);
-  setTxParams(txpower, RAMP_TIME);
-  setTx(txtimeout);                                       //this starts the TX
-
-  if (!wait)
-  {
-    return _TXPacketL;
-  }
-
-  //0x0201   = IRQ_TX_DONE + IRQ_RX_TX_TIMEOUT
-  while (!(readIrqStatus() & 0x0201 ));   //wait for IRQs going active
-
-  setMode(MODE_STDBY_RC);                                //ensure we leave function with TX off
-
-  if (readIrqStatus() & IRQ_RX_TX_TIMEOUT )              //check for timeout
-  {
-    return 0;
-  }
-
-  return _TXPacketL;
-}
-
-
-uint8_t SX126XLT::waitSXReliableACKIRQ(uint8_t startaddr, uint16_t networkID, uint16_t payloadcrc, uint32_t acktimeout)
-{
-
-#ifdef SX126XDEBUGRELIABLE
-  Serial.println(F(" {RELIABLE} waitSXReliableACKIRQ()"));
-#endif
-
-  uint16_t RXnetworkID, RXcrc;
-  uint32_t startmS;
-  uint8_t buffer[2];
-
-  setReliableRX(0);
-
-  startmS = millis();
-
-  do
-  {
-    //0x0202   = IRQ_RX_DONE + IRQ_RX_TX_TIMEOUT
-    if (readIrqStatus() & 0x0202 )
-    {
-      if ( readIrqStatus() & (IRQ_HEADER_ERROR + IRQ_CRC_ERROR + IRQ_RX_TX_TIMEOUT))
-      {
-        setReliableRX(0);
-        continue;
-      }
-
-      readCommand(RADIO_GET_RXBUFFERSTATUS, buffer, 2);
-      _RXPacketL = buffer[0];
-      RXnetworkID = readUint16SXBuffer(startaddr + _RXPacketL - 4);
-      RXcrc = readUint16SXBuffer(startaddr + _RXPacketL - 2);
-
-      if ( (RXnetworkID == networkID) && (RXcrc == payloadcrc))
-      {
-        bitSet(_ReliableFlags, ReliableACKReceived);
-        return _RXPacketL;                                 //_RXPacketL should be payload length + 4
-      }
-      else
-      {
-        setReliableRX(0);
-        continue;
-      }
-    }
-  } while ( ((uint32_t) (millis() - startmS) < acktimeout) );
-
-  bitSet(_ReliableErrors, ReliableACKError);
-  return 0;
-}
-
-
-uint8_t SX126XLT::receiveSXReliableIRQ(uint8_t startaddr, uint16_t networkID, uint32_t rxtimeout, uint8_t wait )
-{
-#ifdef SX126XDEBUGRELIABLE
-  Serial.println();
-  Serial.println(F(" {RELIABLE} receiveSXReliable()"));
-  Serial.print(F(" {RELIABLE} _ReliableConfig "));
-  Serial.println(_ReliableConfig, HEX);
-#endif
-
-  uint16_t payloadcrc = 0, RXcrc, RXnetworkID = 0;
-  uint8_t buffer[2];
-
-  _ReliableErrors = 0;
-  _ReliableFlags = 0;
-
-  setMode(MODE_STDBY_RC);
-  checkBusy();
-  setRx(rxtimeout);
-
-  if (!wait)
-  {
-    return 0;                                                              //not wait requested so no packet length to pass
-  }
-
-  //0x0202   = IRQ_RX_DONE + IRQ_RX_TX_TIMEOUT
-  while (!(readIrqStatus() & 0x0202 ));   //wait for IRQs going active
-
-  setMode(MODE_STDBY_RC);                                                  //ensure to stop further packet reception
-
-  if ( readIrqStatus() & (IRQ_HEADER_ERROR + IRQ_CRC_ERROR + IRQ_RX_TX_TIMEOUT))
-  {
-    return 0;                                                              //no RX done and header valid only, could be CRC error
-  }
-
-  readCommand(RADIO_GET_RXBUFFERSTATUS, buffer, 2);
-  _RXPacketL = buffer[0];
-
-  if (_RXPacketL < 4)                                                      //check received packet is 4 or more bytes long
-  {
-    bitSet(_ReliableErrors, ReliableSizeError);
-    return 0;
-  }
-
-  RXnetworkID = readUint16SXBuffer(startaddr + _RXPacketL - 4);
-
-  if (RXnetworkID != networkID)
-  {
-    bitSet(_ReliableErrors, ReliableIDError);
-  }
-
-  if (!bitRead(_ReliableConfig, NoReliableCRC))
-  {
-    payloadcrc = CRCCCITTReliable(startaddr, (startaddr + _RXPacketL - 5), 0xFFFF);
-    RXcrc = readUint16SXBuffer(startaddr + _RXPacketL - 2);
-
-    if (payloadcrc != RXcrc)
-    {
-      bitSet(_ReliableErrors, ReliableCRCError);
-    }
-  }
-
-  if (_ReliableErrors)                                      //if there has been a reliable error return a RX fail
-  {
-    return 0;
-  }
-
-  return _RXPacketL;                                        //return and RX OK.
-}
-
-
-uint8_t SX126XLT::sendSXReliableACKIRQ(uint8_t startaddr, uint8_t length, uint16_t networkID, uint16_t payloadcrc, int8_t txpower)
-{
-
-#ifdef SX126XDEBUGRELIABLE
-  Serial.print(F(" {RELIABLE} sendSXReliableACK() "));
-#endif
-
-  uint32_t txtimeout = 12000;                                    //set TX timeout to 12 seconds, longest packet is 8.7secs
-
-  _TXPacketL = length + 4;                                       //packet is networkId (2 bytes) + payloadCRC (2 bytes)
-  setMode(MODE_STDBY_RC);
-
-  writeUint16SXBuffer((length + startaddr), networkID);
-  writeUint16SXBuffer((length + startaddr + 2), payloadcrc);
-
-  checkBusy();
-  setPayloadLength(_TXPacketL);
-  setTxParams(txpower, RAMP_TIME);
-  setTx(txtimeout);                                             //start transmission
-
-  //0x0201   = IRQ_TX_DONE + IRQ_RX_TX_TIMEOUT
-  while (!(readIrqStatus() & 0x0201 ));                         //wait for IRQs going active
-
-  setMode(MODE_STDBY_RC);                                       //ensure we leave function with TX off
-
-  if (readIrqStatus() & IRQ_RX_TX_TIMEOUT )                     //check for timeout
-  {
-    return 0;
-  }
-
-  bitSet(_ReliableFlags, ReliableACKSent);
-  return _TXPacketL;                                            //TX OK so return TXpacket length
-}
-
-
-uint8_t SX126XLT::transmitSXBufferIRQ(uint8_t startaddr, uint8_t length, uint16_t timeout, int8_t txpower, uint8_t wait)
-{
-#ifdef SX126XDEBUG
-  Serial.println(F("transmitSXBuffer()"));
-#endif
-
-  setBufferBaseAddress(startaddr, 0);          //TX, RX
-  setPayloadLength(length);
-  setTxParams(txpower, RAMP_TIME);
-  setTx(timeout);                              //this starts the TX
-
-  if (!wait)
-  {
-    return _TXPacketL;
-  }
-
-  //0x0201   = IRQ_TX_DONE + IRQ_RX_TX_TIMEOUT
-  while (!(readIrqStatus() & 0x0201 ));        //wait for IRQs going active
-
-  setMode(MODE_STDBY_RC);                      //ensure we leave function with TX off
-
-  if (readIrqStatus() & IRQ_RX_TX_TIMEOUT )    //check for timeout
-  {
-    return 0;
-  }
-  else
-  {
-    return _TXPacketL;
-  }
-}
-
-
-uint8_t SX126XLT::receiveSXBufferIRQ(uint8_t startaddr, uint16_t timeout, uint8_t wait )
-{
-#ifdef SX126XDEBUG1
-  Serial.println(F("receiveSXBufferIRQ()"));
-#endif
-
-  uint8_t buffer[2];
-
-  setMode(MODE_STDBY_RC);
-  setBufferBaseAddress(0, startaddr);                //order is TX RX
-  setRx(timeout);
-
-  if (!wait)
-  {
-    return 0;
-  }
-
-  //0x0202   = IRQ_RX_DONE + IRQ_RX_TX_TIMEOUT
-  while (!(readIrqStatus() & 0x0202 ));              //wait for IRQs going active
-
-
-  setMode(MODE_STDBY_RC);                            //ensure to stop further packet reception
-
-  if ( readIrqStatus() & (IRQ_HEADER_ERROR + IRQ_CRC_ERROR + IRQ_RX_TX_TIMEOUT))
-  {
-    return 0;                                        //no RX done and header valid only, could be CRC error
-  }
-
-  readCommand(RADIO_GET_RXBUFFERSTATUS, buffer, 2);
-  _RXPacketL = buffer[0];
-
-  return _RXPacketL;
-}
-
-
-void SX126XLT::setReliableConfig(uint8_t bitset)
-{
-#ifdef SX126XDEBUGRELIABLE
-  Serial.print(F(" {RELIABLE} setReliableConfig() bit "));
-  Serial.println(bitset);
-#endif
-
-  bitSet(_ReliableConfig, bitset);
-  return;
-}
-
-
-void SX126XLT::clearReliableConfig(uint8_t bitset)
-{
-#ifdef SX126XDEBUGRELIABLE
-  Serial.print(F(" {RELIABLE} clearReliableConfig() bit "));
-  Serial.println(bitset);
-#endif
-
-  bitClear(_ReliableConfig, bitset);
-  return;
-}
-
-
-//***********************************************************************************
-//Data Transfer functions - Added December 2021
-//TX and RX base addresses assumed to be 0
-//***********************************************************************************
-
-uint8_t SX126XLT::transmitDT(uint8_t *header, uint8_t headersize, uint8_t *dataarray, uint8_t datasize, uint16_t networkID, uint32_t txtimeout, int8_t txpower, uint8_t wait)
-{
-#ifdef SX126XDEBUGRELIABLE
-  Serial.println(F(" {RELIABLE} transmitDT() "));
-#endif
-
-  uint8_t index, bufferdata;
-  uint16_t payloadcrc;
-
-  _ReliableErrors = 0;
-  _ReliableFlags = 0;
-
-#ifdef DETECTRELIABLERRORS
-  if (datasize > (251 - headersize))                  //its 251 because of 4 bytes appended to packet
-  {
-    bitSet(_ReliableErrors, ReliableSizeError);
-    return 0;
-  }
-#endif
-  setMode(MODE_STDBY_RC);
-  _TXPacketL = headersize + datasize + 4;
-
-  if (bitRead(_ReliableConfig, NoReliableCRC))
-  {
-    payloadcrc = 0;
-  }
-  else
-  {
-    payloadcrc = CRCCCITT(dataarray, datasize, 0xFFFF);
-  }
-
-  checkBusy();
-
-#ifdef USE_SPI_TRANSACTION
-  SPI.beginTransaction(SPISettings(LTspeedMaximum, LTdataOrder, LTdataMode));
-#endif
-
-  digitalWrite(_NSS, LOW);
-  SPI.transfer(RADIO_WRITE_BUFFER);
-  SPI.transfer(0);
-
-  //load up the header
-  for (index = 0; index < headersize; index++)
-  {
-    bufferdata = header[index];
-    SPI.transfer(bufferdata);
-  }
-
-  //load up the data array
-  for (index = 0; index < datasize; index++)
-  {
-    bufferdata = dataarray[index];
-    SPI.transfer(bufferdata);
-  }
-
-  //append the network ID and payload CRC at end
-  SPI.transfer(lowByte(networkID));
-  SPI.transfer(highByte(networkID));
-  SPI.transfer(lowByte(payloadcrc));
-  SPI.transfer(highByte(payloadcrc));
-
-  digitalWrite(_NSS, HIGH);
-
-#ifdef USE_SPI_TRANSACTION
-  SPI.endTransaction();
-#endif
-
-  setPayloadLength(_TXPacketL);
-  setTxParams(txpower, RAMP_TIME);
-  setDioIrqParams(IRQ_RADIO_ALL, (IRQ_TX_DONE + IRQ_RX_TX_TIMEOUT), 0, 0);   //set for IRQ on TX done and timeout on DIO1
-  setTx(txtimeout);
-
-  if (!wait)
-  {
-    return _TXPacketL;
-  }
-
-  while (!digitalRead(_TXDonePin));                                //Wait for DIO1 to go high
-
-  setMode(MODE_STDBY_RC);                                          //ensure we leave function with TX off
-
-  if (readIrqStatus() & IRQ_RX_TX_TIMEOUT )                        //check for timeout
-  {
-    return 0;
-  }
-  else
-  {
-    return _TXPacketL;
-  }
-
-  if (readIrqStatus() & IRQ_RX_TX_TIMEOUT )                        //check for timeout
-  {
-    return 0;
-  }
-  else
-  {
-    return _TXPacketL;
-  }
-}
-
-
-uint8_t SX126XLT::sendACKDT(uint8_t *header, uint8_t headersize, int8_t txpower)
-{
-
-#ifdef SX126XDEBUGRELIABLE
-  Serial.print(F(" {RELIABLE} sendACKDT() "));
-#endif
-
-  uint32_t txtimeout = 12000;                                     //set TX timeout to 12 seconds, longest packet is 8.7secs
-  uint8_t bufferdata, index;
-  uint16_t networkID;
-  uint16_t payloadCRC;
-
-  setMode(MODE_STDBY_RC);
-  _TXPacketL = headersize + 4;
-  networkID = readUint16SXBuffer(_RXPacketL - 4);
-  payloadCRC = readUint16SXBuffer(_RXPacketL - 2);
-  checkBusy();
-
-#ifdef USE_SPI_TRANSACTION
-  SPI.beginTransaction(SPISettings(LTspeedMaximum, LTdataOrder, LTdataMode));
-#endif
-
-  digitalWrite(_NSS, LOW);
-  SPI.transfer(RADIO_WRITE_BUFFER);
-  SPI.transfer(0);
-
-  for (index = 0; index < headersize; index++)
-  {
-    bufferdata = header[index];
-    SPI.transfer(bufferdata);
-  }
-
-  SPI.transfer(lowByte(networkID));
-  SPI.transfer(highByte(networkID));
-  SPI.transfer(lowByte(payloadCRC));
-  SPI.transfer(highByte(payloadCRC));
-
-  digitalWrite(_NSS, HIGH);
-
-#ifdef USE_SPI_TRANSACTION
-  SPI.endTransaction();
-#endif
-
-  setPayloadLength(_TXPacketL);
-  setTxParams(txpower, RAMP_TIME);
-  setDioIrqParams(IRQ_RADIO_ALL, (IRQ_TX_DONE + IRQ_RX_TX_TIMEOUT), 0, 0);   //set for IRQ on TX done and timeout on DIO1
-  setTx(txtimeout);
-
-  while (!digitalRead(_TXDonePin));                                          //Wait for DIO1 to go high
-
-  if (readIrqStatus() & IRQ_RX_TX_TIMEOUT )                                  //check for timeout
-  {
-    bitSet(_ReliableFlags, ReliableTimeout);
-    return 0;
-  }
-
-  bitSet(_ReliableFlags, ReliableACKSent);
-  return _TXPacketL;                                                         //TX OK so return TXpacket length
-}
-
-
-uint8_t SX126XLT::receiveDT(uint8_t *header, uint8_t headersize, uint8_t *dataarray, uint8_t datasize, uint16_t networkID, uint32_t rxtimeout, uint8_t wait )
-{
-#ifdef SX126XDEBUGRELIABLE
-  Serial.println();
-  Serial.println(F(" {RELIABLE} receiveDT()"));
-  Serial.print(F(" {RELIABLE} _ReliableConfig "));
-  Serial.println(_ReliableConfig, HEX);
-#endif
-
-  uint16_t index, payloadcrc = 0, RXcrc, RXnetworkID = 0;
-  uint8_t regdataL, regdataH;
-  uint8_t RXHeaderL;
-  uint8_t RXDataL;
-  uint8_t buffer[2];
-  uint8_t RXstart;
-
-  _ReliableErrors = 0;
-  _ReliableFlags = 0;
-  setMode(MODE_STDBY_RC);
-  setDioIrqParams(IRQ_RADIO_ALL, (IRQ_RX_DONE + IRQ_RX_TX_TIMEOUT), 0, 0);
-  setRx(rxtimeout);
-
-  if (!wait)
-  {
-    return 0;                                            //not wait requested so no packet length to pass
-  }
-
-  while (!digitalRead(_RXDonePin));                      //Wait for DIO1 to go high, no timeout, RX DONE
-
-  setMode(MODE_STDBY_RC);                                //ensure to stop further packet reception
-
-  //IRQ_HEADER_ERROR + IRQ_CRC_ERROR + IRQ_RX_TX_TIMEOUT = 0x0260
-  if (readIrqStatus() & 0x0260)
-  {
-#ifdef SX126XDEBUGRELIABLE
-    Serial.println(F(" {RELIABLE} Packet error"));
-#endif
-    return 0;                                            //packet is errored somewhere so return 0
-  }
-
-  RXHeaderL = getByteSXBuffer(2);
-  RXDataL = getByteSXBuffer(3);
-
-  readCommand(RADIO_GET_RXBUFFERSTATUS, buffer, 2);
-  _RXPacketL = buffer[0];
-  RXstart = buffer[1];
-
-#ifdef SX126XDEBUGRELIABLE
-  Serial.print(F(" {RELIABLE} Header  "));
-  printSXBufferHEX(0, (RXHeaderL - 1));
-  Serial.println();
-  Serial.print(F(" {RELIABLE} Received data payload size "));
-  Serial.println(RXDataL);
-  Serial.print(F(" {RELIABLE} Data payload  "));
-  printSXBufferHEX(RXHeaderL, RXHeaderL + RXDataL - 1);
-  Serial.println();
-#endif
-
-  if (RXHeaderL > headersize )
-  {
-#ifdef SX126XDEBUGRELIABLE
-    Serial.print(F(" {RELIABLE} Header size error "));
-    Serial.println(headersize);
-#endif
-    bitSet(_ReliableErrors, ReliableSizeError);
-    return 0;
-  }
-
-  if (RXDataL > datasize )
-  {
-#ifdef SX126XDEBUGRELIABLE
-    Serial.print(F(" {RELIABLE} Data size error "));
-    Serial.println(datasize);
-#endif
-    bitSet(_ReliableErrors, ReliableSizeError);
-    return 0;
-  }
-
-#ifdef SX126XDEBUGRELIABLE
-  Serial.print(F(" {RELIABLE} _RXPacketL  "));
-  Serial.println(_RXPacketL);
-  Serial.print(F(" {RELIABLE} Header  "));
-  printSXBufferHEX(0, (RXHeaderL - 1));
-  Serial.println();
-  Serial.print(F(" {RELIABLE} Received data payload size "));
-  Serial.println(RXDataL);
-  Serial.print(F(" {RELIABLE} Data payload  "));
-  printSXBufferHEX(RXHeaderL, RXHeaderL + RXDataL - 1);
-  Serial.println();
-#endif
-
-  if (_RXPacketL < 10)                                      //check received packet is 10 or more bytes long
-  {
-    bitSet(_ReliableErrors, ReliableSizeError);
-    return 0;
-  }
-
-  checkBusy();
-
-#ifdef USE_SPI_TRANSACTION
-  SPI.beginTransaction(SPISettings(LTspeedMaximum, LTdataOrder, LTdataMode));
-#endif
-
-  digitalWrite(_NSS, LOW);             //start the burst read
-  SPI.transfer(RADIO_READ_BUFFER);
-  SPI.transfer(RXstart);
-  SPI.transfer(0xFF);
-
-  for (index = 0; index < RXHeaderL; index++)
-  {
-    regdataL = SPI.transfer(0);
-    header[index] = regdataL;
-  }
-
-  for (index = 0; index < RXDataL; index++)
-  {
-    regdataL = SPI.transfer(0);
-    dataarray[index] = regdataL;
-  }
-
-  regdataL = SPI.transfer(0);
-  regdataH = SPI.transfer(0);
-  RXnetworkID = ((uint16_t) regdataH << 8) + regdataL;
-  regdataL = SPI.transfer(0);
-  regdataH = SPI.transfer(0);
-
-  digitalWrite(_NSS, HIGH);
-
-#ifdef USE_SPI_TRANSACTION
-  SPI.endTransaction();
-#endif
-
-  if (!bitRead(_ReliableConfig, NoReliableCRC))
-  {
-    payloadcrc = CRCCCITT(dataarray, RXDataL, 0xFFFF);
-    RXcrc = ((uint16_t) regdataH << 8) + regdataL;
-
-#ifdef SX126XDEBUGRELIABLE
-    Serial.println(F(" {RELIABLE} Payload CRC check enabled"));
-    Serial.print(F(" {RELIABLE} payloadcrc 0x"));
-    Serial.println(payloadcrc, HEX);
-    Serial.print(F(" {RELIABLE} RXcrc 0x"));
-    Serial.println(RXcrc, HEX);
-#endif
-
-    if (payloadcrc != RXcrc)
-    {
-      bitSet(_ReliableErrors, ReliableCRCError);
-#ifdef SX126XDEBUGRELIABLE
-      Serial.print(F(" {RELIABLE} CRCmissmatch, received 0x"));
-      Serial.println(RXcrc, HEX);
-#endif
-    }
-  }
-
-#ifdef SX126XDEBUGRELIABLE
-  Serial.print(F(" {RELIABLE} RXnetworkID 0x"));
-  Serial.println(RXnetworkID, HEX);
-#endif
-
-  if (RXnetworkID != networkID)
-  {
-#ifdef SX126XDEBUGRELIABLE
-    Serial.print(F(" {RELIABLE} NetworkID missmatch received 0x"));
-    Serial.print(RXnetworkID, HEX);
-    Serial.print(F(" LocalID 0x"));
-    Serial.println(networkID, HEX);
-#endif
-    bitSet(_ReliableErrors, ReliableIDError);
-  }
-
-  if (_ReliableErrors)                                            //if there has been a reliable error return a RX fail
-  {
-#ifdef SX126XDEBUGRELIABLE
-    Serial.print(F(" {RELIABLE} Reliable errors"));
-#endif
-
-    return 0;
-  }
-
-  return _RXPacketL;                                              //return and indicate RX OK.
-}
-
-
-uint8_t SX126XLT::waitACKDT(uint8_t *header, uint8_t headersize, uint32_t acktimeout)
-{
-
-#ifdef SX126XDEBUGRELIABLE
-  Serial.println(F(" {RELIABLE} waitACKDT()"));
-#endif
-
-  uint16_t RXnetworkID, RXcrc;
-  uint32_t startmS;
-  uint8_t regdata, index;
-  uint16_t networkID;
-  uint16_t payloadCRC;
-  uint8_t buffer[2];
-
-  _ReliableErrors = 0;
-  _ReliableFlags = 0;
-
-  networkID = readUint16SXBuffer(_TXPacketL - 4);              //get networkID used to transmit previous packet, before next RX
-  payloadCRC = readUint16SXBuffer(_TXPacketL - 2);             //get payloadCRC used to transmit previous packet, before next RX
-
-  setReliableRX(0);
-  startmS = millis();                                          //setReliableRX has a timeount, but here we want an overall timeout waiting for ACK
-
-  do
-  {
-    if (digitalRead(_RXDonePin))                               //has a packet arrived ?
-    {
-      setMode(MODE_STDBY_RC);                                  //ensure to stop further packet reception
-
-      //IRQ_HEADER_ERROR + IRQ_CRC_ERROR + IRQ_RX_TX_TIMEOUT = 0x0260
-      if (readIrqStatus() & 0x0260)
-      {
-        setReliableRX(0);
-        continue;
-      }
-      readCommand(RADIO_GET_RXBUFFERSTATUS, buffer, 2);
-      _RXPacketL = buffer[0];
-      RXnetworkID = readUint16SXBuffer(_RXPacketL - 4);
-      RXcrc = readUint16SXBuffer(_RXPacketL - 2);
-
-      if ((_RXPacketL - 4) > headersize )                       //check passed buffer is big enough for header
-      {
-        setReliableRX(0);
-        continue;
-      }
-
-      if (!bitRead(_ReliableConfig, NoReliableCRC))
-      {
-        if (payloadCRC != RXcrc)
-        {
-          bitSet(_ReliableErrors, ReliableCRCError);
-          setReliableRX(0);
-          continue;
-        }
-      }
-
-      if ( (RXnetworkID == networkID))
-      {
-        bitSet(_ReliableFlags, ReliableACKReceived);
-
-        checkBusy();
-
-#ifdef USE_SPI_TRANSACTION
-        SPI.beginTransaction(SPISettings(LTspeedMaximum, LTdataOrder, LTdataMode));
-#endif
-
-        digitalWrite(_NSS, LOW);                                //start the burst read
-        SPI.transfer(RADIO_READ_BUFFER);
-        SPI.transfer(0);
-        SPI.transfer(0xFF);
-
-        for (index = 0; index < (_RXPacketL - 4); index++)      //read packet into rxbuffer
-        {
-          regdata = SPI.transfer(0);
-          header[index] = regdata;
-        }
-        digitalWrite(_NSS, HIGH);
-
-#ifdef USE_SPI_TRANSACTION
-        SPI.endTransaction();
-#endif
-
-        return _RXPacketL;                                      //_RXPacketL should be payload length + 4
-      }
-      else
-      {
-        setReliableRX(0);
-        continue;
-      }
-    }
-  } while ( ((uint32_t) (millis() - startmS) < acktimeout));
-
-  bitSet(_ReliableErrors, ReliableACKError);
-  bitSet(_ReliableErrors, ReliableTimeout);
-
-  return 0;
-}
-
-
-uint16_t SX126XLT::getTXNetworkID(uint8_t length)
-{
-#ifdef SX126XDEBUGRELIABLE
-  Serial.println(F(" {RELIABLE} getTXnetworkID() "));
-#endif
-
-  return readUint16SXBuffer(length - 4);
-}
-
-uint8_t SX126XLT::readReliableErrors()
-{
-#ifdef SX126XDEBUGRELIABLE
-  Serial.println(F(" {RELIABLE} readReliableErrors()"));
-#endif
-
-  return _ReliableErrors;
-}
-
-uint8_t SX126XLT::readReliableFlags()
-{
-#ifdef SX126XDEBUGRELIABLE
-  Serial.println(F(" {RELIABLE} readReliableFlags()"));
-#endif
-
-  return _ReliableFlags;
-}
-
-
-uint8_t SX126XLT::sendACKDTIRQ(uint8_t *header, uint8_t headersize, int8_t txpower)
-{
-
-#ifdef SX126XDEBUGRELIABLE
-  Serial.print(F(" {RELIABLE} sendACKDT() "));
-#endif
-
-  uint32_t txtimeout = 12000;                                     //set TX timeout to 12 seconds, longest packet is 8.7secs
-  uint8_t bufferdata, index;
-  uint16_t networkID;
-  uint16_t payloadCRC;
-
-  setMode(MODE_STDBY_RC);
-  _TXPacketL = headersize + 4;
-  networkID = readUint16SXBuffer(_RXPacketL - 4);
-  payloadCRC = readUint16SXBuffer(_RXPacketL - 2);
-  checkBusy();
-
-#ifdef USE_SPI_TRANSACTION
-  SPI.beginTransaction(SPISettings(LTspeedMaximum, LTdataOrder, LTdataMode));
-#endif
-
-  digitalWrite(_NSS, LOW);
-  SPI.transfer(RADIO_WRITE_BUFFER);
-  SPI.transfer(0);
-
-  for (index = 0; index < headersize; index++)
-  {
-    bufferdata = header[index];
-    SPI.transfer(bufferdata);
-  }
-
-  SPI.transfer(lowByte(networkID));
-  SPI.transfer(highByte(networkID));
-  SPI.transfer(lowByte(payloadCRC));
-  SPI.transfer(highByte(payloadCRC));
-
-  digitalWrite(_NSS, HIGH);
-
-#ifdef USE_SPI_TRANSACTION
-  SPI.endTransaction();
-#endif
-
-  setPayloadLength(_TXPacketL);
-  setTxParams(txpower, RAMP_TIME);
-  setDioIrqParams(IRQ_RADIO_ALL, (IRQ_TX_DONE + IRQ_RX_TX_TIMEOUT), 0, 0);   //set for IRQ on TX done and timeout on DIO1
-  setTx(txtimeout);
-
-  while (!(readIrqStatus() & 0x201 ));                                       //wait for IRQs going active
-
-  if (readIrqStatus() & IRQ_RX_TX_TIMEOUT )                                  //check for timeout
-  {
-    bitSet(_ReliableFlags, ReliableTimeout);
-    return 0;
-  }
-
-  bitSet(_ReliableFlags, ReliableACKSent);
-  return _TXPacketL;                                                         //TX OK so return TXpacket length
-}
-
-
-uint8_t SX126XLT::waitACKDTIRQ(uint8_t *header, uint8_t headersize, uint32_t acktimeout)
-{
-
-#ifdef SX126XDEBUGRELIABLE
-  Serial.println(F(" {RELIABLE} waitACKDTIRQ()"));
-#endif
-
-  uint16_t RXnetworkID, RXcrc;
-  uint32_t startmS;
-  uint8_t regdata, index;
-  uint16_t networkID;
-  uint16_t payloadCRC;
-  uint8_t buffer[2];
-
-  _ReliableErrors = 0;
-  _ReliableFlags = 0;
-
-  networkID = readUint16SXBuffer(_TXPacketL - 4);              //get networkID used to transmit previous packet, before next RX
-  payloadCRC = readUint16SXBuffer(_TXPacketL - 2);             //get payloadCRC used to transmit previous packet, before next RX
-
-  setReliableRX(0);
-  startmS = millis();                                          //setReliableRX has a timeount, but here we want an overall timeout waiting for ACK
-
-  do
-  {
-    //0x02   = IRQ_RX_DONE
-    if (readIrqStatus() & 0x02)                                //has a packet arrived?
-    {
-      setMode(MODE_STDBY_RC);                                  //ensure to stop further packet reception
-
-      //IRQ_HEADER_ERROR + IRQ_CRC_ERROR + IRQ_RX_TX_TIMEOUT = 0x0260
-      if (readIrqStatus() & 0x0260)
-      {
-        setReliableRX(0);
-        continue;
-      }
-      readCommand(RADIO_GET_RXBUFFERSTATUS, buffer, 2);
-      _RXPacketL = buffer[0];
-      RXnetworkID = readUint16SXBuffer(_RXPacketL - 4);
-      RXcrc = readUint16SXBuffer(_RXPacketL - 2);
-
-      if ((_RXPacketL - 4) > headersize )                       //check passed buffer is big enough for header
-      {
-        setReliableRX(0);
-        continue;
-      }
-
-      if (!bitRead(_ReliableConfig, NoReliableCRC))
-      {
-        if (payloadCRC != RXcrc)
-        {
-          bitSet(_ReliableErrors, ReliableCRCError);
-          setReliableRX(0);
-          continue;
-        }
-      }
-
-      if ( (RXnetworkID == networkID))
-      {
-        bitSet(_ReliableFlags, ReliableACKReceived);
-
-        checkBusy();
-
-#ifdef USE_SPI_TRANSACTION
-        SPI.beginTransaction(SPISettings(LTspeedMaximum, LTdataOrder, LTdataMode));
-#endif
-
-        digitalWrite(_NSS, LOW);                                //start the burst read
-        SPI.transfer(RADIO_READ_BUFFER);
-        SPI.transfer(0);
-        SPI.transfer(0xFF);
-
-        for (index = 0; index < (_RXPacketL - 4); index++)      //read packet into rxbuffer
-        {
-          regdata = SPI.transfer(0);
-          header[index] = regdata;
-        }
-        digitalWrite(_NSS, HIGH);
-
-#ifdef USE_SPI_TRANSACTION
-        SPI.endTransaction();
-#endif
-
-        return _RXPacketL;                                      //_RXPacketL should be payload length + 4
-      }
-      else
-      {
-        setReliableRX(0);
-        continue;
-      }
-    }
-  } while ( ((uint32_t) (millis() - startmS) < acktimeout));
-
-  bitSet(_ReliableErrors, ReliableACKError);
-  bitSet(_ReliableErrors, ReliableTimeout);
-
-  return 0;
-}
-
-
-uint8_t SX126XLT::receiveDTIRQ(uint8_t *header, uint8_t headersize, uint8_t *dataarray, uint8_t datasize, uint16_t networkID, uint32_t rxtimeout, uint8_t wait )
-{
-#ifdef SX126XDEBUGRELIABLE
-  Serial.println();
-  Serial.println(F(" {RELIABLE} receiveDTIRQ()"));
-  Serial.print(F(" {RELIABLE} _ReliableConfig "));
-  Serial.println(_ReliableConfig, HEX);
-#endif
-
-  uint16_t index, payloadcrc = 0, RXcrc, RXnetworkID = 0;
-  uint8_t regdataL, regdataH;
-  uint8_t RXHeaderL;
-  uint8_t RXDataL;
-  uint8_t buffer[2];
-  uint8_t RXstart;
-
-  _ReliableErrors = 0;
-  _ReliableFlags = 0;
-  setMode(MODE_STDBY_RC);
-  setDioIrqParams(IRQ_RADIO_ALL, (IRQ_RX_DONE + IRQ_RX_TX_TIMEOUT), 0, 0);
-  setRx(rxtimeout);
-
-  if (!wait)
-  {
-    return 0;                                           //not wait requested so no packet length to pass
-  }
-
-  //0x202   = IRQ_RX_TIMEOUT + IRQ_RX_DONE
-  while (!(readIrqStatus() & 0x202));                   //Wait for RX Done IRQ to go high
-
-  setMode(MODE_STDBY_RC);                               //ensure to stop further packet reception
-
-  //IRQ_HEADER_ERROR + IRQ_CRC_ERROR + IRQ_RX_TX_TIMEOUT = 0x0260
-  if (readIrqStatus() & 0x0260)
-  {
-#ifdef SX126XDEBUGRELIABLE
-    Serial.println(F(" {RELIABLE} Packet error"));
-#endif
-    return 0;                                            //packet is errored somewhere so return 0
-  }
-
-  RXHeaderL = getByteSXBuffer(2);
-  RXDataL = getByteSXBuffer(3);
-
-  readCommand(RADIO_GET_RXBUFFERSTATUS, buffer, 2);
-  _RXPacketL = buffer[0];
-  RXstart = buffer[1];
-
-#ifdef SX126XDEBUGRELIABLE
-  Serial.print(F(" {RELIABLE} Header  "));
-  printSXBufferHEX(0, (RXHeaderL - 1));
-  Serial.println();
-  Serial.print(F(" {RELIABLE} Received data payload size "));
-  Serial.println(RXDataL);
-  Serial.print(F(" {RELIABLE} Data payload  "));
-  printSXBufferHEX(RXHeaderL, RXHeaderL + RXDataL - 1);
-  Serial.println();
-#endif
-
-  if (RXHeaderL > headersize )
-  {
-#ifdef SX126XDEBUGRELIABLE
-    Serial.print(F(" {RELIABLE} Header size error "));
-    Serial.println(headersize);
-#endif
-    bitSet(_ReliableErrors, ReliableSizeError);
-    return 0;
-  }
-
-  if (RXDataL > datasize )
-  {
-#ifdef SX126XDEBUGRELIABLE
-    Serial.print(F(" {RELIABLE} Data size error "));
-    Serial.println(datasize);
-#endif
-    bitSet(_ReliableErrors, ReliableSizeError);
-    return 0;
-  }
-
-#ifdef SX126XDEBUGRELIABLE
-  Serial.print(F(" {RELIABLE} _RXPacketL  "));
-  Serial.println(_RXPacketL);
-  Serial.print(F(" {RELIABLE} Header  "));
-  printSXBufferHEX(0, (RXHeaderL - 1));
-  Serial.println();
-  Serial.print(F(" {RELIABLE} Received data payload size "));
-  Serial.println(RXDataL);
-  Serial.print(F(" {RELIABLE} Data payload  "));
-  printSXBufferHEX(RXHeaderL, RXHeaderL + RXDataL - 1);
-  Serial.println();
-#endif
-
-  if (_RXPacketL < 10)                                      //check received packet is 10 or more bytes long
-  {
-    bitSet(_ReliableErrors, ReliableSizeError);
-    return 0;
-  }
-
-  checkBusy();
-
-#ifdef USE_SPI_TRANSACTION
-  SPI.beginTransaction(SPISettings(LTspeedMaximum, LTdataOrder, LTdataMode));
-#endif
-
-  digitalWrite(_NSS, LOW);             //start the burst read
-  SPI.transfer(RADIO_READ_BUFFER);
-  SPI.transfer(RXstart);
-  SPI.transfer(0xFF);
-
-  for (index = 0; index < RXHeaderL; index++)
-  {
-    regdataL = SPI.transfer(0);
-    header[index] = regdataL;
-  }
-
-  for (index = 0; index < RXDataL; index++)
-  {
-    regdataL = SPI.transfer(0);
-    dataarray[index] = regdataL;
-  }
-
-  regdataL = SPI.transfer(0);
-  regdataH = SPI.transfer(0);
-  RXnetworkID = ((uint16_t) regdataH << 8) + regdataL;
-  regdataL = SPI.transfer(0);
-  regdataH = SPI.transfer(0);
-
-  digitalWrite(_NSS, HIGH);
-
-#ifdef USE_SPI_TRANSACTION
-  SPI.endTransaction();
-#endif
-
-  if (!bitRead(_ReliableConfig, NoReliableCRC))
-  {
-    payloadcrc = CRCCCITT(dataarray, RXDataL, 0xFFFF);
-    RXcrc = ((uint16_t) regdataH << 8) + regdataL;
-
-#ifdef SX126XDEBUGRELIABLE
-    Serial.println(F(" {RELIABLE} Payload CRC check enabled"));
-    Serial.print(F(" {RELIABLE} payloadcrc 0x"));
-    Serial.println(payloadcrc, HEX);
-    Serial.print(F(" {RELIABLE} RXcrc 0x"));
-    Serial.println(RXcrc, HEX);
-#endif
-
-    if (payloadcrc != RXcrc)
-    {
-      bitSet(_ReliableErrors, ReliableCRCError);
-#ifdef SX126XDEBUGRELIABLE
-      Serial.print(F(" {RELIABLE} CRCmissmatch, received 0x"));
-      Serial.println(RXcrc, HEX);
-#endif
-    }
-  }
-
-#ifdef SX126XDEBUGRELIABLE
-  Serial.print(F(" {RELIABLE} RXnetworkID 0x"));
-  Serial.println(RXnetworkID, HEX);
-#endif
-
-  if (RXnetworkID != networkID)
-  {
-#ifdef SX126XDEBUGRELIABLE
-    Serial.print(F(" {RELIABLE} NetworkID missmatch received 0x"));
-    Serial.print(RXnetworkID, HEX);
-    Serial.print(F(" LocalID 0x"));
-    Serial.println(networkID, HEX);
-#endif
-    bitSet(_ReliableErrors, ReliableIDError);
-  }
-
-  if (_ReliableErrors)                                            //if there has been a reliable error return a RX fail
-  {
-#ifdef SX126XDEBUGRELIABLE
-    Serial.print(F(" {RELIABLE} Reliable errors"));
-#endif
-
-    return 0;
-  }
-
-  return _RXPacketL;                                              //return and indicate RX OK.
-}
-
-
-uint8_t SX126XLT::transmitDTIRQ(uint8_t *header, uint8_t headersize, uint8_t *dataarray, uint8_t datasize, uint16_t networkID, uint32_t txtimeout, int8_t txpower, uint8_t wait)
-{
-#ifdef SX126XDEBUGRELIABLE
-  Serial.println(F(" {RELIABLE} transmitDT() "));
-#endif
-
-  uint8_t index, bufferdata;
-  uint16_t payloadcrc;
-
-  _ReliableErrors = 0;
-  _ReliableFlags = 0;
-
-#ifdef DETECTRELIABLERRORS
-  if (datasize > (251 - headersize))                  //its 251 because of 4 bytes appended to packet
-  {
-    bitSet(_ReliableErrors, ReliableSizeError);
-    return 0;
-  }
-#endif
-  setMode(MODE_STDBY_RC);
-  _TXPacketL = headersize + datasize + 4;
-
-  if (bitRead(_ReliableConfig, NoReliableCRC))
-  {
-    payloadcrc = 0;
-  }
-  else
-  {
-    payloadcrc = CRCCCITT(dataarray, datasize, 0xFFFF);
-  }
-
-  checkBusy();
-
-#ifdef USE_SPI_TRANSACTION
-  SPI.beginTransaction(SPISettings(LTspeedMaximum, LTdataOrder, LTdataMode));
-#endif
-
-  digitalWrite(_NSS, LOW);
-  SPI.transfer(RADIO_WRITE_BUFFER);
-  SPI.transfer(0);
-
-  //load up the header
-  for (index = 0; index < headersize; index++)
-  {
-    bufferdata = header[index];
-    SPI.transfer(bufferdata);
-  }
-
-  //load up the data array
-  for (index = 0; index < datasize; index++)
-  {
-    bufferdata = dataarray[index];
-    SPI.transfer(bufferdata);
-  }
-
-  //append the network ID and payload CRC at end
-  SPI.transfer(lowByte(networkID));
-  SPI.transfer(highByte(networkID));
-  SPI.transfer(lowByte(payloadcrc));
-  SPI.transfer(highByte(payloadcrc));
-
-  digitalWrite(_NSS, HIGH);
-
-#ifdef USE_SPI_TRANSACTION
-  SPI.endTransaction();
-#endif
-
-  setPayloadLength(_TXPacketL);
-  setTxParams(txpower, RAMP_TIME);
-  setDioIrqParams(IRQ_RADIO_ALL, (IRQ_TX_DONE + IRQ_RX_TX_TIMEOUT), 0, 0);   //set for IRQ on TX done and timeout on DIO1
-  setTx(txtimeout);
-
-  if (!wait)
-  {
-    return _TXPacketL;
-  }
-
-  while (!(readIrqStatus() & 0x201 ));                                       //wait for IRQs going active
-
-  setMode(MODE_STDBY_RC);                                          //ensure we leave function with TX off
-
-  if (readIrqStatus() & IRQ_RX_TX_TIMEOUT )                        //check for timeout
-  {
-    return 0;
-  }
-  else
-  {
-    return _TXPacketL;
-  }
-
-  if (readIrqStatus() & IRQ_RX_TX_TIMEOUT )                        //check for timeout
-  {
-    return 0;
-  }
-  else
-  {
-    return _TXPacketL;
-  }
-}
 
 /*
   MIT license
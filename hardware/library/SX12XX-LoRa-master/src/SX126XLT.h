@@ -12,9 +12,24 @@
 
 #include "Arduino.h"
 #include <SX126XLT_Definitions.h>
+#include <LTLoRaConfig.h>
+#include <LTReliableCore.h>
 
+#define SX126XBusyStatsSize 16      //commands with their own BUSY wait counters
+#define SX126XQueueSize 6           //commands held by beginCommandQueue()
+#define SX126XQueueBytes 9          //parameters of the longest command queued, setPacketParams()
 
-class SX126XLT  {
+
+struct SX126XBusyStat
+{
+  uint32_t waituS;                  //total time waited for BUSY to go low after them
+  uint16_t count;                   //commands sent
+  uint16_t maxuS;                   //longest wait
+  uint8_t opcode;                   //command, 0 for buffer accesses and commands sent directly
+};
+
+
+class SX126XLT : public LTReliableCore<SX126XLT>  {
   public:
 
     SX126XLT();
@@ -26,6 +41,12 @@ class SX126XLT  {
     bool begin(int8_t pinNSS, int8_t pinNRESET, int8_t pinRFBUSY, uint8_t device);
 
     void checkBusy();
+    void setBusyInterrupt(bool enable);
+    void beginCommandQueue();
+    void endCommandQueue();
+    uint8_t getBusyStats(SX126XBusyStat *stats, uint8_t size);
+    void resetBusyStats();
+    uint16_t getBusyTimeouts();
     void writeCommand(uint8_t Opcode, uint8_t *buffer, uint16_t size );
     void readCommand( uint8_t Opcode, uint8_t *buffer, uint16_t size );
     void writeRegisters( uint16_t address, uint8_t *buffer, uint16_t size );
@@ -35,6 +56,7 @@ class SX126XLT  {
     void resetDevice();
     bool checkDevice();
     void setupLoRa(uint32_t frequency, int32_t offset, uint8_t modParam1, uint8_t modParam2, uint8_t  modParam3, uint8_t modParam4);
+    void applyConfig(const LTSX126XConfig &config);   //setupLoRa() from the parameters of LTLoRaConfig.h
     void setMode(uint8_t modeconfig);
     void setRegulatorMode(uint8_t mode);
 
@@ -50,6 +72,7 @@ class SX126XLT  {
     uint8_t returnOptimisation(uint8_t SpreadingFactor, uint8_t Bandwidth);
     uint32_t returnBandwidth(uint8_t BWregvalue);
     float calcSymbolTime(float Bandwidth, uint8_t SpreadingFactor);
+    uint32_t getTimeOnAiruS(uint8_t packetL);
     void setBufferBaseAddress(uint8_t txBaseAddress, uint8_t rxBaseAddress);
     void setPacketParams(uint16_t packetParam1, uint8_t  packetParam2, uint8_t packetParam3, uint8_t packetParam4, uint8_t packetParam5);
     void setDioIrqParams(uint16_t irqMask, uint16_t dio1Mask, uint16_t dio2Mask, uint16_t dio3Mask );
@@ -184,35 +207,21 @@ class SX126XLT  {
     // Routines assume that RX and TX buffer base addresses are set to 0 by setupLoRa()
     //**********************************************************************************************
 
+    //transmitReliable(), receiveReliable(), the AutoACK, ACK and SX variants, pollReliable() and the other
+    //non blocking functions, setReliablePreamble() and readReliableACKRSSI() etc are in LTReliableCore.h
+    //Their NetworkID is 0 to 0x7FFF, bit 15 is ReliableSequenceID, others are a ReliableIDError
+
     void printASCIIArray(uint8_t *buffer, uint8_t size);
     uint8_t getReliableConfig(uint8_t bitread);
     void printReliableStatus();
-    uint8_t transmitReliable(uint8_t *txbuffer, uint8_t size, uint16_t networkID, uint32_t txtimeout, int8_t txpower, uint8_t wait);
     uint16_t getTXPayloadCRC(uint8_t length);
     uint16_t readUint16SXBuffer(uint8_t addr);
     void setPayloadLength(uint8_t length);
-    uint8_t receiveReliable(uint8_t *rxbuffer, uint8_t size, uint16_t networkID, uint32_t rxtimeout, uint8_t wait );
     uint16_t getRXNetworkID(uint8_t length);
     uint16_t getRXPayloadCRC(uint8_t length);
-    uint8_t transmitSXReliable(uint8_t startaddr, uint8_t length, uint16_t networkID, uint32_t txtimeout, int8_t txpower, uint8_t wait);
-    uint8_t receiveSXReliable(uint8_t startaddr, uint16_t networkID, uint32_t rxtimeout, uint8_t wait );
     uint16_t CRCCCITTReliable(uint8_t startadd, uint8_t endadd, uint16_t startvalue);
     void writeUint16SXBuffer(uint8_t addr, uint16_t regdata);
-    uint8_t transmitReliableAutoACK(uint8_t *txbuffer, uint8_t size, uint16_t networkID, uint32_t acktimeout, uint32_t txtimeout, int8_t txpower, uint8_t wait);
-    uint8_t waitReliableACK(uint16_t networkID, uint16_t payloadcrc, uint32_t acktimeout);
-    uint8_t waitReliableACK(uint8_t *rxbuffer, uint8_t size, uint16_t networkID, uint16_t payloadcrc, uint32_t acktimeout);
     void setReliableRX(uint16_t timeout);
-    uint8_t receiveReliableAutoACK(uint8_t *rxbuffer, uint8_t size, uint16_t networkID, uint32_t ackdelay, int8_t txpower, uint32_t rxtimeout, uint8_t wait );
-    uint8_t sendReliableACK(uint16_t networkID, uint16_t payloadcrc, int8_t txpower);
-    uint8_t sendReliableACK(uint8_t *txbuffer, uint8_t size, uint16_t networkID, uint16_t payloadcrc, int8_t txpower);
-    uint8_t transmitSXReliableAutoACK(uint8_t startaddr, uint8_t length, uint16_t networkID, uint32_t acktimeout, uint32_t txtimeout, int8_t txpower, uint8_t wait);
-    uint8_t receiveSXReliableAutoACK(uint8_t startaddr, uint16_t networkID, uint32_t ackdelay, int8_t txpower, uint32_t rxtimeout, uint8_t wait );
-    uint8_t waitSXReliableACK(uint8_t startaddr, uint16_t networkID, uint16_t payloadcrc, uint32_t acktimeout);
-    uint8_t sendSXReliableACK(uint8_t startaddr, uint8_t length, uint16_t networkID, uint16_t payloadcrc, int8_t txpower);
-    uint8_t transmitSXReliableIRQ(uint8_t startaddr, uint8_t length, uint16_t networkID, uint32_t txtimeout, int8_t txpower, uint8_t wait);
-    uint8_t waitSXReliableACKIRQ(uint8_t startaddr, uint16_t networkID, uint16_t payloadcrc, uint32_t acktimeout);
-    uint8_t receiveSXReliableIRQ(uint8_t startaddr, uint16_t networkID, uint32_t rxtimeout, uint8_t wait );
-    uint8_t sendSXReliableACKIRQ(uint8_t startaddr, uint8_t length, uint16_t networkID, uint16_t payloadcrc, int8_t txpower);
     uint8_t transmitSXBufferIRQ(uint8_t startaddr, uint8_t length, uint16_t timeout, int8_t txpower, uint8_t wait);
     uint8_t receiveSXBufferIRQ(uint8_t startaddr, uint16_t timeout, uint8_t wait );
     void setReliableConfig(uint8_t bitset);
@@ -223,17 +232,12 @@ class SX126XLT  {
     //TX and RX base addresses assumed to be 0
     //***********************************************************************************
 
-    uint8_t transmitDT(uint8_t *header, uint8_t headersize, uint8_t *dataarray, uint8_t datasize, uint16_t networkID, uint32_t txtimeout, int8_t txpower, uint8_t wait);
-    uint8_t sendACKDT(uint8_t *header, uint8_t headersize, int8_t txpower);
-    uint8_t receiveDT(uint8_t *header, uint8_t headersize, uint8_t *dataarray, uint8_t datasize, uint16_t networkID, uint32_t rxtimeout, uint8_t wait );
-    uint8_t waitACKDT(uint8_t *header, uint8_t headersize, uint32_t acktimeout);
+    //transmitDT(), receiveDT(), sendACKDT(), waitACKDT(), receiveHeaderDT(), readDataDT() and the IRQ
+    //variants are in LTReliableCore.h
+
     uint16_t getTXNetworkID(uint8_t length);
     uint8_t readReliableErrors();
     uint8_t readReliableFlags();
-    uint8_t sendACKDTIRQ(uint8_t *header, uint8_t headersize, int8_t txpower);
-    uint8_t waitACKDTIRQ(uint8_t *header, uint8_t headersize, uint32_t acktimeout);
-    uint8_t receiveDTIRQ(uint8_t *header, uint8_t headersize, uint8_t *dataarray, uint8_t datasize, uint16_t networkID, uint32_t rxtimeout, uint8_t wait );
-    uint8_t transmitDTIRQ(uint8_t *header, uint8_t headersize, uint8_t *dataarray, uint8_t datasize, uint16_t networkID, uint32_t txtimeout, int8_t txpower, uint8_t wait);
 
 
   private:
@@ -272,6 +276,54 @@ class SX126XLT  {
     uint8_t _ReliableErrors;        //Reliable status byte
     uint8_t _ReliableFlags;         //Reliable flags byte
     uint8_t _ReliableConfig;        //Reliable config byte
+    uint8_t _DTDataStart;           //buffer address of the data of the packet from receiveHeaderDT()
+    uint8_t _DTDataL;               //length of that data
+    uint16_t _DTPayloadCRC;         //payload CRC sent with it
+
+    uint8_t _LastOpcode;            //command the next BUSY wait is counted against
+    bool _BusyInterrupt;            //wait for the BUSY falling edge interrupt instead of reading the pin
+    uint16_t _BusyTimeouts;         //BUSY stayed high for longer than the timeout, device was reset
+    SX126XBusyStat _BusyStats[SX126XBusyStatsSize];
+    bool _Queueing;                 //configuration commands are held until endCommandQueue()
+    uint8_t _Queued;                //commands held
+    uint8_t _QueueOpcode[SX126XQueueSize];
+    uint8_t _QueueSize[SX126XQueueSize];
+    uint8_t _QueueData[SX126XQueueSize][SX126XQueueBytes];
+
+    void waitBusy();
+    void sendCommand(uint8_t Opcode, uint8_t *buffer, uint16_t size);
+    void sendCommandQueue();
+    bool isQueuedCommand(uint8_t Opcode);
+    void addBusyStat(uint8_t opcode, uint32_t waituS);
+
+    friend class LTReliableCore<SX126XLT>;            //device access of the DT and reliable functions
+
+    static const uint8_t DTMinPacketL = 10;
+    static const uint32_t DTACKTXTimeout = 12000;     //mS, longest packet is 8.7secs
+
+    void standbyDT();
+    void beginWriteDT(uint8_t offset);
+    void beginReadDT(uint8_t offset);
+    void endBufferDT();
+    void startTXDT(uint8_t length, int8_t txpower, uint32_t txtimeout);
+    bool waitTXDT(uint32_t txtimeout, bool useIRQ);
+    void startRXDT(uint32_t rxtimeout);
+    bool rxDoneDT(bool useIRQ);
+    bool waitRXDT(uint32_t rxtimeout, bool useIRQ);
+    bool endRXDT();
+    uint8_t readRXBufferStatusDT();
+    void restartRXDT();
+    bool receivingDT();
+    bool txDoneDT(bool useIRQ);
+    bool endTXDT();
+    void timeoutDT(bool tx);
+    void setTXBaseDT(uint8_t addr);
+    void setRXBaseDT(uint8_t addr);
+    uint16_t readPreambleDT();
+    void writePreambleDT(uint16_t length);
 
 };
+
+extern template class LTReliableCore<SX126XLT>;
+
 #endif
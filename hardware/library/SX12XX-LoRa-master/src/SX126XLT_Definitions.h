@@ -291,10 +291,30 @@
 //These are the bit numbers which when set indicate reliable status flags, variable _ReliableFlags
 #define ReliableACKSent 0x00              //bit number set in _ReliableFlags when there is a ACK sent
 #define ReliableACKReceived 0x01          //bit number set in _ReliableFlags when there is a ACK received
+#define ReliableDuplicate 0x02            //bit number set in _ReliableFlags when a packet received before was ACKed again
 
 //These are the bit numbers which when set indicate reliable configuration, variable _ReliableConfig
 #define NoReliableCRC 0x00                //bit number set in _ReliableConfig when reliable CRC is not used
 #define NoAutoACK 0x01                    //bit number set in _ReliableConfig when ACK is not used 
+#define ReliableACKLink 0x02              //bit number set in _ReliableConfig when ACKs carry the RSSI and SNR of the packet
+#define ReliableACKLinkL 6                //length of an ACK with ReliableACKLink, RSSI, SNR, NetworkID and payload CRC
+#define ReliableSequence 0x03             //bit number set in _ReliableConfig when reliable packets carry a sequence number
+#define ReliableSequenceL 5               //bytes added to the payload with ReliableSequence, sequence, NetworkID and payload CRC
+#define ReliableSequenceID 0x8000        //flipped in the NetworkID sent with a packet that carries a sequence number,
+                                         //reserved, reliable NetworkIDs are 0 to 0x7FFF
+#ifndef ReliableSeenSlots
+#define ReliableSeenSlots 4               //packets a receiver remembers with ReliableSequence, to ACK them again
+#endif
+
+//These are the states of the non blocking reliable functions, returned by pollReliable()
+#define ReliableIdle 0x00                 //nothing in progress
+#define ReliableTX 0x01                   //reliable packet being transmitted
+#define ReliableWaitACK 0x02              //waiting for the ACK of the transmitted packet
+#define ReliableRX 0x03                   //waiting to receive a reliable packet
+#define ReliableACKDelay 0x04             //packet received, waiting ackdelay before sending the ACK
+#define ReliableSendACK 0x05              //ACK being transmitted
+#define ReliableDone 0x06                 //finished, packet acknowledged or packet received and ACK sent
+#define ReliableFailed 0x07               //finished with an error, see readReliableErrors() and readIrqStatus()
 
 
 /*
@@ -13,10 +13,14 @@
 */
 
 #include <SX127XLT.h>
+#include <LTCRC.h>
 #include <SPI.h>
+#include <LTSPI.h>
+#include <LTAirtime.h>
 
 #define LTUNUSED(v) (void) (v)       //add LTUNUSED(variable); in functions to avoid compiler warnings 
 #define USE_SPI_TRANSACTION          //this is the standard behaviour of library, use SPI Transaction switching
+#define USE_REGISTER_CACHE           //keep shadow copies of configuration registers, skips redundant register reads and writes
 
 //#define SX127XDEBUG1               //enable level 1 debug messages
 //#define SX127XDEBUG2               //enable level 2 debug messages
@@ -28,6 +32,10 @@
 //#define APPLYERRATANOTE_2_3        //if enabled the changes suggested in SX1276_77_8_ErrataNote_1_1 are applied
 //#define SX127XDEBUGRELIABLE        //enable for debugging reliable and data transfer (DT) packets
 
+//configuration registers that only change when written by the host, one bit per register 0x00 to 0x4F
+//0x06-0x0B, 0x0E, 0x0F, 0x11, 0x1D-0x24, 0x26, 0x27, 0x2F-0x31, 0x33, 0x36, 0x37, 0x39-0x3B, 0x40, 0x41, 0x4B, 0x4D
+static const uint8_t cachedRegisters[REGCACHE_SIZE / 8] PROGMEM = {0xC0, 0xCF, 0x02, 0xE0, 0xDF, 0x80, 0xCB, 0x0E, 0x03, 0x28};
+
 
 SX127XLT::SX127XLT()
 {
@@ -59,6 +67,10 @@ bool SX127XLT::begin(int8_t pinNSS, int8_t pinNRESET, int8_t pinDIO0, int8_t pin
   _TXDonePin = pinDIO0;        //this is defalt pin for sensing TX done
   _RXDonePin = pinDIO0;        //this is defalt pin for sensing RX done
   _ReliableConfig = 0;         //reliable config needs to start at 0
+  _RegisterCacheLoRa = false;  //device mode is not known until REG_OPMODE is written
+  _SPITransactions = 0;
+  invalidateRegisterCache();
+  beginReliable();
 
   pinMode(_NSS, OUTPUT);
   digitalWrite(_NSS, HIGH);
@@ -123,6 +135,10 @@ bool SX127XLT::begin(int8_t pinNSS, int8_t pinNRESET, int8_t pinDIO0, uint8_t de
   _TXDonePin = pinDIO0;        //this is defalt pin for sensing TX done
   _RXDonePin = pinDIO0;        //this is defalt pin for sensing RX done
   _ReliableConfig = 0;         //reliable config needs to start at 0
+  _RegisterCacheLoRa = false;  //device mode is not known until REG_OPMODE is written
+  _SPITransactions = 0;
+  invalidateRegisterCache();
+  beginReliable();
 
   pinMode(_NSS, OUTPUT);
   digitalWrite(_NSS, HIGH);
@@ -173,6 +189,10 @@ bool SX127XLT::begin(int8_t pinNSS, int8_t pinNRESET, uint8_t device)
   _TXDonePin = _DIO0;          //this is default pin for sensing TX done
   _RXDonePin = _DIO0;          //this is default pin for sensing RX done
   _ReliableConfig = 0;         //reliable config needs to start at 0
+  _RegisterCacheLoRa = false;  //device mode is not known until REG_OPMODE is written
+  _SPITransactions = 0;
+  invalidateRegisterCache();
+  beginReliable();
 
   pinMode(_NSS, OUTPUT);
   digitalWrite(_NSS, HIGH);
@@ -217,6 +237,10 @@ bool SX127XLT::begin(int8_t pinNSS, uint8_t device)
   _TXDonePin = _DIO0;          //this is default pin for sensing TX done
   _RXDonePin = _DIO0;          //this is default pin for sensing RX done
   _ReliableConfig = 0;         //reliable config needs to start at 0
+  _RegisterCacheLoRa = false;  //device mode is not known until REG_OPMODE is written
+  _SPITransactions = 0;
+  invalidateRegisterCache();
+  beginReliable();
 
   pinMode(_NSS, OUTPUT);
   digitalWrite(_NSS, HIGH);
@@ -238,6 +262,114 @@ bool SX127XLT::begin(int8_t pinNSS, uint8_t device)
 }
 
 
+static uint16_t snapshotCRC(const LTSX127XSnapshot &snapshot)
+{
+  return LTCRCCCITTUpdate(0xFFFF, (const uint8_t *) &snapshot, offsetof(LTSX127XSnapshot, CRC));
+}
+
+
+bool SX127XLT::beginFromSnapshot(int8_t pinNSS, int8_t pinNRESET, int8_t pinDIO0, uint8_t device, const LTSX127XSnapshot &snapshot)
+{
+  //format 2 pins, for a processor waking up from a sleep the device spent powered in sleep mode, with the
+  //snapshot from saveSnapshot() before it. In place of the reset and setupLoRa() the registers are read in
+  //one burst and checked against the snapshot, any configuration register that differs is written back in
+  //one burst. Returns false, nothing written, if the snapshot is not valid or the device has been reset or
+  //powered down since, begin() and setupLoRa() are then needed.
+
+#ifdef SX127XDEBUG1
+  Serial.println(F("beginFromSnapshot() "));
+#endif
+
+  uint8_t registers[REGCACHE_SIZE];
+  uint8_t address;
+  bool differs = false, frequencyDiffers;
+
+  if ((snapshot.device != device) || (snapshotCRC(snapshot) != snapshot.CRC))
+  {
+    return false;
+  }
+
+  _NSS = pinNSS;
+  _NRESET = pinNRESET;
+  _DIO0 = pinDIO0;
+  _DIO1 = -1;                  //pin not used
+  _DIO2 = -1;                  //pin not used
+  _Device = device;
+  _TXDonePin = pinDIO0;        //this is defalt pin for sensing TX done
+  _RXDonePin = pinDIO0;        //this is defalt pin for sensing RX done
+  _ReliableConfig = 0;         //reliable config needs to start at 0
+  _RegisterCacheLoRa = false;  //set by the read of REG_OPMODE
+  _SPITransactions = 0;
+  invalidateRegisterCache();
+  beginReliable();
+
+  pinMode(_NSS, OUTPUT);
+  digitalWrite(_NSS, HIGH);
+  pinMode(_NRESET, OUTPUT);
+  digitalWrite(_NRESET, HIGH);
+
+  if (_DIO0 >= 0)
+  {
+    pinMode( _DIO0, INPUT);
+  }
+
+  readRegisters(REG_OPMODE, &registers[REG_OPMODE], (REGCACHE_SIZE - 1));   //also loads the register cache
+
+  if (!(registers[REG_OPMODE] & PACKET_TYPE_LORA) || (registers[REG_VERSION] != snapshot.registers[REG_VERSION]))
+  {
+    //no device, or it is in FSK mode as it comes out of reset, the configuration and image calibration are lost
+    invalidateRegisterCache();
+    return false;
+  }
+
+  frequencyDiffers = (memcmp(&registers[REG_FRMSB], &snapshot.registers[REG_FRMSB], 3) != 0);
+
+  for (address = REG_FRMSB; address <= REG_PADAC; address++)
+  {
+    if (isCachedRegister(address) && (registers[address] != snapshot.registers[address]))
+    {
+      registers[address] = snapshot.registers[address];
+      differs = true;
+    }
+  }
+
+  if (differs)
+  {
+    if (frequencyDiffers)
+    {
+      writeRegisters(REG_FRMSB, &snapshot.registers[REG_FRMSB], 3);
+      calibrateImage(0);                             //at the frequency of the snapshot, overwrites REG_INVERTIQ2
+    }
+
+    //the other registers of the block are written back as they were read, a 0 leaves the IRQ flags alone.
+    //writeRegisters() only sends the span between the first and last cached register that differs
+    registers[REG_IRQFLAGS] = 0;
+    writeRegisters(REG_FRMSB, &registers[REG_FRMSB], (REG_PADAC - REG_FRMSB + 1));
+    readRegisters(REG_OPMODE, &registers[REG_OPMODE], (REGCACHE_SIZE - 1));
+
+    for (address = REG_FRMSB; address <= REG_PADAC; address++)
+    {
+      if (isCachedRegister(address) && (registers[address] != snapshot.registers[address]))
+      {
+        invalidateRegisterCache();
+        return false;
+      }
+    }
+  }
+
+  _PACKET_TYPE = snapshot.packetType;
+  _UseCRC = snapshot.useCRC;
+  _savedFrequency = snapshot.frequency;
+  _savedOffset = snapshot.offset;
+  _freqregH = snapshot.registers[REG_FRMSB];
+  _freqregM = snapshot.registers[REG_FRMID];
+  _freqregL = snapshot.registers[REG_FRLSB];
+
+  setMode(MODE_STDBY_RC);                            //as setupLoRa() leaves the device
+  return true;
+}
+
+
 void SX127XLT::resetDevice()
 {
 #ifdef SX127XDEBUG1
@@ -260,6 +392,9 @@ void SX127XLT::resetDevice()
       digitalWrite(_NRESET, HIGH);
       delay(20);
     }
+
+    _RegisterCacheLoRa = false;             //device comes out of reset in FSK mode
+    invalidateRegisterCache();              //and with default register values
   }
 }
 
@@ -306,6 +441,7 @@ bool SX127XLT::checkDevice()
   uint8_t Regdata1, Regdata2;
   Regdata1 = readRegister(REG_FRMID);               //low byte of frequency setting
   writeRegister(REG_FRMID, (Regdata1 + 1));
+  invalidateRegisterCache();                        //so the read back comes from the device and not the cache
   Regdata2 = readRegister(REG_FRMID);               //read changed value back
   writeRegister(REG_FRMID, Regdata1);               //restore register to original value
 
@@ -385,25 +521,7 @@ uint16_t SX127XLT::CRCCCITT(uint8_t *buffer, uint32_t size, uint16_t startvalue)
   Serial.println(F("CRCCCITT() "));
 #endif
 
-  uint32_t index;
-  uint16_t libraryCRC;
-  uint8_t j;
-
-  libraryCRC = startvalue;                                  //start value for CRC16
-
-  for (index = 0; index < size; index++)
-  {
-    libraryCRC ^= (((uint16_t)buffer[index]) << 8);
-    for (j = 0; j < 8; j++)
-    {
-      if (libraryCRC & 0x8000)
-        libraryCRC = (libraryCRC << 1) ^ 0x1021;
-      else
-        libraryCRC <<= 1;
-    }
-  }
-
-  return libraryCRC;
+  return LTCRCCCITTUpdate(startvalue, buffer, size);                 //table driven CRC16, see LTCRC.h
 }
 
 
@@ -416,22 +534,21 @@ uint16_t SX127XLT::CRCCCITTSX(uint8_t startadd, uint8_t endadd, uint16_t startva
   Serial.println(F("CRCCCITTSX() "));
 #endif
 
-  uint16_t index, libraryCRC;
-  uint8_t j;
+  uint16_t remaining, libraryCRC;
+  uint8_t buff[32], length;
 
   libraryCRC = startvalue;                                  //start value for CRC16
   startReadSXBuffer(startadd);                              //begin the buffer read
 
-  for (index = startadd; index <= endadd; index++)
+  remaining = (endadd >= startadd) ? (endadd - startadd + 1) : 0;
+
+  while (remaining > 0)                             //a block of the buffer at a time
   {
-    libraryCRC ^= (((uint16_t) readUint8() ) << 8);
-    for (j = 0; j < 8; j++)
-    {
-      if (libraryCRC & 0x8000)
-        libraryCRC = (libraryCRC << 1) ^ 0x1021;
-      else
-        libraryCRC <<= 1;
-    }
+    length = (remaining < sizeof(buff)) ? remaining : sizeof(buff);
+    LTSPIreadBytes(buff, length);
+    libraryCRC = LTCRCCCITTUpdate(libraryCRC, buff, length);
+    _RXPacketL = _RXPacketL + length;                 //count of bytes read, as readUint8() keeps it
+    remaining = remaining - length;
   }
 
   endReadSXBuffer();                                         //end the buffer read
@@ -536,11 +653,23 @@ void SX127XLT::writeRegister(uint8_t address, uint8_t value)
   Serial.println(F("writeRegister() "));
 #endif
 
+#ifdef USE_REGISTER_CACHE
+  uint8_t regdata;
+
+  if (getCachedRegister(address, &regdata) && (regdata == value))
+  {
+    return;                                 //register already holds the value, no need to write it
+  }
+
+  updateRegisterCache(address, value);
+#endif
+
 #ifdef USE_SPI_TRANSACTION                  //to use SPI_TRANSACTION enable define at beginning of CPP file 
   SPI.beginTransaction(SPISettings(LTspeedMaximum, LTdataOrder, LTdataMode));
 #endif
 
   digitalWrite(_NSS, LOW);                  //set NSS low
+  _SPITransactions++;
   SPI.transfer(address | 0x80);             //mask address for write
   SPI.transfer(value);                      //write the byte
   digitalWrite(_NSS, HIGH);                 //set NSS high
@@ -568,11 +697,19 @@ uint8_t SX127XLT::readRegister(uint8_t address)
 
   uint8_t regdata;
 
+#ifdef USE_REGISTER_CACHE
+  if (getCachedRegister(address, &regdata))
+  {
+    return regdata;                //shadow copy is the same as the device register
+  }
+#endif
+
 #ifdef USE_SPI_TRANSACTION         //to use SPI_TRANSACTION enable define at beginning of CPP file 
   SPI.beginTransaction(SPISettings(LTspeedMaximum, LTdataOrder, LTdataMode));
 #endif
 
   digitalWrite(_NSS, LOW);         //set NSS low
+  _SPITransactions++;
   SPI.transfer(address & 0x7F);    //mask address for read
   regdata = SPI.transfer(0);       //read the byte
   digitalWrite(_NSS, HIGH);        //set NSS high
@@ -581,6 +718,10 @@ uint8_t SX127XLT::readRegister(uint8_t address)
   SPI.endTransaction();
 #endif
 
+#ifdef USE_REGISTER_CACHE
+  updateRegisterCache(address, regdata);
+#endif
+
 #ifdef SX127XDEBUG2
   Serial.print(F("Read register "));
   printHEXByte0x(address);
@@ -594,6 +735,194 @@ uint8_t SX127XLT::readRegister(uint8_t address)
 }
 
 
+void SX127XLT::writeRegisters(uint8_t address, const uint8_t *buffer, uint8_t size)
+{
+  //burst write of consecutive registers, the SX127x increments the address after each byte.
+  //Not for the FIFO, REG_FIFO does not increment, use the SX buffer functions for that.
+
+#ifdef SX127XDEBUG1
+  Serial.println(F("writeRegisters() "));
+#endif
+
+  uint8_t index;
+
+#ifdef USE_REGISTER_CACHE
+  uint8_t regdata;
+
+  //registers at the start and end of the block that already hold their values are not written
+  while (size && getCachedRegister(address, &regdata) && (regdata == buffer[0]))
+  {
+    address++;
+    buffer++;
+    size--;
+  }
+
+  while (size && getCachedRegister(address + size - 1, &regdata) && (regdata == buffer[size - 1]))
+  {
+    size--;
+  }
+
+  if (size == 0)
+  {
+    return;
+  }
+
+  for (index = 0; index < size; index++)
+  {
+    updateRegisterCache(address + index, buffer[index]);
+  }
+#endif
+
+#ifdef USE_SPI_TRANSACTION                  //to use SPI_TRANSACTION enable define at beginning of CPP file 
+  SPI.beginTransaction(SPISettings(LTspeedMaximum, LTdataOrder, LTdataMode));
+#endif
+
+  digitalWrite(_NSS, LOW);                  //set NSS low
+  _SPITransactions++;
+  SPI.transfer(address | 0x80);             //mask address for write
+
+  LTSPIwriteBytes(buffer, size);
+
+  digitalWrite(_NSS, HIGH);                 //set NSS high
+
+#ifdef USE_SPI_TRANSACTION
+  SPI.endTransaction();
+#endif
+
+#ifdef SX127XDEBUG2
+  Serial.print(F("Write registers "));
+  printHEXByte0x(address);
+  Serial.print(F(" "));
+  printHEXPacket((uint8_t *) buffer, size);
+  Serial.println();
+  Serial.flush();
+#endif
+}
+
+
+void SX127XLT::readRegisters(uint8_t address, uint8_t *buffer, uint8_t size)
+{
+  //burst read of consecutive registers, always read from the device
+
+#ifdef SX127XDEBUG1
+  Serial.println(F("readRegisters() "));
+#endif
+
+  uint8_t index;
+
+#ifdef USE_SPI_TRANSACTION                  //to use SPI_TRANSACTION enable define at beginning of CPP file 
+  SPI.beginTransaction(SPISettings(LTspeedMaximum, LTdataOrder, LTdataMode));
+#endif
+
+  digitalWrite(_NSS, LOW);                  //set NSS low
+  _SPITransactions++;
+  SPI.transfer(address & 0x7F);             //mask address for read
+
+  LTSPIreadBytes(buffer, size);
+
+  digitalWrite(_NSS, HIGH);                 //set NSS high
+
+#ifdef USE_SPI_TRANSACTION
+  SPI.endTransaction();
+#endif
+
+#ifdef USE_REGISTER_CACHE
+  for (index = 0; index < size; index++)
+  {
+    updateRegisterCache(address + index, buffer[index]);
+  }
+#endif
+}
+
+
+void SX127XLT::invalidateRegisterCache()
+{
+  //forget all shadow register copies, the next read of each register goes to the device.
+  //Needed if the device registers are changed other than through this library, by a reset for instance.
+
+#ifdef SX127XDEBUG1
+  Serial.println(F("invalidateRegisterCache() "));
+#endif
+
+  memset(_RegisterCacheValid, 0, sizeof(_RegisterCacheValid));
+}
+
+
+uint32_t SX127XLT::getSPITransactions()
+{
+  //number of SPI transactions, NSS low to high, since begin() or resetSPITransactions()
+
+  return _SPITransactions;
+}
+
+
+void SX127XLT::resetSPITransactions()
+{
+  _SPITransactions = 0;
+}
+
+
+bool SX127XLT::isCachedRegister(uint8_t address)
+{
+  //true if a shadow copy of the register is kept in the current mode
+
+  if (address >= REGCACHE_SIZE)
+  {
+    return false;
+  }
+
+  if (!_RegisterCacheLoRa && (address >= REGCACHE_PAGE_START) && (address <= REGCACHE_PAGE_END))
+  {
+    return false;                           //FSK register page, not cached
+  }
+
+  return bitRead(pgm_read_byte(&cachedRegisters[address >> 3]), address & 0x07);
+}
+
+
+bool SX127XLT::getCachedRegister(uint8_t address, uint8_t *value)
+{
+  //true if there is a valid shadow copy of the register, value is then loaded with it
+
+  if (isCachedRegister(address) && bitRead(_RegisterCacheValid[address >> 3], address & 0x07))
+  {
+    *value = _RegisterCache[address];
+    return true;
+  }
+
+  return false;
+}
+
+
+void SX127XLT::updateRegisterCache(uint8_t address, uint8_t value)
+{
+  //called with each value written to or read from the device
+
+  uint8_t index;
+
+  if (address == REG_OPMODE)
+  {
+    if (_RegisterCacheLoRa != (bool) (value & 0x80))
+    {
+      //changing between LoRa and FSK, the shadow copies of the paged registers are no longer trusted
+      for (index = REGCACHE_PAGE_START; index <= REGCACHE_PAGE_END; index++)
+      {
+        bitClear(_RegisterCacheValid[index >> 3], index & 0x07);
+      }
+    }
+
+    _RegisterCacheLoRa = (value & 0x80);
+    return;
+  }
+
+  if (isCachedRegister(address))
+  {
+    _RegisterCache[address] = value;
+    bitSet(_RegisterCacheValid[address >> 3], address & 0x07);
+  }
+}
+
+
 void SX127XLT::printRegisters(uint16_t Start, uint16_t End)
 {
   //prints the contents of SX127x registers to serial monitor
@@ -769,6 +1098,7 @@ void SX127XLT::setTxParams(int8_t txPower, uint8_t rampTime)
 #endif
 
   uint8_t MaxPower, OutputPower, OcpTrim, boostval;
+  uint8_t paconfig[3];
 
   if (_Device & 0x10)
   {
@@ -849,9 +1179,10 @@ void SX127XLT::setTxParams(int8_t txPower, uint8_t rampTime)
     OcpTrim = OCP_TRIM_80MA;
   }
 
-  writeRegister(REG_PARAMP, rampTime);
-  writeRegister(REG_OCP, (OcpTrim + 0x20));
-  writeRegister(REG_PACONFIG, (boostval  + MaxPower + OutputPower));    //MaxPower does not care for SX1272
+  paconfig[0] = (boostval  + MaxPower + OutputPower);   //REG_PACONFIG, MaxPower does not care for SX1272
+  paconfig[1] = rampTime;                                //REG_PARAMP
+  paconfig[2] = (OcpTrim + 0x20);                        //REG_OCP
+  writeRegisters(REG_PACONFIG, paconfig, 3);
 
 #ifdef  PACONFIGDEBUG
   Serial.print(F("txPower,"));
@@ -949,20 +1280,17 @@ void SX127XLT::setPacketParams(uint16_t packetParam1, uint8_t  packetParam2, uin
   Serial.println(F("SetPacketParams() "));
 #endif
 
-  uint8_t preambleMSB, preambleLSB, regdata;
+  uint8_t packetconfig[3], modemconfig[2];
 
 
   //*******************************************************
   //These changes are the same for SX1272 and SX127X
-  //PreambleLength reg 0x20, 0x21
-
-  preambleMSB = packetParam1 >> 8;
-  preambleLSB = packetParam1 & 0xFF;
-  writeRegister(REG_PREAMBLEMSB, preambleMSB);
-  writeRegister(REG_PREAMBLELSB, preambleLSB);
+  //PreambleLength reg 0x20, 0x21 and TX Packetlength reg 0x22, written in one burst
 
-  //TX Packetlength reg 0x22
-  writeRegister(REG_PAYLOADLENGTH, packetParam3);                //when in implicit mode, this is used as receive length also
+  packetconfig[0] = packetParam1 >> 8;
+  packetconfig[1] = packetParam1 & 0xFF;
+  packetconfig[2] = packetParam3;                                 //when in implicit mode, this is used as receive length also
+  writeRegisters(REG_PREAMBLEMSB, packetconfig, 3);
 
   //IQ mode reg 0x33 and 0x3B
   if (packetParam5 == LORA_IQ_INVERTED)
@@ -985,28 +1313,29 @@ void SX127XLT::setPacketParams(uint16_t packetParam1, uint8_t  packetParam2, uin
   //CRC mode
   _UseCRC = packetParam4;                                         //save CRC use status
 
+  modemconfig[0] = readRegister(REG_MODEMCONFIG1);
+  modemconfig[1] = readRegister(REG_MODEMCONFIG2);
+
   if (_Device != DEVICE_SX1272)
   {
     //for all devices apart from SX1272
-    //Fixed\Variable length packets
-    regdata = ( (readRegister(REG_MODEMCONFIG1)) & (~READ_IMPLCIT_AND_X)); //mask off bit 0
-    writeRegister(REG_MODEMCONFIG1, (regdata + packetParam2));             //write out with bit 0 set appropriatly
+    //Fixed\Variable length packets, mask off bit 0 and set appropriatly
+    modemconfig[0] = ((modemconfig[0] & (~READ_IMPLCIT_AND_X)) + packetParam2);
 
-    //CRC on payload
-    regdata = ( (readRegister(REG_MODEMCONFIG2)) & (~READ_HASCRC_AND_X));  //mask off all bits bar CRC on - bit 2
-    writeRegister(REG_MODEMCONFIG2, (regdata + (packetParam4 << 2)));      //write out with CRC bit 2 set appropriatly
+    //CRC on payload, mask off all bits bar CRC on - bit 2 and set appropriatly
+    modemconfig[1] = ((modemconfig[1] & (~READ_HASCRC_AND_X)) + (packetParam4 << 2));
   }
   else
   {
     //for SX1272
-    //Fixed\Variable length packets
-    regdata = ( (readRegister(REG_MODEMCONFIG1)) & (~READ_IMPLCIT_AND_2)); //mask off bit 2
-    writeRegister(REG_MODEMCONFIG1, (regdata + (packetParam2 << 2)));      //write out with bit 2 set appropriatly
+    //Fixed\Variable length packets, mask off bit 2 and set appropriatly
+    modemconfig[0] = ((modemconfig[0] & (~READ_IMPLCIT_AND_2)) + (packetParam2 << 2));
 
-    //CRC on payload
-    regdata = ( (readRegister(REG_MODEMCONFIG1)) & (~READ_HASCRC_AND_2));  //mask of all bits bar CRC on - bit 1
-    writeRegister(REG_MODEMCONFIG1, (regdata + (packetParam4 << 1)));      //write out with CRC bit 1 set appropriatly
+    //CRC on payload, mask of all bits bar CRC on - bit 1 and set appropriatly
+    modemconfig[0] = ((modemconfig[0] & (~READ_HASCRC_AND_2)) + (packetParam4 << 1));
   }
+
+  writeRegisters(REG_MODEMCONFIG1, modemconfig, 2);              //REG_MODEMCONFIG1 and REG_MODEMCONFIG2 in one burst
 }
 
 
@@ -1019,22 +1348,22 @@ void SX127XLT::setModulationParams(uint8_t modParam1, uint8_t modParam2, uint8_t
 #endif
 
   uint8_t regdata, bw;
+  uint8_t modemconfig[2];
 
-  //Spreading factor - same for SX1272 and SX127X - reg 0x1D
-  regdata = (readRegister(REG_MODEMCONFIG2) & (~READ_SF_AND_X));
-  writeRegister(REG_MODEMCONFIG2, (regdata + (modParam1 << 4)));
+  modemconfig[0] = readRegister(REG_MODEMCONFIG1);
+  modemconfig[1] = readRegister(REG_MODEMCONFIG2);
+
+  //Spreading factor - same for SX1272 and SX127X - reg 0x1E
+  modemconfig[1] = ((modemconfig[1] & (~READ_SF_AND_X)) + (modParam1 << 4));
 
   if (_Device != DEVICE_SX1272)
   {
     //for all devices apart from SX1272
 
-    //bandwidth
-    regdata = (readRegister(REG_MODEMCONFIG1) & (~READ_BW_AND_X));
-    writeRegister(REG_MODEMCONFIG1, (regdata + modParam2));
-
-    //Coding rate
-    regdata = (readRegister(REG_MODEMCONFIG1) & (~READ_CR_AND_X));
-    writeRegister(REG_MODEMCONFIG1, (regdata + (modParam3)));
+    //bandwidth and coding rate
+    modemconfig[0] = ((modemconfig[0] & (~READ_BW_AND_X)) + modParam2);
+    modemconfig[0] = ((modemconfig[0] & (~READ_CR_AND_X)) + modParam3);
+    writeRegisters(REG_MODEMCONFIG1, modemconfig, 2);              //REG_MODEMCONFIG1 and REG_MODEMCONFIG2 in one burst
 
     //Optimisation
     if (modParam4 == LDRO_AUTO)
@@ -1049,7 +1378,7 @@ void SX127XLT::setModulationParams(uint8_t modParam1, uint8_t modParam2, uint8_t
   else
   {
     //for SX1272
-    regdata = (readRegister(REG_MODEMCONFIG1) & (~READ_BW_AND_2));   //value will be LORA_BW_500 128, LORA_BW_250 64, LORA_BW_125 0
+    modemconfig[0] = (modemconfig[0] & (~READ_BW_AND_2));          //value will be LORA_BW_500 128, LORA_BW_250 64, LORA_BW_125 0
 
     switch (modParam2)
     {
@@ -1069,11 +1398,10 @@ void SX127XLT::setModulationParams(uint8_t modParam1, uint8_t modParam2, uint8_t
         bw = 0x00;                       //defaults to LORA_BW_125
     }
 
-    writeRegister(REG_MODEMCONFIG1, (regdata + bw));
+    modemconfig[0] = modemconfig[0] + bw;
 
     //Coding rate
-    regdata = (readRegister(REG_MODEMCONFIG1) & (~READ_CR_AND_2));
-    writeRegister(REG_MODEMCONFIG1, (regdata + (modParam3 << 2)));
+    modemconfig[0] = ((modemconfig[0] & (~READ_CR_AND_2)) + (modParam3 << 2));
 
     //Optimisation
     if (modParam4 == LDRO_AUTO)
@@ -1081,8 +1409,8 @@ void SX127XLT::setModulationParams(uint8_t modParam1, uint8_t modParam2, uint8_t
       modParam4 = returnOptimisation(modParam2, modParam1);
     }
 
-    regdata = (readRegister(REG_MODEMCONFIG1) & (~READ_LDRO_AND_2));
-    writeRegister(REG_MODEMCONFIG1, (regdata + modParam4));
+    modemconfig[0] = ((modemconfig[0] & (~READ_LDRO_AND_2)) + modParam4);
+    writeRegisters(REG_MODEMCONFIG1, modemconfig, 2);              //REG_MODEMCONFIG1 and REG_MODEMCONFIG2 in one burst
 
   }
 
@@ -1180,6 +1508,8 @@ void SX127XLT::setRfFrequency(uint64_t freq64, int32_t offset)
   Serial.println(F("setRfFrequency() "));
 #endif
 
+  uint8_t freqregs[3];
+
   _savedFrequency = freq64;
   _savedOffset = offset;
   freq64 = freq64 + offset;
@@ -1187,9 +1517,10 @@ void SX127XLT::setRfFrequency(uint64_t freq64, int32_t offset)
   _freqregH = freq64 >> 16;
   _freqregM = freq64 >> 8;
   _freqregL = freq64;
-  writeRegister(REG_FRMSB, _freqregH);
-  writeRegister(REG_FRMID, _freqregM);
-  writeRegister(REG_FRLSB, _freqregL);
+  freqregs[0] = _freqregH;
+  freqregs[1] = _freqregM;
+  freqregs[2] = _freqregL;
+  writeRegisters(REG_FRMSB, freqregs, 3);
 }
 
 
@@ -1847,8 +2178,11 @@ void SX127XLT::setBufferBaseAddress(uint8_t txBaseAddress, uint8_t rxBaseAddress
   Serial.println(F("setBufferBaseAddress() "));
 #endif
 
-  writeRegister(REG_FIFOTXBASEADDR, txBaseAddress);
-  writeRegister(REG_FIFORXBASEADDR, rxBaseAddress);
+  uint8_t baseaddress[2];
+
+  baseaddress[0] = txBaseAddress;
+  baseaddress[1] = rxBaseAddress;
+  writeRegisters(REG_FIFOTXBASEADDR, baseaddress, 2);
 }
 
 
@@ -2199,7 +2533,6 @@ uint8_t SX127XLT::receive(uint8_t *rxbuffer, uint8_t size, uint32_t rxtimeout, u
   Serial.println(F("receive()"));
 #endif
 
-  uint16_t index;
   uint32_t startmS;
   uint8_t regdata;
 
@@ -2253,13 +2586,10 @@ uint8_t SX127XLT::receive(uint8_t *rxbuffer, uint8_t size, uint32_t rxtimeout, u
 #endif
 
   digitalWrite(_NSS, LOW);                    //start the burst read
+  _SPITransactions++;
   SPI.transfer(REG_FIFO);
 
-  for (index = 0; index < _RXPacketL; index++)
-  {
-    regdata = SPI.transfer(0);
-    rxbuffer[index] = regdata;
-  }
+  LTSPIreadBytes(rxbuffer, _RXPacketL);
   digitalWrite(_NSS, HIGH);
 
 #ifdef USE_SPI_TRANSACTION
@@ -2276,7 +2606,6 @@ uint8_t SX127XLT::receiveIRQ(uint8_t *rxbuffer, uint8_t size, uint32_t rxtimeout
   Serial.println(F("receive()"));
 #endif
 
-  uint16_t index;
   uint32_t startmS;
   uint8_t regdata;
 
@@ -2330,13 +2659,10 @@ uint8_t SX127XLT::receiveIRQ(uint8_t *rxbuffer, uint8_t size, uint32_t rxtimeout
 #endif
 
   digitalWrite(_NSS, LOW);                    //start the burst read
+  _SPITransactions++;
   SPI.transfer(REG_FIFO);
 
-  for (index = 0; index < _RXPacketL; index++)
-  {
-    regdata = SPI.transfer(0);
-    rxbuffer[index] = regdata;
-  }
+  LTSPIreadBytes(rxbuffer, _RXPacketL);
   digitalWrite(_NSS, HIGH);
 
 #ifdef USE_SPI_TRANSACTION
@@ -2353,7 +2679,6 @@ uint8_t SX127XLT::receiveAddressed(uint8_t *rxbuffer, uint8_t size, uint32_t rxt
   Serial.println(F("receiveAddressed() "));
 #endif
 
-  uint16_t index;
   uint32_t startmS;
   uint8_t regdata;
 
@@ -2403,17 +2728,14 @@ uint8_t SX127XLT::receiveAddressed(uint8_t *rxbuffer, uint8_t size, uint32_t rxt
 #endif
 
   digitalWrite(_NSS, LOW);                    //start the burst read
+  _SPITransactions++;
   SPI.transfer(REG_FIFO);
 
   _RXPacketType = SPI.transfer(0);
   _RXDestination = SPI.transfer(0);
   _RXSource = SPI.transfer(0);
 
-  for (index = 0; index < _RXPacketL; index++)
-  {
-    regdata = SPI.transfer(0);
-    rxbuffer[index] = regdata;
-  }
+  LTSPIreadBytes(rxbuffer, _RXPacketL);
   digitalWrite(_NSS, HIGH);
 
 #ifdef USE_SPI_TRANSACTION
@@ -2430,7 +2752,7 @@ uint8_t SX127XLT::readPacket(uint8_t *rxbuffer, uint8_t size)
   Serial.println(F("readPacket() "));
 #endif
 
-  uint8_t index, regdata;
+  uint8_t regdata;
 
   if ( readIrqStatus() != (IRQ_RX_DONE + IRQ_HEADER_VALID) )
   {
@@ -2452,13 +2774,10 @@ uint8_t SX127XLT::readPacket(uint8_t *rxbuffer, uint8_t size)
 #endif
 
   digitalWrite(_NSS, LOW);                      //start the burst read
+  _SPITransactions++;
   SPI.transfer(REG_FIFO);
 
-  for (index = 0; index < _RXPacketL; index++)
-  {
-    regdata = SPI.transfer(0);
-    rxbuffer[index] = regdata;
-  }
+  LTSPIreadBytes(rxbuffer, _RXPacketL);
   digitalWrite(_NSS, HIGH);
 
 #ifdef USE_SPI_TRANSACTION
@@ -2475,7 +2794,7 @@ uint8_t SX127XLT::readPacketAddressed(uint8_t *rxbuffer, uint8_t size)
   Serial.println(F("readPacketAddressed() "));
 #endif
 
-  uint8_t index, regdata;
+  uint8_t regdata;
 
   setMode(MODE_STDBY_RC);
   regdata = readRegister(REG_FIFORXBASEADDR);  //retrieve the RXbase address pointer
@@ -2492,16 +2811,13 @@ uint8_t SX127XLT::readPacketAddressed(uint8_t *rxbuffer, uint8_t size)
 #endif
 
   digitalWrite(_NSS, LOW);                     //start the burst read
+  _SPITransactions++;
   SPI.transfer(REG_FIFO);
   _RXPacketType = SPI.transfer(0);
   _RXDestination = SPI.transfer(0);
   _RXSource = SPI.transfer(0);
 
-  for (index = 0; index < _RXPacketL; index++)
-  {
-    regdata = SPI.transfer(0);
-    rxbuffer[index] = regdata;
-  }
+  LTSPIreadBytes(rxbuffer, _RXPacketL);
   digitalWrite(_NSS, HIGH);
 
 #ifdef USE_SPI_TRANSACTION
@@ -2518,8 +2834,7 @@ uint8_t SX127XLT::transmit(uint8_t *txbuffer, uint8_t size, uint32_t txtimeout,
   Serial.println(F("transmit()"));
 #endif
 
-  uint8_t index, ptr;
-  uint8_t bufferdata;
+  uint8_t ptr;
   uint32_t startmS;
 
   if (size == 0)
@@ -2536,13 +2851,10 @@ uint8_t SX127XLT::transmit(uint8_t *txbuffer, uint8_t size, uint32_t txtimeout,
 #endif
 
   digitalWrite(_NSS, LOW);
+  _SPITransactions++;
   SPI.transfer(WREG_FIFO);
 
-  for (index = 0; index < size; index++)
-  {
-    bufferdata = txbuffer[index];
-    SPI.transfer(bufferdata);
-  }
+  LTSPIwriteBytes(txbuffer, size);
   digitalWrite(_NSS, HIGH);
 
 #ifdef USE_SPI_TRANSACTION
@@ -2588,8 +2900,7 @@ uint8_t SX127XLT::transmitIRQ(uint8_t *txbuffer, uint8_t size, uint32_t txtimeou
   Serial.println(F("transmit()"));
 #endif
 
-  uint8_t index, ptr;
-  uint8_t bufferdata;
+  uint8_t ptr;
   uint32_t startmS;
 
   if (size == 0)
@@ -2606,13 +2917,10 @@ uint8_t SX127XLT::transmitIRQ(uint8_t *txbuffer, uint8_t size, uint32_t txtimeou
 #endif
 
   digitalWrite(_NSS, LOW);
+  _SPITransactions++;
   SPI.transfer(WREG_FIFO);
 
-  for (index = 0; index < size; index++)
-  {
-    bufferdata = txbuffer[index];
-    SPI.transfer(bufferdata);
-  }
+  LTSPIwriteBytes(txbuffer, size);
   digitalWrite(_NSS, HIGH);
 
 #ifdef USE_SPI_TRANSACTION
@@ -2658,8 +2966,7 @@ uint8_t SX127XLT::transmitAddressed(uint8_t *txbuffer, uint8_t size, char txpack
   Serial.println(F("transmitAddressed() "));
 #endif
 
-  uint8_t index, ptr;
-  uint8_t bufferdata;
+  uint8_t ptr;
   uint32_t startmS;
 
   if (size == 0)
@@ -2676,6 +2983,7 @@ uint8_t SX127XLT::transmitAddressed(uint8_t *txbuffer, uint8_t size, char txpack
 #endif
 
   digitalWrite(_NSS, LOW);
+  _SPITransactions++;
   SPI.transfer(WREG_FIFO);
 
   SPI.transfer(txpackettype);                     //Write the packet type
@@ -2683,11 +2991,7 @@ uint8_t SX127XLT::transmitAddressed(uint8_t *txbuffer, uint8_t size, char txpack
   SPI.transfer(txsource);                         //Source node
   _TXPacketL = 3 + size;                          //we have added 3 header bytes to size
 
-  for (index = 0; index < size; index++)
-  {
-    bufferdata = txbuffer[index];
-    SPI.transfer(bufferdata);
-  }
+  LTSPIwriteBytes(txbuffer, size);
   digitalWrite(_NSS, HIGH);
 
 #ifdef USE_SPI_TRANSACTION
@@ -2762,6 +3066,74 @@ void SX127XLT::setupLoRa(uint32_t Frequency)
 }
 
 
+void SX127XLT::applyConfig(const LTSX127XConfig &config)
+{
+  //leaves the device as setupLoRa() with the settings of the LTLoRaConfig.h image, the registers written
+  //as they are without reading them first. The SX1272 has its own modem register layout, so for that
+  //the settings are passed to setupLoRa()
+
+#ifdef SX127XDEBUG1
+  Serial.println(F("applyConfig() "));
+#endif
+
+  if (_Device == DEVICE_SX1272)
+  {
+    setupLoRa(config.frequency, config.offset, (config.modem[1] & READ_SF_AND_X) >> 4, (config.modem[0] & READ_BW_AND_X),
+              (config.modem[0] & READ_CR_AND_X), ((config.modem3 & READ_LDRO_AND_X) >> 3));
+    return;
+  }
+
+  _PACKET_TYPE = PACKET_TYPE_LORA;
+  _savedFrequency = config.frequency;
+  _savedOffset = config.offset;
+  _freqregH = config.frf[0];
+  _freqregM = config.frf[1];
+  _freqregL = config.frf[2];
+  _UseCRC = LORA_CRC_ON;
+
+  writeRegister(REG_OPMODE, 0x80);                   //sleep, the LoRa bit can only be set in sleep
+  writeRegister(REG_OPMODE, (MODE_STDBY_RC + PACKET_TYPE_LORA));
+  writeRegisters(REG_FRMSB, config.frf, 3);
+  calibrateImage(0);                                 //at the frequency just set, uses REG_IMAGECAL of the FSK page
+  writeRegister(REG_LNA, config.lna);
+  writeRegisters(REG_FIFOTXBASEADDR, config.fifoBase, 2);
+  writeRegisters(REG_MODEMCONFIG1, config.modem, 2);
+  writeRegisters(REG_PREAMBLEMSB, config.packet, 3);
+  writeRegister(REG_MODEMCONFIG3, config.modem3);
+  writeRegister(REG_DETECTOPTIMIZE, config.detectOptimize);
+  writeRegister(REG_INVERTIQ, config.invertIQ);
+  writeRegisters(REG_HIGHBWOPTIMIZE1, config.highBW, 2);
+  writeRegister(REG_SYNCWORD, config.syncWord);
+
+  if (config.highBW2 != 0)
+  {
+    writeRegister(REG_HIGHBWOPTIMIZE2, config.highBW2);
+  }
+
+  writeRegister(REG_INVERTIQ2, config.invertIQ2);
+}
+
+
+void SX127XLT::saveSnapshot(LTSX127XSnapshot &snapshot)
+{
+  //the device registers, read in one burst, and the driver settings, once the device is set up. For
+  //beginFromSnapshot() after a sleep of the processor, snapshot needs to be kept where it survives the sleep
+
+#ifdef SX127XDEBUG1
+  Serial.println(F("saveSnapshot() "));
+#endif
+
+  memset(&snapshot, 0, sizeof(snapshot));
+  readRegisters(REG_OPMODE, &snapshot.registers[REG_OPMODE], (REGCACHE_SIZE - 1));
+  snapshot.frequency = _savedFrequency;
+  snapshot.offset = _savedOffset;
+  snapshot.device = _Device;
+  snapshot.packetType = _PACKET_TYPE;
+  snapshot.useCRC = _UseCRC;
+  snapshot.CRC = snapshotCRC(snapshot);
+}
+
+
 uint8_t SX127XLT::getLoRaSF()
 {
 #ifdef SX127XDEBUG1
@@ -2868,6 +3240,53 @@ uint16_t SX127XLT::getPreamble()
 }
 
 
+void SX127XLT::setPreamble(uint16_t length)
+{
+  //sets the preamble length in symbols without the rest of setPacketParams(), 6 to 65535
+
+#ifdef SX127XDEBUG1
+  Serial.println(F("setPreamble() "));
+#endif
+
+  uint8_t buff[2];
+
+  buff[0] = highByte(length);
+  buff[1] = lowByte(length);
+  writeRegisters(REG_PREAMBLEMSB, buff, 2);
+}
+
+
+uint8_t SX127XLT::doCAD()
+{
+  //channel activity detection, the device looks for a LoRa preamble at the current settings for around
+  //2 symbols, 2mS at SF7 BW125, then returns to standby. Returns 1 if a preamble was found, 0 if not or if
+  //CAD done was not seen within 2 seconds. A packet found is received with a receive function, so the
+  //transmitter must send a preamble long enough to cover the time between CADs, see LTListen.h
+
+#ifdef SX127XDEBUG1
+  Serial.println(F("doCAD() "));
+#endif
+
+  uint32_t startmS;
+
+  setMode(MODE_STDBY_RC);
+  setDioIrqParams(IRQ_RADIO_ALL, IRQ_CAD_DONE, IRQ_CAD_ACTIVITY_DETECTED, 0);  //CAD done on DIO0
+  clearIrqStatus(IRQ_RADIO_ALL);
+  setMode(MODE_CAD);
+
+  startmS = millis();
+  while (!digitalRead(_DIO0) && ((uint32_t) (millis() - startmS) < 2000));
+
+  if (!digitalRead(_DIO0))
+  {
+    setMode(MODE_STDBY_RC);
+    return 0;
+  }
+
+  return (readRegister(REG_IRQFLAGS) & IRQ_CAD_ACTIVITY_DETECTED) ? 1 : 0;
+}
+
+
 uint32_t SX127XLT::returnBandwidth(byte BWregvalue)
 {
 #ifdef SX127XDEBUG1
@@ -2986,6 +3405,29 @@ float SX127XLT::calcSymbolTime(float Bandwidth, uint8_t SpreadingFactor)
 }
 
 
+uint32_t SX127XLT::getTimeOnAiruS(uint8_t packetL)
+{
+  //time on air in uS of a LoRa packet of packetL bytes with the current settings, see LTAirtime.h
+
+#ifdef SX127XDEBUG1
+  Serial.println(F("getTimeOnAiruS() "));
+#endif
+
+  uint8_t regdata;
+
+  if (_Device == DEVICE_SX1272)
+  {
+    regdata = (readRegister(REG_MODEMCONFIG1) & READ_BW_AND_2);
+  }
+  else
+  {
+    regdata = (readRegister(REG_MODEMCONFIG1) & READ_BW_AND_X);
+  }
+
+  return LTAirtimeuS(returnBandwidth(regdata), getLoRaSF(), getLoRaCodingRate(), getPreamble(), packetL, getCRCMode(), getHeaderMode(), getOptimisation());
+}
+
+
 void SX127XLT::printModemSettings()
 {
 #ifdef SX127XDEBUG1
@@ -3247,6 +3689,7 @@ void SX127XLT::printSXBufferHEX(uint8_t start, uint8_t end)
 #endif
 
   digitalWrite(_NSS, LOW);                       //start the burst read
+  _SPITransactions++;
   SPI.transfer(REG_FIFO);
 
   for (index = start; index <= end; index++)
@@ -3281,6 +3724,7 @@ void SX127XLT::printSXBufferASCII(uint8_t start, uint8_t end)
 #endif
 
   digitalWrite(_NSS, LOW);                    //start the burst read
+  _SPITransactions++;
   SPI.transfer(REG_FIFO);
 
   for (index = start; index <= end; index++)
@@ -3311,6 +3755,7 @@ void SX127XLT::fillSXBuffer(uint8_t startaddress, uint8_t size, uint8_t characte
 #endif
 
   digitalWrite(_NSS, LOW);                          //start the burst write
+  _SPITransactions++;
   SPI.transfer(WREG_FIFO);
 
   for (index = 0; index < size; index++)
@@ -3342,6 +3787,7 @@ uint8_t SX127XLT::getByteSXBuffer(uint8_t addr)
 #endif
 
   digitalWrite(_NSS, LOW);                    //start the burst read
+  _SPITransactions++;
   SPI.transfer(REG_FIFO);
   regdata = SPI.transfer(0);
   digitalWrite(_NSS, HIGH);
@@ -3368,6 +3814,7 @@ void SX127XLT::writeByteSXBuffer(uint8_t addr, uint8_t regdata)
 #endif
 
   digitalWrite(_NSS, LOW);                //start the burst read
+  _SPITransactions++;
   SPI.transfer(WREG_FIFO);
   SPI.transfer(regdata);
   digitalWrite(_NSS, HIGH);
@@ -3393,6 +3840,7 @@ void SX127XLT::startWriteSXBuffer(uint8_t ptr)
 #endif
 
   digitalWrite(_NSS, LOW);
+  _SPITransactions++;
   SPI.transfer(WREG_FIFO);
 }
 
@@ -3428,6 +3876,7 @@ void SX127XLT::startReadSXBuffer(uint8_t ptr)
 #endif
 
   digitalWrite(_NSS, LOW);                       //start the burst read
+  _SPITransactions++;
   SPI.transfer(REG_FIFO);
 
   //next line would be data = SPI.transfer(0);
@@ -3738,17 +4187,12 @@ void SX127XLT::writeBuffer(uint8_t *txbuffer, uint8_t size)
   Serial.println(F("writeBuffer() "));
 #endif
 
-  uint8_t index, regdata;
 
   _TXPacketL = _TXPacketL + size;      //these are the number of bytes that will be added
 
   size--;                              //loose one byte from size, the last byte written MUST be a 0
 
-  for (index = 0; index < size; index++)
-  {
-    regdata = txbuffer[index];
-    SPI.transfer(regdata);
-  }
+  LTSPIwriteBytes(txbuffer, size);
 
   SPI.transfer(0);                     //this ensures last byte of buffer writen really is a null (0)
 }
@@ -3760,17 +4204,12 @@ void SX127XLT::writeBufferChar(char *txbuffer, uint8_t size)
   Serial.println(F("writeBufferChar() "));
 #endif
 
-  uint8_t index, regdata;
 
   _TXPacketL = _TXPacketL + size;      //these are the number of bytes that will be added
 
   size--;                              //loose one byte from size, the last byte written MUST be a 0
 
-  for (index = 0; index < size; index++)
-  {
-    regdata = txbuffer[index];
-    SPI.transfer(regdata);
-  }
+  LTSPIwriteBytes((uint8_t *) txbuffer, size);
 
   SPI.transfer(0);                     //this ensures last byte of buffer writen really is a null (0)
 }
@@ -3824,13 +4263,8 @@ uint8_t SX127XLT::readBuffer(uint8_t *rxbuffer, uint8_t size)
   Serial.println(F("readBuffer() "));
 #endif
 
-  uint8_t index, regdata;
 
-  for (index = 0; index < size; index++)
-  {
-    regdata = SPI.transfer(0);
-    rxbuffer[index] = regdata;            //fill the rxbuffer.
-  }
+  LTSPIreadBytes(rxbuffer, size);
 
   _RXPacketL = _RXPacketL + size;        //increment count of bytes read
 
@@ -3929,6 +4363,7 @@ void SX127XLT::toneFM(uint16_t frequency, uint32_t length, uint32_t deviation, f
 #endif
 
   digitalWrite(_NSS, LOW);           //set NSS low
+  _SPITransactions++;
   SPI.transfer(REG_FRMSB & 0x7F);    //mask address for read
   freqregH = SPI.transfer(0);
   freqregM = SPI.transfer(0);
@@ -4006,6 +4441,7 @@ void SX127XLT::toneFM(uint16_t frequency, uint32_t length, uint32_t deviation, f
   for (index = 1; index <= loopcount; index++)
   {
     digitalWrite(_NSS, LOW);                  //set NSS low
+    _SPITransactions++;
     SPI.transfer(0x86);                       //address for write to REG_FRMSB
     SPI.transfer(ShiftH);
     SPI.transfer(ShiftM);
@@ -4015,6 +4451,7 @@ void SX127XLT::toneFM(uint16_t frequency, uint32_t length, uint32_t deviation, f
     delayMicroseconds(ToneDelayus);
 
     digitalWrite(_NSS, LOW);                  //set NSS low
+    _SPITransactions++;
     SPI.transfer(0x86);                       //address for write to REG_FRMSB
     SPI.transfer(NoShiftH);
     SPI.transfer(NoShiftM);
@@ -4025,6 +4462,7 @@ void SX127XLT::toneFM(uint16_t frequency, uint32_t length, uint32_t deviation, f
   }
   //now set the frequency registers back to centre
   digitalWrite(_NSS, LOW);                    //set NSS low
+  _SPITransactions++;
   SPI.transfer(0x86);                         //address for write to REG_FRMSB
   SPI.transfer(freqregH);
   SPI.transfer(freqregM);
@@ -4130,6 +4568,7 @@ void SX127XLT::setRfFrequencyDirect(uint8_t high, uint8_t mid, uint8_t low)
 #endif
 
   digitalWrite(_NSS, LOW);                  //set NSS low
+  _SPITransactions++;
   SPI.transfer(0x86);                       //address for write to REG_FRMSB
   SPI.transfer(high);
   SPI.transfer(mid);
@@ -4139,6 +4578,12 @@ void SX127XLT::setRfFrequencyDirect(uint8_t high, uint8_t mid, uint8_t low)
 #ifdef USE_SPI_TRANSACTION
   SPI.endTransaction();
 #endif
+
+#ifdef USE_REGISTER_CACHE
+  updateRegisterCache(REG_FRMSB, high);     //always written, timing of the FSK shifts should not vary
+  updateRegisterCache(REG_FRMID, mid);
+  updateRegisterCache(REG_FRLSB, low);
+#endif
 }
 
 
@@ -4155,6 +4600,7 @@ void SX127XLT::getRfFrequencyRegisters(uint8_t *buff)
 #endif
 
   digitalWrite(_NSS, LOW);                  //set NSS low
+  _SPITransactions++;
   SPI.transfer(REG_FRMSB & 0x7F);           //mask address for read
   buff[0] = SPI.transfer(0);                //read the byte into buffer
   buff[1] = SPI.transfer(0);                //read the byte into buffer
@@ -4463,18 +4909,11 @@ uint8_t SX127XLT::readBufferbytes(uint8_t *buffer, uint8_t size)
   Serial.println(F("readBufferbytes() "));
 #endif
 
-  uint8_t ptr = 0, regdata, index;
-
-  for (index = 1; index <= size; index++)
-  {
-    regdata = SPI.transfer(0);
-    buffer[ptr] = regdata;              //fill the buffer.
-    ptr++;
-  }
+  LTSPIreadBytes(buffer, size);         //fill the buffer.
 
   _RXPacketL = _RXPacketL + size;       //increment count of bytes read and written to buffer
 
-  return index;                         //return the actual size of the buffer
+  return size;                          //return the actual size of the buffer
 }
 
 
@@ -4484,17 +4923,11 @@ uint8_t SX127XLT::writeBufferbytes(uint8_t *buffer, uint8_t size)
   Serial.println(F("writeBufferbytes() "));
 #endif
 
-  uint8_t regdata, index;
-
-  for (index = 0; index < size; index++)
-  {
-    regdata = buffer[index];
-    SPI.transfer(regdata);
-  }
+  LTSPIwriteBytes(buffer, size);
 
   _TXPacketL = _TXPacketL + size;       //increment count of bytes read and written to buffer
 
-  return index;                         //return the actual size of the buffer
+  return size;                          //return the actual size of the buffer
 }
 
 
@@ -4523,2435 +4956,542 @@ void SX127XLT::setDeviceRFO()
 // Reliable packet routines - added August 2021
 // Routines assume that REG_FIFOTXBASEADDR and REG_FIFORXBASEADDR are set to 0 by setupLoRa()
 // 20/09/20 Changed operation of getRXPayloadCRC(), getTXPayloadCRC(),getRXNetworkID(),getTXNetworkID()
+// The reliable packets, ACKs and pollReliable() are in LTReliableCore.h, shared with the SX126X and SX128X
 //****************************************************************************
 
 
-uint8_t SX127XLT::transmitReliable(uint8_t *txbuffer, uint8_t size, uint16_t networkID, uint32_t txtimeout, int8_t txpower, uint8_t wait)
+void SX127XLT::writeUint16SXBuffer(uint8_t addr, uint16_t regdata)
 {
 #ifdef SX127XDEBUGRELIABLE
-  Serial.println();
-  Serial.println(F(" {RELIABLE} transmitRELIABLE() "));
-  Serial.print(F(" {RELIABLE} _ReliableConfig "));
-  Serial.println(_ReliableConfig, HEX);
-  Serial.print(F(" {RELIABLE} Payload length "));
-  Serial.println(size);
+  Serial.print(F(" {RELIABLE} writeUint16SXBuffer() 0x"));
+  Serial.print(addr, HEX);
+  Serial.print(F(" 0x"));
+  Serial.println(regdata, HEX);
 #endif
 
-  uint8_t index, tempdata;
-  uint16_t payloadcrc;
-  uint32_t startmS;
-
-  _ReliableErrors = 0;
-  _ReliableFlags = 0;
-
-  if (size > 251)
-  {
-    bitSet(_ReliableErrors, ReliableSizeError);
-    return 0;
-  }
-
-  setMode(MODE_STDBY_RC);
-  _TXPacketL = size + 4;
-
-  if (bitRead(_ReliableConfig, NoReliableCRC))
-  {
-    payloadcrc = 0;
-  }
-  else
-  {
-    payloadcrc = CRCCCITT(txbuffer, size, 0xFFFF);
-  }
-
-  writeRegister(REG_FIFOADDRPTR, 0);          //set PTR to start of FIFO
+  setMode(MODE_STDBY_RC);                 //this is needed to ensure we can write to buffer OK.
+  writeRegister(REG_FIFOADDRPTR, addr);   //set FIFO access ptr to location
 
 #ifdef USE_SPI_TRANSACTION
   SPI.beginTransaction(SPISettings(LTspeedMaximum, LTdataOrder, LTdataMode));
 #endif
 
-  digitalWrite(_NSS, LOW);
+  digitalWrite(_NSS, LOW);                //start the burst read
+  _SPITransactions++;
   SPI.transfer(WREG_FIFO);
-
-  for (index = 0; index < size; index++)
-  {
-    tempdata = txbuffer[index];
-    SPI.transfer(tempdata);
-  }
-
-  SPI.transfer(lowByte(networkID));
-  SPI.transfer(highByte(networkID));
-  SPI.transfer(lowByte(payloadcrc));
-  SPI.transfer(highByte(payloadcrc));
-
+  SPI.transfer(lowByte(regdata));
+  SPI.transfer(highByte(regdata));
   digitalWrite(_NSS, HIGH);
 
 #ifdef USE_SPI_TRANSACTION
   SPI.endTransaction();
 #endif
-
-  writeRegister(REG_PAYLOADLENGTH, _TXPacketL);
-
-  setTxParams(txpower, RADIO_RAMP_DEFAULT);            //TX power and ramp time
-  setDioIrqParams(IRQ_RADIO_ALL, IRQ_TX_DONE, 0, 0);   //set for IRQ on TX done on first DIO pin
-  setTx(0);                                            //TX timeout is not handled in setTX()
-
-  if (!wait)
-  {
-    return _TXPacketL;
-  }
-
-  if (txtimeout == 0)
-  {
-    while (!digitalRead(_TXDonePin));                  //Wait for pin to go high, TX finished
-  }
-  else
-  {
-    startmS = millis();
-    while (!digitalRead(_TXDonePin) && ((uint32_t) (millis() - startmS) < txtimeout));
-  }
-
-  setMode(MODE_STDBY_RC);                              //ensure we leave function with TX off
-
-  if (!digitalRead(_TXDonePin))                        //if _TXDonePin is still low its a TX timeout
-  {
-    _IRQmsb = IRQ_TX_TIMEOUT;
-    return 0;
-  }
-
-  return _TXPacketL;
 }
 
 
-uint8_t SX127XLT::transmitReliableAutoACK(uint8_t *txbuffer, uint8_t size, uint16_t networkID, uint32_t acktimeout, uint32_t txtimeout, int8_t txpower, uint8_t wait)
+uint16_t SX127XLT::readUint16SXBuffer(uint8_t addr)
 {
 #ifdef SX127XDEBUGRELIABLE
-  Serial.println(F(" {RELIABLE} transmitReliableAutoACK() "));
-  Serial.print(F(" {RELIABLE} _ReliableConfig "));
-  Serial.println(_ReliableConfig, HEX);
-  Serial.print(F(" {RELIABLE} Payload length "));
-  Serial.println(size);
+  Serial.print(F(" {RELIABLE} readUint16SXBuffer() 0x"));
+  Serial.println(addr, HEX);
 #endif
 
-  uint8_t index, tempdata, RXPacketL;
-  uint16_t payloadcrc;
-  uint32_t startmS;
-
-  _ReliableErrors = 0;
-  _ReliableFlags = 0;
-
-  if (size > 251)
-  {
-    bitSet(_ReliableErrors, ReliableSizeError);
-    return 0;
-  }
-
-  setMode(MODE_STDBY_RC);
-  _TXPacketL = size + 4;
-
-  if (bitRead(_ReliableConfig, NoReliableCRC))
-  {
-    payloadcrc = 0;
-  }
-  else
-  {
-    payloadcrc = CRCCCITT(txbuffer, size, 0xFFFF);
-  }
+  uint8_t regdatalow, regdatahigh;
+  setMode(MODE_STDBY_RC);                     //this is needed to ensure we can read from buffer OK.
 
-  writeRegister(REG_FIFOADDRPTR, 0);                        //and save in FIFO access ptr
+  writeRegister(REG_FIFOADDRPTR, addr);       //set FIFO access ptr to location
 
 #ifdef USE_SPI_TRANSACTION
   SPI.beginTransaction(SPISettings(LTspeedMaximum, LTdataOrder, LTdataMode));
 #endif
 
-  digitalWrite(_NSS, LOW);
-  SPI.transfer(WREG_FIFO);
-
-  for (index = 0; index < size; index++)
-  {
-    tempdata = txbuffer[index];
-    SPI.transfer(tempdata);
-  }
-
-  SPI.transfer(lowByte(networkID));
-  SPI.transfer(highByte(networkID));
-  SPI.transfer(lowByte(payloadcrc));
-  SPI.transfer(highByte(payloadcrc));
-
+  digitalWrite(_NSS, LOW);                    //start the burst read
+  _SPITransactions++;
+  SPI.transfer(REG_FIFO);
+  regdatalow = SPI.transfer(0);
+  regdatahigh = SPI.transfer(0);
   digitalWrite(_NSS, HIGH);
 
 #ifdef USE_SPI_TRANSACTION
   SPI.endTransaction();
 #endif
 
-  writeRegister(REG_PAYLOADLENGTH, _TXPacketL);
-  setTxParams(txpower, RADIO_RAMP_DEFAULT);            //TX power and ramp time
-  setDioIrqParams(IRQ_RADIO_ALL, IRQ_TX_DONE, 0, 0);   //set for IRQ on TX done on first DIO pin
-  setTx(0);                                            //TX timeout is not handled in setTX()
-
-  if (!wait)
-  {
-    return _TXPacketL;
-  }
+  return (regdatalow + (regdatahigh << 8));
+}
 
-  if (txtimeout == 0)
-  {
-    while (!digitalRead(_TXDonePin));                  //Wait for pin to go high, TX finished
-  }
-  else
-  {
-    startmS = millis();
-    while (!digitalRead(_TXDonePin) && ((uint32_t) (millis() - startmS) < txtimeout));
-  }
 
-  setMode(MODE_STDBY_RC);                              //ensure we leave function with TX off
+uint8_t SX127XLT::readReliableErrors()
+{
+#ifdef SX127XDEBUGRELIABLE
+  Serial.println(F(" {RELIABLE} readReliableErrors()"));
+#endif
 
-  if (!digitalRead(_TXDonePin))                        //if _TXDonePin is still low its a TX timeout
-  {
-    _IRQmsb = IRQ_TX_TIMEOUT;
-    return 0;
-  }
+  return _ReliableErrors;
+}
 
-  RXPacketL = waitReliableACK(networkID, payloadcrc, acktimeout);
 
-  if (RXPacketL != 4)
-  {
-    return 0;
-  }
+uint8_t SX127XLT::readReliableFlags()
+{
+#ifdef SX127XDEBUGRELIABLE
+  Serial.println(F(" {RELIABLE} readReliableFlags()"));
+#endif
 
-  return _TXPacketL;
+  return _ReliableFlags;
 }
 
 
-uint8_t SX127XLT::receiveReliable(uint8_t *rxbuffer, uint8_t size, uint16_t networkID, uint32_t rxtimeout, uint8_t wait )
+uint8_t SX127XLT::readReliableConfig()
 {
+#ifdef SX127XDEBUGRELIABLE
+  Serial.println(F(" {RELIABLE} readReliableConfig()"));
+#endif
+
+  return _ReliableConfig;
+}
 
-  //Maximum LoRa packet size is 255 bytes, so allowing for the 4 bytes appended to the end of a reliable
-  //packet, the maximum payload size is 251 bytes. So to avoid overwriting memory, we do need to check if
-  //the passed array is big enough to take the payload received in the packet. The assumed payload length will
-  //always be 4 bytes less than the received packet length
 
+void SX127XLT::setReliableConfig(uint8_t bitset)
+{
 #ifdef SX127XDEBUGRELIABLE
-  Serial.println();
-  Serial.println(F(" {RELIABLE} receiveReliable()"));
-  Serial.print(F(" {RELIABLE} _ReliableConfig "));
-  Serial.println(_ReliableConfig, HEX);
+  Serial.print(F(" {RELIABLE} setReliableConfig() bit "));
+  Serial.println(bitset);
 #endif
 
-  uint16_t payloadcrc = 0, RXcrc, RXnetworkID = 0;
-  uint32_t startmS;
-  uint8_t regdataL, regdataH;
-  uint8_t index;
+  bitSet(_ReliableConfig, bitset);
+  return;
+}
 
-  _ReliableErrors = 0;
-  _ReliableFlags = 0;
 
-  if (size > 251 )
-  {
-    bitSet(_ReliableErrors, ReliableSizeError);
-    return 0;
-  }
-
-  setMode(MODE_STDBY_RC);
-  setDioIrqParams(IRQ_RADIO_ALL, IRQ_RX_DONE, 0, 0);                       //set for IRQ on RX done
-  writeRegister(REG_FIFOADDRPTR, 0);                                       //and save in FIFO access ptr
-  setRx(0);                                                                //no actual RX timeout in this function
-
-  if (!wait)
-  {
-    return 0;                                                              //not wait requested so no packet length to pass
-  }
-
-  if (rxtimeout == 0)
-  {
-    while (!digitalRead(_RXDonePin));                                      //Wait for DIO0 to go high, no timeout, RX DONE
-  }
-  else
-  {
-    startmS = millis();
-    while   ( (!digitalRead(_RXDonePin) && ((uint32_t) (millis() - startmS) < rxtimeout)) || ((readRegister(REG_MODEMSTAT) & 0x03)) )  ;
-  }
-
-  setMode(MODE_STDBY_RC);                                                  //ensure to stop further packet reception
-
-  if (!digitalRead(_RXDonePin))                                            //check if DIO still low, is so must be RX timeout
-  {
-    _IRQmsb = IRQ_RX_TIMEOUT;
-    return 0;
-  }
-
-  if ( readIrqStatus() != (IRQ_RX_DONE + IRQ_HEADER_VALID) )
-  {
-    return 0;                                                              //no RX done and header valid only, could be CRC error
-  }
-
-  _RXPacketL = readRegister(REG_RXNBBYTES);
-
-  if (_RXPacketL < 4)    //check received packet is 4 or more bytes long
-  {
-    bitSet(_ReliableErrors, ReliableSizeError);
-    return 0;
-  }
-
-  if ((_RXPacketL - 4) > size )                        //check if calculated payload size (_RXPacketL -4) fits in array
-  {
-    bitSet(_ReliableErrors, ReliableSizeError);
-    return 0;
-  }
-
-  writeRegister(REG_FIFOADDRPTR, 0);
-
-#ifdef USE_SPI_TRANSACTION
-  SPI.beginTransaction(SPISettings(LTspeedMaximum, LTdataOrder, LTdataMode));
-#endif
-
-  digitalWrite(_NSS, LOW);                              //start the burst read
-  SPI.transfer(REG_FIFO);
-
-  for (index = 0; index < (_RXPacketL - 4); index++)
-  {
-    regdataL = SPI.transfer(0);
-    rxbuffer[index] = regdataL;
-  }
-
-  regdataL = SPI.transfer(0);
-  regdataH = SPI.transfer(0);
-  RXnetworkID = ((uint16_t) regdataH << 8) + regdataL;
-  regdataL = SPI.transfer(0);
-  regdataH = SPI.transfer(0);
-
-  digitalWrite(_NSS, HIGH);
-
-#ifdef USE_SPI_TRANSACTION
-  SPI.endTransaction();
-#endif
-
-  if (!bitRead(_ReliableConfig, NoReliableCRC))
-  {
-    payloadcrc = CRCCCITT(rxbuffer, (_RXPacketL - 4), 0xFFFF);
-    RXcrc = ((uint16_t) regdataH << 8) + regdataL;
-
-    if (payloadcrc != RXcrc)
-    {
-      bitSet(_ReliableErrors, ReliableCRCError);
-    }
-  }
-
-  if (RXnetworkID != networkID)
-  {
-    bitSet(_ReliableErrors, ReliableIDError);
-  }
-
-  if (_ReliableErrors)                                      //if there has been a reliable error return a RX fail
-  {
-    return 0;
-  }
-
-  return _RXPacketL;                                        //return and indicate RX OK.
-}
-
-
-uint8_t SX127XLT::receiveReliableAutoACK(uint8_t *rxbuffer, uint8_t size, uint16_t networkID, uint32_t ackdelay, int8_t txpower, uint32_t rxtimeout, uint8_t wait )
-{
-  //Maximum LoRa packet size is 255 bytes, so allowing for the 4 bytes appended to the end of a reliable
-  //packet, the maximum payload size is 251 bytes. So to avoid overwriting memory, we do need to check if
-  //the passed array is big enough to take the payload received in the packet. The assumed payload length will
-  //always be 4 bytes less than the received packet length
-
-
-#ifdef SX127XDEBUGRELIABLE
-  Serial.println();
-  Serial.println(F(" {RELIABLE} receiveReliableAutoACK()"));
-  Serial.print(F(" {RELIABLE} _ReliableConfig "));
-  Serial.println(_ReliableConfig, HEX);
-#endif
-
-  uint16_t payloadcrc = 0, RXcrc, RXnetworkID = 0;
-  uint32_t startmS;
-  uint8_t regdataL, regdataH, index;
-
-  _ReliableErrors = 0;
-  _ReliableFlags = 0;
-
-
-  if (size > 251 )
-  {
-    bitSet(_ReliableErrors, ReliableSizeError);
-    return 0;
-  }
-
-  setMode(MODE_STDBY_RC);
-  setDioIrqParams(IRQ_RADIO_ALL, IRQ_RX_DONE, 0, 0);                       //set for IRQ on RX done
-  writeRegister(REG_FIFOADDRPTR, 0);
-  setRx(0);                                                                //no actual RX timeout in this function
-
-  if (!wait)
-  {
-    return 0;                                                              //not wait requested so no packet length to pass
-  }
-
-  if (rxtimeout == 0)
-  {
-    while (!digitalRead(_RXDonePin));                                      //Wait for DIO0 to go high, no timeout, RX DONE
-  }
-  else
-  {
-    startmS = millis();
-    while (!digitalRead(_RXDonePin) && ((uint32_t) (millis() - startmS) < rxtimeout));
-  }
-
-  setMode(MODE_STDBY_RC);                                                  //ensure to stop further packet reception
-
-  if (!digitalRead(_RXDonePin))                                            //check if DIO still low, is so must be RX timeout
-  {
-    _IRQmsb = IRQ_RX_TIMEOUT;
-    return 0;
-  }
-
-  if ( readIrqStatus() != (IRQ_RX_DONE + IRQ_HEADER_VALID) )
-  {
-    return 0;                                                              //no RX done and header valid only, could be CRC error
-  }
-
-  _RXPacketL = readRegister(REG_RXNBBYTES);
-
-  if (_RXPacketL < 4)    //check received packet is 4 or more bytes long
-  {
-    bitSet(_ReliableErrors, ReliableSizeError);
-    return 0;
-  }
-
-  if ((_RXPacketL - 4) > size )                      //check if calculated payload size (_RXPacketL -4) fits in array
-  {
-    bitSet(_ReliableErrors, ReliableSizeError);
-    return 0;
-  }
-
-  writeRegister(REG_FIFOADDRPTR, 0);             //set FIFO access ptr to beginning of packet
-
-#ifdef USE_SPI_TRANSACTION
-  SPI.beginTransaction(SPISettings(LTspeedMaximum, LTdataOrder, LTdataMode));
-#endif
-
-  digitalWrite(_NSS, LOW);                    //start the burst read
-  SPI.transfer(REG_FIFO);
-
-  for (index = 0; index < (_RXPacketL - 4); index++)
-  {
-    regdataL = SPI.transfer(0);
-    rxbuffer[index] = regdataL;
-  }
-
-  regdataL = SPI.transfer(0);
-  regdataH = SPI.transfer(0);
-  RXnetworkID = ((uint16_t) regdataH << 8) + regdataL;
-  regdataL = SPI.transfer(0);
-  regdataH = SPI.transfer(0);
-  digitalWrite(_NSS, HIGH);
-
-#ifdef USE_SPI_TRANSACTION
-  SPI.endTransaction();
-#endif
-
-  if (!bitRead(_ReliableConfig, NoReliableCRC))
-  {
-    payloadcrc = CRCCCITT(rxbuffer, (_RXPacketL - 4), 0xFFFF);
-    RXcrc = ((uint16_t) regdataH << 8) + regdataL;
-
-    if (payloadcrc != RXcrc)
-    {
-      bitSet(_ReliableErrors, ReliableCRCError);
-    }
-  }
-
-  if (RXnetworkID != networkID)
-  {
-    bitSet(_ReliableErrors, ReliableIDError);
-  }
-
-  if (_ReliableErrors)                                    //if there has been a reliable error return a RX fail
-  {
-    return 0;
-  }
-
-  delay(ackdelay);
-  _TXPacketL = sendReliableACK(RXnetworkID, payloadcrc, txpower);
-
-  if (_TXPacketL != 4)
-  {
-    return 0;
-  }
-
-  return _RXPacketL;                                        //return and indicate RX OK.
-}
-
-
-uint8_t SX127XLT::sendReliableACK(uint16_t networkID, uint16_t payloadcrc, int8_t txpower)
-{
-
-#ifdef SX127XDEBUGRELIABLE
-  Serial.println(F(" {RELIABLE} sendReliableACK()"));
-#endif
-
-  uint32_t startmS, txtimeout = 60000;                       //set TX timeout to 60 seconds
-
-  _TXPacketL = 4;                                            //packet is networkId (2 bytes) + payloadCRC (2 bytes)
-
-  setMode(MODE_STDBY_RC);
-
-  writeUint16SXBuffer(0, networkID);
-  writeUint16SXBuffer(2, payloadcrc);
-
-  writeRegister(REG_PAYLOADLENGTH, 4);
-  setTxParams(txpower, RADIO_RAMP_DEFAULT);                  //TX power and ramp time
-  setDioIrqParams(IRQ_RADIO_ALL, IRQ_TX_DONE, 0, 0);         //set for IRQ on TX done
-  setTx(0);                                                  //start transmission
-
-  startmS = millis();
-  while (!digitalRead(_TXDonePin) && ((uint32_t) (millis() - startmS) < txtimeout));
-
-  setMode(MODE_STDBY_RC);                                    //ensure we leave function with TX off
-
-  if (!digitalRead(_TXDonePin))
-  {
-    _IRQmsb = IRQ_TX_TIMEOUT;
-    return 0;
-  }
-
-  bitSet(_ReliableFlags, ReliableACKSent);
-  return 4;                                                  //TX OK so return TXpacket length
-}
-
-
-uint8_t SX127XLT::sendReliableACK(uint8_t *txbuffer, uint8_t size, uint16_t networkID, uint16_t payloadcrc, int8_t txpower)
-{
-  //overloaded version of sendReliableACK() for use when ack contains payload data
-#ifdef SX127XDEBUGRELIABLE
-  Serial.print(F(" {RELIABLE} sendReliableACK() "));
-  Serial.print(F("buffer size "));
-  Serial.println(size);
-#endif
-
-  uint32_t startmS, txtimeout = 60000;                         //set TX timeout to 15 seconds
-  uint8_t bufferdata, index;
-
-  setMode(MODE_STDBY_RC);
-  writeRegister(REG_FIFOADDRPTR, 0);                           //set ptr to write packet
-  _TXPacketL = size + 4;
-
-#ifdef USE_SPI_TRANSACTION
-  SPI.beginTransaction(SPISettings(LTspeedMaximum, LTdataOrder, LTdataMode));
-#endif
-
-  digitalWrite(_NSS, LOW);
-  SPI.transfer(WREG_FIFO);
-
-  for (index = 0; index < size; index++)
-  {
-    bufferdata = txbuffer[index];
-    SPI.transfer(bufferdata);
-  }
-
-  SPI.transfer(lowByte(networkID));
-  SPI.transfer(highByte(networkID));
-  SPI.transfer(lowByte(payloadcrc));
-  SPI.transfer(highByte(payloadcrc));
-
-  digitalWrite(_NSS, HIGH);
-
-#ifdef USE_SPI_TRANSACTION
-  SPI.endTransaction();
-#endif
-
-  writeRegister(REG_PAYLOADLENGTH, _TXPacketL);
-  setTxParams(txpower, RADIO_RAMP_DEFAULT);                  //TX power and ramp time
-  setDioIrqParams(IRQ_RADIO_ALL, IRQ_TX_DONE, 0, 0);         //set for IRQ on TX done
-  setTx(0);                                                  //start transmission
-
-  startmS = millis();
-  while (!digitalRead(_TXDonePin) && ((uint32_t) (millis() - startmS) < txtimeout));
-
-  setMode(MODE_STDBY_RC);                                    //ensure we leave function with TX off
-
-  if (!digitalRead(_TXDonePin))
-  {
-    _IRQmsb = IRQ_TX_TIMEOUT;
-    return 0;
-  }
-
-  bitSet(_ReliableFlags, ReliableACKSent);
-  return _TXPacketL;                                          //TX OK so return TXpacket length
-}
-
-
-uint8_t SX127XLT::waitReliableACK(uint16_t networkID, uint16_t payloadcrc, uint32_t acktimeout)
-{
-
-#ifdef SX127XDEBUGRELIABLE
-  Serial.println(F(" {RELIABLE} waitReliableACK()"));
-#endif
-
-  uint16_t RXnetworkID, RXcrc;
-  uint32_t startmS;
-
-  setReliableRX();
-  startmS = millis();
-
-  do
-  {
-    if (digitalRead(_RXDonePin))                                             //has a packet arrived ?
-    {
-      if ( readIrqStatus() != (IRQ_RX_DONE + IRQ_HEADER_VALID) )
-      {
-        setReliableRX();
-        continue;
-      }
-
-      _RXPacketL = readRegister(REG_RXNBBYTES);
-
-      RXnetworkID = readUint16SXBuffer(_RXPacketL - 4);
-      RXcrc = readUint16SXBuffer(_RXPacketL - 2);
-
-      if ( (RXnetworkID == networkID) && (RXcrc == payloadcrc))
-      {
-        bitSet(_ReliableFlags, ReliableACKReceived);
-        return 4;                                                            //return value of 4 indicates valid ack
-      }
-      else
-      {
-        setReliableRX();
-        continue;
-      }
-    }
-
-  } while ( ((uint32_t) (millis() - startmS) < acktimeout)  || ((readRegister(REG_MODEMSTAT) & 0x03)) );
-
-  bitSet(_ReliableErrors, ReliableACKError);
-  return 0;
-}
-
-
-uint8_t SX127XLT::waitReliableACK(uint8_t *rxbuffer, uint8_t size, uint16_t networkID, uint16_t payloadcrc, uint32_t acktimeout)
-{
-  //overloaded version of waitReliableACK() for use when ack contains payload data
-#ifdef SX127XDEBUGRELIABLE
-  Serial.println(F(" {RELIABLE} waitReliableACK()"));
-#endif
-
-  uint16_t RXnetworkID, RXcrc;
-  uint32_t startmS;
-  uint8_t regdata, index;
-
-
-  if (size > 251 )
-  {
-    bitSet(_ReliableErrors, ReliableSizeError);
-    return 0;
-  }
-
-  setReliableRX();
-  startmS = millis();
-
-  do
-  {
-    if (digitalRead(_RXDonePin))                                             //has a packet arrived ?
-    {
-      if ( readIrqStatus() != (IRQ_RX_DONE + IRQ_HEADER_VALID) )
-      {
-        setReliableRX();
-        continue;
-      }
-
-      _RXPacketL = readRegister(REG_RXNBBYTES);
-      RXnetworkID = readUint16SXBuffer(_RXPacketL - 4);
-      RXcrc = readUint16SXBuffer(_RXPacketL - 2);
-
-      if ( (RXnetworkID == networkID) && (RXcrc == payloadcrc))
-      {
-        if ((_RXPacketL - 4) > size )                        //check passed buffer is big enough for payload
-        {
-          bitSet(_ReliableErrors, ReliableACKError);
-          bitSet(_ReliableErrors, ReliableSizeError);
-          return 0;
-        }
-
-        bitSet(_ReliableFlags, ReliableACKReceived);
-        writeRegister(REG_FIFOADDRPTR, 0);                   //set FIFO access ptr
-
-#ifdef USE_SPI_TRANSACTION
-        SPI.beginTransaction(SPISettings(LTspeedMaximum, LTdataOrder, LTdataMode));
-#endif
-
-        digitalWrite(_NSS, LOW);                             //start the burst read
-        SPI.transfer(REG_FIFO);
-
-        for (index = 0; index < (_RXPacketL - 4); index++)   //read packet into rxbuffer
-        {
-          regdata = SPI.transfer(0);
-          rxbuffer[index] = regdata;
-        }
-        digitalWrite(_NSS, HIGH);
-
-#ifdef USE_SPI_TRANSACTION
-        SPI.endTransaction();
-#endif
-
-        return _RXPacketL;                                    //_RXPacketL should be payload length + 4
-      }
-      else
-      {
-        setReliableRX();
-        continue;
-      }
-    }
-  } while ( ((uint32_t) (millis() - startmS) < acktimeout)  || ((readRegister(REG_MODEMSTAT) & 0x03)) );
-
-  bitSet(_ReliableErrors, ReliableACKError);
-  return 0;
-}
-
-
-void SX127XLT::writeUint16SXBuffer(uint8_t addr, uint16_t regdata)
-{
-#ifdef SX127XDEBUGRELIABLE
-  Serial.print(F(" {RELIABLE} writeUint16SXBuffer() 0x"));
-  Serial.print(addr, HEX);
-  Serial.print(F(" 0x"));
-  Serial.println(regdata, HEX);
-#endif
-
-  setMode(MODE_STDBY_RC);                 //this is needed to ensure we can write to buffer OK.
-  writeRegister(REG_FIFOADDRPTR, addr);   //set FIFO access ptr to location
-
-#ifdef USE_SPI_TRANSACTION
-  SPI.beginTransaction(SPISettings(LTspeedMaximum, LTdataOrder, LTdataMode));
-#endif
-
-  digitalWrite(_NSS, LOW);                //start the burst read
-  SPI.transfer(WREG_FIFO);
-  SPI.transfer(lowByte(regdata));
-  SPI.transfer(highByte(regdata));
-  digitalWrite(_NSS, HIGH);
-
-#ifdef USE_SPI_TRANSACTION
-  SPI.endTransaction();
-#endif
-}
-
-
-uint16_t SX127XLT::readUint16SXBuffer(uint8_t addr)
-{
-#ifdef SX127XDEBUGRELIABLE
-  Serial.print(F(" {RELIABLE} readUint16SXBuffer() 0x"));
-  Serial.println(addr, HEX);
-#endif
-
-  uint8_t regdatalow, regdatahigh;
-  setMode(MODE_STDBY_RC);                     //this is needed to ensure we can read from buffer OK.
-
-  writeRegister(REG_FIFOADDRPTR, addr);       //set FIFO access ptr to location
-
-#ifdef USE_SPI_TRANSACTION
-  SPI.beginTransaction(SPISettings(LTspeedMaximum, LTdataOrder, LTdataMode));
-#endif
-
-  digitalWrite(_NSS, LOW);                    //start the burst read
-  SPI.transfer(REG_FIFO);
-  regdatalow = SPI.transfer(0);
-  regdatahigh = SPI.transfer(0);
-  digitalWrite(_NSS, HIGH);
-
-#ifdef USE_SPI_TRANSACTION
-  SPI.endTransaction();
-#endif
-
-  return (regdatalow + (regdatahigh << 8));
-}
-
-
-uint8_t SX127XLT::readReliableErrors()
-{
-#ifdef SX127XDEBUGRELIABLE
-  Serial.println(F(" {RELIABLE} readReliableErrors()"));
-#endif
-
-  return _ReliableErrors;
-}
-
-
-uint8_t SX127XLT::readReliableFlags()
-{
-#ifdef SX127XDEBUGRELIABLE
-  Serial.println(F(" {RELIABLE} readReliableFlags()"));
-#endif
-
-  return _ReliableFlags;
-}
-
-
-uint8_t SX127XLT::readReliableConfig()
-{
-#ifdef SX127XDEBUGRELIABLE
-  Serial.println(F(" {RELIABLE} readReliableConfig()"));
-#endif
-
-  return _ReliableConfig;
-}
-
-
-void SX127XLT::setReliableConfig(uint8_t bitset)
-{
-#ifdef SX127XDEBUGRELIABLE
-  Serial.print(F(" {RELIABLE} setReliableConfig() bit "));
-  Serial.println(bitset);
-#endif
-
-  bitSet(_ReliableConfig, bitset);
-  return;
-}
-
-
-void SX127XLT::clearReliableConfig(uint8_t bitclear)
-{
-#ifdef SX127XDEBUGRELIABLE
-  Serial.print(F(" {RELIABLE} clearReliableConfig() bit "));
-  Serial.println(bitclear);
-#endif
-
-  bitClear(_ReliableConfig, bitclear);
-  return;
-}
-
-
-uint8_t SX127XLT::getReliableConfig(uint8_t bitread)
-{
-#ifdef SX127XDEBUGRELIABLE
-  Serial.print(F(" {RELIABLE} getReliableConfig() "));
-  Serial.println(_ReliableConfig);
-#endif
-
-  return bitRead(_ReliableConfig, bitread);
-}
-
-
-void SX127XLT::printReliableConfig()
-
-{
-#ifdef SX127XDEBUGRELIABLE
-  Serial.print(F(" {RELIABLE} printReliableConfig() "));
-#endif
-
-  Serial.print(F("ReliableConfig"));
-
-  //bit 0x00
-  if (bitRead(_ReliableConfig, NoReliableCRC))
-  {
-    Serial.print(F(",CRCdisabled"));
-  }
-  else
-  {
-    Serial.print(F(",CRCenabled"));
-  }
-
-  //bit 0x01
-  if (bitRead(_ReliableConfig, NoAutoACK))
-  {
-    Serial.print(F(",AutoACKdisabled"));
-  }
-  else
-  {
-    Serial.print(F(",AutoACKenabled"));
-  }
-
-}
-
-
-void SX127XLT::printReliableStatus()
-{
-#ifdef SX127XDEBUGRELIABLE
-  Serial.print(F(" {RELIABLE} printReliableStatus() "));
-#endif
-
-  //0x00
-  if (bitRead(_ReliableErrors, ReliableCRCError))
-  {
-    Serial.print(F(",ReliableCRCError"));
-  }
-
-  //0x01
-  if (bitRead(_ReliableErrors, ReliableIDError))
-  {
-    Serial.print(F(",ReliableIDError"));
-  }
-
-  //0x02
-  if (bitRead(_ReliableErrors, ReliableSizeError))
-  {
-    Serial.print(F(",ReliableSizeError"));
-  }
-
-  //0x03
-  if (bitRead(_ReliableErrors, ReliableACKError))
-  {
-    Serial.print(F(",NoReliableACK"));
-  }
-
-  if (bitRead(_ReliableErrors, ReliableTimeout))
-  {
-    Serial.print(F(",ReliableTimeout"));
-  }
-
-
-  //0x00
-  if (bitRead(_ReliableFlags, ReliableACKSent))
-  {
-    Serial.print(F(",ACKsent"));
-  }
-
-
-  //0x01
-  if (bitRead(_ReliableFlags, ReliableACKReceived))
-  {
-    Serial.print(F(",ACKreceived"));
-  }
-
-}
-
-
-void SX127XLT::setReliableRX()
-{
-  //existing setRx() does not setup LoRa device as a receiver completly, just turns on receiver mode
-  //this routine does all the required setup for receive mode
-#ifdef SX127XDEBUGRELIABLE
-  Serial.println(F(" {RELIABLE} setReliableRX()"));
-#endif
-
-  setMode(MODE_STDBY_RC);                                                  //stops receiver
-  clearIrqStatus(IRQ_RADIO_ALL);                                           //clear current interrupt flags
-  setDioIrqParams(IRQ_RADIO_ALL, IRQ_RX_DONE, 0, 0);                       //set for IRQ on RX done
-  writeRegister(REG_OPMODE, (MODE_RXCONTINUOUS + 0x80));                   //RX on LoRa continuous mode
-}
-
-
-uint16_t SX127XLT::CRCCCITTReliable(uint8_t startadd, uint8_t endadd, uint16_t startvalue)
-{
-  //generates a CRC of bytes from the internal SX buffer, _RXPackletL and _TXPackletL are not affected
-
-#ifdef SX127XDEBUGRELIABLE
-  Serial.println(F(" {RELIABLE} CRCCCITTReliable() "));
-#endif
-
-  uint16_t index, libraryCRC;
-  uint8_t j, readSX;
-
-  libraryCRC = startvalue;                       //start value for CRC16
-
-  setMode(MODE_STDBY_RC);
-  writeRegister(REG_FIFOADDRPTR, startadd);      //set buffer access ptr
-
-#ifdef USE_SPI_TRANSACTION
-  SPI.beginTransaction(SPISettings(LTspeedMaximum, LTdataOrder, LTdataMode));
-#endif
-
-  digitalWrite(_NSS, LOW);                       //start the burst read
-  SPI.transfer(REG_FIFO);
-
-  for (index = startadd; index <= endadd; index++)
-  {
-    readSX = SPI.transfer(0);
-    libraryCRC ^= (((uint16_t) readSX ) << 8);
-    for (j = 0; j < 8; j++)
-    {
-      if (libraryCRC & 0x8000)
-        libraryCRC = (libraryCRC << 1) ^ 0x1021;
-      else
-        libraryCRC <<= 1;
-    }
-  }
-
-  digitalWrite(_NSS, HIGH);
-
-#ifdef USE_SPI_TRANSACTION
-  SPI.endTransaction();
-#endif
-
-  return libraryCRC;
-}
-
-
-void SX127XLT::writeArray(uint8_t *txbuffer, uint8_t size)
-{
-#ifdef SX127XDEBUG1
-  Serial.println(F("writeArray() "));
-#endif
-
-  uint8_t index, regdata;
-  _TXPacketL = _TXPacketL + size;      //these are the number of bytes that will be added
-
-  for (index = 0; index <= size; index++)
-  {
-    regdata = txbuffer[index];
-    SPI.transfer(regdata);
-  }
-}
-
-
-void SX127XLT::printASCIIArray(uint8_t *buffer, uint8_t size)
-{
-#ifdef SX127XDEBUG1
-  Serial.println(F("printASCIIArray() "));
-#endif
-
-  uint8_t index;
-
-  for (index = 0; index < size; index++)
-  {
-    Serial.write(buffer[index]);
-  }
-}
-
-
-uint16_t SX127XLT::getRXPayloadCRC(uint8_t length)
-{
-#ifdef SX127XDEBUGRELIABLE
-  Serial.println(F(" {RELIABLE} getRXPayloadCRC() "));
-#endif
-  uint8_t regdata = readRegister(REG_FIFORXBASEADDR);       //retrieve the RXbase address pointer
-  return readUint16SXBuffer(regdata + length - 2);
-}
-
-
-uint16_t SX127XLT::getTXPayloadCRC(uint8_t length)
-{
-#ifdef SX127XDEBUGRELIABLE
-  Serial.println(F(" {RELIABLE} getTXPayloadCRC() "));
-#endif
-  uint8_t regdata = readRegister(REG_FIFOTXBASEADDR);       //retrieve the TXbase address pointer
-  return readUint16SXBuffer(regdata + length - 2);
-}
-
-
-
-uint16_t SX127XLT::getRXNetworkID(uint8_t length)
-{
-#ifdef SX127XDEBUGRELIABLE
-  Serial.println(F(" {RELIABLE} getRXnetworkID() "));
-#endif
-  uint8_t regdata = readRegister(REG_FIFORXBASEADDR);       //retrieve the RXbase address pointer
-  return readUint16SXBuffer(regdata + length - 4);
-}
-
-
-uint16_t SX127XLT::getTXNetworkID(uint8_t length)
-{
-#ifdef SX127XDEBUGRELIABLE
-  Serial.println(F(" {RELIABLE} getTXnetworkID() "));
-#endif
-  uint8_t regdata = readRegister(REG_FIFOTXBASEADDR);       //retrieve the TXbase address pointer
-  return readUint16SXBuffer(regdata + length - 4);
-}
-
-//****************************************************************************
-//
-// Reliable SX packet routines - added August 2021
-// Note that the startaddr is writen to the appropriate base address;
-// REG_FIFORXBASEADDR or REG_FIFOTXBASEADDR
-//
-//****************************************************************************
-
-uint8_t SX127XLT::transmitSXReliable(uint8_t startaddr, uint8_t length, uint16_t networkID, uint32_t txtimeout, int8_t txpower, uint8_t wait)
-{
-#ifdef SX127XDEBUGRELIABLE
-  Serial.println();
-  Serial.println(F(" {RELIABLE} transmitSXReliable() "));
-  Serial.print(F(" {RELIABLE} _ReliableConfig "));
-  Serial.println(_ReliableConfig, HEX);
-#endif
-
-  uint16_t payloadcrc;
-  uint32_t startmS;
-
-  writeRegister(REG_FIFOTXBASEADDR, startaddr);      //save base TX ptr
-  _ReliableErrors = 0;
-  _ReliableFlags = 0;
-
-  if (startaddr + length > 251)
-  {
-    bitSet(_ReliableErrors, ReliableSizeError);
-    return 0;
-  }
-
-  _TXPacketL = length + 4;
-
-  if (bitRead(_ReliableConfig, NoReliableCRC))
-  {
-    payloadcrc = 0;
-  }
-  else
-  {
-    payloadcrc = CRCCCITTReliable(startaddr, startaddr + length - 1, 0xFFFF);
-  }
-
-  writeUint16SXBuffer(startaddr + _TXPacketL - 4, networkID);
-  writeUint16SXBuffer(startaddr + _TXPacketL - 2, payloadcrc);
-  writeRegister(REG_PAYLOADLENGTH, _TXPacketL);
-  setTxParams(txpower, RADIO_RAMP_DEFAULT);            //TX power and ramp time
-  setDioIrqParams(IRQ_RADIO_ALL, IRQ_TX_DONE, 0, 0);   //set for IRQ on TX done on first DIO pin
-  setTx(0);                                            //TX timeout is not handled in setTX()
-
-  if (!wait)
-  {
-    return _TXPacketL;
-  }
-
-  if (txtimeout == 0)
-  {
-    while (!digitalRead(_TXDonePin));                  //Wait for pin to go high, TX finished
-  }
-  else
-  {
-    startmS = millis();
-    while (!digitalRead(_TXDonePin) && ((uint32_t) (millis() - startmS) < txtimeout));
-  }
-
-  setMode(MODE_STDBY_RC);                              //ensure we leave function with TX off
-
-  if (!digitalRead(_TXDonePin))                        //if _TXDonePin is still low its a TX timeout
-  {
-    _IRQmsb = IRQ_TX_TIMEOUT;
-    return 0;
-  }
-
-  return _TXPacketL;
-}
-
-
-uint8_t SX127XLT::transmitSXReliableIRQ(uint8_t startaddr, uint8_t length, uint16_t networkID, uint32_t txtimeout, int8_t txpower, uint8_t wait)
-{
-#ifdef SX127XDEBUGRELIABLE
-  Serial.println();
-  Serial.println(F(" {RELIABLE} transmitSXReliableIRQ() "));
-  Serial.print(F(" {RELIABLE} _ReliableConfig "));
-  Serial.println(_ReliableConfig, HEX);
-#endif
-
-  uint16_t payloadcrc;
-  uint32_t startmS;
-
-  writeRegister(REG_FIFOTXBASEADDR, startaddr);      //save base TX ptr
-  _ReliableErrors = 0;
-  _ReliableFlags = 0;
-
-  if (startaddr + length > 251)
-  {
-    bitSet(_ReliableErrors, ReliableSizeError);
-    return 0;
-  }
-
-  _TXPacketL = length + 4;
-
-  if (bitRead(_ReliableConfig, NoReliableCRC))
-  {
-    payloadcrc = 0;
-  }
-  else
-  {
-    payloadcrc = CRCCCITTReliable(startaddr, startaddr + length - 1, 0xFFFF);
-  }
-
-  writeUint16SXBuffer(startaddr + _TXPacketL - 4, networkID);
-  writeUint16SXBuffer(startaddr + _TXPacketL - 2, payloadcrc);
-  writeRegister(REG_PAYLOADLENGTH, _TXPacketL);
-  setTxParams(txpower, RADIO_RAMP_DEFAULT);            //TX power and ramp time
-  setDioIrqParams(IRQ_RADIO_ALL, IRQ_TX_DONE, 0, 0);   //set for IRQ on TX done on first DIO pin
-  setTx(0);                                            //TX timeout is not handled in setTX()
-
-  if (!wait)
-  {
-    return _TXPacketL;
-  }
-
-  if (txtimeout == 0)
-  {
-    while (!isTXdoneIRQ());                            //Wait for IRQ to go high, TX finished
-  }
-  else
-  {
-    startmS = millis();
-    while (!isTXdoneIRQ() && ((uint32_t) (millis() - startmS) < txtimeout));
-  }
-
-  setMode(MODE_STDBY_RC);                              //ensure we leave function with TX off
-
-  if (!isTXdoneIRQ())                                  //if IRQ is still low its a TX timeout
-  {
-    _IRQmsb = IRQ_TX_TIMEOUT;
-    return 0;
-  }
-
-  return _TXPacketL;
-}
-
-
-uint8_t SX127XLT::transmitSXReliableAutoACK(uint8_t startaddr, uint8_t length, uint16_t networkID, uint32_t acktimeout, uint32_t txtimeout, int8_t txpower, uint8_t wait)
-{
-#ifdef SX127XDEBUGRELIABLE
-  Serial.println();
-  Serial.println(F(" {RELIABLE} transmitSXReliableAutoACK() "));
-  Serial.print(F(" {RELIABLE} _ReliableConfig "));
-  Serial.println(_ReliableConfig, HEX);
-#endif
-
-  uint8_t RXPacketL;
-  uint16_t payloadcrc;
-  uint32_t startmS;
-
-  writeRegister(REG_FIFOTXBASEADDR, startaddr);      //save base TX ptr
-  _ReliableErrors = 0;
-  _ReliableFlags = 0;
-
-  if (startaddr + length > 251)
-  {
-    bitSet(_ReliableErrors, ReliableSizeError);
-    return 0;
-  }
-
-  _TXPacketL = length + 4;
-
-  if (bitRead(_ReliableConfig, NoReliableCRC))
-  {
-    payloadcrc = 0;
-  }
-  else
-  {
-    payloadcrc = CRCCCITTReliable(startaddr, startaddr + length - 1, 0xFFFF);
-  }
-
-  writeUint16SXBuffer(startaddr + _TXPacketL - 4, networkID);
-  writeUint16SXBuffer(startaddr + _TXPacketL - 2, payloadcrc);
-  writeRegister(REG_PAYLOADLENGTH, _TXPacketL);
-  setTxParams(txpower, RADIO_RAMP_DEFAULT);            //TX power and ramp time
-  setDioIrqParams(IRQ_RADIO_ALL, IRQ_TX_DONE, 0, 0);   //set for IRQ on TX done on first DIO pin
-  setTx(0);                                            //TX timeout is not handled in setTX()
-
-  if (!wait)
-  {
-    return _TXPacketL;
-  }
-
-  if (txtimeout == 0)
-  {
-    while (!digitalRead(_TXDonePin));                  //Wait for pin to go high, TX finished
-  }
-  else
-  {
-    startmS = millis();
-    while (!digitalRead(_TXDonePin) && ((uint32_t) (millis() - startmS) < txtimeout));
-  }
-
-  setMode(MODE_STDBY_RC);                              //ensure we leave function with TX off
-
-  if (!digitalRead(_TXDonePin))                        //if _TXDonePin is still low its a TX timeout
-  {
-    _IRQmsb = IRQ_TX_TIMEOUT;
-    return 0;
-  }
-
-  RXPacketL = waitReliableACK(networkID, payloadcrc, acktimeout);
-
-  if (RXPacketL != 4)
-  {
-
-    return 0;
-  }
-
-  return _TXPacketL;
-}
-
-
-uint8_t SX127XLT::receiveSXReliable(uint8_t startaddr, uint16_t networkID, uint32_t rxtimeout, uint8_t wait )
-{
-#ifdef SX127XDEBUGRELIABLE
-  Serial.println();
-  Serial.println(F(" {RELIABLE} receiveSXReliable()"));
-  Serial.print(F(" {RELIABLE} _ReliableConfig "));
-  Serial.println(_ReliableConfig, HEX);
-#endif
-
-  uint16_t payloadcrc = 0, RXcrc, RXnetworkID = 0;
-  uint32_t startmS;
-
-  _ReliableErrors = 0;
-  _ReliableFlags = 0;
-  setMode(MODE_STDBY_RC);
-  writeRegister(REG_FIFORXBASEADDR, startaddr);                            //set start address of RX packet in buffer
-  setDioIrqParams(IRQ_RADIO_ALL, IRQ_RX_DONE, 0, 0);                       //set for IRQ on RX done
-  setRx(0);                                                                //no actual RX timeout in this function
-
-  if (!wait)
-  {
-    return 0;                                                              //not wait requested so no packet length to pass
-  }
-
-  if (rxtimeout == 0)
-  {
-    while (!digitalRead(_RXDonePin));                                      //Wait for DIO0 to go high, no timeout, RX DONE
-  }
-  else
-  {
-    startmS = millis();
-    while   ((!digitalRead(_RXDonePin) && ((uint32_t) (millis() - startmS) < rxtimeout)) || ((readRegister(REG_MODEMSTAT) & 0x03)));
-  }
-
-  setMode(MODE_STDBY_RC);                                                  //ensure to stop further packet reception
-
-  if (!digitalRead(_RXDonePin))                                            //check if DIO still low, is so must be RX timeout
-  {
-    _IRQmsb = IRQ_RX_TIMEOUT;
-    return 0;
-  }
-
-  if ( readIrqStatus() != (IRQ_RX_DONE + IRQ_HEADER_VALID) )
-  {
-    return 0;                                                              //no RX done and header valid only, could be CRC error
-  }
-
-  _RXPacketL = readRegister(REG_RXNBBYTES);
-
-  if (_RXPacketL < 4)                                                      //check received packet is 4 or more bytes long
-  {
-    bitSet(_ReliableErrors, ReliableSizeError);
-    return 0;
-  }
-
-  RXnetworkID = readUint16SXBuffer(startaddr + _RXPacketL - 4);
-
-  if (RXnetworkID != networkID)
-  {
-    bitSet(_ReliableErrors, ReliableIDError);
-  }
-
-  if (!bitRead(_ReliableConfig, NoReliableCRC))
-  {
-    payloadcrc = CRCCCITTReliable(startaddr, (startaddr + _RXPacketL - 5), 0xFFFF);
-    RXcrc = readUint16SXBuffer(startaddr + _RXPacketL - 2);
-
-    if (payloadcrc != RXcrc)
-    {
-      bitSet(_ReliableErrors, ReliableCRCError);
-    }
-  }
-
-  if (_ReliableErrors)                                      //if there has been a reliable error return a RX fail
-  {
-    return 0;
-  }
-  return _RXPacketL;                                         //return and RX OK.
-}
-
-
-uint8_t SX127XLT::receiveSXReliableIRQ(uint8_t startaddr, uint16_t networkID, uint32_t rxtimeout, uint8_t wait )
-{
-#ifdef SX127XDEBUGRELIABLE
-  Serial.println();
-  Serial.println(F(" {RELIABLE} receiveSXReliableIRQ()"));
-  Serial.print(F(" {RELIABLE} _ReliableConfig "));
-  Serial.println(_ReliableConfig, HEX);
-#endif
-
-  uint16_t payloadcrc = 0, RXcrc, RXnetworkID = 0;
-  uint32_t startmS;
-
-  _ReliableErrors = 0;
-  _ReliableFlags = 0;
-
-  setMode(MODE_STDBY_RC);
-  writeRegister(REG_FIFORXBASEADDR, startaddr);                            //set start address of RX packet in buffer
-
-  setDioIrqParams(IRQ_RADIO_ALL, IRQ_RX_DONE, 0, 0);                       //set for IRQ on RX done
-  setRx(0);                                                                //no actual RX timeout in this function
-
-  if (!wait)
-  {
-    return 0;                                                              //not wait requested so no packet length to pass
-  }
-
-  if (rxtimeout == 0)
-  {
-    while (!isRXdoneIRQ());                                                //Wait for IRQ to go high, no timeout, RX DONE
-  }
-  else
-  {
-    startmS = millis();
-    while   ((!isRXdoneIRQ() && ((uint32_t) (millis() - startmS) < rxtimeout)) || ((readRegister(REG_MODEMSTAT) & 0x03)));
-  }
-
-  setMode(MODE_STDBY_RC);                                                  //ensure to stop further packet reception
-
-  if (!isRXdoneIRQ())                                                      //check if IRQ still low, is so must be RX timeout
-  {
-    _IRQmsb = IRQ_RX_TIMEOUT;
-    return 0;
-  }
-
-  if ( readIrqStatus() != (IRQ_RX_DONE + IRQ_HEADER_VALID) )
-  {
-    return 0;                                                              //no RX done and header valid only, could be CRC error
-  }
-
-  _RXPacketL = readRegister(REG_RXNBBYTES);
-
-  if (_RXPacketL < 4)                                                      //check received packet is 4 or more bytes long
-  {
-    bitSet(_ReliableErrors, ReliableSizeError);
-    return 0;
-  }
-
-  RXnetworkID = readUint16SXBuffer(startaddr + _RXPacketL - 4);
-
-  if (RXnetworkID != networkID)
-  {
-    bitSet(_ReliableErrors, ReliableIDError);
-  }
-
-  if (!bitRead(_ReliableConfig, NoReliableCRC))
-  {
-    payloadcrc = CRCCCITTReliable(startaddr, (startaddr + _RXPacketL - 5), 0xFFFF);
-    RXcrc = readUint16SXBuffer(startaddr + _RXPacketL - 2);
-
-    if (payloadcrc != RXcrc)
-    {
-      bitSet(_ReliableErrors, ReliableCRCError);
-    }
-  }
-
-  if (_ReliableErrors)                                       //if there has been a reliable error return a RX fail
-  {
-    return 0;
-  }
-  return _RXPacketL;                                         //return and RX OK.
-}
-
-
-uint8_t SX127XLT::receiveSXReliableAutoACK(uint8_t startaddr, uint16_t networkID, uint32_t ackdelay, int8_t txpower, uint32_t rxtimeout, uint8_t wait )
-{
-#ifdef SX127XDEBUGRELIABLE
-  Serial.println();
-  Serial.println(F(" {RELIABLE} receiveSXReliableAutoACK()"));
-  Serial.print(F(" {RELIABLE} _ReliableConfig "));
-  Serial.println(_ReliableConfig, HEX);
-#endif
-
-  uint16_t payloadcrc = 0, RXcrc, RXnetworkID = 0;
-  uint16_t temp1, temp2;
-  uint32_t startmS;
-
-  _ReliableErrors = 0;
-  _ReliableFlags = 0;
-
-  setMode(MODE_STDBY_RC);
-  writeRegister(REG_FIFORXBASEADDR, startaddr);                            //set start address of RX packet in buffer
-
-  setDioIrqParams(IRQ_RADIO_ALL, IRQ_RX_DONE, 0, 0);                       //set for IRQ on RX done
-  setRx(0);                                                                //no actual RX timeout in this function
-
-  if (!wait)
-  {
-    return 0;                                                              //not wait requested so no packet length to pass
-  }
-
-  if (rxtimeout == 0)
-  {
-    while (!digitalRead(_RXDonePin));                                      //Wait for DIO0 to go high, no timeout, RX DONE
-  }
-  else
-  {
-    startmS = millis();
-    while   ( (!digitalRead(_RXDonePin) && ((uint32_t) (millis() - startmS) < rxtimeout)) || ((readRegister(REG_MODEMSTAT) & 0x03)));
-  }
-
-  setMode(MODE_STDBY_RC);                                                  //ensure to stop further packet reception
-
-  if (!digitalRead(_RXDonePin))                                            //check if DIO still low, is so must be RX timeout
-  {
-    _IRQmsb = IRQ_RX_TIMEOUT;
-    return 0;
-  }
-
-  if ( readIrqStatus() != (IRQ_RX_DONE + IRQ_HEADER_VALID) )
-  {
-    return 0;                                                              //no RX done and header valid only, could be CRC error
-  }
-
-  _RXPacketL = readRegister(REG_RXNBBYTES);
-
-  if (_RXPacketL < 4)                                                      //check received packet is 4 or more bytes long
-  {
-    bitSet(_ReliableErrors, ReliableSizeError);
-    return 0;
-  }
-
-  RXnetworkID = readUint16SXBuffer(startaddr + _RXPacketL - 4);
-
-  if (RXnetworkID != networkID)
-  {
-    bitSet(_ReliableErrors, ReliableIDError);
-  }
-
-  if (!bitRead(_ReliableConfig, NoReliableCRC))
-  {
-    payloadcrc = CRCCCITTReliable(startaddr, (startaddr + _RXPacketL - 5), 0xFFFF);
-    RXcrc = readUint16SXBuffer(startaddr + _RXPacketL - 2);
-
-    if (payloadcrc != RXcrc)
-    {
-      bitSet(_ReliableErrors, ReliableCRCError);
-    }
-  }
-
-  if (_ReliableErrors)                                            //if there has been a reliable error return a RX fail
-  {
-    return 0;
-  }
-
-  delay(ackdelay);
-  temp1 = readUint16SXBuffer(startaddr);                          //save bytes that would be overwritten by ack
-  temp2 = readUint16SXBuffer(startaddr + 2);                      //save bytes that would be overwritten by ack
-
-  _TXPacketL = sendReliableACK(RXnetworkID, payloadcrc, txpower);
-
-  writeUint16SXBuffer(startaddr, temp1);                          //restore bytes that would be overwritten by ack
-  writeUint16SXBuffer(startaddr + 2, temp2);                      //restore bytes that would be overwritten by ack
-
-  if (_TXPacketL != 4)
-  {
-    bitSet(_ReliableErrors, ReliableACKError);
-    return 0;
-  }
-
-  return _RXPacketL;                                              //return indicating RX ack sent OK.
-}
-
-
-uint8_t SX127XLT::sendSXReliableACK(uint8_t startaddr, uint8_t length, uint16_t networkID, uint16_t payloadcrc, int8_t txpower)
-{
-
-#ifdef SX127XDEBUGRELIABLE
-  Serial.print(F(" {RELIABLE} sendSXReliableACK() "));
-#endif
-
-  uint32_t startmS, txtimeout = 60000;                            //set TX timeout to 60 seconds
-
-  setMode(MODE_STDBY_RC);
-  writeRegister(REG_FIFOTXBASEADDR, startaddr);                   //set FIFO access ptr
-  _TXPacketL = length + 4;
-  writeUint16SXBuffer((length + startaddr), networkID);
-  writeUint16SXBuffer((length + startaddr + 2), payloadcrc);
-  writeRegister(REG_PAYLOADLENGTH, _TXPacketL);
-  setTxParams(txpower, RADIO_RAMP_DEFAULT);                  //TX power and ramp time
-  setDioIrqParams(IRQ_RADIO_ALL, IRQ_TX_DONE, 0, 0);         //set for IRQ on TX done
-  setTx(0);                                                  //start transmission
-
-  startmS = millis();
-  while (!digitalRead(_TXDonePin) && ((uint32_t) (millis() - startmS) < txtimeout));
-
-  setMode(MODE_STDBY_RC);                                    //ensure we leave function with TX off
-
-  if (!digitalRead(_TXDonePin))
-  {
-    _IRQmsb = IRQ_TX_TIMEOUT;
-    return 0;
-  }
-
-  bitSet(_ReliableFlags, ReliableACKSent);
-  return _TXPacketL;                                          //TX OK so return TXpacket length
-}
-
-
-uint8_t SX127XLT::sendSXReliableACKIRQ(uint8_t startaddr, uint8_t length, uint16_t networkID, uint16_t payloadcrc, int8_t txpower)
-{
-
-#ifdef SX127XDEBUGRELIABLE
-  Serial.print(F(" {RELIABLE} sendSXReliableACKIRQ() "));
-  Serial.print(F("payload size "));
-  Serial.println(length);
-#endif
-
-  uint32_t startmS, txtimeout = 60000;                         //set TX timeout to 60 seconds
-
-  setMode(MODE_STDBY_RC);
-  writeRegister(REG_FIFOTXBASEADDR, startaddr);                //set FIFO access ptr
-  _TXPacketL = length + 4;
-  writeUint16SXBuffer((length + startaddr), networkID);
-  writeUint16SXBuffer((length + startaddr + 2), payloadcrc);
-  writeRegister(REG_PAYLOADLENGTH, _TXPacketL);
-  setTxParams(txpower, RADIO_RAMP_DEFAULT);                     //TX power and ramp time
-  setDioIrqParams(IRQ_RADIO_ALL, IRQ_TX_DONE, 0, 0);            //set for IRQ on TX done
-  setTx(0);                                                     //start transmission
-
-  startmS = millis();
-  while (!isTXdoneIRQ() && ((uint32_t) (millis() - startmS) < txtimeout));
-
-  setMode(MODE_STDBY_RC);                                        //ensure we leave function with TX off
-
-  if (!isTXdoneIRQ())
-  {
-    _IRQmsb = IRQ_TX_TIMEOUT;
-    return 0;
-  }
-
-  bitSet(_ReliableFlags, ReliableACKSent);
-  return _TXPacketL;                                              //TX OK so return TXpacket length
-}
-
-
-uint8_t SX127XLT::waitSXReliableACK(uint8_t startaddr, uint16_t networkID, uint16_t payloadcrc, uint32_t acktimeout)
-{
-
-#ifdef SX127XDEBUGRELIABLE
-  Serial.println(F(" {RELIABLE} waitSXReliableACK()"));
-#endif
-
-  uint16_t RXnetworkID, RXcrc;
-  uint32_t startmS;
-
-  writeRegister(REG_FIFORXBASEADDR, startaddr);                    //set the RX base address pointer
-  setReliableRX();
-  startmS = millis();
-
-#ifdef SX127XDEBUGRELIABLE
-  Serial.println(F(" {RELIABLE} Waiting RXDonePin"));
-#endif
-
-  do
-  {
-    if (digitalRead(_RXDonePin))                                    //has a packet arrived ?
-    {
-      _RXPacketL = readRegister(REG_RXNBBYTES);
-
-      if ( readIrqStatus() != (IRQ_RX_DONE + IRQ_HEADER_VALID) )
-      {
-        setReliableRX();
-        continue;
-      }
-
-      RXnetworkID = readUint16SXBuffer(startaddr + _RXPacketL - 4);
-      RXcrc = readUint16SXBuffer(startaddr + _RXPacketL - 2);
-
-      if ( (RXnetworkID == networkID) && (RXcrc == payloadcrc))
-      {
-        bitSet(_ReliableFlags, ReliableACKReceived);
-        return _RXPacketL;                                          //_RXPacketL should be payload length + 4
-      }
-      else
-      {
-        setReliableRX();
-        continue;
-      }
-    }
-  } while ( ((uint32_t) (millis() - startmS) < acktimeout)  || ((readRegister(REG_MODEMSTAT) & 0x03)) );
+void SX127XLT::clearReliableConfig(uint8_t bitclear)
+{
+#ifdef SX127XDEBUGRELIABLE
+  Serial.print(F(" {RELIABLE} clearReliableConfig() bit "));
+  Serial.println(bitclear);
+#endif
 
-  bitSet(_ReliableErrors, ReliableACKError);
-  return 0;
+  bitClear(_ReliableConfig, bitclear);
+  return;
 }
 
 
-uint8_t SX127XLT::waitSXReliableACKIRQ(uint8_t startaddr, uint16_t networkID, uint16_t payloadcrc, uint32_t acktimeout)
+uint8_t SX127XLT::getReliableConfig(uint8_t bitread)
 {
-
 #ifdef SX127XDEBUGRELIABLE
-  Serial.println(F(" {RELIABLE} waitSXReliableACKIRQ()"));
+  Serial.print(F(" {RELIABLE} getReliableConfig() "));
+  Serial.println(_ReliableConfig);
 #endif
 
-  uint16_t RXnetworkID, RXcrc;
-  uint32_t startmS;
-
-  writeRegister(REG_FIFORXBASEADDR, startaddr);              //set the RX base address pointer
-  setReliableRX();
-  startmS = millis();
-
-  do
-  {
-    if (isRXdoneIRQ())                                       //has a packet arrived ?
-    {
-      _RXPacketL = readRegister(REG_RXNBBYTES);
-
-      if ( readIrqStatus() != (IRQ_RX_DONE + IRQ_HEADER_VALID) )
-      {
-        setReliableRX();
-        continue;
-      }
-      RXnetworkID = readUint16SXBuffer(startaddr + _RXPacketL - 4);
-      RXcrc = readUint16SXBuffer(startaddr + _RXPacketL - 2);
-
-      if ( (RXnetworkID == networkID) && (RXcrc == payloadcrc))
-      {
-        bitSet(_ReliableFlags, ReliableACKReceived);
-        return _RXPacketL;                                   //_RXPacketL should be payload length + 4
-      }
-      else
-      {
-        setReliableRX();
-        continue;
-      }
-    }
-  } while ( ((uint32_t) (millis() - startmS) < acktimeout)  || ((readRegister(REG_MODEMSTAT) & 0x03)) );
-
-  bitSet(_ReliableErrors, ReliableACKError);
-  return 0;
+  return bitRead(_ReliableConfig, bitread);
 }
 
-//*****************************************************************************************
-//Data Transfer functions - added September 2021 - TX and RX base addresses assumed to be 0
-//*****************************************************************************************
 
-uint8_t SX127XLT::transmitDT(uint8_t *header, uint8_t headersize, uint8_t *dataarray, uint8_t datasize, uint16_t networkID, uint32_t txtimeout, int8_t txpower, uint8_t wait)
+void SX127XLT::printReliableConfig()
+
 {
 #ifdef SX127XDEBUGRELIABLE
-  Serial.println(F(" {RELIABLE} transmitDT() "));
+  Serial.print(F(" {RELIABLE} printReliableConfig() "));
 #endif
 
-  uint8_t index, bufferdata;
-  uint16_t payloadcrc;
-  uint32_t startmS;
-
-  _ReliableErrors = 0;
-  _ReliableFlags = 0;
-
-  if (datasize > (251 - headersize))                  //its 251 because of 4 bytes appended to packet
-  {
-    bitSet(_ReliableErrors, ReliableSizeError);
-    return 0;
-  }
-
-  setMode(MODE_STDBY_RC);
-  _TXPacketL = headersize + datasize + 4;
+  Serial.print(F("ReliableConfig"));
 
+  //bit 0x00
   if (bitRead(_ReliableConfig, NoReliableCRC))
   {
-    payloadcrc = 0;
+    Serial.print(F(",CRCdisabled"));
   }
   else
   {
-    payloadcrc = CRCCCITT(dataarray, datasize, 0xFFFF);
-  }
-
-  writeRegister(REG_FIFOADDRPTR, 0);                             //set PTR to start of FIFO
-
-#ifdef USE_SPI_TRANSACTION
-  SPI.beginTransaction(SPISettings(LTspeedMaximum, LTdataOrder, LTdataMode));
-#endif
-
-  digitalWrite(_NSS, LOW);
-  SPI.transfer(WREG_FIFO);
-
-  //load up the header
-  for (index = 0; index < headersize; index++)
-  {
-    bufferdata = header[index];
-    SPI.transfer(bufferdata);
+    Serial.print(F(",CRCenabled"));
   }
 
-  //load up the data array
-  for (index = 0; index < datasize; index++)
+  //bit 0x01
+  if (bitRead(_ReliableConfig, NoAutoACK))
   {
-    bufferdata = dataarray[index];
-    SPI.transfer(bufferdata);
+    Serial.print(F(",AutoACKdisabled"));
   }
-
-  //append the network ID and payload CRC at end
-  SPI.transfer(lowByte(networkID));
-  SPI.transfer(highByte(networkID));
-  SPI.transfer(lowByte(payloadcrc));
-  SPI.transfer(highByte(payloadcrc));
-
-  digitalWrite(_NSS, HIGH);
-
-#ifdef USE_SPI_TRANSACTION
-  SPI.endTransaction();
-#endif
-
-  writeRegister(REG_PAYLOADLENGTH, _TXPacketL);
-
-  setTxParams(txpower, RADIO_RAMP_DEFAULT);            //TX power and ramp time
-  setDioIrqParams(IRQ_RADIO_ALL, IRQ_TX_DONE, 0, 0);   //set for IRQ on TX done on first DIO pin
-  setTx(0);                                            //TX timeout is not handled in setTX()
-
-  if (!wait)
+  else
   {
-    return _TXPacketL;
+    Serial.print(F(",AutoACKenabled"));
   }
 
-  if (txtimeout == 0)
+  //bit 0x02
+  if (bitRead(_ReliableConfig, ReliableACKLink))
   {
-    while (!digitalRead(_TXDonePin));                  //Wait for pin to go high, TX finished
-  }
-  else
-  {
-    startmS = millis();
-    while (!digitalRead(_TXDonePin) && ((uint32_t) (millis() - startmS) < txtimeout));
+    Serial.print(F(",ACKLinkenabled"));
   }
 
-  setMode(MODE_STDBY_RC);                              //ensure we leave function with TX off
-
-  if (!digitalRead(_TXDonePin))                        //if _TXDonePin is still low its a TX timeout
+  //bit 0x03
+  if (bitRead(_ReliableConfig, ReliableSequence))
   {
-    _IRQmsb = IRQ_TX_TIMEOUT;
-    return 0;
+    Serial.print(F(",Sequenceenabled"));
   }
-
-  return _TXPacketL;
 }
 
 
-uint8_t SX127XLT::receiveDT(uint8_t *header, uint8_t headersize, uint8_t *dataarray, uint8_t datasize, uint16_t networkID, uint32_t rxtimeout, uint8_t wait )
+void SX127XLT::printReliableStatus()
 {
 #ifdef SX127XDEBUGRELIABLE
-  Serial.println(F(" {RELIABLE} receiveDT()"));
+  Serial.print(F(" {RELIABLE} printReliableStatus() "));
 #endif
 
-  uint16_t index, payloadcrc = 0, RXcrc, RXnetworkID = 0;
-  uint32_t startmS;
-  uint8_t regdataL, regdataH;
-  uint8_t RXHeaderL;
-  uint8_t RXDataL;
-
-  _ReliableErrors = 0;
-  _ReliableFlags = 0;
-  setMode(MODE_STDBY_RC);
-  setDioIrqParams(IRQ_RADIO_ALL, IRQ_RX_DONE, 0, 0);                       //set for IRQ on RX done
-  setRx(0);                                                                //no actual RX timeout in this function
-
-  if (!wait)
-  {
-    return 0;                                                              //not wait requested so no packet length to pass
-  }
-
-  if (rxtimeout == 0)
-  {
-    while (!digitalRead(_RXDonePin));                                      //Wait for DIO0 to go high, no timeout, RX DONE
-  }
-  else
-  {
-    startmS = millis();
-    while   ( (!digitalRead(_RXDonePin) && ((uint32_t) (millis() - startmS) < rxtimeout)) || ((readRegister(REG_MODEMSTAT) & 0x03)) )  ;
-  }
-
-  setMode(MODE_STDBY_RC);                                                  //ensure to stop further packet reception
-
-  if (!digitalRead(_RXDonePin))                                            //check if DIO still low, is so must be RX timeout
-  {
-    _IRQmsb = IRQ_RX_TIMEOUT;
-    return 0;
-  }
-
-  if ( readIrqStatus() != (IRQ_RX_DONE + IRQ_HEADER_VALID) )
-  {
-    return 0;                                                              //no RX done and header valid only, could be CRC error
-  }
-
-  RXHeaderL = getByteSXBuffer(2);
-  RXDataL = getByteSXBuffer(3);
-  _RXPacketL = readRegister(REG_RXNBBYTES);
-
-  if (RXHeaderL > headersize )
-  {
-    bitSet(_ReliableErrors, ReliableSizeError);
-    return 0;
-  }
-
-  if (RXDataL > datasize )
+  //0x00
+  if (bitRead(_ReliableErrors, ReliableCRCError))
   {
-    bitSet(_ReliableErrors, ReliableSizeError);
-    return 0;
+    Serial.print(F(",ReliableCRCError"));
   }
 
-  if (_RXPacketL < 8)                                      //check received packet is 8 or more bytes long
+  //0x01
+  if (bitRead(_ReliableErrors, ReliableIDError))
   {
-    bitSet(_ReliableErrors, ReliableSizeError);
-    return 0;
+    Serial.print(F(",ReliableIDError"));
   }
 
-  writeRegister(REG_FIFOADDRPTR, 0);                       //set FIFO access ptr to beginning of packet
-
-#ifdef USE_SPI_TRANSACTION
-  SPI.beginTransaction(SPISettings(LTspeedMaximum, LTdataOrder, LTdataMode));
-#endif
-
-  digitalWrite(_NSS, LOW);                                 //start the burst read
-  SPI.transfer(REG_FIFO);
-
-  for (index = 0; index < RXHeaderL; index++)
+  //0x02
+  if (bitRead(_ReliableErrors, ReliableSizeError))
   {
-    regdataL = SPI.transfer(0);
-    header[index] = regdataL;
+    Serial.print(F(",ReliableSizeError"));
   }
 
-  for (index = 0; index < RXDataL; index++)
+  //0x03
+  if (bitRead(_ReliableErrors, ReliableACKError))
   {
-    regdataL = SPI.transfer(0);
-    dataarray[index] = regdataL;
+    Serial.print(F(",NoReliableACK"));
   }
 
-  regdataL = SPI.transfer(0);
-  regdataH = SPI.transfer(0);
-  RXnetworkID = ((uint16_t) regdataH << 8) + regdataL;
-  regdataL = SPI.transfer(0);
-  regdataH = SPI.transfer(0);
-
-  digitalWrite(_NSS, HIGH);
-
-#ifdef USE_SPI_TRANSACTION
-  SPI.endTransaction();
-#endif
-
-  if (!bitRead(_ReliableConfig, NoReliableCRC))
+  if (bitRead(_ReliableErrors, ReliableTimeout))
   {
-    payloadcrc = CRCCCITT(dataarray, RXDataL, 0xFFFF);
-    RXcrc = ((uint16_t) regdataH << 8) + regdataL;
-
-    if (payloadcrc != RXcrc)
-    {
-      bitSet(_ReliableErrors, ReliableCRCError);
-    }
+    Serial.print(F(",ReliableTimeout"));
   }
 
-  if (RXnetworkID != networkID)
-  {
-    bitSet(_ReliableErrors, ReliableIDError);
-  }
 
-  if (_ReliableErrors)                                            //if there has been a reliable error return a RX fail
+  //0x00
+  if (bitRead(_ReliableFlags, ReliableACKSent))
   {
-    return 0;
+    Serial.print(F(",ACKsent"));
   }
 
-  return _RXPacketL;                                              //return and indicate RX OK.
-}
-
-
-uint8_t SX127XLT::sendACKDT(uint8_t *header, uint8_t headersize, int8_t txpower)
-{
-
-#ifdef SX127XDEBUGRELIABLE
-  Serial.print(F(" {RELIABLE} sendACKDT() "));
-#endif
-
-  uint32_t startmS, txtimeout = 60000;                            //set TX timeout to 60 seconds
-  uint8_t bufferdata, index;
-  uint16_t networkID;
-  uint16_t payloadCRC;
-
-  setMode(MODE_STDBY_RC);
-  _TXPacketL = headersize + 4;
-  networkID = readUint16SXBuffer(_RXPacketL - 4);
-  payloadCRC = readUint16SXBuffer(_RXPacketL - 2);
-
-  writeRegister(REG_FIFOADDRPTR, 0);                               //set FIFO access ptr
-
-#ifdef USE_SPI_TRANSACTION
-  SPI.beginTransaction(SPISettings(LTspeedMaximum, LTdataOrder, LTdataMode));
-#endif
-
-  digitalWrite(_NSS, LOW);
-  SPI.transfer(WREG_FIFO);
 
-  for (index = 0; index < headersize; index++)
+  //0x01
+  if (bitRead(_ReliableFlags, ReliableACKReceived))
   {
-    bufferdata = header[index];
-    SPI.transfer(bufferdata);
+    Serial.print(F(",ACKreceived"));
   }
 
-  SPI.transfer(lowByte(networkID));
-  SPI.transfer(highByte(networkID));
-  SPI.transfer(lowByte(payloadCRC));
-  SPI.transfer(highByte(payloadCRC));
-
-  digitalWrite(_NSS, HIGH);
-
-#ifdef USE_SPI_TRANSACTION
-  SPI.endTransaction();
-#endif
-
-  writeRegister(REG_PAYLOADLENGTH, _TXPacketL);
-  setTxParams(txpower, RADIO_RAMP_DEFAULT);                  //TX power and ramp time
-  setDioIrqParams(IRQ_RADIO_ALL, IRQ_TX_DONE, 0, 0);         //set for IRQ on TX done
-  setTx(0);                                                  //start transmission
-
-  startmS = millis();
-  while (!digitalRead(_TXDonePin) && ((uint32_t) (millis() - startmS) < txtimeout));
-
-  setMode(MODE_STDBY_RC);                                    //ensure we leave function with TX off
-
-  if (!digitalRead(_TXDonePin))
+  //0x02
+  if (bitRead(_ReliableFlags, ReliableDuplicate))
   {
-    _IRQmsb = IRQ_TX_TIMEOUT;
-    return 0;
+    Serial.print(F(",DuplicateACKed"));
   }
 
-  bitSet(_ReliableFlags, ReliableACKSent);
-  return _TXPacketL;                                          //TX OK so return TXpacket length
 }
 
 
-uint8_t SX127XLT::waitACKDT(uint8_t *header, uint8_t headersize, uint32_t acktimeout)
+void SX127XLT::setReliableRX()
 {
+  //existing setRx() does not setup LoRa device as a receiver completly, just turns on receiver mode
+  //this routine does all the required setup for receive mode
+#ifdef SX127XDEBUGRELIABLE
+  Serial.println(F(" {RELIABLE} setReliableRX()"));
+#endif
 
-#ifdef SX127XDEBUGRELIABLE
-  Serial.println(F(" {RELIABLE} waitACKDT()"));
-#endif
-
-  uint16_t RXnetworkID, RXcrc;
-  uint32_t startmS;
-  uint8_t regdata, index;
-  uint16_t networkID;
-  uint16_t payloadCRC;
-
-  networkID = readUint16SXBuffer(_TXPacketL - 4);              //get networkID used to transmit previous packet, before next RX
-  payloadCRC = readUint16SXBuffer(_TXPacketL - 2);             //get payloadCRC used to transmit previous packet, before next RX
-  setReliableRX();
-
-  startmS = millis();
-
-  do
-  {
-    if (digitalRead(_RXDonePin))                                //has a packet arrived ?
-    {
-      if ( readIrqStatus() != (IRQ_RX_DONE + IRQ_HEADER_VALID) )
-      {
-        setReliableRX();
-        continue;
-      }
-
-      _RXPacketL = readRegister(REG_RXNBBYTES);
-      RXnetworkID = readUint16SXBuffer(_RXPacketL - 4);
-      RXcrc = readUint16SXBuffer(_RXPacketL - 2);
-
-      if ((_RXPacketL - 4) > headersize )                       //check passed buffer is big enough for header
-      {
-        setReliableRX();
-        continue;
-      }
-
-      if (!bitRead(_ReliableConfig, NoReliableCRC))
-      {
-        if (payloadCRC != RXcrc)
-        {
-          bitSet(_ReliableErrors, ReliableCRCError);
-          setReliableRX();
-          continue;
-        }
-      }
-
-      if ( (RXnetworkID == networkID))
-      {
-        bitSet(_ReliableFlags, ReliableACKReceived);
-        writeRegister(REG_FIFOADDRPTR, 0);                      //set FIFO access ptr
-
-#ifdef USE_SPI_TRANSACTION
-        SPI.beginTransaction(SPISettings(LTspeedMaximum, LTdataOrder, LTdataMode));
-#endif
-
-        digitalWrite(_NSS, LOW);                                //start the burst read
-        SPI.transfer(REG_FIFO);
-
-        for (index = 0; index < (_RXPacketL - 4); index++)      //read packet into rxbuffer
-        {
-          regdata = SPI.transfer(0);
-          header[index] = regdata;
-        }
-        digitalWrite(_NSS, HIGH);
-
-#ifdef USE_SPI_TRANSACTION
-        SPI.endTransaction();
-#endif
-
-        return _RXPacketL;                                      //_RXPacketL should be payload length + 4
-      }
-      else
-      {
-        setReliableRX();
-        continue;
-      }
-    }
-  } while ( ((uint32_t) (millis() - startmS) < acktimeout)  || ((readRegister(REG_MODEMSTAT) & 0x03)) );
-
-  bitSet(_ReliableErrors, ReliableACKError);
-  bitSet(_ReliableErrors, ReliableTimeout);
-  return 0;
+  setMode(MODE_STDBY_RC);                                                  //stops receiver
+  clearIrqStatus(IRQ_RADIO_ALL);                                           //clear current interrupt flags
+  setDioIrqParams(IRQ_RADIO_ALL, IRQ_RX_DONE, 0, 0);                       //set for IRQ on RX done
+  writeRegister(REG_OPMODE, (MODE_RXCONTINUOUS + 0x80));                   //RX on LoRa continuous mode
 }
 
 
-uint8_t SX127XLT::transmitDTIRQ(uint8_t *header, uint8_t headersize, uint8_t *dataarray, uint8_t datasize, uint16_t networkID, uint32_t txtimeout, int8_t txpower, uint8_t wait)
+uint16_t SX127XLT::CRCCCITTReliable(uint8_t startadd, uint8_t endadd, uint16_t startvalue)
 {
+  //generates a CRC of bytes from the internal SX buffer, _RXPackletL and _TXPackletL are not affected
+
 #ifdef SX127XDEBUGRELIABLE
-  Serial.println(F(" {RELIABLE} transmitDTIRQ() "));
+  Serial.println(F(" {RELIABLE} CRCCCITTReliable() "));
 #endif
 
-  uint8_t index, bufferdata;
-  uint16_t payloadcrc;
-  uint32_t startmS;
-
-  _ReliableErrors = 0;
-  _ReliableFlags = 0;
+  uint16_t remaining, libraryCRC;
+  uint8_t buff[32], length;
 
-  if (datasize > (251 - headersize))                           //its 251 because of 4 bytes appended to packet
-  {
-    bitSet(_ReliableErrors, ReliableSizeError);
-    return 0;
-  }
+  libraryCRC = startvalue;                       //start value for CRC16
 
   setMode(MODE_STDBY_RC);
-  _TXPacketL = headersize + datasize + 4;
-
-  if (bitRead(_ReliableConfig, NoReliableCRC))
-  {
-    payloadcrc = 0;
-  }
-  else
-  {
-    payloadcrc = CRCCCITT(dataarray, datasize, 0xFFFF);
-  }
-
-  writeRegister(REG_FIFOADDRPTR, 0);                           //set PTR to start of FIFO
+  writeRegister(REG_FIFOADDRPTR, startadd);      //set buffer access ptr
 
 #ifdef USE_SPI_TRANSACTION
   SPI.beginTransaction(SPISettings(LTspeedMaximum, LTdataOrder, LTdataMode));
 #endif
 
-  digitalWrite(_NSS, LOW);
-  SPI.transfer(WREG_FIFO);
+  digitalWrite(_NSS, LOW);                       //start the burst read
+  _SPITransactions++;
+  SPI.transfer(REG_FIFO);
 
-  //load up the header
-  for (index = 0; index < headersize; index++)
-  {
-    bufferdata = header[index];
-    SPI.transfer(bufferdata);
-  }
+  remaining = (endadd >= startadd) ? (endadd - startadd + 1) : 0;
 
-  //load up the data array
-  for (index = 0; index < datasize; index++)
+  while (remaining > 0)                         //a block of the FIFO at a time
   {
-    bufferdata = dataarray[index];
-    SPI.transfer(bufferdata);
+    length = (remaining < sizeof(buff)) ? remaining : sizeof(buff);
+    LTSPIreadBytes(buff, length);
+    libraryCRC = LTCRCCCITTUpdate(libraryCRC, buff, length);
+    remaining = remaining - length;
   }
 
-  //append the network ID and payload CRFC at end
-  SPI.transfer(lowByte(networkID));
-  SPI.transfer(highByte(networkID));
-  SPI.transfer(lowByte(payloadcrc));
-  SPI.transfer(highByte(payloadcrc));
-
   digitalWrite(_NSS, HIGH);
 
 #ifdef USE_SPI_TRANSACTION
   SPI.endTransaction();
 #endif
 
-  writeRegister(REG_PAYLOADLENGTH, _TXPacketL);
-  setTxParams(txpower, RADIO_RAMP_DEFAULT);            //TX power and ramp time
-  setDioIrqParams(IRQ_RADIO_ALL, IRQ_TX_DONE, 0, 0);   //set for IRQ on TX done on first DIO pin
-  setTx(0);                                            //TX timeout is not handled in setTX()
+  return libraryCRC;
+}
 
-  if (!wait)
-  {
-    return _TXPacketL;
-  }
 
-  if (txtimeout == 0)
-  {
-    while (!isTXdoneIRQ());                           //Wait for IRQ to go high, TX finished
-  }
-  else
-  {
-    startmS = millis();
-    while (!isTXdoneIRQ() && ((uint32_t) (millis() - startmS) < txtimeout));
-  }
+void SX127XLT::writeArray(uint8_t *txbuffer, uint8_t size)
+{
+#ifdef SX127XDEBUG1
+  Serial.println(F("writeArray() "));
+#endif
+
+  _TXPacketL = _TXPacketL + size;      //these are the number of bytes that will be added
+
+  LTSPIwriteBytes(txbuffer, size + 1);
+}
+
+
+void SX127XLT::printASCIIArray(uint8_t *buffer, uint8_t size)
+{
+#ifdef SX127XDEBUG1
+  Serial.println(F("printASCIIArray() "));
+#endif
 
-  setMode(MODE_STDBY_RC);                             //ensure we leave function with TX off
+  uint8_t index;
 
-  if (!isTXdoneIRQ())                                 //if  TXdone IRQ is still low its a TX timeout
+  for (index = 0; index < size; index++)
   {
-    _IRQmsb = IRQ_TX_TIMEOUT;
-    return 0;
+    Serial.write(buffer[index]);
   }
-
-  return _TXPacketL;
 }
 
 
-uint8_t SX127XLT::receiveDTIRQ(uint8_t *header, uint8_t headersize, uint8_t *dataarray, uint8_t datasize, uint16_t networkID, uint32_t rxtimeout, uint8_t wait )
+uint16_t SX127XLT::getRXPayloadCRC(uint8_t length)
 {
 #ifdef SX127XDEBUGRELIABLE
-  Serial.println(F(" {RELIABLE} receiveDTIRQ()"));
+  Serial.println(F(" {RELIABLE} getRXPayloadCRC() "));
 #endif
+  uint8_t regdata = readRegister(REG_FIFORXBASEADDR);       //retrieve the RXbase address pointer
+  return readUint16SXBuffer(regdata + length - 2);
+}
 
-  uint16_t index, payloadcrc = 0, RXcrc, RXnetworkID = 0;
-  uint32_t startmS;
-  uint8_t regdataL, regdataH;
-  uint8_t RXHeaderL;
-  uint8_t RXDataL;
 
-  _ReliableErrors = 0;
-  _ReliableFlags = 0;
-  setMode(MODE_STDBY_RC);
-  setDioIrqParams(IRQ_RADIO_ALL, IRQ_RX_DONE, 0, 0);                       //set for IRQ on RX done
-  setRx(0);                                                                //no actual RX timeout in this function
+uint16_t SX127XLT::getTXPayloadCRC(uint8_t length)
+{
+#ifdef SX127XDEBUGRELIABLE
+  Serial.println(F(" {RELIABLE} getTXPayloadCRC() "));
+#endif
+  uint8_t regdata = readRegister(REG_FIFOTXBASEADDR);       //retrieve the TXbase address pointer
+  return readUint16SXBuffer(regdata + length - 2);
+}
 
-  if (!wait)
-  {
-    return 0;                                                              //not wait requested so no packet length to pass
-  }
 
-  if (rxtimeout == 0)
-  {
-    while (!isRXdoneIRQ());                                               //Wait for IRQ to go high, no timeout, RX DONE
-  }
-  else
-  {
-    startmS = millis();
-    while   ( (!isRXdoneIRQ() && ((uint32_t) (millis() - startmS) < rxtimeout)) || ((readRegister(REG_MODEMSTAT) & 0x03)) )  ;
-  }
 
-  setMode(MODE_STDBY_RC);                                                  //ensure to stop further packet reception
+uint16_t SX127XLT::getRXNetworkID(uint8_t length)
+{
+#ifdef SX127XDEBUGRELIABLE
+  Serial.println(F(" {RELIABLE} getRXnetworkID() "));
+#endif
+  uint8_t regdata = readRegister(REG_FIFORXBASEADDR);       //retrieve the RXbase address pointer
+  return readUint16SXBuffer(regdata + length - 4);
+}
 
-  if (!isRXdoneIRQ())                                                      //check if IRQ still low, is so must be RX timeout
-  {
-    _IRQmsb = IRQ_RX_TIMEOUT;
-    return 0;
-  }
 
-  if ( readIrqStatus() != (IRQ_RX_DONE + IRQ_HEADER_VALID) )
-  {
-    return 0;                                                              //no RX done IRQ and header valid only, could be CRC error
-  }
+uint16_t SX127XLT::getTXNetworkID(uint8_t length)
+{
+#ifdef SX127XDEBUGRELIABLE
+  Serial.println(F(" {RELIABLE} getTXnetworkID() "));
+#endif
+  uint8_t regdata = readRegister(REG_FIFOTXBASEADDR);       //retrieve the TXbase address pointer
+  return readUint16SXBuffer(regdata + length - 4);
+}
 
-  RXHeaderL = getByteSXBuffer(2);
-  RXDataL = getByteSXBuffer(3);
-  _RXPacketL = readRegister(REG_RXNBBYTES);
+//*****************************************************************************************
+//Data Transfer functions - added September 2021 - TX and RX base addresses assumed to be 0
+//The DT functions are in LTReliableCore.h, these are the device accesses they call
+//*****************************************************************************************
 
-  if (RXHeaderL > headersize )
-  {
-    bitSet(_ReliableErrors, ReliableSizeError);
-    return 0;
-  }
+template class LTReliableCore<SX127XLT>;
 
-  if (RXDataL > datasize )
-  {
-    bitSet(_ReliableErrors, ReliableSizeError);
-    return 0;
-  }
 
-  if (_RXPacketL < 8)                              //check received packet is 8 or more bytes long
-  {
-    bitSet(_ReliableErrors, ReliableSizeError);
-    return 0;
-  }
+void SX127XLT::standbyDT()
+{
+  setMode(MODE_STDBY_RC);
+}
 
-  writeRegister(REG_FIFOADDRPTR, 0);              //set FIFO access ptr to beginning of packet
+
+void SX127XLT::beginWriteDT(uint8_t offset)
+{
+  writeRegister(REG_FIFOADDRPTR, offset);              //set FIFO access ptr
 
 #ifdef USE_SPI_TRANSACTION
   SPI.beginTransaction(SPISettings(LTspeedMaximum, LTdataOrder, LTdataMode));
 #endif
 
-  digitalWrite(_NSS, LOW);                        //start the burst read
-  SPI.transfer(REG_FIFO);
+  digitalWrite(_NSS, LOW);
+  _SPITransactions++;
+  SPI.transfer(WREG_FIFO);
+}
 
-  for (index = 0; index < RXHeaderL; index++)
-  {
-    regdataL = SPI.transfer(0);
-    header[index] = regdataL;
-  }
 
-  for (index = 0; index < RXDataL; index++)
-  {
-    regdataL = SPI.transfer(0);
-    dataarray[index] = regdataL;
-  }
+void SX127XLT::beginReadDT(uint8_t offset)
+{
+  writeRegister(REG_FIFOADDRPTR, offset);              //set FIFO access ptr
+
+#ifdef USE_SPI_TRANSACTION
+  SPI.beginTransaction(SPISettings(LTspeedMaximum, LTdataOrder, LTdataMode));
+#endif
+
+  digitalWrite(_NSS, LOW);                             //start the burst read
+  _SPITransactions++;
+  SPI.transfer(REG_FIFO);
+}
 
-  regdataL = SPI.transfer(0);
-  regdataH = SPI.transfer(0);
-  RXnetworkID = ((uint16_t) regdataH << 8) + regdataL;
-  regdataL = SPI.transfer(0);
-  regdataH = SPI.transfer(0);
 
+void SX127XLT::endBufferDT()
+{
   digitalWrite(_NSS, HIGH);
 
 #ifdef USE_SPI_TRANSACTION
   SPI.endTransaction();
 #endif
+}
 
-  if (!bitRead(_ReliableConfig, NoReliableCRC))
-  {
-    payloadcrc = CRCCCITT(dataarray, RXDataL, 0xFFFF);
-    RXcrc = ((uint16_t) regdataH << 8) + regdataL;
-
-    if (payloadcrc != RXcrc)
-    {
-      bitSet(_ReliableErrors, ReliableCRCError);
-    }
-  }
-
-  if (RXnetworkID != networkID)
-  {
-    bitSet(_ReliableErrors, ReliableIDError);
-  }
 
-  if (_ReliableErrors)                                             //if there has been a reliable error return a RX fail
-  {
-    return 0;
-  }
+void SX127XLT::startTXDT(uint8_t length, int8_t txpower, uint32_t txtimeout)
+{
+  //TX timeout is not handled in setTx(), waitTXDT() times out the transmission
 
-  return _RXPacketL;                                               //return and indicate RX OK.
+  (void) txtimeout;
+  writeRegister(REG_PAYLOADLENGTH, length);
+  setTxParams(txpower, RADIO_RAMP_DEFAULT);            //TX power and ramp time
+  setDioIrqParams(IRQ_RADIO_ALL, IRQ_TX_DONE, 0, 0);   //set for IRQ on TX done on first DIO pin
+  setTx(0);
 }
 
 
-uint8_t SX127XLT::sendACKDTIRQ(uint8_t *header, uint8_t headersize, int8_t txpower)
+bool SX127XLT::txDoneDT(bool useIRQ)
 {
+  return useIRQ ? isTXdoneIRQ() : digitalRead(_TXDonePin);
+}
 
-#ifdef SX127XDEBUGRELIABLE
-  Serial.print(F(" {RELIABLE} sendACKDTIRQ() "));
-#endif
 
-  uint32_t startmS, txtimeout = 60000;                             //set TX timeout to 15 seconds
-  uint8_t bufferdata, index;
-  uint16_t networkID;
-  uint16_t payloadCRC;
+bool SX127XLT::endTXDT()
+{
+  setMode(MODE_STDBY_RC);                              //ensure we leave with TX off
+  return true;                                         //the TX timeout is by millis(), see timeoutDT()
+}
 
-  setMode(MODE_STDBY_RC);
-  _TXPacketL = headersize + 4;
-  networkID = readUint16SXBuffer(_RXPacketL - 4);
-  payloadCRC = readUint16SXBuffer(_RXPacketL - 2);
-  writeRegister(REG_FIFOADDRPTR, 0);                               //set FIFO access ptr
 
-#ifdef USE_SPI_TRANSACTION
-  SPI.beginTransaction(SPISettings(LTspeedMaximum, LTdataOrder, LTdataMode));
-#endif
+bool SX127XLT::waitTXDT(uint32_t txtimeout, bool useIRQ)
+{
+  uint32_t startmS = millis();
 
-  digitalWrite(_NSS, LOW);
-  SPI.transfer(WREG_FIFO);
+  while (!txDoneDT(useIRQ) && ((txtimeout == 0) || ((uint32_t) (millis() - startmS) < txtimeout)));
 
-  for (index = 0; index < headersize; index++)
+  if (!txDoneDT(useIRQ))                               //if TX done is still low its a TX timeout
   {
-    bufferdata = header[index];
-    SPI.transfer(bufferdata);
+    timeoutDT(true);
+    return false;
   }
 
-  SPI.transfer(lowByte(networkID));
-  SPI.transfer(highByte(networkID));
-  SPI.transfer(lowByte(payloadCRC));
-  SPI.transfer(highByte(payloadCRC));
+  return endTXDT();
+}
 
-  digitalWrite(_NSS, HIGH);
 
-#ifdef USE_SPI_TRANSACTION
-  SPI.endTransaction();
-#endif
+void SX127XLT::startRXDT(uint32_t rxtimeout)
+{
+  //no actual RX timeout in setRx(), waitRXDT() times out the reception
 
-  writeRegister(REG_PAYLOADLENGTH, _TXPacketL);
-  setTxParams(txpower, RADIO_RAMP_DEFAULT);                  //TX power and ramp time
-  setDioIrqParams(IRQ_RADIO_ALL, IRQ_TX_DONE, 0, 0);         //set for IRQ on TX done
-  setTx(0);                                                  //start transmission
+  (void) rxtimeout;
+  setMode(MODE_STDBY_RC);
+  setDioIrqParams(IRQ_RADIO_ALL, IRQ_RX_DONE, 0, 0);   //set for IRQ on RX done
+  setRx(0);
+}
 
-  startmS = millis();
-  while (!isTXdoneIRQ() && ((uint32_t) (millis() - startmS) < txtimeout));
 
-  setMode(MODE_STDBY_RC);                                    //ensure we leave function with TX off
+bool SX127XLT::rxDoneDT(bool useIRQ)
+{
+  return useIRQ ? isRXdoneIRQ() : digitalRead(_RXDonePin);
+}
+
 
-  if (!isTXdoneIRQ())
+bool SX127XLT::waitRXDT(uint32_t rxtimeout, bool useIRQ)
+{
+  uint32_t startmS = millis();
+
+  while (!rxDoneDT(useIRQ) && ((rxtimeout == 0) || ((uint32_t) (millis() - startmS) < rxtimeout) || receivingDT()));   //a packet arriving at timeout is waited for, the next one is not
+
+  if (!rxDoneDT(useIRQ))                               //check if RX done still low, is so must be RX timeout
   {
-    _IRQmsb = IRQ_TX_TIMEOUT;
-    return 0;
+    timeoutDT(false);
+    return false;
   }
 
-  bitSet(_ReliableFlags, ReliableACKSent);
-  return _TXPacketL;                                          //TX OK so return TXpacket length
+  setMode(MODE_STDBY_RC);                              //ensure to stop further packet reception
+  return true;
 }
 
 
-uint8_t SX127XLT::waitACKDTIRQ(uint8_t *header, uint8_t headersize, uint32_t acktimeout)
+void SX127XLT::timeoutDT(bool tx)
 {
+  setMode(MODE_STDBY_RC);
+  _IRQmsb = tx ? IRQ_TX_TIMEOUT : IRQ_RX_TIMEOUT;      //for readIrqStatus(), the device has no timeout IRQ here
+}
 
-#ifdef SX127XDEBUGRELIABLE
-  Serial.println(F(" {RELIABLE} waitACKDTIRQ()"));
-#endif
 
-  uint16_t RXnetworkID, RXcrc;
-  uint32_t startmS;
-  uint8_t regdata, index;
-  uint16_t networkID;
-  uint16_t payloadCRC;
+bool SX127XLT::endRXDT()
+{
+  return (readIrqStatus() == (IRQ_RX_DONE + IRQ_HEADER_VALID));   //RX done and header valid only, not a CRC error
+}
 
-  networkID = readUint16SXBuffer(_TXPacketL - 4);                  //get networkID used to transmit previous packet, before next RX
-  payloadCRC = readUint16SXBuffer(_TXPacketL - 2);                 //get payloadCRC used to transmit previous packet, before next RX
-  setReliableRX();
 
-  startmS = millis();
+uint8_t SX127XLT::readRXBufferStatusDT()
+{
+  _RXPacketL = readRegister(REG_RXNBBYTES);
+  return 0;                                            //RX base address assumed to be 0
+}
 
-  do
-  {
-    if (isRXdoneIRQ())                                             //has a packet arrived ?
-    {
-      if ( readIrqStatus() != (IRQ_RX_DONE + IRQ_HEADER_VALID) )
-      {
-        setReliableRX();
-        continue;
-      }
 
-      _RXPacketL = readRegister(REG_RXNBBYTES);
-      RXnetworkID = readUint16SXBuffer(_RXPacketL - 4);
-      RXcrc = readUint16SXBuffer(_RXPacketL - 2);
+void SX127XLT::restartRXDT()
+{
+  setReliableRX();
+}
 
-      if ((_RXPacketL - 4) > headersize )                           //check passed buffer is big enough for header
-      {
-        setReliableRX();
-        continue;
-      }
 
-      if (!bitRead(_ReliableConfig, NoReliableCRC))
-      {
-        if (payloadCRC != RXcrc)
-        {
-          bitSet(_ReliableErrors, ReliableCRCError);
-          setReliableRX();
-          continue;
-        }
-      }
+bool SX127XLT::receivingDT()
+{
+  return (readRegister(REG_MODEMSTAT) & 0x03);
+}
 
-      if ( (RXnetworkID == networkID))
-      {
-        bitSet(_ReliableFlags, ReliableACKReceived);
-        writeRegister(REG_FIFOADDRPTR, 0);                     //set FIFO access ptr
 
-#ifdef USE_SPI_TRANSACTION
-        SPI.beginTransaction(SPISettings(LTspeedMaximum, LTdataOrder, LTdataMode));
-#endif
+void SX127XLT::setTXBaseDT(uint8_t addr)
+{
+  writeRegister(REG_FIFOTXBASEADDR, addr);             //the SX variants transmit from addr
+}
 
-        digitalWrite(_NSS, LOW);                               //start the burst read
-        SPI.transfer(REG_FIFO);
 
-        for (index = 0; index < (_RXPacketL - 4); index++)     //read packet header buffer
-        {
-          regdata = SPI.transfer(0);
-          header[index] = regdata;
-        }
-        digitalWrite(_NSS, HIGH);
+void SX127XLT::setRXBaseDT(uint8_t addr)
+{
+  writeRegister(REG_FIFORXBASEADDR, addr);             //and receive to addr
+}
 
-#ifdef USE_SPI_TRANSACTION
-        SPI.endTransaction();
-#endif
 
-        return _RXPacketL;                                     //_RXPacketL should be payload length + 4
-      }
-      else
-      {
-        setReliableRX();
-        continue;
-      }
-    }
-  } while ( ((uint32_t) (millis() - startmS) < acktimeout)  || ((readRegister(REG_MODEMSTAT) & 0x03)) );
+uint16_t SX127XLT::readPreambleDT()
+{
+  return getPreamble();
+}
 
-  bitSet(_ReliableErrors, ReliableACKError);
-  bitSet(_ReliableErrors, ReliableTimeout);
-  return 0;
+
+void SX127XLT::writePreambleDT(uint16_t length)
+{
+  setPreamble(length);
 }
 
 
@@ -24,9 +24,26 @@
 
 #include <Arduino.h>
 #include <SX127XLT_Definitions.h>
+#include <LTLoRaConfig.h>
+#include <LTReliableCore.h>
 
 
-class SX127XLT
+struct LTSX127XSnapshot
+{
+  //the device registers and the driver settings that go with them, from saveSnapshot(), for keeping where
+  //they survive a sleep of the processor, RTC memory on the ESP32, and beginFromSnapshot() on wake up
+
+  uint32_t frequency;                         //as passed to setupLoRa()
+  int32_t offset;
+  uint8_t registers[REGCACHE_SIZE];           //registers 0x01 to 0x4F, registers[0] is not used
+  uint8_t device;
+  uint8_t packetType;
+  uint8_t useCRC;
+  uint16_t CRC;                               //CRC-CCITT of the above, a snapshot never saved fails the check
+};
+
+
+class SX127XLT : public LTReliableCore<SX127XLT>
 {
 
   public:
@@ -37,6 +54,7 @@ class SX127XLT
     bool begin(int8_t pinNSS, int8_t pinNRESET, int8_t pinDIO0, uint8_t device);
     bool begin(int8_t pinNSS, int8_t pinNRESET, uint8_t device);
     bool begin(int8_t pinNSS, uint8_t device);
+    bool beginFromSnapshot(int8_t pinNSS, int8_t pinNRESET, int8_t pinDIO0, uint8_t device, const LTSX127XSnapshot &snapshot);
     void resetDevice();
     void setMode(uint8_t modeconfig);
     void setSleep(uint8_t sleepconfig);
@@ -52,6 +70,11 @@ class SX127XLT
     bool isTransmitDone();
     void writeRegister( uint8_t address, uint8_t value );
     uint8_t readRegister( uint8_t address );
+    void writeRegisters(uint8_t address, const uint8_t *buffer, uint8_t size);
+    void readRegisters(uint8_t address, uint8_t *buffer, uint8_t size);
+    void invalidateRegisterCache();
+    uint32_t getSPITransactions();
+    void resetSPITransactions();
     void printRegisters(uint16_t start, uint16_t end);
     void printRegister(uint8_t reg);
     void printOperatingMode();
@@ -126,6 +149,8 @@ class SX127XLT
 
     void setupLoRa(uint32_t Frequency, int32_t Offset, uint8_t modParam1, uint8_t modParam2, uint8_t  modParam3, uint8_t modParam4);
     void setupLoRa(uint32_t Frequency);
+    void applyConfig(const LTSX127XConfig &config);   //setupLoRa() from an image of LTLoRaConfig.h
+    void saveSnapshot(LTSX127XSnapshot &snapshot);
     uint8_t getLoRaSF();
     uint8_t getLoRaCodingRate();
     uint8_t getOptimisation();
@@ -133,9 +158,12 @@ class SX127XLT
     uint8_t getInvertIQ();
     uint8_t getVersion();
     uint16_t getPreamble();
+    void setPreamble(uint16_t length);
+    uint8_t doCAD();
     uint32_t returnBandwidth(uint8_t BWregvalue);
     uint8_t returnOptimisation(uint8_t SpreadingFactor, uint8_t Bandwidth);
     float calcSymbolTime(float Bandwidth, uint8_t SpreadingFactor);
+    uint32_t getTimeOnAiruS(uint8_t packetL);
     void printModemSettings();
     void setSyncWord(uint8_t syncword);
     void setTXDirect();
@@ -214,29 +242,9 @@ class SX127XLT
     //Reliable RX\TX routines
     //*******************************************************************************
 
-    uint8_t transmitReliable(uint8_t *txbuffer, uint8_t size, uint16_t networkID, uint32_t txtimeout, int8_t txpower, uint8_t wait);
-    uint8_t receiveReliable(uint8_t *rxbuffer, uint8_t size, uint16_t networkID, uint32_t rxtimeout, uint8_t wait );
-
-    uint8_t transmitReliableAutoACK(uint8_t *txbuffer, uint8_t size, uint16_t networkID, uint32_t acktimeout, uint32_t txtimeout, int8_t txpower, uint8_t wait);
-    uint8_t receiveReliableAutoACK(uint8_t *rxbuffer, uint8_t size, uint16_t networkID, uint32_t ackdelay, int8_t txpower, uint32_t rxtimeout, uint8_t wait );
-
-    uint8_t sendReliableACK(uint16_t networkID, uint16_t payloadcrc, int8_t txpower);
-    uint8_t sendReliableACK(uint8_t *txbuffer, uint8_t size, uint16_t networkID, uint16_t payloadcrc, int8_t txpower);
-
-    uint8_t waitReliableACK(uint16_t networkID, uint16_t payloadcrc, uint32_t acktimeout);
-    uint8_t waitReliableACK(uint8_t *rxbuffer, uint8_t size, uint16_t networkID, uint16_t payloadcrc, uint32_t acktimeout);
-
-    uint8_t transmitSXReliable(uint8_t startaddr, uint8_t length, uint16_t networkID, uint32_t txtimeout, int8_t txpower, uint8_t wait);
-    uint8_t transmitSXReliableAutoACK(uint8_t startaddr, uint8_t length, uint16_t networkID, uint32_t acktimeout, uint32_t txtimeout, int8_t txpower, uint8_t wait);
-    uint8_t receiveSXReliable(uint8_t startaddr, uint16_t networkID, uint32_t rxtimeout, uint8_t wait );
-    uint8_t receiveSXReliableAutoACK(uint8_t startaddr, uint16_t networkID, uint32_t ackdelay, int8_t txpower, uint32_t rxtimeout, uint8_t wait );
-    uint8_t sendSXReliableACK(uint8_t startaddr, uint8_t length, uint16_t networkID, uint16_t payloadcrc, int8_t txpower);
-    uint8_t waitSXReliableACK(uint8_t startaddr, uint16_t networkID, uint16_t payloadcrc, uint32_t acktimeout);
-
-    uint8_t transmitSXReliableIRQ(uint8_t startaddr, uint8_t length, uint16_t networkID, uint32_t txtimeout, int8_t txpower, uint8_t wait);
-    uint8_t receiveSXReliableIRQ(uint8_t startaddr, uint16_t networkID, uint32_t rxtimeout, uint8_t wait );
-    uint8_t sendSXReliableACKIRQ(uint8_t startaddr, uint8_t length, uint16_t networkID, uint16_t payloadcrc, int8_t txpower);
-    uint8_t waitSXReliableACKIRQ(uint8_t startaddr, uint16_t networkID, uint16_t payloadcrc, uint32_t acktimeout);
+    //transmitReliable(), receiveReliable(), the AutoACK, ACK and SX variants, pollReliable() and the other
+    //non blocking functions, setReliablePreamble() and readReliableACKRSSI() etc are in LTReliableCore.h
+    //Their NetworkID is 0 to 0x7FFF, bit 15 is ReliableSequenceID, others are a ReliableIDError
 
     void writeUint16SXBuffer(uint8_t addr, uint16_t regdata);
     uint16_t readUint16SXBuffer(uint8_t addr);
@@ -266,15 +274,8 @@ class SX127XLT
     //Data Array - File Transfer functions
     //*******************************************************************************
 
-    uint8_t transmitDT(uint8_t *header, uint8_t headersize, uint8_t *dataarray, uint8_t size, uint16_t networkID, uint32_t txtimeout, int8_t txpower, uint8_t wait);
-    uint8_t receiveDT(uint8_t *header, uint8_t headersize, uint8_t *dataarray, uint8_t size, uint16_t networkID, uint32_t rxtimeout, uint8_t wait );
-    uint8_t sendACKDT(uint8_t *header, uint8_t headersize, int8_t txpower);
-    uint8_t waitACKDT(uint8_t *header, uint8_t headersize, uint32_t acktimeout);
-
-    uint8_t transmitDTIRQ(uint8_t *header, uint8_t headersize, uint8_t *dataarray, uint8_t size, uint16_t networkID, uint32_t txtimeout, int8_t txpower, uint8_t wait);
-    uint8_t receiveDTIRQ(uint8_t *header, uint8_t headersize, uint8_t *dataarray, uint8_t size, uint16_t networkID, uint32_t rxtimeout, uint8_t wait );
-    uint8_t sendACKDTIRQ(uint8_t *header, uint8_t headersize, int8_t txpower);
-    uint8_t waitACKDTIRQ(uint8_t *header, uint8_t headersize, uint32_t acktimeout);
+    //transmitDT(), receiveDT(), sendACKDT(), waitACKDT(), receiveHeaderDT(), readDataDT() and the IRQ
+    //variants are in LTReliableCore.h
 
     //*******************************************************************************
     //RX\TX Enable routines - Not yet tested as of 02/12/19
@@ -310,8 +311,47 @@ class SX127XLT
     uint8_t _ReliableErrors;        //Reliable status byte
     uint8_t _ReliableFlags;         //Reliable flags byte
     uint8_t _ReliableConfig;        //Reliable config byte
+    uint8_t _RegisterCache[REGCACHE_SIZE];              //shadow copies of configuration registers
+    uint8_t _RegisterCacheValid[REGCACHE_SIZE / 8];     //bit set when the shadow copy matches the device
+    bool _RegisterCacheLoRa;        //last write to REG_OPMODE selected LoRa mode, so the LoRa register page is in use
+    uint32_t _SPITransactions;      //count of NSS low to high SPI transactions
+    uint8_t _DTDataStart;           //buffer address of the data of the packet from receiveHeaderDT()
+    uint8_t _DTDataL;               //length of that data
+    uint16_t _DTPayloadCRC;         //payload CRC sent with it
+
+    bool isCachedRegister(uint8_t address);
+    bool getCachedRegister(uint8_t address, uint8_t *value);
+    void updateRegisterCache(uint8_t address, uint8_t value);
+
+    friend class LTReliableCore<SX127XLT>;            //device access of the DT and reliable functions
+
+    static const uint8_t DTMinPacketL = 8;
+    static const uint32_t DTACKTXTimeout = 60000;     //mS
+
+    void standbyDT();
+    void beginWriteDT(uint8_t offset);
+    void beginReadDT(uint8_t offset);
+    void endBufferDT();
+    void startTXDT(uint8_t length, int8_t txpower, uint32_t txtimeout);
+    bool waitTXDT(uint32_t txtimeout, bool useIRQ);
+    void startRXDT(uint32_t rxtimeout);
+    bool rxDoneDT(bool useIRQ);
+    bool waitRXDT(uint32_t rxtimeout, bool useIRQ);
+    bool endRXDT();
+    uint8_t readRXBufferStatusDT();
+    void restartRXDT();
+    bool receivingDT();
+    bool txDoneDT(bool useIRQ);
+    bool endTXDT();
+    void timeoutDT(bool tx);
+    void setTXBaseDT(uint8_t addr);
+    void setRXBaseDT(uint8_t addr);
+    uint16_t readPreambleDT();
+    void writePreambleDT(uint16_t length);
 
 };
+
+extern template class LTReliableCore<SX127XLT>;
 #endif
 
 
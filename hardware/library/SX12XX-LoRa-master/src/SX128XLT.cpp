@@ -10,7 +10,10 @@
 */
 
 #include <SX128XLT.h>
+#include <LTCRC.h>
 #include <SPI.h>
+#include <LTSPI.h>
+#include <LTAirtime.h>
 
 #define LTUNUSED(v) (void) (v)       //add LTUNUSED(variable); to avoid compiler warnings 
 #define USE_SPI_TRANSACTION
@@ -66,6 +69,7 @@ bool SX128XLT::begin(int8_t pinNSS, int8_t pinNRESET, int8_t pinRFBUSY, int8_t p
   _Device = device;
   _TXDonePin = pinDIO1;        //this is defalt pin for sensing TX done
   _RXDonePin = pinDIO1;        //this is defalt pin for sensing RX done
+  beginReliable();             //no reliable exchange in progress, sequence numbers start again
 
   digitalWrite(_NSS, HIGH);
   pinMode(_NSS, OUTPUT);
@@ -153,6 +157,7 @@ bool SX128XLT::begin(int8_t pinNSS, int8_t pinNRESET, int8_t pinRFBUSY, int8_t p
   _Device = device;
   _TXDonePin = pinDIO1;        //this is defalt pin for sensing TX done
   _RXDonePin = pinDIO1;        //this is defalt pin for sensing RX done
+  beginReliable();             //no reliable exchange in progress, sequence numbers start again
 
   digitalWrite(_NSS, HIGH);
   pinMode(_NSS, OUTPUT);
@@ -218,6 +223,7 @@ bool SX128XLT::begin(int8_t pinNSS, int8_t pinNRESET, int8_t pinRFBUSY, int8_t p
   _Device = device;
   _TXDonePin = pinDIO1;        //this is defalt pin for sensing TX done
   _RXDonePin = pinDIO1;        //this is defalt pin for sensing RX done
+  beginReliable();             //no reliable exchange in progress, sequence numbers start again
 
   digitalWrite(_NSS, HIGH);
   pinMode(_NSS, OUTPUT);
@@ -294,6 +300,7 @@ bool SX128XLT::begin(int8_t pinNSS, int8_t pinNRESET, int8_t pinRFBUSY, uint8_t
   _Device = device;
   _TXDonePin = -1;             //not defined, so mark as unused
   _RXDonePin = -1;             //not defined, so mark as unused
+  beginReliable();             //no reliable exchange in progress, sequence numbers start again
 
   digitalWrite(_NSS, HIGH);
   pinMode(_NSS, OUTPUT);
@@ -343,6 +350,7 @@ bool SX128XLT::begin(int8_t pinNSS, int8_t pinRFBUSY, uint8_t device)
   _Device = device;
   _TXDonePin = -1;             //not defined, so mark as unused
   _RXDonePin = -1;             //not defined, so mark as unused
+  beginReliable();             //no reliable exchange in progress, sequence numbers start again
 
   digitalWrite(_NSS, HIGH);    //make sure NSS state is high, before turning on output, a low to high transision here causes issues
   pinMode(_NSS, OUTPUT);
@@ -473,7 +481,6 @@ bool SX128XLT::config()
 
 void SX128XLT::readRegisters(uint16_t address, uint8_t *buffer, uint16_t size)
 {
-  uint16_t index;
   uint8_t addr_l, addr_h;
 
   addr_h = address >> 8;
@@ -489,10 +496,7 @@ void SX128XLT::readRegisters(uint16_t address, uint8_t *buffer, uint16_t size)
   SPI.transfer(addr_h);               //MSB
   SPI.transfer(addr_l);               //LSB
   SPI.transfer(0xFF);
-  for (index = 0; index < size; index++)
-  {
-    *(buffer + index) = SPI.transfer(0xFF);
-  }
+  LTSPIreadBytes(buffer, size);
 
   digitalWrite(_NSS, HIGH);
 
@@ -515,7 +519,6 @@ uint8_t SX128XLT::readRegister(uint16_t address)
 void SX128XLT::writeRegisters(uint16_t address, uint8_t *buffer, uint16_t size)
 {
   uint8_t addr_l, addr_h;
-  uint8_t i;
 
   addr_l = address & 0xff;
   addr_h = address >> 8;
@@ -530,10 +533,7 @@ void SX128XLT::writeRegisters(uint16_t address, uint8_t *buffer, uint16_t size)
   SPI.transfer(addr_h);        //MSB
   SPI.transfer(addr_l);        //LSB
 
-  for (i = 0; i < size; i++)
-  {
-    SPI.transfer(buffer[i]);
-  }
+  LTSPIwriteBytes(buffer, size);
 
   digitalWrite(_NSS, HIGH);
 
@@ -557,7 +557,6 @@ void SX128XLT::writeCommand(uint8_t Opcode, uint8_t *buffer, uint16_t size)
   //Serial.println(Opcode, HEX);
 #endif
 
-  uint8_t index;
   checkBusy();
 
 #ifdef USE_SPI_TRANSACTION                 //to use SPI_TRANSACTION enable define at beginning of CPP file 
@@ -567,10 +566,7 @@ void SX128XLT::writeCommand(uint8_t Opcode, uint8_t *buffer, uint16_t size)
   digitalWrite(_NSS, LOW);
   SPI.transfer(Opcode);
 
-  for (index = 0; index < size; index++)
-  {
-    SPI.transfer(buffer[index]);
-  }
+  LTSPIwriteBytes(buffer, size);
   digitalWrite(_NSS, HIGH);
 
 #ifdef USE_SPI_TRANSACTION
@@ -591,7 +587,6 @@ void SX128XLT::readCommand(uint8_t Opcode, uint8_t *buffer, uint16_t size)
   //Serial.println(Opcode, HEX);
 #endif
 
-  uint8_t i;
   checkBusy();
 
 #ifdef USE_SPI_TRANSACTION                   //to use SPI_TRANSACTION enable define at beginning of CPP file 
@@ -602,10 +597,7 @@ void SX128XLT::readCommand(uint8_t Opcode, uint8_t *buffer, uint16_t size)
   SPI.transfer(Opcode);
   SPI.transfer(0xFF);
 
-  for ( i = 0; i < size; i++ )
-  {
-    *(buffer + i) = SPI.transfer(0xFF);
-  }
+  LTSPIreadBytes(buffer, size);
   digitalWrite(_NSS, HIGH);
 
 
@@ -1177,6 +1169,30 @@ uint32_t SX128XLT::returnBandwidth(uint8_t data)
 }
 
 
+uint32_t SX128XLT::getTimeOnAiruS(uint8_t packetL)
+{
+  //time on air in uS of a LoRa packet of packetL bytes with the current settings, see LTAirtime.h. The
+  //preamble is held as mantissa and exponent, SF11 and SF12 always use 4 bits less per symbol. The long
+  //interleaving coding rates are taken as the same rate without, which is close but not exact
+
+#ifdef SX128XDEBUG
+  Serial.println(F("getTimeOnAiruS()"));
+#endif
+
+  uint8_t sf = getLoRaSF();
+  uint8_t cr = (savedModParam3 > LORA_CR_4_8) ? ((savedModParam3 == LORA_CR_LI_4_8) ? 8 : savedModParam3) : (savedModParam3 + 4);
+  uint16_t preamble = (savedPacketParam1 & 0x0F) << (savedPacketParam1 >> 4);
+
+  if (savedPacketType != PACKET_TYPE_LORA)
+  {
+    return 0;
+  }
+
+  return LTAirtimeuS(returnBandwidth(savedModParam2), sf, cr, preamble, packetL, (savedPacketParam4 == LORA_CRC_ON),
+                     (savedPacketParam2 == LORA_PACKET_FIXED_LENGTH), (sf > 10), (sf < 7));
+}
+
+
 uint8_t SX128XLT::getLoRaCodingRate()
 {
 #ifdef SX128XDEBUG
@@ -1469,8 +1485,6 @@ uint8_t SX128XLT::transmit(uint8_t *txbuffer, uint8_t size, uint16_t timeout, in
 #ifdef SX128XDEBUG
   Serial.println(F("transmit()"));
 #endif
-  uint8_t index;
-  uint8_t bufferdata;
 
   if (size == 0)
   {
@@ -1488,11 +1502,7 @@ uint8_t SX128XLT::transmit(uint8_t *txbuffer, uint8_t size, uint16_t timeout, in
   SPI.transfer(RADIO_WRITE_BUFFER);
   SPI.transfer(0);
 
-  for (index = 0; index < size; index++)
-  {
-    bufferdata = txbuffer[index];
-    SPI.transfer(bufferdata);
-  }
+  LTSPIwriteBytes(txbuffer, size);
 
   digitalWrite(_NSS, HIGH);
 
@@ -1531,8 +1541,6 @@ uint8_t SX128XLT::transmitIRQ(uint8_t *txbuffer, uint8_t size, uint16_t timeout,
 #ifdef SX128XDEBUG
   Serial.println(F("transmitIRQ()"));
 #endif
-  uint8_t index;
-  uint8_t bufferdata;
 
   if (size == 0)
   {
@@ -1550,11 +1558,7 @@ uint8_t SX128XLT::transmitIRQ(uint8_t *txbuffer, uint8_t size, uint16_t timeout,
   SPI.transfer(RADIO_WRITE_BUFFER);
   SPI.transfer(0);
 
-  for (index = 0; index < size; index++)
-  {
-    bufferdata = txbuffer[index];
-    SPI.transfer(bufferdata);
-  }
+  LTSPIwriteBytes(txbuffer, size);
 
   digitalWrite(_NSS, HIGH);
 
@@ -1769,25 +1773,7 @@ uint16_t SX128XLT::CRCCCITT(uint8_t *buffer, uint32_t size, uint16_t start)
   Serial.println(F("CRCCCITT()"));
 #endif
 
-  uint32_t index;
-  uint16_t libraryCRC;
-  uint8_t j;
-
-  libraryCRC = start;                                  //start value for CRC16
-
-  for (index = 0; index < size; index++)
-  {
-    libraryCRC ^= (((uint16_t)buffer[index]) << 8);
-    for (j = 0; j < 8; j++)
-    {
-      if (libraryCRC & 0x8000)
-        libraryCRC = (libraryCRC << 1) ^ 0x1021;
-      else
-        libraryCRC <<= 1;
-    }
-  }
-
-  return libraryCRC;
+  return LTCRCCCITTUpdate(start, buffer, size);                 //table driven CRC16, see LTCRC.h
 }
 
 
@@ -1797,7 +1783,7 @@ uint8_t SX128XLT::receive(uint8_t *rxbuffer, uint8_t size, uint16_t timeout, uin
   Serial.println(F("receive()"));
 #endif
 
-  uint8_t index, RXstart, RXend;
+  uint8_t RXstart;
   uint16_t regdata;
   uint8_t buffer[2];
 
@@ -1828,7 +1814,6 @@ uint8_t SX128XLT::receive(uint8_t *rxbuffer, uint8_t size, uint16_t timeout, uin
   }
 
   RXstart = buffer[1];
-  RXend = RXstart + _RXPacketL;
   checkBusy();
 
 #ifdef USE_SPI_TRANSACTION             //to use SPI_TRANSACTION enable define at beginning of CPP file 
@@ -1840,11 +1825,7 @@ uint8_t SX128XLT::receive(uint8_t *rxbuffer, uint8_t size, uint16_t timeout, uin
   SPI.transfer(RXstart);
   SPI.transfer(0xFF);
 
-  for (index = RXstart; index < RXend; index++)
-  {
-    regdata = SPI.transfer(0);
-    rxbuffer[index] = regdata;
-  }
+  LTSPIreadBytes(rxbuffer, _RXPacketL);
 
   digitalWrite(_NSS, HIGH);
 
@@ -1862,8 +1843,7 @@ uint8_t SX128XLT::receiveIRQ(uint8_t *rxbuffer, uint8_t size, uint16_t timeout,
   Serial.println(F("receiveIRQ()"));
 #endif
 
-  uint8_t index, RXstart, RXend;
-  uint16_t regdata;
+  uint8_t RXstart;
   uint8_t buffer[2];
 
   setRx(timeout);
@@ -1892,7 +1872,6 @@ uint8_t SX128XLT::receiveIRQ(uint8_t *rxbuffer, uint8_t size, uint16_t timeout,
   }
 
   RXstart = buffer[1];
-  RXend = RXstart + _RXPacketL;
 
   checkBusy();
 
@@ -1905,11 +1884,7 @@ uint8_t SX128XLT::receiveIRQ(uint8_t *rxbuffer, uint8_t size, uint16_t timeout,
   SPI.transfer(RXstart);
   SPI.transfer(0xFF);
 
-  for (index = RXstart; index < RXend; index++)
-  {
-    regdata = SPI.transfer(0);
-    rxbuffer[index] = regdata;
-  }
+  LTSPIreadBytes(rxbuffer, _RXPacketL);
 
   digitalWrite(_NSS, HIGH);
 
@@ -2226,8 +2201,6 @@ uint8_t SX128XLT::transmitAddressed(uint8_t *txbuffer, uint8_t size, char txpack
 #ifdef SX128XDEBUG
   Serial.println(F("transmitAddressed()"));
 #endif
-  uint8_t index;
-  uint8_t bufferdata;
 
   if (size == 0)
   {
@@ -2250,11 +2223,7 @@ uint8_t SX128XLT::transmitAddressed(uint8_t *txbuffer, uint8_t size, char txpack
   SPI.transfer(txsource);                         //Source node
   _TXPacketL = 3 + size;                          //we have added 3 header bytes to size
 
-  for (index = 0; index < size; index++)
-  {
-    bufferdata = txbuffer[index];
-    SPI.transfer(bufferdata);
-  }
+  LTSPIwriteBytes(txbuffer, size);
 
   digitalWrite(_NSS, HIGH);
 
@@ -2294,7 +2263,7 @@ uint8_t SX128XLT::receiveAddressed(uint8_t *rxbuffer, uint8_t size, uint16_t tim
   Serial.println(F("receiveAddressed()"));
 #endif
 
-  uint8_t index, RXstart, RXend;
+  uint8_t RXstart;
   uint16_t regdata;
   uint8_t buffer[2];
 
@@ -2325,7 +2294,6 @@ uint8_t SX128XLT::receiveAddressed(uint8_t *rxbuffer, uint8_t size, uint16_t tim
   }
 
   RXstart = buffer[1];
-  RXend = RXstart + _RXPacketL;
   checkBusy();
 
 #ifdef USE_SPI_TRANSACTION              //to use SPI_TRANSACTION enable define at beginning of CPP file 
@@ -2339,11 +2307,7 @@ uint8_t SX128XLT::receiveAddressed(uint8_t *rxbuffer, uint8_t size, uint16_t tim
 
   
 
-  for (index = RXstart; index < RXend; index++)
-  {
-    regdata = SPI.transfer(0);
-    rxbuffer[index] = regdata;
-  }
+  LTSPIreadBytes(rxbuffer, _RXPacketL);
 
   digitalWrite(_NSS, HIGH);
 
@@ -2371,7 +2335,7 @@ uint8_t SX128XLT::readPacket(uint8_t *rxbuffer, uint8_t size)
   Serial.println(F("readPacket()"));
 #endif
 
-  uint8_t index, regdata, RXstart, RXend;
+  uint8_t RXstart;
   uint8_t buffer[2];
 
   readCommand(RADIO_GET_RXBUFFERSTATUS, buffer, 2);
@@ -2383,7 +2347,6 @@ uint8_t SX128XLT::readPacket(uint8_t *rxbuffer, uint8_t size)
   }
 
   RXstart = buffer[1];
-  RXend = RXstart + _RXPacketL;
   checkBusy();
 
 #ifdef USE_SPI_TRANSACTION               //to use SPI_TRANSACTION enable define at beginning of CPP file 
@@ -2395,11 +2358,7 @@ uint8_t SX128XLT::readPacket(uint8_t *rxbuffer, uint8_t size)
   SPI.transfer(RXstart);
   SPI.transfer(0xFF);
 
-  for (index = RXstart; index < RXend; index++)
-  {
-    regdata = SPI.transfer(0);
-    rxbuffer[index] = regdata;
-  }
+  LTSPIreadBytes(rxbuffer, _RXPacketL);
 
   digitalWrite(_NSS, HIGH);
 
@@ -2880,16 +2839,11 @@ void SX128XLT::writeBuffer(uint8_t *txbuffer, uint8_t size)
   Serial.println(F("writeBuffer()"));
 #endif
 
-  uint8_t index, regdata;
 
   _TXPacketL = _TXPacketL + size;      //these are the number of bytes that will be added
   size--;                              //loose one byte from size, the last byte written MUST be a 0
 
-  for (index = 0; index < size; index++)
-  {
-    regdata = txbuffer[index];
-    SPI.transfer(regdata);
-  }
+  LTSPIwriteBytes(txbuffer, size);
 
   SPI.transfer(0);                     //this ensures last byte of buffer written really is a null (0)
 
@@ -2997,22 +2951,21 @@ uint16_t SX128XLT::CRCCCITTSX(uint8_t startadd, uint8_t endadd, uint16_t startva
   Serial.println(F("CRCCCITTSX()"));
 #endif
 
-  uint16_t index, libraryCRC;
-  uint8_t j;
+  uint16_t remaining, libraryCRC;
+  uint8_t buff[32], length;
 
   libraryCRC = startvalue;                           //start value for CRC16
   startReadSXBuffer(startadd);                       //begin the buffer read
 
-  for (index = startadd; index <= endadd; index++)
+  remaining = (endadd >= startadd) ? (endadd - startadd + 1) : 0;
+
+  while (remaining > 0)                             //a block of the buffer at a time
   {
-    libraryCRC ^= (((uint16_t) readUint8() ) << 8);
-    for (j = 0; j < 8; j++)
-    {
-      if (libraryCRC & 0x8000)
-        libraryCRC = (libraryCRC << 1) ^ 0x1021;
-      else
-        libraryCRC <<= 1;
-    }
+    length = (remaining < sizeof(buff)) ? remaining : sizeof(buff);
+    LTSPIreadBytes(buff, length);
+    libraryCRC = LTCRCCCITTUpdate(libraryCRC, buff, length);
+    _RXPacketL = _RXPacketL + length;                 //count of bytes read, as readUint8() keeps it
+    remaining = remaining - length;
   }
 
   endReadSXBuffer();                                 //end the buffer read
@@ -3094,16 +3047,11 @@ void SX128XLT::writeBufferChar(char *txbuffer, uint8_t size)
   Serial.println(F("writeBuffer()"));
 #endif
 
-  uint8_t index, regdata;
 
   _TXPacketL = _TXPacketL + size;      //these are the number of bytes that will be added
   size--;                              //loose one byte from size, the last byte written MUST be a 0
 
-  for (index = 0; index < size; index++)
-  {
-    regdata = txbuffer[index];
-    SPI.transfer(regdata);
-  }
+  LTSPIwriteBytes((uint8_t *) txbuffer, size);
 
   SPI.transfer(0);                     //this ensures last byte of buffer writen really is a null (0)
 }
@@ -3499,6 +3447,7 @@ int16_t SX128XLT::getRangingRSSI()
 //**********************************************************************************************
 // Reliable packet routines - added November 2021
 // Routines assume that RX and TX buffer base addresses are set to 0 by setupLoRa(), setupFLRC()
+// The reliable packets, ACKs and pollReliable() are in LTReliableCore.h, shared with the SX126X and SX127X
 //**********************************************************************************************
 
 void SX128XLT::printASCIIArray(uint8_t *buffer, uint8_t size)
@@ -3527,93 +3476,6 @@ uint8_t SX128XLT::getReliableConfig(uint8_t bitread)
 }
 
 
-uint8_t SX128XLT::transmitReliable(uint8_t *txbuffer, uint8_t size, uint16_t networkID, uint32_t txtimeout, int8_t txpower, uint8_t wait)
-{
-#ifdef SX128XDEBUGRELIABLE
-  Serial.println();
-  Serial.println(F(" {RELIABLE} transmitRELIABLE() "));
-  Serial.print(F(" {RELIABLE} _ReliableConfig "));
-  Serial.println(_ReliableConfig, HEX);
-  Serial.print(F(" {RELIABLE} Payload length "));
-  Serial.println(size);
-#endif
-
-  uint8_t index, tempdata;
-  uint16_t payloadcrc;
-
-  _ReliableErrors = 0;
-  _ReliableFlags = 0;
-
-  if (size > 251)
-  {
-    bitSet(_ReliableErrors, ReliableSizeError);
-    return 0;
-  }
-
-  setMode(MODE_STDBY_RC);
-  _TXPacketL = size + 4;
-
-  if (bitRead(_ReliableConfig, NoReliableCRC))
-  {
-    payloadcrc = 0;
-  }
-  else
-  {
-    payloadcrc = CRCCCITT(txbuffer, size, 0xFFFF);
-    //payloadcrc = CRCCCITT(txbuffer, size, 0xFFFF) + 1;
-  }
-
-  checkBusy();
-
-#ifdef USE_SPI_TRANSACTION
-  SPI.beginTransaction(SPISettings(LTspeedMaximum, LTdataOrder, LTdataMode));
-#endif
-
-  digitalWrite(_NSS, LOW);
-  SPI.transfer(RADIO_WRITE_BUFFER);
-  SPI.transfer(0);
-
-  for (index = 0; index < size; index++)
-  {
-    tempdata = txbuffer[index];
-    SPI.transfer(tempdata);
-  }
-
-  SPI.transfer(lowByte(networkID));
-  SPI.transfer(highByte(networkID));
-  SPI.transfer(lowByte(payloadcrc));
-  SPI.transfer(highByte(payloadcrc));
-
-  digitalWrite(_NSS, HIGH);
-
-#ifdef USE_SPI_TRANSACTION
-  SPI.endTransaction();
-#endif
-
-  setPayloadLength(_TXPacketL);
-
-  setTxParams(txpower, RAMP_TIME);
-  setDioIrqParams(IRQ_RADIO_ALL, (IRQ_TX_DONE + IRQ_RX_TX_TIMEOUT), 0, 0);   //set for IRQ on TX done and timeout on DIO1
-  setTx(txtimeout);
-
-  if (!wait)
-  {
-    return _TXPacketL;
-  }
-
-  while (!digitalRead(_TXDonePin));                                //Wait for DIO1 to go high
-
-  setMode(MODE_STDBY_RC);                                          //ensure we leave function with TX off
-
-  if (readIrqStatus() & IRQ_RX_TX_TIMEOUT )                        //check for timeout
-  {
-    return 0;
-  }
-
-  return _TXPacketL;
-}
-
-
 uint16_t SX128XLT::getTXPayloadCRC(uint8_t length)
 {
 #ifdef SX128XDEBUGRELIABLE
@@ -3702,6 +3564,12 @@ void SX128XLT::printReliableStatus()
     Serial.print(F(",ACKreceived"));
   }
 
+  //0x02
+  if (bitRead(_ReliableFlags, ReliableDuplicate))
+  {
+    Serial.print(F(",DuplicateACKed"));
+  }
+
 }
 
 
@@ -3770,67 +3638,38 @@ uint16_t SX128XLT::readUint16SXBuffer(uint8_t addr)
 //******************************************************************************************
 
 
-uint8_t SX128XLT::receiveReliable(uint8_t *rxbuffer, uint8_t size, uint16_t networkID, uint32_t rxtimeout, uint8_t wait )
+void SX128XLT::setReliableRX(uint16_t timeout)
 {
-  //Maximum total packet size is 255 bytes, so allowing for the 4 bytes appended to the end of a reliable
-  //packet, the maximum payload size for LORa is 251 bytes and 117 bytes for FLRC. So to avoid overwriting
-  //memory, we do need to check if the passed array is big enough to take the payload received in the packet.
-  //The assumed payload length will always be 4 bytes less than the received packet length.
-
+  //existing setRx() does not setup LoRa device as a receiver completly, just turns on receiver mode
+  //this routine does all the required setup for receive mode
 #ifdef SX128XDEBUGRELIABLE
-  Serial.println();
-  Serial.println(F(" {RELIABLE} receiveReliable()"));
-  Serial.print(F(" {RELIABLE} _ReliableConfig "));
-  Serial.println(_ReliableConfig, HEX);
+  Serial.println(F(" {RELIABLE} setReliableRX()"));
 #endif
 
-  uint16_t payloadcrc = 0, RXcrc, RXnetworkID = 0;
-  uint8_t regdataL, regdataH;
-  uint8_t index;
-  uint8_t buffer[2];
-
-  _ReliableErrors = 0;
-  _ReliableFlags = 0;
-
-  if (size > 251 )
-  {
-    bitSet(_ReliableErrors, ReliableSizeError);
-    return 0;
-  }
-
-  setMode(MODE_STDBY_RC);
-  setDioIrqParams(IRQ_RADIO_ALL, (IRQ_RX_DONE + IRQ_RX_TX_TIMEOUT + IRQ_HEADER_ERROR), 0, 0);  //set for IRQ on RX done or timeout
-  setRx(rxtimeout);
-
-  if (!wait)
-  {
-    return 0;                                                               //not wait requested so no packet length to pass
-  }
-
-  while (!digitalRead(_RXDonePin));                                         //Wait for DIO1 to go high
-  setMode(MODE_STDBY_RC);                                                   //ensure to stop further packet reception
+  setMode(MODE_STDBY_RC);                                                   //stops receiver
+  clearIrqStatus(IRQ_RADIO_ALL);                                            //clear current interrupt flags
+  setDioIrqParams(IRQ_RADIO_ALL, (IRQ_RX_DONE + IRQ_RX_TX_TIMEOUT + IRQ_HEADER_ERROR), 0, 0);
+  setRx(timeout);
+}
 
-  if ( readIrqStatus() & (IRQ_HEADER_ERROR + IRQ_CRC_ERROR + IRQ_RX_TX_TIMEOUT + IRQ_SYNCWORD_ERROR))
-  {
-    return 0;                                                               //packet is errored somewhere so return 0
-  }
 
-  readCommand(RADIO_GET_RXBUFFERSTATUS, buffer, 2);
-  _RXPacketL = buffer[0];
+uint16_t SX128XLT::CRCCCITTReliable(uint8_t startadd, uint8_t endadd, uint16_t startvalue)
+{
+#ifdef SX128XDEBUGRELIABLE
+  Serial.println(F(" {RELIABLE} CRCCCITTReliable()"));
+#endif
 
+  //generates a CRC of bytes from the internal SX buffer, _RXPackletL and _TXPackletL are not affected
 
-  if (_RXPacketL < 4)                                  //check received packet is 4 or more bytes long
-  {
-    bitSet(_ReliableErrors, ReliableSizeError);
-    return 0;
-  }
+#ifdef SX128DEBUGRELIABLE
+  Serial.println(F(" {RELIABLE} CRCCCITTReliable() "));
+#endif
 
-  if ((_RXPacketL - 4) > size )                        //check if calculated payload size (_RXPacketL -4) fits in array
-  {
-    bitSet(_ReliableErrors, ReliableSizeError);
-    return 0;
-  }
+  uint16_t remaining, libraryCRC;
+  uint8_t buff[32], length;
 
+  libraryCRC = startvalue;              //start value for CRC16
+  setMode(MODE_STDBY_RC);
   checkBusy();
 
 #ifdef USE_SPI_TRANSACTION
@@ -3839,2117 +3678,278 @@ uint8_t SX128XLT::receiveReliable(uint8_t *rxbuffer, uint8_t size, uint16_t netw
 
   digitalWrite(_NSS, LOW);             //start the burst read
   SPI.transfer(RADIO_READ_BUFFER);
-  SPI.transfer(0);
+  SPI.transfer(startadd);
   SPI.transfer(0xFF);
 
-  for (index = 0; index < (_RXPacketL - 4); index++)
+  remaining = (endadd >= startadd) ? (endadd - startadd + 1) : 0;
+
+  while (remaining > 0)                         //a block of the FIFO at a time
   {
-    regdataL = SPI.transfer(0);
-    rxbuffer[index] = regdataL;
+    length = (remaining < sizeof(buff)) ? remaining : sizeof(buff);
+    LTSPIreadBytes(buff, length);
+    libraryCRC = LTCRCCCITTUpdate(libraryCRC, buff, length);
+    remaining = remaining - length;
   }
 
-  regdataL = SPI.transfer(0);
-  regdataH = SPI.transfer(0);
-  RXnetworkID = ((uint16_t) regdataH << 8) + regdataL;
-  regdataL = SPI.transfer(0);
-  regdataH = SPI.transfer(0);
-
   digitalWrite(_NSS, HIGH);
 
 #ifdef USE_SPI_TRANSACTION
   SPI.endTransaction();
 #endif
 
-  if (!bitRead(_ReliableConfig, NoReliableCRC))
-  {
-    payloadcrc = CRCCCITT(rxbuffer, (_RXPacketL - 4), 0xFFFF);
-    RXcrc = ((uint16_t) regdataH << 8) + regdataL;
-
-    if (payloadcrc != RXcrc)
-    {
-      bitSet(_ReliableErrors, ReliableCRCError);
-    }
-  }
+  return libraryCRC;
+}
 
-  if (RXnetworkID != networkID)
-  {
-    bitSet(_ReliableErrors, ReliableIDError);
-  }
 
-  if (_ReliableErrors)                                      //if there has been a reliable error return a RX fail
-  {
-    return 0;
-  }
+void SX128XLT::setReliableConfig(uint8_t bitset)
+{
+#ifdef SX128XDEBUGRELIABLE
+  Serial.print(F(" {RELIABLE} setReliableConfig() bit "));
+  Serial.println(bitset);
+#endif
 
-  return _RXPacketL;                                        //return and indicate RX OK.
+  bitSet(_ReliableConfig, bitset);
+  return;
 }
 
 
-void SX128XLT::setReliableRX(uint16_t timeout)
+void SX128XLT::clearReliableConfig(uint8_t bitset)
 {
-  //existing setRx() does not setup LoRa device as a receiver completly, just turns on receiver mode
-  //this routine does all the required setup for receive mode
 #ifdef SX128XDEBUGRELIABLE
-  Serial.println(F(" {RELIABLE} setReliableRX()"));
+  Serial.print(F(" {RELIABLE} clearReliableConfig() bit "));
+  Serial.println(bitset);
 #endif
 
-  setMode(MODE_STDBY_RC);                                                   //stops receiver
-  clearIrqStatus(IRQ_RADIO_ALL);                                            //clear current interrupt flags
-  setDioIrqParams(IRQ_RADIO_ALL, (IRQ_RX_DONE + IRQ_RX_TX_TIMEOUT + IRQ_HEADER_ERROR), 0, 0);
-  setRx(timeout);
+  bitClear(_ReliableConfig, bitset);
+  return;
 }
 
 
-uint8_t SX128XLT::transmitReliableAutoACK(uint8_t *txbuffer, uint8_t size, uint16_t networkID, uint32_t acktimeout, uint32_t txtimeout, int8_t txpower, uint8_t wait)
+
+uint8_t SX128XLT::readReliableErrors()
 {
 #ifdef SX128XDEBUGRELIABLE
-  Serial.println(F(" {RELIABLE} transmitReliableAutoACK() "));
-  Serial.print(F(" {RELIABLE} _ReliableConfig "));
-  Serial.println(_ReliableConfig, HEX);
-  Serial.print(F(" {RELIABLE} Payload length "));
-  Serial.println(size);
+  Serial.println(F(" {RELIABLE} readReliableErrors()"));
 #endif
 
-  uint8_t index, tempdata, RXPacketL;
-  uint16_t payloadcrc;
+  return _ReliableErrors;
+}
 
-  _ReliableErrors = 0;
-  _ReliableFlags = 0;
+uint8_t SX128XLT::readReliableFlags()
+{
+#ifdef SX128XDEBUGRELIABLE
+  Serial.println(F(" {RELIABLE} readReliableFlags()"));
+#endif
 
-  if (size > 251)
-  {
-    bitSet(_ReliableErrors, ReliableSizeError);
-    return 0;
-  }
+  return _ReliableFlags;
+}
 
-  setMode(MODE_STDBY_RC);
-  checkBusy();
-  _TXPacketL = size + 4;
 
-  if (bitRead(_ReliableConfig, NoReliableCRC))
-  {
-    payloadcrc = 0;
-  }
-  else
-  {
-    payloadcrc = CRCCCITT(txbuffer, size, 0xFFFF);
-    //payloadcrc = CRCCCITT(txbuffer, size, 0xFFFF) + 1;
-  }
+//***********************************************************************************
+//Data Transfer functions - Added November 2021
+//TX and RX base addresses assumed to be 0
+//The DT functions are in LTReliableCore.h, these are the device accesses they call
+//***********************************************************************************
 
-  checkBusy();
+template class LTReliableCore<SX128XLT>;
 
-#ifdef USE_SPI_TRANSACTION
-  SPI.beginTransaction(SPISettings(LTspeedMaximum, LTdataOrder, LTdataMode));
-#endif
-
-  digitalWrite(_NSS, LOW);
-  SPI.transfer(RADIO_WRITE_BUFFER);
-  SPI.transfer(0);
-
-  for (index = 0; index < size; index++)
-  {
-    tempdata = txbuffer[index];
-    SPI.transfer(tempdata);
-  }
-
-  SPI.transfer(lowByte(networkID));
-  SPI.transfer(highByte(networkID));
-  SPI.transfer(lowByte(payloadcrc));
-  SPI.transfer(highByte(payloadcrc));
-
-  digitalWrite(_NSS, HIGH);
-
-#ifdef USE_SPI_TRANSACTION
-  SPI.endTransaction();
-#endif
-
-  setPayloadLength(_TXPacketL);
-  setTxParams(txpower, RAMP_TIME);
-  setDioIrqParams(IRQ_RADIO_ALL, (IRQ_TX_DONE + IRQ_RX_TX_TIMEOUT), 0, 0);   //set for IRQ on TX done and timeout on DIO1
-  setTx(txtimeout);
-
-  if (!wait)
-  {
-    return _TXPacketL;
-  }
-
-  while (!digitalRead(_TXDonePin));                                //Wait for DIO1 to go high
-
-  setMode(MODE_STDBY_RC);                                          //ensure we leave function with TX off
-
-  if (readIrqStatus() & IRQ_RX_TX_TIMEOUT )                        //check for timeout
-  {
-    return 0;
-  }
-
-  RXPacketL = waitReliableACK(networkID, payloadcrc, acktimeout);
-
-  if (RXPacketL != 4)
-  {
-    return 0;
-  }
-
-  return _TXPacketL;
-}
-
-
-uint8_t SX128XLT::waitReliableACK(uint16_t networkID, uint16_t payloadcrc, uint32_t acktimeout)
-{
-
-#ifdef SX128XDEBUGRELIABLE
-  Serial.println(F(" {RELIABLE} waitReliableACK()"));
-#endif
-
-  uint16_t RXnetworkID, RXcrc;
-  uint32_t startmS;
-  uint8_t buffer[2];
-
-  setReliableRX(0);
-  startmS = millis();
-
-  do
-  {
-    if (digitalRead(_RXDonePin))          //has a packet arrived ?
-    {
-      if ( readIrqStatus() & (IRQ_HEADER_ERROR + IRQ_CRC_ERROR + IRQ_RX_TX_TIMEOUT + IRQ_SYNCWORD_ERROR))
-      {
-        setReliableRX(0);
-        continue;
-      }
-
-      readCommand(RADIO_GET_RXBUFFERSTATUS, buffer, 2);
-      _RXPacketL = buffer[0];
-      RXnetworkID = readUint16SXBuffer(_RXPacketL - 4);
-      RXcrc = readUint16SXBuffer(_RXPacketL - 2);
-
-      if ( (RXnetworkID == networkID) && (RXcrc == payloadcrc))
-      {
-        bitSet(_ReliableFlags, ReliableACKReceived);
-        return 4;                          //return value of 4 indicates valid ack
-      }
-      else
-      {
-        setReliableRX(0);
-        continue;
-      }
-    }
-
-  } while ( ((uint32_t) (millis() - startmS) < acktimeout));
-
-  bitSet(_ReliableErrors, ReliableACKError);
-  return 0;
-}
-
-
-uint8_t SX128XLT::waitReliableACK(uint8_t *rxbuffer, uint8_t size, uint16_t networkID, uint16_t payloadcrc, uint32_t acktimeout)
-{
-  //overloaded version of waitReliableACK() for use when ack contains payload data
-#ifdef SX128XDEBUGRELIABLE
-  Serial.println(F(" {RELIABLE} waitReliableACK()"));
-#endif
-
-  uint16_t RXnetworkID, RXcrc;
-  uint32_t startmS;
-  uint8_t buffer[2];
-  uint8_t regdata, index;
-
-
-  if (size > 251 )
-  {
-    bitSet(_ReliableErrors, ReliableSizeError);
-    return 0;
-  }
-
-  setReliableRX(0);
-  startmS = millis();
-
-  do
-  {
-    if (digitalRead(_RXDonePin))                         //has a packet arrived ?
-    {
-      regdata = readIrqStatus();
-
-      if ( readIrqStatus() & (IRQ_HEADER_ERROR + IRQ_CRC_ERROR + IRQ_RX_TX_TIMEOUT + IRQ_SYNCWORD_ERROR))
-      {
-        setReliableRX(0);
-        continue;
-      }
-
-      readCommand(RADIO_GET_RXBUFFERSTATUS, buffer, 2);
-      _RXPacketL = buffer[0];
-      RXnetworkID = readUint16SXBuffer(_RXPacketL - 4);
-      RXcrc = readUint16SXBuffer(_RXPacketL - 2);
-
-      if ( (RXnetworkID == networkID) && (RXcrc == payloadcrc))
-      {
-        if ((_RXPacketL - 4) > size )                    //check passed buffer is big enough for payload
-        {
-          bitSet(_ReliableErrors, ReliableACKError);
-          bitSet(_ReliableErrors, ReliableSizeError);
-          return 0;
-        }
-
-        bitSet(_ReliableFlags, ReliableACKReceived);
-        checkBusy();
-
-#ifdef USE_SPI_TRANSACTION
-        SPI.beginTransaction(SPISettings(LTspeedMaximum, LTdataOrder, LTdataMode));
-#endif
-
-        digitalWrite(_NSS, LOW);             //start the burst read
-        SPI.transfer(RADIO_READ_BUFFER);
-        SPI.transfer(0);
-        SPI.transfer(0xFF);
-
-        for (index = 0; index < (_RXPacketL - 4); index++)   //read packet into rxbuffer
-        {
-          regdata = SPI.transfer(0);
-          rxbuffer[index] = regdata;
-        }
-        digitalWrite(_NSS, HIGH);
-
-#ifdef USE_SPI_TRANSACTION
-        SPI.endTransaction();
-#endif
-
-        return _RXPacketL;                                  //_RXPacketL should be payload length + 4
-      }
-      else
-      {
-        setReliableRX(0);
-        continue;
-      }
-    }
-  } while ( ((uint32_t) (millis() - startmS) < acktimeout) );
-
-  bitSet(_ReliableErrors, ReliableACKError);
-  return 0;
-}
-
-
-
-uint8_t SX128XLT::receiveReliableAutoACK(uint8_t *rxbuffer, uint8_t size, uint16_t networkID, uint32_t ackdelay, int8_t txpower, uint32_t rxtimeout, uint8_t wait )
-{
-  //Maximum total packet size is 255 bytes, so allowing for the 4 bytes appended to the end of a reliable
-  //packet, the maximum payload size for LORa is 251 bytes and 117 bytes for FLRC. So to avoid overwriting
-  //memory, we do need to check if the passed array is big enough to take the payload received in the packet.
-  //The assumed payload length will always be 4 bytes less than the received packet length.
-
-
-#ifdef SX128XDEBUGRELIABLE
-  Serial.println();
-  Serial.println(F(" {RELIABLE} receiveReliableAutoACK()"));
-  Serial.print(F(" {RELIABLE} _ReliableConfig "));
-  Serial.println(_ReliableConfig, HEX);
-#endif
-
-  uint16_t payloadcrc = 0, RXcrc, RXnetworkID = 0;
-  uint8_t regdataL, regdataH, index;
-  uint8_t buffer[2];
-
-  _ReliableErrors = 0;
-  _ReliableFlags = 0;
-
-  if (size > 251 )
-  {
-    bitSet(_ReliableErrors, ReliableSizeError);
-    return 0;
-  }
-
-  setMode(MODE_STDBY_RC);
-  setDioIrqParams(IRQ_RADIO_ALL, (IRQ_RX_DONE + IRQ_RX_TX_TIMEOUT + IRQ_HEADER_ERROR), 0, 0);  //set for IRQ on RX done or timeout
-  setRx(rxtimeout);
-
-  if (!wait)
-  {
-    return 0;                                                               //not wait requested so no packet length to pass
-  }
-
-  while (!digitalRead(_RXDonePin));                                         //Wait for DIO1 to go high
-  setMode(MODE_STDBY_RC);                                                   //ensure to stop further packet reception
-
-  if ( readIrqStatus() & (IRQ_HEADER_ERROR + IRQ_CRC_ERROR + IRQ_RX_TX_TIMEOUT + IRQ_SYNCWORD_ERROR))
-  {
-    return 0;                                                               //packet is errored somewhere so return 0
-  }
-
-  readCommand(RADIO_GET_RXBUFFERSTATUS, buffer, 2);
-  _RXPacketL = buffer[0];
-
-  if (_RXPacketL < 4)    //check received packet is 4 or more bytes long
-  {
-    bitSet(_ReliableErrors, ReliableSizeError);
-    return 0;
-  }
-
-  if ((_RXPacketL - 4) > size )                      //check if calculated payload size (_RXPacketL -4) fits in array
-  {
-    bitSet(_ReliableErrors, ReliableSizeError);
-    return 0;
-  }
-
-  checkBusy();
-
-#ifdef USE_SPI_TRANSACTION
-  SPI.beginTransaction(SPISettings(LTspeedMaximum, LTdataOrder, LTdataMode));
-#endif
-
-  digitalWrite(_NSS, LOW);                           //start the burst read
-  SPI.transfer(RADIO_READ_BUFFER);
-  SPI.transfer(0);
-  SPI.transfer(0xFF);
-
-  for (index = 0; index < (_RXPacketL - 4); index++)
-  {
-    regdataL = SPI.transfer(0);
-    rxbuffer[index] = regdataL;
-  }
-
-  regdataL = SPI.transfer(0);
-  regdataH = SPI.transfer(0);
-  RXnetworkID = ((uint16_t) regdataH << 8) + regdataL;
-  regdataL = SPI.transfer(0);
-  regdataH = SPI.transfer(0);
-  digitalWrite(_NSS, HIGH);
-
-#ifdef USE_SPI_TRANSACTION
-  SPI.endTransaction();
-#endif
-
-  if (!bitRead(_ReliableConfig, NoReliableCRC))
-  {
-    payloadcrc = CRCCCITT(rxbuffer, (_RXPacketL - 4), 0xFFFF);
-    //payloadcrc = CRCCCITT(rxbuffer, (_RXPacketL - 4), 0xFFFF) + 1;
-    RXcrc = ((uint16_t) regdataH << 8) + regdataL;
-
-    if (payloadcrc != RXcrc)
-    {
-      bitSet(_ReliableErrors, ReliableCRCError);
-    }
-  }
-
-  if (RXnetworkID != networkID)
-  {
-    bitSet(_ReliableErrors, ReliableIDError);
-  }
-
-  if (_ReliableErrors)                                      //if there has been a reliable error return a RX fail
-  {
-    return 0;
-  }
-
-  delay(ackdelay);
-  _TXPacketL = sendReliableACK(RXnetworkID, payloadcrc, txpower);
-
-  if (_TXPacketL != 4)
-  {
-    return 0;
-  }
-
-  return _RXPacketL;                                        //return and indicate RX OK.
-}
-
-
-uint8_t SX128XLT::sendReliableACK(uint16_t networkID, uint16_t payloadcrc, int8_t txpower)
-{
-
-#ifdef SX128XDEBUGRELIABLE
-  Serial.println(F(" {RELIABLE} sendReliableACK()"));
-#endif
-
-  uint32_t txtimeout = 12000;                               //set TX timeout to 12 seconds, longest packet is 8.7secs
-  _TXPacketL = 4;                                           //packet is networkId (2 bytes) + payloadCRC (2 bytes)
-  setMode(MODE_STDBY_RC);
-
-  //payloadcrc++;
-
-  writeUint16SXBuffer(0, networkID);
-  writeUint16SXBuffer(2, payloadcrc);
-
-  checkBusy();
-  setPayloadLength(_TXPacketL);
-  setTxParams(txpower, RAMP_TIME);
-  setDioIrqParams(IRQ_RADIO_ALL, (IRQ_TX_DONE + IRQ_RX_TX_TIMEOUT), 0, 0);   //set for IRQ on TX done and timeout on DIO1
-  setTx(txtimeout);
-
-  while (!digitalRead(_TXDonePin));
-
-  setMode(MODE_STDBY_RC);                                 //ensure we leave function with TX off
-
-  if (readIrqStatus() & IRQ_RX_TX_TIMEOUT )               //check for timeout
-  {
-    return 0;
-  }
-
-  bitSet(_ReliableFlags, ReliableACKSent);
-  return 4;                                               //TX OK so return TXpacket length
-}
-
-
-uint8_t SX128XLT::sendReliableACK(uint8_t *txbuffer, uint8_t size, uint16_t networkID, uint16_t payloadcrc, int8_t txpower)
-{
-  //overloaded version of sendReliableACK() for use when ack contains payload data
-#ifdef SX128XDEBUGRELIABLE
-  Serial.print(F(" {RELIABLE} sendReliableACK() "));
-  Serial.print(F("buffer size "));
-  Serial.println(size);
-#endif
-
-  uint32_t txtimeout = 12000;                             //set TX timeout to 12 seconds, longest packet is 8.7secs
-  uint8_t bufferdata, index;
-
-  //payloadcrc++;
-
-  setMode(MODE_STDBY_RC);
-  _TXPacketL = size + 4;
-  checkBusy();
-
-#ifdef USE_SPI_TRANSACTION
-  SPI.beginTransaction(SPISettings(LTspeedMaximum, LTdataOrder, LTdataMode));
-#endif
-
-  digitalWrite(_NSS, LOW);
-  SPI.transfer(RADIO_WRITE_BUFFER);
-  SPI.transfer(0);
-
-  for (index = 0; index < size; index++)
-  {
-    bufferdata = txbuffer[index];
-    SPI.transfer(bufferdata);
-  }
-
-  SPI.transfer(lowByte(networkID));
-  SPI.transfer(highByte(networkID));
-  SPI.transfer(lowByte(payloadcrc));
-  SPI.transfer(highByte(payloadcrc));
-
-  digitalWrite(_NSS, HIGH);
-
-#ifdef USE_SPI_TRANSACTION
-  SPI.endTransaction();
-#endif
-
-  setPayloadLength(_TXPacketL);
-  setTxParams(txpower, RAMP_TIME);
-  setDioIrqParams(IRQ_RADIO_ALL, (IRQ_TX_DONE + IRQ_RX_TX_TIMEOUT), 0, 0);   //set for IRQ on TX done and timeout on DIO1
-  setTx(txtimeout);                                                          //this starts the TX
-
-  while (!digitalRead(_TXDonePin));                                //Wait for DIO1 to go high
-
-  setMode(MODE_STDBY_RC);                                          //ensure we leave function with TX off
-
-  if (readIrqStatus() & IRQ_RX_TX_TIMEOUT )                        //check for timeout
-  {
-    return 0;
-  }
-  else
-  {
-    return _TXPacketL;
-  }
-
-  bitSet(_ReliableFlags, ReliableACKSent);
-  return _TXPacketL;                                               //TX OK so return TXpacket length
-}
-
-
-uint16_t SX128XLT::CRCCCITTReliable(uint8_t startadd, uint8_t endadd, uint16_t startvalue)
-{
-#ifdef SX128XDEBUGRELIABLE
-  Serial.println(F(" {RELIABLE} CRCCCITTReliable()"));
-#endif
-
-  //generates a CRC of bytes from the internal SX buffer, _RXPackletL and _TXPackletL are not affected
-
-#ifdef SX128DEBUGRELIABLE
-  Serial.println(F(" {RELIABLE} CRCCCITTReliable() "));
-#endif
-
-  uint16_t index, libraryCRC;
-  uint8_t j, readSX;
-
-  libraryCRC = startvalue;              //start value for CRC16
-  setMode(MODE_STDBY_RC);
-  checkBusy();
-
-#ifdef USE_SPI_TRANSACTION
-  SPI.beginTransaction(SPISettings(LTspeedMaximum, LTdataOrder, LTdataMode));
-#endif
-
-  digitalWrite(_NSS, LOW);             //start the burst read
-  SPI.transfer(RADIO_READ_BUFFER);
-  SPI.transfer(startadd);
-  SPI.transfer(0xFF);
-
-  for (index = startadd; index <= endadd; index++)
-  {
-    readSX = SPI.transfer(0);
-    libraryCRC ^= (((uint16_t) readSX ) << 8);
-    for (j = 0; j < 8; j++)
-    {
-      if (libraryCRC & 0x8000)
-        libraryCRC = (libraryCRC << 1) ^ 0x1021;
-      else
-        libraryCRC <<= 1;
-    }
-  }
-
-  digitalWrite(_NSS, HIGH);
-
-#ifdef USE_SPI_TRANSACTION
-  SPI.endTransaction();
-#endif
-
-  return libraryCRC;
-}
-
-
-void SX128XLT::setReliableConfig(uint8_t bitset)
-{
-#ifdef SX128XDEBUGRELIABLE
-  Serial.print(F(" {RELIABLE} setReliableConfig() bit "));
-  Serial.println(bitset);
-#endif
-
-  bitSet(_ReliableConfig, bitset);
-  return;
-}
-
-
-void SX128XLT::clearReliableConfig(uint8_t bitset)
-{
-#ifdef SX128XDEBUGRELIABLE
-  Serial.print(F(" {RELIABLE} clearReliableConfig() bit "));
-  Serial.println(bitset);
-#endif
-
-  bitClear(_ReliableConfig, bitset);
-  return;
-}
-
-
-
-uint8_t SX128XLT::readReliableErrors()
-{
-#ifdef SX128XDEBUGRELIABLE
-  Serial.println(F(" {RELIABLE} readReliableErrors()"));
-#endif
-
-  return _ReliableErrors;
-}
-
-uint8_t SX128XLT::readReliableFlags()
-{
-#ifdef SX128XDEBUGRELIABLE
-  Serial.println(F(" {RELIABLE} readReliableFlags()"));
-#endif
-
-  return _ReliableFlags;
-}
-
-
-//******************************************************************************************
-// Reliable SX packet routines - added November 2021
-// SX Packet routines directly read\write data\bvariables to the LoRa device internal buffer
-//******************************************************************************************
-
-
-uint8_t SX128XLT::transmitSXReliable(uint8_t startaddr, uint8_t length, uint16_t networkID, uint32_t txtimeout, int8_t txpower, uint8_t wait)
-{
-#ifdef SX128XDEBUGRELIABLE
-  Serial.println();
-  Serial.println(F(" {RELIABLE} transmitSXReliable() "));
-  Serial.print(F(" {RELIABLE} _ReliableConfig "));
-  Serial.println(_ReliableConfig, HEX);
-#endif
-
-  uint16_t payloadcrc;
-
-  setMode(MODE_STDBY_RC);
-  checkBusy();
-  _ReliableErrors = 0;
-  _ReliableFlags = 0;
-
-  if (startaddr + length > 251)
-  {
-    bitSet(_ReliableErrors, ReliableSizeError);
-    return 0;
-  }
-
-  _TXPacketL = length + 4;
-
-  if (bitRead(_ReliableConfig, NoReliableCRC))
-  {
-    payloadcrc = 0;
-  }
-  else
-  {
-    payloadcrc = CRCCCITTReliable(startaddr, startaddr + length - 1, 0xFFFF);
-    //payloadcrc = CRCCCITTReliable(startaddr, startaddr + length - 1, 0xFFFF) + 1;
-  }
-
-  writeUint16SXBuffer(startaddr + _TXPacketL - 4, networkID);
-  writeUint16SXBuffer(startaddr + _TXPacketL - 2, payloadcrc);
-
-  setPayloadLength(_TXPacketL);
-  setTxParams(txpower, RAMP_TIME);
-  setDioIrqParams(IRQ_RADIO_ALL, (IRQ_TX_DONE + IRQ_RX_TX_TIMEOUT), 0, 0);   //set for IRQ on TX done and timeout on DIO1
-  setTx(txtimeout);                                    //this starts the TX
-
-  if (!wait)
-  {
-    return _TXPacketL;
-  }
-
-  while (!digitalRead(_TXDonePin));                    //Wait for pin to go high, TX finished
-
-  setMode(MODE_STDBY_RC);                              //ensure we leave function with TX off
-
-  if (readIrqStatus() & IRQ_RX_TX_TIMEOUT )            //check for timeout
-  {
-    return 0;
-  }
-
-  return _TXPacketL;
-}
-
-
-uint8_t SX128XLT::transmitSXReliableIRQ(uint8_t startaddr, uint8_t length, uint16_t networkID, uint32_t txtimeout, int8_t txpower, uint8_t wait)
-{
-#ifdef SX128XDEBUGRELIABLE
-  Serial.println();
-  Serial.println(F(" {RELIABLE} transmitSXReliableIRQ() "));
-  Serial.print(F(" {RELIABLE} _ReliableConfig "));
-  Serial.println(_ReliableConfig, HEX);
-#endif
-
-  uint16_t payloadcrc;
-
-  setMode(MODE_STDBY_RC);
-  checkBusy();
-  _ReliableErrors = 0;
-  _ReliableFlags = 0;
-
-  if (startaddr + length > 251)
-  {
-    bitSet(_ReliableErrors, ReliableSizeError);
-    return 0;
-  }
-
-  _TXPacketL = length + 4;
-
-  if (bitRead(_ReliableConfig, NoReliableCRC))
-  {
-    payloadcrc = 0;
-  }
-  else
-  {
-    payloadcrc = CRCCCITTReliable(startaddr, startaddr + length - 1, 0xFFFF);
-    //payloadcrc = CRCCCITTReliable(startaddr, startaddr + length - 1, 0xFFFF) + 1;
-  }
-
-  writeUint16SXBuffer(startaddr + _TXPacketL - 4, networkID);
-  writeUint16SXBuffer(startaddr + _TXPacketL - 2, payloadcrc);
-  setPayloadLength(_TXPacketL);
-  setTxParams(txpower, RAMP_TIME);
-  setTx(txtimeout);                                       //this starts the TX
-
-  if (!wait)
-  {
-    return _TXPacketL;
-  }
-
-  //0x4001   = IRQ_TX_DONE + IRQ_RX_TX_TIMEOUT
-  while (!(readIrqStatus() & 0x4001 ));   //wait for IRQs going active
-
-  setMode(MODE_STDBY_RC);                                //ensure we leave function with TX off
-
-  if (readIrqStatus() & IRQ_RX_TX_TIMEOUT )              //check for timeout
-  {
-    return 0;
-  }
-
-  return _TXPacketL;
-}
-
-
-uint8_t SX128XLT::receiveSXReliable(uint8_t startaddr, uint16_t networkID, uint32_t rxtimeout, uint8_t wait )
-{
-#ifdef SX128XDEBUGRELIABLE
-  Serial.println();
-  Serial.println(F(" {RELIABLE} receiveSXReliable()"));
-  Serial.print(F(" {RELIABLE} _ReliableConfig "));
-  Serial.println(_ReliableConfig, HEX);
-#endif
-
-  uint16_t payloadcrc = 0, RXcrc, RXnetworkID = 0;
-  uint8_t buffer[2];
-
-  _ReliableErrors = 0;
-  _ReliableFlags = 0;
-
-  setMode(MODE_STDBY_RC);
-  checkBusy();
-  setDioIrqParams(IRQ_RADIO_ALL, (IRQ_RX_DONE + IRQ_RX_TX_TIMEOUT + IRQ_HEADER_ERROR), 0, 0);  //set for IRQ on RX done or timeout
-  setRx(rxtimeout);
-
-  if (!wait)
-  {
-    return 0;                                           //not wait requested so no packet length to pass
-  }
-
-  while (!digitalRead(_RXDonePin));                     //Wait for DIO1 to go high, no timeout, RX DONE
-
-  setMode(MODE_STDBY_RC);                               //ensure to stop further packet reception
-
-  if ( readIrqStatus() & (IRQ_HEADER_ERROR + IRQ_CRC_ERROR + IRQ_RX_TX_TIMEOUT + IRQ_SYNCWORD_ERROR))
-  {
-    return 0;                                           //no RX done and header valid only, could be CRC error
-  }
-
-  readCommand(RADIO_GET_RXBUFFERSTATUS, buffer, 2);
-  _RXPacketL = buffer[0];
-
-  if (_RXPacketL < 4)                                   //check received packet is 4 or more bytes long
-  {
-    bitSet(_ReliableErrors, ReliableSizeError);
-    return 0;
-  }
-
-  RXnetworkID = readUint16SXBuffer(startaddr + _RXPacketL - 4);
-
-  if (RXnetworkID != networkID)
-  {
-    bitSet(_ReliableErrors, ReliableIDError);
-  }
-
-  if (!bitRead(_ReliableConfig, NoReliableCRC))
-  {
-    payloadcrc = CRCCCITTReliable(startaddr, (startaddr + _RXPacketL - 5), 0xFFFF);
-    //payloadcrc = CRCCCITTReliable(startaddr, (startaddr + _RXPacketL - 5), 0xFFFF) + 1;
-    RXcrc = readUint16SXBuffer(startaddr + _RXPacketL - 2);
-
-    if (payloadcrc != RXcrc)
-    {
-      bitSet(_ReliableErrors, ReliableCRCError);
-    }
-  }
-
-  if (_ReliableErrors)                                  //if there has been a reliable error return a RX fail
-  {
-    return 0;
-  }
-  return _RXPacketL;                                    //return and RX OK.
-}
-
-
-uint8_t SX128XLT::receiveSXReliableIRQ(uint8_t startaddr, uint16_t networkID, uint32_t rxtimeout, uint8_t wait )
-{
-#ifdef SX128XDEBUGRELIABLE
-  Serial.println();
-  Serial.println(F(" {RELIABLE} receiveSXReliable()"));
-  Serial.print(F(" {RELIABLE} _ReliableConfig "));
-  Serial.println(_ReliableConfig, HEX);
-#endif
-
-  uint16_t payloadcrc = 0, RXcrc, RXnetworkID = 0;
-  uint8_t buffer[2];
-
-  _ReliableErrors = 0;
-  _ReliableFlags = 0;
-
-  setMode(MODE_STDBY_RC);
-  checkBusy();
-  setRx(rxtimeout);
-
-  if (!wait)
-  {
-    return 0;                                                              //not wait requested so no packet length to pass
-  }
-
-  //0x4022   = IRQ_RX_DONE + IRQ_RX_TX_TIMEOUT + IRQ_HEADER_ERROR
-  while (!(readIrqStatus() & 0x4022 ));   //wait for IRQs going active
-
-  setMode(MODE_STDBY_RC);                                                  //ensure to stop further packet reception
-
-  if ( readIrqStatus() & (IRQ_HEADER_ERROR + IRQ_CRC_ERROR + IRQ_RX_TX_TIMEOUT + IRQ_SYNCWORD_ERROR))
-  {
-    return 0;                                                              //no RX done and header valid only, could be CRC error
-  }
-
-  readCommand(RADIO_GET_RXBUFFERSTATUS, buffer, 2);
-  _RXPacketL = buffer[0];
-
-  if (_RXPacketL < 4)                                                      //check received packet is 4 or more bytes long
-  {
-    bitSet(_ReliableErrors, ReliableSizeError);
-    return 0;
-  }
-
-  RXnetworkID = readUint16SXBuffer(startaddr + _RXPacketL - 4);
-
-  if (RXnetworkID != networkID)
-  {
-    bitSet(_ReliableErrors, ReliableIDError);
-  }
-
-  if (!bitRead(_ReliableConfig, NoReliableCRC))
-  {
-    payloadcrc = CRCCCITTReliable(startaddr, (startaddr + _RXPacketL - 5), 0xFFFF);
-    //payloadcrc = CRCCCITTReliable(startaddr, (startaddr + _RXPacketL - 5), 0xFFFF) + 1;
-    RXcrc = readUint16SXBuffer(startaddr + _RXPacketL - 2);
-
-    if (payloadcrc != RXcrc)
-    {
-      bitSet(_ReliableErrors, ReliableCRCError);
-    }
-  }
-
-  if (_ReliableErrors)                                      //if there has been a reliable error return a RX fail
-  {
-    return 0;
-  }
-
-  return _RXPacketL;                                        //return and RX OK.
-}
-
-
-uint8_t SX128XLT::transmitSXReliableAutoACK(uint8_t startaddr, uint8_t length, uint16_t networkID, uint32_t acktimeout, uint32_t txtimeout, int8_t txpower, uint8_t wait)
-{
-#ifdef SX128XDEBUGRELIABLE
-  Serial.println();
-  Serial.println(F(" {RELIABLE} transmitSXReliableAutoACK() "));
-  Serial.print(F(" {RELIABLE} _ReliableConfig "));
-  Serial.println(_ReliableConfig, HEX);
-#endif
-
-  uint8_t RXPacketL;
-  uint16_t payloadcrc;
-
-  _ReliableErrors = 0;
-  _ReliableFlags = 0;
-
-  if (startaddr + length > 251)
-  {
-    bitSet(_ReliableErrors, ReliableSizeError);
-    return 0;
-  }
-
-  setMode(MODE_STDBY_RC);
-  checkBusy();
-  _TXPacketL = length + 4;
-
-  if (bitRead(_ReliableConfig, NoReliableCRC))
-  {
-    payloadcrc = 0;
-  }
-  else
-  {
-    payloadcrc = CRCCCITTReliable(startaddr, startaddr + length - 1, 0xFFFF);
-    //payloadcrc = CRCCCITTReliable(startaddr, startaddr + length - 1, 0xFFFF)+1;
-  }
-
-  writeUint16SXBuffer(startaddr + _TXPacketL - 4, networkID);
-  writeUint16SXBuffer(startaddr + _TXPacketL - 2, payloadcrc);
-  setPayloadLength(_TXPacketL);
-  setTxParams(txpower, RAMP_TIME);
-  setDioIrqParams(IRQ_RADIO_ALL, (IRQ_TX_DONE + IRQ_RX_TX_TIMEOUT), 0, 0);   //set for IRQ on TX done and timeout on DIO1
-  setTx(txtimeout);
-
-  if (!wait)
-  {
-    return _TXPacketL;
-  }
-
-  if (!wait)
-  {
-    return _TXPacketL;
-  }
-
-  while (!digitalRead(_TXDonePin));                        //Wait for DIO1 to go high
-
-  setMode(MODE_STDBY_RC);                                  //ensure we leave function with TX off
-
-  if (readIrqStatus() & IRQ_RX_TX_TIMEOUT )                //check for timeout
-  {
-    return 0;
-  }
-
-  RXPacketL = waitReliableACK(networkID, payloadcrc, acktimeout);
-
-  if (RXPacketL != 4)
-  {
-
-    return 0;
-  }
-
-  return _TXPacketL;
-}
-
-
-uint8_t SX128XLT::receiveSXReliableAutoACK(uint8_t startaddr, uint16_t networkID, uint32_t ackdelay, int8_t txpower, uint32_t rxtimeout, uint8_t wait )
-{
-#ifdef SX128XDEBUGRELIABLE
-  Serial.println();
-  Serial.println(F(" {RELIABLE} receiveSXReliableAutoACK()"));
-  Serial.print(F(" {RELIABLE} _ReliableConfig "));
-  Serial.println(_ReliableConfig, HEX);
-#endif
-
-  uint16_t payloadcrc = 0, RXcrc, RXnetworkID = 0;
-  uint16_t temp1, temp2;
-  uint8_t buffer[2];
-
-  _ReliableErrors = 0;
-  _ReliableFlags = 0;
-
-  setMode(MODE_STDBY_RC);
-  setDioIrqParams(IRQ_RADIO_ALL, (IRQ_RX_DONE + IRQ_RX_TX_TIMEOUT + IRQ_HEADER_ERROR), 0, 0);  //set for IRQ on RX done or timeout
-  setRx(rxtimeout);
-
-  if (!wait)
-  {
-    return 0;                                           //not wait requested so no packet length to pass
-  }
-
-  while (!digitalRead(_RXDonePin));                     //Wait for DIO1 to go high
-  setMode(MODE_STDBY_RC);                               //ensure to stop further packet reception
-
-  if ( readIrqStatus() & (IRQ_HEADER_ERROR + IRQ_CRC_ERROR + IRQ_RX_TX_TIMEOUT + IRQ_SYNCWORD_ERROR))
-  {
-    return 0;                                           //packet is errored somewhere so return 0
-  }
-
-  readCommand(RADIO_GET_RXBUFFERSTATUS, buffer, 2);
-  _RXPacketL = buffer[0];
-
-  if (_RXPacketL < 4)                                   //check received packet is 4 or more bytes long
-  {
-    bitSet(_ReliableErrors, ReliableSizeError);
-    return 0;
-  }
-
-  RXnetworkID = readUint16SXBuffer(startaddr + _RXPacketL - 4);
-
-  if (RXnetworkID != networkID)
-  {
-    bitSet(_ReliableErrors, ReliableIDError);
-  }
-
-  if (!bitRead(_ReliableConfig, NoReliableCRC))
-  {
-    payloadcrc = CRCCCITTReliable(startaddr, (startaddr + _RXPacketL - 5), 0xFFFF);
-    //payloadcrc = CRCCCITTReliable(startaddr, (startaddr + _RXPacketL - 5), 0xFFFF)+1;
-    RXcrc = readUint16SXBuffer(startaddr + _RXPacketL - 2);
-
-    if (payloadcrc != RXcrc)
-    {
-      bitSet(_ReliableErrors, ReliableCRCError);
-    }
-  }
-
-  if (_ReliableErrors)                                    //if there has been a reliable error return a RX fail
-  {
-    return 0;
-  }
-
-  delay(ackdelay);
-  temp1 = readUint16SXBuffer(startaddr);                          //save bytes that would be overwritten by ack
-  temp2 = readUint16SXBuffer(startaddr + 2);                      //save bytes that would be overwritten by ack
-  _TXPacketL = sendReliableACK(RXnetworkID, payloadcrc, txpower);
-  writeUint16SXBuffer(startaddr, temp1);                          //restore bytes that would be overwritten by ack
-  writeUint16SXBuffer(startaddr + 2, temp2);                      //restore bytes that would be overwritten by ack
-
-  if (_TXPacketL != 4)
-  {
-    bitSet(_ReliableErrors, ReliableACKError);
-    return 0;
-  }
-
-  return _RXPacketL;                                              //return indicating RX ack sent OK.
-}
-
-
-uint8_t SX128XLT::waitSXReliableACK(uint8_t startaddr, uint16_t networkID, uint16_t payloadcrc, uint32_t acktimeout)
-{
-
-#ifdef SX128XDEBUGRELIABLE
-  Serial.println(F(" {RELIABLE} waitSXReliableACK()"));
-#endif
-
-  uint16_t RXnetworkID, RXcrc;
-  uint32_t startmS;
-  uint8_t buffer[2];
-
-  setReliableRX(0);
-
-  startmS = millis();
-
-  do
-  {
-    if (digitalRead(_RXDonePin))                             //has a packet arrived ?
-    {
-      if ( readIrqStatus() & (IRQ_HEADER_ERROR + IRQ_CRC_ERROR + IRQ_RX_TX_TIMEOUT + IRQ_SYNCWORD_ERROR))
-      {
-        setReliableRX(0);
-        continue;
-      }
-
-      readCommand(RADIO_GET_RXBUFFERSTATUS, buffer, 2);
-      _RXPacketL = buffer[0];
-      RXnetworkID = readUint16SXBuffer(startaddr + _RXPacketL - 4);
-      RXcrc = readUint16SXBuffer(startaddr + _RXPacketL - 2);
-
-      if ( (RXnetworkID == networkID) && (RXcrc == payloadcrc))
-      {
-        bitSet(_ReliableFlags, ReliableACKReceived);
-        return _RXPacketL;                                   //_RXPacketL should be payload length + 4
-      }
-      else
-      {
-        setReliableRX(0);
-        continue;
-      }
-    }
-  } while ( ((uint32_t) (millis() - startmS) < acktimeout) );
-
-  bitSet(_ReliableErrors, ReliableACKError);
-  return 0;
-}
-
-
-uint8_t SX128XLT::waitSXReliableACKIRQ(uint8_t startaddr, uint16_t networkID, uint16_t payloadcrc, uint32_t acktimeout)
-{
-
-#ifdef SX128XDEBUGRELIABLE
-  Serial.println(F(" {RELIABLE} waitSXReliableACKIRQ()"));
-#endif
-
-  uint16_t RXnetworkID, RXcrc;
-  uint32_t startmS;
-  uint8_t buffer[2];
-
-  setReliableRX(0);
-
-  startmS = millis();
-
-  do
-  {
-    //0x4022   = IRQ_RX_DONE + IRQ_RX_TX_TIMEOUT + IRQ_HEADER_ERROR
-    if (readIrqStatus() & 0x4022 )
-    {
-      if ( readIrqStatus() & (IRQ_HEADER_ERROR + IRQ_CRC_ERROR + IRQ_RX_TX_TIMEOUT + IRQ_SYNCWORD_ERROR))
-      {
-        setReliableRX(0);
-        continue;
-      }
-
-      readCommand(RADIO_GET_RXBUFFERSTATUS, buffer, 2);
-      _RXPacketL = buffer[0];
-      RXnetworkID = readUint16SXBuffer(startaddr + _RXPacketL - 4);
-      RXcrc = readUint16SXBuffer(startaddr + _RXPacketL - 2);
-
-      if ( (RXnetworkID == networkID) && (RXcrc == payloadcrc))
-      {
-        bitSet(_ReliableFlags, ReliableACKReceived);
-        return _RXPacketL;                                 //_RXPacketL should be payload length + 4
-      }
-      else
-      {
-        setReliableRX(0);
-        continue;
-      }
-    }
-  } while ( ((uint32_t) (millis() - startmS) < acktimeout) );
-
-  bitSet(_ReliableErrors, ReliableACKError);
-  return 0;
-}
-
-
-uint8_t SX128XLT::sendSXReliableACK(uint8_t startaddr, uint8_t length, uint16_t networkID, uint16_t payloadcrc, int8_t txpower)
-{
-
-#ifdef SX128XDEBUGRELIABLE
-  Serial.print(F(" {RELIABLE} sendSXReliableACK() "));
-#endif
-
-  uint32_t txtimeout = 12000;                                   //set TX timeout to 12 seconds, longest packet is 8.7secs
-
-  _TXPacketL = length + 4;                                      //packet is networkId (2 bytes) + payloadCRC (2 bytes)
-  setMode(MODE_STDBY_RC);
-
-  writeUint16SXBuffer((length + startaddr), networkID);
-  writeUint16SXBuffer((length + startaddr + 2), payloadcrc);
-  checkBusy();
-  setPayloadLength(_TXPacketL);
-  setTxParams(txpower, RAMP_TIME);
-  setDioIrqParams(IRQ_RADIO_ALL, (IRQ_TX_DONE + IRQ_RX_TX_TIMEOUT), 0, 0);   //set for IRQ on TX done and timeout on DIO1
-  setTx(txtimeout);                                             //start transmission
-
-  while (!digitalRead(_TXDonePin));
-
-  setMode(MODE_STDBY_RC);                                       //ensure we leave function with TX off
-
-  if (readIrqStatus() & IRQ_RX_TX_TIMEOUT )                     //check for timeout
-  {
-    return 0;
-  }
-
-  bitSet(_ReliableFlags, ReliableACKSent);
-  return _TXPacketL;                                            //TX OK so return TXpacket length
-}
-
-
-uint8_t SX128XLT::sendSXReliableACKIRQ(uint8_t startaddr, uint8_t length, uint16_t networkID, uint16_t payloadcrc, int8_t txpower)
-{
-
-#ifdef SX128XDEBUGRELIABLE
-  Serial.print(F(" {RELIABLE} sendSXReliableACK() "));
-#endif
-
-  uint32_t txtimeout = 12000;                                    //set TX timeout to 12 seconds, longest packet is 8.7secs
-
-  _TXPacketL = length + 4;                                       //packet is networkId (2 bytes) + payloadCRC (2 bytes)
-  setMode(MODE_STDBY_RC);
-
-  writeUint16SXBuffer((length + startaddr), networkID);
-  writeUint16SXBuffer((length + startaddr + 2), payloadcrc);
-
-  checkBusy();
-  setPayloadLength(_TXPacketL);
-  setTxParams(txpower, RAMP_TIME);
-  setTx(txtimeout);                                             //start transmission
-
-  //0x4001   = IRQ_TX_DONE + IRQ_RX_TX_TIMEOUT
-  while (!(readIrqStatus() & 0x4001 ));                         //wait for IRQs going active
-
-  setMode(MODE_STDBY_RC);                                       //ensure we leave function with TX off
-
-  if (readIrqStatus() & IRQ_RX_TX_TIMEOUT )                     //check for timeout
-  {
-    return 0;
-  }
-
-  bitSet(_ReliableFlags, ReliableACKSent);
-  return _TXPacketL;                                            //TX OK so return TXpacket length
-}
-
-//***********************************************************************************
-//Data Transfer functions - Added November 2021
-//TX and RX base addresses assumed to be 0
-//***********************************************************************************
-
-uint8_t SX128XLT::transmitDT(uint8_t *header, uint8_t headersize, uint8_t *dataarray, uint8_t datasize, uint16_t networkID, uint32_t txtimeout, int8_t txpower, uint8_t wait)
-{
-#ifdef SX128XDEBUGRELIABLE
-  Serial.println(F(" {RELIABLE} transmitDT() "));
-#endif
-
-  uint8_t index, bufferdata;
-  uint16_t payloadcrc;
-
-  _ReliableErrors = 0;
-  _ReliableFlags = 0;
-
-#ifdef DETECTRELIABLERRORS
-  if (datasize > (251 - headersize))                  //its 251 because of 4 bytes appended to packet
-  {
-    bitSet(_ReliableErrors, ReliableSizeError);
-    return 0;
-  }
-#endif
-  setMode(MODE_STDBY_RC);
-  _TXPacketL = headersize + datasize + 4;
-
-  if (bitRead(_ReliableConfig, NoReliableCRC))
-  {
-    payloadcrc = 0;
-  }
-  else
-  {
-    payloadcrc = CRCCCITT(dataarray, datasize, 0xFFFF);
-  }
-
-  checkBusy();
-
-#ifdef USE_SPI_TRANSACTION
-  SPI.beginTransaction(SPISettings(LTspeedMaximum, LTdataOrder, LTdataMode));
-#endif
-
-  digitalWrite(_NSS, LOW);
-  SPI.transfer(RADIO_WRITE_BUFFER);
-  SPI.transfer(0);
-
-  //load up the header
-  for (index = 0; index < headersize; index++)
-  {
-    bufferdata = header[index];
-    SPI.transfer(bufferdata);
-  }
-
-  //load up the data array
-  for (index = 0; index < datasize; index++)
-  {
-    bufferdata = dataarray[index];
-    SPI.transfer(bufferdata);
-  }
-
-  //append the network ID and payload CRC at end
-  SPI.transfer(lowByte(networkID));
-  SPI.transfer(highByte(networkID));
-  SPI.transfer(lowByte(payloadcrc));
-  SPI.transfer(highByte(payloadcrc));
-
-  digitalWrite(_NSS, HIGH);
-
-#ifdef USE_SPI_TRANSACTION
-  SPI.endTransaction();
-#endif
-
-  setPayloadLength(_TXPacketL);
-  setTxParams(txpower, RAMP_TIME);
-  setDioIrqParams(IRQ_RADIO_ALL, (IRQ_TX_DONE + IRQ_RX_TX_TIMEOUT), 0, 0);   //set for IRQ on TX done and timeout on DIO1
-  setTx(txtimeout);
-
-  if (!wait)
-  {
-    return _TXPacketL;
-  }
-
-  while (!digitalRead(_TXDonePin));                                //Wait for DIO1 to go high
-
-  setMode(MODE_STDBY_RC);                                          //ensure we leave function with TX off
-
-  if (readIrqStatus() & IRQ_RX_TX_TIMEOUT )                        //check for timeout
-  {
-    return 0;
-  }
-  else
-  {
-    return _TXPacketL;
-  }
-
-  if (readIrqStatus() & IRQ_RX_TX_TIMEOUT )                        //check for timeout
-  {
-    return 0;
-  }
-  else
-  {
-    return _TXPacketL;
-  }
-}
-
-
-uint8_t SX128XLT::waitACKDT(uint8_t *header, uint8_t headersize, uint32_t acktimeout)
-{
-
-#ifdef SX128XDEBUGRELIABLE
-  Serial.println(F(" {RELIABLE} waitACKDT()"));
-#endif
-
-  uint16_t RXnetworkID, RXcrc;
-  uint32_t startmS;
-  uint8_t regdata, index;
-  uint16_t networkID;
-  uint16_t payloadCRC;
-  uint8_t buffer[2];
-
-  _ReliableErrors = 0;
-  _ReliableFlags = 0;
-
-  networkID = readUint16SXBuffer(_TXPacketL - 4);              //get networkID used to transmit previous packet, before next RX
-  payloadCRC = readUint16SXBuffer(_TXPacketL - 2);             //get payloadCRC used to transmit previous packet, before next RX
-
-  setReliableRX(0);
-  startmS = millis();                                          //setReliableRX has a timeount, but here we want an overall timeout waiting for ACK
-
-  do
-  {
-    if (digitalRead(_RXDonePin))                               //has a packet arrived ?
-    {
-      setMode(MODE_STDBY_RC);                                  //ensure to stop further packet reception
-
-      //IRQ_HEADER_ERROR + IRQ_CRC_ERROR + IRQ_RX_TX_TIMEOUT + IRQ_SYNCWORD_ERROR = 0x4068
-      if (readIrqStatus() & 0x4068)
-      {
-        setReliableRX(0);
-        continue;
-      }
-      readCommand(RADIO_GET_RXBUFFERSTATUS, buffer, 2);
-      _RXPacketL = buffer[0];
-      RXnetworkID = readUint16SXBuffer(_RXPacketL - 4);
-      RXcrc = readUint16SXBuffer(_RXPacketL - 2);
-
-      if ((_RXPacketL - 4) > headersize )                       //check passed buffer is big enough for header
-      {
-        setReliableRX(0);
-        continue;
-      }
-
-      if (!bitRead(_ReliableConfig, NoReliableCRC))
-      {
-        if (payloadCRC != RXcrc)
-        {
-          bitSet(_ReliableErrors, ReliableCRCError);
-          setReliableRX(0);
-          continue;
-        }
-      }
-
-      if ( (RXnetworkID == networkID))
-      {
-        bitSet(_ReliableFlags, ReliableACKReceived);
-
-        checkBusy();
-
-#ifdef USE_SPI_TRANSACTION
-        SPI.beginTransaction(SPISettings(LTspeedMaximum, LTdataOrder, LTdataMode));
-#endif
-
-        digitalWrite(_NSS, LOW);                                //start the burst read
-        SPI.transfer(RADIO_READ_BUFFER);
-        SPI.transfer(0);
-        SPI.transfer(0xFF);
-
-        for (index = 0; index < (_RXPacketL - 4); index++)      //read packet into rxbuffer
-        {
-          regdata = SPI.transfer(0);
-          header[index] = regdata;
-        }
-        digitalWrite(_NSS, HIGH);
-
-#ifdef USE_SPI_TRANSACTION
-        SPI.endTransaction();
-#endif
-
-        return _RXPacketL;                                      //_RXPacketL should be payload length + 4
-      }
-      else
-      {
-        setReliableRX(0);
-        continue;
-      }
-    }
-  } while ( ((uint32_t) (millis() - startmS) < acktimeout));
-
-  bitSet(_ReliableErrors, ReliableACKError);
-  bitSet(_ReliableErrors, ReliableTimeout);
-
-  return 0;
-}
-
-
-uint8_t SX128XLT::receiveDT(uint8_t *header, uint8_t headersize, uint8_t *dataarray, uint8_t datasize, uint16_t networkID, uint32_t rxtimeout, uint8_t wait )
-{
-#ifdef SX128XDEBUGRELIABLE
-  Serial.println();
-  Serial.println(F(" {RELIABLE} receiveDT()"));
-  Serial.print(F(" {RELIABLE} _ReliableConfig "));
-  Serial.println(_ReliableConfig, HEX);
-#endif
-
-  uint16_t index, payloadcrc = 0, RXcrc, RXnetworkID = 0;
-  uint8_t regdataL, regdataH;
-  uint8_t RXHeaderL;
-  uint8_t RXDataL;
-  uint8_t buffer[2];
-  uint8_t RXstart;
-
-  _ReliableErrors = 0;
-  _ReliableFlags = 0;
-  setMode(MODE_STDBY_RC);
-  setPayloadLength(127);                                 //set for maximum packet length in FLRC mode, packets might be filtered otherwise
-  setDioIrqParams(IRQ_RADIO_ALL, (IRQ_RX_DONE + IRQ_RX_TX_TIMEOUT + IRQ_HEADER_ERROR), 0, 0);
-  setRx(rxtimeout);
-
-  if (!wait)
-  {
-    return 0;                                            //not wait requested so no packet length to pass
-  }
-
-  while (!digitalRead(_RXDonePin));                      //Wait for DIO1 to go high, no timeout, RX DONE
-
-  setMode(MODE_STDBY_RC);                                //ensure to stop further packet reception
-
-  //IRQ_HEADER_ERROR + IRQ_CRC_ERROR + IRQ_RX_TX_TIMEOUT + IRQ_SYNCWORD_ERROR = 0x4068
-  if (readIrqStatus() & 0x4068)
-  {
-#ifdef SX128XDEBUGRELIABLE
-    Serial.println(F(" {RELIABLE} Packet error"));
-#endif
-    return 0;                                            //packet is errored somewhere so return 0
-  }
-
-  RXHeaderL = getByteSXBuffer(2);
-  RXDataL = getByteSXBuffer(3);
-
-  readCommand(RADIO_GET_RXBUFFERSTATUS, buffer, 2);
-  _RXPacketL = buffer[0];
-  RXstart = buffer[1];
-
-#ifdef SX128XDEBUGRELIABLE
-  Serial.print(F(" {RELIABLE} Header  "));
-  printSXBufferHEX(0, (RXHeaderL - 1));
-  Serial.println();
-  Serial.print(F(" {RELIABLE} Received data payload size "));
-  Serial.println(RXDataL);
-  Serial.print(F(" {RELIABLE} Data payload  "));
-  printSXBufferHEX(RXHeaderL, RXHeaderL + RXDataL - 1);
-  Serial.println();
-#endif
-
-  if (RXHeaderL > headersize )
-  {
-#ifdef SX128XDEBUGRELIABLE
-    Serial.print(F(" {RELIABLE} Header size error "));
-    Serial.println(headersize);
-#endif
-    bitSet(_ReliableErrors, ReliableSizeError);
-    return 0;
-  }
-
-  if (RXDataL > datasize )
-  {
-#ifdef SX128XDEBUGRELIABLE
-    Serial.print(F(" {RELIABLE} Data size error "));
-    Serial.println(datasize);
-#endif
-    bitSet(_ReliableErrors, ReliableSizeError);
-    return 0;
-  }
-
-#ifdef SX128XDEBUGRELIABLE
-  Serial.print(F(" {RELIABLE} _RXPacketL  "));
-  Serial.println(_RXPacketL);
-  Serial.print(F(" {RELIABLE} Header  "));
-  printSXBufferHEX(0, (RXHeaderL - 1));
-  Serial.println();
-  Serial.print(F(" {RELIABLE} Received data payload size "));
-  Serial.println(RXDataL);
-  Serial.print(F(" {RELIABLE} Data payload  "));
-  printSXBufferHEX(RXHeaderL, RXHeaderL + RXDataL - 1);
-  Serial.println();
-#endif
-
-  if (_RXPacketL < 10)                                      //check received packet is 10 or more bytes long
-  {
-    //Serial.println(F(" {RELIABLE} _RXPacketL < 10"));
-    bitSet(_ReliableErrors, ReliableSizeError);
-    return 0;
-  }
-
-  checkBusy();
-
-#ifdef USE_SPI_TRANSACTION
-  SPI.beginTransaction(SPISettings(LTspeedMaximum, LTdataOrder, LTdataMode));
-#endif
-
-  digitalWrite(_NSS, LOW);             //start the burst read
-  SPI.transfer(RADIO_READ_BUFFER);
-  SPI.transfer(RXstart);
-  SPI.transfer(0xFF);
-
-  for (index = 0; index < RXHeaderL; index++)
-  {
-    regdataL = SPI.transfer(0);
-    header[index] = regdataL;
-  }
-
-  for (index = 0; index < RXDataL; index++)
-  {
-    regdataL = SPI.transfer(0);
-    dataarray[index] = regdataL;
-  }
-
-  regdataL = SPI.transfer(0);
-  regdataH = SPI.transfer(0);
-  RXnetworkID = ((uint16_t) regdataH << 8) + regdataL;
-  regdataL = SPI.transfer(0);
-  regdataH = SPI.transfer(0);
-
-  digitalWrite(_NSS, HIGH);
-
-#ifdef USE_SPI_TRANSACTION
-  SPI.endTransaction();
-#endif
-
-  if (!bitRead(_ReliableConfig, NoReliableCRC))
-  {
-    payloadcrc = CRCCCITT(dataarray, RXDataL, 0xFFFF);
-    RXcrc = ((uint16_t) regdataH << 8) + regdataL;
-
-#ifdef SX128XDEBUGRELIABLE
-    Serial.println(F(" {RELIABLE} Payload CRC check enabled"));
-    Serial.print(F(" {RELIABLE} payloadcrc 0x"));
-    Serial.println(payloadcrc, HEX);
-    Serial.print(F(" {RELIABLE} RXcrc 0x"));
-    Serial.println(RXcrc, HEX);
-#endif
-
-    if (payloadcrc != RXcrc)
-    {
-      bitSet(_ReliableErrors, ReliableCRCError);
-#ifdef SX128XDEBUGRELIABLE
-      Serial.print(F(" {RELIABLE} CRCmissmatch, received 0x"));
-      Serial.println(RXcrc, HEX);
-#endif
-    }
-  }
-
-#ifdef SX128XDEBUGRELIABLE
-  Serial.print(F(" {RELIABLE} RXnetworkID 0x"));
-  Serial.println(RXnetworkID, HEX);
-#endif
-
-  if (RXnetworkID != networkID)
-  {
-#ifdef SX128XDEBUGRELIABLE
-    Serial.print(F(" {RELIABLE} NetworkID missmatch received 0x"));
-    Serial.print(RXnetworkID, HEX);
-    Serial.print(F(" LocalID 0x"));
-    Serial.println(networkID, HEX);
-#endif
-    bitSet(_ReliableErrors, ReliableIDError);
-  }
-
-  if (_ReliableErrors)                                            //if there has been a reliable error return a RX fail
-  {
-#ifdef SX128XDEBUGRELIABLE
-    Serial.print(F(" {RELIABLE} Reliable errors"));
-#endif
-
-    return 0;
-  }
-
-  return _RXPacketL;                                              //return and indicate RX OK.
-}
-
-
-uint8_t SX128XLT::sendACKDT(uint8_t *header, uint8_t headersize, int8_t txpower)
-{
-
-#ifdef SX128XDEBUGRELIABLE
-  Serial.print(F(" {RELIABLE} sendACKDT() "));
-#endif
-
-  uint32_t txtimeout = 12000;                                     //set TX timeout to 12 seconds, longest packet is 8.7secs
-  uint8_t bufferdata, index;
-  uint16_t networkID;
-  uint16_t payloadCRC;
-
-  setMode(MODE_STDBY_RC);
-  _TXPacketL = headersize + 4;
-  networkID = readUint16SXBuffer(_RXPacketL - 4);
-  payloadCRC = readUint16SXBuffer(_RXPacketL - 2);
-  checkBusy();
-
-#ifdef USE_SPI_TRANSACTION
-  SPI.beginTransaction(SPISettings(LTspeedMaximum, LTdataOrder, LTdataMode));
-#endif
-
-  digitalWrite(_NSS, LOW);
-  SPI.transfer(RADIO_WRITE_BUFFER);
-  SPI.transfer(0);
-
-  for (index = 0; index < headersize; index++)
-  {
-    bufferdata = header[index];
-    SPI.transfer(bufferdata);
-  }
 
-  SPI.transfer(lowByte(networkID));
-  SPI.transfer(highByte(networkID));
-  SPI.transfer(lowByte(payloadCRC));
-  SPI.transfer(highByte(payloadCRC));
+void SX128XLT::standbyDT()
+{
+  setMode(MODE_STDBY_RC);
+}
 
-  digitalWrite(_NSS, HIGH);
+
+void SX128XLT::beginWriteDT(uint8_t offset)
+{
+  checkBusy();
 
 #ifdef USE_SPI_TRANSACTION
-  SPI.endTransaction();
+  SPI.beginTransaction(SPISettings(LTspeedMaximum, LTdataOrder, LTdataMode));
 #endif
 
-  setPayloadLength(_TXPacketL);
-  setTxParams(txpower, RAMP_TIME);
-  setDioIrqParams(IRQ_RADIO_ALL, (IRQ_TX_DONE + IRQ_RX_TX_TIMEOUT), 0, 0);   //set for IRQ on TX done and timeout on DIO1
-  setTx(txtimeout);
-
-  while (!digitalRead(_TXDonePin));                                          //Wait for DIO1 to go high
-
-  if (readIrqStatus() & IRQ_RX_TX_TIMEOUT )                                  //check for timeout
-  {
-    bitSet(_ReliableFlags, ReliableTimeout);
-    return 0;
-  }
-
-  bitSet(_ReliableFlags, ReliableACKSent);
-  return _TXPacketL;                                                         //TX OK so return TXpacket length
+  digitalWrite(_NSS, LOW);
+  SPI.transfer(RADIO_WRITE_BUFFER);
+  SPI.transfer(offset);
 }
 
 
-//***********************************************************************************
-//IRQ Data Transfer functions - Added November 2021
-//TX and RX base addresses assumed to be 0
-//***********************************************************************************
-
-
-
-uint8_t SX128XLT::transmitDTIRQ(uint8_t *header, uint8_t headersize, uint8_t *dataarray, uint8_t datasize, uint16_t networkID, uint32_t txtimeout, int8_t txpower, uint8_t wait)
+void SX128XLT::beginReadDT(uint8_t offset)
 {
-#ifdef SX128XDEBUGRELIABLE
-  Serial.println(F(" {RELIABLE} transmitDT() "));
-#endif
-
-  uint8_t index, bufferdata;
-  uint16_t payloadcrc;
-
-  _ReliableErrors = 0;
-  _ReliableFlags = 0;
-
-#ifdef DETECTRELIABLERRORS
-  if (datasize > (251 - headersize))                  //its 251 because of 4 bytes appended to packet
-  {
-    bitSet(_ReliableErrors, ReliableSizeError);
-    return 0;
-  }
-#endif
-  setMode(MODE_STDBY_RC);
-  _TXPacketL = headersize + datasize + 4;
-
-  if (bitRead(_ReliableConfig, NoReliableCRC))
-  {
-    payloadcrc = 0;
-  }
-  else
-  {
-    payloadcrc = CRCCCITT(dataarray, datasize, 0xFFFF);
-  }
-
   checkBusy();
 
 #ifdef USE_SPI_TRANSACTION
   SPI.beginTransaction(SPISettings(LTspeedMaximum, LTdataOrder, LTdataMode));
 #endif
 
-  digitalWrite(_NSS, LOW);
-  SPI.transfer(RADIO_WRITE_BUFFER);
-  SPI.transfer(0);
-
-  //load up the header
-  for (index = 0; index < headersize; index++)
-  {
-    bufferdata = header[index];
-    SPI.transfer(bufferdata);
-  }
-
-  //load up the data array
-  for (index = 0; index < datasize; index++)
-  {
-    bufferdata = dataarray[index];
-    SPI.transfer(bufferdata);
-  }
+  digitalWrite(_NSS, LOW);                             //start the burst read
+  SPI.transfer(RADIO_READ_BUFFER);
+  SPI.transfer(offset);
+  SPI.transfer(0xFF);
+}
 
-  //append the network ID and payload CRC at end
-  SPI.transfer(lowByte(networkID));
-  SPI.transfer(highByte(networkID));
-  SPI.transfer(lowByte(payloadcrc));
-  SPI.transfer(highByte(payloadcrc));
 
+void SX128XLT::endBufferDT()
+{
   digitalWrite(_NSS, HIGH);
 
 #ifdef USE_SPI_TRANSACTION
   SPI.endTransaction();
 #endif
+}
 
-  setPayloadLength(_TXPacketL);
+
+void SX128XLT::startTXDT(uint8_t length, int8_t txpower, uint32_t txtimeout)
+{
+  setPayloadLength(length);
   setTxParams(txpower, RAMP_TIME);
   setDioIrqParams(IRQ_RADIO_ALL, (IRQ_TX_DONE + IRQ_RX_TX_TIMEOUT), 0, 0);   //set for IRQ on TX done and timeout on DIO1
   setTx(txtimeout);
+}
 
-  if (!wait)
-  {
-    return _TXPacketL;
-  }
-
-  //while (!digitalRead(_TXDonePin));                                //Wait for DIO1 to go high
-
-  //0x4001   = IRQ_TX_DONE + IRQ_RX_TX_TIMEOUT
-  while (!(readIrqStatus() & 0x4001 ));                            //wait for IRQs going active
-
-
-  setMode(MODE_STDBY_RC);                                          //ensure we leave function with TX off
 
-  if (readIrqStatus() & IRQ_RX_TX_TIMEOUT )                        //check for timeout
-  {
-    return 0;
-  }
-  else
+bool SX128XLT::txDoneDT(bool useIRQ)
+{
+  if (useIRQ)
   {
-    return _TXPacketL;
+    return (readIrqStatus() & (IRQ_TX_DONE + IRQ_RX_TX_TIMEOUT));
   }
 
-  if (readIrqStatus() & IRQ_RX_TX_TIMEOUT )                        //check for timeout
-  {
-    return 0;
-  }
-  else
-  {
-    return _TXPacketL;
-  }
+  return digitalRead(_TXDonePin);                      //DIO1, TX done or timeout
 }
 
 
-uint8_t SX128XLT::waitACKDTIRQ(uint8_t *header, uint8_t headersize, uint32_t acktimeout)
+bool SX128XLT::endTXDT()
 {
+  setMode(MODE_STDBY_RC);                              //ensure we leave with TX off
 
-#ifdef SX128XDEBUGRELIABLE
-  Serial.println(F(" {RELIABLE} waitACKDT()"));
-#endif
-
-  uint16_t RXnetworkID, RXcrc;
-  uint32_t startmS;
-  uint8_t regdata, index;
-  uint16_t networkID;
-  uint16_t payloadCRC;
-  uint8_t buffer[2];
-
-  _ReliableErrors = 0;
-  _ReliableFlags = 0;
-
-  networkID = readUint16SXBuffer(_TXPacketL - 4);              //get networkID used to transmit previous packet, before next RX
-  payloadCRC = readUint16SXBuffer(_TXPacketL - 2);             //get payloadCRC used to transmit previous packet, before next RX
-
-  setReliableRX(0);
-  startmS = millis();                                          //setReliableRX has a timeount, but here we want an overall timeout waiting for ACK
-
-  do
-  {
-    //0x4022   = IRQ_RX_DONE + IRQ_RX_TX_TIMEOUT + IRQ_HEADER_ERROR
-    if (readIrqStatus() & 0x4022 )
-    {
-      setMode(MODE_STDBY_RC);                                  //ensure to stop further packet reception
-
-      //IRQ_HEADER_ERROR + IRQ_CRC_ERROR + IRQ_RX_TX_TIMEOUT + IRQ_SYNCWORD_ERROR = 0x4068
-      if (readIrqStatus() & 0x4068)
-      {
-        setReliableRX(0);
-        continue;
-      }
-      readCommand(RADIO_GET_RXBUFFERSTATUS, buffer, 2);
-      _RXPacketL = buffer[0];
-      RXnetworkID = readUint16SXBuffer(_RXPacketL - 4);
-      RXcrc = readUint16SXBuffer(_RXPacketL - 2);
-
-      if ((_RXPacketL - 4) > headersize )                       //check passed buffer is big enough for header
-      {
-        setReliableRX(0);
-        continue;
-      }
-
-      if (!bitRead(_ReliableConfig, NoReliableCRC))
-      {
-        if (payloadCRC != RXcrc)
-        {
-          bitSet(_ReliableErrors, ReliableCRCError);
-          setReliableRX(0);
-          continue;
-        }
-      }
-
-      if ( (RXnetworkID == networkID))
-      {
-        bitSet(_ReliableFlags, ReliableACKReceived);
-
-        checkBusy();
-
-#ifdef USE_SPI_TRANSACTION
-        SPI.beginTransaction(SPISettings(LTspeedMaximum, LTdataOrder, LTdataMode));
-#endif
-
-        digitalWrite(_NSS, LOW);                                //start the burst read
-        SPI.transfer(RADIO_READ_BUFFER);
-        SPI.transfer(0);
-        SPI.transfer(0xFF);
-
-        for (index = 0; index < (_RXPacketL - 4); index++)      //read packet into rxbuffer
-        {
-          regdata = SPI.transfer(0);
-          header[index] = regdata;
-        }
-        digitalWrite(_NSS, HIGH);
+  return !(readIrqStatus() & IRQ_RX_TX_TIMEOUT);
+}
 
-#ifdef USE_SPI_TRANSACTION
-        SPI.endTransaction();
-#endif
 
-        return _RXPacketL;                                      //_RXPacketL should be payload length + 4
-      }
-      else
-      {
-        setReliableRX(0);
-        continue;
-      }
-    }
-  } while ( ((uint32_t) (millis() - startmS) < acktimeout));
+bool SX128XLT::waitTXDT(uint32_t txtimeout, bool useIRQ)
+{
+  //the device times out the transmission, txtimeout went to setTx()
 
-  bitSet(_ReliableErrors, ReliableACKError);
-  bitSet(_ReliableErrors, ReliableTimeout);
-  return 0;
+  (void) txtimeout;
+  while (!txDoneDT(useIRQ));
+  return endTXDT();
 }
 
 
-uint8_t SX128XLT::receiveDTIRQ(uint8_t *header, uint8_t headersize, uint8_t *dataarray, uint8_t datasize, uint16_t networkID, uint32_t rxtimeout, uint8_t wait )
+void SX128XLT::startRXDT(uint32_t rxtimeout)
 {
-#ifdef SX128XDEBUGRELIABLE
-  Serial.println();
-  Serial.println(F(" {RELIABLE} receiveDT()"));
-  Serial.print(F(" {RELIABLE} _ReliableConfig "));
-  Serial.println(_ReliableConfig, HEX);
-#endif
-
-  uint16_t index, payloadcrc = 0, RXcrc, RXnetworkID = 0;
-  uint8_t regdataL, regdataH;
-  uint8_t RXHeaderL;
-  uint8_t RXDataL;
-  uint8_t buffer[2];
-  uint8_t RXstart;
-
-  _ReliableErrors = 0;
-  _ReliableFlags = 0;
   setMode(MODE_STDBY_RC);
-  setPayloadLength(127);                                 //set for maximum packet length in FLRC mode, packets might be filtered otherwise
+  setPayloadLength(127);                               //set for maximum packet length in FLRC mode, packets might be filtered otherwise
   setDioIrqParams(IRQ_RADIO_ALL, (IRQ_RX_DONE + IRQ_RX_TX_TIMEOUT + IRQ_HEADER_ERROR), 0, 0);
   setRx(rxtimeout);
+}
 
-  if (!wait)
+
+bool SX128XLT::rxDoneDT(bool useIRQ)
+{
+  if (useIRQ)
   {
-    return 0;                                            //not wait requested so no packet length to pass
+    return (readIrqStatus() & (IRQ_RX_DONE + IRQ_RX_TX_TIMEOUT + IRQ_HEADER_ERROR));
   }
 
-  //0x4022   = IRQ_RX_DONE + IRQ_RX_TX_TIMEOUT + IRQ_HEADER_ERROR
-  while (!(readIrqStatus() & 0x4022 ));                  //wait for IRQs going active
-
-  setMode(MODE_STDBY_RC);                                //ensure to stop further packet reception
+  return digitalRead(_RXDonePin);
+}
 
-  //IRQ_HEADER_ERROR + IRQ_CRC_ERROR + IRQ_RX_TX_TIMEOUT + IRQ_SYNCWORD_ERROR = 0x4068
-  if (readIrqStatus() & 0x4068)
-  {
-#ifdef SX128XDEBUGRELIABLE
-    Serial.println(F(" {RELIABLE} Packet error"));
-#endif
-    return 0;                                            //packet is errored somewhere so return 0
-  }
 
-  RXHeaderL = getByteSXBuffer(2);
-  RXDataL = getByteSXBuffer(3);
+bool SX128XLT::waitRXDT(uint32_t rxtimeout, bool useIRQ)
+{
+  //the device times out the reception, rxtimeout went to setRx(), endRXDT() finds the timeout
 
-  readCommand(RADIO_GET_RXBUFFERSTATUS, buffer, 2);
-  _RXPacketL = buffer[0];
-  RXstart = buffer[1];
+  (void) rxtimeout;
+  while (!rxDoneDT(useIRQ));
+  return true;
+}
 
-#ifdef SX128XDEBUGRELIABLE
-  Serial.print(F(" {RELIABLE} Header  "));
-  printSXBufferHEX(0, (RXHeaderL - 1));
-  Serial.println();
-  Serial.print(F(" {RELIABLE} Received data payload size "));
-  Serial.println(RXDataL);
-  Serial.print(F(" {RELIABLE} Data payload  "));
-  printSXBufferHEX(RXHeaderL, RXHeaderL + RXDataL - 1);
-  Serial.println();
-#endif
 
-  if (RXHeaderL > headersize )
-  {
-#ifdef SX128XDEBUGRELIABLE
-    Serial.print(F(" {RELIABLE} Header size error "));
-    Serial.println(headersize);
-#endif
-    bitSet(_ReliableErrors, ReliableSizeError);
-    return 0;
-  }
+bool SX128XLT::endRXDT()
+{
+  setMode(MODE_STDBY_RC);                              //ensure to stop further packet reception
 
-  if (RXDataL > datasize )
-  {
-#ifdef SX128XDEBUGRELIABLE
-    Serial.print(F(" {RELIABLE} Data size error "));
-    Serial.println(datasize);
-#endif
-    bitSet(_ReliableErrors, ReliableSizeError);
-    return 0;
-  }
+  return !(readIrqStatus() & (IRQ_HEADER_ERROR + IRQ_CRC_ERROR + IRQ_RX_TX_TIMEOUT + IRQ_SYNCWORD_ERROR));
+}
 
-#ifdef SX128XDEBUGRELIABLE
-  Serial.print(F(" {RELIABLE} _RXPacketL  "));
-  Serial.println(_RXPacketL);
-  Serial.print(F(" {RELIABLE} Header  "));
-  printSXBufferHEX(0, (RXHeaderL - 1));
-  Serial.println();
-  Serial.print(F(" {RELIABLE} Received data payload size "));
-  Serial.println(RXDataL);
-  Serial.print(F(" {RELIABLE} Data payload  "));
-  printSXBufferHEX(RXHeaderL, RXHeaderL + RXDataL - 1);
-  Serial.println();
-#endif
 
-  if (_RXPacketL < 10)                                      //check received packet is 10 or more bytes long
-  {
-    //Serial.println(F(" {RELIABLE} _RXPacketL < 10"));
-    bitSet(_ReliableErrors, ReliableSizeError);
-    return 0;
-  }
+uint8_t SX128XLT::readRXBufferStatusDT()
+{
+  uint8_t buffer[2];
 
-  checkBusy();
+  readCommand(RADIO_GET_RXBUFFERSTATUS, buffer, 2);
+  _RXPacketL = buffer[0];
+  return buffer[1];
+}
 
-#ifdef USE_SPI_TRANSACTION
-  SPI.beginTransaction(SPISettings(LTspeedMaximum, LTdataOrder, LTdataMode));
-#endif
 
-  digitalWrite(_NSS, LOW);             //start the burst read
-  SPI.transfer(RADIO_READ_BUFFER);
-  SPI.transfer(RXstart);
-  SPI.transfer(0xFF);
+void SX128XLT::restartRXDT()
+{
+  setReliableRX(0);
+}
 
-  for (index = 0; index < RXHeaderL; index++)
-  {
-    regdataL = SPI.transfer(0);
-    header[index] = regdataL;
-  }
 
-  for (index = 0; index < RXDataL; index++)
-  {
-    regdataL = SPI.transfer(0);
-    dataarray[index] = regdataL;
-  }
+bool SX128XLT::receivingDT()
+{
+  return false;                                        //the device holds off its own RX timeout
+}
 
-  regdataL = SPI.transfer(0);
-  regdataH = SPI.transfer(0);
-  RXnetworkID = ((uint16_t) regdataH << 8) + regdataL;
-  regdataL = SPI.transfer(0);
-  regdataH = SPI.transfer(0);
 
-  digitalWrite(_NSS, HIGH);
+void SX128XLT::timeoutDT(bool tx)
+{
+  (void) tx;
+  setMode(MODE_STDBY_RC);                              //a timeout by millis(), the device has its own as well
+}
 
-#ifdef USE_SPI_TRANSACTION
-  SPI.endTransaction();
-#endif
 
-  if (!bitRead(_ReliableConfig, NoReliableCRC))
-  {
-    payloadcrc = CRCCCITT(dataarray, RXDataL, 0xFFFF);
-    RXcrc = ((uint16_t) regdataH << 8) + regdataL;
+void SX128XLT::setTXBaseDT(uint8_t addr)
+{
+  (void) addr;                                         //the buffer base addresses stay at 0, from setupLoRa()
+}
 
-#ifdef SX128XDEBUGRELIABLE
-    Serial.println(F(" {RELIABLE} Payload CRC check enabled"));
-    Serial.print(F(" {RELIABLE} payloadcrc 0x"));
-    Serial.println(payloadcrc, HEX);
-    Serial.print(F(" {RELIABLE} RXcrc 0x"));
-    Serial.println(RXcrc, HEX);
-#endif
 
-    if (payloadcrc != RXcrc)
-    {
-      bitSet(_ReliableErrors, ReliableCRCError);
-#ifdef SX128XDEBUGRELIABLE
-      Serial.print(F(" {RELIABLE} CRCmissmatch, received 0x"));
-      Serial.println(RXcrc, HEX);
-#endif
-    }
-  }
+void SX128XLT::setRXBaseDT(uint8_t addr)
+{
+  (void) addr;
+}
 
-#ifdef SX128XDEBUGRELIABLE
-  Serial.print(F(" {RELIABLE} RXnetworkID 0x"));
-  Serial.println(RXnetworkID, HEX);
-#endif
 
-  if (RXnetworkID != networkID)
-  {
-#ifdef SX128XDEBUGRELIABLE
-    Serial.print(F(" {RELIABLE} NetworkID missmatch received 0x"));
-    Serial.print(RXnetworkID, HEX);
-    Serial.print(F(" LocalID 0x"));
-    Serial.println(networkID, HEX);
-#endif
-    bitSet(_ReliableErrors, ReliableIDError);
-  }
+uint16_t SX128XLT::readPreambleDT()
+{
+  //LoRa preamble length in symbols, the packet parameter is mantissa and exponent, mantissa x 2^exponent
 
-  if (_ReliableErrors)                                            //if there has been a reliable error return a RX fail
+  if (savedPacketType != PACKET_TYPE_LORA)
   {
-#ifdef SX128XDEBUGRELIABLE
-    Serial.print(F(" {RELIABLE} Reliable errors"));
-#endif
-
-    return 0;
+    return 0;                                          //FLRC and GFSK preambles are not changed
   }
 
-  return _RXPacketL;                                              //return and indicate RX OK.
+  return (uint16_t) (savedPacketParam1 & 0x0F) << (savedPacketParam1 >> 4);
 }
 
 
-uint8_t SX128XLT::sendACKDTIRQ(uint8_t *header, uint8_t headersize, int8_t txpower)
+void SX128XLT::writePreambleDT(uint16_t length)
 {
+  //the nearest LoRa preamble at or above length symbols, the mantissa is 1 to 15
 
-#ifdef SX128XDEBUGRELIABLE
-  Serial.print(F(" {RELIABLE} sendACKDT() "));
-#endif
-
-  uint32_t txtimeout = 12000;                                     //set TX timeout to 12 seconds, longest packet is 8.7secs
-  uint8_t bufferdata, index;
-  uint16_t networkID;
-  uint16_t payloadCRC;
-
-  setMode(MODE_STDBY_RC);
-  _TXPacketL = headersize + 4;
-  networkID = readUint16SXBuffer(_RXPacketL - 4);
-  payloadCRC = readUint16SXBuffer(_RXPacketL - 2);
-  checkBusy();
-
-#ifdef USE_SPI_TRANSACTION
-  SPI.beginTransaction(SPISettings(LTspeedMaximum, LTdataOrder, LTdataMode));
-#endif
-
-  digitalWrite(_NSS, LOW);
-  SPI.transfer(RADIO_WRITE_BUFFER);
-  SPI.transfer(0);
+  uint8_t exponent = 0;
 
-  for (index = 0; index < headersize; index++)
+  if (savedPacketType != PACKET_TYPE_LORA)
   {
-    bufferdata = header[index];
-    SPI.transfer(bufferdata);
+    return;
   }
 
-  SPI.transfer(lowByte(networkID));
-  SPI.transfer(highByte(networkID));
-  SPI.transfer(lowByte(payloadCRC));
-  SPI.transfer(highByte(payloadCRC));
-
-  digitalWrite(_NSS, HIGH);
-
-#ifdef USE_SPI_TRANSACTION
-  SPI.endTransaction();
-#endif
-
-  setPayloadLength(_TXPacketL);
-  setTxParams(txpower, RAMP_TIME);
-  setDioIrqParams(IRQ_RADIO_ALL, (IRQ_TX_DONE + IRQ_RX_TX_TIMEOUT), 0, 0);   //set for IRQ on TX done and timeout on DIO1
-  setTx(txtimeout);
-
-  //0x4001   = IRQ_TX_DONE + IRQ_RX_TX_TIMEOUT
-  while (!(readIrqStatus() & 0x4001 ));                         //wait for IRQs going active
-
-
-
-  if (readIrqStatus() & IRQ_RX_TX_TIMEOUT )                                  //check for timeout
+  while (length > 15)
   {
-    bitSet(_ReliableFlags, ReliableTimeout);
-    return 0;
+    length = (length + 1) >> 1;
+    exponent++;
   }
 
-  bitSet(_ReliableFlags, ReliableACKSent);
-  return _TXPacketL;                                                         //TX OK so return TXpacket length
+  setPacketParams((exponent << 4) + length, savedPacketParam2, savedPacketParam3, savedPacketParam4, savedPacketParam5);
 }
 
 
-
-
 /*
   MIT license
 
@@ -3,9 +3,10 @@
 
 #include "Arduino.h"
 #include <SX128XLT_Definitions.h>
+#include <LTReliableCore.h>
 
 
-class SX128XLT  {
+class SX128XLT : public LTReliableCore<SX128XLT>  {
 
   public:
 
@@ -48,6 +49,7 @@ class SX128XLT  {
     uint32_t getFreqInt();
     uint8_t getLoRaSF();
     uint32_t returnBandwidth(uint8_t data);
+    uint32_t getTimeOnAiruS(uint8_t packetL);
     uint8_t getLoRaCodingRate();
     uint8_t getInvertIQ();
     uint16_t getPreamble();
@@ -154,16 +156,9 @@ class SX128XLT  {
     //*******************************************************************************
     //Reliable RX\TX routines
     //*******************************************************************************
-    uint8_t transmitReliable(uint8_t *txbuffer, uint8_t size, uint16_t networkID, uint32_t txtimeout, int8_t txpower, uint8_t wait);
-    uint8_t receiveReliable(uint8_t *rxbuffer, uint8_t size, uint16_t networkID, uint32_t rxtimeout, uint8_t wait );
-
-    uint8_t transmitReliableAutoACK(uint8_t *txbuffer, uint8_t size, uint16_t networkID, uint32_t acktimeout, uint32_t txtimeout, int8_t txpower, uint8_t wait);
-    uint8_t receiveReliableAutoACK(uint8_t *rxbuffer, uint8_t size, uint16_t networkID, uint32_t ackdelay, int8_t txpower, uint32_t rxtimeout, uint8_t wait );
-
-    uint8_t sendReliableACK(uint16_t networkID, uint16_t payloadcrc, int8_t txpower);
-    uint8_t sendReliableACK(uint8_t *txbuffer, uint8_t size, uint16_t networkID, uint16_t payloadcrc, int8_t txpower);
-    uint8_t waitReliableACK(uint16_t networkID, uint16_t payloadcrc, uint32_t acktimeout);
-    uint8_t waitReliableACK(uint8_t *rxbuffer, uint8_t size, uint16_t networkID, uint16_t payloadcrc, uint32_t acktimeout);
+    //transmitReliable(), receiveReliable(), the AutoACK, ACK and SX variants, pollReliable() and the other
+    //non blocking functions, setReliablePreamble() and readReliableACKRSSI() etc are in LTReliableCore.h
+    //Their NetworkID is 0 to 0x7FFF, bit 15 is ReliableSequenceID, others are a ReliableIDError
 
     void printASCIIArray(uint8_t *buffer, uint8_t size);
     uint8_t getReliableConfig(uint8_t bitread);
@@ -192,32 +187,14 @@ class SX128XLT  {
     void setPayloadLength(uint8_t length);
     uint16_t CRCCCITTReliable(uint8_t startadd, uint8_t endadd, uint16_t startvalue);
 
-    uint8_t transmitSXReliable(uint8_t startaddr, uint8_t length, uint16_t networkID, uint32_t txtimeout, int8_t txpower, uint8_t wait);
-    uint8_t transmitSXReliableIRQ(uint8_t startaddr, uint8_t length, uint16_t networkID, uint32_t txtimeout, int8_t txpower, uint8_t wait);
-    uint8_t receiveSXReliable(uint8_t startaddr, uint16_t networkID, uint32_t rxtimeout, uint8_t wait );
-    uint8_t receiveSXReliableIRQ(uint8_t startaddr, uint16_t networkID, uint32_t rxtimeout, uint8_t wait );
-    uint8_t transmitSXReliableAutoACK(uint8_t startaddr, uint8_t length, uint16_t networkID, uint32_t acktimeout, uint32_t txtimeout, int8_t txpower, uint8_t wait);
-    uint8_t receiveSXReliableAutoACK(uint8_t startaddr, uint16_t networkID, uint32_t ackdelay, int8_t txpower, uint32_t rxtimeout, uint8_t wait );
-    uint8_t waitSXReliableACK(uint8_t startaddr, uint16_t networkID, uint16_t payloadcrc, uint32_t acktimeout);
-    uint8_t waitSXReliableACKIRQ(uint8_t startaddr, uint16_t networkID, uint16_t payloadcrc, uint32_t acktimeout);
-    uint8_t sendSXReliableACK(uint8_t startaddr, uint8_t length, uint16_t networkID, uint16_t payloadcrc, int8_t txpower);
-    uint8_t sendSXReliableACKIRQ(uint8_t startaddr, uint8_t length, uint16_t networkID, uint16_t payloadcrc, int8_t txpower);
     uint8_t readReliableErrors();
     uint8_t readReliableFlags();
 
     //*******************************************************************************
     //Data Transfer functions
     //*******************************************************************************
-    uint8_t transmitDT(uint8_t *header, uint8_t headersize, uint8_t *dataarray, uint8_t datasize, uint16_t networkID, uint32_t txtimeout, int8_t txpower, uint8_t wait);
-    uint8_t waitACKDT(uint8_t *header, uint8_t headersize, uint32_t acktimeout);
-    uint8_t receiveDT(uint8_t *header, uint8_t headersize, uint8_t *dataarray, uint8_t datasize, uint16_t networkID, uint32_t rxtimeout, uint8_t wait );
-    uint8_t sendACKDT(uint8_t *header, uint8_t headersize, int8_t txpower);
-
-    uint8_t transmitDTIRQ(uint8_t *header, uint8_t headersize, uint8_t *dataarray, uint8_t datasize, uint16_t networkID, uint32_t txtimeout, int8_t txpower, uint8_t wait);
-    uint8_t waitACKDTIRQ(uint8_t *header, uint8_t headersize, uint32_t acktimeout);
-    uint8_t receiveDTIRQ(uint8_t *header, uint8_t headersize, uint8_t *dataarray, uint8_t datasize, uint16_t networkID, uint32_t rxtimeout, uint8_t wait );
-    uint8_t sendACKDTIRQ(uint8_t *header, uint8_t headersize, int8_t txpower);
-
+    //transmitDT(), receiveDT(), sendACKDT(), waitACKDT(), receiveHeaderDT(), readDataDT() and the IRQ
+    //variants are in LTReliableCore.h
 
   private:
 
@@ -254,6 +231,38 @@ class SX128XLT  {
     uint8_t _ReliableErrors;        //Reliable status byte
     uint8_t _ReliableFlags;         //Reliable flags byte
     uint8_t _ReliableConfig;        //Reliable config byte
+    uint8_t _DTDataStart;           //buffer address of the data of the packet from receiveHeaderDT()
+    uint8_t _DTDataL;               //length of that data
+    uint16_t _DTPayloadCRC;         //payload CRC sent with it
+
+    friend class LTReliableCore<SX128XLT>;            //device access of the DT and reliable functions
+
+    static const uint8_t DTMinPacketL = 10;
+    static const uint32_t DTACKTXTimeout = 12000;     //mS, longest packet is 8.7secs
+
+    void standbyDT();
+    void beginWriteDT(uint8_t offset);
+    void beginReadDT(uint8_t offset);
+    void endBufferDT();
+    void startTXDT(uint8_t length, int8_t txpower, uint32_t txtimeout);
+    bool waitTXDT(uint32_t txtimeout, bool useIRQ);
+    void startRXDT(uint32_t rxtimeout);
+    bool rxDoneDT(bool useIRQ);
+    bool waitRXDT(uint32_t rxtimeout, bool useIRQ);
+    bool endRXDT();
+    uint8_t readRXBufferStatusDT();
+    void restartRXDT();
+    bool receivingDT();
+    bool txDoneDT(bool useIRQ);
+    bool endTXDT();
+    void timeoutDT(bool tx);
+    void setTXBaseDT(uint8_t addr);
+    void setRXBaseDT(uint8_t addr);
+    uint16_t readPreambleDT();
+    void writePreambleDT(uint16_t length);
 
 };
+
+extern template class LTReliableCore<SX128XLT>;
+
 #endif
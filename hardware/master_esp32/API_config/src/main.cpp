@@ -3,29 +3,86 @@
   Reliable transmission with AutoACK using the SX12XX library by Stuart Robinson.
   Reference: example 209_Reliable_Transmitter_AutoACK
 
-  Role: Master node. Reads local sensors, transmits a LoRa packet to the slave,
-        extracts link-quality metrics (RSSI, SNR) from the received ACK, and
-        sends the data as JSON via HTTPS POST to the backend REST API for
-        real-time Random Forest inference.
-
-  Active sensor config: 2 sensors — DHT11 (temperature + humidity)
-  CSV format:           temp_C, hum_air_pct, rssi_dBm, snr_dB
-  JSON keys:            temperatura, humedad_relativa, rssi, snr
-
-  To enable 3-sensor config (+ HW-080 soil moisture):
-    uncomment all lines marked with [3S]
-    CSV becomes: temp_C, hum_air_pct, soil_moisture_pct, rssi_dBm, snr_dB
-    JSON adds:   "humedad_suelo": <value>
-    Note: backend must accept the additional field.
+  Role: Master node (hub). Reads local sensors, polls each wristband slave with
+        a reliable LoRa packet, extracts link-quality metrics (RSSI, SNR) from
+        the received ACK, and sends the data in batches of JSON via HTTPS POST
+        to the backend REST API for real-time Random Forest inference.
+
+  Frame: each poll carries the sample as an LTTelemetry.h frame, feature
+         schema, node, sequence, fixed point readings and the TX power, and
+         the slave ACKs with the RSSI and SNR it received the poll at
+         (ReliableACKLink), so one exchange measures the link both ways.
+         Each poll carries a sequence number (ReliableSequence), a poll
+         sent again because its ACK was lost is ACKed again by the slave
+         and not taken as a second sample.
+
+  Radio: the reliable TX -> ACK wait -> retry exchange runs in its own task using
+         the non-blocking startTransmitReliableAutoACK() / pollReliable() API,
+         woken by the DIO0 interrupt (TX done, RX done) and every RadioPollmS for
+         timeouts. loop() reads the DHT11 every CyclePeriodmS and runs the HTTPS
+         uplink meanwhile and gets each result from a queue.
+
+  Uplink: uplink.h queues each sample and POSTs them in batches over a kept
+         TLS connection, so the handshake is not paid for every sample.
+         Samples that cannot be sent are kept in a FRAM log, through resets,
+         and sent with the time they were taken once the backend is back.
+
+  Polling: every wristband has its own NetworkID, its node address, listed in
+         NodeAddresses. LTPoll.h picks the node due next and sets its next
+         poll from the ACK: every ActivemS for new wristbands and those whose
+         RSSI is moving, every StablemS for steady ones, backing off up to
+         LostmS for those that do not answer. Up to MaxNodes per hub.
+
+  ADR:   LTADR.h tracks the ACK RSSI/SNR of each node and moves its link
+         between SF12 and SF7 BW250 and 2 to 17 dBm, negotiated with the slave
+         in an ADR request sent in place of the probe payload. Both ends start
+         at SF7 BW125 2 dBm and meet at SF12 17 dBm if an exchange fails. The
+         RSSI and SNR sent to the backend are scaled back to 2 dBm and 125 kHz,
+         the settings the dataset was recorded with.
+
+  Listen: with ListenPeriodmS set the wristbands are duty cycled, LTListen.h,
+         asleep but for a CAD once a period. Every poll is then sent with a
+         preamble longer than the period and takes that much longer. It must
+         match LISTEN_PERIOD_MS of the slave firmware, 0 for slaves always in RX.
+
+  Sensors: FeatureSchema picks the sensors fitted, a schema of LTFeatures.h,
+         generated from hardware/schema/features.json with the dataset tool
+         and backend tables. LTSchema2S is the DHT11 (temperature + humidity),
+         LTSchema3S adds the HW-080 soil moisture. The CSV columns, the frame
+         readings and the JSON keys all follow the schema, and the schema id
+         goes with each frame and each sample ("schema_id"), so the backend
+         knows which features a sample has.
+         CSV (2S): temp_C, hum_air_pct, rssi_dBm, snr_dB
+         CSV (3S): temp_C, hum_air_pct, soil_moisture_pct, rssi_dBm, snr_dB
+
+  Inference: with EdgeInference set the hub runs the Random Forest of the
+         backend, LTForest.h with LTForestModel.h exported from its model by
+         export_forest.py, on each sample. The prediction is the one the
+         backend would make from the same readings. A sample goes out only
+         when the prediction of its wristband changes, sent at once as an
+         alert, or every HeartbeatmS so the backend keeps it online.
+
+  Link statistics: LTLinkStats.h keeps the EWMA, median, deviation, min and
+         max of the RSSI and SNR of the last polls of each wristband, and the
+         packets lost in its TXattempts loop, and each sample carries them
+         next to the RSSI and SNR of its own ACK.
 *******************************************************************************************************/
 
 #include <SPI.h>
 #include <SX127XLT.h>
+#include <LTADR.h>
+#include <LTPoll.h>
+#include <LTListen.h>
+#include <LTAirtime.h>
+#include <LTTelemetry.h>
+#include <LTFeatures.h>
+#include <LTForest.h>
+#include <LTForestModel.h>
+#include <LTLinkStats.h>
 #include <Arduino.h>
 #include "DHT.h"
 #include <WiFi.h>
-#include <HTTPClient.h>
-#include <WiFiClientSecure.h>
+#include "uplink.h"
 
 // ===================== WiFi Credentials =====================
 // WARNING: do not commit real credentials to a public repository.
@@ -49,45 +106,105 @@ SX127XLT LT;
 #define DIO0       2      // LoRa DIO0 interrupt
 
 #define LORA_DEVICE DEVICE_SX1278
-#define TXpower     10
+#define Frequency   434000000  // SX1278 433 MHz band
+#define TXpower     2          // ADR start TX power, both ways, the slave ACK power of the dataset
+#define ADRstartRate 5         // SF7 BW125
 
 // ===================== Reliable Packet / AutoACK Parameters =====================
-#define ACKtimeout 1000    // ms to wait for ACK after transmission
-#define TXtimeout  1000    // ms timeout for TX operation
-#define TXattempts 10      // max retransmission attempts before giving up
-
-const uint16_t NetworkID = 0x3210;  // Must match slave node
+#define ACKdelay   100     // ACKdelay of the slaves, the ACK and TX timeouts are sized from the airtime, LTAirtime.h
+#define TXattempts 3       // attempts per poll, a node that misses a poll is polled again at ActivemS
+#define ListenPeriodmS 0   // LISTEN_PERIOD_MS of the slaves, 0 for slaves always in RX
+
+// ===================== Cycle / Radio Task =====================
+#define CyclePeriodmS 10000   // one sensor read per period
+#define RadioPollmS   5       // radio task polls at least this often, for ACK and TX timeouts
+#define RADIO_DIO0    0x01    // radio task notification bit
+
+// ===================== Wristband Polling =====================
+#define MaxNodes      256     // 12 B of LTPoll state and an LTADR per node
+#define ActivemS      10000   // poll interval of new and moving wristbands
+#define StablemS      30000   // poll interval once the RSSI is steady
+#define LostmS        120000  // longest poll interval of a wristband that does not answer
+
+// ===================== Feature Schema =====================
+#define FeatureSchema LTSchema2S   // LTSchema2S DHT11, LTSchema3S DHT11 + HW-080, LTFeatures.h
+typedef LTSchema<FeatureSchema> Schema;
+
+// ===================== Inference on the Hub =====================
+#define EdgeInference 1       // classify with LTForest.h and uplink changes and heartbeats, 0 to send every sample
+#define HeartbeatmS   60000   // a wristband with no change is sent this often, the backend marks it offline after 120 s
+#define NoneSent      -128    // nodePrediction before the first sample of a wristband is sent
+
+struct LinkResult
+{
+  uint16_t node;       // NetworkID of the wristband polled
+  int16_t  slot;       // its Poller slot
+  bool     acked;
+  uint8_t  attempts;
+  uint8_t  errors;     // readReliableErrors() of the last attempt
+  uint16_t payloadCRC;
+  int16_t  rssi;       // scaled to TXpower and 125 kHz
+  int8_t   snr;
+  uint8_t  rate;       // LTADR rate and TX power of the exchange
+  int8_t   txpower;
+  uint8_t  sequence;   // of the telemetry frame, 0 for an ADR request
+  int16_t  uplinkRSSI; // the poll as the wristband received it, scaled as rssi
+  int8_t   uplinkSNR;
+};
+
+TaskHandle_t  radioTaskHandle = NULL;
+QueueHandle_t linkResults     = NULL;
+uint32_t      lastCyclemS     = 0;
+bool          firstCycle      = true;
+
+// NetworkID of each wristband, NODE_ADDRESS in its slave firmware, 0x0000 to 0x7FFF
+const uint16_t NodeAddresses[] = {0x3210};
+
+LTPoll<MaxNodes> Poller;            // used by the radio task only after setup()
+LTADR            nodeADR[MaxNodes]; // ADR of each node, by Poller slot
+LTListen         Listen;            // preamble for duty cycled slaves, used by the radio task
 
 // ===================== LoRa Payload =====================
-// LoRa is used only for link quality evaluation (RSSI, SNR from ACK).
-// Sensor data is NOT transported via LoRa.
-uint8_t  buff[] = "SIESPRO";
-uint16_t PayloadCRC;
-uint8_t  TXPacketL;
+// LoRa is used for link quality evaluation (RSSI, SNR both ways), the frame carries
+// the sample but the backend still gets it over WiFi.
+uint8_t  buff[LTTelemetryLength(FeatureSchema)];   // telemetry frame of the poll, LTTelemetry.h
+uint8_t  nodeSequence[MaxNodes];    // last frame sequence of each node, by Poller slot
+uint8_t  ADRbuff[LTADRRequestL];    // sent instead of buff when ADR asks for new settings
+
+// ===================== Last Prediction Sent, by Poller slot =====================
+int8_t   nodePrediction[MaxNodes];
+uint32_t nodeUplinkmS[MaxNodes];    // millis() when it was sent
+
+// ===================== Link Statistics, by Poller slot, used by loop() =====================
+LTLinkStats nodeStats[MaxNodes];    // 76 B per node
 
 // ===================== DHT11 — Air Temperature & Humidity =====================
 #define DHTPIN  17
 #define DHTTYPE DHT11
 DHT dht(DHTPIN, DHTTYPE);
 
-// ===================== [3S] HW-080 — Soil Moisture =====================
-// [3S] const int soilSensorPin = 33;
-// [3S] int       soilPercent   = 0;
+// ===================== HW-080 — Soil Moisture, LTSchema3S =====================
+const int soilSensorPin = 33;
+int       soilPercent   = 0;
 
 // ===================== Last Valid Sensor Sample =====================
 float lastT            = NAN;
 float lastH            = NAN;
-// [3S] int lastSoil    = 0;
+int   lastSoil         = 0;
 bool  lastSensorsValid = false;
 
-int16_t AckRSSI = 0;
-int8_t  AckSNR  = 0;
-
 // ===================== Forward Declarations =====================
-void packet_is_OK();
-void packet_is_Error();
-void sendData(float tempC, float humAir, int rssi, float snr);
-// [3S] void sendData(float tempC, float humAir, int soilPct, int rssi, float snr);
+void IRAM_ATTR dio0ISR();
+void radioTask(void *parameter);
+uint32_t ackTimeout();
+uint32_t txTimeout(uint8_t payloadL);
+uint8_t buildFrame(int16_t slot, int8_t txpower);
+void readSensors();
+void printSchema();
+void printCSV(int16_t rssi, int8_t snr);
+int8_t predictLink(const LinkResult &link);
+void printStats(LTLinkStats &stats);
+void reportLink(const LinkResult &link);
 
 
 void setup()
@@ -97,7 +214,11 @@ void setup()
   Serial.println(F("SIESPRO Master - LoRa Online Inference (ESP32)"));
 
   dht.begin();                              // NOTE: was missing in original 2S version
-  // [3S] pinMode(soilSensorPin, INPUT);
+
+  if (Schema::has(LTFeatureSoil))
+  {
+    pinMode(soilSensorPin, INPUT);
+  }
 
   SPI.begin(LORA_SCK, LORA_MISO, LORA_MOSI, NSS);
 
@@ -112,23 +233,47 @@ void setup()
     while (1) { delay(2000); }
   }
 
-  LT.setupLoRa(
-      434000000,    // carrier frequency (Hz) — SX1278 433 MHz band
-      0,            // frequency offset
-      LORA_SF7,     // spreading factor
-      LORA_BW_125,  // bandwidth
-      LORA_CR_4_5,  // coding rate
-      LDRO_AUTO     // low data rate optimization
-  );
+  // SF7, BW125, CR 4/5, LDRO auto at the ADR start rate
+  LTADRsetup(LT, Frequency, ADRstartRate);
+  Listen.begin(ListenPeriodmS, LTADR::getSymbolTimeuS(ADRstartRate));
+  LT.setReliablePreamble(ListenPeriodmS ? Listen.getPreamble() : 0);
+  LT.setReliableConfig(ReliableACKLink);       // ACKs carry the RSSI and SNR the wristband measured
+  LT.setReliableConfig(ReliableSequence);      // polls sent again after a lost ACK are not taken twice
+
+  Poller.setIntervals(ActivemS, StablemS, LostmS);
+
+  for (uint16_t index = 0; index < (sizeof(NodeAddresses) / sizeof(NodeAddresses[0])); index++)
+  {
+    int16_t slot = Poller.addNode(NodeAddresses[index], millis());
+
+    if (slot >= 0)
+    {
+      nodeADR[slot].begin(ADRstartRate, TXpower);
+      nodePrediction[slot] = NoneSent;
+    }
+    else
+    {
+      Serial.print(F("Node not added, bit 15 set or table full: 0x"));
+      Serial.println(NodeAddresses[index], HEX);
+    }
+  }
+
+  // Radio task on the loop() core at a higher priority, so a DIO0 edge preempts
+  // the DHT11 read or the HTTPS POST and the ACK wait starts straight away.
+  linkResults = xQueueCreate(16, sizeof(LinkResult));
+  xTaskCreatePinnedToCore(radioTask, "radio", 4096, NULL, 2, &radioTaskHandle, 1);
+  attachInterrupt(digitalPinToInterrupt(DIO0), dio0ISR, RISING);
+
+  uplinkBegin(serverUrl, LTForestModelID);
 
   Serial.println(F("Transmitter ready"));
   Serial.println();
-  Serial.println(F("CSV: temp_C,hum_air_pct,rssi_dBm,snr_dB"));
-  // [3S] Serial.println(F("CSV: temp_C,hum_air_pct,soil_moisture_pct,rssi_dBm,snr_dB"));
+  printSchema();
   Serial.println();
 
   // ===================== WiFi Setup =====================
   WiFi.begin(ssid, password);
+  configTime(0, 0, "pool.ntp.org");             // UTC for the sample timestamps, SNTP retries until WiFi is up
   Serial.print(F("Connecting to WiFi"));
 
   unsigned long start = millis();
@@ -162,7 +307,194 @@ void setup()
 
 void loop()
 {
-  // ===================== Sensor Readings =====================
+  LinkResult link;
+
+  // ===================== Start of Cycle =====================
+  if (firstCycle || ((uint32_t) (millis() - lastCyclemS) >= CyclePeriodmS))
+  {
+    firstCycle  = false;
+    lastCyclemS = millis();
+
+    readSensors();                          // the radio task polls the wristbands meanwhile
+  }
+
+  // ===================== Result of Reliable Exchange =====================
+  if (xQueueReceive(linkResults, &link, pdMS_TO_TICKS(10)) == pdTRUE)
+  {
+    reportLink(link);
+  }
+
+  // ===================== Batched HTTPS POST to API =====================
+  uplinkService();
+}
+
+
+// ===================== DIO0 Interrupt =====================
+// DIO0 goes high on TX done and on RX done, just wake the radio task,
+// the SPI work is done there.
+void IRAM_ATTR dio0ISR()
+{
+  BaseType_t woken = pdFALSE;
+
+  xTaskNotifyFromISR(radioTaskHandle, RADIO_DIO0, eSetBits, &woken);
+
+  if (woken)
+  {
+    portYIELD_FROM_ISR();
+  }
+}
+
+
+// ===================== Radio Task =====================
+// Only this task uses LT, Poller and nodeADR after setup(). Results go to loop()
+// via linkResults.
+void radioTask(void *parameter)
+{
+  uint32_t   events;
+  uint8_t    state;
+  uint8_t    newRate;
+  int8_t     newPower;
+  uint8_t    radioRate = ADRstartRate;    // rate LT is set up for
+  int16_t    slot = -1;                   // Poller slot of the node being polled
+  LTADR      *ADR = NULL;
+  bool       request = false;
+  LinkResult link;
+
+  for (;;)
+  {
+    events = 0;
+    xTaskNotifyWait(0, 0xFFFFFFFF, &events, pdMS_TO_TICKS(RadioPollmS));
+
+    if ((LT.getReliableState() == ReliableIdle) && ((slot = Poller.next(millis())) >= 0))
+    {
+      ADR = &nodeADR[slot];
+
+      if (ADR->getRate() != radioRate)
+      {
+        radioRate = ADR->getRate();
+        LTADRsetup(LT, Frequency, radioRate);
+        Listen.setSymbolTime(LTADR::getSymbolTimeuS(radioRate));
+        LT.setReliablePreamble(ListenPeriodmS ? Listen.getPreamble() : 0);
+      }
+
+      request = ADR->getProposal(newRate, newPower);
+      link.sequence = 0;
+
+      if (request)
+      {
+        LTADR::buildRequest(ADRbuff, newRate, newPower);
+        LT.startTransmitReliableAutoACK(ADRbuff, sizeof(ADRbuff), Poller.getAddress(slot), ackTimeout(), txTimeout(sizeof(ADRbuff)), ADR->getTXpower(), TXattempts);
+      }
+      else
+      {
+        link.sequence = buildFrame(slot, ADR->getTXpower());
+        LT.startTransmitReliableAutoACK(buff, sizeof(buff), Poller.getAddress(slot), ackTimeout(), txTimeout(sizeof(buff)), ADR->getTXpower(), TXattempts);
+      }
+    }
+
+    state = LT.pollReliable();
+
+    if (((state == ReliableDone) || (state == ReliableFailed)) && (ADR != NULL))
+    {
+      link.node       = Poller.getAddress(slot);
+      link.slot       = slot;
+      link.acked      = (state == ReliableDone);
+      link.attempts   = LT.getReliableAttempts();
+      link.errors     = LT.readReliableErrors();
+      link.payloadCRC = link.acked ? LT.getTXPayloadCRC(LT.readTXPacketL()) : 0;
+      link.rssi       = link.acked ? LT.readPacketRSSI() : 0;
+      link.snr        = link.acked ? LT.readPacketSNR() : 0;
+      link.uplinkRSSI = link.acked ? LT.readReliableACKRSSI() : 0;
+      link.uplinkSNR  = link.acked ? LT.readReliableACKSNR() : 0;
+      link.rate       = ADR->getRate();
+      link.txpower    = ADR->getTXpower();
+
+      LT.cancelReliable();                                   // back to ReliableIdle for the next poll
+
+      if (link.acked)
+      {
+        ADR->addSample(link.rssi, link.snr);
+
+        // features as if received with the dataset settings, 2 dBm ACK at 125 kHz
+        link.rssi -= (link.txpower - TXpower);
+        link.snr  += (LTADR::getBandwidth(link.rate) == LORA_BW_250) ? 3 : 0;
+        link.uplinkRSSI -= (link.txpower - TXpower);
+        link.uplinkSNR  += (LTADR::getBandwidth(link.rate) == LORA_BW_250) ? 3 : 0;
+
+        if (request)
+        {
+          ADR->apply(newRate, newPower);                     // the slave switched when it sent the ACK
+        }
+      }
+      else
+      {
+        // out of step with the slave or out of range, meet it at the fallback settings,
+        // or at the start settings if it has been reset
+        if (ADR->isFallback())
+        {
+          ADR->restart();
+        }
+        else
+        {
+          ADR->fallback();
+        }
+      }
+
+      // the scaled RSSI, so an ADR power change does not count as the wristband moving
+      Poller.pollDone(slot, millis(), link.acked, link.rssi, link.snr);
+
+      ADR = NULL;
+      request = false;
+      xQueueSend(linkResults, &link, 0);
+    }
+  }
+}
+
+
+// Timeouts from the time on air at the rate LT is set up for, so a lost packet at SF7 is sent again
+// after a few hundred ms rather than a second. A TX to a listening slave adds its long preamble,
+// getTimeOnAiruS() counts the short one as the reliable preamble is only set while sending
+uint32_t ackTimeout()
+{
+  return LTAirtimeACKTimeoutmS(ACKdelay, LT.getTimeOnAiruS(ReliableACKLinkL));
+}
+
+uint32_t txTimeout(uint8_t payloadL)
+{
+  return LTAirtimeTXTimeoutmS(LT.getTimeOnAiruS(payloadL + ReliableSequenceL)) + (ListenPeriodmS ? Listen.getAddedLatencymS() : 0);
+}
+
+
+// ===================== Telemetry Frame =====================
+// The sample of this poll, the last sensor readings, in place of a probe string. The
+// sequence moves on once per poll, not per attempt, so a resend keeps its number.
+uint8_t buildFrame(int16_t slot, int8_t txpower)
+{
+  LTTelemetryFrame frame;
+
+  nodeSequence[slot] = (nodeSequence[slot] == 255) ? 1 : (nodeSequence[slot] + 1);   // 0 marks an ADR request in LinkResult
+
+  LTTelemetry::clear(frame, FeatureSchema);
+  frame.node        = Poller.getAddress(slot);
+  frame.sequence    = nodeSequence[slot];
+  frame.battery     = 0;                      // the hub is not battery powered
+  frame.txpower     = txpower;
+
+  if (lastSensorsValid)                       // readings not in the schema are not sent
+  {
+    LTTelemetry::setReading(frame, LTFeatureTemperature, lastT);
+    LTTelemetry::setReading(frame, LTFeatureHumidity, lastH);
+    LTTelemetry::setReading(frame, LTFeatureSoil, lastSoil);
+  }
+
+  LTTelemetry::build(buff, frame);
+  return frame.sequence;
+}
+
+
+// ===================== Sensor Readings =====================
+void readSensors()
+{
   float h = dht.readHumidity();
   float t = dht.readTemperature();
   float f = dht.readTemperature(true);   // Fahrenheit — unused but validates sensor response
@@ -176,161 +508,212 @@ void loop()
   }
   else
   {
-    // [3S] soilPercent = map(analogRead(soilSensorPin), 4092, 0, 0, 100);
-
     Serial.print(F("DHT11  | Humidity: ")); Serial.print(h);
     Serial.print(F("%  Temp: "));           Serial.print(t);
     Serial.print(F(" °C / "));              Serial.print(f);
     Serial.println(F(" °F"));
 
-    // [3S] Serial.print(F("HW-080 | Soil moisture: "));
-    // [3S] Serial.print(soilPercent);
-    // [3S] Serial.println(F(" %"));
+    if (Schema::has(LTFeatureSoil))
+    {
+      soilPercent = map(analogRead(soilSensorPin), 4092, 0, 0, 100);
+      Serial.print(F("HW-080 | Soil moisture: "));
+      Serial.print(soilPercent);
+      Serial.println(F(" %"));
+    }
 
     lastT = t;
     lastH = h;
-    // [3S] lastSoil = soilPercent;
+    lastSoil = soilPercent;
     lastSensorsValid = true;
   }
 
   Serial.println();
+}
+
 
-  // ===================== Reliable Transmission with AutoACK =====================
-  uint8_t attempts = TXattempts;
-  TXPacketL = 0;
+// ===================== Schema + CSV Output =====================
+// The columns and values follow the schema, in its order, so they match the
+// dataset tool and the backend generated from the same features.json.
+void printSchema()
+{
+  Serial.print(F("Schema,"));
+  Serial.println(FeatureSchema);
+  Serial.print(F("CSV: "));
 
-  do
+  for (uint8_t index = 0; index < Schema::features; index++)
   {
-    Serial.print(F("Transmit payload > "));
-    LT.printASCIIArray(buff, sizeof(buff));
-    Serial.println();
-    Serial.flush();
-
-    Serial.print(F("Send attempt "));
-    Serial.println(TXattempts - attempts + 1);
-
-    TXPacketL = LT.transmitReliableAutoACK(
-        buff,
-        sizeof(buff),
-        NetworkID,
-        ACKtimeout,
-        TXtimeout,
-        TXpower,
-        WAIT_TX
-    );
-    attempts--;
-
-    if (TXPacketL > 0)
-    {
-      PayloadCRC = LT.getTXPayloadCRC(TXPacketL);
-      AckRSSI    = LT.readPacketRSSI();
-      AckSNR     = LT.readPacketSNR();
+    Serial.print(index ? F(",") : F(""));
+    Serial.print(LTFeatureTable[LTSchemaFeature(FeatureSchema, index) - 1].column);
+  }
 
-      packet_is_OK();
+  Serial.println();
+}
 
-      if (lastSensorsValid)
-      {
-        // ===================== CSV Output =====================
-        Serial.println();
-        Serial.print(lastT);   Serial.print(F(","));
-        Serial.print(lastH);   Serial.print(F(","));
-        // [3S] Serial.print(lastSoil); Serial.print(F(","));
-        Serial.print(AckRSSI); Serial.print(F(","));
-        Serial.println(AckSNR);
-
-        // ===================== HTTPS POST to API =====================
-        sendData(lastT, lastH, AckRSSI, (float)AckSNR);
-        // [3S] sendData(lastT, lastH, lastSoil, AckRSSI, (float)AckSNR);
-      }
+void printCSV(int16_t rssi, int8_t snr)
+{
+  for (uint8_t index = 0; index < Schema::features; index++)
+  {
+    Serial.print(index ? F(",") : F(""));
 
-      Serial.println();
-    }
-    else
+    switch (LTSchemaFeature(FeatureSchema, index))
     {
-      packet_is_Error();
-      Serial.println();
+      case LTFeatureTemperature: Serial.print(lastT);    break;
+      case LTFeatureHumidity:    Serial.print(lastH);    break;
+      case LTFeatureSoil:        Serial.print(lastSoil); break;
+      case LTFeatureRSSI:        Serial.print(rssi);     break;
+      case LTFeatureSNR:         Serial.print(snr);      break;
     }
-
-    delay(500);
   }
-  while ((TXPacketL == 0) && (attempts != 0));
 
-  if (TXPacketL > 0)
-    Serial.println(F("Packet acknowledged"));
+  Serial.println();
+}
+
+
+// ===================== Inference on the Hub =====================
+// The inputs of the model, in LTForestModel.h order, from the readings of this sample.
+// The hundredths are those the JSON to the backend carries, so the prediction is the
+// one the backend would make from the sample.
+int8_t predictLink(const LinkResult &link)
+{
+  int16_t inputs[LTForestInputs];
 
-  if (attempts == 0)
+  for (uint8_t index = 0; index < LTForestInputs; index++)
   {
-    Serial.print(F("No acknowledge after "));
-    Serial.print(TXattempts);
-    Serial.println(F(" attempts"));
+    switch (LTForestInputFeature[index])
+    {
+      case LTFeatureTemperature: inputs[index] = LTForest::toInput(lastT);     break;
+      case LTFeatureHumidity:    inputs[index] = LTForest::toInput(lastH);     break;
+      case LTFeatureSoil:        inputs[index] = Schema::has(LTFeatureSoil) ? LTForest::toInput(lastSoil) : LTForestNoInput; break;
+      case LTFeatureRSSI:        inputs[index] = LTForest::toInput(link.rssi); break;
+      case LTFeatureSNR:         inputs[index] = LTForest::toInput(link.snr);  break;
+      default:                   inputs[index] = LTForestNoInput;              break;
+    }
   }
 
-  Serial.println();
-  delay(10000);
+  if (!LTForest::validInputs(LTForestSIESPRO, inputs))
+  {
+    return UplinkNoPrediction;               // the model needs a sensor this schema does not have
+  }
+
+  return (int8_t) LTForest::predict(LTForestSIESPRO, inputs);
 }
 
 
-void packet_is_OK()
+// ===================== Link Statistics =====================
+// Median and deviation of the RSSI and SNR over the last polls, tenths of a dB
+void printStats(LTLinkStats &stats)
 {
-  Serial.print(F("LocalNetworkID,0x"));
-  Serial.print(NetworkID, HEX);
-  Serial.print(F(",TransmittedPayloadCRC,0x"));
-  Serial.println(PayloadCRC, HEX);
+  LTLinkSummary rssi, snr;
+
+  stats.getRSSI(rssi);
+  stats.getSNR(snr);
+
+  Serial.print(F("Last "));
+  Serial.print(stats.getSamples());
+  Serial.print(F(", RSSI median "));
+  Serial.print(rssi.median / 10.0f, 1);
+  Serial.print(F("dBm sd "));
+  Serial.print(rssi.deviation / 10.0f, 1);
+  Serial.print(F(" SNR median "));
+  Serial.print(snr.median / 10.0f, 1);
+  Serial.print(F("dB sd "));
+  Serial.print(snr.deviation / 10.0f, 1);
+  Serial.print(F(", lost "));
+  Serial.print(stats.getLossPercent());
+  Serial.println(F("%"));
 }
 
 
-void packet_is_Error()
+// ===================== Link Report + Uplink =====================
+void reportLink(const LinkResult &link)
 {
-  Serial.println(F("No packet acknowledge"));
-  LT.printIrqStatus();
-  LT.printReliableStatus();
-}
+  LTLinkStats &stats = nodeStats[link.slot];
 
+  stats.addPoll(link.acked, link.attempts, link.rssi, link.snr);
 
-// ===================== HTTPS POST =====================
-// Sends JSON sensor + link-quality data to the backend for RF inference.
-// setInsecure() disables certificate validation — acceptable for demo/academic use.
-void sendData(float tempC, float humAir, int rssi, float snr)
-// [3S] void sendData(float tempC, float humAir, int soilPct, int rssi, float snr)
-{
-  if (WiFi.status() != WL_CONNECTED)
+  if (!link.acked)
   {
-    Serial.println(F("WiFi not connected, skipping API call"));
+    Serial.print(F("Node 0x"));
+    Serial.print(link.node, HEX);
+    Serial.print(F(", no acknowledge after "));
+    Serial.print(link.attempts);
+    Serial.print(F(" attempts, reliable errors 0x"));
+    Serial.println(link.errors, HEX);
+    Serial.println();
     return;
   }
 
-  String jsonData = "{";
-  jsonData += "\"temperatura\": "      + String(tempC, 2) + ",";
-  jsonData += "\"humedad_relativa\": " + String(humAir, 2) + ",";
-  // [3S] jsonData += "\"humedad_suelo\": " + String(soilPct) + ",";
-  jsonData += "\"rssi\": "             + String(rssi) + ",";
-  jsonData += "\"snr\": "              + String(snr, 2);
-  jsonData += "}";
-
-  Serial.print(F("JSON: "));
-  Serial.println(jsonData);
+  Serial.print(F("Node 0x"));
+  Serial.print(link.node, HEX);
+  Serial.print(F(", packet acknowledged, attempts "));
+  Serial.print(link.attempts);
+  Serial.print(F(", SF"));
+  Serial.print(LTADR::getSF(link.rate));
+  Serial.print((LTADR::getBandwidth(link.rate) == LORA_BW_250) ? F(" BW250 ") : F(" BW125 "));
+  Serial.print(link.txpower);
+  Serial.println(F("dBm"));
 
-  WiFiClientSecure client;
-  client.setInsecure();
+  Serial.print(link.sequence ? F("Frame ") : F("ADR request"));
 
-  HTTPClient http;
-  http.begin(client, serverUrl);
-  http.addHeader("Content-Type", "application/json");
-
-  int httpCode = http.POST(jsonData);
-
-  if (httpCode > 0)
+  if (link.sequence)
   {
-    Serial.print(F("HTTP POST OK, code: "));
-    Serial.println(httpCode);
-    Serial.print(F("Response: "));
-    Serial.println(http.getString());
+    Serial.print(link.sequence);
   }
-  else
+
+  Serial.print(F(", uplink RSSI "));
+  Serial.print(link.uplinkRSSI);
+  Serial.print(F("dBm SNR "));
+  Serial.print(link.uplinkSNR);
+  Serial.println(F("dB"));
+  printStats(stats);
+  Serial.print(F("LocalNetworkID,0x"));
+  Serial.print(link.node, HEX);
+  Serial.print(F(",TransmittedPayloadCRC,0x"));
+  Serial.println(link.payloadCRC, HEX);
+
+  if (lastSensorsValid)
   {
-    Serial.print(F("HTTP POST failed, code: "));
-    Serial.println(httpCode);
+    // ===================== CSV Output =====================
+    Serial.println();
+    printCSV(link.rssi, link.snr);
+
+    // ===================== Queue for the API =====================
+    UplinkSample sample;
+    sample.node    = link.node;
+    sample.schema  = FeatureSchema;
+    sample.tempC   = lastT;
+    sample.humAir  = lastH;
+    sample.soilPct = Schema::has(LTFeatureSoil) ? lastSoil : UplinkNoSoil;
+    sample.rssi    = link.rssi;
+    sample.snr     = link.snr;
+    sample.prediction = UplinkNoPrediction;
+    sample.linkSamples = stats.getSamples();
+    sample.lossPct = stats.getLossPercent();
+    stats.getRSSI(sample.rssiStats);
+    stats.getSNR(sample.snrStats);
+
+#if EdgeInference
+    sample.prediction = predictLink(link);
+    Serial.print(F("Prediction,"));
+    Serial.println(sample.prediction);
+
+    if (sample.prediction != nodePrediction[link.slot])
+    {
+      uplinkFlush();                        // a change is an alert, it does not wait for a batch
+    }
+    else if ((uint32_t) (millis() - nodeUplinkmS[link.slot]) < HeartbeatmS)
+    {
+      Serial.println();
+      return;                               // the backend has this prediction already
+    }
+
+    nodePrediction[link.slot] = sample.prediction;
+    nodeUplinkmS[link.slot]   = millis();
+#endif
+
+    uplinkAdd(sample);
   }
 
-  http.end();
+  Serial.println();
 }
+
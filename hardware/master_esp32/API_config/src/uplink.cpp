@@ -0,0 +1,407 @@
+/*******************************************************************************************************
+  SIESPRO - Batched HTTPS Uplink (ESP32 Master / API_config), see uplink.h
+*******************************************************************************************************/
+
+#include "uplink.h"
+#include <WiFi.h>
+#include <HTTPClient.h>
+#include <WiFiClientSecure.h>
+#include <time.h>
+#include <stdarg.h>
+#include <LTFeatures.h>
+
+#if UplinkLogFRAM
+#include <Wire.h>
+#include <FRAM_FM24CL64.h>
+#include <LTLog.h>
+#endif
+
+// ===================== Ring Buffer =====================
+static UplinkSample queue[UplinkQueueSize];
+static uint32_t     queuedmS[UplinkQueueSize];   // millis() when each sample was queued
+static uint16_t     head  = 0;                   // oldest sample
+static uint16_t     count = 0;
+
+// ===================== Offline Log =====================
+#if UplinkLogFRAM
+static LTLog        offlineLog;
+#endif
+
+// ===================== Connection, kept between batches =====================
+static const char       *serverUrl = NULL;
+static uint32_t         modelId   = 0;           // LTForestModelID, sent with each prediction
+static WiFiClientSecure client;
+static HTTPClient       http;
+static UplinkSample     batch[UplinkBatchMax];
+static char             json[UplinkJSONSize];
+static uint32_t         retryAftermS = 0;
+static bool             retryWait    = false;
+static bool             flush        = false;    // send the queue at once, uplinkFlush()
+
+static bool     logSample(const UplinkSample &sample);
+static uint16_t readLog(uint16_t samples);
+static uint16_t buildBatch(uint16_t samples, size_t &length);
+static bool     appendJSON(size_t &length, const char *format, ...);
+static bool     appendStats(size_t &length, const char *name, const LTLinkSummary &stats);
+static float    sampleFeature(const UplinkSample &sample, uint8_t id);
+static int      postBatch(size_t length);
+
+
+void uplinkBegin(const char *url, uint32_t modelID)
+{
+  serverUrl = url;
+  modelId   = modelID;
+
+  // setInsecure() disables certificate validation — acceptable for demo/academic use.
+  client.setInsecure();
+  http.setReuse(true);
+
+#if UplinkLogFRAM
+  memoryStart(UplinkFRAMAddr);
+  Serial.print(F("Offline log, samples to send "));
+  Serial.println(offlineLog.begin(0, UplinkFRAMEnd));
+#endif
+}
+
+
+bool uplinkAdd(const UplinkSample &sample)
+{
+  bool     kept = true;
+  time_t   now  = time(NULL);
+  uint16_t slot;
+
+  if (count == UplinkQueueSize)
+  {
+    kept = logSample(queue[head]);               // make room, the oldest goes to the log if there is one
+    head = (head + 1) % UplinkQueueSize;
+    count--;
+
+    if (!kept)
+    {
+      Serial.println(F("Uplink queue full, oldest sample dropped"));
+    }
+  }
+
+  slot             = (head + count) % UplinkQueueSize;
+  queue[slot]      = sample;
+  queue[slot].time = (now > 1600000000) ? (uint32_t) now : 0;   // before SNTP the clock starts at 1970
+  queuedmS[slot]   = millis();
+  count++;
+
+  return kept;
+}
+
+
+void uplinkFlush()
+{
+  flush = true;
+}
+
+
+uint16_t uplinkPending()
+{
+#if UplinkLogFRAM
+  return count + offlineLog.getPending();
+#else
+  return count;
+#endif
+}
+
+
+void uplinkService()
+{
+  uint16_t samples;
+  uint16_t logged = 0;                           // samples in the batch that came from the log
+  size_t   length;
+  uint32_t startmS;
+  int      httpCode;
+
+  if ((uplinkPending() == 0) || (serverUrl == NULL))
+  {
+    return;
+  }
+
+  if (retryWait && ((int32_t) (millis() - retryAftermS) < 0))
+  {
+    return;
+  }
+
+  if (WiFi.status() != WL_CONNECTED)
+  {
+    Serial.println(F("WiFi not connected, samples kept for the next batch"));
+
+#if UplinkLogFRAM
+    while (count > 0)                            // somewhere a reset will not lose them
+    {
+      logSample(queue[head]);
+      head = (head + 1) % UplinkQueueSize;
+      count--;
+    }
+#endif
+
+    retryWait    = true;
+    retryAftermS = millis() + UplinkRetrymS;
+    return;
+  }
+
+#if UplinkLogFRAM
+  logged = readLog(UplinkBatchMax);              // the log is older, it goes first
+#endif
+
+  if (logged > 0)
+  {
+    samples = logged;
+  }
+  else if (!flush && (count < UplinkBatchMax) && ((uint32_t) (millis() - queuedmS[head]) < UplinkMaxWaitmS))
+  {
+    return;                                      // let the batch fill
+  }
+  else
+  {
+    samples = (count < UplinkBatchMax) ? count : UplinkBatchMax;
+
+    for (uint16_t index = 0; index < samples; index++)
+    {
+      batch[index] = queue[(head + index) % UplinkQueueSize];
+    }
+  }
+
+  samples  = buildBatch(samples, length);
+  startmS  = millis();
+  httpCode = postBatch(length);
+
+  Serial.print(logged ? F("Uplink from log ") : F("Uplink "));
+  Serial.print(samples);
+  Serial.print(F(" samples, "));
+  Serial.print(length);
+  Serial.print(F(" bytes, "));
+  Serial.print(millis() - startmS);
+  Serial.print(F("mS, code "));
+  Serial.println(httpCode);
+
+  if ((httpCode >= 400) && (httpCode < 500) && (httpCode != 408) && (httpCode != 429))
+  {
+    Serial.println(F("Batch rejected by the backend, dropped"));   // sending it again would get the same answer
+  }
+  else if ((httpCode < 200) || (httpCode >= 300))
+  {
+    retryWait    = true;
+    retryAftermS = millis() + UplinkRetrymS;
+    return;
+  }
+
+  retryWait = false;
+
+#if UplinkLogFRAM
+  if (logged > 0)
+  {
+    offlineLog.markSent(samples);
+    return;
+  }
+#endif
+
+  head   = (head + samples) % UplinkQueueSize;
+  count -= samples;
+  flush  = flush && (count > 0);
+}
+
+
+// Appends a sample to the offline log, false if there is no log
+static bool logSample(const UplinkSample &sample)
+{
+#if UplinkLogFRAM
+  LTLogRecord record;
+
+  record.node        = sample.node;
+  record.time        = sample.time;
+  record.temperature = (int16_t) lroundf(sample.tempC * 100);
+  record.humidity    = (uint16_t) lroundf(sample.humAir * 100);
+  record.soil        = (sample.soilPct == UplinkNoSoil) ? LTLogNoSoil : sample.soilPct;
+  record.rssi        = sample.rssi;
+  record.snr         = sample.snr;
+
+  if (!offlineLog.append(record))
+  {
+    Serial.println(F("Offline log full, oldest sample overwritten"));
+  }
+
+  return true;
+#else
+  (void) sample;
+  return false;
+#endif
+}
+
+
+// Reads up to samples of the oldest samples in the offline log into batch
+static uint16_t readLog(uint16_t samples)
+{
+#if UplinkLogFRAM
+  LTLogRecord records[UplinkBatchMax];
+
+  samples = offlineLog.read(records, samples);
+
+  for (uint16_t index = 0; index < samples; index++)
+  {
+    // the log keeps no schema, a record with a soil reading is a LTSchema3S sample
+    batch[index].node    = records[index].node;
+    batch[index].schema  = (records[index].soil == LTLogNoSoil) ? LTSchema2S : LTSchema3S;
+    batch[index].time    = records[index].time;
+    batch[index].tempC   = records[index].temperature / 100.0f;
+    batch[index].humAir  = records[index].humidity / 100.0f;
+    batch[index].soilPct = (records[index].soil == LTLogNoSoil) ? UplinkNoSoil : records[index].soil;
+    batch[index].rssi    = records[index].rssi;
+    batch[index].snr     = records[index].snr;
+    batch[index].prediction = UplinkNoPrediction;   // not logged, the backend classifies it
+    batch[index].linkSamples = 0;
+  }
+
+  return samples;
+#else
+  (void) samples;
+  return 0;
+#endif
+}
+
+
+// Writes the first samples of batch into json, returns how many fitted
+static uint16_t buildBatch(uint16_t samples, size_t &length)
+{
+  const UplinkSample *sample;
+  uint16_t index;
+  uint8_t  feature, id;
+  size_t   start;
+  bool     fitted;
+  float    value;
+
+  length = snprintf(json, sizeof(json), "{\"samples\":[");
+
+  for (index = 0; index < samples; index++)
+  {
+    sample = &batch[index];
+    start  = length;
+    fitted = appendJSON(length, "%s{\"bracelet_id\":\"MANILLA-%04X\",\"schema_id\":%u",
+                        index ? "," : "", sample->node, sample->schema);
+
+    for (feature = 0; fitted && LTSchemaValid(sample->schema) && (feature < LTSchemaFeatures(sample->schema)); feature++)
+    {
+      id    = LTSchemaFeature(sample->schema, feature);
+      value = sampleFeature(*sample, id);
+
+      if (isnan(value))
+      {
+        continue;                                // not read, the backend gets no key
+      }
+
+      if (LTFeatureTable[id - 1].scale > 1)
+      {
+        fitted = appendJSON(length, ",\"%s\":%.2f", LTFeatureTable[id - 1].key, value);
+      }
+      else
+      {
+        fitted = appendJSON(length, ",\"%s\":%d", LTFeatureTable[id - 1].key, (int) value);
+      }
+    }
+
+    if (fitted && (sample->prediction != UplinkNoPrediction))
+    {
+      fitted = appendJSON(length, ",\"prediction\":%d,\"model_id\":\"%08lx\"", sample->prediction, (unsigned long) modelId);
+    }
+
+    if (fitted && (sample->linkSamples > 0))
+    {
+      fitted = appendStats(length, "rssi", sample->rssiStats) &&
+               appendStats(length, "snr", sample->snrStats) &&
+               appendJSON(length, ",\"loss_pct\":%u,\"link_samples\":%u", sample->lossPct, sample->linkSamples);
+    }
+
+    if (fitted && sample->time)
+    {
+      fitted = appendJSON(length, ",\"timestamp\":%lu", (unsigned long) sample->time);
+    }
+
+    if (!fitted || !appendJSON(length, "}"))
+    {
+      length = start;                            // no room for this one and the closing "]}"
+      break;
+    }
+  }
+
+  length += snprintf(json + length, sizeof(json) - length, "]}");
+  return index;
+}
+
+
+// Appends to json at length, false if it does not fit with room left for the closing "]}"
+static bool appendJSON(size_t &length, const char *format, ...)
+{
+  va_list args;
+  int     written;
+
+  va_start(args, format);
+  written = vsnprintf(json + length, sizeof(json) - length, format, args);
+  va_end(args);
+
+  if ((written < 0) || ((length + written + 3) > sizeof(json)))
+  {
+    return false;
+  }
+
+  length += written;
+  return true;
+}
+
+
+// Appends the link statistics of the RSSI or SNR, name_ewma to name_max
+static bool appendStats(size_t &length, const char *name, const LTLinkSummary &stats)
+{
+  return appendJSON(length, ",\"%s_ewma\":%.1f,\"%s_median\":%.1f,\"%s_std\":%.1f,\"%s_min\":%d,\"%s_max\":%d",
+                    name, stats.ewma / 10.0f, name, stats.median / 10.0f, name, stats.deviation / 10.0f,
+                    name, stats.min, name, stats.max);
+}
+
+
+// Value of a feature of the sample, by LTFeatures.h id, NAN if not read
+static float sampleFeature(const UplinkSample &sample, uint8_t id)
+{
+  switch (id)
+  {
+    case LTFeatureTemperature: return sample.tempC;
+    case LTFeatureHumidity:    return sample.humAir;
+    case LTFeatureSoil:        return (sample.soilPct == UplinkNoSoil) ? NAN : sample.soilPct;
+    case LTFeatureRSSI:        return sample.rssi;
+    case LTFeatureSNR:         return sample.snr;
+  }
+
+  return NAN;
+}
+
+
+// POST over the kept connection, HTTPClient reconnects and does a new TLS
+// handshake only if the backend has closed it
+static int postBatch(size_t length)
+{
+  int httpCode;
+
+  if (!http.begin(client, serverUrl))
+  {
+    return HTTPC_ERROR_CONNECTION_REFUSED;
+  }
+
+  http.addHeader("Content-Type", "application/json");
+  httpCode = http.POST((uint8_t *) json, length);
+
+  if (httpCode > 0)
+  {
+    http.getString();                            // read the whole response so the connection can be reused
+  }
+
+  http.end();                                    // with setReuse(true) the connection stays open
+
+  if (httpCode <= 0)
+  {
+    client.stop();                               // start again with a fresh handshake
+  }
+
+  return httpCode;
+}
@@ -0,0 +1,90 @@
+/*******************************************************************************************************
+  SIESPRO - Batched HTTPS Uplink (ESP32 Master / API_config)
+
+  Samples from reportLink() go into a fixed ring buffer of UplinkQueueSize.
+  uplinkService(), called from loop(), sends them to the backend in one POST
+  of up to UplinkBatchMax samples once that many are queued or the oldest has
+  waited UplinkMaxWaitmS:
+
+    {"samples":[{"bracelet_id":"MANILLA-3210","schema_id":1,
+                 "temperatura":21.00,"humedad_relativa":54.70,"rssi":-47,
+                 "snr":9,"prediction":0,"model_id":"1a2b3c4d",
+                 "timestamp":1760000000}, ...]}
+
+  The keys after schema_id are those of the features of the sample's schema,
+  in its order, from the LTFeatures.h tables, so a LTSchema3S sample adds
+  "humedad_suelo" without a change here. "prediction" is the class the hub
+  got from LTForest.h, left out for a sample the hub did not classify, which
+  the backend then runs its model on. "model_id" follows it, LTForestModelID
+  of the LTForestModel.h the hub was built with as passed to uplinkBegin(), so
+  the backend recomputes a prediction made with a model it does not have.
+
+  Samples with link statistics, LTLinkStats.h over the last polls of the
+  wristband, add them after the prediction, the averages, medians and
+  deviations in dB to a tenth:
+
+    "rssi_ewma":-47.3,"rssi_median":-47.5,"rssi_std":2.1,"rssi_min":-51,
+    "rssi_max":-44,"snr_ewma":...,"snr_max":10,"loss_pct":12,"link_samples":8
+
+  uplinkFlush() sends what is queued at the next uplinkService() without
+  waiting for the batch to fill, for a sample that is an alert.
+
+  The JSON is written into a preallocated buffer with snprintf(), no String.
+  The WiFiClientSecure and HTTPClient are kept between batches with
+  setReuse(true), so the TLS handshake is only done when the backend or WiFi
+  drops the connection. A batch that fails stays queued and is sent again
+  after UplinkRetrymS.
+
+  Offline log: with UplinkLogFRAM set, samples that cannot be sent go to an
+  LTLog.h store and forward log on an FM24CL64 FRAM, 455 samples of 18 bytes.
+  The queue moves there when WiFi is down, and its oldest sample does when it
+  fills while the backend is down. Once a POST gets through, the log is sent
+  first, oldest first, in batches of UplinkBatchMax. Without the FRAM the
+  oldest sample is dropped when the queue is full. The log keeps no
+  prediction or link statistics, the backend classifies logged samples
+  itself.
+
+  Each sample carries the time it was taken, from SNTP, so samples sent late
+  are stored at the right time. timestamp is left out until the clock is set.
+*******************************************************************************************************/
+
+#pragma once
+
+#include <Arduino.h>
+#include <LTLinkStats.h>
+
+#define UplinkQueueSize  32      // samples held in RAM
+#define UplinkBatchMax   16      // samples per POST, the backend accepts up to 64
+#define UplinkMaxWaitmS  15000   // oldest sample waits at most this long for a batch to fill
+#define UplinkRetrymS    5000    // wait after a failed POST
+#define UplinkJSONSize   6400    // UplinkBatchMax samples of up to 400 characters
+
+#define UplinkLogFRAM    1       // FM24CL64 FRAM on I2C, SDA 21 and SCL 22, 0 if not fitted
+#define UplinkFRAMAddr   0x50
+#define UplinkFRAMEnd    8191    // last address of the FRAM used for the log
+
+#define UplinkNoSoil     -1      // soilPct of a sample without a soil reading
+#define UplinkNoPrediction -1    // prediction of a sample left to the backend
+
+struct UplinkSample
+{
+  uint16_t node;       // NetworkID of the wristband
+  uint8_t  schema;     // feature schema of the sample, LTFeatures.h
+  uint32_t time;       // seconds since 1970 when queued, 0 if the clock is not set
+  float    tempC;
+  float    humAir;
+  int8_t   soilPct;    // UplinkNoSoil if not read
+  int16_t  rssi;
+  int8_t   snr;
+  int8_t   prediction; // class from LTForest.h on the hub, UplinkNoPrediction if not classified
+  uint8_t  linkSamples; // ACKs the link statistics are over, 0 to send none
+  uint8_t  lossPct;
+  LTLinkSummary rssiStats;
+  LTLinkSummary snrStats;
+};
+
+void     uplinkBegin(const char *url, uint32_t modelID);   // modelID is LTForestModelID
+bool     uplinkAdd(const UplinkSample &sample);   // false if a sample had to be dropped
+void     uplinkService();                         // call from loop()
+void     uplinkFlush();                           // send the queue without waiting for a batch
+uint16_t uplinkPending();                         // samples queued and in the offline log
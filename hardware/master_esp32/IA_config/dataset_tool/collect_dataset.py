@@ -3,13 +3,17 @@ SIESPRO - Dataset Acquisition Tool
 Reads CSV lines from the master ESP32 via Serial and writes labeled samples
 to a CSV file for offline Random Forest training.
 
-Active sensor config: 2 sensors — DHT11 (temperature + humidity)
-Expected Serial format: temp_C,hum_air_pct,rssi_dBm,snr_dB
+Sensor config: the feature schema of the firmware, FeatureSchema in
+IA_config/src/main.cpp. The columns of each schema come from features.py,
+generated with LTFeatures.h of the firmware from hardware/schema/features.json,
+so nothing here changes with the sensors. The schema is taken from the
+"Schema,N" line the master prints at start up, or from the number of fields
+of the first sample, or given on the command line:
 
-To enable 3-sensor config (+ HW-080 soil moisture):
-  uncomment all lines marked with [3S]
-  Expected format becomes: temp_C,hum_air_pct,soil_moisture_pct,rssi_dBm,snr_dB
-  Note: firmware must also have [3S] lines enabled.
+  python collect_dataset.py [schema id]
+
+Expected Serial format (2S): temp_C,hum_air_pct,rssi_dBm,snr_dB
+Expected Serial format (3S): temp_C,hum_air_pct,soil_moisture_pct,rssi_dBm,snr_dB
 
 Controls:
   s         start recording
@@ -31,18 +35,15 @@ import tty
 import os
 import time
 
+from features import SCHEMAS, schema_dataset_columns, schema_for_field_count
+
 # ===================== Serial Configuration =====================
-PORT     = "/dev/ttyUSB0"   # [3S] was /dev/ttyACM0 in 3-sensor tests
-BAUD     = 115200            # [3S] was 9600 in 3-sensor tests; must match firmware
+PORT     = "/dev/ttyUSB0"   # was /dev/ttyACM0 in the 3-sensor tests
+BAUD     = 115200            # was 9600 in the 3-sensor tests; must match firmware
 CSV_FILE = "mediciones_loRa.csv"
 
 # ===================== Sampling =====================
 SAMPLE_INTERVAL = 3.0        # seconds between accepted samples (matches firmware delay)
-# [3S] SAMPLE_INTERVAL = 0    # 3S firmware has no sleep; remove throttle if needed
-
-# ===================== Expected field count =====================
-EXPECTED_FIELDS = 4          # temp, hum_air, rssi, snr
-# [3S] EXPECTED_FIELDS = 5   # temp, hum_air, soil, rssi, snr
 
 
 def get_key_nonblocking():
@@ -52,31 +53,47 @@ def get_key_nonblocking():
     return None
 
 
-def write_header(file_obj, writer):
-    """Write CSV header if file is empty."""
+def header_row(schema_id):
+    """CSV header of a dataset file of the schema."""
+    return ["timestamp_iso"] + schema_dataset_columns(schema_id) + ["label"]
+
+
+def check_header(file_obj, schema_id):
+    """
+    Write the CSV header if the file is empty, else check the file was
+    recorded with the same schema. Returns False if it was not.
+    """
     file_obj.seek(0, os.SEEK_END)
     if file_obj.tell() == 0:
-        writer.writerow([
-            "timestamp_iso",
-            "temp_C",
-            "hum_aire_pct",
-            # [3S] "hum_tierra_pct",
-            "rssi_dBm",
-            "snr_dB",
-            "label"
-        ])
+        csv.writer(file_obj).writerow(header_row(schema_id))
         file_obj.flush()
+        return True
+
+    file_obj.seek(0)
+    first = next(csv.reader(file_obj), [])
+    file_obj.seek(0, os.SEEK_END)
+    return first == header_row(schema_id)
 
 
-def parse_line(line):
+def parse_schema(line):
+    """Schema id of a "Schema,N" line from the master, None for other lines."""
+    parts = line.split(",")
+    if len(parts) == 2 and parts[0] == "Schema" and parts[1].isdigit():
+        return int(parts[1])
+    return None
+
+
+def parse_line(line, schema_id):
     """
     Parse a CSV line from Serial.
-    Returns a tuple of floats or None on failure.
-    Expected (2S): temp, hum_air, rssi, snr
-    Expected (3S): temp, hum_air, soil, rssi, snr
+    Returns a tuple of floats or None on failure, one per feature of the
+    schema in its order, or of any schema if schema_id is None.
     """
     parts = line.split(",")
-    if len(parts) != EXPECTED_FIELDS:
+    if schema_id is None:
+        if schema_for_field_count(len(parts)) is None:
+            return None
+    elif len(parts) != len(SCHEMAS[schema_id]["features"]):
         return None
     try:
         return tuple(float(p) for p in parts)
@@ -85,18 +102,8 @@ def parse_line(line):
 
 
 def build_row(timestamp, values, label):
-    """Build CSV row from parsed values."""
-    temp, hum_air, rssi, snr = values          # 2S
-    # [3S] temp, hum_air, soil, rssi, snr = values
-    return [
-        timestamp,
-        temp,
-        hum_air,
-        # [3S] soil,
-        rssi,
-        snr,
-        label
-    ]
+    """Build CSV row from parsed values, already in the order of the header."""
+    return [timestamp, *values, label]
 
 
 def main():
@@ -109,8 +116,16 @@ def main():
              open(CSV_FILE, "a+", newline="") as f:
 
             writer = csv.writer(f)
-            write_header(f, writer)
+            schema_id = int(sys.argv[1]) if len(sys.argv) > 1 else None
+            if schema_id is not None and schema_id not in SCHEMAS:
+                print(f"Unknown schema {schema_id}, known: {sorted(SCHEMAS)}")
+                return
+
+            if schema_id is not None and not check_header(f, schema_id):
+                print(f"{CSV_FILE} was recorded with another schema")
+                return
 
+            header_checked = schema_id is not None
             recording = False
             label     = 0
             print("Controls: s=start  p=pause  q=quit  [Space]=toggle label")
@@ -143,11 +158,32 @@ def main():
                 if not line:
                     continue
 
-                values = parse_line(line)
+                announced = parse_schema(line)
+                if announced is not None:
+                    if schema_id is not None and announced != schema_id:
+                        print(f"Master sends schema {announced}, recording schema {schema_id}, stopping")
+                        break
+                    if announced not in SCHEMAS:
+                        print(f"Master sends schema {announced}, unknown to features.py, stopping")
+                        break
+                    schema_id = announced
+                    continue
+
+                values = parse_line(line, schema_id)
                 if values is None:
                     print(f"Skipped (invalid): {line}")
                     continue
 
+                if schema_id is None:
+                    schema_id = schema_for_field_count(len(values))
+
+                if not header_checked:
+                    if not check_header(f, schema_id):
+                        print(f"{CSV_FILE} was recorded with another schema")
+                        break
+                    header_checked = True
+                    print(f"Schema {schema_id} ({SCHEMAS[schema_id]['name']}): {', '.join(header_row(schema_id))}")
+
                 timestamp = datetime.now().isoformat()
                 row = build_row(timestamp, values, label)
                 writer.writerow(row)
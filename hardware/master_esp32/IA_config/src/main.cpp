@@ -8,17 +8,21 @@
         On each successful TX+ACK cycle, outputs a single CSV line via Serial
         consumed by collect_dataset.py for offline Random Forest training.
 
-  Active sensor config: 2 sensors — DHT11 (temperature + humidity)
-  Serial output format: temp_C,hum_air_pct,rssi_dBm,snr_dB
-
-  To enable 3-sensor config (+ HW-080 soil moisture):
-    uncomment all lines marked with [3S]
-    Output becomes: temp_C,hum_air_pct,soil_moisture_pct,rssi_dBm,snr_dB
-    Note: collect_dataset.py must also have [3S] lines enabled.
+  Sensors: FeatureSchema picks the sensors fitted, a schema of LTFeatures.h,
+           generated from hardware/schema/features.json with the tables of
+           collect_dataset.py. LTSchema2S is the DHT11 (temperature +
+           humidity), LTSchema3S adds the HW-080 soil moisture. The output
+           columns follow the schema, collect_dataset.py tells the schema
+           from the number of fields, or from the Schema line at start up.
+           Output (2S): temp_C,hum_air_pct,rssi_dBm,snr_dB
+           Output (3S): temp_C,hum_air_pct,soil_moisture_pct,rssi_dBm,snr_dB
 *******************************************************************************************************/
 
 #include <SPI.h>
 #include <SX127XLT.h>
+#include <LTAirtime.h>
+#include <LTLoRaConfig.h>
+#include <LTFeatures.h>
 #include <Arduino.h>
 #include "DHT.h"
 
@@ -35,38 +39,51 @@ SX127XLT LT;
 #define LORA_DEVICE DEVICE_SX1278
 #define TXpower     10
 
+// 434 MHz (SX1278 433 MHz band), SF7, BW125, CR4/5, LDRO auto, the register
+// image is worked out by the compiler, see LTLoRaConfig.h
+typedef LTLoRaConfig<434000000, 7, 125000, 5> RadioConfig;
+
 // ===================== Reliable Packet / AutoACK Parameters =====================
-#define ACKtimeout 1000    // ms to wait for ACK after transmission
-#define TXtimeout  1000    // ms timeout for TX operation
+#define ACKdelay   100     // ms the slave waits before sending the ACK
 #define TXattempts 10      // max retransmission attempts before giving up
 
 const uint16_t NetworkID = 0x3210;  // Must match slave node
 
+// ===================== Feature Schema =====================
+#define FeatureSchema LTSchema2S   // LTSchema2S DHT11, LTSchema3S DHT11 + HW-080, LTFeatures.h
+typedef LTSchema<FeatureSchema> Schema;
+
 // ===================== LoRa Payload =====================
 // LoRa is used only for link quality evaluation (RSSI, SNR from ACK).
 // Sensor data is NOT transported via LoRa.
 uint8_t  buff[] = "Hello World";
 uint16_t PayloadCRC;
 uint8_t  TXPacketL;
+uint32_t ACKtimeout;        // ms to wait for ACK after transmission, from the airtime in setup()
+uint32_t TXtimeout;         // ms timeout for TX operation
 
 // ===================== DHT11 — Air Temperature & Humidity =====================
 #define DHTPIN  17
 #define DHTTYPE DHT11
 DHT dht(DHTPIN, DHTTYPE);
 
-// ===================== [3S] HW-080 — Soil Moisture =====================
-// [3S] const int soilSensorPin = 33;
-// [3S] int       soilPercent   = 0;
+// ===================== HW-080 — Soil Moisture, LTSchema3S =====================
+const int soilSensorPin = 33;
+int       soilPercent   = 0;
 
 // ===================== Last Valid Sensor Sample =====================
 float lastT            = NAN;
 float lastH            = NAN;
-// [3S] int lastSoil    = 0;
+int   lastSoil         = 0;
 bool  lastSensorsValid = false;
 
 int16_t AckRSSI = 0;
 int8_t  AckSNR  = 0;
 
+// ===================== Forward Declarations =====================
+void printSchema();
+void printCSV(int16_t rssi, int8_t snr);
+
 
 void setup()
 {
@@ -75,7 +92,11 @@ void setup()
   Serial.println(F("SIESPRO Master - LoRa Dataset Acquisition (ESP32)"));
 
   dht.begin();
-  // [3S] pinMode(soilSensorPin, INPUT);
+
+  if (Schema::has(LTFeatureSoil))
+  {
+    pinMode(soilSensorPin, INPUT);
+  }
 
   SPI.begin(LORA_SCK, LORA_MISO, LORA_MOSI, NSS);
 
@@ -90,19 +111,15 @@ void setup()
     while (1) { delay(2000); }
   }
 
-  LT.setupLoRa(
-      434000000,    // carrier frequency (Hz) — SX1278 433 MHz band
-      0,            // frequency offset
-      LORA_SF7,     // spreading factor
-      LORA_BW_125,  // bandwidth
-      LORA_CR_4_5,  // coding rate
-      LDRO_AUTO     // low data rate optimization
-  );
+  LT.applyConfig(RadioConfig::SX127X);   // the registers setupLoRa() would leave, written in bursts
+  LT.setReliableConfig(ReliableSequence);   // a packet sent again keeps its sequence number, so the slave does not take it twice
+
+  ACKtimeout = LTAirtimeACKTimeoutmS(ACKdelay, LT.getTimeOnAiruS(ReliableACKLinkL));   // the slave ACKs with its RSSI and SNR
+  TXtimeout  = LTAirtimeTXTimeoutmS(LT.getTimeOnAiruS(sizeof(buff) + ReliableSequenceL));
 
   Serial.println(F("Transmitter ready"));
   Serial.println();
-  Serial.println(F("Output: temp_C,hum_air_pct,rssi_dBm,snr_dB"));
-  // [3S] Serial.println(F("Output: temp_C,hum_air_pct,soil_moisture_pct,rssi_dBm,snr_dB"));
+  printSchema();
   Serial.println();
 }
 
@@ -119,10 +136,14 @@ void loop()
   }
   else
   {
-    // [3S] soilPercent = map(analogRead(soilSensorPin), 4092, 0, 0, 100);
+    if (Schema::has(LTFeatureSoil))
+    {
+      soilPercent = map(analogRead(soilSensorPin), 4092, 0, 0, 100);
+    }
+
     lastT = t;
     lastH = h;
-    // [3S] lastSoil = soilPercent;
+    lastSoil = soilPercent;
     lastSensorsValid = true;
   }
 
@@ -151,11 +172,7 @@ void loop()
       // ===================== CSV Output — single line for collect_dataset.py =====================
       if (lastSensorsValid)
       {
-        Serial.print(lastT, 2);   Serial.print(F(","));
-        Serial.print(lastH, 2);   Serial.print(F(","));
-        // [3S] Serial.print(lastSoil); Serial.print(F(","));
-        Serial.print(AckRSSI);    Serial.print(F(","));
-        Serial.println(AckSNR);
+        printCSV(AckRSSI, AckSNR);
       }
     }
 
@@ -165,3 +182,41 @@ void loop()
 
   delay(5000);
 }
+
+
+// ===================== Schema + CSV Output =====================
+// The columns and values follow the schema, in its order, so they match the
+// dataset tool and the backend generated from the same features.json.
+void printSchema()
+{
+  Serial.print(F("Schema,"));
+  Serial.println(FeatureSchema);
+  Serial.print(F("Output: "));
+
+  for (uint8_t index = 0; index < Schema::features; index++)
+  {
+    Serial.print(index ? F(",") : F(""));
+    Serial.print(LTFeatureTable[LTSchemaFeature(FeatureSchema, index) - 1].column);
+  }
+
+  Serial.println();
+}
+
+void printCSV(int16_t rssi, int8_t snr)
+{
+  for (uint8_t index = 0; index < Schema::features; index++)
+  {
+    Serial.print(index ? F(",") : F(""));
+
+    switch (LTSchemaFeature(FeatureSchema, index))
+    {
+      case LTFeatureTemperature: Serial.print(lastT, 2); break;
+      case LTFeatureHumidity:    Serial.print(lastH, 2); break;
+      case LTFeatureSoil:        Serial.print(lastSoil); break;
+      case LTFeatureRSSI:        Serial.print(rssi);     break;
+      case LTFeatureSNR:         Serial.print(snr);      break;
+    }
+  }
+
+  Serial.println();
+}
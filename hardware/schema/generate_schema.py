@@ -0,0 +1,340 @@
+"""
+SIESPRO - Feature Schema Generator
+Emits the feature schema in features.json, the one place the features of the
+Random Forest and the sets of them a node can send are defined, as:
+
+  library/SX12XX-LoRa-master/src/LTFeatures.h          firmware, constexpr tables
+  master_esp32/IA_config/dataset_tool/features.py      dataset tool
+  ../frontend_backend/my_iot_project/app/core/features.py   backend and training
+
+Run it after changing features.json and commit the generated files with it.
+
+Usage:
+  python generate_schema.py           write the generated files
+  python generate_schema.py --check   exit 1 if a generated file is out of step
+"""
+
+import json
+import os
+import sys
+
+HERE     = os.path.dirname(os.path.abspath(__file__))
+HARDWARE = os.path.dirname(HERE)
+REPO     = os.path.dirname(HARDWARE)
+SOURCE   = os.path.join(HERE, "features.json")
+
+HEADER_PATH  = os.path.join(HARDWARE, "library", "SX12XX-LoRa-master", "src", "LTFeatures.h")
+PYTHON_PATHS = [  # path, line ending of the files around it
+    (os.path.join(HARDWARE, "master_esp32", "IA_config", "dataset_tool", "features.py"), "\n"),
+    (os.path.join(REPO, "frontend_backend", "my_iot_project", "app", "core", "features.py"), "\r\n"),
+]
+
+TYPES = {          # type: (LTFeatures.h define, bytes in the frame)
+    "int8":   ("LTFeatureInt8",   1),
+    "uint8":  ("LTFeatureUint8",  1),
+    "int16":  ("LTFeatureInt16",  2),
+    "uint16": ("LTFeatureUint16", 2),
+}
+
+MIT_LICENSE = """/*
+  MIT license
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+  associated documentation files (the "Software"), to deal in the Software without restriction, including
+  without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the
+  following conditions:
+
+  The above copyright notice and this permission notice shall be included in all copies or substantial
+  portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+  LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO
+  EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+  IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE
+  USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+"""
+
+
+def load():
+    """Read features.json and check it, ids 1 up in order, known types, schemas of known features."""
+    with open(SOURCE, encoding="utf-8") as f:
+        spec = json.load(f)
+
+    features = spec["features"]
+    schemas  = spec["schemas"]
+
+    for index, feature in enumerate(features):
+        if feature["id"] != index + 1:
+            sys.exit(f"features.json: feature ids must run 1, 2, 3.., {feature['symbol']} is {feature['id']}")
+        if feature["type"] not in TYPES:
+            sys.exit(f"features.json: {feature['symbol']} has unknown type {feature['type']}")
+        if not 1 <= feature["scale"] <= 255:
+            sys.exit(f"features.json: {feature['symbol']} scale must be 1 to 255")
+
+    for index, schema in enumerate(schemas):
+        if schema["id"] != index + 1:
+            sys.exit(f"features.json: schema ids must run 1, 2, 3.., {schema['name']} is {schema['id']}")
+        for feature_id in schema["features"]:
+            if not 1 <= feature_id <= len(features):
+                sys.exit(f"features.json: schema {schema['name']} has unknown feature {feature_id}")
+        if len(set(schema["features"])) != len(schema["features"]):
+            sys.exit(f"features.json: schema {schema['name']} lists a feature twice")
+
+    for key in ("model_schema", "default_schema"):
+        if not 1 <= spec[key] <= len(schemas):
+            sys.exit(f"features.json: {key} is not a schema")
+
+    return spec
+
+
+def frame_bytes(spec, schema):
+    """Bytes the sensor features of a schema take in a telemetry frame, the link ones are not sent."""
+    features = spec["features"]
+    return sum(TYPES[features[i - 1]["type"]][1] for i in schema["features"] if not features[i - 1]["link"])
+
+
+def header(spec):
+    features = spec["features"]
+    schemas  = spec["schemas"]
+    widest   = max(len(s["features"]) for s in schemas)
+    names    = {s["id"]: s["name"] for s in schemas}
+    out      = []
+
+    out.append("""/*
+  Licensed under a MIT license displayed at the bottom of this document.
+  Original published 16/10/26, feature schema
+
+  Generated by hardware/schema/generate_schema.py from hardware/schema/features.json, do not edit.
+*/
+
+/*
+  The features the Random Forest is trained on and the schemas, the sets of them a node can send. Each
+  feature has an id, the type and fixed point scale it is sent at in an LTTelemetry.h frame, the JSON key
+  the backend knows it by and the column it has in the serial CSV. The RSSI and SNR are link features,
+  measured by the radio of the master, not sent in the frame.
+
+  A firmware picks its schema at compile time and asks the tables what it has, LTSchema<schema>::has()
+  and the constexpr functions below fold to constants, so a feature not in the schema costs no code. The
+  schema id goes in byte 1 of each telemetry frame and in each sample sent to the backend, so the
+  receiver knows which features the sample has without being built for the same schema.
+
+  The dataset tool and the backend have the same tables in features.py, generated from the same file.
+*/
+
+#ifndef LTFeatures_h
+#define LTFeatures_h
+
+#include <Arduino.h>
+""")
+
+    out.append("#define LTFeatureInt8 0                       //feature types")
+    out.append("#define LTFeatureUint8 1")
+    out.append("#define LTFeatureInt16 2")
+    out.append("#define LTFeatureUint16 3")
+    out.append("")
+
+    for feature in features:
+        define = f"#define LTFeature{feature['symbol']} {feature['id']}"
+        out.append(f"{define:<46}//{feature['key']}, {feature['unit']}")
+    out.append(f"#define LTFeatureCount {len(features)}")
+    out.append("")
+
+    for schema in schemas:
+        define = f"#define LTSchema{schema['name']} {schema['id']}"
+        out.append(f"{define:<46}//{schema['sensors']}")
+    out.append(f"#define LTSchemaCount {len(schemas)}")
+    out.append(f"#define LTSchemaMaxFeatures {widest}")
+    define = f"#define LTSchemaMaxFrameBytes {max(frame_bytes(spec, s) for s in schemas)}"
+    out.append(f"{define:<46}//most bytes the sensor features of a schema take")
+    define = f"#define LTSchemaModel LTSchema{names[spec['model_schema']]}"
+    out.append(f"{define:<46}//schema the backend model is trained on")
+    out.append(f"#define LTSchemaDefault LTSchema{names[spec['default_schema']]}")
+    out.append("")
+    out.append("""
+struct LTFeatureInfo
+{
+  uint8_t type;
+  uint8_t scale;                              //sent as the reading times the scale
+  bool link;                                  //measured by the radio, not sent in the frame
+  const char *key;                            //JSON key of the backend
+  const char *column;                         //serial CSV column
+};
+""")
+
+    out.append("constexpr LTFeatureInfo LTFeatureTable[LTFeatureCount] =")
+    out.append("{")
+    for feature in features:
+        link = "true" if feature["link"] else "false"
+        out.append(f"  {{{TYPES[feature['type']][0]}, {feature['scale']}, {link}, "
+                   f"\"{feature['key']}\", \"{feature['serial']}\"}},")
+    out.append("};")
+    out.append("")
+
+    out.append("constexpr uint8_t LTSchemaTable[LTSchemaCount][LTSchemaMaxFeatures + 1] =")
+    out.append("{")
+    for schema in schemas:
+        ids  = schema["features"] + [0] * (widest - len(schema["features"]))
+        row  = ", ".join(str(i) for i in [len(schema["features"])] + ids)
+        out.append(f"  {{{row}}},{'':<8}//{schema['name']}, count then feature ids")
+    out.append("};")
+
+    out.append("""
+
+constexpr bool LTSchemaValid(uint8_t schema)
+{
+  return (schema >= 1) && (schema <= LTSchemaCount);
+}
+
+constexpr uint8_t LTSchemaFeatures(uint8_t schema)
+{
+  //number of features in the schema
+  return LTSchemaTable[schema - 1][0];
+}
+
+constexpr uint8_t LTSchemaFeature(uint8_t schema, uint8_t index)
+{
+  //id of the feature at index, in the order of the CSV columns and the frame
+  return LTSchemaTable[schema - 1][index + 1];
+}
+
+constexpr bool LTSchemaHas(uint8_t schema, uint8_t id, uint8_t index = 0)
+{
+  return (index < LTSchemaMaxFeatures) && (index < LTSchemaFeatures(schema)) && ((LTSchemaFeature(schema, index) == id) || LTSchemaHas(schema, id, index + 1));
+}
+
+constexpr uint8_t LTFeatureBytes(uint8_t id)
+{
+  return ((LTFeatureTable[id - 1].type == LTFeatureInt16) || (LTFeatureTable[id - 1].type == LTFeatureUint16)) ? 2 : 1;
+}
+
+constexpr int32_t LTFeatureNoReading(uint8_t id)
+{
+  //value sent for a feature not read, outside the range of its type
+  return (LTFeatureTable[id - 1].type == LTFeatureInt8) ? -128 :
+         (LTFeatureTable[id - 1].type == LTFeatureUint8) ? 0xFF :
+         (LTFeatureTable[id - 1].type == LTFeatureInt16) ? -32768 : 0xFFFF;
+}
+
+constexpr uint8_t LTSchemaFrameBytes(uint8_t schema, uint8_t index = 0)
+{
+  //bytes the sensor features of the schema take in a telemetry frame
+  return ((index < LTSchemaMaxFeatures) && (index < LTSchemaFeatures(schema))) ?
+         ((LTFeatureTable[LTSchemaFeature(schema, index) - 1].link ? 0 : LTFeatureBytes(LTSchemaFeature(schema, index))) +
+          LTSchemaFrameBytes(schema, index + 1)) : 0;
+}
+
+
+template <uint8_t schema>
+struct LTSchema
+{
+  static_assert(LTSchemaValid(schema), "unknown feature schema, see hardware/schema/features.json");
+
+  static constexpr uint8_t features = LTSchemaFeatures(schema);
+  static constexpr uint8_t frameBytes = LTSchemaFrameBytes(schema);
+
+  static constexpr bool has(uint8_t id)
+  {
+    return LTSchemaHas(schema, id);
+  }
+};
+""")
+
+    for schema in schemas:
+        out.append(f"static_assert(LTSchemaFrameBytes(LTSchema{schema['name']}) == {frame_bytes(spec, schema)}, "
+                   "\"LTFeatures.h out of step with features.json\");")
+
+    out.append("")
+    out.append("#endif")
+    out.append("")
+    out.append(MIT_LICENSE)
+    return "\n".join(out)
+
+
+def python(spec):
+    features = spec["features"]
+    out      = []
+
+    out.append('"""')
+    out.append("SIESPRO - Feature Schema")
+    out.append("Generated by hardware/schema/generate_schema.py from hardware/schema/features.json, do not edit.")
+    out.append("")
+    out.append("The features the Random Forest is trained on and the schemas, the sets of them")
+    out.append("a node can send, the same tables the firmware builds against in LTFeatures.h.")
+    out.append('"""')
+    out.append("")
+    out.append("FEATURES = {")
+    for feature in features:
+        out.append(f"    {feature['id']}: {{\"key\": \"{feature['key']}\", \"serial\": \"{feature['serial']}\", "
+                   f"\"dataset\": \"{feature['dataset']}\", \"type\": \"{feature['type']}\", "
+                   f"\"scale\": {feature['scale']}, \"link\": {feature['link']}}},")
+    out.append("}")
+    out.append("")
+    out.append("SCHEMAS = {")
+    for schema in spec["schemas"]:
+        out.append(f"    {schema['id']}: {{\"name\": \"{schema['name']}\", \"sensors\": \"{schema['sensors']}\", "
+                   f"\"features\": {schema['features']}}},")
+    out.append("}")
+    out.append("")
+    out.append(f"MODEL_SCHEMA   = {spec['model_schema']}      # schema the backend model is trained on")
+    out.append(f"DEFAULT_SCHEMA = {spec['default_schema']}")
+    out.append('''
+
+def schema_keys(schema_id):
+    """Backend JSON keys of the features of a schema, in order."""
+    return [FEATURES[i]["key"] for i in SCHEMAS[schema_id]["features"]]
+
+
+def schema_serial_columns(schema_id):
+    """Columns of the CSV line the master prints for a schema."""
+    return [FEATURES[i]["serial"] for i in SCHEMAS[schema_id]["features"]]
+
+
+def schema_dataset_columns(schema_id):
+    """Columns of the dataset CSV for a schema, between timestamp_iso and label."""
+    return [FEATURES[i]["dataset"] for i in SCHEMAS[schema_id]["features"]]
+
+
+def dataset_to_key():
+    """Dataset CSV column to backend JSON key, for every feature."""
+    return {f["dataset"]: f["key"] for f in FEATURES.values()}
+
+
+def schema_for_field_count(count):
+    """Schema with count features, None if none or more than one has."""
+    found = [i for i, s in SCHEMAS.items() if len(s["features"]) == count]
+    return found[0] if len(found) == 1 else None
+''')
+    return "\n".join(out)
+
+
+def main():
+    spec    = load()
+    outputs = [(HEADER_PATH, header(spec), "\n")] + [(path, python(spec), ending) for path, ending in PYTHON_PATHS]
+    check   = "--check" in sys.argv[1:]
+    stale   = 0
+
+    for path, text, ending in outputs:
+        text    = text.replace("\n", ending)
+        current = None
+        if os.path.exists(path):
+            with open(path, encoding="utf-8", newline="") as f:
+                current = f.read()
+
+        if current == text:
+            continue
+
+        if check:
+            print(f"out of step: {os.path.relpath(path, REPO)}")
+            stale += 1
+        else:
+            with open(path, "w", encoding="utf-8", newline="") as f:
+                f.write(text)
+            print(f"wrote {os.path.relpath(path, REPO)}")
+
+    return 1 if stale else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -2,14 +2,59 @@
   SIESPRO - LoRa Slave Node (ESP32-C3 Mini)
   Reliable packet reception with AutoACK using the SX12XX library by Stuart Robinson.
   Reference: example 210_Reliable_Receiver_AutoACK
-  
+
   Role: Passive node. Listens for LoRa packets from the master and responds
         with automatic ACK frames. No sensor acquisition on this node.
-        Link quality (RSSI, SNR) is extracted by the master from the ACK.
+        Link quality (RSSI, SNR) is extracted by the master from the ACK,
+        and the ACK carries back the RSSI and SNR this node received the
+        packet at (ReliableACKLink). The API_config master sends an
+        LTTelemetry.h frame, printed decoded by the feature schema it
+        carries, other masters a probe string.
+        NODE_ADDRESS is the NetworkID of this wristband, each wristband of a
+        hub needs its own, listed in NodeAddresses of the API_config master.
+        It is 0 to 0x7FFF, bit 15 marks the packets with a sequence number.
+
+  RX:   DIO0 going high (RX done or TX done) wakes radioTask, which runs the
+        non blocking receiveReliableAutoACK() of the library, pollReliable(),
+        and receives each packet straight into a slot of an LTRXQueue.h queue.
+        The ACK goes out ACKdelay after the packet whatever loop() is doing,
+        loop() takes the packets from the queue and prints them. The SPI bus
+        is only used by radioTask, the ISR does nothing but wake it. With
+        every slot full the node stops receiving, the packets it misses are
+        not ACKed and the master sends them again. Packets carry a sequence
+        number (ReliableSequence), a packet sent again because its ACK was
+        lost is ACKed again by the library and not queued a second time.
+        Packets from masters without ReliableSequence are taken as before.
+
+  ADR:  a master running API_config sends an LTADR.h request in place of the
+        probe payload when the link calls for another SF, bandwidth or TX
+        power. The new settings are applied once the ACK has gone, the ACKs
+        use the negotiated TX power. After the first request, FallbackmS
+        without a valid packet puts the node on the fallback settings,
+        SF12 at 17 dBm, where the master looks for it.
+
+  Listen: with LISTEN_PERIOD_MS set, LTListen.h, the node does not stay in
+        RX. It puts the LoRa device to sleep, and itself into light sleep
+        when loop() has nothing left to print, and wakes once a period for
+        a CAD. Only a preamble found by the CAD starts a receive. The master
+        must send with a preamble as long as the period, ListenPeriodmS of
+        API_config set to the same value. 0 keeps the node always in RX, as
+        the ACK_config and IA_config masters need.
+
+  Wake: each time the radio is set up its registers are saved to RTC memory
+        with saveSnapshot(), with the ADR settings. A node woken from deep
+        sleep comes back through setup(), beginFromSnapshot() then checks
+        the LoRa device kept its settings in sleep mode and the reset, the
+        1000 ms wait and setupLoRa() are skipped. After a power on, or with
+        the device reset, the node starts as before.
 *******************************************************************************************************/
 
 #include <SPI.h>
 #include <SX127XLT.h>
+#include <LTADR.h>
+#include <LTRXQueue.h>
+#include <LTListen.h>
+#include <LTTelemetry.h>
 
 SX127XLT LT;
 
@@ -22,29 +67,70 @@ SX127XLT LT;
 #define DIO0       2
 
 #define LORA_DEVICE DEVICE_SX1278
+#define Frequency   434000000  // SX1278 433 MHz band
+#define ADRstartRate 5         // SF7 BW125, must match the master
 
 // ===================== Reliable Packet / AutoACK Parameters =====================
 #define ACKdelay  100      // ms before sending ACK after valid reception
 #define RXtimeout 60000    // ms to wait for incoming packet before timeout
-#define TXpower   2        // ACK transmit power in dBm
+#define TXpower   2        // ACK transmit power in dBm, ADR start power
+#define FallbackmS 90000   // ms without a packet before going to the ADR fallback settings,
+                           // three polls at the master StablemS
+
+#define NODE_ADDRESS 0x3210            // unique per wristband, 0x3210 for ACK_config and IA_config
+const uint16_t NetworkID = NODE_ADDRESS;  // Must match master node
+static_assert((NODE_ADDRESS & ReliableSequenceID) == 0, "NODE_ADDRESS is 0 to 0x7FFF, bit 15 is ReliableSequenceID");
+
+// ===================== Receive Queue =====================
+#define RXQueueSlots   8       // packets held for loop(), a power of 2, 260 bytes each
+#define RadioPriority  2       // above loop(), which runs at 1
+#define RadioWaitmS    100     // longest wait for DIO0, RX timeouts are checked this often
 
-const uint16_t NetworkID = 0x3210;  // Must match master node
+// ===================== Duty Cycled Listen =====================
+#define LISTEN_PERIOD_MS 0     // ms between CADs, 0 stays in RX. ListenPeriodmS of the master
 
-const uint8_t RXBUFFER_SIZE = 251;
-uint8_t RXBUFFER[RXBUFFER_SIZE];
+LTRXQueue<RXQueueSlots> RXQueue;
+TaskHandle_t radioTaskHandle;
+LTListen     Listen;             // owned by radioTask once it runs
 
-uint8_t  RXPacketL;
-uint8_t  RXPayloadL;
-uint8_t  PacketOK;
-int16_t  PacketRSSI;
-uint16_t LocalPayloadCRC;
-uint16_t RXPayloadCRC;
-uint16_t TransmitterNetworkID;
+LTADR    ADR;                    // owned by radioTask once it runs
+bool     ADRrequested = false;   // fall back only with a master that does ADR
+uint32_t lastPacketmS;
+
+// ===================== Deep Sleep Wake =====================
+// kept through a deep sleep, not a power on, written by setupRadio()
+RTC_DATA_ATTR LTSX127XSnapshot RadioSnapshot;
+RTC_DATA_ATTR uint8_t RadioRate;
+RTC_DATA_ATTR int8_t  RadioTXpower;
+RTC_DATA_ATTR bool    RadioADRrequested;
+
+// written by radioTask, read by loop()
+volatile uint32_t RXErrors = 0;
+volatile uint32_t RXTimeouts = 0;
+volatile uint32_t RXDuplicates = 0;
+volatile bool     ADRchanged = false;
 
 // ===================== Forward Declarations =====================
-void packet_is_OK();
-void packet_is_Error();
-void printPacketDetails();
+void radioTask(void *parameter);
+bool listenCycle();
+uint32_t receiveTimeout();
+void packetReceived(LTRXPacket *packet);
+void packetFailed();
+void checkFallback();
+bool processADR(LTRXPacket *packet);
+void setupRadio();
+void printPacket(LTRXPacket *packet);
+void printADR();
+
+void IRAM_ATTR DIO0_ISR()
+{
+  BaseType_t woken = pdFALSE;
+
+  vTaskNotifyGiveFromISR(radioTaskHandle, &woken);
+
+  if (woken)
+    portYIELD_FROM_ISR();
+}
 
 void setup()
 {
@@ -54,25 +140,42 @@ void setup()
 
   SPI.begin(LORA_SCK, LORA_MISO, LORA_MOSI, NSS);
 
-  if (LT.begin(NSS, NRESET, DIO0, LORA_DEVICE))
+  // SF7, BW125, CR 4/5, LDRO auto at the ADR start rate
+  ADR.begin(ADRstartRate, TXpower);
+  Listen.begin(LISTEN_PERIOD_MS, LTADR::getSymbolTimeuS(ADR.getRate()));
+
+  if ((esp_sleep_get_wakeup_cause() != ESP_SLEEP_WAKEUP_UNDEFINED) &&
+      LT.beginFromSnapshot(NSS, NRESET, DIO0, LORA_DEVICE, RadioSnapshot))
   {
-    Serial.println(F("LoRa device found"));
-    delay(1000);
+    // woken from deep sleep, the LoRa device is set up as the snapshot
+    Serial.println(F("LoRa device kept its settings"));
+    ADR.apply(RadioRate, RadioTXpower);
+    ADRrequested = RadioADRrequested;
+    Listen.setSymbolTime(LTADR::getSymbolTimeuS(ADR.getRate()));
   }
   else
   {
-    Serial.println(F("No LoRa device responding"));
-    while (1) { delay(2000); }
+    if (LT.begin(NSS, NRESET, DIO0, LORA_DEVICE))
+    {
+      Serial.println(F("LoRa device found"));
+      delay(1000);
+    }
+    else
+    {
+      Serial.println(F("No LoRa device responding"));
+      while (1) { delay(2000); }
+    }
+
+    setupRadio();
   }
 
-  LT.setupLoRa(
-      434000000,    // carrier frequency (Hz) — SX1278 433 MHz band
-      0,            // frequency offset
-      LORA_SF7,     // spreading factor
-      LORA_BW_125,  // bandwidth
-      LORA_CR_4_5,  // coding rate
-      LDRO_AUTO     // low data rate optimization
-  );
+  LT.setReliableConfig(ReliableACKLink);   // ACKs carry the RSSI and SNR of the packet
+  LT.setReliableConfig(ReliableSequence);  // packets sent again after a lost ACK are ACKed again, not queued twice
+  lastPacketmS = millis();
+
+  // from here on only radioTask touches LT and ADR
+  xTaskCreate(radioTask, "radio", 4096, NULL, RadioPriority, &radioTaskHandle);
+  attachInterrupt(digitalPinToInterrupt(DIO0), DIO0_ISR, RISING);
 
   Serial.println(F("Receiver ready"));
   Serial.println();
@@ -80,58 +183,254 @@ void setup()
 
 void loop()
 {
-  PacketOK = LT.receiveReliableAutoACK(
-      RXBUFFER,
-      RXBUFFER_SIZE,
-      NetworkID,
-      ACKdelay,
-      TXpower,
-      RXtimeout,
-      WAIT_RX
-  );
-
-  RXPacketL  = LT.readRXPacketL();
-  RXPayloadL = RXPacketL - 4;   // subtract 2B NetworkID + 2B PayloadCRC appended by library
-  PacketRSSI = LT.readPacketRSSI();
-
-  if (PacketOK > 0)
-    packet_is_OK();
+  static uint32_t errors = 0, timeouts = 0, duplicates = 0;
+  LTRXPacket *packet = RXQueue.peek();
+
+  if (packet != NULL)
+  {
+    printPacket(packet);
+    RXQueue.pop();
+  }
+
+  if (ADRchanged)
+  {
+    ADRchanged = false;
+    printADR();
+  }
+
+  if (RXErrors != errors)
+  {
+    errors = RXErrors;
+    Serial.print(F("Error, packets not received "));
+    Serial.println(errors);
+    Serial.println();
+  }
+
+  if (RXTimeouts != timeouts)
+  {
+    timeouts = RXTimeouts;
+    Serial.println(F("Error RX timeout"));
+    Serial.println();
+  }
+
+  if (RXDuplicates != duplicates)
+  {
+    duplicates = RXDuplicates;
+    Serial.print(F("Packets ACKed again, ACK lost "));
+    Serial.println(duplicates);
+    Serial.println();
+  }
+
+  if (packet == NULL)
+    delay(1);
+}
+
+void radioTask(void *parameter)
+{
+  LTRXPacket *slot = NULL;
+  uint8_t state;
+
+  for (;;)
+  {
+    state = LT.getReliableState();
+
+    if ((state == ReliableIdle) || (state == ReliableDone) || (state == ReliableFailed))
+    {
+      slot = RXQueue.reserve();
+
+      if (slot == NULL)
+      {
+        vTaskDelay(1);   // queue full, the master resends what is missed
+        continue;
+      }
+
+      if (LISTEN_PERIOD_MS && !listenCycle())
+        continue;        // no preamble this period
+
+      LT.startReceiveReliableAutoACK(
+          slot->data,
+          sizeof(slot->data),
+          NetworkID,
+          ACKdelay,
+          ADR.getTXpower(),
+          receiveTimeout()
+      );
+    }
+
+    // DIO0 ends the wait, the ACK delay is timed to the tick
+    ulTaskNotifyTake(pdTRUE, (state == ReliableACKDelay) ? 1 : pdMS_TO_TICKS(RadioWaitmS));
+
+    state = LT.pollReliable();
+
+    if (LT.readReliableDuplicates() != RXDuplicates)
+    {
+      RXDuplicates = LT.readReliableDuplicates();
+      lastPacketmS = millis();   // the master is in range, only its ACK was lost
+    }
+
+    if (state == ReliableDone)
+      packetReceived(slot);
+    else if (state == ReliableFailed)
+      packetFailed();
+  }
+}
+
+bool listenCycle()
+{
+  // sleep until the next period, true if the CAD then finds a preamble
+  static uint32_t nextmS = millis();
+  int32_t sleepmS;
+
+  LT.setSleep(CONFIGURATION_RETENTION);
+  nextmS += LISTEN_PERIOD_MS;
+  sleepmS = (int32_t) (nextmS - millis());
+
+  if (sleepmS <= 0)
+  {
+    nextmS = millis();   // a packet took the node past its wake up
+  }
+  else if ((RXQueue.getCount() == 0) && !ADRchanged)
+  {
+    Serial.flush();      // loop() has printed everything, the whole node can sleep
+    esp_sleep_enable_timer_wakeup((uint64_t) sleepmS * 1000);
+    esp_light_sleep_start();
+  }
   else
-    packet_is_Error();
+  {
+    vTaskDelay(pdMS_TO_TICKS(sleepmS));
+  }
 
-  Serial.println();
+  LT.wake();
+
+  if (LT.doCAD())
+    return true;
+
+  checkFallback();
+  return false;
 }
 
-void packet_is_OK()
+uint32_t receiveTimeout()
 {
-  Serial.print(F("Payload OK > "));
-  LT.printASCIIPacket(RXBUFFER, RXPayloadL);
-  Serial.println();
-  printPacketDetails();
-  Serial.println();
+  if (LISTEN_PERIOD_MS)
+    return Listen.getRXTimeout();   // the rest of the preamble the CAD found
+
+  return (ADRrequested && !ADR.isFallback()) ? FallbackmS : RXtimeout;
 }
 
-void packet_is_Error()
+void packetReceived(LTRXPacket *packet)
 {
-  uint16_t IRQStatus = LT.readIrqStatus();
-  Serial.print(F("Error "));
+  // the ACK has gone, RSSI and SNR are still those of the packet
+  packet->length = LT.readReliablePayloadL();   // less the sequence number, NetworkID and PayloadCRC appended by library
+  packet->rssi   = LT.readPacketRSSI();
+  packet->snr    = LT.readPacketSNR();
+  packet->mS     = millis();
+  lastPacketmS   = packet->mS;
+
+  ADRchanged = processADR(packet) || ADRchanged;
+  RXQueue.commit();
+}
 
-  if (IRQStatus & IRQ_RX_TIMEOUT)
-    Serial.println(F("RX timeout"));
+void packetFailed()
+{
+  if (LT.readIrqStatus() & IRQ_RX_TIMEOUT)
+  {
+    RXTimeouts++;
+    checkFallback();
+  }
   else
-    printPacketDetails();
+  {
+    RXErrors++;
+  }
+}
+
+void checkFallback()
+{
+  if (ADRrequested && !ADR.isFallback() && ((uint32_t) (millis() - lastPacketmS) >= FallbackmS))
+  {
+    ADR.fallback();
+    setupRadio();
+    ADRchanged = true;
+  }
 }
 
-void printPacketDetails()
+bool processADR(LTRXPacket *packet)
 {
-  LocalPayloadCRC      = LT.CRCCCITT(RXBUFFER, RXPayloadL, 0xFFFF);
-  TransmitterNetworkID = LT.getRXNetworkID(RXPacketL);
-  RXPayloadCRC         = LT.getRXPayloadCRC(RXPacketL);
+  uint8_t rate;
+  int8_t  txpower;
+
+  if (!LTADR::readRequest(packet->data, packet->length, rate, txpower))
+    return false;
+
+  ADR.apply(rate, txpower);   // the ACK has gone, switch now
+  ADRrequested = true;
+  setupRadio();
+  return true;
+}
+
+void setupRadio()
+{
+  // the ADR rate, and the listen CAD and receive timeout for its symbol time
+  LTADRsetup(LT, Frequency, ADR.getRate());
+  Listen.setSymbolTime(LTADR::getSymbolTimeuS(ADR.getRate()));
+
+  // for a wake from deep sleep, see setup()
+  LT.saveSnapshot(RadioSnapshot);
+  RadioRate = ADR.getRate();
+  RadioTXpower = ADR.getTXpower();
+  RadioADRrequested = ADRrequested;
+}
+
+void printPacket(LTRXPacket *packet)
+{
+  // the packet and its details were stored by radioTask, nothing here uses the SPI bus
+  LTTelemetryFrame frame;
+  uint8_t index, id;
+
+  if (LTTelemetry::read(packet->data, packet->length, frame))
+  {
+    Serial.print(F("Frame OK > node 0x")); Serial.print(frame.node, HEX);
+    Serial.print(F(",schema,"));           Serial.print(frame.schema);
+    Serial.print(F(",seq,"));              Serial.print(frame.sequence);
+
+    // the readings the schema of the frame has, LTFeatures.h, none for a schema this build does not know
+    for (index = 0; LTSchemaValid(frame.schema) && (index < LTSchemaFeatures(frame.schema)); index++)
+    {
+      id = LTSchemaFeature(frame.schema, index);
+
+      if (!LTFeatureTable[id - 1].link)
+      {
+        Serial.print(F(","));
+        Serial.print(LTFeatureTable[id - 1].column);
+        Serial.print(F(","));
+        Serial.print(LTTelemetry::getReading(frame, id));
+      }
+    }
+
+    Serial.print(F(",txpower,"));          Serial.print(frame.txpower);
+    Serial.println(F("dBm"));
+  }
+  else
+  {
+    Serial.print(F("Payload OK > "));
+    LT.printASCIIPacket(packet->data, packet->length);
+    Serial.println();
+  }
 
   Serial.print(F("LocalNetworkID,0x"));   Serial.print(NetworkID, HEX);
-  Serial.print(F(",TransmitterNetworkID,0x")); Serial.print(TransmitterNetworkID, HEX);
-  Serial.print(F(",LocalPayloadCRC,0x")); Serial.print(LocalPayloadCRC, HEX);
-  Serial.print(F(",RXPayloadCRC,0x"));    Serial.print(RXPayloadCRC, HEX);
+  Serial.print(F(",LocalPayloadCRC,0x")); Serial.print(LT.CRCCCITT(packet->data, packet->length, 0xFFFF), HEX);
+  Serial.print(F(",RSSI,"));              Serial.print(packet->rssi);
+  Serial.print(F("dBm,SNR,"));            Serial.print(packet->snr);
+  Serial.print(F("dB,Queued,"));          Serial.print(RXQueue.getCount());
+  Serial.println();
+  Serial.println();
+}
 
-  LT.printReliableStatus();
-}
\ No newline at end of file
+void printADR()
+{
+  Serial.print(F("ADR SF"));
+  Serial.print(LTADR::getSF(ADR.getRate()));
+  Serial.print((LTADR::getBandwidth(ADR.getRate()) == LORA_BW_250) ? F(" BW250 ") : F(" BW125 "));
+  Serial.print(ADR.getTXpower());
+  Serial.println(F("dBm"));
+  Serial.println();
+}